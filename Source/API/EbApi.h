@@ -58,6 +58,45 @@ typedef enum EB_COLOR_FORMAT {
 #define EB_NON_REF_SLICE   4
 #define EB_INVALID_SLICE   0xFF
 
+// Per-picture statistics returned with the output packets
+typedef struct EB_H265_ENC_PICTURE_STATS
+{
+    // Quality metrics of the reconstructed picture, valid when qualityMetricsValid is set
+    unsigned char      qualityMetricsValid;
+    unsigned long long sseY;
+    unsigned long long sseCb;
+    unsigned long long sseCr;
+    double             psnrY;
+    double             psnrCb;
+    double             psnrCr;
+    double             ssimY;           // mean SSIM of the 8x8 windows on a 4-sample grid over the plane
+    double             ssimCb;
+    double             ssimCr;
+
+    // Encode statistics
+    unsigned int       bitCount;                // coded picture size in bits, headers included
+    double             averageQp;               // average LCU QP
+    unsigned char      temporalLayerIndex;
+    double             intraCuPercentage;       // share of the picture area coded with intra CUs
+    double             interCuPercentage;       // share of the picture area coded with non-skip inter CUs
+    double             skipCuPercentage;        // share of the picture area coded with skip CUs
+    double             meAverageSad;            // SAD per luma sample of the best 16x16 ME candidates (0 for I pictures)
+    unsigned char      duplicatePicture;        // identical to the previous input picture
+    unsigned char      hmeLevels;               // HME levels run by ME (bit n: level n), 0 for I pictures
+
+    // Timing in ms, measured from the picture input; each stage time includes the wait for that stage
+    double             latency;
+    double             analysisTime;            // resource coordination and picture analysis
+    double             motionEstimationTime;    // picture decision and motion estimation
+    double             rateControlTime;         // lookahead and rate control
+    double             encDecTime;              // mode decision configuration and EncDec
+    double             entropyCodingTime;
+    double             packetizationTime;       // packetization and output reordering
+
+    // ME work of the picture in ms, summed over its segments (waits excluded)
+    double             motionEstimationComputeTime;
+} EB_H265_ENC_PICTURE_STATS;
+
 typedef struct EB_BUFFERHEADERTYPE
 {
     // EB_BUFFERHEADERTYPE size
@@ -82,6 +121,12 @@ typedef struct EB_BUFFERHEADERTYPE
 
     // pic flags
     unsigned int nFlags;
+
+    // library object owning the buffer, set when the buffer is handed out by reference
+    void* wrapperPtr;
+
+    // per-picture statistics (output packets only), filled when pictureStatsEnabled is set
+    EB_H265_ENC_PICTURE_STATS* pStats;
 } EB_BUFFERHEADERTYPE;
 
 typedef struct EB_COMPONENTTYPE
@@ -244,6 +289,12 @@ typedef struct EB_H265_ENC_CONFIGURATION
 
     // Debug tools
     unsigned int              reconEnabled;
+    unsigned int              reconDecimation;              // recon output decimation factor (1: full resolution, 2: 2x2 average, 4: 4x4 average)
+    unsigned int              qualityMetricsInterval;       // compute PSNR / SSIM of every Nth picture into the output packet stats (0: OFF)
+    unsigned int              pictureStatsEnabled;          // copy the per-picture statistics into pStats of the output packets (0: OFF, pStats is ignored)
+
+    // Motion Estimation Tools
+    unsigned char             hashMotionSearch;             // look up exact 64x64 matches in a block hash index of the references before HME / full-pel search
 
 } EB_H265_ENC_CONFIGURATION;
 
@@ -306,6 +357,17 @@ EB_API EB_ERRORTYPE EbH265GetRecon(
     EB_COMPONENTTYPE      *h265EncComponent,
     EB_BUFFERHEADERTYPE   *pBuffer);
 
+/***************************************************/
+/* OPTIONAL: Get output reconstructed picture in   */
+/* place, release it with EbH265ReleaseRecon       */
+/***************************************************/
+EB_API EB_ERRORTYPE EbH265GetReconRef(
+    EB_COMPONENTTYPE      *h265EncComponent,
+    EB_BUFFERHEADERTYPE  **pBuffer);
+
+EB_API void EbH265ReleaseRecon(
+    EB_BUFFERHEADERTYPE   *pBuffer);
+
 /***************************************************/
 /******* STEP 6: De-Init the encoder libray ********/
 /***************************************************/
@@ -25,6 +25,8 @@
 #define INPUT_FILE_TOKEN                "-i"
 #define OUTPUT_BITSTREAM_TOKEN          "-b"
 #define OUTPUT_RECON_TOKEN              "-o"
+#define RECON_DECIMATION_TOKEN          "-recon-dec"
+#define QUALITY_METRICS_TOKEN           "-quality-metrics"
 #define ERROR_FILE_TOKEN                "-errlog"
 #define STAT_FILE_TOKEN                 "-stat-file"
 #define QP_FILE_TOKEN                   "-qp-file"
@@ -60,6 +62,7 @@
 #define HME_L0_ENABLE_TOKEN             "-hme-l0"   // no Eval
 #define HME_L1_ENABLE_TOKEN             "-hme-l1"   // no Eval
 #define HME_L2_ENABLE_TOKEN             "-hme-l2"   // no Eval
+#define HASH_ME_TOKEN                   "-hash-me"
 #define SEARCH_AREA_WIDTH_TOKEN         "-search-w" // no Eval
 #define SEARCH_AREA_HEIGHT_TOKEN        "-search-h" // no Eval
 #define NUM_HME_SEARCH_WIDTH_TOKEN      "-num-hme-w"// no Eval
@@ -125,6 +128,7 @@ static void SetCfgInputFile                     (const char *value, EbConfig_t *
     else {
         FOPEN(cfg->inputFile, value, "rb"); 
     }
+    EB_STRNCPY(cfg->inputFileName, value, MAX_FILE_NAME_LENGTH - 1);
 };
 static void SetCfgStreamFile                    (const char *value, EbConfig_t *cfg) 
 {
@@ -141,6 +145,8 @@ static void SetCfgReconFile(const char *value, EbConfig_t *cfg)
     if (cfg->reconFile) { fclose(cfg->reconFile); }  
     FOPEN(cfg->reconFile,value, "wb");
 };
+static void SetReconDecimation                  (const char *value, EbConfig_t *cfg) {cfg->reconDecimation = strtoul(value, NULL, 0);};
+static void SetQualityMetricsInterval           (const char *value, EbConfig_t *cfg) {cfg->qualityMetricsInterval = strtoul(value, NULL, 0);};
 static void SetCfgQpFile                        (const char *value, EbConfig_t *cfg) 
 {
     if (cfg->qpFile) { fclose(cfg->qpFile); }  
@@ -186,6 +192,7 @@ static void SetMaxQpAllowed                     (const char *value, EbConfig_t *
 static void SetMinQpAllowed                     (const char *value, EbConfig_t *cfg) {cfg->minQpAllowed = strtoul(value, NULL, 0);};
 static void SetEnableHmeLevel1Flag              (const char *value, EbConfig_t *cfg) {cfg->enableHmeLevel1Flag  = (EB_BOOL)strtoul(value, NULL, 0);};
 static void SetEnableHmeLevel2Flag              (const char *value, EbConfig_t *cfg) {cfg->enableHmeLevel2Flag  = (EB_BOOL)strtoul(value, NULL, 0);};
+static void SetHashMotionSearch                 (const char *value, EbConfig_t *cfg) {cfg->hashMotionSearch = (EB_BOOL)strtoul(value, NULL, 0);};
 static void SetCfgSearchAreaWidth               (const char *value, EbConfig_t *cfg) {cfg->searchAreaWidth = strtoul(value, NULL, 0);};
 static void SetCfgSearchAreaHeight              (const char *value, EbConfig_t *cfg) {cfg->searchAreaHeight = strtoul(value, NULL, 0);};
 static void SetCfgNumberHmeSearchRegionInWidth  (const char *value, EbConfig_t *cfg) {cfg->numberHmeSearchRegionInWidth = strtoul(value, NULL, 0);};
@@ -261,6 +268,8 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, OUTPUT_BITSTREAM_TOKEN,   "StreamFile",       SetCfgStreamFile },
     { SINGLE_INPUT, ERROR_FILE_TOKEN, "ErrorFile", SetCfgErrorFile },
     { SINGLE_INPUT, OUTPUT_RECON_TOKEN, "ReconFile", SetCfgReconFile },
+    { SINGLE_INPUT, RECON_DECIMATION_TOKEN, "ReconDecimation", SetReconDecimation },
+    { SINGLE_INPUT, QUALITY_METRICS_TOKEN, "QualityMetricsInterval", SetQualityMetricsInterval },
     { SINGLE_INPUT, QP_FILE_TOKEN, "QpFile", SetCfgQpFile },
 
     // Interlaced Video 
@@ -313,6 +322,7 @@ config_entry_t config_entry[] = {
     { SINGLE_INPUT, HME_L0_ENABLE_TOKEN, "HMELevel0", SetEnableHmeLevel0Flag },
     { SINGLE_INPUT, HME_L1_ENABLE_TOKEN, "HMELevel1", SetEnableHmeLevel1Flag },
     { SINGLE_INPUT, HME_L2_ENABLE_TOKEN, "HMELevel2", SetEnableHmeLevel2Flag },
+    { SINGLE_INPUT, HASH_ME_TOKEN, "HashMotionSearch", SetHashMotionSearch },
                                                 
     // ME Parameters                                  
     { SINGLE_INPUT, SEARCH_AREA_WIDTH_TOKEN, "SearchAreaWidth", SetCfgSearchAreaWidth },
@@ -380,8 +390,11 @@ void EbConfigCtor(EbConfig_t *configPtr)
 {
     configPtr->configFile                           = NULL;
     configPtr->inputFile                            = NULL;
+    configPtr->inputFileName[0]                     = '\0';
     configPtr->bitstreamFile                        = NULL;
     configPtr->reconFile                            = NULL;
+    configPtr->reconDecimation                      = 1;
+    configPtr->qualityMetricsInterval               = 0;
     configPtr->errorLogFile                         = stderr;
     configPtr->qpFile                               = NULL;
     
@@ -404,6 +417,7 @@ void EbConfigCtor(EbConfig_t *configPtr)
     // Interlaced Video 
     configPtr->interlacedVideo                      = EB_FALSE;
     configPtr->separateFields                       = EB_FALSE;
+    configPtr->fieldPairBuffer                      = 0;
     configPtr->qp                                   = 32;
     configPtr->useQpFile                            = EB_FALSE;
 
@@ -426,6 +440,7 @@ void EbConfigCtor(EbConfig_t *configPtr)
     configPtr->enableHmeLevel0Flag                  = EB_TRUE;
     configPtr->enableHmeLevel1Flag                  = EB_FALSE;
     configPtr->enableHmeLevel2Flag                  = EB_FALSE;
+    configPtr->hashMotionSearch                     = EB_FALSE;
     configPtr->searchAreaWidth                      = 16;
     configPtr->searchAreaHeight                     = 7;
     configPtr->numberHmeSearchRegionInWidth         = 2;
@@ -489,6 +504,16 @@ void EbConfigCtor(EbConfig_t *configPtr)
     configPtr->performanceContext.maxLatency                = 0;
     configPtr->performanceContext.totalLatency              = 0;    
     configPtr->performanceContext.byteCount                 = 0;
+    configPtr->performanceContext.qualityMetricsCount       = 0;
+    configPtr->performanceContext.duplicatePictureCount     = 0;
+    configPtr->performanceContext.hmePictureCount           = 0;
+    configPtr->performanceContext.hmeLevel0SkipCount        = 0;
+    configPtr->performanceContext.sumPsnrY                  = 0;
+    configPtr->performanceContext.sumPsnrCb                 = 0;
+    configPtr->performanceContext.sumPsnrCr                 = 0;
+    configPtr->performanceContext.sumSsimY                  = 0;
+    configPtr->performanceContext.sumSsimCb                 = 0;
+    configPtr->performanceContext.sumSsimCr                 = 0;
     
     // ASM Type
     configPtr->asmType                                      = EB_ASM_AVX2;
@@ -789,7 +814,13 @@ static EB_ERRORTYPE VerifySettings(EbConfig_t *config, unsigned int channelNumbe
         return_error = EB_ErrorBadParameter;
     }
 
-    if (config->encoderBitDepth == 10 && config->separateFields == 1)
+    // The field buffers only address unpacked frames: the compressed 10-bit planes (lumaExt, cbExt, crExt) are not read
+    if (config->encoderBitDepth == 10 && config->compressedTenBitFormat == 1 && config->separateFields == 1)
+    {
+        fprintf(config->errorLogFile, "Error instance %u: Separate fields is not supported for compressed 10 bit input \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+    else if (config->encoderBitDepth == 10 && config->separateFields == 1)
     {
         fprintf(config->errorLogFile, "Error instance %u: Separate fields is not supported for 10 bit input \n", channelNumber + 1);
         return_error = EB_ErrorBadParameter;
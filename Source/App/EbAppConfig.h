@@ -216,6 +216,7 @@ extern rsize_t strnlen_ss(const char *s, rsize_t smax);
 
 #define MAX_CHANNEL_NUMBER      6
 #define MAX_NUM_TOKENS          200
+#define MAX_FILE_NAME_LENGTH    2048
 
 #ifdef _MSC_VER
 #define FOPEN(f,s,m) fopen_s(&f,s,m)
@@ -250,6 +251,20 @@ typedef struct EbPerformanceContext_s {
     double                  averageLatency;
 
     EB_U64                  byteCount;
+    EB_U64                  duplicatePictureCount;
+    EB_U64                  hmePictureCount;            // pictures running HME
+    EB_U64                  hmeLevel0SkipCount;         // pictures running HME without level 0
+
+    /****************************************
+     * Quality Metrics
+     ****************************************/
+    EB_U64                  qualityMetricsCount;
+    double                  sumPsnrY;
+    double                  sumPsnrCb;
+    double                  sumPsnrCr;
+    double                  sumSsimY;
+    double                  sumSsimCb;
+    double                  sumSsimCr;
 
 }EbPerformanceContext_t;
    
@@ -260,8 +275,11 @@ typedef struct EbConfig_s
      ****************************************/
     FILE                   *configFile;
     FILE                   *inputFile;
+    char                    inputFileName[MAX_FILE_NAME_LENGTH];
     FILE                   *bitstreamFile;
     FILE                   *reconFile;
+    EB_U32                  reconDecimation;
+    EB_U32                  qualityMetricsInterval;
     FILE                   *errorLogFile;
 	FILE                   *bufferFile;
 
@@ -296,6 +314,7 @@ typedef struct EbConfig_s
      ****************************************/
     EB_BOOL                 interlacedVideo;
     EB_BOOL                 separateFields;
+    unsigned char          *fieldPairBuffer;         // both fields of the current frame, separateFields without bufferedInput
 
     /*****************************************
      * Coding Structure
@@ -331,6 +350,7 @@ typedef struct EbConfig_s
     EB_BOOL                enableHmeLevel0Flag;
     EB_BOOL                enableHmeLevel1Flag;
     EB_BOOL                enableHmeLevel2Flag;
+    EB_BOOL                hashMotionSearch;
 
     /****************************************
      * ME Parameters
@@ -33,6 +33,24 @@ static EbMemoryMapEntry        *appMemoryMapAllChannels[MAX_CHANNEL_NUMBER];
 static EB_U32                   appMemoryMapIndexAllChannels[MAX_CHANNEL_NUMBER];
 static EB_U64                   appMemoryMallocdAllChannels[MAX_CHANNEL_NUMBER];
 
+/***************************************
+* Preloaded input sequences. Channels that
+*  buffer the same yuv file with the same
+*  geometry share one read-only copy; the
+*  frames live outside the per-channel
+*  memory tables and are reference counted.
+***************************************/
+typedef struct EbSharedInput_s {
+    char                            inputFileName[MAX_FILE_NAME_LENGTH];
+    int                             readSize;
+    int                             bufferedFrameCount;
+    unsigned char                  *sequenceData;
+    unsigned char                 **sequenceBuffer;
+    EB_U32                          refCount;
+} EbSharedInput_t;
+
+static EbSharedInput_t          appSharedInputs[MAX_CHANNEL_NUMBER];
+
 /***************************************
 * Allocation and initializing a memory table
 *  hosting all allocated pointers
@@ -70,80 +88,6 @@ void AllocateMemoryTable(
 **************************************/
 
 
-/******************************************************
-* Copy fields from the stream to the input buffer
-    Input   : stream
-    Output  : valid input buffer
-******************************************************/
-void ProcessInputFieldBufferingMode(
-    EB_U64                    processedFrameCount,
-    int                      *filledLen,
-    FILE                     *inputFile,
-    EB_U8                    *lumaInputPtr,
-    EB_U8                    *cbInputPtr,
-    EB_U8                    *crInputPtr,
-    EB_U32                    inputPaddedWidth,
-    EB_U32                    inputPaddedHeight,
-    unsigned char             is16bit) {
-
-
-    EB_U64  sourceLumaRowSize   = (EB_U64)(inputPaddedWidth << is16bit);
-    EB_U64  sourceChromaRowSize = sourceLumaRowSize >> 1;
-   
-    EB_U8  *ebInputPtr;
-    EB_U32  inputRowIndex;
-
-    // Y
-    ebInputPtr = lumaInputPtr;
-    // Skip 1 luma row if bottom field (point to the bottom field)
-    if (processedFrameCount % 2 != 0)
-        fseeko64(inputFile, (long)sourceLumaRowSize, SEEK_CUR);
-
-    for (inputRowIndex = 0; inputRowIndex < inputPaddedHeight; inputRowIndex++) {
-
-        *filledLen += (EB_U32)fread(ebInputPtr, 1, sourceLumaRowSize, inputFile);
-        // Skip 1 luma row (only fields)
-        fseeko64(inputFile, (long)sourceLumaRowSize, SEEK_CUR);
-        ebInputPtr += sourceLumaRowSize;
-    }
-
-    // U
-    ebInputPtr = cbInputPtr;
-    // Step back 1 luma row if bottom field (undo the previous jump), and skip 1 chroma row if bottom field (point to the bottom field)
-    if (processedFrameCount % 2 != 0) {
-        fseeko64(inputFile, -(long)sourceLumaRowSize, SEEK_CUR);
-        fseeko64(inputFile, (long)sourceChromaRowSize, SEEK_CUR);
-    }
-
-    for (inputRowIndex = 0; inputRowIndex < inputPaddedHeight >> 1; inputRowIndex++) {
-
-        *filledLen += (EB_U32)fread(ebInputPtr, 1, sourceChromaRowSize, inputFile);
-        // Skip 1 chroma row (only fields)
-        fseeko64(inputFile, (long)sourceChromaRowSize, SEEK_CUR);
-        ebInputPtr += sourceChromaRowSize;
-    }
-
-    // V
-    ebInputPtr = crInputPtr;
-    // Step back 1 chroma row if bottom field (undo the previous jump), and skip 1 chroma row if bottom field (point to the bottom field) 
-    // => no action
-
-
-    for (inputRowIndex = 0; inputRowIndex < inputPaddedHeight >> 1; inputRowIndex++) {
-
-        *filledLen += (EB_U32)fread(ebInputPtr, 1, sourceChromaRowSize, inputFile);
-        // Skip 1 chroma row (only fields)
-        fseeko64(inputFile, (long)sourceChromaRowSize, SEEK_CUR);
-        ebInputPtr += sourceChromaRowSize;
-    }
-
-    // Step back 1 chroma row if bottom field (undo the previous jump)
-    if (processedFrameCount % 2 != 0) {
-        fseeko64(inputFile, -(long)sourceChromaRowSize, SEEK_CUR);
-    }
-}
-
-
 /***********************************************
 * Copy configuration parameters from 
 *  The config structure, to the 
@@ -190,6 +134,7 @@ EB_ERRORTYPE CopyConfigurationParameters(
     callbackData->ebEncParameters.enableHmeLevel0Flag = (EB_BOOL)config->enableHmeLevel0Flag;
     callbackData->ebEncParameters.enableHmeLevel1Flag = (EB_BOOL)config->enableHmeLevel1Flag;
     callbackData->ebEncParameters.enableHmeLevel2Flag = (EB_BOOL)config->enableHmeLevel2Flag;
+    callbackData->ebEncParameters.hashMotionSearch = (EB_BOOL)config->hashMotionSearch;
     callbackData->ebEncParameters.searchAreaWidth = config->searchAreaWidth;
     callbackData->ebEncParameters.searchAreaHeight = config->searchAreaHeight;
     callbackData->ebEncParameters.numberHmeSearchRegionInWidth = config->numberHmeSearchRegionInWidth;
@@ -223,6 +168,9 @@ EB_ERRORTYPE CopyConfigurationParameters(
     callbackData->ebEncParameters.speedControlFlag = config->speedControlFlag;
     callbackData->ebEncParameters.asmType = config->asmType;
     callbackData->ebEncParameters.reconEnabled = config->reconFile ? EB_TRUE : EB_FALSE;
+    callbackData->ebEncParameters.reconDecimation = config->reconDecimation;
+    callbackData->ebEncParameters.qualityMetricsInterval = config->qualityMetricsInterval;
+    callbackData->ebEncParameters.pictureStatsEnabled = 1;
     callbackData->ebEncParameters.codeVpsSpsPps = 1;
 
     for (hmeRegionIndex = 0; hmeRegionIndex < callbackData->ebEncParameters.numberHmeSearchRegionInWidth; ++hmeRegionIndex) {
@@ -328,43 +276,31 @@ EB_ERRORTYPE AllocateInputBuffers(
 
         if (config->bufferedInput == -1) {
 
-            // Allocate frame buffer for the pBuffer
-            AllocateFrameBuffer(
+            // Interlaced Video: both fields are read at once and addressed in place
+            if (config->separateFields) {
+                const EB_COLOR_FORMAT colorFormat = config->encoderColorFormat;
+                const size_t lumaFrameSize = (config->inputPaddedWidth * config->inputPaddedHeight << 1) << (config->encoderBitDepth > 8);
+                const size_t frameSize = lumaFrameSize + 2 * (lumaFrameSize >> (3 - colorFormat));
+
+                EB_APP_MALLOC(unsigned char*, config->fieldPairBuffer, frameSize, EB_N_PTR, EB_ErrorInsufficientResources);
+            }
+            else {
+                // Allocate frame buffer for the pBuffer
+                AllocateFrameBuffer(
                     config,
                     callbackData->inputBufferPool->pBuffer);
+            }
         }
 
         // Assign the variables 
         callbackData->inputBufferPool->pAppPrivate = NULL;
         callbackData->inputBufferPool->sliceType   = EB_INVALID_SLICE;
+        callbackData->inputBufferPool->wrapperPtr  = NULL;
+        callbackData->inputBufferPool->pStats      = NULL;
     }
 
     return return_error;
 }
-EB_ERRORTYPE AllocateOutputReconBuffers(
-    EbConfig_t				*config,
-    EbAppContext_t			*callbackData)
-{
-    EB_ERRORTYPE   return_error = EB_ErrorNone;
-    const size_t lumaSize = config->inputPaddedWidth * config->inputPaddedHeight;
-    // both u and v
-    const size_t chromaSize = lumaSize >> (3 - config->encoderColorFormat);
-    const size_t tenBit = (config->encoderBitDepth > 8);
-    const size_t frameSize = (lumaSize + 2 * chromaSize) << tenBit;
-
-// ... Recon Port
-    EB_APP_MALLOC(EB_BUFFERHEADERTYPE*, callbackData->reconBuffer, sizeof(EB_BUFFERHEADERTYPE), EB_N_PTR, EB_ErrorInsufficientResources);
-
-    // Initialize Header
-    callbackData->reconBuffer->nSize = sizeof(EB_BUFFERHEADERTYPE);
-
-    EB_APP_MALLOC(EB_U8*, callbackData->reconBuffer->pBuffer, frameSize, EB_N_PTR, EB_ErrorInsufficientResources);
-
-    callbackData->reconBuffer->nAllocLen = (unsigned int)frameSize;
-    callbackData->reconBuffer->pAppPrivate = NULL;
-    return return_error;
-}
-
 EB_ERRORTYPE AllocateOutputBuffers(
     EbConfig_t				*config,
     EbAppContext_t			*callbackData)
@@ -383,22 +319,27 @@ EB_ERRORTYPE AllocateOutputBuffers(
         callbackData->streamBufferPool->nAllocLen = outputStreamBufferSize;
         callbackData->streamBufferPool->pAppPrivate = NULL;
         callbackData->streamBufferPool->sliceType = EB_INVALID_SLICE;
+        callbackData->streamBufferPool->wrapperPtr = NULL;
+
+        EB_APP_MALLOC(EB_H265_ENC_PICTURE_STATS*, callbackData->streamBufferPool->pStats, sizeof(EB_H265_ENC_PICTURE_STATS), EB_N_PTR, EB_ErrorInsufficientResources);
     }
     return return_error;
 }
 
 static EB_ERRORTYPE PreloadFramesIntoRam(
-    EbConfig_t				*config)
+    EbConfig_t				*config,
+    EbAppContext_t			*callbackData)
 {
     EB_ERRORTYPE    return_error = EB_ErrorNone;
-    const EB_COLOR_FORMAT colorFormat = config->encoderColorFormat;    // Chroma subsampling 
-    const EB_U16 subWidthCMinus1 = (colorFormat == EB_YUV444 ? 1 : 2) - 1;
     int             processedFrameCount;
+    int             bufferedFrameCount;
     int             filledLen;
     int             inputPaddedWidth = config->inputPaddedWidth;
     int             inputPaddedHeight = config->inputPaddedHeight;
     int             readSize;
     unsigned char  *ebInputPtr;
+    EbSharedInput_t *sharedInput = (EbSharedInput_t*)EB_NULL;
+    EB_U32          sharedInputIndex;
 
     FILE *inputFile = config->inputFile;
 
@@ -414,161 +355,100 @@ static EB_ERRORTYPE PreloadFramesIntoRam(
         readSize += 2 * (readSize >> (3 - config->encoderColorFormat)); // Add Chroma
         readSize *= (config->encoderBitDepth > 8 ? 2 : 1); //10 bit
     }
-    EB_APP_MALLOC(unsigned char **, config->sequenceBuffer, sizeof(unsigned char*) * config->bufferedInput, EB_N_PTR, EB_ErrorInsufficientResources);
-
-
-    for (processedFrameCount = 0; processedFrameCount < config->bufferedInput; ++processedFrameCount) {
-        EB_APP_MALLOC(unsigned char*, config->sequenceBuffer[processedFrameCount], readSize, EB_N_PTR, EB_ErrorInsufficientResources);
-        // Interlaced Video
-        if (config->separateFields) {
-            // TODO: Jing for interlace input for 422/444
-            EB_BOOL is16bit = config->encoderBitDepth > 8;
-            if (is16bit == 0 || (is16bit == 1 && config->compressedTenBitFormat == 0)) {
-
-                const int tenBitPackedMode = (config->encoderBitDepth > 8) && (config->compressedTenBitFormat == 0) ? 1 : 0;
-
-                const size_t luma8bitSize =
 
-                    (config->inputPaddedWidth) *
-                    (config->inputPaddedHeight) *
-
-                    (1 << tenBitPackedMode);
-
-                const size_t chroma8bitSize = luma8bitSize >> 2;
-
-                filledLen = 0;
+    // Interlaced Video: each buffer hosts a complete frame, i.e. two consecutive fields
+    bufferedFrameCount = config->bufferedInput;
+    if (config->separateFields) {
+        bufferedFrameCount = (config->bufferedInput + 1) >> 1;
+        readSize <<= 1;
+    }
 
-                ProcessInputFieldBufferingMode(
-                    processedFrameCount,
-                    &filledLen,
-                    inputFile,
-                    config->sequenceBuffer[processedFrameCount],
-                    config->sequenceBuffer[processedFrameCount] + luma8bitSize,
-                    config->sequenceBuffer[processedFrameCount] + luma8bitSize + chroma8bitSize,
-                    (EB_U32)inputPaddedWidth,
-                    (EB_U32)inputPaddedHeight,
+    // Reuse the frames already loaded by another channel (not possible for stdin)
+    if (config->inputFile != stdin) {
+        for (sharedInputIndex = 0; sharedInputIndex < MAX_CHANNEL_NUMBER; ++sharedInputIndex) {
+            EbSharedInput_t *candidate = &appSharedInputs[sharedInputIndex];
+            if (candidate->refCount &&
+                candidate->readSize == readSize &&
+                candidate->bufferedFrameCount == bufferedFrameCount &&
+                !EB_STRCMP(candidate->inputFileName, config->inputFileName)) {
 
-                    is16bit);
+                ++candidate->refCount;
+                config->sequenceBuffer = candidate->sequenceBuffer;
+                callbackData->sharedInput = candidate;
+                return return_error;
+            }
+        }
+    }
 
-                if (readSize != filledLen) {
+    for (sharedInputIndex = 0; sharedInputIndex < MAX_CHANNEL_NUMBER; ++sharedInputIndex) {
+        if (appSharedInputs[sharedInputIndex].refCount == 0) {
+            sharedInput = &appSharedInputs[sharedInputIndex];
+            break;
+        }
+    }
+    if (sharedInput == EB_NULL)
+        return EB_ErrorInsufficientResources;
 
-                    fseek(inputFile, 0, SEEK_SET);
-                    filledLen = 0;
+    // One allocation for the whole sequence, handed to the encoder in place
+    sharedInput->sequenceBuffer = (unsigned char**)malloc(sizeof(unsigned char*) * bufferedFrameCount);
+    sharedInput->sequenceData = (unsigned char*)malloc((size_t)readSize * bufferedFrameCount);
+    if (sharedInput->sequenceBuffer == EB_NULL || sharedInput->sequenceData == EB_NULL) {
+        free(sharedInput->sequenceBuffer);
+        free(sharedInput->sequenceData);
+        return EB_ErrorInsufficientResources;
+    }
 
-                    ProcessInputFieldBufferingMode(
-                        processedFrameCount,
-                        &filledLen,
-                        inputFile,
-                        config->sequenceBuffer[processedFrameCount],
-                        config->sequenceBuffer[processedFrameCount] + luma8bitSize,
-                        config->sequenceBuffer[processedFrameCount] + luma8bitSize + chroma8bitSize,
-                        (EB_U32)inputPaddedWidth,
-                        (EB_U32)inputPaddedHeight,
+    for (processedFrameCount = 0; processedFrameCount < bufferedFrameCount; ++processedFrameCount) {
+        sharedInput->sequenceBuffer[processedFrameCount] = sharedInput->sequenceData + (size_t)readSize * processedFrameCount;
 
-                        is16bit);
-                }
+        // Fill the buffer with a complete frame
+        filledLen = 0;
+        ebInputPtr = sharedInput->sequenceBuffer[processedFrameCount];
+        filledLen += (EB_U32)fread(ebInputPtr, 1, readSize, inputFile);
 
-                // Reset the pointer position after a top field
-                if (processedFrameCount % 2 == 0) {
-                    fseek(inputFile, -(long)(readSize << 1), SEEK_CUR);
-                }
-            }
-            // Unpacked 10 bit
-            else {
+        if (readSize != filledLen) {
 
-                const int tenBitPackedMode = (config->encoderBitDepth > 8) && (config->compressedTenBitFormat == 0) ? 1 : 0;
-
-                const size_t luma8bitSize =
-                    (config->inputPaddedWidth) *
-                    (config->inputPaddedHeight) *
-                    (1 << tenBitPackedMode);
-
-                const size_t chroma8bitSize = luma8bitSize >> 2;
-
-                const size_t luma10bitSize = (config->encoderBitDepth > 8 && tenBitPackedMode == 0) ? luma8bitSize : 0;
-                const size_t chroma10bitSize = (config->encoderBitDepth > 8 && tenBitPackedMode == 0) ? chroma8bitSize : 0;
-
-                filledLen = 0;
-
-                ProcessInputFieldBufferingMode(
-                    processedFrameCount,
-                    &filledLen,
-                    inputFile,
-                    config->sequenceBuffer[processedFrameCount],
-                    config->sequenceBuffer[processedFrameCount] + luma8bitSize,
-                    config->sequenceBuffer[processedFrameCount] + luma8bitSize + chroma8bitSize,
-                    (EB_U32)inputPaddedWidth,
-                    (EB_U32)inputPaddedHeight,
-                    0);
-
-                ProcessInputFieldBufferingMode(
-                    processedFrameCount,
-                    &filledLen,
-                    inputFile,
-                    config->sequenceBuffer[processedFrameCount] + luma8bitSize + (chroma8bitSize << 1),
-                    config->sequenceBuffer[processedFrameCount] + luma8bitSize + (chroma8bitSize << 1) + luma10bitSize,
-                    config->sequenceBuffer[processedFrameCount] + luma8bitSize + (chroma8bitSize << 1) + luma10bitSize + chroma10bitSize,
-                    (EB_U32)inputPaddedWidth,
-                    (EB_U32)inputPaddedHeight,
-                    0);
-
-                if (readSize != filledLen) {
-
-                    fseek(inputFile, 0, SEEK_SET);
-                    filledLen = 0;
-
-                    ProcessInputFieldBufferingMode(
-                        processedFrameCount,
-                        &filledLen,
-                        inputFile,
-                        config->sequenceBuffer[processedFrameCount],
-                        config->sequenceBuffer[processedFrameCount] + luma8bitSize,
-                        config->sequenceBuffer[processedFrameCount] + luma8bitSize + chroma8bitSize,
-                        (EB_U32)inputPaddedWidth,
-                        (EB_U32)inputPaddedHeight,
-                        0);
-
-                    ProcessInputFieldBufferingMode(
-                        processedFrameCount,
-                        &filledLen,
-                        inputFile,
-                        config->sequenceBuffer[processedFrameCount] + luma8bitSize + (chroma8bitSize << 1),
-                        config->sequenceBuffer[processedFrameCount] + luma8bitSize + (chroma8bitSize << 1) + luma10bitSize,
-                        config->sequenceBuffer[processedFrameCount] + luma8bitSize + (chroma8bitSize << 1) + luma10bitSize + chroma10bitSize,
-                        (EB_U32)inputPaddedWidth,
-                        (EB_U32)inputPaddedHeight,
-                        0);
-
-                }
-
-                // Reset the pointer position after a top field
-                if (processedFrameCount % 2 == 0) {
-                    fseek(inputFile, -(long)(readSize << 1), SEEK_CUR);
-                }
-            }
-        }
-        else {
+            fseek(config->inputFile, 0, SEEK_SET);
 
             // Fill the buffer with a complete frame
             filledLen = 0;
-            ebInputPtr = config->sequenceBuffer[processedFrameCount];
+            ebInputPtr = sharedInput->sequenceBuffer[processedFrameCount];
             filledLen += (EB_U32)fread(ebInputPtr, 1, readSize, inputFile);
-
-            if (readSize != filledLen) {
-
-                fseek(config->inputFile, 0, SEEK_SET);
-
-                // Fill the buffer with a complete frame
-                filledLen = 0;
-                ebInputPtr = config->sequenceBuffer[processedFrameCount];
-                filledLen += (EB_U32)fread(ebInputPtr, 1, readSize, inputFile);
-            }
         }
     }
 
+    EB_STRCPY(sharedInput->inputFileName, MAX_FILE_NAME_LENGTH, config->inputFileName);
+    sharedInput->readSize = readSize;
+    sharedInput->bufferedFrameCount = bufferedFrameCount;
+    sharedInput->refCount = 1;
+
+    config->sequenceBuffer = sharedInput->sequenceBuffer;
+    callbackData->sharedInput = sharedInput;
+
     return return_error;
 }
 
+/***************************************
+* Drop one reference to the preloaded input,
+*  the last channel frees the frames
+***************************************/
+static void ReleasePreloadedFrames(
+    EbAppContext_t			*callbackData)
+{
+    EbSharedInput_t *sharedInput = (EbSharedInput_t*)callbackData->sharedInput;
+
+    if (sharedInput == EB_NULL)
+        return;
+
+    if (--sharedInput->refCount == 0) {
+        free(sharedInput->sequenceData);
+        free(sharedInput->sequenceBuffer);
+        sharedInput->sequenceData = (unsigned char*)EB_NULL;
+        sharedInput->sequenceBuffer = (unsigned char**)EB_NULL;
+    }
+    callbackData->sharedInput = EB_NULL;
+}
+
 /***************************************
 * Functions Implementation
 ***************************************/
@@ -639,21 +519,14 @@ EB_ERRORTYPE InitEncoder(
         return return_error;
     }
 
-    // STEP 8: Allocate output Recon Buffer
-    return_error = AllocateOutputReconBuffers(
-        config,
-        callbackData);
-
-    if (return_error != EB_ErrorNone) {
-        return return_error;
-    }    
-
 	// Allocate the Sequence Buffer
+    callbackData->sharedInput = EB_NULL;
     if (config->bufferedInput != -1) {
 
         // Preload frames into the ram for a faster yuv access time
-        PreloadFramesIntoRam(
-            config);
+        return_error = PreloadFramesIntoRam(
+            config,
+            callbackData);
     }
     else {
         config->sequenceBuffer = 0;
@@ -689,6 +562,9 @@ EB_ERRORTYPE DeInitEncoder(
         return return_error;
     }
 
+    // Release the preloaded input, possibly still in use by other channels
+    ReleasePreloadedFrames(callbackDataPtr);
+
     // Loop through the ptr table and free all malloc'd pointers per channel
     for (ptrIndex = appMemoryMapIndexAllChannels[instanceIndex] - 1; ptrIndex >= 0; --ptrIndex) {
         memoryEntry = &appMemoryMapAllChannels[instanceIndex][ptrIndex];
@@ -28,11 +28,13 @@ typedef struct EbAppContext_s {
     // Buffer Pools
     EB_BUFFERHEADERTYPE                *inputBufferPool;
     EB_BUFFERHEADERTYPE                *streamBufferPool;
-    EB_BUFFERHEADERTYPE                *reconBuffer;
 
 	// Instance Index
 	EB_U8								instanceIdx;
 
+    // Preloaded input, shared with the channels reading the same file
+    void                               *sharedInput;
+
 } EbAppContext_t;
 
 
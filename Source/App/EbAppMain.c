@@ -256,6 +256,27 @@ int main(int argc, char* argv[])
                                 (double)frameRate,
                                 (double)configs[instanceCount]->performanceContext.byteCount,
                                 ((double)(configs[instanceCount]->performanceContext.byteCount << 3) * frameRate / (configs[instanceCount]->framesEncoded * 1000)));
+
+                            if (configs[instanceCount]->performanceContext.duplicatePictureCount) {
+                                printf("\nDuplicate Pictures:\t%u\n", (unsigned int)configs[instanceCount]->performanceContext.duplicatePictureCount);
+                            }
+
+                            if (configs[instanceCount]->performanceContext.hmeLevel0SkipCount) {
+                                printf("\nHME Level 0 Skipped:\t%u of %u pictures\n",
+                                    (unsigned int)configs[instanceCount]->performanceContext.hmeLevel0SkipCount,
+                                    (unsigned int)configs[instanceCount]->performanceContext.hmePictureCount);
+                            }
+
+                            if (configs[instanceCount]->performanceContext.qualityMetricsCount) {
+                                const double metricsCount = (double)configs[instanceCount]->performanceContext.qualityMetricsCount;
+                                printf("\nAverage PSNR (Y / Cb / Cr):\t%.4f / %.4f / %.4f dB\nAverage SSIM (Y / Cb / Cr):\t%.6f / %.6f / %.6f\n",
+                                    configs[instanceCount]->performanceContext.sumPsnrY / metricsCount,
+                                    configs[instanceCount]->performanceContext.sumPsnrCb / metricsCount,
+                                    configs[instanceCount]->performanceContext.sumPsnrCr / metricsCount,
+                                    configs[instanceCount]->performanceContext.sumSsimY / metricsCount,
+                                    configs[instanceCount]->performanceContext.sumSsimCb / metricsCount,
+                                    configs[instanceCount]->performanceContext.sumSsimCr / metricsCount);
+                            }
                             fflush(stdout);
                         }
                     }
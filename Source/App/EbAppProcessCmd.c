@@ -610,77 +610,72 @@ void LogErrorOutput(
 }
 
 /******************************************************
-* Copy fields from the stream to the input buffer
-    Input   : stream
+* Point the input buffer at one field of an interlaced
+*  frame. The field rows are addressed in place by
+*  doubling the plane strides, so no deinterleave copy
+*  is needed: the library input copy gathers the rows.
+    Input   : frame buffer, field index (even: top, odd: bottom)
     Output  : valid input buffer
 ******************************************************/
-static void ProcessInputFieldStandardMode(
-    EbConfig_t               *config,
-    EB_BUFFERHEADERTYPE     *headerPtr,
-    EB_U8                   *lumaInputPtr,
-    EB_U8                   *cbInputPtr,
-    EB_U8                   *crInputPtr)
+static void SetInputFieldPointers(
+    EbConfig_t              *config,
+    EB_H265_ENC_INPUT       *inputPtr,
+    EB_U8                   *frameBuffer,
+    EB_U64                   fieldIndex)
 {
     const EB_U32 inputPaddedWidth = config->inputPaddedWidth;
-    const EB_U32 inputPaddedHeight = config->inputPaddedHeight;
+    const EB_U32 frameHeight = config->inputPaddedHeight << 1;
     const EB_COLOR_FORMAT colorFormat = config->encoderColorFormat;
     const EB_U16 subWidthCMinus1 = (colorFormat == EB_YUV444 ? 1 : 2) - 1;
     const EB_U16 subHeightCMinus1 = (colorFormat >= EB_YUV422 ? 1 : 2) - 1;
     const unsigned char is16bit = (config->encoderBitDepth > 8) ? 1 : 0;
-    const FILE *inputFile = config->inputFile;
-
-    EB_U32 sourceLumaRowSize = inputPaddedWidth << is16bit;
-    EB_U32 sourceChromaRowSize = sourceLumaRowSize >> subWidthCMinus1;
-   
-    EB_U8  *ebInputPtr;
-    EB_U32  inputRowIndex;
-
-    // Y
-    ebInputPtr = lumaInputPtr;
-    // Skip 1 luma row if bottom field (point to the bottom field)
-    if (config->processedFrameCount % 2 != 0)
-        fseeko64(inputFile, (long)sourceLumaRowSize, SEEK_CUR);
-
-    for (inputRowIndex = 0; inputRowIndex < inputPaddedHeight; inputRowIndex++) {
-
-        headerPtr->nFilledLen += (EB_U32)fread(ebInputPtr, 1, sourceLumaRowSize, inputFile);
-        // Skip 1 luma row (only fields)
-        fseeko64(inputFile, (long)sourceLumaRowSize, SEEK_CUR);
-        ebInputPtr += sourceLumaRowSize;
-    }
+    const EB_U32 bottomField = (EB_U32)(fieldIndex & 1);
 
-    // U
-    ebInputPtr = cbInputPtr;
-    // Step back 1 luma row if bottom field (undo the previous jump), and skip 1 chroma row if bottom field (point to the bottom field)
-    if (config->processedFrameCount % 2 != 0) {
-        fseeko64(inputFile, -(long)sourceLumaRowSize, SEEK_CUR);
-        fseeko64(inputFile, (long)sourceChromaRowSize, SEEK_CUR);
-    }
+    const size_t lumaRowSize = (size_t)inputPaddedWidth << is16bit;
+    const size_t chromaRowSize = lumaRowSize >> subWidthCMinus1;
+    const size_t lumaFrameSize = lumaRowSize * frameHeight;
+    const size_t chromaFrameSize = chromaRowSize * (frameHeight >> subHeightCMinus1);
 
-    for (inputRowIndex = 0; inputRowIndex < inputPaddedHeight >> subHeightCMinus1; inputRowIndex++) {
-        headerPtr->nFilledLen += (EB_U32)fread(ebInputPtr, 1, sourceChromaRowSize, inputFile);
-        // Skip 1 chroma row (only fields)
-        fseeko64(inputFile, (long)sourceChromaRowSize, SEEK_CUR);
-        ebInputPtr += sourceChromaRowSize;
-    }
+    inputPtr->yStride  = inputPaddedWidth << 1;
+    inputPtr->cbStride = (inputPaddedWidth >> subWidthCMinus1) << 1;
+    inputPtr->crStride = (inputPaddedWidth >> subWidthCMinus1) << 1;
 
-    // V
-    ebInputPtr = crInputPtr;
-    // Step back 1 chroma row if bottom field (undo the previous jump), and skip 1 chroma row if bottom field (point to the bottom field) 
-    // => no action
+    inputPtr->luma = frameBuffer + bottomField * lumaRowSize;
+    inputPtr->cb   = frameBuffer + lumaFrameSize + bottomField * chromaRowSize;
+    inputPtr->cr   = frameBuffer + lumaFrameSize + chromaFrameSize + bottomField * chromaRowSize;
+}
 
+/******************************************************
+* Read one interlaced frame per field pair and serve
+*  both fields from it
+    Input   : stream
+    Output  : valid input buffer
+******************************************************/
+static void ProcessInputFieldStandardMode(
+    EbConfig_t               *config,
+    EB_BUFFERHEADERTYPE     *headerPtr)
+{
+    const EB_COLOR_FORMAT colorFormat = config->encoderColorFormat;
+    const unsigned char is16bit = (config->encoderBitDepth > 8) ? 1 : 0;
+    const EB_U32 frameSize = SIZE_OF_ONE_FRAME_IN_BYTES(config->inputPaddedWidth, config->inputPaddedHeight << 1, colorFormat, is16bit);
+    FILE *inputFile = config->inputFile;
 
-    for (inputRowIndex = 0; inputRowIndex < inputPaddedHeight >> subHeightCMinus1; inputRowIndex++) {
-        headerPtr->nFilledLen += (EB_U32)fread(ebInputPtr, 1, sourceChromaRowSize, inputFile);
-        // Skip 1 chroma row (only fields)
-        fseeko64(inputFile, (long)sourceChromaRowSize, SEEK_CUR);
-        ebInputPtr += sourceChromaRowSize;
+    // The top field triggers the read, the bottom field reuses the same frame
+    if (config->processedFrameCount % 2 == 0) {
+        if ((EB_U32)fread(config->fieldPairBuffer, 1, frameSize, inputFile) != frameSize) {
+            fseek(inputFile, 0, SEEK_SET);
+            if ((EB_U32)fread(config->fieldPairBuffer, 1, frameSize, inputFile) != frameSize)
+                fprintf(config->errorLogFile, "Error: input file is smaller than one interlaced frame\n");
+        }
     }
 
-    // Step back 1 chroma row if bottom field (undo the previous jump)
-    if (config->processedFrameCount % 2 != 0) {
-        fseeko64(inputFile, -(long)sourceChromaRowSize, SEEK_CUR);
-    }
+    SetInputFieldPointers(
+        config,
+        (EB_H265_ENC_INPUT*)headerPtr->pBuffer,
+        config->fieldPairBuffer,
+        config->processedFrameCount);
+
+    headerPtr->nFilledLen = frameSize >> 1;
 }
 
 
@@ -779,27 +774,7 @@ static void ReadInputFrames(
             if (config->separateFields) {
                 ProcessInputFieldStandardMode(
                     config,
-                    headerPtr,
-                    inputPtr->luma,
-                    inputPtr->cb,
-                    inputPtr->cr);
-
-                if (readSize != headerPtr->nFilledLen) {
-                    //TODO: why
-                    fseek(inputFile, 0, SEEK_SET);
-                    headerPtr->nFilledLen = 0;
-                    ProcessInputFieldStandardMode(
-                        config,
-                        headerPtr,
-                        inputPtr->luma,
-                        inputPtr->cb,
-                        inputPtr->cr);
-                }
-
-                // Reset the pointer position after a top field
-                if (config->processedFrameCount % 2 == 0) {
-                    fseek(inputFile, -(long)(readSize << 1), SEEK_CUR);
-                }
+                    headerPtr);
             } else {
                 const EB_U32 lumaReadSize = inputPaddedWidth * inputPaddedHeight << is16bit;
                 const EB_U32 chromaReadSize = lumaReadSize >> (3 - colorFormat);
@@ -871,6 +846,17 @@ static void ReadInputFrames(
             }
 
             headerPtr->nFilledLen = (inputPaddedWidth*inputPaddedHeight * 3) / 2 + (inputPaddedWidth / 4 * inputPaddedHeight * 3) / 2;
+        } else if (config->separateFields) {
+            // Interlaced Video: each preloaded buffer hosts both fields of one frame
+            const EB_U64 fieldIndex = config->processedFrameCount % config->bufferedInput;
+
+            SetInputFieldPointers(
+                config,
+                inputPtr,
+                config->sequenceBuffer[fieldIndex >> 1],
+                fieldIndex);
+
+            headerPtr->nFilledLen = (EB_U32)(EB_U64)SIZE_OF_ONE_FRAME_IN_BYTES(inputPaddedWidth, inputPaddedHeight, colorFormat, is16bit);
         } else {
             //Normal unpacked mode:yuv420p10le yuv422p10le yuv444p10le
 
@@ -1098,6 +1084,28 @@ APPEXITCONDITIONTYPE ProcessOutputStreamBuffer(
         }
         config->performanceContext.byteCount += headerPtr->nFilledLen;
 
+        if (headerPtr->pStats && headerPtr->pStats->duplicatePicture) {
+            ++(config->performanceContext.duplicatePictureCount);
+        }
+
+        if (headerPtr->pStats && headerPtr->pStats->hmeLevels) {
+            ++(config->performanceContext.hmePictureCount);
+            if (!(headerPtr->pStats->hmeLevels & 1)) {
+                ++(config->performanceContext.hmeLevel0SkipCount);
+            }
+        }
+
+        // Accumulate the per-picture quality metrics
+        if (headerPtr->pStats && headerPtr->pStats->qualityMetricsValid) {
+            ++(config->performanceContext.qualityMetricsCount);
+            config->performanceContext.sumPsnrY += headerPtr->pStats->psnrY;
+            config->performanceContext.sumPsnrCb += headerPtr->pStats->psnrCb;
+            config->performanceContext.sumPsnrCr += headerPtr->pStats->psnrCr;
+            config->performanceContext.sumSsimY += headerPtr->pStats->ssimY;
+            config->performanceContext.sumSsimCb += headerPtr->pStats->ssimCb;
+            config->performanceContext.sumSsimCr += headerPtr->pStats->ssimCr;
+        }
+
         if ((headerPtr->nFlags & EB_BUFFERFLAG_EOS) && appCallBack->ebEncParameters.codeEosNal == 0) {
             headerPtr->nFilledLen = 0;
             stream_status = EbH265EncEosNal(componentHandle, headerPtr);
@@ -1172,39 +1180,38 @@ APPEXITCONDITIONTYPE ProcessOutputReconBuffer(
     EbConfig_t             *config,
     EbAppContext_t         *appCallBack)
 {
-    EB_BUFFERHEADERTYPE    *headerPtr = appCallBack->reconBuffer; // needs to change for buffered input
+    EB_BUFFERHEADERTYPE    *headerPtr = NULL;
     EB_COMPONENTTYPE       *componentHandle = (EB_COMPONENTTYPE*)appCallBack->svtEncoderHandle;
     APPEXITCONDITIONTYPE    return_value = APP_ExitConditionNone;
     EB_ERRORTYPE            recon_status = EB_ErrorNone;
     int fseekReturnVal;
-    // non-blocking call until all input frames are sent
-    recon_status = EbH265GetRecon(componentHandle, headerPtr);
+    // non-blocking call until all input frames are sent, the recon is read in place
+    recon_status = EbH265GetReconRef(componentHandle, &headerPtr);
 
     if (recon_status == EB_ErrorMax) {
         printf("\n");
         LogErrorOutput(
             config->errorLogFile,
-            headerPtr->nFlags);
+            headerPtr ? headerPtr->nFlags : 0);
+        EbH265ReleaseRecon(headerPtr);
         return APP_ExitConditionError;
     }
     else if (recon_status != EB_NoErrorEmptyQueue) {
-        //Sets the File position to the beginning of the file.
-        rewind(config->reconFile);
-        EB_U64 frameNum = headerPtr->pts;
-        while (frameNum>0) {
-            fseekReturnVal = fseeko64(config->reconFile, headerPtr->nFilledLen, SEEK_CUR);
-
-            if (fseekReturnVal != 0) {
-                printf("Error in fseeko64  returnVal %i\n", fseekReturnVal);
-                return APP_ExitConditionError;
-            }
-            frameNum = frameNum - 1;
+        // Recon frames all have the same size, seek straight to the frame position
+        fseekReturnVal = fseeko64(config->reconFile, (EB_S64)headerPtr->pts * headerPtr->nFilledLen, SEEK_SET);
+
+        if (fseekReturnVal != 0) {
+            printf("Error in fseeko64  returnVal %i\n", fseekReturnVal);
+            EbH265ReleaseRecon(headerPtr);
+            return APP_ExitConditionError;
         }
 
         fwrite(headerPtr->pBuffer, 1, headerPtr->nFilledLen, config->reconFile);
         
         // Update Output Port Activity State
         return_value = (headerPtr->nFlags & EB_BUFFERFLAG_EOS) ? APP_ExitConditionFinished : APP_ExitConditionNone;
+
+        EbH265ReleaseRecon(headerPtr);
     }
     return return_value;
 }
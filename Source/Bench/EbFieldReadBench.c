@@ -0,0 +1,263 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+// Field input benchmark
+//  -Writes a synthetic interlaced 4:2:0 8-bit clip to a temporary file
+//  -Times the two ways the application can feed separate fields to the encoder:
+//    row:   one fseek and one fread per field row, then the contiguous copy of
+//           the field into the encoder picture
+//    frame: one fread per field pair, then the copy of each field into the
+//           encoder picture with the plane strides doubled (-separate-fields)
+//  -Reports the best-of-runs milliseconds per field; the clip is read from the
+//   page cache, as after the first pass of an encode
+//
+// Usage: SvtHevcFieldReadBench [-w <width>] [-h <frame height>] [-n <frames>] [-json <file>]
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/***************************************
+ * Clip
+ ***************************************/
+#define BENCH_DEFAULT_WIDTH     1920
+#define BENCH_DEFAULT_HEIGHT    1080
+#define BENCH_DEFAULT_FRAMES    20
+#define BENCH_RUNS              5       // passes over the clip per method, the fastest one is kept
+
+typedef struct BenchFields_s
+{
+    unsigned int    width;
+    unsigned int    height;             // frame height, twice the field height
+    unsigned int    frameCount;
+    size_t          frameSize;
+    unsigned char  *frameBuffer;        // both fields of one frame
+    unsigned char  *fieldBuffer;        // one field, rows contiguous (row method)
+    unsigned char  *picture;            // encoder input picture of one field
+} BenchFields_t;
+
+/***************************************
+ * BenchNow
+ *   Wall clock in milliseconds
+ ***************************************/
+static double BenchNow(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return 1000.0 * (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return 1000.0 * (double)now.tv_sec + (double)now.tv_nsec / 1000000.0;
+#endif
+}
+
+/***************************************
+ * BenchCopyPlane
+ *   Row copy into the encoder picture, as the
+ *   library input copy does
+ ***************************************/
+static void BenchCopyPlane(
+    unsigned char       *dst,
+    const unsigned char *src,
+    size_t               srcStride,
+    unsigned int         width,
+    unsigned int         height)
+{
+    unsigned int y;
+
+    for (y = 0; y < height; ++y) {
+        memcpy(dst + (size_t)y * width, src + y * srcStride, width);
+    }
+}
+
+/***************************************
+ * BenchReadFieldRows
+ *   Gathers one plane of a field from the file,
+ *   one row at a time
+ ***************************************/
+static void BenchReadFieldRows(
+    FILE            *file,
+    long             planeOffset,
+    unsigned int     bottomField,
+    unsigned char   *dst,
+    unsigned int     rowSize,
+    unsigned int     rowCount)
+{
+    unsigned int y;
+
+    fseek(file, planeOffset + (long)(bottomField * rowSize), SEEK_SET);
+    for (y = 0; y < rowCount; ++y) {
+        if (fread(dst + (size_t)y * rowSize, 1, rowSize, file) != rowSize) {
+            return;
+        }
+        fseek(file, (long)rowSize, SEEK_CUR);
+    }
+}
+
+/***************************************
+ * BenchPassRow
+ ***************************************/
+static void BenchPassRow(BenchFields_t *fields, FILE *file)
+{
+    const unsigned int fieldHeight = fields->height >> 1;
+    const size_t lumaFrameSize = (size_t)fields->width * fields->height;
+    const size_t lumaFieldSize = lumaFrameSize >> 1;
+    unsigned int frameIndex, bottomField;
+
+    for (frameIndex = 0; frameIndex < fields->frameCount; ++frameIndex) {
+        const long frameOffset = (long)(frameIndex * fields->frameSize);
+
+        for (bottomField = 0; bottomField < 2; ++bottomField) {
+            BenchReadFieldRows(file, frameOffset, bottomField, fields->fieldBuffer, fields->width, fieldHeight);
+            BenchReadFieldRows(file, frameOffset + (long)lumaFrameSize, bottomField, fields->fieldBuffer + lumaFieldSize, fields->width >> 1, fieldHeight >> 1);
+            BenchReadFieldRows(file, frameOffset + (long)(lumaFrameSize + (lumaFrameSize >> 2)), bottomField, fields->fieldBuffer + lumaFieldSize + (lumaFieldSize >> 2), fields->width >> 1, fieldHeight >> 1);
+
+            BenchCopyPlane(fields->picture, fields->fieldBuffer, fields->width, fields->width, fieldHeight);
+            BenchCopyPlane(fields->picture + lumaFieldSize, fields->fieldBuffer + lumaFieldSize, fields->width >> 1, fields->width >> 1, fieldHeight >> 1);
+            BenchCopyPlane(fields->picture + lumaFieldSize + (lumaFieldSize >> 2), fields->fieldBuffer + lumaFieldSize + (lumaFieldSize >> 2), fields->width >> 1, fields->width >> 1, fieldHeight >> 1);
+        }
+    }
+}
+
+/***************************************
+ * BenchPassFrame
+ ***************************************/
+static void BenchPassFrame(BenchFields_t *fields, FILE *file)
+{
+    const unsigned int fieldHeight = fields->height >> 1;
+    const size_t lumaFrameSize = (size_t)fields->width * fields->height;
+    const size_t lumaFieldSize = lumaFrameSize >> 1;
+    const unsigned char *cb = fields->frameBuffer + lumaFrameSize;
+    const unsigned char *cr = cb + (lumaFrameSize >> 2);
+    unsigned int frameIndex, bottomField;
+
+    fseek(file, 0, SEEK_SET);
+    for (frameIndex = 0; frameIndex < fields->frameCount; ++frameIndex) {
+        if (fread(fields->frameBuffer, 1, fields->frameSize, file) != fields->frameSize) {
+            return;
+        }
+
+        for (bottomField = 0; bottomField < 2; ++bottomField) {
+            BenchCopyPlane(fields->picture, fields->frameBuffer + bottomField * fields->width, (size_t)fields->width << 1, fields->width, fieldHeight);
+            BenchCopyPlane(fields->picture + lumaFieldSize, cb + bottomField * (fields->width >> 1), fields->width, fields->width >> 1, fieldHeight >> 1);
+            BenchCopyPlane(fields->picture + lumaFieldSize + (lumaFieldSize >> 2), cr + bottomField * (fields->width >> 1), fields->width, fields->width >> 1, fieldHeight >> 1);
+        }
+    }
+}
+
+/***************************************
+ * BenchMethod
+ *   Best pass, in milliseconds per field
+ ***************************************/
+static double BenchMethod(BenchFields_t *fields, FILE *file, void (*pass)(BenchFields_t *fields, FILE *file))
+{
+    double best = -1.0;
+    unsigned int run;
+
+    for (run = 0; run < BENCH_RUNS; ++run) {
+        const double start = BenchNow();
+        double elapsed;
+
+        pass(fields, file);
+        elapsed = BenchNow() - start;
+        if (best < 0.0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+    return best / (2.0 * fields->frameCount);
+}
+
+int main(int argc, char *argv[])
+{
+    const char     *jsonPath = NULL;
+    FILE           *file;
+    BenchFields_t   fields;
+    double          rowMs, frameMs;
+    unsigned int    frameIndex;
+    size_t          i;
+    int             argIndex;
+
+    fields.width = BENCH_DEFAULT_WIDTH;
+    fields.height = BENCH_DEFAULT_HEIGHT;
+    fields.frameCount = BENCH_DEFAULT_FRAMES;
+
+    for (argIndex = 1; argIndex < argc; ++argIndex) {
+        if (strcmp(argv[argIndex], "-w") == 0 && argIndex + 1 < argc && atoi(argv[argIndex + 1]) >= 16) {
+            fields.width = (unsigned int)atoi(argv[++argIndex]) & ~7u;
+        }
+        else if (strcmp(argv[argIndex], "-h") == 0 && argIndex + 1 < argc && atoi(argv[argIndex + 1]) >= 16) {
+            fields.height = (unsigned int)atoi(argv[++argIndex]) & ~3u;
+        }
+        else if (strcmp(argv[argIndex], "-n") == 0 && argIndex + 1 < argc && atoi(argv[argIndex + 1]) > 0) {
+            fields.frameCount = (unsigned int)atoi(argv[++argIndex]);
+        }
+        else if (strcmp(argv[argIndex], "-json") == 0 && argIndex + 1 < argc) {
+            jsonPath = argv[++argIndex];
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-w <width>] [-h <frame height>] [-n <frames>] [-json <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    fields.frameSize = (size_t)fields.width * fields.height * 3 / 2;
+    fields.frameBuffer = (unsigned char*)malloc(fields.frameSize);
+    fields.fieldBuffer = (unsigned char*)malloc(fields.frameSize >> 1);
+    fields.picture = (unsigned char*)malloc(fields.frameSize >> 1);
+    file = tmpfile();
+    if (fields.frameBuffer == NULL || fields.fieldBuffer == NULL || fields.picture == NULL || file == NULL) {
+        fprintf(stderr, "Error: cannot allocate the clip\n");
+        return 1;
+    }
+
+    srand(1);
+    for (frameIndex = 0; frameIndex < fields.frameCount; ++frameIndex) {
+        for (i = 0; i < fields.frameSize; ++i) {
+            fields.frameBuffer[i] = (unsigned char)(rand() & 0xFF);
+        }
+        if (fwrite(fields.frameBuffer, 1, fields.frameSize, file) != fields.frameSize) {
+            fprintf(stderr, "Error: cannot write the clip\n");
+            return 1;
+        }
+    }
+    fflush(file);
+
+    rowMs = BenchMethod(&fields, file, BenchPassRow);
+    frameMs = BenchMethod(&fields, file, BenchPassFrame);
+
+    printf("%ux%u fields, %u frames\n", fields.width, fields.height >> 1, fields.frameCount);
+    printf("  row   (fseek + fread per row, contiguous copy)   %8.3f ms per field\n", rowMs);
+    printf("  frame (fread per frame, strided copy)             %8.3f ms per field\n", frameMs);
+
+    if (jsonPath) {
+        FILE *jsonFile = fopen(jsonPath, "w");
+        if (jsonFile == NULL) {
+            fprintf(stderr, "Error: cannot open %s\n", jsonPath);
+            return 1;
+        }
+        fprintf(jsonFile, "{\n  \"width\": %u,\n  \"field_height\": %u,\n  \"frames\": %u,\n  \"row_ms_per_field\": %.3f,\n  \"frame_ms_per_field\": %.3f\n}\n",
+            fields.width, fields.height >> 1, fields.frameCount, rowMs, frameMs);
+        fclose(jsonFile);
+    }
+
+    fclose(file);
+    free(fields.frameBuffer);
+    free(fields.fieldBuffer);
+    free(fields.picture);
+
+    return 0;
+}
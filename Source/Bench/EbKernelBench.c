@@ -0,0 +1,647 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+// Kernel microbenchmark
+//  -Runs the kernels of the run-time dispatch table (rtcd) on random data
+//  -Repeats every kernel once per ASM tier (C, SSE, AVX2, AVX-512) the CPU supports;
+//   a tier whose kernel is the same function as the tier below it is skipped
+//  -Reports the best-of-runs cycles per pixel, and writes them as JSON with -json
+//
+// Usage: SvtHevcKernelBench [-json <file>] [-filter <kernel substring>] [-iterations <n>]
+//
+// SVT_HEVC_RTCD still caps single kernels, as it does in the encoder.
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+#include "EbDefinitions.h"
+#include "EbRtcd.h"
+#include "EbEncHandle.h"
+#include "EbTransforms.h"
+
+/***************************************
+ * Test data
+ ***************************************/
+#define BENCH_STRIDE            256
+#define BENCH_ROWS              256
+#define BENCH_BORDER            16      // kernels read up to 8 samples outside the block
+#define BENCH_RUNS              9       // timed runs per kernel, the fastest one is kept
+#define BENCH_DEFAULT_ITERATIONS 200    // calls per timed run
+
+#define BENCH_QP                32
+
+EB_ALIGN(64) static EB_U8  benchSrc[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_U8  benchRef[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_U8  benchDst[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_U8  benchAux[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_U8  benchSmooth[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_U16 benchSrc16[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_U16 benchDst16[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_S16 benchCoeff[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_S16 benchResidual[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_S16 benchRaw0[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_S16 benchRaw1[BENCH_STRIDE * BENCH_ROWS];
+EB_ALIGN(64) static EB_S16 benchTemp[BENCH_STRIDE * BENCH_ROWS];
+
+#define BENCH_BLOCK(buffer)     ((buffer) + BENCH_BORDER * BENCH_STRIDE + BENCH_BORDER)
+
+/***************************************
+ * Kernel cases
+ ***************************************/
+typedef struct BenchCase_s
+{
+    const char  *kernel;        // rtcd member, with its candidate index
+    EB_U32       width;
+    EB_U32       height;
+    EB_U32       param;         // fractional position, angle, edge direction, ...
+    EB_U32       scale;         // pixels per call = width * height * scale
+    void       (*run)(const struct BenchCase_s *benchCase);
+    const void  *slot;          // dispatched function pointer in rtcd
+} BenchCase_t;
+
+#define BENCH_CASE_SCALED(member, width, height, param, scale, run) \
+    { #member, width, height, param, scale, run, (const void*)&rtcd.member }
+
+#define BENCH_CASE(member, width, height, param, run) \
+    BENCH_CASE_SCALED(member, width, height, param, 1, run)
+
+#define BENCH_KERNEL(type, benchCase)   (*(const type*)(benchCase)->slot)
+
+static void BenchSad(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_SADKERNELNxM_TYPE, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, BENCH_BLOCK(benchRef) + 1, BENCH_STRIDE, c->height, c->width);
+}
+
+static void BenchSadAveraging(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_SADAVGKERNELNxM_TYPE, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, BENCH_BLOCK(benchRef), BENCH_STRIDE, BENCH_BLOCK(benchAux), BENCH_STRIDE, c->height, c->width);
+}
+
+// Full search of param x param positions
+static void BenchSadLoop(const BenchCase_t *c)
+{
+    EB_U64 bestSad = ~(EB_U64)0;
+    EB_S16 xSearchCenter = 0;
+    EB_S16 ySearchCenter = 0;
+
+    BENCH_KERNEL(EB_SADLOOPKERNELNxM_TYPE, c)(
+        BENCH_BLOCK(benchSrc),
+        BENCH_STRIDE,
+        BENCH_BLOCK(benchRef),
+        BENCH_STRIDE,
+        c->height,
+        c->width,
+        &bestSad,
+        &xSearchCenter,
+        &ySearchCenter,
+        BENCH_STRIDE,
+        (EB_S16)c->param,
+        (EB_S16)c->param);
+}
+
+static void BenchMeSad8x8And16x16(const BenchCase_t *c)
+{
+    EB_U32 bestSad8x8[4] = { ~0u, ~0u, ~0u, ~0u };
+    EB_U32 bestMv8x8[4] = { 0 };
+    EB_U32 bestSad16x16 = ~0u;
+    EB_U32 bestMv16x16 = 0;
+    EB_U32 sad16x16 = 0;
+
+    BENCH_KERNEL(EB_SADCALCULATION8X8AND16X16_TYPE, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, BENCH_BLOCK(benchRef), BENCH_STRIDE, bestSad8x8, &bestSad16x16, bestMv8x8, &bestMv16x16, 0, &sad16x16);
+}
+
+static void BenchResidual(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_RESDKERNEL_TYPE, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, BENCH_BLOCK(benchRef), BENCH_STRIDE, benchResidual, BENCH_STRIDE, c->width, c->height);
+}
+
+static void BenchPicCopy(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_PICCOPY_TYPE, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, BENCH_BLOCK(benchDst), BENCH_STRIDE, c->width, c->height);
+}
+
+static void BenchAddition(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_ADDDKERNEL_TYPE, c)(BENCH_BLOCK(benchRef), BENCH_STRIDE, benchResidual, BENCH_STRIDE, BENCH_BLOCK(benchDst), BENCH_STRIDE, c->width, c->height);
+}
+
+static void BenchSpatialDistortion(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_SPATIALFULLDIST_TYPE, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, BENCH_BLOCK(benchRef), BENCH_STRIDE, c->width, c->height);
+}
+
+static void BenchSatd(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_SATD_TYPE, c)(benchResidual);
+}
+
+static void BenchSatdU8(const BenchCase_t *c)
+{
+    EB_U64 dcValue = 0;
+    BENCH_KERNEL(EB_SATD_U8_TYPE, c)(BENCH_BLOCK(benchSrc), &dcValue, BENCH_STRIDE);
+}
+
+static void BenchBlockHash(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_BLOCKHASH_TYPE, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, c->width, c->height, (EB_U32*)benchRaw0);
+}
+
+static void BenchMean(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_COMPUTE_MEAN_FUNC, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, c->width, c->height);
+}
+
+// Reference samples laid out as in IntraPrediction.c: left column, corner, top row
+static void BenchIntra(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_INTRA_NOANG_TYPE, c)(c->width, benchAux, BENCH_BLOCK(benchDst), BENCH_STRIDE, EB_FALSE);
+}
+
+static void BenchIntra16bit(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_INTRA_NOANG_16bit_TYPE, c)(c->width, benchSrc16, BENCH_BLOCK(benchDst16), BENCH_STRIDE, EB_FALSE);
+}
+
+static void BenchIntraAngular(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_INTRA_ANG_TYPE, c)(c->width, benchAux + (c->width << 1), BENCH_BLOCK(benchDst), BENCH_STRIDE, EB_FALSE, (EB_S32)c->param);
+}
+
+static void BenchForwardTransform(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_TRANSFORM_FUNC, c)(benchResidual, BENCH_STRIDE, benchCoeff, BENCH_STRIDE, benchTemp, 0);
+}
+
+static void BenchInverseTransform(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_INVTRANSFORM_FUNC, c)(benchCoeff, BENCH_STRIDE, benchResidual, BENCH_STRIDE, benchTemp, 0);
+}
+
+static void BenchInverseTransformRecon(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_INVTRANSFORM_RECON_FUNC, c)(benchCoeff, BENCH_STRIDE, BENCH_BLOCK(benchRef), BENCH_STRIDE, BENCH_BLOCK(benchDst), BENCH_STRIDE, benchTemp, 0);
+}
+
+// Quantization parameters as derived in EbFullLoop.c, for an inter slice
+static void BenchQiQ(const BenchCase_t *c)
+{
+    const EB_S32 qpRem = BENCH_QP % 6;
+    const EB_S32 qpPer = BENCH_QP / 6;
+    const EB_U32 transformShiftNum = 7 - Log2f(c->width);
+    const EB_S32 shiftedQBits = QUANT_SHIFT + qpPer + transformShiftNum;
+    const EB_U32 qOffset = QUANT_OFFSET_P << (shiftedQBits - 9);
+    const EB_S32 shiftedFFunc = (EB_S32)FFunc[qpRem] << qpPer;
+    const EB_S32 shiftNum = QUANT_IQUANT_SHIFT - QUANT_SHIFT - transformShiftNum;
+    EB_U32 nonZeroCoeffs = 0;
+
+    BENCH_KERNEL(EB_QIQ_TYPE, c)(benchCoeff, BENCH_STRIDE, benchRaw0, benchRaw1, QFunc[qpRem], qOffset, shiftedQBits, shiftedFFunc, 1 << (shiftNum - 1), shiftNum, c->width, &nonZeroCoeffs);
+}
+
+static void BenchLumaUniPred(const BenchCase_t *c)
+{
+    BENCH_KERNEL(InterpolationFilterNew, c)(BENCH_BLOCK(benchRef), BENCH_STRIDE, BENCH_BLOCK(benchDst), BENCH_STRIDE, c->width, c->height, benchTemp);
+}
+
+static void BenchLumaBiPred(const BenchCase_t *c)
+{
+    BENCH_KERNEL(InterpolationFilterOutRaw, c)(BENCH_BLOCK(benchRef), BENCH_STRIDE, benchRaw0, c->width, c->height, benchTemp);
+}
+
+static void BenchLumaUniPred16bit(const BenchCase_t *c)
+{
+    BENCH_KERNEL(InterpolationFilterNew16bit, c)(BENCH_BLOCK(benchSrc16), BENCH_STRIDE, BENCH_BLOCK(benchDst16), BENCH_STRIDE, c->width, c->height, benchTemp);
+}
+
+static void BenchAvcStyleUniPred(const BenchCase_t *c)
+{
+    BENCH_KERNEL(AvcStyleInterpolationFilterNew, c)(BENCH_BLOCK(benchRef), BENCH_STRIDE, BENCH_BLOCK(benchDst), BENCH_STRIDE, c->width, c->height, (EB_BYTE)benchTemp, c->param);
+}
+
+static void BenchChromaUniPred(const BenchCase_t *c)
+{
+    BENCH_KERNEL(ChromaFilterNew, c)(BENCH_BLOCK(benchRef), BENCH_STRIDE, BENCH_BLOCK(benchDst), BENCH_STRIDE, c->width, c->height, benchTemp, c->param & 7, c->param >> 3);
+}
+
+static void BenchChromaBiPred(const BenchCase_t *c)
+{
+    BENCH_KERNEL(ChromaFilterOutRaw, c)(BENCH_BLOCK(benchRef), BENCH_STRIDE, benchRaw0, c->width, c->height, benchTemp, c->param & 7, c->param >> 3);
+}
+
+static void BenchBiPredClipping(const BenchCase_t *c)
+{
+    BENCH_KERNEL(sampleBiPredClipping, c)(c->width, c->height, benchRaw0, benchRaw1, BENCH_BLOCK(benchDst), BENCH_STRIDE, (1 << 6) + (1 << 14));
+}
+
+// param is the edge direction (isVerticalEdge); tc and beta make most edges filtered
+static void BenchLumaDeblock4(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_LUMA4SAMPLEDGEDLF_FUNC, c)(BENCH_BLOCK(benchSmooth), BENCH_STRIDE, (EB_BOOL)c->param, 6, 40);
+}
+
+static void BenchLumaDeblock8(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_LUMA8SAMPLEDGEDLF_FUNC, c)(BENCH_BLOCK(benchSmooth), BENCH_STRIDE, (EB_BOOL)c->param, 6, 40, 6, 40);
+}
+
+static void BenchChromaDeblock(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_CHROMA2SAMPLEDGEDLF_FUNC, c)(BENCH_BLOCK(benchSmooth), BENCH_BLOCK(benchSmooth) + 64, BENCH_STRIDE, (EB_BOOL)c->param, 6, 6);
+}
+
+// Padded, the SIMD kernels load the offsets 8 at a time
+static EB_S8 benchSaoOffset[8] = { 2, 1, 0, -1, -2 };
+
+static void BenchSaoGather(const BenchCase_t *c)
+{
+    EB_S32 boDiff[SAO_BO_INTERVALS];
+    EB_U16 boCount[SAO_BO_INTERVALS];
+    EB_S32 eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1];
+    EB_U16 eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1];
+
+    BENCH_KERNEL(EB_SAOGATHER_FUNC, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, BENCH_BLOCK(benchRef), BENCH_STRIDE, c->width, c->height, boDiff, boCount, eoDiff, eoCount);
+}
+
+static void BenchSaoGather16bit(const BenchCase_t *c)
+{
+    EB_S32 boDiff[SAO_BO_INTERVALS];
+    EB_U16 boCount[SAO_BO_INTERVALS];
+    EB_S32 eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1];
+    EB_U16 eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1];
+
+    BENCH_KERNEL(EB_SAOGATHER_16bit_FUNC, c)(BENCH_BLOCK(benchSrc16), BENCH_STRIDE, BENCH_BLOCK(benchDst16), BENCH_STRIDE, c->width, c->height, boDiff, boCount, eoDiff, eoCount);
+}
+
+static void BenchSaoGatherEo16bit(const BenchCase_t *c)
+{
+    EB_S32 eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1];
+    EB_U16 eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1];
+
+    BENCH_KERNEL(EB_SAOGATHER_90_45_135_16bit_SSE2_FUNC, c)(BENCH_BLOCK(benchSrc16), BENCH_STRIDE, BENCH_BLOCK(benchDst16), BENCH_STRIDE, c->width, c->height, eoDiff, eoCount);
+}
+
+static void BenchSaoBo(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_SAOAPPLY_BO_FUNC, c)(BENCH_BLOCK(benchDst), BENCH_STRIDE, 10, benchSaoOffset, c->height, c->width);
+}
+
+static void BenchSaoEo090(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_SAOAPPLY_EO_0_90_FUNC, c)(BENCH_BLOCK(benchDst), BENCH_STRIDE, benchAux, benchSaoOffset, c->height, c->width);
+}
+
+static void BenchSaoEo13545(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_SAOAPPLY_EO_135_45_FUNC, c)(BENCH_BLOCK(benchDst), BENCH_STRIDE, benchAux, benchAux + BENCH_STRIDE, benchSaoOffset, c->height, c->width);
+}
+
+static void BenchPack2D(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_ENC_Pack2D_TYPE, c)(BENCH_BLOCK(benchSrc), BENCH_STRIDE, BENCH_BLOCK(benchAux), BENCH_BLOCK(benchDst16), BENCH_STRIDE, BENCH_STRIDE, c->width, c->height);
+}
+
+static void BenchUnPack2D(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_ENC_UnPack2D_TYPE, c)(BENCH_BLOCK(benchSrc16), BENCH_STRIDE, BENCH_BLOCK(benchDst), BENCH_BLOCK(benchAux), BENCH_STRIDE, BENCH_STRIDE, c->width, c->height);
+}
+
+// One LCU of a 192x192 picture
+static EbPictureBufferDesc_t benchInputPicture;
+static EbPictureBufferDesc_t benchDenoisedPicture;
+static EbPictureBufferDesc_t benchNoisePicture;
+
+static void BenchPictureInit(EbPictureBufferDesc_t *picture, EB_BYTE buffer)
+{
+    picture->bufferY = buffer;
+    picture->strideY = BENCH_STRIDE;
+    picture->originX = BENCH_BORDER;
+    picture->originY = BENCH_BORDER;
+    picture->width = 192;
+    picture->height = 192;
+    picture->maxWidth = 192;
+    picture->maxHeight = 192;
+    picture->bitDepth = EB_8BIT;
+}
+
+static void BenchWeakLumaFilter(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_WEAKLUMAFILTER_TYPE, c)(&benchInputPicture, &benchDenoisedPicture, &benchNoisePicture, c->height, c->width);
+}
+
+static void BenchStrongLumaFilter(const BenchCase_t *c)
+{
+    BENCH_KERNEL(EB_STRONGLUMAFILTER_TYPE, c)(&benchInputPicture, &benchDenoisedPicture, c->height, c->width);
+}
+
+static const BenchCase_t BenchCases[] = {
+    // SAD
+    BENCH_CASE(NxMSadKernel[1], 8, 8, 0, BenchSad),
+    BENCH_CASE(NxMSadKernel[2], 16, 16, 0, BenchSad),
+    BENCH_CASE(NxMSadKernel[3], 24, 32, 0, BenchSad),
+    BENCH_CASE(NxMSadKernel[4], 32, 32, 0, BenchSad),
+    BENCH_CASE(NxMSadKernel[6], 48, 64, 0, BenchSad),
+    BENCH_CASE(NxMSadKernel[8], 64, 64, 0, BenchSad),
+    BENCH_CASE(NxMSadAveragingKernel[1], 8, 8, 0, BenchSadAveraging),
+    BENCH_CASE(NxMSadAveragingKernel[2], 16, 16, 0, BenchSadAveraging),
+    BENCH_CASE(NxMSadAveragingKernel[4], 32, 32, 0, BenchSadAveraging),
+    BENCH_CASE(NxMSadAveragingKernel[8], 64, 64, 0, BenchSadAveraging),
+    BENCH_CASE_SCALED(NxMSadLoopKernel, 16, 16, 64, 64 * 64, BenchSadLoop),
+    BENCH_CASE_SCALED(NxMSadLoopKernel, 32, 32, 64, 64 * 64, BenchSadLoop),
+
+    // ME SAD
+    BENCH_CASE(SadCalculation_8x8_16x16, 16, 16, 0, BenchMeSad8x8And16x16),
+
+    // Picture operators
+    BENCH_CASE(ResidualKernel[0], 4, 4, 0, BenchResidual),
+    BENCH_CASE(ResidualKernel[1], 8, 8, 0, BenchResidual),
+    BENCH_CASE(ResidualKernel[2], 16, 16, 0, BenchResidual),
+    BENCH_CASE(ResidualKernel[4], 32, 32, 0, BenchResidual),
+    BENCH_CASE(ResidualKernel[8], 64, 64, 0, BenchResidual),
+    BENCH_CASE(PicCopyKernel[1], 8, 8, 0, BenchPicCopy),
+    BENCH_CASE(PicCopyKernel[4], 32, 32, 0, BenchPicCopy),
+    BENCH_CASE(PicCopyKernel[8], 64, 64, 0, BenchPicCopy),
+    BENCH_CASE(AdditionKernel[0], 4, 4, 0, BenchAddition),
+    BENCH_CASE(AdditionKernel[1], 8, 8, 0, BenchAddition),
+    BENCH_CASE(AdditionKernel[2], 16, 16, 0, BenchAddition),
+    BENCH_CASE(AdditionKernel[4], 32, 32, 0, BenchAddition),
+    BENCH_CASE(SpatialFullDistortionKernel[0], 4, 4, 0, BenchSpatialDistortion),
+    BENCH_CASE(SpatialFullDistortionKernel[1], 8, 8, 0, BenchSpatialDistortion),
+    BENCH_CASE(SpatialFullDistortionKernel[2], 16, 16, 0, BenchSpatialDistortion),
+    BENCH_CASE(SpatialFullDistortionKernel[3], 32, 32, 0, BenchSpatialDistortion),
+    BENCH_CASE(SpatialFullDistortionKernel[4], 64, 64, 0, BenchSpatialDistortion),
+    BENCH_CASE(Compute8x8Satd, 8, 8, 0, BenchSatd),
+    BENCH_CASE(Compute8x8Satd_U8, 8, 8, 0, BenchSatdU8),
+    BENCH_CASE(Compute16x16Satd_U8, 16, 16, 0, BenchSatdU8),
+    BENCH_CASE(ComputeMeanFunc[0], 8, 8, 0, BenchMean),
+    BENCH_CASE(BlockHash64x64, 128, 128, 0, BenchBlockHash),
+
+    // Intra prediction
+    BENCH_CASE(IntraPlanar, 4, 4, 0, BenchIntra),
+    BENCH_CASE(IntraPlanar, 8, 8, 0, BenchIntra),
+    BENCH_CASE(IntraPlanar, 16, 16, 0, BenchIntra),
+    BENCH_CASE(IntraPlanar, 32, 32, 0, BenchIntra),
+    BENCH_CASE(IntraDCLuma, 8, 8, 0, BenchIntra),
+    BENCH_CASE(IntraDCLuma, 32, 32, 0, BenchIntra),
+    BENCH_CASE(IntraAng34, 8, 8, 0, BenchIntra),
+    BENCH_CASE(IntraAng34, 32, 32, 0, BenchIntra),
+    BENCH_CASE(IntraAngVertical, 8, 8, 13, BenchIntraAngular),
+    BENCH_CASE(IntraAngVertical, 32, 32, 13, BenchIntraAngular),
+    BENCH_CASE(IntraAngHorizontal, 8, 8, 13, BenchIntraAngular),
+    BENCH_CASE(IntraAngHorizontal, 32, 32, 13, BenchIntraAngular),
+    BENCH_CASE(IntraPlanar_16bit, 8, 8, 0, BenchIntra16bit),
+    BENCH_CASE(IntraPlanar_16bit, 32, 32, 0, BenchIntra16bit),
+
+    // Transforms / quantization, index = Log2f(TRANSFORM_MAX_SIZE) - Log2f(size), 4 for DST
+    BENCH_CASE(transformFunctionTableEncode[3], 4, 4, 0, BenchForwardTransform),
+    BENCH_CASE(transformFunctionTableEncode[4], 4, 4, 0, BenchForwardTransform),
+    BENCH_CASE(transformFunctionTableEncode[2], 8, 8, 0, BenchForwardTransform),
+    BENCH_CASE(transformFunctionTableEncode[1], 16, 16, 0, BenchForwardTransform),
+    BENCH_CASE(transformFunctionTableEncode[0], 32, 32, 0, BenchForwardTransform),
+    BENCH_CASE(invTransformFunctionTableEncode[3], 4, 4, 0, BenchInverseTransform),
+    BENCH_CASE(invTransformFunctionTableEncode[4], 4, 4, 0, BenchInverseTransform),
+    BENCH_CASE(invTransformFunctionTableEncode[2], 8, 8, 0, BenchInverseTransform),
+    BENCH_CASE(invTransformFunctionTableEncode[1], 16, 16, 0, BenchInverseTransform),
+    BENCH_CASE(invTransformFunctionTableEncode[0], 32, 32, 0, BenchInverseTransform),
+    BENCH_CASE(invTransformReconFunctionTable[3], 4, 4, 0, BenchInverseTransformRecon),
+    BENCH_CASE(invTransformReconFunctionTable[2], 8, 8, 0, BenchInverseTransformRecon),
+    BENCH_CASE(invTransformReconFunctionTable[1], 16, 16, 0, BenchInverseTransformRecon),
+    BENCH_CASE(invTransformReconFunctionTable[0], 32, 32, 0, BenchInverseTransformRecon),
+    BENCH_CASE(QiQ[0], 4, 4, 0, BenchQiQ),
+    BENCH_CASE(QiQ[1], 8, 8, 0, BenchQiQ),
+    BENCH_CASE(QiQ[2], 16, 16, 0, BenchQiQ),
+    BENCH_CASE(QiQ[4], 32, 32, 0, BenchQiQ),
+
+    // Motion compensated prediction, luma index = fracPosx + (fracPosy << 2)
+    BENCH_CASE(uniPredLumaIFNew[2], 8, 8, 0, BenchLumaUniPred),
+    BENCH_CASE(uniPredLumaIFNew[2], 16, 16, 0, BenchLumaUniPred),
+    BENCH_CASE(uniPredLumaIFNew[2], 64, 64, 0, BenchLumaUniPred),
+    BENCH_CASE(uniPredLumaIFNew[8], 16, 16, 0, BenchLumaUniPred),
+    BENCH_CASE(uniPredLumaIFNew[8], 64, 64, 0, BenchLumaUniPred),
+    BENCH_CASE(uniPredLumaIFNew[10], 8, 8, 0, BenchLumaUniPred),
+    BENCH_CASE(uniPredLumaIFNew[10], 16, 16, 0, BenchLumaUniPred),
+    BENCH_CASE(uniPredLumaIFNew[10], 64, 64, 0, BenchLumaUniPred),
+    BENCH_CASE(biPredLumaIFNew[2], 16, 16, 0, BenchLumaBiPred),
+    BENCH_CASE(biPredLumaIFNew[8], 16, 16, 0, BenchLumaBiPred),
+    BENCH_CASE(biPredLumaIFNew[10], 16, 16, 0, BenchLumaBiPred),
+    BENCH_CASE(biPredLumaIFNew[10], 64, 64, 0, BenchLumaBiPred),
+    BENCH_CASE(uniPredLuma16bitIF[10], 16, 16, 0, BenchLumaUniPred16bit),
+    BENCH_CASE(uniPredLuma16bitIF[10], 64, 64, 0, BenchLumaUniPred16bit),
+    BENCH_CASE(AvcStyleUniPredLumaIF[1], 16, 16, 2, BenchAvcStyleUniPred),
+    BENCH_CASE(AvcStyleUniPredLumaIF[1], 64, 64, 2, BenchAvcStyleUniPred),
+    BENCH_CASE(AvcStyleUniPredLumaIF[2], 16, 16, 2, BenchAvcStyleUniPred),
+    BENCH_CASE(AvcStyleUniPredLumaIF[2], 64, 64, 2, BenchAvcStyleUniPred),
+    BENCH_CASE(uniPredChromaIFNew[4], 8, 8, 4, BenchChromaUniPred),
+    BENCH_CASE(uniPredChromaIFNew[32], 8, 8, 32, BenchChromaUniPred),
+    BENCH_CASE(uniPredChromaIFNew[36], 8, 8, 36, BenchChromaUniPred),
+    BENCH_CASE(uniPredChromaIFNew[36], 32, 32, 36, BenchChromaUniPred),
+    BENCH_CASE(biPredChromaIFNew[36], 8, 8, 36, BenchChromaBiPred),
+    BENCH_CASE(biPredChromaIFNew[36], 32, 32, 36, BenchChromaBiPred),
+    BENCH_CASE(biPredClipping, 8, 8, 0, BenchBiPredClipping),
+    BENCH_CASE(biPredClipping, 16, 16, 0, BenchBiPredClipping),
+    BENCH_CASE(biPredClipping, 64, 64, 0, BenchBiPredClipping),
+
+    // Deblocking filter, width across the edge x height along it
+    BENCH_CASE(Luma4SampleEdgeDLFCore, 8, 4, EB_TRUE, BenchLumaDeblock4),
+    BENCH_CASE(Luma4SampleEdgeDLFCore, 8, 4, EB_FALSE, BenchLumaDeblock4),
+    BENCH_CASE(Luma8SampleEdgeDLFCore, 8, 8, EB_TRUE, BenchLumaDeblock8),
+    BENCH_CASE(Luma8SampleEdgeDLFCore, 8, 8, EB_FALSE, BenchLumaDeblock8),
+    BENCH_CASE(Chroma2SampleEdgeDLFCore, 4, 2, EB_TRUE, BenchChromaDeblock),
+    BENCH_CASE(Chroma2SampleEdgeDLFCore, 4, 2, EB_FALSE, BenchChromaDeblock),
+
+    // Sample adaptive offset
+    BENCH_CASE(SaoGatherFunctionTableLossy, 64, 64, 0, BenchSaoGather),
+    BENCH_CASE(SaoGatherFunctionTableLossy, 32, 32, 0, BenchSaoGather),
+    BENCH_CASE(SaoGatherFunctionTable_16bit[1], 64, 64, 0, BenchSaoGather16bit),
+    BENCH_CASE(SaoGatherFunctionTable_90_45_135_16bit_SSE2[1], 64, 64, 0, BenchSaoGatherEo16bit),
+    BENCH_CASE(SaoFunctionTableBo[1], 64, 64, 0, BenchSaoBo),
+    BENCH_CASE(SaoFunctionTableEO_0_90[0][1], 64, 64, 0, BenchSaoEo090),
+    BENCH_CASE(SaoFunctionTableEO_0_90[1][1], 64, 64, 0, BenchSaoEo090),
+    BENCH_CASE(SaoFunctionTableEO_135_45[0][0][1], 64, 64, 0, BenchSaoEo13545),
+    BENCH_CASE(SaoFunctionTableEO_135_45[1][0][1], 64, 64, 0, BenchSaoEo13545),
+
+    // Pack / unpack
+    BENCH_CASE(Pack2D_16Bit_SRC[1], 64, 64, 0, BenchPack2D),
+    BENCH_CASE(UnPack2D_16Bit[1], 64, 64, 0, BenchUnPack2D),
+
+    // Noise filters, on the LCU at (64, 64)
+    BENCH_CASE(WeakLumaFilterLcu, 64, 64, 0, BenchWeakLumaFilter),
+    BENCH_CASE(StrongLumaFilter, 64, 64, 0, BenchStrongLumaFilter),
+};
+
+#define BENCH_CASE_COUNT (sizeof(BenchCases) / sizeof(BenchCases[0]))
+
+/***************************************
+ * ASM tiers, as ASM_TYPES bit-fields
+ ***************************************/
+typedef struct BenchTier_s
+{
+    const char  *name;
+    EB_U32       asmTypes;
+} BenchTier_t;
+
+static const BenchTier_t BenchTiers[] = {
+    { "C",      0 },
+    { "SSE",    PREAVX2_MASK },
+    { "AVX2",   PREAVX2_MASK | AVX2_MASK },
+    { "AVX512", PREAVX2_MASK | AVX2_MASK | AVX512_MASK },
+};
+
+#define BENCH_TIER_COUNT (sizeof(BenchTiers) / sizeof(BenchTiers[0]))
+
+typedef void(*BenchKernel)(void);
+
+/***************************************
+ * BenchFillData
+ *   Random samples and coefficients; the deblocking
+ *   buffer is a noisy ramp so that edges get filtered
+ ***************************************/
+static void BenchFillData(void)
+{
+    EB_U32 index;
+
+    srand(1);
+    for (index = 0; index < BENCH_STRIDE * BENCH_ROWS; ++index) {
+        benchSrc[index] = (EB_U8)(rand() & 0xFF);
+        benchRef[index] = (EB_U8)(rand() & 0xFF);
+        benchDst[index] = (EB_U8)(rand() & 0xFF);
+        benchAux[index] = (EB_U8)(rand() & 0xFF);
+        benchSmooth[index] = (EB_U8)(64 + ((index % BENCH_STRIDE) >> 2) + ((index / BENCH_STRIDE) >> 2) + (rand() & 3));
+        benchSrc16[index] = (EB_U16)(rand() & 0x3FF);
+        benchDst16[index] = (EB_U16)(rand() & 0x3FF);
+        benchCoeff[index] = (EB_S16)((rand() & 0x3FF) - 0x200);
+        benchResidual[index] = (EB_S16)((rand() & 0x1FF) - 0x100);
+        benchRaw0[index] = (EB_S16)((rand() & 0x3FFF) - 0x2000);
+        benchRaw1[index] = (EB_S16)((rand() & 0x3FFF) - 0x2000);
+    }
+
+    BenchPictureInit(&benchInputPicture, benchSrc);
+    BenchPictureInit(&benchDenoisedPicture, benchDst);
+    BenchPictureInit(&benchNoisePicture, benchAux);
+}
+
+/***************************************
+ * BenchRun
+ *   Best-of-BENCH_RUNS cycles per pixel
+ ***************************************/
+static double BenchRun(const BenchCase_t *benchCase, EB_U32 iterations)
+{
+    EB_U64 bestCycles = ~(EB_U64)0;
+    EB_U32 runIndex;
+    EB_U32 callIndex;
+
+    // Warm caches and branch predictors
+    benchCase->run(benchCase);
+
+    for (runIndex = 0; runIndex < BENCH_RUNS; ++runIndex) {
+        EB_U64 startCycles = __rdtsc();
+        EB_U64 cycles;
+
+        for (callIndex = 0; callIndex < iterations; ++callIndex) {
+            benchCase->run(benchCase);
+        }
+
+        cycles = __rdtsc() - startCycles;
+        if (cycles < bestCycles) {
+            bestCycles = cycles;
+        }
+    }
+
+    return (double)bestCycles / iterations / (benchCase->width * benchCase->height * benchCase->scale);
+}
+
+int main(int argc, char *argv[])
+{
+    const char *jsonPath = NULL;
+    const char *filter = NULL;
+    EB_U32      iterations = BENCH_DEFAULT_ITERATIONS;
+    EB_U32      cpuAsmTypes = GetCpuAsmType();
+    BenchKernel previousKernel[BENCH_CASE_COUNT];
+    FILE       *jsonFile = NULL;
+    EB_BOOL     firstResult = EB_TRUE;
+    EB_U32      tierIndex;
+    EB_U32      caseIndex;
+    int         argIndex;
+
+    for (argIndex = 1; argIndex < argc; ++argIndex) {
+        if (strcmp(argv[argIndex], "-json") == 0 && argIndex + 1 < argc) {
+            jsonPath = argv[++argIndex];
+        }
+        else if (strcmp(argv[argIndex], "-filter") == 0 && argIndex + 1 < argc) {
+            filter = argv[++argIndex];
+        }
+        else if (strcmp(argv[argIndex], "-iterations") == 0 && argIndex + 1 < argc && atoi(argv[argIndex + 1]) > 0) {
+            iterations = (EB_U32)atoi(argv[++argIndex]);
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-json <file>] [-filter <kernel substring>] [-iterations <n>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (jsonPath) {
+        jsonFile = fopen(jsonPath, "w");
+        if (jsonFile == NULL) {
+            fprintf(stderr, "Error: cannot open %s\n", jsonPath);
+            return 1;
+        }
+        fprintf(jsonFile, "{\n  \"asm_types\": %u,\n  \"iterations\": %u,\n  \"results\": [", cpuAsmTypes, iterations);
+    }
+
+    BenchFillData();
+    memset(previousKernel, 0, sizeof(previousKernel));
+
+    printf("%-40s %-8s %-6s %-7s %s\n", "kernel", "block", "param", "tier", "cycles/pixel");
+    for (tierIndex = 0; tierIndex < BENCH_TIER_COUNT; ++tierIndex) {
+        const BenchTier_t *tier = &BenchTiers[tierIndex];
+
+        if ((tier->asmTypes & ~cpuAsmTypes) != 0) {
+            continue;
+        }
+        if (EbRtcdSetup(tier->asmTypes) != EB_ErrorNone) {
+            return 1;
+        }
+
+        for (caseIndex = 0; caseIndex < BENCH_CASE_COUNT; ++caseIndex) {
+            const BenchCase_t *benchCase = &BenchCases[caseIndex];
+            BenchKernel        kernel;
+            double             cyclesPerPixel;
+
+            if (filter && strstr(benchCase->kernel, filter) == NULL) {
+                continue;
+            }
+
+            // Skip tiers that dispatch to the kernel already timed
+            EB_MEMCPY(&kernel, (void*)benchCase->slot, sizeof(kernel));
+            if (tierIndex > 0 && kernel == previousKernel[caseIndex]) {
+                continue;
+            }
+            previousKernel[caseIndex] = kernel;
+
+            cyclesPerPixel = BenchRun(benchCase, iterations);
+            printf("%-40s %3ux%-4u %-6u %-7s %.4f\n", benchCase->kernel, benchCase->width, benchCase->height, benchCase->param, tier->name, cyclesPerPixel);
+
+            if (jsonFile) {
+                fprintf(jsonFile, "%s\n    { \"kernel\": \"%s\", \"width\": %u, \"height\": %u, \"param\": %u, \"tier\": \"%s\", \"cycles_per_pixel\": %.4f }",
+                    firstResult ? "" : ",", benchCase->kernel, benchCase->width, benchCase->height, benchCase->param, tier->name, cyclesPerPixel);
+                firstResult = EB_FALSE;
+            }
+        }
+    }
+
+    if (jsonFile) {
+        fprintf(jsonFile, "\n  ]\n}\n");
+        fclose(jsonFile);
+    }
+
+    return 0;
+}
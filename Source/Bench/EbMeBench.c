@@ -0,0 +1,378 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+// Motion estimation benchmark
+//  -Encodes synthetic clips of different content types through the API
+//  -Reports the ME work per inter picture, as returned in the picture stats
+//   (motionEstimationComputeTime), and the resulting ME SAD per sample
+//
+// Usage: SvtHevcMeBench [-w <width>] [-h <height>] [-n <frames>] [-encMode <preset>] [-json <file>]
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EbApi.h"
+
+/***************************************
+ * Content
+ ***************************************/
+#define BENCH_DEFAULT_WIDTH     832
+#define BENCH_DEFAULT_HEIGHT    480
+#define BENCH_DEFAULT_FRAMES    40
+#define BENCH_DEFAULT_ENC_MODE  4
+
+#define BENCH_PAN_X             3       // pan motion, samples per picture
+#define BENCH_PAN_Y             1
+#define BENCH_OBJECT_COUNT      4       // moving objects of the local motion clip
+#define BENCH_OBJECT_SIZE       96
+#define BENCH_TEXTURE_BLUR      2       // box filter radius of the texture
+
+typedef enum BenchContent_e {
+    BENCH_CONTENT_STATIC = 0,           // still picture
+    BENCH_CONTENT_PAN,                  // the whole picture moves
+    BENCH_CONTENT_LOCAL,                // objects moving over a still background
+    BENCH_CONTENT_NOISE,                // no temporal correlation
+    BENCH_CONTENT_COUNT
+} BenchContent_t;
+
+static const char *BenchContentNames[BENCH_CONTENT_COUNT] = { "static", "pan", "local", "noise" };
+
+typedef struct BenchClip_s
+{
+    unsigned int    width;
+    unsigned int    height;
+    unsigned int    frameCount;
+    unsigned int    textureWidth;       // texture the pictures are cut from
+    unsigned int    textureHeight;
+    unsigned char  *texture;
+    unsigned char  *luma;
+    unsigned char  *chroma;             // flat cb and cr
+} BenchClip_t;
+
+typedef struct BenchResult_s
+{
+    unsigned int    interPictureCount;
+    double          totalMeTime;
+    double          maxMeTime;
+    double          totalMeSad;
+} BenchResult_t;
+
+/***************************************
+ * BenchTextureInit
+ *   Blurred noise, large enough for the pan
+ ***************************************/
+static int BenchTextureInit(BenchClip_t *clip)
+{
+    unsigned char *noise;
+    unsigned int x, y;
+    int dx, dy;
+
+    clip->textureWidth = clip->width + BENCH_PAN_X * clip->frameCount + 2 * BENCH_TEXTURE_BLUR;
+    clip->textureHeight = clip->height + BENCH_PAN_Y * clip->frameCount + 2 * BENCH_TEXTURE_BLUR;
+    clip->texture = (unsigned char*)malloc(clip->textureWidth * clip->textureHeight);
+    noise = (unsigned char*)malloc(clip->textureWidth * clip->textureHeight);
+    if (clip->texture == NULL || noise == NULL) {
+        free(noise);
+        return -1;
+    }
+
+    srand(1);
+    for (x = 0; x < clip->textureWidth * clip->textureHeight; ++x) {
+        noise[x] = (unsigned char)(rand() & 0xFF);
+    }
+
+    memset(clip->texture, 128, clip->textureWidth * clip->textureHeight);
+    for (y = BENCH_TEXTURE_BLUR; y < clip->textureHeight - BENCH_TEXTURE_BLUR; ++y) {
+        for (x = BENCH_TEXTURE_BLUR; x < clip->textureWidth - BENCH_TEXTURE_BLUR; ++x) {
+            unsigned int sum = 0;
+            for (dy = -BENCH_TEXTURE_BLUR; dy <= BENCH_TEXTURE_BLUR; ++dy) {
+                for (dx = -BENCH_TEXTURE_BLUR; dx <= BENCH_TEXTURE_BLUR; ++dx) {
+                    sum += noise[(y + dy) * clip->textureWidth + x + dx];
+                }
+            }
+            clip->texture[y * clip->textureWidth + x] = (unsigned char)(sum / ((2 * BENCH_TEXTURE_BLUR + 1) * (2 * BENCH_TEXTURE_BLUR + 1)));
+        }
+    }
+
+    free(noise);
+    return 0;
+}
+
+/***************************************
+ * BenchCopyWindow
+ *   Copies a width x height window of the texture
+ ***************************************/
+static void BenchCopyWindow(
+    const BenchClip_t *clip,
+    unsigned int       textureX,
+    unsigned int       textureY,
+    unsigned int       pictureX,
+    unsigned int       pictureY,
+    unsigned int       width,
+    unsigned int       height)
+{
+    unsigned int y;
+
+    for (y = 0; y < height; ++y) {
+        memcpy(
+            &clip->luma[(pictureY + y) * clip->width + pictureX],
+            &clip->texture[(textureY + y) * clip->textureWidth + textureX],
+            width);
+    }
+}
+
+/***************************************
+ * BenchFillPicture
+ ***************************************/
+static void BenchFillPicture(
+    const BenchClip_t *clip,
+    BenchContent_t     content,
+    unsigned int       frameIndex)
+{
+    unsigned int objectIndex;
+    unsigned int x;
+
+    switch (content) {
+    case BENCH_CONTENT_STATIC:
+        BenchCopyWindow(clip, 0, 0, 0, 0, clip->width, clip->height);
+        break;
+
+    case BENCH_CONTENT_PAN:
+        BenchCopyWindow(clip, BENCH_PAN_X * frameIndex, BENCH_PAN_Y * frameIndex, 0, 0, clip->width, clip->height);
+        break;
+
+    case BENCH_CONTENT_LOCAL:
+        BenchCopyWindow(clip, 0, 0, 0, 0, clip->width, clip->height);
+
+        // Objects cut from the far side of the texture, bouncing with different speeds
+        for (objectIndex = 0; objectIndex < BENCH_OBJECT_COUNT; ++objectIndex) {
+            unsigned int rangeX = clip->width - BENCH_OBJECT_SIZE;
+            unsigned int rangeY = clip->height - BENCH_OBJECT_SIZE;
+            unsigned int travelX = (frameIndex * (2 + 3 * objectIndex) + objectIndex * rangeX / BENCH_OBJECT_COUNT) % (2 * rangeX);
+            unsigned int travelY = (frameIndex * (1 + 2 * objectIndex) + objectIndex * rangeY / BENCH_OBJECT_COUNT) % (2 * rangeY);
+
+            BenchCopyWindow(
+                clip,
+                clip->textureWidth - BENCH_OBJECT_SIZE - objectIndex * BENCH_OBJECT_SIZE / 2,
+                clip->textureHeight - BENCH_OBJECT_SIZE,
+                travelX < rangeX ? travelX : 2 * rangeX - travelX,
+                travelY < rangeY ? travelY : 2 * rangeY - travelY,
+                BENCH_OBJECT_SIZE,
+                BENCH_OBJECT_SIZE);
+        }
+        break;
+
+    default:
+        for (x = 0; x < clip->width * clip->height; ++x) {
+            clip->luma[x] = (unsigned char)(rand() & 0xFF);
+        }
+        break;
+    }
+}
+
+/***************************************
+ * BenchCollectPacket
+ ***************************************/
+static void BenchCollectPacket(
+    const EB_BUFFERHEADERTYPE *packet,
+    BenchResult_t             *result)
+{
+    const EB_H265_ENC_PICTURE_STATS *stats = packet->pStats;
+
+    if (packet->nFilledLen == 0 || packet->sliceType == EB_I_SLICE || packet->sliceType == EB_IDR_SLICE) {
+        return;
+    }
+
+    ++result->interPictureCount;
+    result->totalMeTime += stats->motionEstimationComputeTime;
+    result->maxMeTime = stats->motionEstimationComputeTime > result->maxMeTime ? stats->motionEstimationComputeTime : result->maxMeTime;
+    result->totalMeSad += stats->meAverageSad;
+}
+
+/***************************************
+ * BenchEncode
+ *   Encodes one clip; returns 0 on success
+ ***************************************/
+static int BenchEncode(
+    BenchClip_t    *clip,
+    BenchContent_t  content,
+    unsigned int    encMode,
+    BenchResult_t  *result)
+{
+    EB_COMPONENTTYPE          *handle = NULL;
+    EB_H265_ENC_CONFIGURATION  config;
+    EB_H265_ENC_INPUT          input;
+    EB_H265_ENC_PICTURE_STATS  stats;
+    EB_BUFFERHEADERTYPE        inputHeader;
+    EB_BUFFERHEADERTYPE        eosHeader;
+    EB_BUFFERHEADERTYPE        packet;
+    EB_ERRORTYPE               status;
+    unsigned int               packetBufferSize = clip->width * clip->height * 2;
+    unsigned int               frameIndex;
+    int                        done = 0;
+
+    memset(result, 0, sizeof(*result));
+    memset(&packet, 0, sizeof(packet));
+    packet.nSize = sizeof(packet);
+    packet.pBuffer = (unsigned char*)malloc(packetBufferSize);
+    packet.nAllocLen = packetBufferSize;
+    packet.pStats = &stats;
+    if (packet.pBuffer == NULL) {
+        return -1;
+    }
+
+    if (EbInitHandle(&handle, NULL, &config) != EB_ErrorNone) {
+        free(packet.pBuffer);
+        return -1;
+    }
+    config.sourceWidth = clip->width;
+    config.sourceHeight = clip->height;
+    config.encMode = (unsigned char)encMode;
+    config.framesToBeEncoded = clip->frameCount;
+    config.pictureStatsEnabled = 1;
+    if (EbH265EncSetParameter(handle, &config) != EB_ErrorNone || EbInitEncoder(handle) != EB_ErrorNone) {
+        EbDeinitHandle(handle);
+        free(packet.pBuffer);
+        return -1;
+    }
+
+    memset(&input, 0, sizeof(input));
+    input.luma = clip->luma;
+    input.cb = clip->chroma;
+    input.cr = clip->chroma;
+    input.yStride = clip->width;
+    input.cbStride = clip->width >> 1;
+    input.crStride = clip->width >> 1;
+
+    memset(&inputHeader, 0, sizeof(inputHeader));
+    inputHeader.nSize = sizeof(inputHeader);
+    inputHeader.pBuffer = (unsigned char*)&input;
+    inputHeader.nFilledLen = clip->width * clip->height * 3 / 2;
+    inputHeader.sliceType = EB_INVALID_SLICE;
+
+    srand(2);
+    for (frameIndex = 0; frameIndex < clip->frameCount; ++frameIndex) {
+        BenchFillPicture(clip, content, frameIndex);
+        inputHeader.pts = frameIndex;
+        EbH265EncSendPicture(handle, &inputHeader);
+
+        // Drain the packets ready so far
+        while ((status = EbH265GetPacket(handle, &packet, 0)) != EB_NoErrorEmptyQueue && status != EB_ErrorMax) {
+            BenchCollectPacket(&packet, result);
+        }
+    }
+
+    memset(&eosHeader, 0, sizeof(eosHeader));
+    eosHeader.nSize = sizeof(eosHeader);
+    eosHeader.nFlags = EB_BUFFERFLAG_EOS;
+    eosHeader.sliceType = EB_INVALID_SLICE;
+    EbH265EncSendPicture(handle, &eosHeader);
+
+    while (!done) {
+        status = EbH265GetPacket(handle, &packet, 1);
+        if (status == EB_ErrorMax) {
+            break;
+        }
+        BenchCollectPacket(&packet, result);
+        done = (packet.nFlags & EB_BUFFERFLAG_EOS) != 0;
+    }
+
+    EbDeinitEncoder(handle);
+    EbDeinitHandle(handle);
+    free(packet.pBuffer);
+
+    return done ? 0 : -1;
+}
+
+int main(int argc, char *argv[])
+{
+    const char     *jsonPath = NULL;
+    FILE           *jsonFile = NULL;
+    BenchClip_t     clip;
+    unsigned int    encMode = BENCH_DEFAULT_ENC_MODE;
+    unsigned int    content;
+    int             argIndex;
+
+    memset(&clip, 0, sizeof(clip));
+    clip.width = BENCH_DEFAULT_WIDTH;
+    clip.height = BENCH_DEFAULT_HEIGHT;
+    clip.frameCount = BENCH_DEFAULT_FRAMES;
+
+    for (argIndex = 1; argIndex < argc; ++argIndex) {
+        if (strcmp(argv[argIndex], "-w") == 0 && argIndex + 1 < argc && atoi(argv[argIndex + 1]) >= 2 * BENCH_OBJECT_SIZE) {
+            clip.width = (unsigned int)atoi(argv[++argIndex]) & ~7u;
+        }
+        else if (strcmp(argv[argIndex], "-h") == 0 && argIndex + 1 < argc && atoi(argv[argIndex + 1]) >= 2 * BENCH_OBJECT_SIZE) {
+            clip.height = (unsigned int)atoi(argv[++argIndex]) & ~7u;
+        }
+        else if (strcmp(argv[argIndex], "-n") == 0 && argIndex + 1 < argc && atoi(argv[argIndex + 1]) > 0) {
+            clip.frameCount = (unsigned int)atoi(argv[++argIndex]);
+        }
+        else if (strcmp(argv[argIndex], "-encMode") == 0 && argIndex + 1 < argc && atoi(argv[argIndex + 1]) >= 0) {
+            encMode = (unsigned int)atoi(argv[++argIndex]);
+        }
+        else if (strcmp(argv[argIndex], "-json") == 0 && argIndex + 1 < argc) {
+            jsonPath = argv[++argIndex];
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-w <width>] [-h <height>] [-n <frames>] [-encMode <preset>] [-json <file>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    clip.luma = (unsigned char*)malloc(clip.width * clip.height);
+    clip.chroma = (unsigned char*)malloc(clip.width * clip.height / 4);
+    if (clip.luma == NULL || clip.chroma == NULL || BenchTextureInit(&clip) != 0) {
+        fprintf(stderr, "Error: out of memory\n");
+        return 1;
+    }
+    memset(clip.chroma, 128, clip.width * clip.height / 4);
+
+    if (jsonPath) {
+        jsonFile = fopen(jsonPath, "w");
+        if (jsonFile == NULL) {
+            fprintf(stderr, "Error: cannot open %s\n", jsonPath);
+            return 1;
+        }
+        fprintf(jsonFile, "{\n  \"width\": %u,\n  \"height\": %u,\n  \"frames\": %u,\n  \"enc_mode\": %u,\n  \"results\": [",
+            clip.width, clip.height, clip.frameCount, encMode);
+    }
+
+    printf("%-8s %-9s %-16s %-16s %s\n", "content", "pictures", "ME ms/picture", "max ME ms", "ME SAD/sample");
+    for (content = 0; content < BENCH_CONTENT_COUNT; ++content) {
+        BenchResult_t result;
+        double        averageMeTime;
+        double        averageMeSad;
+
+        if (BenchEncode(&clip, (BenchContent_t)content, encMode, &result) != 0) {
+            fprintf(stderr, "Error: encoding the %s clip failed\n", BenchContentNames[content]);
+            return 1;
+        }
+
+        averageMeTime = result.interPictureCount ? result.totalMeTime / result.interPictureCount : 0;
+        averageMeSad = result.interPictureCount ? result.totalMeSad / result.interPictureCount : 0;
+        printf("%-8s %-9u %-16.3f %-16.3f %.3f\n", BenchContentNames[content], result.interPictureCount, averageMeTime, result.maxMeTime, averageMeSad);
+
+        if (jsonFile) {
+            fprintf(jsonFile, "%s\n    { \"content\": \"%s\", \"pictures\": %u, \"me_ms_per_picture\": %.3f, \"max_me_ms\": %.3f, \"me_sad_per_sample\": %.3f }",
+                content ? "," : "", BenchContentNames[content], result.interPictureCount, averageMeTime, result.maxMeTime, averageMeSad);
+        }
+    }
+
+    if (jsonFile) {
+        fprintf(jsonFile, "\n  ]\n}\n");
+        fclose(jsonFile);
+    }
+
+    free(clip.texture);
+    free(clip.luma);
+    free(clip.chroma);
+
+    return 0;
+}
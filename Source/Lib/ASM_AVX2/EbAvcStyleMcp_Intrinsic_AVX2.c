@@ -0,0 +1,176 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "immintrin.h"
+#include "EbAvcStyleMcp_AVX2.h"
+#include "EbAvcStyleMcp_SSSE3.h"
+#include "EbDefinitions.h"
+
+/*******************************************
+* AVC-style 4-tap luma filters
+*
+* Every ymm holds the same columns of two rows, one row per lane, and goes
+* through the maddubs sequence of the SSSE3 kernels, so both give the same
+* samples. An odd last row is left to the SSSE3 kernels.
+*******************************************/
+
+#define AVC_STYLE_LOAD2x16(p0, p1)  _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(p0))), _mm_loadu_si128((__m128i *)(p1)), 0x1)
+#define AVC_STYLE_LOAD2x8(p0, p1)   _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadl_epi64((__m128i *)(p0))), _mm_loadl_epi64((__m128i *)(p1)), 0x1)
+
+static __m256i AvcStyleLumaFilter16_AVX2(__m256i ref0, __m256i ref1, __m256i ref2, __m256i ref3, __m256i IFCoeff_1_0, __m256i IFCoeff_3_2)
+{
+    const __m256i IFOffset = _mm256_set1_epi16(0x0010);
+    __m256i sum_lo, sum_hi;
+
+    sum_lo = _mm256_add_epi16(_mm256_maddubs_epi16(_mm256_unpacklo_epi8(ref0, ref1), IFCoeff_1_0),
+        _mm256_maddubs_epi16(_mm256_unpacklo_epi8(ref2, ref3), IFCoeff_3_2));
+    sum_hi = _mm256_add_epi16(_mm256_maddubs_epi16(_mm256_unpackhi_epi8(ref0, ref1), IFCoeff_1_0),
+        _mm256_maddubs_epi16(_mm256_unpackhi_epi8(ref2, ref3), IFCoeff_3_2));
+
+    sum_lo = _mm256_srai_epi16(_mm256_add_epi16(sum_lo, IFOffset), 5);
+    sum_hi = _mm256_srai_epi16(_mm256_add_epi16(sum_hi, IFOffset), 5);
+    return _mm256_packus_epi16(sum_lo, sum_hi);
+}
+
+static __m256i AvcStyleLumaFilter8_AVX2(__m256i ref0, __m256i ref1, __m256i ref2, __m256i ref3, __m256i IFCoeff_1_0, __m256i IFCoeff_3_2)
+{
+    const __m256i IFOffset = _mm256_set1_epi16(0x0010);
+    __m256i sum;
+
+    sum = _mm256_add_epi16(_mm256_maddubs_epi16(_mm256_unpacklo_epi8(ref0, ref1), IFCoeff_1_0),
+        _mm256_maddubs_epi16(_mm256_unpacklo_epi8(ref2, ref3), IFCoeff_3_2));
+
+    sum = _mm256_srai_epi16(_mm256_add_epi16(sum, IFOffset), 5);
+    return _mm256_packus_epi16(sum, sum);
+}
+
+void AvcStyleLumaInterpolationFilterHorizontal_AVX2_INTRIN(
+    EB_BYTE refPic,
+    EB_U32 srcStride,
+    EB_BYTE dst,
+    EB_U32 dstStride,
+    EB_U32 puWidth,
+    EB_U32 puHeight,
+    EB_BYTE tempBuf,
+    EB_U32 fracPos)
+{
+    const __m256i IFCoeff_1_0 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)(AvcStyleLumaIFCoeff8_SSSE3 + (fracPos << 5) - 32)));
+    const __m256i IFCoeff_3_2 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)(AvcStyleLumaIFCoeff8_SSSE3 + (fracPos << 5) - 16)));
+    EB_U32 width_cnt, height_cnt;
+    __m256i sum_clip_U8;
+
+    if (!(puWidth & 15)) { // 16x
+        for (height_cnt = 0; height_cnt + 2 <= puHeight; height_cnt += 2) {
+            for (width_cnt = 0; width_cnt < puWidth; width_cnt += 16) {
+                EB_BYTE ref = refPic + width_cnt;
+
+                sum_clip_U8 = AvcStyleLumaFilter16_AVX2(
+                    AVC_STYLE_LOAD2x16(ref - 1, ref + srcStride - 1),
+                    AVC_STYLE_LOAD2x16(ref, ref + srcStride),
+                    AVC_STYLE_LOAD2x16(ref + 1, ref + srcStride + 1),
+                    AVC_STYLE_LOAD2x16(ref + 2, ref + srcStride + 2),
+                    IFCoeff_1_0,
+                    IFCoeff_3_2);
+                _mm_storeu_si128((__m128i *)(dst + width_cnt), _mm256_castsi256_si128(sum_clip_U8));
+                _mm_storeu_si128((__m128i *)(dst + dstStride + width_cnt), _mm256_extracti128_si256(sum_clip_U8, 1));
+            }
+            refPic += 2 * srcStride;
+            dst += 2 * dstStride;
+        }
+    }
+    else { // 8x
+        for (height_cnt = 0; height_cnt + 2 <= puHeight; height_cnt += 2) {
+            for (width_cnt = 0; width_cnt < puWidth; width_cnt += 8) {
+                EB_BYTE ref = refPic + width_cnt;
+
+                sum_clip_U8 = AvcStyleLumaFilter8_AVX2(
+                    AVC_STYLE_LOAD2x8(ref - 1, ref + srcStride - 1),
+                    AVC_STYLE_LOAD2x8(ref, ref + srcStride),
+                    AVC_STYLE_LOAD2x8(ref + 1, ref + srcStride + 1),
+                    AVC_STYLE_LOAD2x8(ref + 2, ref + srcStride + 2),
+                    IFCoeff_1_0,
+                    IFCoeff_3_2);
+                _mm_storel_epi64((__m128i *)(dst + width_cnt), _mm256_castsi256_si128(sum_clip_U8));
+                _mm_storel_epi64((__m128i *)(dst + dstStride + width_cnt), _mm256_extracti128_si256(sum_clip_U8, 1));
+            }
+            refPic += 2 * srcStride;
+            dst += 2 * dstStride;
+        }
+    }
+
+    if (puHeight & 1) {
+        AvcStyleLumaInterpolationFilterHorizontal_SSSE3_INTRIN(refPic, srcStride, dst, dstStride, puWidth, 1, tempBuf, fracPos);
+    }
+}
+
+void AvcStyleLumaInterpolationFilterVertical_AVX2_INTRIN(
+    EB_BYTE refPic,
+    EB_U32 srcStride,
+    EB_BYTE dst,
+    EB_U32 dstStride,
+    EB_U32 puWidth,
+    EB_U32 puHeight,
+    EB_BYTE tempBuf,
+    EB_U32 fracPos)
+{
+    const __m256i IFCoeff_1_0 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)(AvcStyleLumaIFCoeff8_SSSE3 + (fracPos << 5) - 32)));
+    const __m256i IFCoeff_3_2 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)(AvcStyleLumaIFCoeff8_SSSE3 + (fracPos << 5) - 16)));
+    EB_U32 width_cnt, height_cnt;
+    EB_BYTE refPicTemp, dstTemp;
+    __m256i ref01, ref12, ref23, ref34, sum_clip_U8;
+
+    if (!(puWidth & 15)) { // 16x
+        for (width_cnt = 0; width_cnt < puWidth; width_cnt += 16) {
+            refPicTemp = refPic + width_cnt - srcStride;
+            dstTemp = dst + width_cnt;
+
+            // Rows -1..2 feed the first output row, rows 0..3 the second
+            ref01 = AVC_STYLE_LOAD2x16(refPicTemp, refPicTemp + srcStride);
+            ref12 = AVC_STYLE_LOAD2x16(refPicTemp + srcStride, refPicTemp + 2 * srcStride);
+
+            for (height_cnt = 0; height_cnt + 2 <= puHeight; height_cnt += 2) {
+                ref23 = AVC_STYLE_LOAD2x16(refPicTemp + 2 * srcStride, refPicTemp + 3 * srcStride);
+                ref34 = AVC_STYLE_LOAD2x16(refPicTemp + 3 * srcStride, refPicTemp + 4 * srcStride);
+
+                sum_clip_U8 = AvcStyleLumaFilter16_AVX2(ref01, ref12, ref23, ref34, IFCoeff_1_0, IFCoeff_3_2);
+                _mm_storeu_si128((__m128i *)(dstTemp), _mm256_castsi256_si128(sum_clip_U8));
+                _mm_storeu_si128((__m128i *)(dstTemp + dstStride), _mm256_extracti128_si256(sum_clip_U8, 1));
+
+                ref01 = ref23;
+                ref12 = ref34;
+                refPicTemp += 2 * srcStride;
+                dstTemp += 2 * dstStride;
+            }
+        }
+    }
+    else { // 8x
+        for (width_cnt = 0; width_cnt < puWidth; width_cnt += 8) {
+            refPicTemp = refPic + width_cnt - srcStride;
+            dstTemp = dst + width_cnt;
+
+            ref01 = AVC_STYLE_LOAD2x8(refPicTemp, refPicTemp + srcStride);
+            ref12 = AVC_STYLE_LOAD2x8(refPicTemp + srcStride, refPicTemp + 2 * srcStride);
+
+            for (height_cnt = 0; height_cnt + 2 <= puHeight; height_cnt += 2) {
+                ref23 = AVC_STYLE_LOAD2x8(refPicTemp + 2 * srcStride, refPicTemp + 3 * srcStride);
+                ref34 = AVC_STYLE_LOAD2x8(refPicTemp + 3 * srcStride, refPicTemp + 4 * srcStride);
+
+                sum_clip_U8 = AvcStyleLumaFilter8_AVX2(ref01, ref12, ref23, ref34, IFCoeff_1_0, IFCoeff_3_2);
+                _mm_storel_epi64((__m128i *)(dstTemp), _mm256_castsi256_si128(sum_clip_U8));
+                _mm_storel_epi64((__m128i *)(dstTemp + dstStride), _mm256_extracti128_si256(sum_clip_U8, 1));
+
+                ref01 = ref23;
+                ref12 = ref34;
+                refPicTemp += 2 * srcStride;
+                dstTemp += 2 * dstStride;
+            }
+        }
+    }
+
+    if (puHeight & 1) {
+        height_cnt = puHeight - 1;
+        AvcStyleLumaInterpolationFilterVertical_SSSE3_INTRIN(refPic + height_cnt * srcStride, srcStride, dst + height_cnt * dstStride, dstStride, puWidth, 1, tempBuf, fracPos);
+    }
+}
@@ -0,0 +1,36 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbDeblockingFilter_AVX2_h
+#define EbDeblockingFilter_AVX2_h
+
+#include "EbDefinitions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void Luma8SampleEdgeDLFCore_AVX2_INTRIN(
+    EB_BYTE                edgeStartSample,
+    EB_U32                 reconLumaPicStride,
+    EB_BOOL                isVerticalEdge,
+    EB_S32                 tc0,
+    EB_S32                 beta0,
+    EB_S32                 tc1,
+    EB_S32                 beta1);
+
+void Luma8SampleEdgeDLFCore16bit_AVX2_INTRIN(
+    EB_U16         *edgeStartFilteredSamplePtr,
+    EB_U32          reconLumaPicStride,
+    EB_BOOL         isVerticalEdge,
+    EB_S32          tc0,
+    EB_S32          beta0,
+    EB_S32          tc1,
+    EB_S32          beta1);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbDeblockingFilter_AVX2_h
@@ -0,0 +1,367 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+#include "EbDefinitions.h"
+#include "EbDeblockingFilter_AVX2.h"
+
+// Luma 8 sample edges are filtered as two 4 sample edges, one per 128-bit
+// lane, with the lane layout of Luma4SampleEdgeDLFCore_SSSE3:
+//   x0: p3 q3, x1: p2 q2, x2: p1 q1, x3: p0 q0 (4 rows of p, then 4 rows of q)
+// so every in-lane step below is the SSSE3 step, with tc and beta per lane.
+
+static inline __m256i LumaEdgeLanes16(EB_S32 lane0, EB_S32 lane1)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi16((short)lane0)), _mm_set1_epi16((short)lane1), 1);
+}
+
+static inline __m256i LumaEdgeLanes32(EB_S32 lane0, EB_S32 lane1)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi32(lane0)), _mm_set1_epi32(lane1), 1);
+}
+
+/*******************************************
+* Luma8SampleEdgeFilter
+*   Filters x1..x3 in place. Returns EB_FALSE
+*   when neither 4 sample edge is filtered.
+*******************************************/
+static inline EB_BOOL Luma8SampleEdgeFilter(
+    __m256i  x0,
+    __m256i *x1,
+    __m256i *x2,
+    __m256i *x3,
+    EB_S32   tc0,
+    EB_S32   beta0,
+    EB_S32   tc1,
+    EB_S32   beta1)
+{
+    __m256i d, e, d32;
+    __m256i x3r;
+    __m256i f0, f1, f2;
+    __m256i tcx;
+    __m256i filterMask, strongMask;
+    __m256i y1, y2, y3;
+    EB_BOOL filter0, filter1;
+    EB_BOOL strong0, strong1;
+    int     strongBits;
+
+    // d: dp0 dp3 in words 0 and 3, dq0 dq3 in words 4 and 7 of each lane
+    d = _mm256_sub_epi16(*x1, *x2);
+    d = _mm256_sub_epi16(d, *x2);
+    d = _mm256_add_epi16(d, *x3);
+    d = _mm256_abs_epi16(d);
+
+    // e: d0 in words 0 and 4, d3 in words 3 and 7 of each lane
+    e = _mm256_add_epi16(d, _mm256_shuffle_epi32(d, 0x4e));
+    filter0 = (EB_BOOL)(_mm256_extract_epi16(e, 0) + _mm256_extract_epi16(e, 3) < beta0);
+    filter1 = (EB_BOOL)(_mm256_extract_epi16(e, 8) + _mm256_extract_epi16(e, 11) < beta1);
+    if (!filter0 && !filter1) {
+        return EB_FALSE;
+    }
+
+    // d32: dp in dwords 0 and 1, dq in dwords 2 and 3 of each lane
+    d32 = _mm256_shufflelo_epi16(d, 0xcc);
+    d32 = _mm256_shufflehi_epi16(d32, 0xcc);
+    d32 = _mm256_madd_epi16(d32, _mm256_set1_epi16(1));
+
+    tcx = LumaEdgeLanes16(tc0, tc1);
+    x3r = _mm256_shuffle_epi32(*x3, 0x4e);
+
+    f0 = _mm256_max_epi16(_mm256_sub_epi16(x0, *x3), _mm256_sub_epi16(*x3, x0));
+    f0 = _mm256_add_epi16(f0, _mm256_shuffle_epi32(f0, 0x4e));
+    f0 = _mm256_cmpgt_epi16(LumaEdgeLanes16(beta0 >> 3, beta1 >> 3), f0);
+
+    f1 = _mm256_max_epi16(_mm256_sub_epi16(*x3, x3r), _mm256_sub_epi16(x3r, *x3));
+    f1 = _mm256_cmpgt_epi16(LumaEdgeLanes16((5 * tc0 + 1) >> 1, (5 * tc1 + 1) >> 1), f1);
+
+    f2 = _mm256_cmpgt_epi16(LumaEdgeLanes16(beta0 >> 2, beta1 >> 2), _mm256_add_epi16(e, e));
+
+    f0 = _mm256_and_si256(f0, f1);
+    f0 = _mm256_and_si256(f0, f2);
+
+    strongBits = _mm256_movemask_epi8(f0);
+    strong0 = (EB_BOOL)(filter0 && (strongBits & 0xc3) == 0xc3);
+    strong1 = (EB_BOOL)(filter1 && ((strongBits >> 16) & 0xc3) == 0xc3);
+
+    y1 = *x1;
+    y2 = *x2;
+    y3 = *x3;
+
+    // weak filter, for the lanes not taking the strong one
+    if ((filter0 && !strong0) || (filter1 && !strong1)) {
+        __m256i dl, d2, tcx10, tcw;
+
+        dl = _mm256_mullo_epi16(*x3, _mm256_set1_epi16(9));
+        dl = _mm256_sub_epi16(dl, _mm256_mullo_epi16(*x2, _mm256_set1_epi16(3)));
+        dl = _mm256_sub_epi16(_mm256_shuffle_epi32(dl, 0x4e), dl);
+        dl = _mm256_add_epi16(dl, _mm256_setr_epi16(8, 8, 8, 8, 7, 7, 7, 7, 8, 8, 8, 8, 7, 7, 7, 7));
+        dl = _mm256_srai_epi16(dl, 4);
+
+        tcx10 = _mm256_mullo_epi16(tcx, _mm256_set1_epi16(10));
+
+        tcw = _mm256_and_si256(tcx, _mm256_cmpgt_epi16(tcx10, dl));
+        tcw = _mm256_and_si256(tcw, _mm256_cmpgt_epi16(dl, _mm256_sub_epi16(_mm256_setzero_si256(), tcx10)));
+
+        dl = _mm256_min_epi16(dl, tcw);
+        dl = _mm256_max_epi16(dl, _mm256_sub_epi16(_mm256_setzero_si256(), tcw));
+
+        y3 = _mm256_add_epi16(y3, dl);
+
+        tcw = _mm256_srai_epi16(tcw, 1);
+        tcw = _mm256_and_si256(tcw, _mm256_cmpgt_epi32(LumaEdgeLanes32((3 * beta0) >> 4, (3 * beta1) >> 4), d32)); // side threshold
+
+        d2 = _mm256_sub_epi16(_mm256_avg_epu16(*x3, *x1), *x2);
+        d2 = _mm256_add_epi16(d2, dl);
+        d2 = _mm256_srai_epi16(d2, 1);
+        d2 = _mm256_min_epi16(d2, tcw);
+        d2 = _mm256_max_epi16(d2, _mm256_sub_epi16(_mm256_setzero_si256(), tcw));
+
+        y2 = _mm256_add_epi16(y2, d2);
+    }
+
+    // strong filter, blended over the weak result
+    if (strong0 || strong1) {
+        __m256i c0, c1, c2, c3;
+        __m256i s1, s2, s3;
+        __m256i tcx2 = _mm256_add_epi16(tcx, tcx);
+
+        c0 = _mm256_add_epi16(x0, *x1);  // q2 + q3
+        c1 = _mm256_add_epi16(*x1, *x2); // q1 + q2
+        c2 = _mm256_add_epi16(*x2, *x3); // q0 + q1
+        c3 = _mm256_add_epi16(*x3, x3r); // p0 + q0
+
+        s2 = _mm256_add_epi16(c3, c1);
+        c2 = _mm256_add_epi16(c2, _mm256_shuffle_epi32(c2, 0x4e));
+
+        s1 = _mm256_add_epi16(s2, c0);
+        s1 = _mm256_add_epi16(s1, c0);
+        s3 = _mm256_add_epi16(s2, c2);
+
+        s1 = _mm256_srai_epi16(_mm256_add_epi16(s1, _mm256_set1_epi16(4)), 3);
+        s2 = _mm256_srai_epi16(_mm256_add_epi16(s2, _mm256_set1_epi16(2)), 2);
+        s3 = _mm256_srai_epi16(_mm256_add_epi16(s3, _mm256_set1_epi16(4)), 3);
+
+        s1 = _mm256_max_epi16(s1, _mm256_sub_epi16(*x1, tcx2));
+        s1 = _mm256_min_epi16(s1, _mm256_add_epi16(*x1, tcx2));
+        s2 = _mm256_max_epi16(s2, _mm256_sub_epi16(*x2, tcx2));
+        s2 = _mm256_min_epi16(s2, _mm256_add_epi16(*x2, tcx2));
+        s3 = _mm256_max_epi16(s3, _mm256_sub_epi16(*x3, tcx2));
+        s3 = _mm256_min_epi16(s3, _mm256_add_epi16(*x3, tcx2));
+
+        strongMask = LumaEdgeLanes16(strong0 ? -1 : 0, strong1 ? -1 : 0);
+        y1 = _mm256_blendv_epi8(y1, s1, strongMask);
+        y2 = _mm256_blendv_epi8(y2, s2, strongMask);
+        y3 = _mm256_blendv_epi8(y3, s3, strongMask);
+    }
+
+    filterMask = LumaEdgeLanes16(filter0 ? -1 : 0, filter1 ? -1 : 0);
+    *x1 = _mm256_blendv_epi8(*x1, y1, filterMask);
+    *x2 = _mm256_blendv_epi8(*x2, y2, filterMask);
+    *x3 = _mm256_blendv_epi8(*x3, y3, filterMask);
+
+    return EB_TRUE;
+}
+
+void Luma8SampleEdgeDLFCore_AVX2_INTRIN(
+    EB_BYTE                edgeStartSample,
+    EB_U32                 reconLumaPicStride,
+    EB_BOOL                isVerticalEdge,
+    EB_S32                 tc0,
+    EB_S32                 beta0,
+    EB_S32                 tc1,
+    EB_S32                 beta1)
+{
+    __m256i x0, x1, x2, x3;
+    __m256i a0, a1, a2, a3, b0, b1;
+    __m256i z0, z1;
+
+    if (isVerticalEdge)
+    {
+        EB_BYTE rowPtr = edgeStartSample - 4;
+        EB_U32  stride4 = reconLumaPicStride << 2;
+
+        // rows 0..3 in lane 0, rows 4..7 in lane 1
+        a0 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadl_epi64((__m128i *)(rowPtr + 0 * reconLumaPicStride))), _mm_loadl_epi64((__m128i *)(rowPtr + 0 * reconLumaPicStride + stride4)), 1);
+        a1 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadl_epi64((__m128i *)(rowPtr + 1 * reconLumaPicStride))), _mm_loadl_epi64((__m128i *)(rowPtr + 1 * reconLumaPicStride + stride4)), 1);
+        a2 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadl_epi64((__m128i *)(rowPtr + 2 * reconLumaPicStride))), _mm_loadl_epi64((__m128i *)(rowPtr + 2 * reconLumaPicStride + stride4)), 1);
+        a3 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadl_epi64((__m128i *)(rowPtr + 3 * reconLumaPicStride))), _mm_loadl_epi64((__m128i *)(rowPtr + 3 * reconLumaPicStride + stride4)), 1);
+
+        b0 = _mm256_unpacklo_epi8(a0, a1);
+        b1 = _mm256_unpacklo_epi8(a2, a3);
+        a0 = _mm256_unpacklo_epi16(b0, b1);
+        a1 = _mm256_unpackhi_epi16(b0, b1);
+        a1 = _mm256_shuffle_epi32(a1, 0x1b);
+        b0 = _mm256_unpacklo_epi32(a0, a1);
+        b1 = _mm256_unpackhi_epi32(a0, a1);
+        x0 = _mm256_unpacklo_epi8(b0, _mm256_setzero_si256());
+        x1 = _mm256_unpackhi_epi8(b0, _mm256_setzero_si256());
+        x2 = _mm256_unpacklo_epi8(b1, _mm256_setzero_si256());
+        x3 = _mm256_unpackhi_epi8(b1, _mm256_setzero_si256());
+
+        if (!Luma8SampleEdgeFilter(x0, &x1, &x2, &x3, tc0, beta0, tc1, beta1)) {
+            return;
+        }
+
+        z0 = _mm256_packus_epi16(x0, x1);
+        z1 = _mm256_packus_epi16(x2, x3);
+        a0 = _mm256_unpacklo_epi32(z0, z1);
+        a1 = _mm256_unpackhi_epi32(z0, z1);
+        b0 = _mm256_unpacklo_epi32(a0, a1);
+        b1 = _mm256_unpackhi_epi32(a0, a1);
+        b1 = _mm256_shuffle_epi32(b1, 0x1b);
+        a0 = _mm256_unpacklo_epi8(b0, b1);
+        a1 = _mm256_unpackhi_epi8(b0, b1);
+        b0 = _mm256_unpacklo_epi8(a0, a1);
+        b1 = _mm256_unpackhi_epi8(a0, a1);
+        a0 = _mm256_unpacklo_epi8(b0, b1);
+        a1 = _mm256_unpackhi_epi8(b0, b1);
+
+        {
+            __m128i rows01 = _mm256_castsi256_si128(a0);
+            __m128i rows23 = _mm256_castsi256_si128(a1);
+            __m128i rows45 = _mm256_extracti128_si256(a0, 1);
+            __m128i rows67 = _mm256_extracti128_si256(a1, 1);
+            *(EB_U64 *)(rowPtr + 0 * reconLumaPicStride) = _mm_extract_epi64(rows01, 0);
+            *(EB_U64 *)(rowPtr + 1 * reconLumaPicStride) = _mm_extract_epi64(rows01, 1);
+            *(EB_U64 *)(rowPtr + 2 * reconLumaPicStride) = _mm_extract_epi64(rows23, 0);
+            *(EB_U64 *)(rowPtr + 3 * reconLumaPicStride) = _mm_extract_epi64(rows23, 1);
+            *(EB_U64 *)(rowPtr + 0 * reconLumaPicStride + stride4) = _mm_extract_epi64(rows45, 0);
+            *(EB_U64 *)(rowPtr + 1 * reconLumaPicStride + stride4) = _mm_extract_epi64(rows45, 1);
+            *(EB_U64 *)(rowPtr + 2 * reconLumaPicStride + stride4) = _mm_extract_epi64(rows67, 0);
+            *(EB_U64 *)(rowPtr + 3 * reconLumaPicStride + stride4) = _mm_extract_epi64(rows67, 1);
+        }
+    }
+    else
+    {
+        __m128i t0, t1, t2, lo, hi;
+
+        // columns 0..3 in lane 0, columns 4..7 in lane 1
+        x0 = _mm256_cvtepu8_epi16(_mm_unpacklo_epi32(_mm_loadl_epi64((__m128i *)(edgeStartSample - 4 * (EB_S32)reconLumaPicStride)), _mm_loadl_epi64((__m128i *)(edgeStartSample + 3 * reconLumaPicStride))));
+        x1 = _mm256_cvtepu8_epi16(_mm_unpacklo_epi32(_mm_loadl_epi64((__m128i *)(edgeStartSample - 3 * (EB_S32)reconLumaPicStride)), _mm_loadl_epi64((__m128i *)(edgeStartSample + 2 * reconLumaPicStride))));
+        x2 = _mm256_cvtepu8_epi16(_mm_unpacklo_epi32(_mm_loadl_epi64((__m128i *)(edgeStartSample - 2 * (EB_S32)reconLumaPicStride)), _mm_loadl_epi64((__m128i *)(edgeStartSample + 1 * reconLumaPicStride))));
+        x3 = _mm256_cvtepu8_epi16(_mm_unpacklo_epi32(_mm_loadl_epi64((__m128i *)(edgeStartSample - 1 * (EB_S32)reconLumaPicStride)), _mm_loadl_epi64((__m128i *)(edgeStartSample + 0 * reconLumaPicStride))));
+
+        if (!Luma8SampleEdgeFilter(x0, &x1, &x2, &x3, tc0, beta0, tc1, beta1)) {
+            return;
+        }
+
+        z0 = _mm256_packus_epi16(x1, x2); // p2 q2 p1 q1 per lane
+        z1 = _mm256_packus_epi16(x3, x3); // p0 q0 per lane
+
+        lo = _mm256_castsi256_si128(z0);
+        hi = _mm256_extracti128_si256(z0, 1);
+        t0 = _mm_unpacklo_epi32(lo, hi);
+        t1 = _mm_unpackhi_epi32(lo, hi);
+        t2 = _mm_unpacklo_epi32(_mm256_castsi256_si128(z1), _mm256_extracti128_si256(z1, 1));
+
+        *(EB_U64 *)(edgeStartSample - 3 * (EB_S32)reconLumaPicStride) = _mm_extract_epi64(t0, 0);
+        *(EB_U64 *)(edgeStartSample - 2 * (EB_S32)reconLumaPicStride) = _mm_extract_epi64(t1, 0);
+        *(EB_U64 *)(edgeStartSample - 1 * (EB_S32)reconLumaPicStride) = _mm_extract_epi64(t2, 0);
+        *(EB_U64 *)(edgeStartSample + 0 * reconLumaPicStride) = _mm_extract_epi64(t2, 1);
+        *(EB_U64 *)(edgeStartSample + 1 * reconLumaPicStride) = _mm_extract_epi64(t1, 1);
+        *(EB_U64 *)(edgeStartSample + 2 * reconLumaPicStride) = _mm_extract_epi64(t0, 1);
+    }
+}
+
+void Luma8SampleEdgeDLFCore16bit_AVX2_INTRIN(
+    EB_U16         *edgeStartFilteredSamplePtr,
+    EB_U32          reconLumaPicStride,
+    EB_BOOL         isVerticalEdge,
+    EB_S32          tc0,
+    EB_S32          beta0,
+    EB_S32          tc1,
+    EB_S32          beta1)
+{
+    const __m256i maxSample = _mm256_set1_epi16(1023);
+    __m256i x0, x1, x2, x3;
+
+    if (isVerticalEdge)
+    {
+        EB_U16 *rowPtr = edgeStartFilteredSamplePtr - 4;
+        EB_U32  stride4 = reconLumaPicStride << 2;
+        __m256i a0, a1, a2, a3;
+        __m256i b0, b1, b2, b3;
+        __m256i c0, c1, c2, c3;
+
+        // rows 0..3 in lane 0, rows 4..7 in lane 1
+        a0 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(rowPtr + 0 * reconLumaPicStride))), _mm_loadu_si128((__m128i *)(rowPtr + 0 * reconLumaPicStride + stride4)), 1);
+        a1 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(rowPtr + 1 * reconLumaPicStride))), _mm_loadu_si128((__m128i *)(rowPtr + 1 * reconLumaPicStride + stride4)), 1);
+        a2 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(rowPtr + 2 * reconLumaPicStride))), _mm_loadu_si128((__m128i *)(rowPtr + 2 * reconLumaPicStride + stride4)), 1);
+        a3 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(rowPtr + 3 * reconLumaPicStride))), _mm_loadu_si128((__m128i *)(rowPtr + 3 * reconLumaPicStride + stride4)), 1);
+
+        b0 = _mm256_unpacklo_epi16(a0, a1);
+        b1 = _mm256_unpackhi_epi16(a0, a1);
+        b2 = _mm256_unpacklo_epi16(a2, a3);
+        b3 = _mm256_unpackhi_epi16(a2, a3);
+        c0 = _mm256_unpacklo_epi32(b0, b2); // p3 p2
+        c1 = _mm256_unpackhi_epi32(b0, b2); // p1 p0
+        c2 = _mm256_unpacklo_epi32(b1, b3); // q0 q1
+        c3 = _mm256_unpackhi_epi32(b1, b3); // q2 q3
+        x0 = _mm256_unpacklo_epi64(c0, _mm256_srli_si256(c3, 8));
+        x1 = _mm256_unpackhi_epi64(c0, _mm256_slli_si256(c3, 8));
+        x2 = _mm256_unpacklo_epi64(c1, _mm256_srli_si256(c2, 8));
+        x3 = _mm256_unpackhi_epi64(c1, _mm256_slli_si256(c2, 8));
+
+        if (!Luma8SampleEdgeFilter(x0, &x1, &x2, &x3, tc0, beta0, tc1, beta1)) {
+            return;
+        }
+        x2 = _mm256_min_epi16(_mm256_max_epi16(x2, _mm256_setzero_si256()), maxSample);
+        x3 = _mm256_min_epi16(_mm256_max_epi16(x3, _mm256_setzero_si256()), maxSample);
+
+        c0 = _mm256_unpacklo_epi64(x0, x1); // p3 p2
+        c1 = _mm256_unpacklo_epi64(x2, x3); // p1 p0
+        c2 = _mm256_unpackhi_epi64(x3, x2); // q0 q1
+        c3 = _mm256_unpackhi_epi64(x1, x0); // q2 q3
+        b0 = _mm256_unpacklo_epi16(c0, c1);
+        b1 = _mm256_unpackhi_epi16(c0, c1);
+        b2 = _mm256_unpacklo_epi16(c2, c3);
+        b3 = _mm256_unpackhi_epi16(c2, c3);
+        c0 = _mm256_unpacklo_epi16(b0, b1); // p side, rows 0 1
+        c1 = _mm256_unpackhi_epi16(b0, b1); // p side, rows 2 3
+        c2 = _mm256_unpacklo_epi16(b2, b3); // q side, rows 0 1
+        c3 = _mm256_unpackhi_epi16(b2, b3); // q side, rows 2 3
+        a0 = _mm256_unpacklo_epi64(c0, c2);
+        a1 = _mm256_unpackhi_epi64(c0, c2);
+        a2 = _mm256_unpacklo_epi64(c1, c3);
+        a3 = _mm256_unpackhi_epi64(c1, c3);
+
+        _mm_storeu_si128((__m128i *)(rowPtr + 0 * reconLumaPicStride), _mm256_castsi256_si128(a0));
+        _mm_storeu_si128((__m128i *)(rowPtr + 1 * reconLumaPicStride), _mm256_castsi256_si128(a1));
+        _mm_storeu_si128((__m128i *)(rowPtr + 2 * reconLumaPicStride), _mm256_castsi256_si128(a2));
+        _mm_storeu_si128((__m128i *)(rowPtr + 3 * reconLumaPicStride), _mm256_castsi256_si128(a3));
+        _mm_storeu_si128((__m128i *)(rowPtr + 0 * reconLumaPicStride + stride4), _mm256_extracti128_si256(a0, 1));
+        _mm_storeu_si128((__m128i *)(rowPtr + 1 * reconLumaPicStride + stride4), _mm256_extracti128_si256(a1, 1));
+        _mm_storeu_si128((__m128i *)(rowPtr + 2 * reconLumaPicStride + stride4), _mm256_extracti128_si256(a2, 1));
+        _mm_storeu_si128((__m128i *)(rowPtr + 3 * reconLumaPicStride + stride4), _mm256_extracti128_si256(a3, 1));
+    }
+    else
+    {
+        EB_S32 stride = (EB_S32)reconLumaPicStride;
+
+        // columns 0..3 in lane 0, columns 4..7 in lane 1
+        x0 = _mm256_permute4x64_epi64(_mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(edgeStartFilteredSamplePtr - 4 * stride))), _mm_loadu_si128((__m128i *)(edgeStartFilteredSamplePtr + 3 * stride)), 1), 0xd8);
+        x1 = _mm256_permute4x64_epi64(_mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(edgeStartFilteredSamplePtr - 3 * stride))), _mm_loadu_si128((__m128i *)(edgeStartFilteredSamplePtr + 2 * stride)), 1), 0xd8);
+        x2 = _mm256_permute4x64_epi64(_mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(edgeStartFilteredSamplePtr - 2 * stride))), _mm_loadu_si128((__m128i *)(edgeStartFilteredSamplePtr + 1 * stride)), 1), 0xd8);
+        x3 = _mm256_permute4x64_epi64(_mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(edgeStartFilteredSamplePtr - 1 * stride))), _mm_loadu_si128((__m128i *)(edgeStartFilteredSamplePtr + 0 * stride)), 1), 0xd8);
+
+        if (!Luma8SampleEdgeFilter(x0, &x1, &x2, &x3, tc0, beta0, tc1, beta1)) {
+            return;
+        }
+        x2 = _mm256_min_epi16(_mm256_max_epi16(x2, _mm256_setzero_si256()), maxSample);
+        x3 = _mm256_min_epi16(_mm256_max_epi16(x3, _mm256_setzero_si256()), maxSample);
+
+        // back to p row | q row
+        x1 = _mm256_permute4x64_epi64(x1, 0xd8);
+        x2 = _mm256_permute4x64_epi64(x2, 0xd8);
+        x3 = _mm256_permute4x64_epi64(x3, 0xd8);
+
+        _mm_storeu_si128((__m128i *)(edgeStartFilteredSamplePtr - 3 * stride), _mm256_castsi256_si128(x1));
+        _mm_storeu_si128((__m128i *)(edgeStartFilteredSamplePtr - 2 * stride), _mm256_castsi256_si128(x2));
+        _mm_storeu_si128((__m128i *)(edgeStartFilteredSamplePtr - 1 * stride), _mm256_castsi256_si128(x3));
+        _mm_storeu_si128((__m128i *)(edgeStartFilteredSamplePtr + 0 * stride), _mm256_extracti128_si256(x3, 1));
+        _mm_storeu_si128((__m128i *)(edgeStartFilteredSamplePtr + 1 * stride), _mm256_extracti128_si256(x2, 1));
+        _mm_storeu_si128((__m128i *)(edgeStartFilteredSamplePtr + 2 * stride), _mm256_extracti128_si256(x1, 1));
+    }
+}
@@ -0,0 +1,477 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbDefinitions.h"
+#include "immintrin.h"
+#include "EbIntraPrediction_AVX2.h"
+
+/*******************************************
+* 10-bit intra prediction
+*   All intermediate values fit in 16 bits:
+*   a planar prediction is at most
+*   64 * 1023 + 32 before the shift, and an
+*   angular one 32 * 1023 + 16.
+*******************************************/
+static const EB_U16 intraColumnIndex16bit[32] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31
+};
+
+static inline EB_U32 IntraLog2Size(EB_U32 size)
+{
+    return size == 32 ? 5 : size == 16 ? 4 : size == 8 ? 3 : 2;
+}
+
+/*******************************************
+* Planar
+*   pred(x, y) = base(x) + y * delta(x) + (size - 1 - x) * left[y]
+*   with base(x) = (x + 1) * topRight + (size - 1) * top[x] + bottomLeft + size
+*   and delta(x) = bottomLeft - top[x]. The wrapped 16-bit sum is exact
+*   as the final value is below 65536.
+*******************************************/
+static inline __m256i PlanarBase16bit(__m256i column, __m256i top, __m256i topRight, __m256i bottomLeft, EB_U32 size)
+{
+    __m256i base = _mm256_mullo_epi16(_mm256_add_epi16(column, _mm256_set1_epi16(1)), topRight);
+    base = _mm256_add_epi16(base, _mm256_mullo_epi16(top, _mm256_set1_epi16((EB_S16)(size - 1))));
+    return _mm256_add_epi16(base, _mm256_add_epi16(bottomLeft, _mm256_set1_epi16((EB_S16)size)));
+}
+
+void IntraModePlanar16bit_AVX2_INTRIN(
+    const EB_U32   size,                       //input parameter, denotes the size of the current PU
+    EB_U16        *refSamples,                 //input parameter, pointer to the reference samples
+    EB_U16        *predictionPtr,              //output parameter, pointer to the prediction
+    const EB_U32   predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL  skip)                       //skip half rows
+{
+    const EB_U16 *left = refSamples;
+    const EB_U16 *top = refSamples + (size << 1) + 1;
+    const EB_U32 rowStride = skip ? 2 : 1;
+    const EB_U32 pStride = predictionBufferStride * rowStride;
+    const __m128i shift = _mm_cvtsi32_si128(IntraLog2Size(size) + 1);
+    const __m256i topRight = _mm256_set1_epi16(top[size]);
+    const __m256i bottomLeft = _mm256_set1_epi16(left[size]);
+    __m256i column, topRow, weight, acc, step, pred;
+    EB_U32 y;
+
+    if (size == 4) {
+        // Four rows per register
+        EB_U32 rowCount = 4 / rowStride;
+        EB_U32 i;
+        EB_ALIGN(32) EB_U16 rows[16];
+
+        column = _mm256_broadcastq_epi64(_mm_loadl_epi64((__m128i *)intraColumnIndex16bit));
+        topRow = _mm256_broadcastq_epi64(_mm_loadl_epi64((__m128i *)top));
+        weight = _mm256_sub_epi16(_mm256_set1_epi16(3), column);
+        acc = PlanarBase16bit(column, topRow, topRight, bottomLeft, size);
+        step = _mm256_sub_epi16(bottomLeft, topRow);
+        acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(step, _mm256_setr_epi16(
+            0, 0, 0, 0,
+            (EB_S16)rowStride, (EB_S16)rowStride, (EB_S16)rowStride, (EB_S16)rowStride,
+            (EB_S16)(2 * rowStride), (EB_S16)(2 * rowStride), (EB_S16)(2 * rowStride), (EB_S16)(2 * rowStride),
+            (EB_S16)(3 * rowStride), (EB_S16)(3 * rowStride), (EB_S16)(3 * rowStride), (EB_S16)(3 * rowStride))));
+        pred = _mm256_setr_epi16(
+            left[0], left[0], left[0], left[0],
+            left[rowStride], left[rowStride], left[rowStride], left[rowStride],
+            left[2 * rowStride], left[2 * rowStride], left[2 * rowStride], left[2 * rowStride],
+            left[3 * rowStride], left[3 * rowStride], left[3 * rowStride], left[3 * rowStride]);
+        pred = _mm256_srl_epi16(_mm256_add_epi16(acc, _mm256_mullo_epi16(weight, pred)), shift);
+        _mm256_store_si256((__m256i *)rows, pred);
+
+        for (i = 0; i < rowCount; ++i) {
+            _mm_storel_epi64((__m128i *)predictionPtr, _mm_loadl_epi64((__m128i *)(rows + 4 * i)));
+            predictionPtr += pStride;
+        }
+    }
+    else if (size == 8) {
+        // Two rows per register
+        column = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i *)intraColumnIndex16bit));
+        topRow = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i *)top));
+        weight = _mm256_sub_epi16(_mm256_set1_epi16(7), column);
+        acc = PlanarBase16bit(column, topRow, topRight, bottomLeft, size);
+        step = _mm256_sub_epi16(bottomLeft, topRow);
+        acc = _mm256_add_epi16(acc, _mm256_inserti128_si256(_mm256_setzero_si256(), _mm256_extracti128_si256(_mm256_mullo_epi16(step, _mm256_set1_epi16((EB_S16)rowStride)), 1), 1));
+        step = _mm256_mullo_epi16(step, _mm256_set1_epi16((EB_S16)(rowStride << 1)));
+
+        for (y = 0; y < size; y += rowStride << 1) {
+            pred = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi16(left[y])), _mm_set1_epi16(left[y + rowStride]), 1);
+            pred = _mm256_srl_epi16(_mm256_add_epi16(acc, _mm256_mullo_epi16(weight, pred)), shift);
+            _mm_storeu_si128((__m128i *)predictionPtr, _mm256_castsi256_si128(pred));
+            _mm_storeu_si128((__m128i *)(predictionPtr + pStride), _mm256_extracti128_si256(pred, 1));
+            acc = _mm256_add_epi16(acc, step);
+            predictionPtr += pStride << 1;
+        }
+    }
+    else {
+        // One row per register, two for 32x32
+        EB_U32 x;
+
+        for (x = 0; x < size; x += 16) {
+            EB_U16 *predPtr = predictionPtr + x;
+
+            column = _mm256_loadu_si256((__m256i *)(intraColumnIndex16bit + x));
+            topRow = _mm256_loadu_si256((__m256i *)(top + x));
+            weight = _mm256_sub_epi16(_mm256_set1_epi16((EB_S16)(size - 1)), column);
+            acc = PlanarBase16bit(column, topRow, topRight, bottomLeft, size);
+            step = _mm256_mullo_epi16(_mm256_sub_epi16(bottomLeft, topRow), _mm256_set1_epi16((EB_S16)rowStride));
+
+            for (y = 0; y < size; y += rowStride) {
+                pred = _mm256_srl_epi16(_mm256_add_epi16(acc, _mm256_mullo_epi16(weight, _mm256_set1_epi16(left[y]))), shift);
+                _mm256_storeu_si256((__m256i *)predPtr, pred);
+                acc = _mm256_add_epi16(acc, step);
+                predPtr += pStride;
+            }
+        }
+    }
+}
+
+/*******************************************
+* DC
+*******************************************/
+static inline EB_U32 SumSamples16bit(const EB_U16 *left, const EB_U16 *top, EB_U32 size)
+{
+    __m256i sum;
+    __m128i sum128;
+
+    if (size == 4) {
+        sum = _mm256_castsi128_si256(_mm_add_epi16(_mm_loadl_epi64((__m128i *)left), _mm_loadl_epi64((__m128i *)top)));
+    }
+    else if (size == 8) {
+        sum = _mm256_castsi128_si256(_mm_add_epi16(_mm_loadu_si128((__m128i *)left), _mm_loadu_si128((__m128i *)top)));
+        sum = _mm256_inserti128_si256(sum, _mm_setzero_si128(), 1);
+    }
+    else {
+        sum = _mm256_add_epi16(_mm256_loadu_si256((__m256i *)left), _mm256_loadu_si256((__m256i *)top));
+        if (size == 32) {
+            sum = _mm256_add_epi16(sum, _mm256_add_epi16(_mm256_loadu_si256((__m256i *)(left + 16)), _mm256_loadu_si256((__m256i *)(top + 16))));
+        }
+    }
+
+    if (size == 4) {
+        sum128 = _mm_madd_epi16(_mm_move_epi64(_mm256_castsi256_si128(sum)), _mm_set1_epi16(1));
+    }
+    else {
+        sum = _mm256_madd_epi16(sum, _mm256_set1_epi16(1));
+        sum128 = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    }
+    sum128 = _mm_add_epi32(sum128, _mm_srli_si128(sum128, 8));
+    sum128 = _mm_add_epi32(sum128, _mm_srli_si128(sum128, 4));
+
+    return (EB_U32)_mm_cvtsi128_si32(sum128);
+}
+
+static inline void IntraModeDC16bit(
+    const EB_U32   size,
+    EB_U16        *refSamples,
+    EB_U16        *predictionPtr,
+    const EB_U32   predictionBufferStride,
+    const EB_BOOL  skip,
+    const EB_BOOL  filter)
+{
+    const EB_U16 *left = refSamples;
+    const EB_U16 *top = refSamples + (size << 1) + 1;
+    const EB_U32 rowStride = skip ? 2 : 1;
+    const EB_U32 pStride = predictionBufferStride * rowStride;
+    EB_U16 dcValue = (EB_U16)((SumSamples16bit(left, top, size) + size) >> (IntraLog2Size(size) + 1));
+    __m256i dc = _mm256_set1_epi16(dcValue);
+    EB_U16 *predPtr = predictionPtr;
+    EB_U32 y;
+
+    for (y = 0; y < size; y += rowStride) {
+        if (size == 4) {
+            _mm_storel_epi64((__m128i *)predPtr, _mm256_castsi256_si128(dc));
+        }
+        else if (size == 8) {
+            _mm_storeu_si128((__m128i *)predPtr, _mm256_castsi256_si128(dc));
+        }
+        else {
+            _mm256_storeu_si256((__m256i *)predPtr, dc);
+            if (size == 32) {
+                _mm256_storeu_si256((__m256i *)(predPtr + 16), dc);
+            }
+        }
+        predPtr += pStride;
+    }
+
+    // Filter the first row and column, for luma below 32x32
+    if (filter && size < 32) {
+        const __m256i round = _mm256_add_epi16(_mm256_mullo_epi16(dc, _mm256_set1_epi16(3)), _mm256_set1_epi16(2));
+        EB_ALIGN(32) EB_U16 firstColumn[16];
+        __m256i edge;
+
+        if (size == 16) {
+            edge = _mm256_srli_epi16(_mm256_add_epi16(_mm256_loadu_si256((__m256i *)left), round), 2);
+            _mm256_store_si256((__m256i *)firstColumn, edge);
+            edge = _mm256_srli_epi16(_mm256_add_epi16(_mm256_loadu_si256((__m256i *)top), round), 2);
+            _mm256_storeu_si256((__m256i *)predictionPtr, edge);
+        }
+        else {
+            // Both edges in one register
+            edge = size == 4 ?
+                _mm256_castsi128_si256(_mm_unpacklo_epi64(_mm_loadl_epi64((__m128i *)left), _mm_loadl_epi64((__m128i *)top))) :
+                _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i *)left)), _mm_loadu_si128((__m128i *)top), 1);
+            edge = _mm256_srli_epi16(_mm256_add_epi16(edge, round), 2);
+            _mm256_store_si256((__m256i *)firstColumn, edge);
+            if (size == 4) {
+                _mm_storel_epi64((__m128i *)predictionPtr, _mm_srli_si128(_mm256_castsi256_si128(edge), 8));
+            }
+            else {
+                _mm_storeu_si128((__m128i *)predictionPtr, _mm256_extracti128_si256(edge, 1));
+            }
+        }
+        predictionPtr[0] = (EB_U16)((left[0] + top[0] + (dcValue << 1) + 2) >> 2);
+
+        predPtr = predictionPtr;
+        for (y = rowStride; y < size; y += rowStride) {
+            predPtr += pStride;
+            predPtr[0] = firstColumn[y];
+        }
+    }
+}
+
+void IntraModeDCLuma16bit_AVX2_INTRIN(
+    const EB_U32   size,                       //input parameter, denotes the size of the current PU
+    EB_U16        *refSamples,                 //input parameter, pointer to the reference samples
+    EB_U16        *predictionPtr,              //output parameter, pointer to the prediction
+    const EB_U32   predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL  skip)                       //skip half rows
+{
+    IntraModeDC16bit(size, refSamples, predictionPtr, predictionBufferStride, skip, EB_TRUE);
+}
+
+void IntraModeDCChroma16bit_AVX2_INTRIN(
+    const EB_U32   size,                       //input parameter, denotes the size of the current PU
+    EB_U16        *refSamples,                 //input parameter, pointer to the reference samples
+    EB_U16        *predictionPtr,              //output parameter, pointer to the prediction
+    const EB_U32   predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL  skip)                       //skip half rows
+{
+    IntraModeDC16bit(size, refSamples, predictionPtr, predictionBufferStride, skip, EB_FALSE);
+}
+
+/*******************************************
+* Angular
+*   One line of ((32 - f) * ref[i] + f * ref[i + 1] + 16) >> 5,
+*   a row for the vertical modes and a column for the horizontal ones.
+*******************************************/
+static inline void AngularLine16bit(
+    EB_U16        *dst,
+    const EB_U16  *ref,
+    EB_U32         size,
+    EB_S32         deltaSum)
+{
+    const EB_S32 deltaInt = deltaSum >> 5;
+    const EB_S16 deltaFract = (EB_S16)(deltaSum & 31);
+
+    ref += deltaInt;
+
+    if (size <= 8) {
+        const __m128i coeff0 = _mm_set1_epi16(32 - deltaFract);
+        const __m128i coeff1 = _mm_set1_epi16(deltaFract);
+        __m128i a, b, pred;
+
+        if (size == 4) {
+            a = _mm_loadl_epi64((__m128i *)ref);
+            b = _mm_loadl_epi64((__m128i *)(ref + 1));
+        }
+        else {
+            a = _mm_loadu_si128((__m128i *)ref);
+            b = _mm_loadu_si128((__m128i *)(ref + 1));
+        }
+        pred = _mm_add_epi16(_mm_mullo_epi16(a, coeff0), _mm_mullo_epi16(b, coeff1));
+        pred = _mm_srli_epi16(_mm_add_epi16(pred, _mm_set1_epi16(16)), 5);
+
+        if (size == 4) {
+            _mm_storel_epi64((__m128i *)dst, pred);
+        }
+        else {
+            _mm_storeu_si128((__m128i *)dst, pred);
+        }
+    }
+    else {
+        const __m256i coeff0 = _mm256_set1_epi16(32 - deltaFract);
+        const __m256i coeff1 = _mm256_set1_epi16(deltaFract);
+        EB_U32 x;
+
+        for (x = 0; x < size; x += 16) {
+            __m256i pred = _mm256_add_epi16(
+                _mm256_mullo_epi16(_mm256_loadu_si256((__m256i *)(ref + x)), coeff0),
+                _mm256_mullo_epi16(_mm256_loadu_si256((__m256i *)(ref + x + 1)), coeff1));
+            pred = _mm256_srli_epi16(_mm256_add_epi16(pred, _mm256_set1_epi16(16)), 5);
+            _mm256_storeu_si256((__m256i *)(dst + x), pred);
+        }
+    }
+}
+
+void IntraModeAngular16bit_Vertical_Kernel_AVX2_INTRIN(
+    EB_U32         size,                       //input parameter, denotes the size of the current PU
+    EB_U16        *refSampMain,                //input parameter, pointer to the reference samples
+    EB_U16        *predictionPtr,              //output parameter, pointer to the prediction
+    EB_U32         predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL  skip,
+    EB_S32         intraPredAngle)
+{
+    const EB_U32 rowStride = skip ? 2 : 1;
+    EB_S32 deltaSum = intraPredAngle;
+    EB_U32 y;
+
+    refSampMain += 1; // top sample
+    for (y = 0; y < size; y += rowStride) {
+        AngularLine16bit(predictionPtr, refSampMain, size, deltaSum);
+        predictionPtr += rowStride * predictionBufferStride;
+        deltaSum += rowStride * intraPredAngle;
+    }
+}
+
+// Transposes an 8x8 block of 16-bit samples, writing every rowStride-th output row
+static inline void Transpose8x8_16bit(
+    const EB_U16  *src,
+    EB_U32         srcStride,
+    EB_U16        *dst,
+    EB_U32         dstStride,
+    EB_U32         rowStride)
+{
+    __m128i a0, a1, a2, a3, a4, a5, a6, a7;
+    __m128i b0, b1, b2, b3, b4, b5, b6, b7;
+    __m128i out[8];
+    EB_U32 i;
+
+    a0 = _mm_loadu_si128((__m128i *)(src + 0 * srcStride));
+    a1 = _mm_loadu_si128((__m128i *)(src + 1 * srcStride));
+    a2 = _mm_loadu_si128((__m128i *)(src + 2 * srcStride));
+    a3 = _mm_loadu_si128((__m128i *)(src + 3 * srcStride));
+    a4 = _mm_loadu_si128((__m128i *)(src + 4 * srcStride));
+    a5 = _mm_loadu_si128((__m128i *)(src + 5 * srcStride));
+    a6 = _mm_loadu_si128((__m128i *)(src + 6 * srcStride));
+    a7 = _mm_loadu_si128((__m128i *)(src + 7 * srcStride));
+
+    b0 = _mm_unpacklo_epi16(a0, a1);
+    b1 = _mm_unpackhi_epi16(a0, a1);
+    b2 = _mm_unpacklo_epi16(a2, a3);
+    b3 = _mm_unpackhi_epi16(a2, a3);
+    b4 = _mm_unpacklo_epi16(a4, a5);
+    b5 = _mm_unpackhi_epi16(a4, a5);
+    b6 = _mm_unpacklo_epi16(a6, a7);
+    b7 = _mm_unpackhi_epi16(a6, a7);
+
+    a0 = _mm_unpacklo_epi32(b0, b2);
+    a1 = _mm_unpackhi_epi32(b0, b2);
+    a2 = _mm_unpacklo_epi32(b1, b3);
+    a3 = _mm_unpackhi_epi32(b1, b3);
+    a4 = _mm_unpacklo_epi32(b4, b6);
+    a5 = _mm_unpackhi_epi32(b4, b6);
+    a6 = _mm_unpacklo_epi32(b5, b7);
+    a7 = _mm_unpackhi_epi32(b5, b7);
+
+    out[0] = _mm_unpacklo_epi64(a0, a4);
+    out[1] = _mm_unpackhi_epi64(a0, a4);
+    out[2] = _mm_unpacklo_epi64(a1, a5);
+    out[3] = _mm_unpackhi_epi64(a1, a5);
+    out[4] = _mm_unpacklo_epi64(a2, a6);
+    out[5] = _mm_unpackhi_epi64(a2, a6);
+    out[6] = _mm_unpacklo_epi64(a3, a7);
+    out[7] = _mm_unpackhi_epi64(a3, a7);
+
+    for (i = 0; i < 8; i += rowStride) {
+        _mm_storeu_si128((__m128i *)(dst + i * dstStride), out[i]);
+    }
+}
+
+void IntraModeAngular16bit_Horizontal_Kernel_AVX2_INTRIN(
+    EB_U32         size,                       //input parameter, denotes the size of the current PU
+    EB_U16        *refSampMain,                //input parameter, pointer to the reference samples
+    EB_U16        *predictionPtr,              //output parameter, pointer to the prediction
+    EB_U32         predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL  skip,
+    EB_S32         intraPredAngle)
+{
+    const EB_U32 rowStride = skip ? 2 : 1;
+    EB_ALIGN(32) EB_U16 columns[32 * 32];
+    EB_S32 deltaSum = 0;
+    EB_U32 x, y;
+
+    // Predict each column as a line of the left reference, then transpose
+    refSampMain += 1; // left sample
+    for (x = 0; x < size; x++) {
+        deltaSum += intraPredAngle;
+        AngularLine16bit(columns + x * size, refSampMain, size, deltaSum);
+    }
+
+    if (size == 4) {
+        __m128i a0 = _mm_unpacklo_epi16(_mm_loadl_epi64((__m128i *)(columns + 0)), _mm_loadl_epi64((__m128i *)(columns + 4)));
+        __m128i a1 = _mm_unpacklo_epi16(_mm_loadl_epi64((__m128i *)(columns + 8)), _mm_loadl_epi64((__m128i *)(columns + 12)));
+        __m128i rows01 = _mm_unpacklo_epi32(a0, a1);
+        __m128i rows23 = _mm_unpackhi_epi32(a0, a1);
+
+        _mm_storel_epi64((__m128i *)predictionPtr, rows01);
+        _mm_storel_epi64((__m128i *)(predictionPtr + 2 * predictionBufferStride), rows23);
+        if (!skip) {
+            _mm_storel_epi64((__m128i *)(predictionPtr + predictionBufferStride), _mm_srli_si128(rows01, 8));
+            _mm_storel_epi64((__m128i *)(predictionPtr + 3 * predictionBufferStride), _mm_srli_si128(rows23, 8));
+        }
+        return;
+    }
+
+    for (y = 0; y < size; y += 8) {
+        for (x = 0; x < size; x += 8) {
+            Transpose8x8_16bit(columns + x * size + y, size, predictionPtr + y * predictionBufferStride + x, predictionBufferStride, rowStride);
+        }
+    }
+}
+
+/*******************************************
+* Reference sample [1 2 1] filter
+*******************************************/
+void IntraFilterReferenceSamples16bit_AVX2_INTRIN(
+    const EB_U16  *srcPtr,                     //input parameter, pointer to the reference samples
+    EB_U16        *dstPtr,                     //output parameter, pointer to the filtered reference samples
+    EB_U32         count)                      //input parameter, number of reference samples
+{
+    EB_U32 last = count - 1;
+    EB_U32 i;
+
+    // The last block of each pass overlaps the previous one
+    if (last > 16) {
+        const __m256i two = _mm256_set1_epi16(2);
+
+        for (i = 1; ; i += 16) {
+            __m256i filtered;
+
+            if (i + 16 > last) {
+                i = last - 16;
+            }
+            filtered = _mm256_add_epi16(_mm256_loadu_si256((__m256i *)(srcPtr + i - 1)), _mm256_loadu_si256((__m256i *)(srcPtr + i + 1)));
+            filtered = _mm256_add_epi16(filtered, _mm256_add_epi16(_mm256_slli_epi16(_mm256_loadu_si256((__m256i *)(srcPtr + i)), 1), two));
+            _mm256_storeu_si256((__m256i *)(dstPtr + i), _mm256_srli_epi16(filtered, 2));
+            if (i + 16 == last) {
+                break;
+            }
+        }
+    }
+    else if (last > 8) {
+        const __m128i two = _mm_set1_epi16(2);
+
+        for (i = 1; ; i += 8) {
+            __m128i filtered;
+
+            if (i + 8 > last) {
+                i = last - 8;
+            }
+            filtered = _mm_add_epi16(_mm_loadu_si128((__m128i *)(srcPtr + i - 1)), _mm_loadu_si128((__m128i *)(srcPtr + i + 1)));
+            filtered = _mm_add_epi16(filtered, _mm_add_epi16(_mm_slli_epi16(_mm_loadu_si128((__m128i *)(srcPtr + i)), 1), two));
+            _mm_storeu_si128((__m128i *)(dstPtr + i), _mm_srli_epi16(filtered, 2));
+            if (i + 8 == last) {
+                break;
+            }
+        }
+    }
+    else {
+        for (i = 1; i < last; i++) {
+            dstPtr[i] = (srcPtr[i - 1] + (srcPtr[i] << 1) + srcPtr[i + 1] + 2) >> 2;
+        }
+    }
+
+    dstPtr[0] = srcPtr[0];
+    dstPtr[last] = srcPtr[last];
+}
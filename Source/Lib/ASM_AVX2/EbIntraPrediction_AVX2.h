@@ -98,6 +98,48 @@ EB_U32 UpdateNeighborDcIntraPred_AVX2_INTRIN(
     EB_U32                           srcOriginY,
 	EB_U32                           blockSize);
 
+extern void IntraModePlanar16bit_AVX2_INTRIN(
+    const EB_U32      size,                       //input parameter, denotes the size of the current PU
+    EB_U16           *refSamples,                 //input parameter, pointer to the reference samples
+    EB_U16           *predictionPtr,              //output parameter, pointer to the prediction
+    const EB_U32      predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL     skip);
+
+extern void IntraModeDCLuma16bit_AVX2_INTRIN(
+    const EB_U32      size,                       //input parameter, denotes the size of the current PU
+    EB_U16           *refSamples,                 //input parameter, pointer to the reference samples
+    EB_U16           *predictionPtr,              //output parameter, pointer to the prediction
+    const EB_U32      predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL     skip);
+
+extern void IntraModeDCChroma16bit_AVX2_INTRIN(
+    const EB_U32      size,                       //input parameter, denotes the size of the current PU
+    EB_U16           *refSamples,                 //input parameter, pointer to the reference samples
+    EB_U16           *predictionPtr,              //output parameter, pointer to the prediction
+    const EB_U32      predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL     skip);
+
+extern void IntraModeAngular16bit_Vertical_Kernel_AVX2_INTRIN(
+    EB_U32            size,                       //input parameter, denotes the size of the current PU
+    EB_U16           *refSampMain,                //input parameter, pointer to the reference samples
+    EB_U16           *predictionPtr,              //output parameter, pointer to the prediction
+    EB_U32            predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL     skip,
+    EB_S32            intraPredAngle);
+
+extern void IntraModeAngular16bit_Horizontal_Kernel_AVX2_INTRIN(
+    EB_U32            size,                       //input parameter, denotes the size of the current PU
+    EB_U16           *refSampMain,                //input parameter, pointer to the reference samples
+    EB_U16           *predictionPtr,              //output parameter, pointer to the prediction
+    EB_U32            predictionBufferStride,     //input parameter, denotes the stride for the prediction ptr
+    const EB_BOOL     skip,
+    EB_S32            intraPredAngle);
+
+extern void IntraFilterReferenceSamples16bit_AVX2_INTRIN(
+    const EB_U16     *srcPtr,                     //input parameter, pointer to the reference samples
+    EB_U16           *dstPtr,                     //output parameter, pointer to the filtered reference samples
+    EB_U32            count);                     //input parameter, number of reference samples
+
 #ifdef __cplusplus
 }
 #endif
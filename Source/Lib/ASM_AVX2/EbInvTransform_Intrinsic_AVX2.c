@@ -0,0 +1,791 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+#include "EbDefinitions.h"
+#include "EbTransforms_AVX2.h"
+
+#ifdef __cplusplus
+extern "C" const EB_S16 coeff_tbl2[48 * 8];
+#else
+extern const EB_S16 coeff_tbl2[48 * 8];
+#endif
+
+#define SHIFT_INV_1ST           7
+#define SHIFT_INV_2ND           12
+
+#define INV_OUT_RESIDUAL        0
+#define INV_OUT_RECON_8BIT      1
+#define INV_OUT_RECON_16BIT     2
+
+// Destination of the second (horizontal) pass: either the residual, or the
+// reconstruction obtained by adding the residual to the prediction and clipping
+typedef struct InvTransformOutput_s
+{
+    EB_U32   type;
+    void    *dst;
+    EB_U32   dstStride;
+    void    *pred;
+    EB_U32   predStride;
+} InvTransformOutput_t;
+
+static inline __m256i InvCoeffPair(EB_S16 c0, EB_S16 c1)
+{
+    return _mm256_set1_epi32((EB_S32)(((EB_U32)(EB_U16)c1 << 16) | (EB_U16)c0));
+}
+
+static inline __m256i InvLoadRows(const EB_S16 *src, EB_U32 stride)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)src)), _mm_loadu_si128((const __m128i *)(src + stride)), 1);
+}
+
+/*******************************************
+* Reconstruction stores
+*   res holds rows row and row + 1 of the
+*   residual, 16, 8 or 4 columns wide
+*******************************************/
+static inline void InvReconRow16(const InvTransformOutput_t *out, EB_U32 row, EB_U32 col, __m256i res)
+{
+    __m256i sum;
+
+    if (out->type == INV_OUT_RECON_8BIT) {
+        EB_U8 *pred = (EB_U8 *)out->pred + row * out->predStride + col;
+        EB_U8 *recon = (EB_U8 *)out->dst + row * out->dstStride + col;
+        sum = _mm256_adds_epi16(res, _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)pred)));
+        _mm_storeu_si128((__m128i *)recon, _mm_packus_epi16(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)));
+    }
+    else if (out->type == INV_OUT_RECON_16BIT) {
+        EB_U16 *pred = (EB_U16 *)out->pred + row * out->predStride + col;
+        EB_U16 *recon = (EB_U16 *)out->dst + row * out->dstStride + col;
+        sum = _mm256_adds_epi16(res, _mm256_loadu_si256((__m256i *)pred));
+        sum = _mm256_min_epi16(_mm256_max_epi16(sum, _mm256_setzero_si256()), _mm256_set1_epi16(0x3FF));
+        _mm256_storeu_si256((__m256i *)recon, sum);
+    }
+    else {
+        _mm256_storeu_si256((__m256i *)((EB_S16 *)out->dst + row * out->dstStride + col), res);
+    }
+}
+
+static inline void InvReconRows8(const InvTransformOutput_t *out, EB_U32 row, __m256i res)
+{
+    __m256i sum;
+
+    if (out->type == INV_OUT_RECON_8BIT) {
+        EB_U8 *pred = (EB_U8 *)out->pred + row * out->predStride;
+        EB_U8 *recon = (EB_U8 *)out->dst + row * out->dstStride;
+        __m128i packed;
+        sum = _mm256_adds_epi16(res, _mm256_cvtepu8_epi16(_mm_unpacklo_epi64(_mm_loadl_epi64((__m128i *)pred), _mm_loadl_epi64((__m128i *)(pred + out->predStride)))));
+        packed = _mm_packus_epi16(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        _mm_storel_epi64((__m128i *)recon, packed);
+        _mm_storel_epi64((__m128i *)(recon + out->dstStride), _mm_srli_si128(packed, 8));
+    }
+    else if (out->type == INV_OUT_RECON_16BIT) {
+        EB_U16 *pred = (EB_U16 *)out->pred + row * out->predStride;
+        EB_U16 *recon = (EB_U16 *)out->dst + row * out->dstStride;
+        sum = _mm256_adds_epi16(res, InvLoadRows((EB_S16 *)pred, out->predStride));
+        sum = _mm256_min_epi16(_mm256_max_epi16(sum, _mm256_setzero_si256()), _mm256_set1_epi16(0x3FF));
+        _mm_storeu_si128((__m128i *)recon, _mm256_castsi256_si128(sum));
+        _mm_storeu_si128((__m128i *)(recon + out->dstStride), _mm256_extracti128_si256(sum, 1));
+    }
+    else {
+        EB_S16 *residual = (EB_S16 *)out->dst + row * out->dstStride;
+        _mm_storeu_si128((__m128i *)residual, _mm256_castsi256_si128(res));
+        _mm_storeu_si128((__m128i *)(residual + out->dstStride), _mm256_extracti128_si256(res, 1));
+    }
+}
+
+static inline void InvReconRows4(const InvTransformOutput_t *out, EB_U32 row, __m128i res)
+{
+    __m128i sum;
+
+    if (out->type == INV_OUT_RECON_8BIT) {
+        EB_U8 *pred = (EB_U8 *)out->pred + row * out->predStride;
+        EB_U8 *recon = (EB_U8 *)out->dst + row * out->dstStride;
+        sum = _mm_unpacklo_epi32(_mm_cvtsi32_si128(*(EB_U32 *)pred), _mm_cvtsi32_si128(*(EB_U32 *)(pred + out->predStride)));
+        sum = _mm_adds_epi16(res, _mm_cvtepu8_epi16(sum));
+        sum = _mm_packus_epi16(sum, sum);
+        *(EB_U32 *)recon = _mm_cvtsi128_si32(sum);
+        *(EB_U32 *)(recon + out->dstStride) = _mm_cvtsi128_si32(_mm_srli_si128(sum, 4));
+    }
+    else if (out->type == INV_OUT_RECON_16BIT) {
+        EB_U16 *pred = (EB_U16 *)out->pred + row * out->predStride;
+        EB_U16 *recon = (EB_U16 *)out->dst + row * out->dstStride;
+        sum = _mm_unpacklo_epi64(_mm_loadl_epi64((__m128i *)pred), _mm_loadl_epi64((__m128i *)(pred + out->predStride)));
+        sum = _mm_adds_epi16(res, sum);
+        sum = _mm_min_epi16(_mm_max_epi16(sum, _mm_setzero_si128()), _mm_set1_epi16(0x3FF));
+        _mm_storel_epi64((__m128i *)recon, sum);
+        _mm_storel_epi64((__m128i *)(recon + out->dstStride), _mm_srli_si128(sum, 8));
+    }
+    else {
+        EB_S16 *residual = (EB_S16 *)out->dst + row * out->dstStride;
+        _mm_storel_epi64((__m128i *)residual, res);
+        _mm_storel_epi64((__m128i *)(residual + out->dstStride), _mm_srli_si128(res, 8));
+    }
+}
+
+/*******************************************
+* First (vertical) pass
+*   Works directly on the coefficient
+*   columns, 16 at a time, so that neither
+*   pass needs a transpose. Row pairs are
+*   interleaved and multiplied by broadcast
+*   coefficient pairs taken from coeff_tbl2.
+*******************************************/
+static inline void InvLoadPair(const EB_S16 *src, EB_U32 stride, EB_U32 row0, EB_U32 row1, __m256i *lo, __m256i *hi)
+{
+    __m256i x0 = _mm256_loadu_si256((const __m256i *)(src + row0 * stride));
+    __m256i x1 = _mm256_loadu_si256((const __m256i *)(src + row1 * stride));
+    *lo = _mm256_unpacklo_epi16(x0, x1);
+    *hi = _mm256_unpackhi_epi16(x0, x1);
+}
+
+static inline void InvStoreColumnPair(EB_S16 *dst, __m256i lo, __m256i hi)
+{
+    lo = _mm256_srai_epi32(lo, SHIFT_INV_1ST);
+    hi = _mm256_srai_epi32(hi, SHIFT_INV_1ST);
+    _mm256_storeu_si256((__m256i *)dst, _mm256_packs_epi32(lo, hi));
+}
+
+static void InvTransformColumns32(
+    EB_S16 *src,
+    EB_U32  srcStride,
+    EB_S16 *dst)
+{
+    const EB_S32 *coeff = (const EB_S32 *)coeff_tbl2;
+    const __m256i offset = _mm256_set1_epi32(1 << (SHIFT_INV_1ST - 1));
+    EB_U32 col, j, n;
+
+    for (col = 0; col < 32; col += 16) {
+        // 0..3: rows (0,4) .. (24,28), 4..7: rows (2,6) .. (26,30), 8..15: rows (1,3) .. (29,31)
+        __m256i pairLo[16], pairHi[16];
+        __m256i evenLo[16], evenHi[16];
+
+        for (j = 0; j < 4; j++) {
+            InvLoadPair(src + col, srcStride, 8 * j, 8 * j + 4, &pairLo[j], &pairHi[j]);
+            InvLoadPair(src + col, srcStride, 8 * j + 2, 8 * j + 6, &pairLo[4 + j], &pairHi[4 + j]);
+        }
+        for (j = 0; j < 8; j++) {
+            InvLoadPair(src + col, srcStride, 4 * j + 1, 4 * j + 3, &pairLo[8 + j], &pairHi[8 + j]);
+        }
+
+        for (n = 0; n < 8; n++) {
+            __m256i eeLo = offset, eeHi = offset;
+            __m256i eoLo = _mm256_setzero_si256(), eoHi = _mm256_setzero_si256();
+            for (j = 0; j < 4; j++) {
+                __m256i c0 = _mm256_set1_epi32(coeff[(2 * j + (n >> 2)) * 4 + (n & 3)]);
+                __m256i c1 = _mm256_set1_epi32(coeff[(8 + 2 * j + (n >> 2)) * 4 + (n & 3)]);
+                eeLo = _mm256_add_epi32(eeLo, _mm256_madd_epi16(pairLo[j], c0));
+                eeHi = _mm256_add_epi32(eeHi, _mm256_madd_epi16(pairHi[j], c0));
+                eoLo = _mm256_add_epi32(eoLo, _mm256_madd_epi16(pairLo[4 + j], c1));
+                eoHi = _mm256_add_epi32(eoHi, _mm256_madd_epi16(pairHi[4 + j], c1));
+            }
+            evenLo[n] = _mm256_add_epi32(eeLo, eoLo);
+            evenHi[n] = _mm256_add_epi32(eeHi, eoHi);
+            evenLo[15 - n] = _mm256_sub_epi32(eeLo, eoLo);
+            evenHi[15 - n] = _mm256_sub_epi32(eeHi, eoHi);
+        }
+
+        for (n = 0; n < 16; n++) {
+            __m256i oLo = _mm256_setzero_si256(), oHi = _mm256_setzero_si256();
+            for (j = 0; j < 8; j++) {
+                __m256i c = _mm256_set1_epi32(coeff[(16 + 4 * j + (n >> 2)) * 4 + (n & 3)]);
+                oLo = _mm256_add_epi32(oLo, _mm256_madd_epi16(pairLo[8 + j], c));
+                oHi = _mm256_add_epi32(oHi, _mm256_madd_epi16(pairHi[8 + j], c));
+            }
+            InvStoreColumnPair(dst + n * 32 + col, _mm256_add_epi32(evenLo[n], oLo), _mm256_add_epi32(evenHi[n], oHi));
+            InvStoreColumnPair(dst + (31 - n) * 32 + col, _mm256_sub_epi32(evenLo[n], oLo), _mm256_sub_epi32(evenHi[n], oHi));
+        }
+    }
+}
+
+static void InvTransformColumns16(
+    EB_S16 *src,
+    EB_U32  srcStride,
+    EB_S16 *dst)
+{
+    const EB_S32 *coeff = (const EB_S32 *)coeff_tbl2;
+    const __m256i offset = _mm256_set1_epi32(1 << (SHIFT_INV_1ST - 1));
+    // 0..3: rows (0,2) .. (12,14), 4..7: rows (1,3) .. (13,15)
+    __m256i pairLo[8], pairHi[8];
+    EB_U32 j, n;
+
+    for (j = 0; j < 4; j++) {
+        InvLoadPair(src, srcStride, 4 * j, 4 * j + 2, &pairLo[j], &pairHi[j]);
+        InvLoadPair(src, srcStride, 4 * j + 1, 4 * j + 3, &pairLo[4 + j], &pairHi[4 + j]);
+    }
+
+    for (n = 0; n < 8; n++) {
+        __m256i eLo = offset, eHi = offset;
+        __m256i oLo = _mm256_setzero_si256(), oHi = _mm256_setzero_si256();
+        for (j = 0; j < 4; j++) {
+            __m256i c0 = _mm256_set1_epi32(coeff[(2 * j + (n >> 2)) * 4 + (n & 3)]);
+            __m256i c1 = _mm256_set1_epi32(coeff[(8 + 2 * j + (n >> 2)) * 4 + (n & 3)]);
+            eLo = _mm256_add_epi32(eLo, _mm256_madd_epi16(pairLo[j], c0));
+            eHi = _mm256_add_epi32(eHi, _mm256_madd_epi16(pairHi[j], c0));
+            oLo = _mm256_add_epi32(oLo, _mm256_madd_epi16(pairLo[4 + j], c1));
+            oHi = _mm256_add_epi32(oHi, _mm256_madd_epi16(pairHi[4 + j], c1));
+        }
+        InvStoreColumnPair(dst + n * 16, _mm256_add_epi32(eLo, oLo), _mm256_add_epi32(eHi, oHi));
+        InvStoreColumnPair(dst + (15 - n) * 16, _mm256_sub_epi32(eLo, oLo), _mm256_sub_epi32(eHi, oHi));
+    }
+}
+
+static void InvTransformColumns8(
+    EB_S16 *src,
+    EB_U32  srcStride,
+    EB_S16 *dst)
+{
+    // Columns 0..3 of a row pair in the low lane, columns 4..7 in the high lane
+    static const EB_S16 evenCoeff[4][4] = { { 64, 64, 83, 36 }, { 64, -64, 36, -83 }, { 64, -64, -36, 83 }, { 64, 64, -83, -36 } };
+    static const EB_S16 oddCoeff[4][4] = { { 89, 75, 50, 18 }, { 75, -18, -89, -50 }, { 50, -89, 18, 75 }, { 18, -50, 75, -89 } };
+    const __m256i offset = _mm256_set1_epi32(1 << (SHIFT_INV_1ST - 1));
+    __m256i pair04, pair26, pair13, pair57;
+    __m128i x[8];
+    EB_U32 n;
+
+    for (n = 0; n < 8; n++) {
+        x[n] = _mm_loadu_si128((__m128i *)(src + n * srcStride));
+    }
+    pair04 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(x[0], x[4])), _mm_unpackhi_epi16(x[0], x[4]), 1);
+    pair26 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(x[2], x[6])), _mm_unpackhi_epi16(x[2], x[6]), 1);
+    pair13 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(x[1], x[3])), _mm_unpackhi_epi16(x[1], x[3]), 1);
+    pair57 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(x[5], x[7])), _mm_unpackhi_epi16(x[5], x[7]), 1);
+
+    for (n = 0; n < 4; n++) {
+        __m256i e, o, a, b;
+        e = _mm256_add_epi32(_mm256_madd_epi16(pair04, InvCoeffPair(evenCoeff[n][0], evenCoeff[n][1])), offset);
+        e = _mm256_add_epi32(e, _mm256_madd_epi16(pair26, InvCoeffPair(evenCoeff[n][2], evenCoeff[n][3])));
+        o = _mm256_madd_epi16(pair13, InvCoeffPair(oddCoeff[n][0], oddCoeff[n][1]));
+        o = _mm256_add_epi32(o, _mm256_madd_epi16(pair57, InvCoeffPair(oddCoeff[n][2], oddCoeff[n][3])));
+
+        a = _mm256_srai_epi32(_mm256_add_epi32(e, o), SHIFT_INV_1ST);
+        b = _mm256_srai_epi32(_mm256_sub_epi32(e, o), SHIFT_INV_1ST);
+        a = _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8);
+
+        _mm_storeu_si128((__m128i *)(dst + n * 8), _mm256_castsi256_si128(a));
+        _mm_storeu_si128((__m128i *)(dst + (7 - n) * 8), _mm256_extracti128_si256(a, 1));
+    }
+}
+
+/*******************************************
+* Second (horizontal) pass
+*   Same butterflies as the SSE2 row
+*   transforms, two rows per register
+*******************************************/
+static void InvTransformRows32(
+    EB_S16                      *src,
+    const InvTransformOutput_t  *out,
+    EB_U32                       shift)
+{
+    const __m128i *coeff32 = (const __m128i *)coeff_tbl2;
+    __m128i s0 = _mm_cvtsi32_si128(shift);
+    __m256i o0 = _mm256_set1_epi32(1 << (shift - 1));
+    EB_U32 i, j;
+
+    for (i = 0; i < 32; i += 2)
+    {
+        __m256i x0, x1, x2, x3;
+        __m256i y0, y1, y2, y3;
+        __m256i a0, a1, a2, a3, a4, a5, a6, a7;
+        __m256i b0, b1, b2, b3, b4, b5, b6, b7;
+        __m256i e[4], eo[4], od[8];
+
+        x0 = InvLoadRows(src + i * 32 + 0x00, 32);
+        x1 = InvLoadRows(src + i * 32 + 0x08, 32);
+        x2 = InvLoadRows(src + i * 32 + 0x10, 32);
+        x3 = InvLoadRows(src + i * 32 + 0x18, 32);
+
+        y0 = _mm256_unpacklo_epi16(x0, x1);
+        y1 = _mm256_unpackhi_epi16(x0, x1);
+        y2 = _mm256_unpacklo_epi16(x2, x3);
+        y3 = _mm256_unpackhi_epi16(x2, x3);
+
+        x0 = _mm256_unpacklo_epi16(y0, y1);
+        x1 = _mm256_unpackhi_epi16(y0, y1);
+        x2 = _mm256_unpacklo_epi16(y2, y3);
+        x3 = _mm256_unpackhi_epi16(y2, y3);
+
+        y0 = _mm256_unpacklo_epi64(x0, x2); // 00 04 08 0c 10 14 18 1c
+        y1 = _mm256_unpacklo_epi64(x1, x3); // 02 06 0a 0e 12 16 1a 1e
+        y2 = _mm256_unpackhi_epi16(x0, x1); // 01 03 05 07 09 0b 0d 0f
+        y3 = _mm256_unpackhi_epi16(x2, x3); // 11 13 15 17 19 1b 1d 1f
+
+        e[0] = _mm256_shuffle_epi32(y0, 0x00);
+        e[1] = _mm256_shuffle_epi32(y0, 0x55);
+        e[2] = _mm256_shuffle_epi32(y0, 0xaa);
+        e[3] = _mm256_shuffle_epi32(y0, 0xff);
+        eo[0] = _mm256_shuffle_epi32(y1, 0x00);
+        eo[1] = _mm256_shuffle_epi32(y1, 0x55);
+        eo[2] = _mm256_shuffle_epi32(y1, 0xaa);
+        eo[3] = _mm256_shuffle_epi32(y1, 0xff);
+        od[0] = _mm256_shuffle_epi32(y2, 0x00);
+        od[1] = _mm256_shuffle_epi32(y2, 0x55);
+        od[2] = _mm256_shuffle_epi32(y2, 0xaa);
+        od[3] = _mm256_shuffle_epi32(y2, 0xff);
+        od[4] = _mm256_shuffle_epi32(y3, 0x00);
+        od[5] = _mm256_shuffle_epi32(y3, 0x55);
+        od[6] = _mm256_shuffle_epi32(y3, 0xaa);
+        od[7] = _mm256_shuffle_epi32(y3, 0xff);
+
+        a0 = a1 = o0;
+        a2 = a3 = a4 = a5 = a6 = a7 = _mm256_setzero_si256();
+        for (j = 0; j < 4; j++) {
+            a0 = _mm256_add_epi32(a0, _mm256_madd_epi16(e[j], _mm256_broadcastsi128_si256(coeff32[2 * j])));
+            a1 = _mm256_add_epi32(a1, _mm256_madd_epi16(e[j], _mm256_broadcastsi128_si256(coeff32[2 * j + 1])));
+            a2 = _mm256_add_epi32(a2, _mm256_madd_epi16(eo[j], _mm256_broadcastsi128_si256(coeff32[8 + 2 * j])));
+            a3 = _mm256_add_epi32(a3, _mm256_madd_epi16(eo[j], _mm256_broadcastsi128_si256(coeff32[9 + 2 * j])));
+        }
+        for (j = 0; j < 8; j++) {
+            a4 = _mm256_add_epi32(a4, _mm256_madd_epi16(od[j], _mm256_broadcastsi128_si256(coeff32[16 + 4 * j])));
+            a5 = _mm256_add_epi32(a5, _mm256_madd_epi16(od[j], _mm256_broadcastsi128_si256(coeff32[17 + 4 * j])));
+            a6 = _mm256_add_epi32(a6, _mm256_madd_epi16(od[j], _mm256_broadcastsi128_si256(coeff32[18 + 4 * j])));
+            a7 = _mm256_add_epi32(a7, _mm256_madd_epi16(od[j], _mm256_broadcastsi128_si256(coeff32[19 + 4 * j])));
+        }
+
+        b0 = _mm256_add_epi32(a0, a2);
+        b1 = _mm256_add_epi32(a1, a3);
+        b2 = _mm256_sub_epi32(a0, a2);
+        b3 = _mm256_sub_epi32(a1, a3);
+
+        a0 = b0;
+        a1 = b1;
+        a2 = _mm256_shuffle_epi32(b3, 0x1b); // 00011011
+        a3 = _mm256_shuffle_epi32(b2, 0x1b);
+
+        b0 = _mm256_add_epi32(a0, a4);
+        b1 = _mm256_add_epi32(a1, a5);
+        b2 = _mm256_add_epi32(a2, a6);
+        b3 = _mm256_add_epi32(a3, a7);
+        b4 = _mm256_sub_epi32(a0, a4);
+        b5 = _mm256_sub_epi32(a1, a5);
+        b6 = _mm256_sub_epi32(a2, a6);
+        b7 = _mm256_sub_epi32(a3, a7);
+
+        a0 = _mm256_sra_epi32(b0, s0);
+        a1 = _mm256_sra_epi32(b1, s0);
+        a2 = _mm256_sra_epi32(b2, s0);
+        a3 = _mm256_sra_epi32(b3, s0);
+        a4 = _mm256_sra_epi32(_mm256_shuffle_epi32(b7, 0x1b), s0);
+        a5 = _mm256_sra_epi32(_mm256_shuffle_epi32(b6, 0x1b), s0);
+        a6 = _mm256_sra_epi32(_mm256_shuffle_epi32(b5, 0x1b), s0);
+        a7 = _mm256_sra_epi32(_mm256_shuffle_epi32(b4, 0x1b), s0);
+
+        x0 = _mm256_packs_epi32(a0, a1);
+        x1 = _mm256_packs_epi32(a2, a3);
+        x2 = _mm256_packs_epi32(a4, a5);
+        x3 = _mm256_packs_epi32(a6, a7);
+
+        InvReconRow16(out, i, 0x00, _mm256_permute2x128_si256(x0, x1, 0x20));
+        InvReconRow16(out, i + 1, 0x00, _mm256_permute2x128_si256(x0, x1, 0x31));
+        InvReconRow16(out, i, 0x10, _mm256_permute2x128_si256(x2, x3, 0x20));
+        InvReconRow16(out, i + 1, 0x10, _mm256_permute2x128_si256(x2, x3, 0x31));
+    }
+}
+
+static void InvTransformRows16(
+    EB_S16                      *src,
+    const InvTransformOutput_t  *out,
+    EB_U32                       shift)
+{
+    const __m128i *coeff32 = (const __m128i *)coeff_tbl2;
+    __m128i s0 = _mm_cvtsi32_si128(shift);
+    __m256i o0 = _mm256_set1_epi32(1 << (shift - 1));
+    EB_U32 i, j;
+
+    for (i = 0; i < 16; i += 2)
+    {
+        __m256i x0, x1;
+        __m256i y0, y1;
+        __m256i a0, a1, a2, a3;
+        __m256i b0, b1, b2, b3;
+        __m256i e[4], od[4];
+
+        x0 = InvLoadRows(src + i * 16 + 0x00, 16);
+        x1 = InvLoadRows(src + i * 16 + 0x08, 16);
+
+        y0 = _mm256_unpacklo_epi16(x0, x1);
+        y1 = _mm256_unpackhi_epi16(x0, x1);
+
+        x0 = _mm256_unpacklo_epi16(y0, y1);
+        x1 = _mm256_unpackhi_epi16(y0, y1);
+
+        y0 = _mm256_unpacklo_epi16(x0, x1); // 00 02 04 06 08 0a 0c 0e
+        y1 = _mm256_unpackhi_epi16(x0, x1); // 01 03 05 07 09 0b 0d 0f
+
+        e[0] = _mm256_shuffle_epi32(y0, 0x00);
+        e[1] = _mm256_shuffle_epi32(y0, 0x55);
+        e[2] = _mm256_shuffle_epi32(y0, 0xaa);
+        e[3] = _mm256_shuffle_epi32(y0, 0xff);
+        od[0] = _mm256_shuffle_epi32(y1, 0x00);
+        od[1] = _mm256_shuffle_epi32(y1, 0x55);
+        od[2] = _mm256_shuffle_epi32(y1, 0xaa);
+        od[3] = _mm256_shuffle_epi32(y1, 0xff);
+
+        a0 = a1 = o0;
+        a2 = a3 = _mm256_setzero_si256();
+        for (j = 0; j < 4; j++) {
+            a0 = _mm256_add_epi32(a0, _mm256_madd_epi16(e[j], _mm256_broadcastsi128_si256(coeff32[2 * j])));
+            a1 = _mm256_add_epi32(a1, _mm256_madd_epi16(e[j], _mm256_broadcastsi128_si256(coeff32[2 * j + 1])));
+            a2 = _mm256_add_epi32(a2, _mm256_madd_epi16(od[j], _mm256_broadcastsi128_si256(coeff32[8 + 2 * j])));
+            a3 = _mm256_add_epi32(a3, _mm256_madd_epi16(od[j], _mm256_broadcastsi128_si256(coeff32[9 + 2 * j])));
+        }
+
+        b0 = _mm256_add_epi32(a0, a2);
+        b1 = _mm256_add_epi32(a1, a3);
+        b2 = _mm256_sub_epi32(a0, a2);
+        b3 = _mm256_sub_epi32(a1, a3);
+
+        a0 = _mm256_sra_epi32(b0, s0);
+        a1 = _mm256_sra_epi32(b1, s0);
+        a2 = _mm256_sra_epi32(_mm256_shuffle_epi32(b3, 0x1b), s0); // 00011011
+        a3 = _mm256_sra_epi32(_mm256_shuffle_epi32(b2, 0x1b), s0);
+
+        x0 = _mm256_packs_epi32(a0, a1);
+        x1 = _mm256_packs_epi32(a2, a3);
+
+        InvReconRow16(out, i, 0, _mm256_permute2x128_si256(x0, x1, 0x20));
+        InvReconRow16(out, i + 1, 0, _mm256_permute2x128_si256(x0, x1, 0x31));
+    }
+}
+
+static void InvTransformRows8(
+    EB_S16                      *src,
+    const InvTransformOutput_t  *out,
+    EB_U32                       shift)
+{
+    // 00 04 02 06 01 03 05 07 in each lane
+    const __m256i order = _mm256_setr_epi8(
+        0, 1, 8, 9, 4, 5, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+        0, 1, 8, 9, 4, 5, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+    const __m256i c04 = _mm256_setr_epi16(64, 64, 64, -64, 64, -64, 64, 64, 64, 64, 64, -64, 64, -64, 64, 64);
+    const __m256i c26 = _mm256_setr_epi16(83, 36, 36, -83, -36, 83, -83, -36, 83, 36, 36, -83, -36, 83, -83, -36);
+    const __m256i c13 = _mm256_setr_epi16(89, 75, 75, -18, 50, -89, 18, -50, 89, 75, 75, -18, 50, -89, 18, -50);
+    const __m256i c57 = _mm256_setr_epi16(50, 18, -89, -50, 18, 75, 75, -89, 50, 18, -89, -50, 18, 75, 75, -89);
+    __m128i s0 = _mm_cvtsi32_si128(shift);
+    __m256i o0 = _mm256_set1_epi32(1 << (shift - 1));
+    EB_U32 i;
+
+    for (i = 0; i < 8; i += 2)
+    {
+        __m256i x, e, o, a, b;
+
+        x = _mm256_shuffle_epi8(InvLoadRows(src + i * 8, 8), order);
+
+        e = _mm256_add_epi32(_mm256_madd_epi16(_mm256_shuffle_epi32(x, 0x00), c04), o0);
+        e = _mm256_add_epi32(e, _mm256_madd_epi16(_mm256_shuffle_epi32(x, 0x55), c26));
+        o = _mm256_madd_epi16(_mm256_shuffle_epi32(x, 0xaa), c13);
+        o = _mm256_add_epi32(o, _mm256_madd_epi16(_mm256_shuffle_epi32(x, 0xff), c57));
+
+        a = _mm256_sra_epi32(_mm256_add_epi32(e, o), s0);
+        b = _mm256_sra_epi32(_mm256_shuffle_epi32(_mm256_sub_epi32(e, o), 0x1b), s0);
+
+        InvReconRows8(out, i, _mm256_packs_epi32(a, b));
+    }
+}
+
+/*******************************************
+* 4x4 DCT / DST
+*   Each pass computes outputs 0,1 in one
+*   register and 2,3 in the other from the
+*   (0,2) and (1,3) input pairs.
+*******************************************/
+static inline __m256i InvTransform4Pass(
+    __m128i          pair02,
+    __m128i          pair13,
+    const EB_S16     coeff[4][4],
+    __m256i          offset,
+    __m128i          shift)
+{
+    __m256i x02 = _mm256_broadcastsi128_si256(pair02);
+    __m256i x13 = _mm256_broadcastsi128_si256(pair13);
+    // Output n in the low lane, output n + 1 in the high lane
+    __m256i c02 = _mm256_permute2x128_si256(InvCoeffPair(coeff[0][0], coeff[0][1]), InvCoeffPair(coeff[1][0], coeff[1][1]), 0x20);
+    __m256i c13 = _mm256_permute2x128_si256(InvCoeffPair(coeff[0][2], coeff[0][3]), InvCoeffPair(coeff[1][2], coeff[1][3]), 0x20);
+    __m256i c02b = _mm256_permute2x128_si256(InvCoeffPair(coeff[2][0], coeff[2][1]), InvCoeffPair(coeff[3][0], coeff[3][1]), 0x20);
+    __m256i c13b = _mm256_permute2x128_si256(InvCoeffPair(coeff[2][2], coeff[2][3]), InvCoeffPair(coeff[3][2], coeff[3][3]), 0x20);
+    __m256i y01, y23;
+
+    y01 = _mm256_add_epi32(_mm256_add_epi32(_mm256_madd_epi16(x02, c02), _mm256_madd_epi16(x13, c13)), offset);
+    y23 = _mm256_add_epi32(_mm256_add_epi32(_mm256_madd_epi16(x02, c02b), _mm256_madd_epi16(x13, c13b)), offset);
+
+    // 0 2 | 1 3
+    return _mm256_packs_epi32(_mm256_sra_epi32(y01, shift), _mm256_sra_epi32(y23, shift));
+}
+
+static void InvTransform4x4Kernel(
+    EB_S16                      *src,
+    EB_U32                       srcStride,
+    const InvTransformOutput_t  *out,
+    const EB_S16                 coeff[4][4],
+    EB_U32                       bitIncrement)
+{
+    const __m128i order = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+    __m128i x0, x1, x2, x3, lo, hi, s01, s23;
+    __m256i y;
+
+    x0 = _mm_loadl_epi64((__m128i *)src);
+    x1 = _mm_loadl_epi64((__m128i *)(src + srcStride));
+    x2 = _mm_loadl_epi64((__m128i *)(src + 2 * srcStride));
+    x3 = _mm_loadl_epi64((__m128i *)(src + 3 * srcStride));
+
+    y = InvTransform4Pass(_mm_unpacklo_epi16(x0, x2), _mm_unpacklo_epi16(x1, x3), coeff,
+        _mm256_set1_epi32(1 << (SHIFT_INV_1ST - 1)), _mm_cvtsi32_si128(SHIFT_INV_1ST));
+
+    // Rows of the vertical pass, regrouped into (0,2) and (1,3) column pairs
+    lo = _mm256_castsi256_si128(y);
+    hi = _mm256_extracti128_si256(y, 1);
+    s01 = _mm_shuffle_epi8(_mm_unpacklo_epi64(lo, hi), order);
+    s23 = _mm_shuffle_epi8(_mm_unpackhi_epi64(lo, hi), order);
+
+    y = InvTransform4Pass(_mm_unpacklo_epi64(s01, s23), _mm_unpackhi_epi64(s01, s23), coeff,
+        _mm256_set1_epi32(1 << (SHIFT_INV_2ND - bitIncrement - 1)), _mm_cvtsi32_si128(SHIFT_INV_2ND - bitIncrement));
+
+    // Columns back to rows
+    lo = _mm256_castsi256_si128(y);
+    hi = _mm256_extracti128_si256(y, 1);
+    x0 = _mm_unpacklo_epi16(lo, hi);
+    x1 = _mm_unpackhi_epi16(lo, hi);
+
+    InvReconRows4(out, 0, _mm_unpacklo_epi32(x0, x1));
+    InvReconRows4(out, 2, _mm_unpackhi_epi32(x0, x1));
+}
+
+// [output][(0,2) pair, (1,3) pair]
+static const EB_S16 InvDctCoeff4x4[4][4] = {
+    { 64,  64,  83,  36 },
+    { 64, -64,  36, -83 },
+    { 64, -64, -36,  83 },
+    { 64,  64, -83, -36 } };
+
+static const EB_S16 InvDstCoeff4x4[4][4] = {
+    { 29,  84,  74,  55 },
+    { 55, -29,  74, -84 },
+    { 74, -74,   0,  74 },
+    { 84,  55, -74, -29 } };
+
+/*******************************************
+* Inverse transforms
+*******************************************/
+void InvTransform32x32_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RESIDUAL, residual, dstStride, EB_NULL, 0 };
+    InvTransformColumns32(transformCoefficients, srcStride, transformInnerArrayPtr);
+    InvTransformRows32(transformInnerArrayPtr, &out, SHIFT_INV_2ND - bitIncrement);
+}
+
+void InvTransform16x16_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RESIDUAL, residual, dstStride, EB_NULL, 0 };
+    InvTransformColumns16(transformCoefficients, srcStride, transformInnerArrayPtr);
+    InvTransformRows16(transformInnerArrayPtr, &out, SHIFT_INV_2ND - bitIncrement);
+}
+
+void InvTransform8x8_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RESIDUAL, residual, dstStride, EB_NULL, 0 };
+    InvTransformColumns8(transformCoefficients, srcStride, transformInnerArrayPtr);
+    InvTransformRows8(transformInnerArrayPtr, &out, SHIFT_INV_2ND - bitIncrement);
+}
+
+void InvTransform4x4_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RESIDUAL, residual, dstStride, EB_NULL, 0 };
+    InvTransform4x4Kernel(transformCoefficients, srcStride, &out, InvDctCoeff4x4, bitIncrement);
+    (void)transformInnerArrayPtr;
+}
+
+void InvDstTransform4x4_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RESIDUAL, residual, dstStride, EB_NULL, 0 };
+    InvTransform4x4Kernel(transformCoefficients, srcStride, &out, InvDstCoeff4x4, bitIncrement);
+    (void)transformInnerArrayPtr;
+}
+
+/*******************************************
+* Inverse transform + reconstruction
+*   The horizontal pass adds the prediction
+*   and clips, so the residual never goes
+*   back to memory. The coefficients are
+*   left untouched.
+*******************************************/
+void InvTransformRecon32x32_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_8BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransformColumns32(transformCoefficients, srcStride, transformInnerArrayPtr);
+    InvTransformRows32(transformInnerArrayPtr, &out, SHIFT_INV_2ND - bitIncrement);
+}
+
+void InvTransformRecon16x16_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_8BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransformColumns16(transformCoefficients, srcStride, transformInnerArrayPtr);
+    InvTransformRows16(transformInnerArrayPtr, &out, SHIFT_INV_2ND - bitIncrement);
+}
+
+void InvTransformRecon8x8_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_8BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransformColumns8(transformCoefficients, srcStride, transformInnerArrayPtr);
+    InvTransformRows8(transformInnerArrayPtr, &out, SHIFT_INV_2ND - bitIncrement);
+}
+
+void InvTransformRecon4x4_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_8BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransform4x4Kernel(transformCoefficients, srcStride, &out, InvDctCoeff4x4, bitIncrement);
+    (void)transformInnerArrayPtr;
+}
+
+void InvDstTransformRecon4x4_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_8BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransform4x4Kernel(transformCoefficients, srcStride, &out, InvDstCoeff4x4, bitIncrement);
+    (void)transformInnerArrayPtr;
+}
+
+void InvTransformRecon32x32_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_16BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransformColumns32(transformCoefficients, srcStride, transformInnerArrayPtr);
+    InvTransformRows32(transformInnerArrayPtr, &out, SHIFT_INV_2ND - bitIncrement);
+}
+
+void InvTransformRecon16x16_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_16BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransformColumns16(transformCoefficients, srcStride, transformInnerArrayPtr);
+    InvTransformRows16(transformInnerArrayPtr, &out, SHIFT_INV_2ND - bitIncrement);
+}
+
+void InvTransformRecon8x8_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_16BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransformColumns8(transformCoefficients, srcStride, transformInnerArrayPtr);
+    InvTransformRows8(transformInnerArrayPtr, &out, SHIFT_INV_2ND - bitIncrement);
+}
+
+void InvTransformRecon4x4_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_16BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransform4x4Kernel(transformCoefficients, srcStride, &out, InvDctCoeff4x4, bitIncrement);
+    (void)transformInnerArrayPtr;
+}
+
+void InvDstTransformRecon4x4_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformOutput_t out = { INV_OUT_RECON_16BIT, reconPtr, reconStride, predPtr, predStride };
+    InvTransform4x4Kernel(transformCoefficients, srcStride, &out, InvDstCoeff4x4, bitIncrement);
+    (void)transformInnerArrayPtr;
+}
@@ -17,4 +17,47 @@ void ChromaInterpolationFilterOneDOutRaw16bitHorizontal_AVX2_INTRIN(EB_U16 *refP
 void ChromaInterpolationFilterTwoD16bit_AVX2_INTRIN(EB_U16 *refPic, EB_U32 srcStride, EB_U16 *dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy);
 void ChromaInterpolationFilterTwoDOutRaw16bit_AVX2_INTRIN(EB_U16 *refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy);
 
+
+// 8-bit interpolation
+void LumaInterpolationFilterPosa_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosb_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosc_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosd_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPose_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosf_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosg_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosh_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosi_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosj_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosk_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosn_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosp_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosq_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosr_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+
+void LumaInterpolationFilterPosaOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosbOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPoscOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosdOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPoseOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosfOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosgOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPoshOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosiOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosjOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPoskOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosnOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPospOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosqOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+void LumaInterpolationFilterPosrOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst);
+
+void ChromaInterpolationFilterOneDHorizontal_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy);
+void ChromaInterpolationFilterOneDVertical_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy);
+void ChromaInterpolationFilterTwoD_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy);
+void ChromaInterpolationFilterOneDOutRawHorizontal_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy);
+void ChromaInterpolationFilterOneDOutRawVertical_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy);
+void ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy);
+
+void BiPredClipping_AVX2_INTRIN(EB_U32 puWidth, EB_U32 puHeight, EB_S16 *list0Src, EB_S16 *list1Src, EB_BYTE dst, EB_U32 dstStride, EB_S32 offset);
+
 #endif // EBMCP_AVX2_H
@@ -0,0 +1,1173 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "immintrin.h"
+#include "EbMcp_AVX2.h"
+#include "EbMcp_SSSE3.h"
+#include "EbDefinitions.h"
+
+/*******************************************
+* 8-bit luma/chroma interpolation
+*
+* Every ymm holds two rows of an 8-wide column strip. Blocks narrower than
+* 16 (or not a multiple of 8) go to the SSSE3 kernels, whose 2- and 4-wide
+* strips already pack several rows per register; the rest is filtered
+* strip by strip here. Raw (bi-pred) outputs keep the SSSE3 strip layout,
+* so both kernel sets can be mixed. No reference sample outside the
+* rows/columns read by the SSSE3 kernels is loaded.
+*******************************************/
+
+static const EB_S16 lumaFilterCoeffAvx2[4][8] =
+{
+    { 0, 0,  0, 64,  0,  0, 0,  0 },
+    { -1, 4,-10, 58, 17, -5, 1,  0 },
+    { -1, 4,-11, 40, 40,-11, 4, -1 },
+    { 0, 1, -5, 17, 58,-10, 4, -1 }
+};
+
+// Quarter-sample 2D positions use a 7-tap vertical filter; position 3 starts one row lower
+static const EB_S16 lumaFilterCoeff7Avx2[4][8] =
+{
+    { 0, 0,  0, 64,  0,  0, 0,  0 },
+    { -1, 4,-10, 58, 17, -5, 1,  0 },
+    { -1, 4,-11, 40, 40,-11, 4, -1 },
+    { 1, -5, 17, 58,-10, 4, -1, 0 }
+};
+
+static const EB_S16 chromaFilterCoeffAvx2[8][4] =
+{
+    { 0, 64,  0,  0 },
+    { -2, 58, 10, -2 },
+    { -4, 54, 16, -2 },
+    { -6, 46, 28, -4 },
+    { -4, 36, 36, -4 },
+    { -4, 28, 46, -6 },
+    { -2, 16, 54, -4 },
+    { -2, 10, 58, -2 },
+};
+
+// Horizontal tap-pair gathers, one row per lane
+EB_ALIGN(32) static const EB_S8 McpShuffleH8[4][32] =
+{
+    { 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8 },
+    { 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10 },
+    { 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12 },
+    { 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14 }
+};
+
+typedef struct McpOutput_s
+{
+    EB_BYTE  dst;           // uni-pred output, EB_NULL for raw output
+    EB_U32   dstStride;
+    EB_S16  *dstRaw;        // raw output, written strip by strip
+    EB_S16   rawOffset;     // subtracted from 1D raw results
+} McpOutput_t;
+
+static inline EB_BOOL McpUseSsse3(EB_U32 puWidth)
+{
+    return (puWidth < 16 || (puWidth & 7)) ? EB_TRUE : EB_FALSE;
+}
+
+static inline __m256i McpPair(__m128i lo, __m128i hi)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+// Two adjacent taps as signed byte pairs for _mm256_maddubs_epi16
+static inline __m256i McpCoeffPair8(const EB_S16 *coeff)
+{
+    return _mm256_set1_epi16((EB_S16)(((EB_U16)(EB_U8)coeff[1] << 8) | (EB_U8)coeff[0]));
+}
+
+// Two adjacent taps as 16-bit pairs for _mm256_madd_epi16
+static inline __m256i McpCoeffPair16(const EB_S16 *coeff)
+{
+    return _mm256_set1_epi32((EB_S32)(((EB_U32)(EB_U16)coeff[1] << 16) | (EB_U16)coeff[0]));
+}
+
+// Clips two rows (one per lane) to 8 bits; rowCount is 1 or 2
+static FORCE_INLINE void McpStoreRows(EB_BYTE dst, EB_U32 dstStride, __m256i sum, EB_U32 rowCount)
+{
+    const __m256i packed = _mm256_packus_epi16(sum, sum);
+
+    _mm_storel_epi64((__m128i *)dst, _mm256_castsi256_si128(packed));
+    if (rowCount > 1)
+        _mm_storel_epi64((__m128i *)(dst + dstStride), _mm256_extracti128_si256(packed, 1));
+}
+
+static FORCE_INLINE EB_S16 *McpStoreRaw(EB_S16 *dst, __m256i sum, EB_U32 rowCount)
+{
+    if (rowCount > 1) {
+        _mm256_storeu_si256((__m256i *)dst, sum);
+        return dst + 16;
+    }
+
+    _mm_storeu_si128((__m128i *)dst, _mm256_castsi256_si128(sum));
+    return dst + 8;
+}
+
+// Rounds to 8 bits for uni-pred, subtracts rawOffset for raw output
+static FORCE_INLINE void McpStore1D(McpOutput_t *out, EB_BOOL rawOutput, EB_U32 col, EB_U32 row, __m256i sum, EB_U32 rowCount)
+{
+    if (rawOutput) {
+        out->dstRaw = McpStoreRaw(out->dstRaw, _mm256_sub_epi16(sum, _mm256_set1_epi16(out->rawOffset)), rowCount);
+    }
+    else {
+        sum = _mm256_srai_epi16(_mm256_add_epi16(sum, _mm256_set1_epi16(32)), 6);
+        McpStoreRows(out->dst + row * out->dstStride + col, out->dstStride, sum, rowCount);
+    }
+}
+
+/*******************************************
+* Horizontal filtering
+*******************************************/
+static FORCE_INLINE __m256i McpFilterH8(EB_BYTE ptr, EB_U32 srcStride, EB_U32 rowCount, const __m256i *c, EB_U32 pairCount)
+{
+    const __m128i r0 = _mm_loadu_si128((__m128i *)ptr);
+    const __m256i a = McpPair(r0, rowCount > 1 ? _mm_loadu_si128((__m128i *)(ptr + srcStride)) : r0);
+    __m256i sum;
+
+    sum = _mm256_maddubs_epi16(_mm256_shuffle_epi8(a, _mm256_load_si256((const __m256i *)McpShuffleH8[0])), c[0]);
+    sum = _mm256_add_epi16(sum, _mm256_maddubs_epi16(_mm256_shuffle_epi8(a, _mm256_load_si256((const __m256i *)McpShuffleH8[1])), c[1]));
+
+    if (pairCount == 4) {
+        sum = _mm256_add_epi16(sum, _mm256_maddubs_epi16(_mm256_shuffle_epi8(a, _mm256_load_si256((const __m256i *)McpShuffleH8[2])), c[2]));
+        sum = _mm256_add_epi16(sum, _mm256_maddubs_epi16(_mm256_shuffle_epi8(a, _mm256_load_si256((const __m256i *)McpShuffleH8[3])), c[3]));
+    }
+
+    return sum;
+}
+
+// refPic points at the first tap of column 0
+static FORCE_INLINE void McpFilterHorizontalTaps(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    McpOutput_t          *out,
+    EB_BOOL               rawOutput,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    const EB_S16         *coeff,
+    EB_U32                tapCount)
+{
+    const EB_U32 pairCount = tapCount >> 1;
+    McpOutput_t o = *out;
+    __m256i c[4];
+    EB_U32 col, row;
+
+    c[0] = McpCoeffPair8(coeff);
+    c[1] = McpCoeffPair8(coeff + 2);
+    c[2] = (pairCount == 4) ? McpCoeffPair8(coeff + 4) : _mm256_setzero_si256();
+    c[3] = (pairCount == 4) ? McpCoeffPair8(coeff + 6) : _mm256_setzero_si256();
+
+    for (col = 0; col < puWidth; col += 8) {
+        EB_BYTE ptr = refPic + col;
+
+        for (row = 0; row + 2 <= puHeight; row += 2, ptr += 2 * srcStride)
+            McpStore1D(&o, rawOutput, col, row, McpFilterH8(ptr, srcStride, 2, c, pairCount), 2);
+
+        // Odd row counts come from the 2D first pass
+        if (row < puHeight)
+            McpStore1D(&o, rawOutput, col, row, McpFilterH8(ptr, srcStride, 1, c, pairCount), 1);
+    }
+}
+
+// One instance per output kind and tap count, so that both are resolved at compile time
+static void McpFilterHorizontalUni8(EB_BYTE refPic, EB_U32 srcStride, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff)
+{
+    McpFilterHorizontalTaps(refPic, srcStride, out, EB_FALSE, puWidth, puHeight, coeff, 8);
+}
+
+static void McpFilterHorizontalUni4(EB_BYTE refPic, EB_U32 srcStride, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff)
+{
+    McpFilterHorizontalTaps(refPic, srcStride, out, EB_FALSE, puWidth, puHeight, coeff, 4);
+}
+
+static void McpFilterHorizontalRaw8(EB_BYTE refPic, EB_U32 srcStride, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff)
+{
+    McpFilterHorizontalTaps(refPic, srcStride, out, EB_TRUE, puWidth, puHeight, coeff, 8);
+}
+
+static void McpFilterHorizontalRaw4(EB_BYTE refPic, EB_U32 srcStride, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff)
+{
+    McpFilterHorizontalTaps(refPic, srcStride, out, EB_TRUE, puWidth, puHeight, coeff, 4);
+}
+
+static void McpFilterHorizontal(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    McpOutput_t          *out,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    const EB_S16         *coeff,
+    EB_U32                tapCount)
+{
+    if (out->dst == EB_NULL)
+        (tapCount == 8 ? McpFilterHorizontalRaw8 : McpFilterHorizontalRaw4)(refPic, srcStride, out, puWidth, puHeight, coeff);
+    else
+        (tapCount == 8 ? McpFilterHorizontalUni8 : McpFilterHorizontalUni4)(refPic, srcStride, out, puWidth, puHeight, coeff);
+}
+
+/*******************************************
+* Vertical filtering
+*******************************************/
+
+// Interleaved row pairs (r, r + 1) in lane 0 and (r + 1, r + 2) in lane 1
+static FORCE_INLINE __m256i McpRowPairs(__m128i r0, __m128i r1, __m128i r2)
+{
+    return McpPair(_mm_unpacklo_epi8(r0, r1), _mm_unpacklo_epi8(r1, r2));
+}
+
+// refPic points at the first tap row; two rows per iteration, the interleaved
+// row pairs slide down by one tap pair
+static FORCE_INLINE void McpFilterVerticalTaps(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    McpOutput_t          *out,
+    EB_BOOL               rawOutput,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    const EB_S16         *coeff,
+    EB_U32                tapCount)
+{
+    const EB_U32 pairCount = tapCount >> 1;
+    McpOutput_t o = *out;
+    __m256i c[4];
+    __m256i p0, p1, p2, pLast, sum;
+    __m128i prev, a;
+    EB_U32 col, row;
+
+    c[0] = McpCoeffPair8(coeff);
+    c[1] = McpCoeffPair8(coeff + 2);
+    c[2] = (pairCount == 4) ? McpCoeffPair8(coeff + 4) : _mm256_setzero_si256();
+    c[3] = (pairCount == 4) ? McpCoeffPair8(coeff + 6) : _mm256_setzero_si256();
+
+    for (col = 0; col < puWidth; col += 8) {
+        EB_BYTE ptr = refPic + col;
+
+        prev = _mm_loadl_epi64((__m128i *)(ptr + 2 * srcStride));
+        p0 = McpRowPairs(_mm_loadl_epi64((__m128i *)ptr), _mm_loadl_epi64((__m128i *)(ptr + srcStride)), prev);
+        p1 = p2 = p0;
+        if (pairCount == 4) {
+            a = _mm_loadl_epi64((__m128i *)(ptr + 4 * srcStride));
+            p1 = McpRowPairs(prev, _mm_loadl_epi64((__m128i *)(ptr + 3 * srcStride)), a);
+            prev = _mm_loadl_epi64((__m128i *)(ptr + 6 * srcStride));
+            p2 = McpRowPairs(a, _mm_loadl_epi64((__m128i *)(ptr + 5 * srcStride)), prev);
+        }
+        ptr += (tapCount - 1) * srcStride;
+
+        for (row = 0; row < puHeight; row += 2, ptr += 2 * srcStride) {
+            // The last row of an odd height needs no second window row
+            a = _mm_loadl_epi64((__m128i *)ptr);
+            if (row + 1 < puHeight)
+                a = _mm_loadl_epi64((__m128i *)(ptr + srcStride));
+            pLast = McpRowPairs(prev, _mm_loadl_epi64((__m128i *)ptr), a);
+            prev = a;
+
+            if (pairCount == 4) {
+                sum = _mm256_add_epi16(_mm256_maddubs_epi16(p0, c[0]), _mm256_maddubs_epi16(p1, c[1]));
+                sum = _mm256_add_epi16(sum, _mm256_add_epi16(_mm256_maddubs_epi16(p2, c[2]), _mm256_maddubs_epi16(pLast, c[3])));
+                p0 = p1;
+                p1 = p2;
+                p2 = pLast;
+            }
+            else {
+                sum = _mm256_add_epi16(_mm256_maddubs_epi16(p0, c[0]), _mm256_maddubs_epi16(pLast, c[1]));
+                p0 = pLast;
+            }
+
+            McpStore1D(&o, rawOutput, col, row, sum, (row + 1 < puHeight) ? 2 : 1);
+        }
+    }
+}
+
+static void McpFilterVerticalUni8(EB_BYTE refPic, EB_U32 srcStride, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff)
+{
+    McpFilterVerticalTaps(refPic, srcStride, out, EB_FALSE, puWidth, puHeight, coeff, 8);
+}
+
+static void McpFilterVerticalUni4(EB_BYTE refPic, EB_U32 srcStride, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff)
+{
+    McpFilterVerticalTaps(refPic, srcStride, out, EB_FALSE, puWidth, puHeight, coeff, 4);
+}
+
+static void McpFilterVerticalRaw8(EB_BYTE refPic, EB_U32 srcStride, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff)
+{
+    McpFilterVerticalTaps(refPic, srcStride, out, EB_TRUE, puWidth, puHeight, coeff, 8);
+}
+
+static void McpFilterVerticalRaw4(EB_BYTE refPic, EB_U32 srcStride, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff)
+{
+    McpFilterVerticalTaps(refPic, srcStride, out, EB_TRUE, puWidth, puHeight, coeff, 4);
+}
+
+static void McpFilterVertical(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    McpOutput_t          *out,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    const EB_S16         *coeff,
+    EB_U32                tapCount)
+{
+    if (out->dst == EB_NULL)
+        (tapCount == 8 ? McpFilterVerticalRaw8 : McpFilterVerticalRaw4)(refPic, srcStride, out, puWidth, puHeight, coeff);
+    else
+        (tapCount == 8 ? McpFilterVerticalUni8 : McpFilterVerticalUni4)(refPic, srcStride, out, puWidth, puHeight, coeff);
+}
+
+/*******************************************
+* 2D filtering
+*******************************************/
+
+// First-pass row k of the current two output rows; a single last row only reads its own 8 results
+static FORCE_INLINE __m256i McpLoadFirstPass(const EB_S16 *ptr, EB_U32 k, EB_U32 rowCount)
+{
+    return (rowCount > 1) ? _mm256_loadu_si256((__m256i *)(ptr + 8 * k)) : _mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(ptr + 8 * k)));
+}
+
+// Vertical taps in 32 bits. Odd tap counts pair the last tap with a zero coefficient.
+static FORCE_INLINE void McpFilterTwoDSums(const EB_S16 *ptr, EB_U32 rowCount, const __m256i *c, EB_U32 tapCount, __m256i *sumLo, __m256i *sumHi)
+{
+    __m256i y0, y1, lo, hi;
+
+    y0 = McpLoadFirstPass(ptr, 0, rowCount);
+    y1 = McpLoadFirstPass(ptr, 1, rowCount);
+    lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(y0, y1), c[0]);
+    hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(y0, y1), c[0]);
+
+    y0 = McpLoadFirstPass(ptr, 2, rowCount);
+    y1 = McpLoadFirstPass(ptr, 3, rowCount);
+    lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(y0, y1), c[1]));
+    hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(y0, y1), c[1]));
+
+    if (tapCount > 4) {
+        y0 = McpLoadFirstPass(ptr, 4, rowCount);
+        y1 = McpLoadFirstPass(ptr, 5, rowCount);
+        lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(y0, y1), c[2]));
+        hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(y0, y1), c[2]));
+
+        y0 = McpLoadFirstPass(ptr, 6, rowCount);
+        y1 = (tapCount == 8) ? McpLoadFirstPass(ptr, 7, rowCount) : y0;
+        lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(y0, y1), c[3]));
+        hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(y0, y1), c[3]));
+    }
+
+    *sumLo = lo;
+    *sumHi = hi;
+}
+
+static FORCE_INLINE void McpStore2D(McpOutput_t *out, EB_BOOL rawOutput, EB_U32 col, EB_U32 row, __m256i sumLo, __m256i sumHi, __m256i offset, EB_U32 rowCount)
+{
+    if (rawOutput) {
+        out->dstRaw = McpStoreRaw(out->dstRaw, _mm256_packs_epi32(_mm256_srai_epi32(sumLo, 6), _mm256_srai_epi32(sumHi, 6)), rowCount);
+    }
+    else {
+        sumLo = _mm256_srai_epi32(_mm256_add_epi32(sumLo, offset), 12);
+        sumHi = _mm256_srai_epi32(_mm256_add_epi32(sumHi, offset), 12);
+        McpStoreRows(out->dst + row * out->dstStride + col, out->dstStride, _mm256_packs_epi32(sumLo, sumHi), rowCount);
+    }
+}
+
+// Vertical pass over the raw horizontal output; each strip holds puHeight + tapCount - 1 rows
+static FORCE_INLINE void McpFilterTwoDInRawTaps(
+    const EB_S16         *firstPassIFDst,
+    McpOutput_t          *out,
+    EB_BOOL               rawOutput,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    const EB_S16         *coeff,
+    EB_U32                tapCount,
+    EB_S32                roundOffset)
+{
+    const __m256i offset = _mm256_set1_epi32(roundOffset);
+    McpOutput_t o = *out;
+    __m256i c[4], sumLo, sumHi;
+    EB_U32 col, row;
+
+    c[0] = McpCoeffPair16(coeff);
+    c[1] = McpCoeffPair16(coeff + 2);
+    c[2] = (tapCount > 4) ? McpCoeffPair16(coeff + 4) : _mm256_setzero_si256();
+    c[3] = (tapCount > 4) ? McpCoeffPair16(coeff + 6) : _mm256_setzero_si256();
+
+    for (col = 0; col < puWidth; col += 8) {
+        for (row = 0; row + 2 <= puHeight; row += 2) {
+            McpFilterTwoDSums(firstPassIFDst + row * 8, 2, c, tapCount, &sumLo, &sumHi);
+            McpStore2D(&o, rawOutput, col, row, sumLo, sumHi, offset, 2);
+        }
+
+        if (row < puHeight) {
+            McpFilterTwoDSums(firstPassIFDst + row * 8, 1, c, tapCount, &sumLo, &sumHi);
+            McpStore2D(&o, rawOutput, col, row, sumLo, sumHi, offset, 1);
+        }
+
+        firstPassIFDst += 8 * (puHeight + tapCount - 1);
+    }
+}
+
+static void McpFilterTwoDInRawUni8(const EB_S16 *firstPassIFDst, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff, EB_S32 roundOffset)
+{
+    McpFilterTwoDInRawTaps(firstPassIFDst, out, EB_FALSE, puWidth, puHeight, coeff, 8, roundOffset);
+}
+
+static void McpFilterTwoDInRawUni7(const EB_S16 *firstPassIFDst, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff, EB_S32 roundOffset)
+{
+    McpFilterTwoDInRawTaps(firstPassIFDst, out, EB_FALSE, puWidth, puHeight, coeff, 7, roundOffset);
+}
+
+static void McpFilterTwoDInRawUni4(const EB_S16 *firstPassIFDst, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff, EB_S32 roundOffset)
+{
+    McpFilterTwoDInRawTaps(firstPassIFDst, out, EB_FALSE, puWidth, puHeight, coeff, 4, roundOffset);
+}
+
+static void McpFilterTwoDInRawRaw8(const EB_S16 *firstPassIFDst, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff, EB_S32 roundOffset)
+{
+    McpFilterTwoDInRawTaps(firstPassIFDst, out, EB_TRUE, puWidth, puHeight, coeff, 8, roundOffset);
+}
+
+static void McpFilterTwoDInRawRaw7(const EB_S16 *firstPassIFDst, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff, EB_S32 roundOffset)
+{
+    McpFilterTwoDInRawTaps(firstPassIFDst, out, EB_TRUE, puWidth, puHeight, coeff, 7, roundOffset);
+}
+
+static void McpFilterTwoDInRawRaw4(const EB_S16 *firstPassIFDst, McpOutput_t *out, EB_U32 puWidth, EB_U32 puHeight, const EB_S16 *coeff, EB_S32 roundOffset)
+{
+    McpFilterTwoDInRawTaps(firstPassIFDst, out, EB_TRUE, puWidth, puHeight, coeff, 4, roundOffset);
+}
+
+static void McpFilterTwoDInRaw(
+    const EB_S16         *firstPassIFDst,
+    McpOutput_t          *out,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    const EB_S16         *coeff,
+    EB_U32                tapCount,
+    EB_S32                roundOffset)
+{
+    if (out->dst == EB_NULL)
+        (tapCount == 8 ? McpFilterTwoDInRawRaw8 : tapCount == 7 ? McpFilterTwoDInRawRaw7 : McpFilterTwoDInRawRaw4)(firstPassIFDst, out, puWidth, puHeight, coeff, roundOffset);
+    else
+        (tapCount == 8 ? McpFilterTwoDInRawUni8 : tapCount == 7 ? McpFilterTwoDInRawUni7 : McpFilterTwoDInRawUni4)(firstPassIFDst, out, puWidth, puHeight, coeff, roundOffset);
+}
+
+// refPic points at the first tap row and column
+static void McpFilterTwoD(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    McpOutput_t          *out,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst,
+    const EB_S16         *coeffX,
+    EB_U32                tapCountX,
+    const EB_S16         *coeffY,
+    EB_U32                tapCountY,
+    EB_S16                firstPassOffset,
+    EB_S32                roundOffset)
+{
+    McpOutput_t firstPass;
+
+    firstPass.dst = EB_NULL;
+    firstPass.dstStride = 0;
+    firstPass.dstRaw = firstPassIFDst;
+    firstPass.rawOffset = firstPassOffset;
+
+    McpFilterHorizontal(refPic, srcStride, &firstPass, puWidth, puHeight + tapCountY - 1, coeffX, tapCountX);
+    McpFilterTwoDInRaw(firstPassIFDst, out, puWidth, puHeight, coeffY, tapCountY, roundOffset);
+}
+
+static void LumaInterpolationFilter_AVX2(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    McpOutput_t          *out,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst,
+    EB_U32                fracPosx,
+    EB_U32                fracPosy)
+{
+    if (fracPosy == 0) {
+        McpFilterHorizontal(refPic - 3, srcStride, out, puWidth, puHeight, lumaFilterCoeffAvx2[fracPosx], 8);
+    }
+    else if (fracPosx == 0) {
+        McpFilterVertical(refPic - 3 * srcStride, srcStride, out, puWidth, puHeight, lumaFilterCoeffAvx2[fracPosy], 8);
+    }
+    else {
+        // The first pass keeps the -8192 offset; (1 << 19) removes it again in the second pass
+        McpFilterTwoD(
+            refPic - ((fracPosy == 3) ? 2 : 3) * srcStride - 3,
+            srcStride,
+            out,
+            puWidth,
+            puHeight,
+            firstPassIFDst,
+            lumaFilterCoeffAvx2[fracPosx],
+            8,
+            lumaFilterCoeff7Avx2[fracPosy],
+            (fracPosy == 2) ? 8 : 7,
+            128 * 64,
+            (1 << 19) + (1 << 11));
+    }
+}
+
+static void LumaInterpolationUniPred_AVX2(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy)
+{
+    McpOutput_t out;
+
+    out.dst = dst;
+    out.dstStride = dstStride;
+    out.dstRaw = EB_NULL;
+    out.rawOffset = 0;
+    LumaInterpolationFilter_AVX2(refPic, srcStride, &out, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+}
+
+static void LumaInterpolationBiPred_AVX2(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy)
+{
+    McpOutput_t out;
+
+    out.dst = EB_NULL;
+    out.dstStride = 0;
+    out.dstRaw = dst;
+    out.rawOffset = 128 * 64;
+    LumaInterpolationFilter_AVX2(refPic, srcStride, &out, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+}
+
+static void ChromaInterpolationFilter_AVX2(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    McpOutput_t          *out,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst,
+    EB_U32                fracPosx,
+    EB_U32                fracPosy)
+{
+    if (fracPosy == 0) {
+        McpFilterHorizontal(refPic - 1, srcStride, out, puWidth, puHeight, chromaFilterCoeffAvx2[fracPosx], 4);
+    }
+    else if (fracPosx == 0) {
+        McpFilterVertical(refPic - srcStride, srcStride, out, puWidth, puHeight, chromaFilterCoeffAvx2[fracPosy], 4);
+    }
+    else {
+        McpFilterTwoD(
+            refPic - srcStride - 1,
+            srcStride,
+            out,
+            puWidth,
+            puHeight,
+            firstPassIFDst,
+            chromaFilterCoeffAvx2[fracPosx],
+            4,
+            chromaFilterCoeffAvx2[fracPosy],
+            4,
+            0,
+            1 << 11);
+    }
+}
+
+static void ChromaInterpolationUniPred_AVX2(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy)
+{
+    McpOutput_t out;
+
+    out.dst = dst;
+    out.dstStride = dstStride;
+    out.dstRaw = EB_NULL;
+    out.rawOffset = 0;
+    ChromaInterpolationFilter_AVX2(refPic, srcStride, &out, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+}
+
+static void ChromaInterpolationBiPred_AVX2(EB_BYTE refPic, EB_U32 srcStride, EB_S16 *dst, EB_U32 puWidth, EB_U32 puHeight, EB_S16 *firstPassIFDst, EB_U32 fracPosx, EB_U32 fracPosy)
+{
+    McpOutput_t out;
+
+    out.dst = EB_NULL;
+    out.dstStride = 0;
+    out.dstRaw = dst;
+    out.rawOffset = 0;
+    ChromaInterpolationFilter_AVX2(refPic, srcStride, &out, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+}
+
+/*******************************************
+* Chroma kernels
+*******************************************/
+void ChromaInterpolationFilterOneDHorizontal_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst,
+    EB_U32                fracPosx,
+    EB_U32                fracPosy)
+{
+    if (McpUseSsse3(puWidth))
+        ChromaInterpolationFilterOneDHorizontal_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+    else
+        ChromaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, fracPosx, 0);
+}
+
+void ChromaInterpolationFilterOneDVertical_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst,
+    EB_U32                fracPosx,
+    EB_U32                fracPosy)
+{
+    if (McpUseSsse3(puWidth))
+        ChromaInterpolationFilterOneDVertical_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+    else
+        ChromaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 0, fracPosy);
+}
+
+void ChromaInterpolationFilterTwoD_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst,
+    EB_U32                fracPosx,
+    EB_U32                fracPosy)
+{
+    if (McpUseSsse3(puWidth))
+        ChromaInterpolationFilterTwoD_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+    else
+        ChromaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+}
+
+void ChromaInterpolationFilterOneDOutRawHorizontal_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst,
+    EB_U32                fracPosx,
+    EB_U32                fracPosy)
+{
+    if (McpUseSsse3(puWidth))
+        ChromaInterpolationFilterOneDOutRawHorizontal_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+    else
+        ChromaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, fracPosx, 0);
+}
+
+void ChromaInterpolationFilterOneDOutRawVertical_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst,
+    EB_U32                fracPosx,
+    EB_U32                fracPosy)
+{
+    if (McpUseSsse3(puWidth))
+        ChromaInterpolationFilterOneDOutRawVertical_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+    else
+        ChromaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 0, fracPosy);
+}
+
+void ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst,
+    EB_U32                fracPosx,
+    EB_U32                fracPosy)
+{
+    if (McpUseSsse3(puWidth))
+        ChromaInterpolationFilterTwoDOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+    else
+        ChromaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, fracPosx, fracPosy);
+}
+
+/*******************************************
+* Bi-pred clipping
+*******************************************/
+void BiPredClipping_AVX2_INTRIN(
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *list0Src,
+    EB_S16               *list1Src,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_S32                offset)
+{
+    const __m256i offset256 = _mm256_set1_epi16((EB_S16)offset);
+    EB_U32 col, row;
+    __m256i a0;
+
+    if (McpUseSsse3(puWidth)) {
+        BiPredClipping_SSSE3(puWidth, puHeight, list0Src, list1Src, dst, dstStride, offset);
+        return;
+    }
+
+    // Same saturating sums as the SSSE3 kernel
+    for (col = 0; col < puWidth; col += 8) {
+        EB_BYTE q = dst + col;
+
+        for (row = 0; row + 2 <= puHeight; row += 2, q += 2 * dstStride) {
+            a0 = _mm256_adds_epi16(_mm256_loadu_si256((__m256i *)list0Src), _mm256_loadu_si256((__m256i *)list1Src));
+            McpStoreRows(q, dstStride, _mm256_srai_epi16(_mm256_adds_epi16(a0, offset256), 7), 2);
+            list0Src += 16;
+            list1Src += 16;
+        }
+
+        if (row < puHeight) {
+            a0 = _mm256_castsi128_si256(_mm_adds_epi16(_mm_loadu_si128((__m128i *)list0Src), _mm_loadu_si128((__m128i *)list1Src)));
+            McpStoreRows(q, dstStride, _mm256_srai_epi16(_mm256_adds_epi16(a0, offset256), 7), 1);
+            list0Src += 8;
+            list1Src += 8;
+        }
+    }
+}
+
+/*******************************************
+* Luma uni-pred kernels
+*******************************************/
+void LumaInterpolationFilterPosa_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosa_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 1, 0);
+}
+
+void LumaInterpolationFilterPosb_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosb_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 2, 0);
+}
+
+void LumaInterpolationFilterPosc_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosc_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 3, 0);
+}
+
+void LumaInterpolationFilterPosd_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosd_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 0, 1);
+}
+
+void LumaInterpolationFilterPose_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPose_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 1, 1);
+}
+
+void LumaInterpolationFilterPosf_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosf_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 2, 1);
+}
+
+void LumaInterpolationFilterPosg_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosg_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 3, 1);
+}
+
+void LumaInterpolationFilterPosh_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosh_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 0, 2);
+}
+
+void LumaInterpolationFilterPosi_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosi_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 1, 2);
+}
+
+void LumaInterpolationFilterPosj_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosj_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 2, 2);
+}
+
+void LumaInterpolationFilterPosk_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosk_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 3, 2);
+}
+
+void LumaInterpolationFilterPosn_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosn_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 0, 3);
+}
+
+void LumaInterpolationFilterPosp_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosp_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 1, 3);
+}
+
+void LumaInterpolationFilterPosq_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosq_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 2, 3);
+}
+
+void LumaInterpolationFilterPosr_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_BYTE               dst,
+    EB_U32                dstStride,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosr_SSSE3(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationUniPred_AVX2(refPic, srcStride, dst, dstStride, puWidth, puHeight, firstPassIFDst, 3, 3);
+}
+
+/*******************************************
+* Luma bi-pred (raw output) kernels
+*******************************************/
+void LumaInterpolationFilterPosaOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosaOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 1, 0);
+}
+
+void LumaInterpolationFilterPosbOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosbOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 2, 0);
+}
+
+void LumaInterpolationFilterPoscOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPoscOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 3, 0);
+}
+
+void LumaInterpolationFilterPosdOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosdOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 0, 1);
+}
+
+void LumaInterpolationFilterPoseOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPoseOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 1, 1);
+}
+
+void LumaInterpolationFilterPosfOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosfOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 2, 1);
+}
+
+void LumaInterpolationFilterPosgOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosgOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 3, 1);
+}
+
+void LumaInterpolationFilterPoshOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPoshOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 0, 2);
+}
+
+void LumaInterpolationFilterPosiOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosiOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 1, 2);
+}
+
+void LumaInterpolationFilterPosjOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosjOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 2, 2);
+}
+
+void LumaInterpolationFilterPoskOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPoskOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 3, 2);
+}
+
+void LumaInterpolationFilterPosnOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosnOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 0, 3);
+}
+
+void LumaInterpolationFilterPospOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPospOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 1, 3);
+}
+
+void LumaInterpolationFilterPosqOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosqOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 2, 3);
+}
+
+void LumaInterpolationFilterPosrOutRaw_AVX2_INTRIN(
+    EB_BYTE               refPic,
+    EB_U32                srcStride,
+    EB_S16               *dst,
+    EB_U32                puWidth,
+    EB_U32                puHeight,
+    EB_S16               *firstPassIFDst)
+{
+    if (McpUseSsse3(puWidth))
+        LumaInterpolationFilterPosrOutRaw_SSSE3(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst);
+    else
+        LumaInterpolationBiPred_AVX2(refPic, srcStride, dst, puWidth, puHeight, firstPassIFDst, 3, 3);
+}
@@ -35,6 +35,7 @@ void EB_ENC_msbUnPack2D_AVX512_INTRIN(
     for (x = 0; x < height; x++) {
             // Find offset to the aligned store address
             EB_U32 offset = CHUNK_SIZE - ((size_t)out8BitBuffer & (CHUNK_SIZE - 1));
+            offset = offset > width ? width : offset;   // rows narrower than the alignment offset
             EB_U32 complOffset = (width - offset) & (CHUNK_SIZE - 1);
             EB_U32 numChunks = (width - (offset + complOffset)) / CHUNK_SIZE;
 
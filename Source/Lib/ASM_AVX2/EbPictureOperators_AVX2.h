@@ -76,6 +76,90 @@ void UnpackAvgSafeSub_AVX2_INTRIN(
         EB_U32  width,
         EB_U32  height);
 
+void PictureDecimateAverage2x2Kernel_AVX2_INTRIN(
+    EB_U8                   *src,
+    EB_U32                   srcStride,
+    EB_U8                   *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight);
+
+void PictureDecimateAverage4x4Kernel_AVX2_INTRIN(
+    EB_U8                   *src,
+    EB_U32                   srcStride,
+    EB_U8                   *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight);
+
+void PictureDecimateAverage2x2Kernel16bit_AVX2_INTRIN(
+    EB_U16                  *src,
+    EB_U32                   srcStride,
+    EB_U16                  *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight);
+
+void PictureDecimateAverage4x4Kernel16bit_AVX2_INTRIN(
+    EB_U16                  *src,
+    EB_U32                   srcStride,
+    EB_U16                  *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight);
+
+EB_U64 SpatialFullDistortionKernel_AVX2_INTRIN(
+    EB_U8                   *input,
+    EB_U32                   inputStride,
+    EB_U8                   *recon,
+    EB_U32                   reconStride,
+    EB_U32                   areaWidth,
+    EB_U32                   areaHeight);
+
+EB_U64 SpatialFullDistortionKernel16bit_AVX2_INTRIN(
+    EB_U16                  *input,
+    EB_U32                   inputStride,
+    EB_U16                  *recon,
+    EB_U32                   reconStride,
+    EB_U32                   areaWidth,
+    EB_U32                   areaHeight);
+
+void SsimBlockSums4x4Kernel_AVX2_INTRIN(
+    EB_U8                   *input,
+    EB_U32                   inputStride,
+    EB_U8                   *recon,
+    EB_U32                   reconStride,
+    EB_U32                   sums[][4],
+    EB_U32                   blockCount);
+
+void SsimBlockSums4x4Kernel16bit_AVX2_INTRIN(
+    EB_U16                  *input,
+    EB_U32                   inputStride,
+    EB_U16                  *recon,
+    EB_U32                   reconStride,
+    EB_U32                   sums[][4],
+    EB_U32                   blockCount);
+
+void BlockHash64x64Kernel_AVX2_INTRIN(
+    EB_U8                   *src,
+    EB_U32                   srcStride,
+    EB_U32                   width,
+    EB_U32                   height,
+    EB_U32                  *hash);
+
+EB_U64 Compute8x8Satd_AVX2_INTRIN(
+    EB_S16                  *diff);
+
+EB_U64 Compute8x8Satd_U8_AVX2_INTRIN(
+    EB_U8                   *src,
+    EB_U64                  *dcValue,
+    EB_U32                   srcStride);
+
+EB_U64 Compute16x16Satd_U8_AVX2_INTRIN(
+    EB_U8                   *src,
+    EB_U64                  *dcValue,
+    EB_U32                   srcStride);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,51 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbPictureOperators_AVX512_h
+#define EbPictureOperators_AVX512_h
+
+#include "EbDefinitions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+EB_U64 SpatialFullDistortionKernel16MxN_AVX512_INTRIN(
+    EB_U8                   *input,
+    EB_U32                   inputStride,
+    EB_U8                   *recon,
+    EB_U32                   reconStride,
+    EB_U32                   areaWidth,
+    EB_U32                   areaHeight);
+
+void ResidualKernel32x32_AVX512_INTRIN(
+    EB_U8                   *input,
+    EB_U32                   inputStride,
+    EB_U8                   *pred,
+    EB_U32                   predStride,
+    EB_S16                  *residual,
+    EB_U32                   residualStride,
+    EB_U32                   areaWidth,
+    EB_U32                   areaHeight);
+
+void ResidualKernel64x64_AVX512_INTRIN(
+    EB_U8                   *input,
+    EB_U32                   inputStride,
+    EB_U8                   *pred,
+    EB_U32                   predStride,
+    EB_S16                  *residual,
+    EB_U32                   residualStride,
+    EB_U32                   areaWidth,
+    EB_U32                   areaHeight);
+
+EB_U64 Compute16x16Satd_U8_AVX512_INTRIN(
+    EB_U8                   *src,
+    EB_U64                  *dcValue,
+    EB_U32                   srcStride);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbPictureOperators_AVX512_h
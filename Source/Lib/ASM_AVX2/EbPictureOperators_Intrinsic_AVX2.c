@@ -5,6 +5,7 @@
 
 
 #include <stdio.h>
+#include <string.h>
 #include <immintrin.h>
 #include "EbDefinitions.h"
 #include "EbPictureOperators_AVX2.h"
@@ -1658,3 +1659,552 @@ void UnpackAvgSafeSub_AVX2_INTRIN(
     return;
 }
 
+
+/*********************************
+* Picture Decimate Average Kernels
+*   16 output samples per iteration, the
+*   remaining columns are done in C
+*********************************/
+void PictureDecimateAverage2x2Kernel_AVX2_INTRIN(
+    EB_U8                   *src,
+    EB_U32                   srcStride,
+    EB_U8                   *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight)
+{
+    const __m256i ones = _mm256_set1_epi8(1);
+    const __m256i rounding = _mm256_set1_epi16(2);
+    const EB_U32 simdWidth = dstWidth & ~15;
+    EB_U32 rowIndex;
+    EB_U32 columnIndex;
+
+    for (rowIndex = 0; rowIndex < dstHeight; ++rowIndex) {
+        for (columnIndex = 0; columnIndex < simdWidth; columnIndex += 16) {
+            __m256i row0 = _mm256_loadu_si256((__m256i*)(src + 2 * columnIndex));
+            __m256i row1 = _mm256_loadu_si256((__m256i*)(src + 2 * columnIndex + srcStride));
+            __m256i sum = _mm256_add_epi16(_mm256_maddubs_epi16(row0, ones), _mm256_maddubs_epi16(row1, ones));
+            sum = _mm256_srli_epi16(_mm256_add_epi16(sum, rounding), 2);
+            sum = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, sum), 0xD8);
+            _mm_storeu_si128((__m128i*)(dst + columnIndex), _mm256_castsi256_si128(sum));
+        }
+        for (; columnIndex < dstWidth; ++columnIndex) {
+            dst[columnIndex] = (EB_U8)((
+                src[2 * columnIndex] + src[2 * columnIndex + 1] +
+                src[2 * columnIndex + srcStride] + src[2 * columnIndex + 1 + srcStride] + 2) >> 2);
+        }
+        src += srcStride << 1;
+        dst += dstStride;
+    }
+}
+
+void PictureDecimateAverage4x4Kernel_AVX2_INTRIN(
+    EB_U8                   *src,
+    EB_U32                   srcStride,
+    EB_U8                   *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight)
+{
+    const __m256i ones = _mm256_set1_epi8(1);
+    const __m256i rounding = _mm256_set1_epi16(8);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    const EB_U32 simdWidth = dstWidth & ~15;
+    EB_U32 rowIndex;
+    EB_U32 columnIndex;
+    EB_U32 blockIndex;
+
+    for (rowIndex = 0; rowIndex < dstHeight; ++rowIndex) {
+        for (columnIndex = 0; columnIndex < simdWidth; columnIndex += 16) {
+            __m256i sumLo = _mm256_setzero_si256();
+            __m256i sumHi = _mm256_setzero_si256();
+            __m256i sum;
+            for (blockIndex = 0; blockIndex < 4; ++blockIndex) {
+                EB_U8 *srcPtr = src + blockIndex * srcStride + 4 * columnIndex;
+                sumLo = _mm256_add_epi16(sumLo, _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)srcPtr), ones));
+                sumHi = _mm256_add_epi16(sumHi, _mm256_maddubs_epi16(_mm256_loadu_si256((__m256i*)(srcPtr + 32)), ones));
+            }
+            // hadd leaves the 4-sample groups as [0-3, 8-11 | 4-7, 12-15]
+            sum = _mm256_srli_epi16(_mm256_add_epi16(_mm256_hadd_epi16(sumLo, sumHi), rounding), 4);
+            sum = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(sum, sum), order);
+            _mm_storeu_si128((__m128i*)(dst + columnIndex), _mm256_castsi256_si128(sum));
+        }
+        for (; columnIndex < dstWidth; ++columnIndex) {
+            EB_U32 sum = 0;
+            for (blockIndex = 0; blockIndex < 4; ++blockIndex) {
+                EB_U8 *srcPtr = src + blockIndex * srcStride + 4 * columnIndex;
+                sum += srcPtr[0] + srcPtr[1] + srcPtr[2] + srcPtr[3];
+            }
+            dst[columnIndex] = (EB_U8)((sum + 8) >> 4);
+        }
+        src += srcStride << 2;
+        dst += dstStride;
+    }
+}
+
+void PictureDecimateAverage2x2Kernel16bit_AVX2_INTRIN(
+    EB_U16                  *src,
+    EB_U32                   srcStride,
+    EB_U16                  *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight)
+{
+    const __m256i rounding = _mm256_set1_epi16(2);
+    const EB_U32 simdWidth = dstWidth & ~15;
+    EB_U32 rowIndex;
+    EB_U32 columnIndex;
+
+    for (rowIndex = 0; rowIndex < dstHeight; ++rowIndex) {
+        for (columnIndex = 0; columnIndex < simdWidth; columnIndex += 16) {
+            EB_U16 *srcPtr = src + 2 * columnIndex;
+            __m256i sumLo = _mm256_add_epi16(
+                _mm256_loadu_si256((__m256i*)srcPtr),
+                _mm256_loadu_si256((__m256i*)(srcPtr + srcStride)));
+            __m256i sumHi = _mm256_add_epi16(
+                _mm256_loadu_si256((__m256i*)(srcPtr + 16)),
+                _mm256_loadu_si256((__m256i*)(srcPtr + 16 + srcStride)));
+            __m256i sum = _mm256_srli_epi16(_mm256_add_epi16(_mm256_hadd_epi16(sumLo, sumHi), rounding), 2);
+            _mm256_storeu_si256((__m256i*)(dst + columnIndex), _mm256_permute4x64_epi64(sum, 0xD8));
+        }
+        for (; columnIndex < dstWidth; ++columnIndex) {
+            dst[columnIndex] = (EB_U16)((
+                src[2 * columnIndex] + src[2 * columnIndex + 1] +
+                src[2 * columnIndex + srcStride] + src[2 * columnIndex + 1 + srcStride] + 2) >> 2);
+        }
+        src += srcStride << 1;
+        dst += dstStride;
+    }
+}
+
+void PictureDecimateAverage4x4Kernel16bit_AVX2_INTRIN(
+    EB_U16                  *src,
+    EB_U32                   srcStride,
+    EB_U16                  *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight)
+{
+    const __m256i rounding = _mm256_set1_epi16(8);
+    const __m256i order = _mm256_setr_epi32(0, 4, 2, 6, 1, 5, 3, 7);
+    const EB_U32 simdWidth = dstWidth & ~15;
+    EB_U32 rowIndex;
+    EB_U32 columnIndex;
+    EB_U32 blockIndex;
+
+    for (rowIndex = 0; rowIndex < dstHeight; ++rowIndex) {
+        for (columnIndex = 0; columnIndex < simdWidth; columnIndex += 16) {
+            __m256i sum0 = _mm256_setzero_si256();
+            __m256i sum1 = _mm256_setzero_si256();
+            __m256i sum2 = _mm256_setzero_si256();
+            __m256i sum3 = _mm256_setzero_si256();
+            __m256i sum;
+            for (blockIndex = 0; blockIndex < 4; ++blockIndex) {
+                EB_U16 *srcPtr = src + blockIndex * srcStride + 4 * columnIndex;
+                sum0 = _mm256_add_epi16(sum0, _mm256_loadu_si256((__m256i*)srcPtr));
+                sum1 = _mm256_add_epi16(sum1, _mm256_loadu_si256((__m256i*)(srcPtr + 16)));
+                sum2 = _mm256_add_epi16(sum2, _mm256_loadu_si256((__m256i*)(srcPtr + 32)));
+                sum3 = _mm256_add_epi16(sum3, _mm256_loadu_si256((__m256i*)(srcPtr + 48)));
+            }
+            // two hadd passes leave the 2-sample groups as [0, 8, 4, 12 | 2, 10, 6, 14]
+            sum = _mm256_hadd_epi16(_mm256_hadd_epi16(sum0, sum2), _mm256_hadd_epi16(sum1, sum3));
+            sum = _mm256_srli_epi16(_mm256_add_epi16(sum, rounding), 4);
+            _mm256_storeu_si256((__m256i*)(dst + columnIndex), _mm256_permutevar8x32_epi32(sum, order));
+        }
+        for (; columnIndex < dstWidth; ++columnIndex) {
+            EB_U32 sum = 0;
+            for (blockIndex = 0; blockIndex < 4; ++blockIndex) {
+                EB_U16 *srcPtr = src + blockIndex * srcStride + 4 * columnIndex;
+                sum += srcPtr[0] + srcPtr[1] + srcPtr[2] + srcPtr[3];
+            }
+            dst[columnIndex] = (EB_U16)((sum + 8) >> 4);
+        }
+        src += srcStride << 2;
+        dst += dstStride;
+    }
+}
+
+EB_U64 SpatialFullDistortionKernel_AVX2_INTRIN(
+    EB_U8   *input,
+    EB_U32   inputStride,
+    EB_U8   *recon,
+    EB_U32   reconStride,
+    EB_U32   areaWidth,
+    EB_U32   areaHeight)
+{
+    EB_U32 simdWidth = areaWidth & ~15u;
+    EB_U32 rowIndex, columnIndex;
+    __m256i sum64 = _mm256_setzero_si256();
+    EB_U64 spatialDistortion = 0;
+    __m128i sum128;
+
+    for (rowIndex = 0; rowIndex < areaHeight; ++rowIndex) {
+        __m256i sum32 = _mm256_setzero_si256();
+        for (columnIndex = 0; columnIndex < simdWidth; columnIndex += 16) {
+            __m256i in = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(input + columnIndex)));
+            __m256i rec = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(recon + columnIndex)));
+            __m256i diff = _mm256_sub_epi16(in, rec);
+            sum32 = _mm256_add_epi32(sum32, _mm256_madd_epi16(diff, diff));
+        }
+        sum64 = _mm256_add_epi64(sum64, _mm256_unpacklo_epi32(sum32, _mm256_setzero_si256()));
+        sum64 = _mm256_add_epi64(sum64, _mm256_unpackhi_epi32(sum32, _mm256_setzero_si256()));
+        for (; columnIndex < areaWidth; ++columnIndex) {
+            EB_S32 diff = (EB_S32)input[columnIndex] - recon[columnIndex];
+            spatialDistortion += (EB_U64)(diff * diff);
+        }
+        input += inputStride;
+        recon += reconStride;
+    }
+
+    sum128 = _mm_add_epi64(_mm256_castsi256_si128(sum64), _mm256_extracti128_si256(sum64, 1));
+    sum128 = _mm_add_epi64(sum128, _mm_srli_si128(sum128, 8));
+    return spatialDistortion + (EB_U64)_mm_cvtsi128_si64(sum128);
+}
+
+EB_U64 SpatialFullDistortionKernel16bit_AVX2_INTRIN(
+    EB_U16  *input,
+    EB_U32   inputStride,
+    EB_U16  *recon,
+    EB_U32   reconStride,
+    EB_U32   areaWidth,
+    EB_U32   areaHeight)
+{
+    EB_U32 simdWidth = areaWidth & ~15u;
+    EB_U32 rowIndex, columnIndex;
+    __m256i sum64 = _mm256_setzero_si256();
+    EB_U64 spatialDistortion = 0;
+    __m128i sum128;
+
+    for (rowIndex = 0; rowIndex < areaHeight; ++rowIndex) {
+        __m256i sum32 = _mm256_setzero_si256();
+        for (columnIndex = 0; columnIndex < simdWidth; columnIndex += 16) {
+            __m256i diff = _mm256_sub_epi16(
+                _mm256_loadu_si256((__m256i*)(input + columnIndex)),
+                _mm256_loadu_si256((__m256i*)(recon + columnIndex)));
+            sum32 = _mm256_add_epi32(sum32, _mm256_madd_epi16(diff, diff));
+        }
+        sum64 = _mm256_add_epi64(sum64, _mm256_unpacklo_epi32(sum32, _mm256_setzero_si256()));
+        sum64 = _mm256_add_epi64(sum64, _mm256_unpackhi_epi32(sum32, _mm256_setzero_si256()));
+        for (; columnIndex < areaWidth; ++columnIndex) {
+            EB_S64 diff = (EB_S64)input[columnIndex] - recon[columnIndex];
+            spatialDistortion += (EB_U64)(diff * diff);
+        }
+        input += inputStride;
+        recon += reconStride;
+    }
+
+    sum128 = _mm_add_epi64(_mm256_castsi256_si128(sum64), _mm256_extracti128_si256(sum64, 1));
+    sum128 = _mm_add_epi64(sum128, _mm_srli_si128(sum128, 8));
+    return spatialDistortion + (EB_U64)_mm_cvtsi128_si64(sum128);
+}
+
+// reduces the 16-sample row sums of four 4x4 blocks to {s1, s2, ss, s12} per block
+static void SsimBlockSums4x4Store(
+    __m256i  s1,
+    __m256i  s2,
+    __m256i  ss,
+    __m256i  s12,
+    EB_U32   sums[][4])
+{
+    __m256i x = _mm256_shuffle_epi32(_mm256_hadd_epi32(s1, s2), _MM_SHUFFLE(3, 1, 2, 0));
+    __m256i y = _mm256_shuffle_epi32(_mm256_hadd_epi32(ss, s12), _MM_SHUFFLE(3, 1, 2, 0));
+    __m256i lo = _mm256_unpacklo_epi64(x, y);
+    __m256i hi = _mm256_unpackhi_epi64(x, y);
+    _mm256_storeu_si256((__m256i*)sums[0], _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256((__m256i*)sums[2], _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+void SsimBlockSums4x4Kernel_AVX2_INTRIN(
+    EB_U8   *input,
+    EB_U32   inputStride,
+    EB_U8   *recon,
+    EB_U32   reconStride,
+    EB_U32   sums[][4],
+    EB_U32   blockCount)
+{
+    const __m256i ones = _mm256_set1_epi16(1);
+    EB_U32 simdCount = blockCount & ~3u;
+    EB_U32 blockIndex, rowIndex, columnIndex;
+
+    for (blockIndex = 0; blockIndex < simdCount; blockIndex += 4) {
+        __m256i s1 = _mm256_setzero_si256();
+        __m256i s2 = _mm256_setzero_si256();
+        __m256i ss = _mm256_setzero_si256();
+        __m256i s12 = _mm256_setzero_si256();
+        for (rowIndex = 0; rowIndex < 4; ++rowIndex) {
+            __m256i a = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(input + rowIndex * inputStride + 4 * blockIndex)));
+            __m256i b = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(recon + rowIndex * reconStride + 4 * blockIndex)));
+            s1 = _mm256_add_epi32(s1, _mm256_madd_epi16(a, ones));
+            s2 = _mm256_add_epi32(s2, _mm256_madd_epi16(b, ones));
+            ss = _mm256_add_epi32(ss, _mm256_add_epi32(_mm256_madd_epi16(a, a), _mm256_madd_epi16(b, b)));
+            s12 = _mm256_add_epi32(s12, _mm256_madd_epi16(a, b));
+        }
+        SsimBlockSums4x4Store(s1, s2, ss, s12, sums + blockIndex);
+    }
+
+    for (; blockIndex < blockCount; ++blockIndex) {
+        EB_U32 s1 = 0, s2 = 0, ss = 0, s12 = 0;
+        for (rowIndex = 0; rowIndex < 4; ++rowIndex) {
+            for (columnIndex = 0; columnIndex < 4; ++columnIndex) {
+                EB_U32 a = input[rowIndex * inputStride + 4 * blockIndex + columnIndex];
+                EB_U32 b = recon[rowIndex * reconStride + 4 * blockIndex + columnIndex];
+                s1 += a;
+                s2 += b;
+                ss += a * a + b * b;
+                s12 += a * b;
+            }
+        }
+        sums[blockIndex][0] = s1;
+        sums[blockIndex][1] = s2;
+        sums[blockIndex][2] = ss;
+        sums[blockIndex][3] = s12;
+    }
+}
+
+void SsimBlockSums4x4Kernel16bit_AVX2_INTRIN(
+    EB_U16  *input,
+    EB_U32   inputStride,
+    EB_U16  *recon,
+    EB_U32   reconStride,
+    EB_U32   sums[][4],
+    EB_U32   blockCount)
+{
+    const __m256i ones = _mm256_set1_epi16(1);
+    EB_U32 simdCount = blockCount & ~3u;
+    EB_U32 blockIndex, rowIndex, columnIndex;
+
+    for (blockIndex = 0; blockIndex < simdCount; blockIndex += 4) {
+        __m256i s1 = _mm256_setzero_si256();
+        __m256i s2 = _mm256_setzero_si256();
+        __m256i ss = _mm256_setzero_si256();
+        __m256i s12 = _mm256_setzero_si256();
+        for (rowIndex = 0; rowIndex < 4; ++rowIndex) {
+            __m256i a = _mm256_loadu_si256((__m256i*)(input + rowIndex * inputStride + 4 * blockIndex));
+            __m256i b = _mm256_loadu_si256((__m256i*)(recon + rowIndex * reconStride + 4 * blockIndex));
+            s1 = _mm256_add_epi32(s1, _mm256_madd_epi16(a, ones));
+            s2 = _mm256_add_epi32(s2, _mm256_madd_epi16(b, ones));
+            ss = _mm256_add_epi32(ss, _mm256_add_epi32(_mm256_madd_epi16(a, a), _mm256_madd_epi16(b, b)));
+            s12 = _mm256_add_epi32(s12, _mm256_madd_epi16(a, b));
+        }
+        SsimBlockSums4x4Store(s1, s2, ss, s12, sums + blockIndex);
+    }
+
+    for (; blockIndex < blockCount; ++blockIndex) {
+        EB_U32 s1 = 0, s2 = 0, ss = 0, s12 = 0;
+        for (rowIndex = 0; rowIndex < 4; ++rowIndex) {
+            for (columnIndex = 0; columnIndex < 4; ++columnIndex) {
+                EB_U32 a = input[rowIndex * inputStride + 4 * blockIndex + columnIndex];
+                EB_U32 b = recon[rowIndex * reconStride + 4 * blockIndex + columnIndex];
+                s1 += a;
+                s2 += b;
+                ss += a * a + b * b;
+                s12 += a * b;
+            }
+        }
+        sums[blockIndex][0] = s1;
+        sums[blockIndex][1] = s2;
+        sums[blockIndex][2] = ss;
+        sums[blockIndex][3] = s12;
+    }
+}
+
+/*******************************************
+* 8x8 Hadamard SATD
+*   The butterflies are done in place, which permutes and negates
+*   some of the coefficients without changing the sum of their
+*   absolute values. The last stage is folded into the sum with
+*   |a + b| + |a - b| = 2 * max(|a|, |b|), so that every stored
+*   value of an 8-bit block or of a 10-bit difference fits in 16 bits.
+*******************************************/
+static inline void HadamardButterfly_AVX2(__m256i *a, __m256i *b)
+{
+    const __m256i t = *a;
+    *a = _mm256_add_epi16(t, *b);
+    *b = _mm256_sub_epi16(t, *b);
+}
+
+// Transforms the 8 samples of each 128-bit lane, and returns the 32-bit partial sums of the absolute coefficients
+static inline __m256i HadamardRowAbsSum_AVX2(__m256i v)
+{
+    __m256i swapped;
+
+    swapped = _mm256_or_si256(_mm256_slli_epi32(v, 16), _mm256_srli_epi32(v, 16));
+    v = _mm256_blend_epi16(_mm256_add_epi16(v, swapped), _mm256_sub_epi16(swapped, v), 0xAA);
+    swapped = _mm256_shuffle_epi32(v, 0xB1);
+    v = _mm256_blend_epi16(_mm256_add_epi16(v, swapped), _mm256_sub_epi16(swapped, v), 0xCC);
+    swapped = _mm256_shuffle_epi32(v, 0x4E);
+    v = _mm256_max_epi16(_mm256_abs_epi16(v), _mm256_abs_epi16(swapped));
+
+    return _mm256_madd_epi16(v, _mm256_set1_epi16(1));
+}
+
+// Two 8x8 blocks side by side, row i of both in rows[i]; returns the sum of each block in the first element of its lane
+static inline __m256i Hadamard16x8Sums_AVX2(__m256i rows[8])
+{
+    __m256i sum;
+
+    HadamardButterfly_AVX2(&rows[0], &rows[1]);
+    HadamardButterfly_AVX2(&rows[2], &rows[3]);
+    HadamardButterfly_AVX2(&rows[4], &rows[5]);
+    HadamardButterfly_AVX2(&rows[6], &rows[7]);
+    HadamardButterfly_AVX2(&rows[0], &rows[2]);
+    HadamardButterfly_AVX2(&rows[1], &rows[3]);
+    HadamardButterfly_AVX2(&rows[4], &rows[6]);
+    HadamardButterfly_AVX2(&rows[5], &rows[7]);
+    HadamardButterfly_AVX2(&rows[0], &rows[4]);
+    HadamardButterfly_AVX2(&rows[1], &rows[5]);
+    HadamardButterfly_AVX2(&rows[2], &rows[6]);
+    HadamardButterfly_AVX2(&rows[3], &rows[7]);
+
+    sum = _mm256_add_epi32(
+        _mm256_add_epi32(
+            _mm256_add_epi32(HadamardRowAbsSum_AVX2(rows[0]), HadamardRowAbsSum_AVX2(rows[1])),
+            _mm256_add_epi32(HadamardRowAbsSum_AVX2(rows[2]), HadamardRowAbsSum_AVX2(rows[3]))),
+        _mm256_add_epi32(
+            _mm256_add_epi32(HadamardRowAbsSum_AVX2(rows[4]), HadamardRowAbsSum_AVX2(rows[5])),
+            _mm256_add_epi32(HadamardRowAbsSum_AVX2(rows[6]), HadamardRowAbsSum_AVX2(rows[7]))));
+    sum = _mm256_add_epi32(sum, _mm256_shuffle_epi32(sum, 0x4E));
+    return _mm256_add_epi32(sum, _mm256_shuffle_epi32(sum, 0xB1));
+}
+
+// One 8x8 block, rows i and i + 4 in rows[i]
+static inline EB_U32 Hadamard8x8Sum_AVX2(__m256i rows[4])
+{
+    __m256i sum;
+    __m128i sum128;
+    EB_U32 i;
+
+    HadamardButterfly_AVX2(&rows[0], &rows[1]);
+    HadamardButterfly_AVX2(&rows[2], &rows[3]);
+    HadamardButterfly_AVX2(&rows[0], &rows[2]);
+    HadamardButterfly_AVX2(&rows[1], &rows[3]);
+
+    // Rows i and i + 4 are the two lanes
+    for (i = 0; i < 4; i++) {
+        const __m256i swapped = _mm256_permute2x128_si256(rows[i], rows[i], 0x01);
+        rows[i] = _mm256_blend_epi32(_mm256_add_epi16(rows[i], swapped), _mm256_sub_epi16(swapped, rows[i]), 0xF0);
+    }
+
+    sum = _mm256_add_epi32(
+        _mm256_add_epi32(HadamardRowAbsSum_AVX2(rows[0]), HadamardRowAbsSum_AVX2(rows[1])),
+        _mm256_add_epi32(HadamardRowAbsSum_AVX2(rows[2]), HadamardRowAbsSum_AVX2(rows[3])));
+    sum128 = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, 0x4E));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, 0xB1));
+
+    return (EB_U32)_mm_cvtsi128_si32(sum128);
+}
+
+static inline EB_U64 RoundSatd16x8_AVX2(__m256i sums)
+{
+    return
+        (((EB_U64)(EB_U32)_mm256_extract_epi32(sums, 0) + 2) >> 2) +
+        (((EB_U64)(EB_U32)_mm256_extract_epi32(sums, 4) + 2) >> 2);
+}
+
+EB_U64 Compute8x8Satd_AVX2_INTRIN(
+    EB_S16 *diff)       // input parameter, diff samples Ptr
+{
+    __m256i rows[4];
+    EB_U32 i;
+
+    for (i = 0; i < 4; i++) {
+        rows[i] = _mm256_set_m128i(_mm_loadu_si128((__m128i*)(diff + ((i + 4) << 3))), _mm_loadu_si128((__m128i*)(diff + (i << 3))));
+    }
+
+    return (Hadamard8x8Sum_AVX2(rows) + 2) >> 2;
+}
+
+EB_U64 Compute8x8Satd_U8_AVX2_INTRIN(
+    EB_U8  *src,        // input parameter, source samples Ptr
+    EB_U64 *dcValue,
+    EB_U32  srcStride)
+{
+    __m256i rows[4];
+    __m128i sum = _mm_setzero_si128();
+    EB_U32 i;
+
+    for (i = 0; i < 4; i++) {
+        const __m128i bytes = _mm_unpacklo_epi64(
+            _mm_loadl_epi64((__m128i*)(src + i * srcStride)),
+            _mm_loadl_epi64((__m128i*)(src + (i + 4) * srcStride)));
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(bytes, _mm_setzero_si128()));
+        rows[i] = _mm256_cvtepu8_epi16(bytes);
+    }
+    *dcValue += (EB_U64)_mm_cvtsi128_si64(_mm_add_epi64(sum, _mm_srli_si128(sum, 8)));
+
+    return (Hadamard8x8Sum_AVX2(rows) + 2) >> 2;
+}
+
+EB_U64 Compute16x16Satd_U8_AVX2_INTRIN(
+    EB_U8  *src,        // input parameter, source samples Ptr
+    EB_U64 *dcValue,
+    EB_U32  srcStride)
+{
+    __m256i rows[8];
+    __m128i sum = _mm_setzero_si128();
+    EB_U64 satd = 0;
+    EB_U32 half, i;
+
+    for (half = 0; half < 2; half++) {
+        for (i = 0; i < 8; i++) {
+            const __m128i bytes = _mm_loadu_si128((__m128i*)(src + i * srcStride));
+            sum = _mm_add_epi64(sum, _mm_sad_epu8(bytes, _mm_setzero_si128()));
+            rows[i] = _mm256_cvtepu8_epi16(bytes);
+        }
+        satd += RoundSatd16x8_AVX2(Hadamard16x8Sums_AVX2(rows));
+        src += srcStride << 3;
+    }
+    *dcValue += (EB_U64)_mm_cvtsi128_si64(_mm_add_epi64(sum, _mm_srli_si128(sum, 8)));
+
+    return satd;
+}
+
+/*******************************************************************************
+* Same result as BlockHash64x64Kernel, with the SSE4.2 CRC-32C instruction.
+*******************************************************************************/
+void BlockHash64x64Kernel_AVX2_INTRIN(
+    EB_U8   *src,
+    EB_U32   srcStride,
+    EB_U32   width,
+    EB_U32   height,
+    EB_U32  *hash)
+{
+    EB_U32 x, y, i, blockSize;
+
+    for (y = 0; y < height; ++y) {
+        const EB_U8 *srcRow = src + y * srcStride;
+        EB_U32 *hashRow = hash + y * width;
+        for (x = 0; x + 8 <= width; ++x) {
+            EB_U32 low, high;
+            memcpy(&low, srcRow + x, 4);
+            memcpy(&high, srcRow + x + 4, 4);
+            hashRow[x] = _mm_crc32_u32(_mm_crc32_u32(0, low), high);
+        }
+    }
+
+    for (y = 0; y + 8 <= height; ++y) {
+        for (x = 0; x + 8 <= width; ++x) {
+            EB_U32 crc = 0;
+            for (i = 0; i < 8; ++i) {
+                crc = _mm_crc32_u32(crc, hash[(y + i) * width + x]);
+            }
+            hash[y * width + x] = crc;
+        }
+    }
+
+    for (blockSize = 16; blockSize <= 64; blockSize <<= 1) {
+        const EB_U32 half = blockSize >> 1;
+        for (y = 0; y + blockSize <= height; ++y) {
+            EB_U32 *top = hash + y * width;
+            EB_U32 *bottom = top + half * width;
+            for (x = 0; x + blockSize <= width; ++x) {
+                EB_U32 crc = _mm_crc32_u32(0, top[x]);
+                crc = _mm_crc32_u32(crc, top[x + half]);
+                crc = _mm_crc32_u32(crc, bottom[x]);
+                crc = _mm_crc32_u32(crc, bottom[x + half]);
+                top[x] = crc;
+            }
+        }
+    }
+}
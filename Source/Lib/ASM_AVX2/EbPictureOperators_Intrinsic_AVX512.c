@@ -0,0 +1,209 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbPictureOperators_AVX512.h"
+
+#include <immintrin.h>
+
+/*******************************************************************************
+* Same result as SpatialFullDistortionKernel16MxN_SSSE3_INTRIN (32-bit
+* accumulation, width rounded up to 16), four rows per zmm.
+*******************************************************************************/
+AVX512_FUNC_TARGET
+EB_U64 SpatialFullDistortionKernel16MxN_AVX512_INTRIN(
+    EB_U8   *input,
+    EB_U32   inputStride,
+    EB_U8   *recon,
+    EB_U32   reconStride,
+    EB_U32   areaWidth,
+    EB_U32   areaHeight)
+{
+    EB_U32 rowIndex, columnIndex;
+    __m512i zero = _mm512_setzero_si512();
+    __m512i sum = _mm512_setzero_si512();
+    __m128i sum128 = _mm_setzero_si128();
+
+    for (columnIndex = 0; columnIndex < areaWidth; columnIndex += 16) {
+        EB_U8 *inputPtr = input + columnIndex;
+        EB_U8 *reconPtr = recon + columnIndex;
+
+        for (rowIndex = 0; rowIndex + 4 <= areaHeight; rowIndex += 4) {
+            __m512i x, y;
+
+            x = _mm512_castsi128_si512(_mm_loadu_si128((__m128i*)inputPtr));
+            x = _mm512_inserti32x4(x, _mm_loadu_si128((__m128i*)(inputPtr + inputStride)), 1);
+            x = _mm512_inserti32x4(x, _mm_loadu_si128((__m128i*)(inputPtr + 2 * inputStride)), 2);
+            x = _mm512_inserti32x4(x, _mm_loadu_si128((__m128i*)(inputPtr + 3 * inputStride)), 3);
+            y = _mm512_castsi128_si512(_mm_loadu_si128((__m128i*)reconPtr));
+            y = _mm512_inserti32x4(y, _mm_loadu_si128((__m128i*)(reconPtr + reconStride)), 1);
+            y = _mm512_inserti32x4(y, _mm_loadu_si128((__m128i*)(reconPtr + 2 * reconStride)), 2);
+            y = _mm512_inserti32x4(y, _mm_loadu_si128((__m128i*)(reconPtr + 3 * reconStride)), 3);
+
+            x = _mm512_or_si512(_mm512_subs_epu8(x, y), _mm512_subs_epu8(y, x));
+            y = _mm512_unpackhi_epi8(x, zero);
+            x = _mm512_unpacklo_epi8(x, zero);
+            sum = _mm512_add_epi32(sum, _mm512_add_epi32(_mm512_madd_epi16(x, x), _mm512_madd_epi16(y, y)));
+
+            inputPtr += inputStride << 2;
+            reconPtr += reconStride << 2;
+        }
+
+        for (; rowIndex < areaHeight; ++rowIndex) {
+            __m128i x = _mm_loadu_si128((__m128i*)inputPtr);
+            __m128i y = _mm_loadu_si128((__m128i*)reconPtr);
+
+            x = _mm_or_si128(_mm_subs_epu8(x, y), _mm_subs_epu8(y, x));
+            y = _mm_unpackhi_epi8(x, _mm_setzero_si128());
+            x = _mm_unpacklo_epi8(x, _mm_setzero_si128());
+            sum128 = _mm_add_epi32(sum128, _mm_add_epi32(_mm_madd_epi16(x, x), _mm_madd_epi16(y, y)));
+
+            inputPtr += inputStride;
+            reconPtr += reconStride;
+        }
+    }
+
+    sum128 = _mm_add_epi32(sum128, _mm512_castsi512_si128(sum));
+    sum128 = _mm_add_epi32(sum128, _mm512_extracti32x4_epi32(sum, 1));
+    sum128 = _mm_add_epi32(sum128, _mm512_extracti32x4_epi32(sum, 2));
+    sum128 = _mm_add_epi32(sum128, _mm512_extracti32x4_epi32(sum, 3));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, 0x4e)); // 01001110
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, 0xb1)); // 10110001
+
+    return (EB_U32)_mm_cvtsi128_si32(sum128);
+}
+
+AVX512_FUNC_TARGET
+void ResidualKernel32x32_AVX512_INTRIN(
+    EB_U8   *input,
+    EB_U32   inputStride,
+    EB_U8   *pred,
+    EB_U32   predStride,
+    EB_S16  *residual,
+    EB_U32   residualStride,
+    EB_U32   areaWidth,
+    EB_U32   areaHeight)
+{
+    EB_U32 y;
+
+    for (y = 0; y < 32; ++y) {
+        _mm512_storeu_si512((__m512i*)residual, _mm512_sub_epi16(
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)input)),
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)pred))));
+
+        input += inputStride;
+        pred += predStride;
+        residual += residualStride;
+    }
+    (void)areaWidth;
+    (void)areaHeight;
+}
+
+AVX512_FUNC_TARGET
+void ResidualKernel64x64_AVX512_INTRIN(
+    EB_U8   *input,
+    EB_U32   inputStride,
+    EB_U8   *pred,
+    EB_U32   predStride,
+    EB_S16  *residual,
+    EB_U32   residualStride,
+    EB_U32   areaWidth,
+    EB_U32   areaHeight)
+{
+    EB_U32 y;
+
+    for (y = 0; y < 64; ++y) {
+        _mm512_storeu_si512((__m512i*)residual, _mm512_sub_epi16(
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)input)),
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)pred))));
+        _mm512_storeu_si512((__m512i*)(residual + 32), _mm512_sub_epi16(
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(input + 32))),
+            _mm512_cvtepu8_epi16(_mm256_loadu_si256((__m256i*)(pred + 32)))));
+
+        input += inputStride;
+        pred += predStride;
+        residual += residualStride;
+    }
+    (void)areaWidth;
+    (void)areaHeight;
+}
+
+/*******************************************************************************
+* Same result as Compute16x16Satd_U8: the four 8x8 blocks are the four
+* 128-bit lanes, rows i and i + 8 in rows[i]. See Hadamard16x8Sums_AVX2 for
+* the in-place butterflies and the folded last stage.
+*******************************************************************************/
+AVX512_FUNC_TARGET
+static inline void HadamardButterfly_AVX512(__m512i *a, __m512i *b)
+{
+    const __m512i t = *a;
+    *a = _mm512_add_epi16(t, *b);
+    *b = _mm512_sub_epi16(t, *b);
+}
+
+AVX512_FUNC_TARGET
+static inline __m512i HadamardRowAbsSum_AVX512(__m512i v)
+{
+    __m512i swapped;
+
+    swapped = _mm512_or_si512(_mm512_slli_epi32(v, 16), _mm512_srli_epi32(v, 16));
+    v = _mm512_mask_blend_epi16(0xAAAAAAAA, _mm512_add_epi16(v, swapped), _mm512_sub_epi16(swapped, v));
+    swapped = _mm512_shuffle_epi32(v, (_MM_PERM_ENUM)0xB1);
+    v = _mm512_mask_blend_epi16(0xCCCCCCCC, _mm512_add_epi16(v, swapped), _mm512_sub_epi16(swapped, v));
+    swapped = _mm512_shuffle_epi32(v, (_MM_PERM_ENUM)0x4E);
+    v = _mm512_max_epi16(_mm512_abs_epi16(v), _mm512_abs_epi16(swapped));
+
+    return _mm512_madd_epi16(v, _mm512_set1_epi16(1));
+}
+
+AVX512_FUNC_TARGET
+EB_U64 Compute16x16Satd_U8_AVX512_INTRIN(
+    EB_U8  *src,
+    EB_U64 *dcValue,
+    EB_U32  srcStride)
+{
+    __m512i rows[8];
+    __m512i sum;
+    __m128i dc = _mm_setzero_si128();
+    EB_U64 satd = 0;
+    EB_U32 i;
+
+    for (i = 0; i < 8; i++) {
+        const __m128i top = _mm_loadu_si128((__m128i*)(src + i * srcStride));
+        const __m128i bottom = _mm_loadu_si128((__m128i*)(src + (i + 8) * srcStride));
+        dc = _mm_add_epi64(dc, _mm_add_epi64(_mm_sad_epu8(top, _mm_setzero_si128()), _mm_sad_epu8(bottom, _mm_setzero_si128())));
+        rows[i] = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_cvtepu8_epi16(top)), _mm256_cvtepu8_epi16(bottom), 1);
+    }
+    *dcValue += (EB_U64)_mm_cvtsi128_si64(_mm_add_epi64(dc, _mm_srli_si128(dc, 8)));
+
+    HadamardButterfly_AVX512(&rows[0], &rows[1]);
+    HadamardButterfly_AVX512(&rows[2], &rows[3]);
+    HadamardButterfly_AVX512(&rows[4], &rows[5]);
+    HadamardButterfly_AVX512(&rows[6], &rows[7]);
+    HadamardButterfly_AVX512(&rows[0], &rows[2]);
+    HadamardButterfly_AVX512(&rows[1], &rows[3]);
+    HadamardButterfly_AVX512(&rows[4], &rows[6]);
+    HadamardButterfly_AVX512(&rows[5], &rows[7]);
+    HadamardButterfly_AVX512(&rows[0], &rows[4]);
+    HadamardButterfly_AVX512(&rows[1], &rows[5]);
+    HadamardButterfly_AVX512(&rows[2], &rows[6]);
+    HadamardButterfly_AVX512(&rows[3], &rows[7]);
+
+    sum = _mm512_add_epi32(
+        _mm512_add_epi32(
+            _mm512_add_epi32(HadamardRowAbsSum_AVX512(rows[0]), HadamardRowAbsSum_AVX512(rows[1])),
+            _mm512_add_epi32(HadamardRowAbsSum_AVX512(rows[2]), HadamardRowAbsSum_AVX512(rows[3]))),
+        _mm512_add_epi32(
+            _mm512_add_epi32(HadamardRowAbsSum_AVX512(rows[4]), HadamardRowAbsSum_AVX512(rows[5])),
+            _mm512_add_epi32(HadamardRowAbsSum_AVX512(rows[6]), HadamardRowAbsSum_AVX512(rows[7]))));
+    sum = _mm512_add_epi32(sum, _mm512_shuffle_epi32(sum, (_MM_PERM_ENUM)0x4E));
+    sum = _mm512_add_epi32(sum, _mm512_shuffle_epi32(sum, (_MM_PERM_ENUM)0xB1));
+
+    satd += ((EB_U64)(EB_U32)_mm_cvtsi128_si32(_mm512_castsi512_si128(sum)) + 2) >> 2;
+    satd += ((EB_U64)(EB_U32)_mm_cvtsi128_si32(_mm512_extracti32x4_epi32(sum, 1)) + 2) >> 2;
+    satd += ((EB_U64)(EB_U32)_mm_cvtsi128_si32(_mm512_extracti32x4_epi32(sum, 2)) + 2) >> 2;
+    satd += ((EB_U64)(EB_U32)_mm_cvtsi128_si32(_mm512_extracti32x4_epi32(sum, 3)) + 2) >> 2;
+
+    return satd;
+}
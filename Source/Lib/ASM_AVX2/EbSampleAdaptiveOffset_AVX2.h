@@ -0,0 +1,146 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbSampleAdaptiveOffset_AVX2_h
+#define EbSampleAdaptiveOffset_AVX2_h
+
+#include "EbDefinitions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+EB_ERRORTYPE GatherSaoStatisticsLcu_BT_AVX2(
+    EB_U8                   *inputSamplePtr,        // input parameter, source Picture Ptr
+    EB_U32                   inputStride,           // input parameter, source stride
+    EB_U8                   *reconSamplePtr,        // input parameter, deblocked Picture Ptr
+    EB_U32                   reconStride,           // input parameter, deblocked stride
+    EB_U32                   lcuWidth,              // input parameter, LCU width
+    EB_U32                   lcuHeight,             // input parameter, LCU height
+    EB_S32                  *boDiff,                // output parameter, used to store Band Offset diff, boDiff[SAO_BO_INTERVALS]
+    EB_U16                  *boCount,               // output parameter, used to store Band Offset count, boCount[SAO_BO_INTERVALS]
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],     // output parameter, used to store Edge Offset diff, eoDiff[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1]);   // output parameter, used to store Edge Offset count, eoCount[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
+
+EB_ERRORTYPE GatherSaoStatisticsLcu_OnlyEo_90_45_135_BT_AVX2(
+    EB_U8                   *inputSamplePtr,        // input parameter, source Picture Ptr
+    EB_U32                   inputStride,           // input parameter, source stride
+    EB_U8                   *reconSamplePtr,        // input parameter, deblocked Picture Ptr
+    EB_U32                   reconStride,           // input parameter, deblocked stride
+    EB_U32                   lcuWidth,              // input parameter, LCU width
+    EB_U32                   lcuHeight,             // input parameter, LCU height
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],     // output parameter, used to store Edge Offset diff, eoDiff[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1]);   // output parameter, used to store Edge Offset count, eoCount[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
+
+EB_ERRORTYPE GatherSaoStatisticsLcu16bit_AVX2_INTRIN(
+    EB_U16                  *inputSamplePtr,        // input parameter, source Picture Ptr
+    EB_U32                   inputStride,           // input parameter, source stride
+    EB_U16                  *reconSamplePtr,        // input parameter, deblocked Picture Ptr
+    EB_U32                   reconStride,           // input parameter, deblocked stride
+    EB_U32                   lcuWidth,              // input parameter, LCU width
+    EB_U32                   lcuHeight,             // input parameter, LCU height
+    EB_S32                  *boDiff,                // output parameter, used to store Band Offset diff, boDiff[SAO_BO_INTERVALS]
+    EB_U16                  *boCount,               // output parameter, used to store Band Offset count, boCount[SAO_BO_INTERVALS]
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],     // output parameter, used to store Edge Offset diff, eoDiff[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1]);   // output parameter, used to store Edge Offset count, eoCount[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
+
+EB_ERRORTYPE GatherSaoStatisticsLcu_OnlyEo_90_45_135_16bit_AVX2_INTRIN(
+    EB_U16                  *inputSamplePtr,        // input parameter, source Picture Ptr
+    EB_U32                   inputStride,           // input parameter, source stride
+    EB_U16                  *reconSamplePtr,        // input parameter, deblocked Picture Ptr
+    EB_U32                   reconStride,           // input parameter, deblocked stride
+    EB_U32                   lcuWidth,              // input parameter, LCU width
+    EB_U32                   lcuHeight,             // input parameter, LCU height
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],     // output parameter, used to store Edge Offset diff, eoDiff[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1]);   // output parameter, used to store Edge Offset count, eoCount[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
+
+EB_ERRORTYPE SAOApplyBO_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U32                    saoBandPosition,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+EB_ERRORTYPE SAOApplyEO_0_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U8                    *temporalBufferLeft,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+EB_ERRORTYPE SAOApplyEO_90_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U8                    *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+EB_ERRORTYPE SAOApplyEO_135_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U8                    *temporalBufferLeft,
+    EB_U8                    *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+EB_ERRORTYPE SAOApplyEO_45_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U8                    *temporalBufferLeft,
+    EB_U8                    *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+EB_ERRORTYPE SAOApplyBO16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U32                    saoBandPosition,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+EB_ERRORTYPE SAOApplyEO_0_16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U16                   *temporalBufferLeft,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+EB_ERRORTYPE SAOApplyEO_90_16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U16                   *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+EB_ERRORTYPE SAOApplyEO_135_16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U16                   *temporalBufferLeft,
+    EB_U16                   *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+EB_ERRORTYPE SAOApplyEO_45_16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U16                   *temporalBufferLeft,
+    EB_U16                   *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbSampleAdaptiveOffset_AVX2_h
@@ -0,0 +1,957 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+#include "EbDefinitions.h"
+#include "EbSampleAdaptiveOffset_AVX2.h"
+
+#define SAO_EO_0     0
+#define SAO_EO_135   2
+#define SAO_EO_45    3
+
+// 32 valid bytes followed by 32 masked bytes, loaded at (32 - valid)
+static const EB_U8 saoMaskTable[64] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/*******************************************
+* SAO statistics (8 bit)
+*   Same lane layout as the SSE2 kernels, 32
+*   columns per pass with a 16 column tail.
+*******************************************/
+static inline __m256i SaoLoad8bit(EB_BYTE ptr, EB_U32 chunkWidth)
+{
+    if (chunkWidth == 32) {
+        return _mm256_loadu_si256((__m256i *)ptr);
+    }
+    return _mm256_inserti128_si256(_mm256_setzero_si256(), _mm_loadu_si128((__m128i *)ptr), 0);
+}
+
+static inline void SaoCountEdge(
+    __m256i    *eoDiff,
+    __m256i    *eoCount,
+    EB_BYTE     ptr,
+    EB_S32      offset,
+    EB_U32      chunkWidth,
+    __m256i     x0,
+    __m256i     diff,
+    __m256i     mask)
+{
+    __m256i x1, x2;
+    __m256i c1, c2;
+    __m256i cat, select;
+
+    x1 = _mm256_xor_si256(SaoLoad8bit(ptr + offset, chunkWidth), _mm256_set1_epi8(-128));
+    x2 = _mm256_xor_si256(SaoLoad8bit(ptr - offset, chunkWidth), _mm256_set1_epi8(-128));
+
+    c1 = _mm256_sub_epi8(_mm256_cmpgt_epi8(x1, x0), _mm256_cmpgt_epi8(x0, x1));
+    c2 = _mm256_sub_epi8(_mm256_cmpgt_epi8(x2, x0), _mm256_cmpgt_epi8(x0, x2));
+    cat = _mm256_and_si256(_mm256_add_epi8(c1, c2), mask);
+
+    select = _mm256_cmpeq_epi8(cat, _mm256_set1_epi8(-2));
+    eoCount[0] = _mm256_sub_epi8(eoCount[0], select);
+    eoDiff[0] = _mm256_add_epi64(eoDiff[0], _mm256_sad_epu8(_mm256_and_si256(diff, select), _mm256_setzero_si256()));
+
+    select = _mm256_cmpeq_epi8(cat, _mm256_set1_epi8(-1));
+    eoCount[1] = _mm256_sub_epi8(eoCount[1], select);
+    eoDiff[1] = _mm256_add_epi64(eoDiff[1], _mm256_sad_epu8(_mm256_and_si256(diff, select), _mm256_setzero_si256()));
+
+    select = _mm256_cmpeq_epi8(cat, _mm256_set1_epi8(1));
+    eoCount[2] = _mm256_sub_epi8(eoCount[2], select);
+    eoDiff[2] = _mm256_add_epi64(eoDiff[2], _mm256_sad_epu8(_mm256_and_si256(diff, select), _mm256_setzero_si256()));
+
+    select = _mm256_cmpeq_epi8(cat, _mm256_set1_epi8(2));
+    eoCount[3] = _mm256_sub_epi8(eoCount[3], select);
+    eoDiff[3] = _mm256_add_epi64(eoDiff[3], _mm256_sad_epu8(_mm256_and_si256(diff, select), _mm256_setzero_si256()));
+}
+
+static inline EB_U32 SaoSumLanes64(__m256i x)
+{
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+    s = _mm_add_epi64(s, _mm_srli_si128(s, 8));
+    return (EB_U32)_mm_cvtsi128_si32(s);
+}
+
+static inline void GatherSaoStatisticsLcu8bit(
+    EB_U8                   *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U8                   *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                  *boDiff,
+    EB_U16                  *boCount,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_BOOL                  gatherBoEo0)
+{
+    EB_S32 colCount, rowCount;
+    EB_S32 i, j;
+    EB_S32 firstType = gatherBoEo0 ? 0 : 1;
+
+    __m256i eoDiffX[SAO_EO_TYPES][SAO_EO_CATEGORIES];
+    __m256i eoCountX[SAO_EO_TYPES][SAO_EO_CATEGORIES];
+    EB_ALIGN(32) EB_U8 catArray[32];
+    EB_ALIGN(32) EB_S8 diffArray[32];
+
+    lcuWidth -= 2;
+    lcuHeight -= 2;
+    inputSamplePtr += inputStride + 1;
+    reconSamplePtr += reconStride + 1;
+
+    if (gatherBoEo0) {
+        for (i = 0; i < SAO_BO_INTERVALS; i++) {
+            boCount[i] = 0;
+            boDiff[i] = 0;
+        }
+    }
+
+    for (i = firstType; i < SAO_EO_TYPES; i++) {
+        for (j = 0; j < SAO_EO_CATEGORIES; j++) {
+            eoDiffX[i][j] = _mm256_setzero_si256();
+            eoCountX[i][j] = _mm256_setzero_si256();
+        }
+    }
+
+    colCount = lcuWidth;
+    do {
+        EB_BYTE ptr = reconSamplePtr;
+        EB_BYTE qtr = inputSamplePtr;
+        EB_U32 chunkWidth = colCount > 16 ? 32 : 16;
+        EB_S32 valid = colCount & ~1;
+        __m256i mask;
+
+        if (valid > (EB_S32)chunkWidth) {
+            valid = chunkWidth;
+        }
+        mask = _mm256_loadu_si256((__m256i *)(saoMaskTable + 32 - valid));
+
+        rowCount = lcuHeight;
+        do {
+            __m256i x0, y0;
+            __m256i diff;
+
+            x0 = SaoLoad8bit(ptr, chunkWidth);
+            y0 = SaoLoad8bit(qtr, chunkWidth);
+
+            if (gatherBoEo0) {
+                // Band offset; masked columns land in band 0 with a zero diff and are taken out below
+                EB_U32 k;
+                __m256i cat = _mm256_srli_epi16(_mm256_and_si256(x0, _mm256_set1_epi8(-8)), 3);
+                _mm256_store_si256((__m256i *)catArray, _mm256_and_si256(cat, mask));
+                x0 = _mm256_xor_si256(x0, _mm256_set1_epi8(-128));
+                y0 = _mm256_xor_si256(y0, _mm256_set1_epi8(-128));
+                diff = _mm256_and_si256(_mm256_subs_epi8(y0, x0), mask);
+                _mm256_store_si256((__m256i *)diffArray, diff);
+
+                for (k = 0; k < chunkWidth; k++) {
+                    boCount[catArray[k]]++;
+                    boDiff[catArray[k]] += diffArray[k];
+                }
+            }
+            else {
+                x0 = _mm256_xor_si256(x0, _mm256_set1_epi8(-128));
+                y0 = _mm256_xor_si256(y0, _mm256_set1_epi8(-128));
+                diff = _mm256_and_si256(_mm256_subs_epi8(y0, x0), mask);
+            }
+
+            // Edge offset, with the difference biased by 128 for _mm256_sad_epu8
+            diff = _mm256_xor_si256(diff, _mm256_set1_epi8(-128));
+
+            if (gatherBoEo0) {
+                SaoCountEdge(eoDiffX[0], eoCountX[0], ptr, 1, chunkWidth, x0, diff, mask);
+            }
+            SaoCountEdge(eoDiffX[1], eoCountX[1], ptr, reconStride, chunkWidth, x0, diff, mask);
+            SaoCountEdge(eoDiffX[2], eoCountX[2], ptr, reconStride + 1, chunkWidth, x0, diff, mask);
+            SaoCountEdge(eoDiffX[3], eoCountX[3], ptr, reconStride - 1, chunkWidth, x0, diff, mask);
+
+            ptr += reconStride;
+            qtr += inputStride;
+        } while (--rowCount);
+
+        reconSamplePtr += chunkWidth;
+        inputSamplePtr += chunkWidth;
+        colCount -= chunkWidth;
+    } while (colCount > 0);
+
+    if (gatherBoEo0) {
+        boCount[0] -= (EB_U16)(-colCount * lcuHeight);
+    }
+
+    for (i = firstType; i < SAO_EO_TYPES; i++) {
+        for (j = 0; j < SAO_EO_CATEGORIES; j++) {
+            // Note: per byte counts stay below 2 * 62
+            EB_U32 count = SaoSumLanes64(_mm256_sad_epu8(eoCountX[i][j], _mm256_setzero_si256()));
+            eoCount[i][j] = (EB_U16)count;
+            eoDiff[i][j] = (EB_S32)(SaoSumLanes64(eoDiffX[i][j]) - 128 * count);
+        }
+    }
+}
+
+EB_ERRORTYPE GatherSaoStatisticsLcu_BT_AVX2(
+    EB_U8                   *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U8                   *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                  *boDiff,
+    EB_U16                  *boCount,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1])
+{
+    GatherSaoStatisticsLcu8bit(
+        inputSamplePtr,
+        inputStride,
+        reconSamplePtr,
+        reconStride,
+        lcuWidth,
+        lcuHeight,
+        boDiff,
+        boCount,
+        eoDiff,
+        eoCount,
+        EB_TRUE);
+
+    return EB_ErrorNone;
+}
+
+EB_ERRORTYPE GatherSaoStatisticsLcu_OnlyEo_90_45_135_BT_AVX2(
+    EB_U8                   *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U8                   *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1])
+{
+    GatherSaoStatisticsLcu8bit(
+        inputSamplePtr,
+        inputStride,
+        reconSamplePtr,
+        reconStride,
+        lcuWidth,
+        lcuHeight,
+        (EB_S32 *)EB_NULL,
+        (EB_U16 *)EB_NULL,
+        eoDiff,
+        eoCount,
+        EB_FALSE);
+
+    return EB_ErrorNone;
+}
+
+/*******************************************
+* SAO statistics (16 bit)
+*   16 columns per pass, loaded as two halves.
+*   The halves of the last pass are loaded back
+*   from the end of the row, so no sample right
+*   of the LCU is read, and the lanes that the
+*   previous pass already counted are masked.
+*   Requirement: lcuWidth >= 10
+*******************************************/
+static inline __m256i SaoLoad16bit(EB_U16 *ptr, EB_S32 loColumn, EB_S32 hiColumn)
+{
+    return _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((__m128i *)(ptr + loColumn))),
+        _mm_loadu_si128((__m128i *)(ptr + hiColumn)),
+        1);
+}
+
+static inline void SaoCountEdge16bit(
+    __m256i    *eoDiff,
+    __m256i    *eoCount,
+    EB_U16     *ptr,
+    EB_S32      offset,
+    EB_S32      loColumn,
+    EB_S32      hiColumn,
+    __m256i     x0,
+    __m256i     diff,
+    __m256i     mask)
+{
+    __m256i x1, x2;
+    __m256i c1, c2;
+    __m256i cat, select;
+
+    x1 = SaoLoad16bit(ptr + offset, loColumn, hiColumn);
+    x2 = SaoLoad16bit(ptr - offset, loColumn, hiColumn);
+
+    c1 = _mm256_sub_epi16(_mm256_cmpgt_epi16(x1, x0), _mm256_cmpgt_epi16(x0, x1));
+    c2 = _mm256_sub_epi16(_mm256_cmpgt_epi16(x2, x0), _mm256_cmpgt_epi16(x0, x2));
+    cat = _mm256_and_si256(_mm256_add_epi16(c1, c2), mask);
+
+    select = _mm256_cmpeq_epi16(cat, _mm256_set1_epi16(-2));
+    eoCount[0] = _mm256_sub_epi16(eoCount[0], select);
+    eoDiff[0] = _mm256_add_epi32(eoDiff[0], _mm256_madd_epi16(_mm256_and_si256(diff, select), _mm256_set1_epi16(1)));
+
+    select = _mm256_cmpeq_epi16(cat, _mm256_set1_epi16(-1));
+    eoCount[1] = _mm256_sub_epi16(eoCount[1], select);
+    eoDiff[1] = _mm256_add_epi32(eoDiff[1], _mm256_madd_epi16(_mm256_and_si256(diff, select), _mm256_set1_epi16(1)));
+
+    select = _mm256_cmpeq_epi16(cat, _mm256_set1_epi16(1));
+    eoCount[2] = _mm256_sub_epi16(eoCount[2], select);
+    eoDiff[2] = _mm256_add_epi32(eoDiff[2], _mm256_madd_epi16(_mm256_and_si256(diff, select), _mm256_set1_epi16(1)));
+
+    select = _mm256_cmpeq_epi16(cat, _mm256_set1_epi16(2));
+    eoCount[3] = _mm256_sub_epi16(eoCount[3], select);
+    eoDiff[3] = _mm256_add_epi32(eoDiff[3], _mm256_madd_epi16(_mm256_and_si256(diff, select), _mm256_set1_epi16(1)));
+}
+
+static inline EB_S32 SaoSumLanes32(__m256i x)
+{
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+    s = _mm_add_epi32(s, _mm_srli_si128(s, 8));
+    s = _mm_add_epi32(s, _mm_srli_si128(s, 4));
+    return _mm_cvtsi128_si32(s);
+}
+
+static inline void GatherSaoStatisticsLcu16bit(
+    EB_U16                  *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U16                  *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                  *boDiff,
+    EB_U16                  *boCount,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_BOOL                  gatherBoEo0)
+{
+    const EB_S32 colCount = lcuWidth - 2;
+    EB_S32 column;
+    EB_S32 i, j;
+    EB_S32 firstType = gatherBoEo0 ? 0 : 1;
+
+    __m256i eoDiffX[SAO_EO_TYPES][SAO_EO_CATEGORIES];
+    __m256i eoCountX[SAO_EO_TYPES][SAO_EO_CATEGORIES];
+    EB_ALIGN(32) EB_U16 catArray[16];
+    EB_ALIGN(32) EB_S16 diffArray[16];
+    EB_ALIGN(32) EB_S16 maskArray[16];
+    EB_U32 boCountX[4][SAO_BO_INTERVALS];
+    EB_S32 boDiffX[4][SAO_BO_INTERVALS];
+
+    lcuHeight -= 2;
+    inputSamplePtr += inputStride + 1;
+    reconSamplePtr += reconStride + 1;
+
+    if (gatherBoEo0) {
+        EB_MEMSET(boCountX, 0, sizeof(boCountX));
+        EB_MEMSET(boDiffX, 0, sizeof(boDiffX));
+    }
+
+    for (i = firstType; i < SAO_EO_TYPES; i++) {
+        for (j = 0; j < SAO_EO_CATEGORIES; j++) {
+            eoDiffX[i][j] = _mm256_setzero_si256();
+            eoCountX[i][j] = _mm256_setzero_si256();
+        }
+    }
+
+    for (column = 0; column < colCount; column += 16) {
+        const EB_S32 remaining = colCount - column;
+        EB_S32 loColumn = column;
+        EB_S32 hiColumn = column + 8;
+        EB_S32 firstLane = 0;
+        EB_U16 *ptr = reconSamplePtr;
+        EB_U16 *qtr = inputSamplePtr;
+        EB_U32 rowCount;
+        __m256i mask;
+
+        // Lanes below firstLane were counted by the previous pass
+        if (remaining <= 8) {
+            loColumn = colCount - 8;
+            firstLane = 8 - remaining;
+            for (i = 0; i < 16; i++) {
+                maskArray[i] = (i >= firstLane && i < 8) ? -1 : 0;
+            }
+        }
+        else {
+            if (remaining < 16) {
+                hiColumn = colCount - 8;
+                firstLane = 16 - remaining;
+            }
+            for (i = 0; i < 16; i++) {
+                maskArray[i] = (i < 8 || i >= 8 + firstLane) ? -1 : 0;
+            }
+        }
+        mask = _mm256_load_si256((__m256i *)maskArray);
+        if (remaining <= 8) {
+            hiColumn = loColumn;
+        }
+
+        for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+            __m256i x0, y0;
+            __m256i diff;
+
+            x0 = SaoLoad16bit(ptr, loColumn, hiColumn);
+            y0 = SaoLoad16bit(qtr, loColumn, hiColumn);
+            diff = _mm256_and_si256(_mm256_sub_epi16(y0, x0), mask);
+
+            if (gatherBoEo0) {
+                EB_U32 k;
+                _mm256_store_si256((__m256i *)catArray, _mm256_srli_epi16(x0, 5));
+                _mm256_store_si256((__m256i *)diffArray, diff);
+
+                // Split by column, so that neighbouring samples of the same band do not wait on each other
+                for (k = 0; k < 16; k++) {
+                    if (maskArray[k]) {
+                        boCountX[k & 3][catArray[k]]++;
+                        boDiffX[k & 3][catArray[k]] += diffArray[k];
+                    }
+                }
+
+                SaoCountEdge16bit(eoDiffX[0], eoCountX[0], ptr, 1, loColumn, hiColumn, x0, diff, mask);
+            }
+            SaoCountEdge16bit(eoDiffX[1], eoCountX[1], ptr, reconStride, loColumn, hiColumn, x0, diff, mask);
+            SaoCountEdge16bit(eoDiffX[2], eoCountX[2], ptr, reconStride + 1, loColumn, hiColumn, x0, diff, mask);
+            SaoCountEdge16bit(eoDiffX[3], eoCountX[3], ptr, reconStride - 1, loColumn, hiColumn, x0, diff, mask);
+
+            ptr += reconStride;
+            qtr += inputStride;
+        }
+    }
+
+    if (gatherBoEo0) {
+        for (i = 0; i < SAO_BO_INTERVALS; i++) {
+            boCount[i] = (EB_U16)(boCountX[0][i] + boCountX[1][i] + boCountX[2][i] + boCountX[3][i]);
+            boDiff[i] = boDiffX[0][i] + boDiffX[1][i] + boDiffX[2][i] + boDiffX[3][i];
+        }
+    }
+
+    for (i = firstType; i < SAO_EO_TYPES; i++) {
+        for (j = 0; j < SAO_EO_CATEGORIES; j++) {
+            eoCount[i][j] = (EB_U16)SaoSumLanes32(_mm256_madd_epi16(eoCountX[i][j], _mm256_set1_epi16(1)));
+            eoDiff[i][j] = SaoSumLanes32(eoDiffX[i][j]);
+        }
+    }
+}
+
+EB_ERRORTYPE GatherSaoStatisticsLcu16bit_AVX2_INTRIN(
+    EB_U16                  *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U16                  *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                  *boDiff,
+    EB_U16                  *boCount,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1])
+{
+    GatherSaoStatisticsLcu16bit(
+        inputSamplePtr,
+        inputStride,
+        reconSamplePtr,
+        reconStride,
+        lcuWidth,
+        lcuHeight,
+        boDiff,
+        boCount,
+        eoDiff,
+        eoCount,
+        EB_TRUE);
+
+    return EB_ErrorNone;
+}
+
+EB_ERRORTYPE GatherSaoStatisticsLcu_OnlyEo_90_45_135_16bit_AVX2_INTRIN(
+    EB_U16                  *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U16                  *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1])
+{
+    GatherSaoStatisticsLcu16bit(
+        inputSamplePtr,
+        inputStride,
+        reconSamplePtr,
+        reconStride,
+        lcuWidth,
+        lcuHeight,
+        (EB_S32 *)EB_NULL,
+        (EB_U16 *)EB_NULL,
+        eoDiff,
+        eoCount,
+        EB_FALSE);
+
+    return EB_ErrorNone;
+}
+
+/*******************************************
+* SAO application
+*   Edge offsets are filtered in raster order.
+*   Each filtered row is held in filteredRow
+*   and written back once the next row is
+*   filtered, so every neighbour is read from
+*   the unfiltered picture.
+*******************************************/
+EB_ERRORTYPE SAOApplyBO_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U32                    saoBandPosition,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    const __m256i band = _mm256_set1_epi8((char)saoBandPosition);
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_cvtsi32_si128(*(EB_S32 *)saoOffsetPtr));
+    EB_U32 rowCount, colCount;
+
+    for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+        for (colCount = 0; colCount + 32 <= lcuWidth; colCount += 32) {
+            __m256i x0, x1;
+            x0 = _mm256_loadu_si256((__m256i *)(reconSamplePtr + colCount));
+
+            x1 = _mm256_and_si256(_mm256_sub_epi8(_mm256_srli_epi16(x0, 3), band), _mm256_set1_epi8(31));
+            x0 = _mm256_xor_si256(x0, _mm256_set1_epi8(-128));
+            x0 = _mm256_adds_epi8(x0, _mm256_and_si256(_mm256_shuffle_epi8(offsets, x1), _mm256_cmpgt_epi8(_mm256_set1_epi8(4), x1)));
+            x0 = _mm256_xor_si256(x0, _mm256_set1_epi8(-128));
+
+            _mm256_storeu_si256((__m256i *)(reconSamplePtr + colCount), x0);
+        }
+        for (; colCount < lcuWidth; colCount += 8) {
+            __m128i x0, x1;
+            x0 = _mm_loadl_epi64((__m128i *)(reconSamplePtr + colCount));
+
+            x1 = _mm_and_si128(_mm_sub_epi8(_mm_srli_epi16(x0, 3), _mm256_castsi256_si128(band)), _mm_set1_epi8(31));
+            x0 = _mm_xor_si128(x0, _mm_set1_epi8(-128));
+            x0 = _mm_adds_epi8(x0, _mm_and_si128(_mm_shuffle_epi8(_mm256_castsi256_si128(offsets), x1), _mm_cmpgt_epi8(_mm_set1_epi8(4), x1)));
+            x0 = _mm_xor_si128(x0, _mm_set1_epi8(-128));
+
+            _mm_storel_epi64((__m128i *)(reconSamplePtr + colCount), x0);
+        }
+        reconSamplePtr += reconStride;
+    }
+
+    return EB_ErrorNone;
+}
+
+// x0, x1 and x2 are biased to signed bytes; the offset index is SIGN(x0, x1) + SIGN(x0, x2) + 2
+static inline __m256i SaoEdgeOffset8bit(__m256i x0, __m256i x1, __m256i x2, __m256i offsets)
+{
+    __m256i c1, c2;
+    c1 = _mm256_sub_epi8(_mm256_cmpgt_epi8(x1, x0), _mm256_cmpgt_epi8(x0, x1));
+    c2 = _mm256_sub_epi8(_mm256_cmpgt_epi8(x2, x0), _mm256_cmpgt_epi8(x0, x2));
+    return _mm256_adds_epi8(x0, _mm256_shuffle_epi8(offsets, _mm256_add_epi8(_mm256_add_epi8(c1, c2), _mm256_set1_epi8(2))));
+}
+
+static inline __m128i SaoEdgeOffset8bit128(__m128i x0, __m128i x1, __m128i x2, __m128i offsets)
+{
+    __m128i c1, c2;
+    c1 = _mm_sub_epi8(_mm_cmpgt_epi8(x1, x0), _mm_cmpgt_epi8(x0, x1));
+    c2 = _mm_sub_epi8(_mm_cmpgt_epi8(x2, x0), _mm_cmpgt_epi8(x0, x2));
+    return _mm_adds_epi8(x0, _mm_shuffle_epi8(offsets, _mm_add_epi8(_mm_add_epi8(c1, c2), _mm_set1_epi8(2))));
+}
+
+static inline void SaoStoreRow8bit(EB_U8 *dst, EB_U8 *src, EB_U32 width)
+{
+    EB_U32 colCount;
+    for (colCount = 0; colCount + 32 <= width; colCount += 32) {
+        _mm256_storeu_si256((__m256i *)(dst + colCount), _mm256_load_si256((__m256i *)(src + colCount)));
+    }
+    if (colCount < width) {
+        _mm_storeu_si128((__m128i *)(dst + colCount), _mm_load_si128((__m128i *)(src + colCount)));
+    }
+}
+
+static inline void SaoApplyEo8bit(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U8                    *temporalBufferLeft,
+    EB_U8                    *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth,
+    EB_U32                    eoType)
+{
+    EB_ALIGN(32) EB_U8 filteredRow[2][MAX_LCU_SIZE];
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        saoOffsetPtr[0], saoOffsetPtr[1], saoOffsetPtr[2], saoOffsetPtr[3], saoOffsetPtr[4], 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+    const __m256i firstSample = _mm256_setr_epi8(-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    EB_U32 rowCount, colCount;
+
+    for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+        EB_U8 *abovePtr = rowCount ? reconSamplePtr - reconStride : temporalBufferUpper;
+        EB_U8 *filtered = filteredRow[rowCount & 1];
+        EB_U8 *neighbour1;
+        EB_U8 *neighbour2;
+        EB_BOOL patch1 = EB_FALSE;
+        EB_BOOL patch2 = EB_FALSE;
+        EB_U8 patchSample1 = 0;
+        EB_U8 patchSample2 = 0;
+
+        // Column -1 of the picture belongs to the filtered left LCU, so it is taken from the left buffer
+        switch (eoType) {
+        case SAO_EO_0:
+            neighbour1 = reconSamplePtr - 1;
+            neighbour2 = reconSamplePtr + 1;
+            patch1 = EB_TRUE;
+            patchSample1 = temporalBufferLeft[rowCount];
+            break;
+        case SAO_EO_135:
+            neighbour1 = abovePtr - 1;
+            neighbour2 = reconSamplePtr + reconStride + 1;
+            if (rowCount) {
+                patch1 = EB_TRUE;
+                patchSample1 = temporalBufferLeft[rowCount - 1];
+            }
+            break;
+        default:
+            neighbour1 = abovePtr + 1;
+            neighbour2 = reconSamplePtr + reconStride - 1;
+            patch2 = EB_TRUE;
+            patchSample2 = temporalBufferLeft[rowCount + 1];
+            break;
+        }
+
+        for (colCount = 0; colCount + 32 <= lcuWidth; colCount += 32) {
+            __m256i x0, x1, x2;
+            x0 = _mm256_loadu_si256((__m256i *)(reconSamplePtr + colCount));
+            x1 = _mm256_loadu_si256((__m256i *)(neighbour1 + colCount));
+            x2 = _mm256_loadu_si256((__m256i *)(neighbour2 + colCount));
+            if (colCount == 0) {
+                if (patch1) {
+                    x1 = _mm256_blendv_epi8(x1, _mm256_set1_epi8((char)patchSample1), firstSample);
+                }
+                if (patch2) {
+                    x2 = _mm256_blendv_epi8(x2, _mm256_set1_epi8((char)patchSample2), firstSample);
+                }
+            }
+            x0 = _mm256_xor_si256(x0, _mm256_set1_epi8(-128));
+            x1 = _mm256_xor_si256(x1, _mm256_set1_epi8(-128));
+            x2 = _mm256_xor_si256(x2, _mm256_set1_epi8(-128));
+
+            x0 = _mm256_xor_si256(SaoEdgeOffset8bit(x0, x1, x2, offsets), _mm256_set1_epi8(-128));
+            _mm256_store_si256((__m256i *)(filtered + colCount), x0);
+        }
+        if (colCount < lcuWidth) {
+            __m128i x0, x1, x2;
+            x0 = _mm_loadu_si128((__m128i *)(reconSamplePtr + colCount));
+            x1 = _mm_loadu_si128((__m128i *)(neighbour1 + colCount));
+            x2 = _mm_loadu_si128((__m128i *)(neighbour2 + colCount));
+            if (colCount == 0) {
+                if (patch1) {
+                    x1 = _mm_blendv_epi8(x1, _mm_set1_epi8((char)patchSample1), _mm256_castsi256_si128(firstSample));
+                }
+                if (patch2) {
+                    x2 = _mm_blendv_epi8(x2, _mm_set1_epi8((char)patchSample2), _mm256_castsi256_si128(firstSample));
+                }
+            }
+            x0 = _mm_xor_si128(x0, _mm_set1_epi8(-128));
+            x1 = _mm_xor_si128(x1, _mm_set1_epi8(-128));
+            x2 = _mm_xor_si128(x2, _mm_set1_epi8(-128));
+
+            x0 = _mm_xor_si128(SaoEdgeOffset8bit128(x0, x1, x2, _mm256_castsi256_si128(offsets)), _mm_set1_epi8(-128));
+            _mm_store_si128((__m128i *)(filtered + colCount), x0);
+        }
+
+        // The row above is no longer a neighbour once this row is filtered
+        if (rowCount) {
+            SaoStoreRow8bit(reconSamplePtr - reconStride, filteredRow[(rowCount - 1) & 1], lcuWidth);
+        }
+        reconSamplePtr += reconStride;
+    }
+    SaoStoreRow8bit(reconSamplePtr - reconStride, filteredRow[(lcuHeight - 1) & 1], lcuWidth);
+}
+
+EB_ERRORTYPE SAOApplyEO_0_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U8                    *temporalBufferLeft,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    SaoApplyEo8bit(reconSamplePtr, reconStride, temporalBufferLeft, (EB_U8 *)EB_NULL, saoOffsetPtr, lcuHeight, lcuWidth, SAO_EO_0);
+    return EB_ErrorNone;
+}
+
+EB_ERRORTYPE SAOApplyEO_90_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U8                    *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        saoOffsetPtr[0], saoOffsetPtr[1], saoOffsetPtr[2], saoOffsetPtr[3], saoOffsetPtr[4], 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+    EB_U32 rowCount, colCount;
+
+    // No horizontal neighbours: filter 32 column strips top down, carrying the unfiltered row above
+    for (colCount = 0; colCount + 32 <= lcuWidth; colCount += 32) {
+        EB_U8 *ptr = reconSamplePtr + colCount;
+        __m256i x0, x1, x2;
+        x1 = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(temporalBufferUpper + colCount)), _mm256_set1_epi8(-128));
+        x0 = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)ptr), _mm256_set1_epi8(-128));
+        for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+            x2 = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(ptr + reconStride)), _mm256_set1_epi8(-128));
+            _mm256_storeu_si256((__m256i *)ptr, _mm256_xor_si256(SaoEdgeOffset8bit(x0, x1, x2, offsets), _mm256_set1_epi8(-128)));
+            x1 = x0;
+            x0 = x2;
+            ptr += reconStride;
+        }
+    }
+    if (colCount < lcuWidth) {
+        EB_U8 *ptr = reconSamplePtr + colCount;
+        __m128i x0, x1, x2;
+        x1 = _mm_xor_si128(_mm_loadu_si128((__m128i *)(temporalBufferUpper + colCount)), _mm_set1_epi8(-128));
+        x0 = _mm_xor_si128(_mm_loadu_si128((__m128i *)ptr), _mm_set1_epi8(-128));
+        for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+            x2 = _mm_xor_si128(_mm_loadu_si128((__m128i *)(ptr + reconStride)), _mm_set1_epi8(-128));
+            _mm_storeu_si128((__m128i *)ptr, _mm_xor_si128(SaoEdgeOffset8bit128(x0, x1, x2, _mm256_castsi256_si128(offsets)), _mm_set1_epi8(-128)));
+            x1 = x0;
+            x0 = x2;
+            ptr += reconStride;
+        }
+    }
+
+    return EB_ErrorNone;
+}
+
+EB_ERRORTYPE SAOApplyEO_135_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U8                    *temporalBufferLeft,
+    EB_U8                    *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    SaoApplyEo8bit(reconSamplePtr, reconStride, temporalBufferLeft, temporalBufferUpper, saoOffsetPtr, lcuHeight, lcuWidth, SAO_EO_135);
+    return EB_ErrorNone;
+}
+
+EB_ERRORTYPE SAOApplyEO_45_BT_AVX2(
+    EB_U8                    *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U8                    *temporalBufferLeft,
+    EB_U8                    *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    SaoApplyEo8bit(reconSamplePtr, reconStride, temporalBufferLeft, temporalBufferUpper, saoOffsetPtr, lcuHeight, lcuWidth, SAO_EO_45);
+    return EB_ErrorNone;
+}
+
+/*******************************************
+* SAO application (10 bit)
+*   16 samples per pass; the offsets are
+*   widened to 16 bit and selected with a
+*   byte shuffle on (2 * index, 2 * index + 1).
+*******************************************/
+static inline __m256i SaoOffsetLookup16bit(__m256i index, __m256i offsets)
+{
+    __m256i shuffle = _mm256_add_epi16(index, index);
+    shuffle = _mm256_or_si256(shuffle, _mm256_slli_epi16(_mm256_add_epi16(shuffle, _mm256_set1_epi16(1)), 8));
+    return _mm256_shuffle_epi8(offsets, shuffle);
+}
+
+static inline __m256i SaoClip10bit(__m256i x)
+{
+    return _mm256_max_epi16(_mm256_min_epi16(x, _mm256_set1_epi16(MAX_SAMPLE_VALUE_10BIT)), _mm256_setzero_si256());
+}
+
+EB_ERRORTYPE SAOApplyBO16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U32                    saoBandPosition,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    const __m256i band = _mm256_set1_epi16((short)saoBandPosition);
+    // index 4 selects the zero offset of the bands outside [saoBandPosition, saoBandPosition + SAO_BO_LEN)
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi16(
+        saoOffsetPtr[0], saoOffsetPtr[1], saoOffsetPtr[2], saoOffsetPtr[3], 0, 0, 0, 0));
+    EB_U32 rowCount, colCount;
+
+    for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+        for (colCount = 0; colCount < lcuWidth; colCount += 16) {
+            __m256i x0, index;
+            x0 = _mm256_loadu_si256((__m256i *)(reconSamplePtr + colCount));
+
+            index = _mm256_sub_epi16(_mm256_srli_epi16(x0, 5), band);
+            index = _mm256_min_epu16(index, _mm256_set1_epi16(SAO_BO_LEN));
+            x0 = SaoClip10bit(_mm256_add_epi16(x0, SaoOffsetLookup16bit(index, offsets)));
+
+            _mm256_storeu_si256((__m256i *)(reconSamplePtr + colCount), x0);
+        }
+        reconSamplePtr += reconStride;
+    }
+
+    return EB_ErrorNone;
+}
+
+static inline void SaoStoreRow16bit(EB_U16 *dst, EB_U16 *src, EB_U32 width)
+{
+    EB_U32 colCount;
+    for (colCount = 0; colCount < width; colCount += 16) {
+        _mm256_storeu_si256((__m256i *)(dst + colCount), _mm256_load_si256((__m256i *)(src + colCount)));
+    }
+}
+
+static inline void SaoApplyEo16bit(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U16                   *temporalBufferLeft,
+    EB_U16                   *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth,
+    EB_U32                    eoType)
+{
+    EB_ALIGN(32) EB_U16 filteredRow[2][MAX_LCU_SIZE];
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi16(
+        saoOffsetPtr[0], saoOffsetPtr[1], saoOffsetPtr[2], saoOffsetPtr[3], saoOffsetPtr[4], 0, 0, 0));
+    const __m256i firstSample = _mm256_setr_epi16(-1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    EB_U32 rowCount, colCount;
+
+    for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+        EB_U16 *abovePtr = rowCount ? reconSamplePtr - reconStride : temporalBufferUpper;
+        EB_U16 *filtered = filteredRow[rowCount & 1];
+        EB_U16 *neighbour1;
+        EB_U16 *neighbour2;
+        EB_BOOL patch1 = EB_FALSE;
+        EB_BOOL patch2 = EB_FALSE;
+        EB_U16 patchSample1 = 0;
+        EB_U16 patchSample2 = 0;
+
+        // Column -1 of the picture belongs to the filtered left LCU, so it is taken from the left buffer
+        switch (eoType) {
+        case SAO_EO_0:
+            neighbour1 = reconSamplePtr - 1;
+            neighbour2 = reconSamplePtr + 1;
+            patch1 = EB_TRUE;
+            patchSample1 = temporalBufferLeft[rowCount];
+            break;
+        case SAO_EO_135:
+            neighbour1 = abovePtr - 1;
+            neighbour2 = reconSamplePtr + reconStride + 1;
+            if (rowCount) {
+                patch1 = EB_TRUE;
+                patchSample1 = temporalBufferLeft[rowCount - 1];
+            }
+            break;
+        default:
+            neighbour1 = abovePtr + 1;
+            neighbour2 = reconSamplePtr + reconStride - 1;
+            patch2 = EB_TRUE;
+            patchSample2 = temporalBufferLeft[rowCount + 1];
+            break;
+        }
+
+        for (colCount = 0; colCount < lcuWidth; colCount += 16) {
+            __m256i x0, x1, x2, c1, c2;
+            x0 = _mm256_loadu_si256((__m256i *)(reconSamplePtr + colCount));
+            x1 = _mm256_loadu_si256((__m256i *)(neighbour1 + colCount));
+            x2 = _mm256_loadu_si256((__m256i *)(neighbour2 + colCount));
+            if (colCount == 0) {
+                if (patch1) {
+                    x1 = _mm256_blendv_epi8(x1, _mm256_set1_epi16((short)patchSample1), firstSample);
+                }
+                if (patch2) {
+                    x2 = _mm256_blendv_epi8(x2, _mm256_set1_epi16((short)patchSample2), firstSample);
+                }
+            }
+
+            c1 = _mm256_sub_epi16(_mm256_cmpgt_epi16(x1, x0), _mm256_cmpgt_epi16(x0, x1));
+            c2 = _mm256_sub_epi16(_mm256_cmpgt_epi16(x2, x0), _mm256_cmpgt_epi16(x0, x2));
+            c1 = _mm256_add_epi16(_mm256_add_epi16(c1, c2), _mm256_set1_epi16(2));
+
+            x0 = SaoClip10bit(_mm256_add_epi16(x0, SaoOffsetLookup16bit(c1, offsets)));
+            _mm256_store_si256((__m256i *)(filtered + colCount), x0);
+        }
+
+        // The row above is no longer a neighbour once this row is filtered
+        if (rowCount) {
+            SaoStoreRow16bit(reconSamplePtr - reconStride, filteredRow[(rowCount - 1) & 1], lcuWidth);
+        }
+        reconSamplePtr += reconStride;
+    }
+    SaoStoreRow16bit(reconSamplePtr - reconStride, filteredRow[(lcuHeight - 1) & 1], lcuWidth);
+}
+
+EB_ERRORTYPE SAOApplyEO_0_16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U16                   *temporalBufferLeft,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    SaoApplyEo16bit(reconSamplePtr, reconStride, temporalBufferLeft, (EB_U16 *)EB_NULL, saoOffsetPtr, lcuHeight, lcuWidth, SAO_EO_0);
+    return EB_ErrorNone;
+}
+
+EB_ERRORTYPE SAOApplyEO_90_16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U16                   *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    const __m256i offsets = _mm256_broadcastsi128_si256(_mm_setr_epi16(
+        saoOffsetPtr[0], saoOffsetPtr[1], saoOffsetPtr[2], saoOffsetPtr[3], saoOffsetPtr[4], 0, 0, 0));
+    EB_U32 rowCount, colCount;
+
+    // No horizontal neighbours: filter 16 column strips top down, carrying the unfiltered row above
+    for (colCount = 0; colCount < lcuWidth; colCount += 16) {
+        EB_U16 *ptr = reconSamplePtr + colCount;
+        __m256i x0, x1, x2, c1, c2;
+        x1 = _mm256_loadu_si256((__m256i *)(temporalBufferUpper + colCount));
+        x0 = _mm256_loadu_si256((__m256i *)ptr);
+        for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+            x2 = _mm256_loadu_si256((__m256i *)(ptr + reconStride));
+
+            c1 = _mm256_sub_epi16(_mm256_cmpgt_epi16(x1, x0), _mm256_cmpgt_epi16(x0, x1));
+            c2 = _mm256_sub_epi16(_mm256_cmpgt_epi16(x2, x0), _mm256_cmpgt_epi16(x0, x2));
+            c1 = _mm256_add_epi16(_mm256_add_epi16(c1, c2), _mm256_set1_epi16(2));
+            _mm256_storeu_si256((__m256i *)ptr, SaoClip10bit(_mm256_add_epi16(x0, SaoOffsetLookup16bit(c1, offsets))));
+
+            x1 = x0;
+            x0 = x2;
+            ptr += reconStride;
+        }
+    }
+
+    return EB_ErrorNone;
+}
+
+EB_ERRORTYPE SAOApplyEO_135_16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U16                   *temporalBufferLeft,
+    EB_U16                   *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    SaoApplyEo16bit(reconSamplePtr, reconStride, temporalBufferLeft, temporalBufferUpper, saoOffsetPtr, lcuHeight, lcuWidth, SAO_EO_135);
+    return EB_ErrorNone;
+}
+
+EB_ERRORTYPE SAOApplyEO_45_16bit_AVX2_INTRIN(
+    EB_U16                   *reconSamplePtr,
+    EB_U32                    reconStride,
+    EB_U16                   *temporalBufferLeft,
+    EB_U16                   *temporalBufferUpper,
+    EB_S8                    *saoOffsetPtr,
+    EB_U32                    lcuHeight,
+    EB_U32                    lcuWidth)
+{
+    SaoApplyEo16bit(reconSamplePtr, reconStride, temporalBufferLeft, temporalBufferUpper, saoOffsetPtr, lcuHeight, lcuWidth, SAO_EO_45);
+    return EB_ErrorNone;
+}
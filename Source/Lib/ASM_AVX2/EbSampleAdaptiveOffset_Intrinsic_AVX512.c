@@ -0,0 +1,445 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <immintrin.h>
+#include "EbDefinitions.h"
+#include "EbSampleAdaptiveOffset_AVX512.h"
+
+/*******************************************
+* SAO statistics
+*   One row of 64 (8 bit) or 32 (16 bit)
+*   columns per pass, with the loads masked to
+*   the LCU. The edge category is
+*   sign(x0 - x1) + sign(x0 - x2), each sign
+*   being the difference clamped to [-1, 1].
+*   The band offset histogram is split in four
+*   by column, so that neighbouring samples of
+*   the same band do not wait on each other.
+*******************************************/
+#define SAO_BO_SPLIT    4
+
+AVX512_FUNC_TARGET
+static inline void SaoCountEdge8bit(
+    __m512i    *eoDiff,
+    __m512i    *eoCount,
+    EB_BYTE     ptr,
+    EB_S32      offset,
+    __mmask64   valid,
+    __m512i     x0,
+    __m512i     diff)
+{
+    const __m512i bias = _mm512_set1_epi8(-128);
+    const __m512i one = _mm512_set1_epi8(1);
+    const __m512i minusOne = _mm512_set1_epi8(-1);
+    __m512i x1 = _mm512_xor_si512(_mm512_maskz_loadu_epi8(valid, ptr + offset), bias);
+    __m512i x2 = _mm512_xor_si512(_mm512_maskz_loadu_epi8(valid, ptr - offset), bias);
+    __m512i c1 = _mm512_max_epi8(_mm512_min_epi8(_mm512_subs_epi8(x0, x1), one), minusOne);
+    __m512i c2 = _mm512_max_epi8(_mm512_min_epi8(_mm512_subs_epi8(x0, x2), one), minusOne);
+    __m512i cat = _mm512_add_epi8(c1, c2);
+    __mmask64 select;
+
+    select = _mm512_mask_cmpeq_epi8_mask(valid, cat, _mm512_set1_epi8(-2));
+    eoCount[0] = _mm512_mask_add_epi8(eoCount[0], select, eoCount[0], one);
+    eoDiff[0] = _mm512_add_epi64(eoDiff[0], _mm512_sad_epu8(_mm512_maskz_mov_epi8(select, diff), _mm512_setzero_si512()));
+
+    select = _mm512_mask_cmpeq_epi8_mask(valid, cat, minusOne);
+    eoCount[1] = _mm512_mask_add_epi8(eoCount[1], select, eoCount[1], one);
+    eoDiff[1] = _mm512_add_epi64(eoDiff[1], _mm512_sad_epu8(_mm512_maskz_mov_epi8(select, diff), _mm512_setzero_si512()));
+
+    select = _mm512_mask_cmpeq_epi8_mask(valid, cat, one);
+    eoCount[2] = _mm512_mask_add_epi8(eoCount[2], select, eoCount[2], one);
+    eoDiff[2] = _mm512_add_epi64(eoDiff[2], _mm512_sad_epu8(_mm512_maskz_mov_epi8(select, diff), _mm512_setzero_si512()));
+
+    select = _mm512_mask_cmpeq_epi8_mask(valid, cat, _mm512_set1_epi8(2));
+    eoCount[3] = _mm512_mask_add_epi8(eoCount[3], select, eoCount[3], one);
+    eoDiff[3] = _mm512_add_epi64(eoDiff[3], _mm512_sad_epu8(_mm512_maskz_mov_epi8(select, diff), _mm512_setzero_si512()));
+}
+
+AVX512_FUNC_TARGET
+static inline void GatherSaoStatisticsLcu8bit(
+    EB_U8                   *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U8                   *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                  *boDiff,
+    EB_U16                  *boCount,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_BOOL                  gatherBoEo0)
+{
+    const EB_S32 colCount = lcuWidth - 2;
+    EB_U32 maskedCount = 0;
+    EB_S32 column;
+    EB_U32 rowCount;
+    EB_S32 i, j;
+    EB_S32 firstType = gatherBoEo0 ? 0 : 1;
+
+    __m512i eoDiffX[SAO_EO_TYPES][SAO_EO_CATEGORIES];
+    __m512i eoCountX[SAO_EO_TYPES][SAO_EO_CATEGORIES];
+    EB_ALIGN(64) EB_U8 catArray[64];
+    EB_ALIGN(64) EB_S8 diffArray[64];
+    EB_U32 boCountX[SAO_BO_SPLIT][SAO_BO_INTERVALS];
+    EB_S32 boDiffX[SAO_BO_SPLIT][SAO_BO_INTERVALS];
+
+    lcuHeight -= 2;
+    inputSamplePtr += inputStride + 1;
+    reconSamplePtr += reconStride + 1;
+
+    if (gatherBoEo0) {
+        EB_MEMSET(boCountX, 0, sizeof(boCountX));
+        EB_MEMSET(boDiffX, 0, sizeof(boDiffX));
+    }
+
+    for (i = firstType; i < SAO_EO_TYPES; i++) {
+        for (j = 0; j < SAO_EO_CATEGORIES; j++) {
+            eoDiffX[i][j] = _mm512_setzero_si512();
+            eoCountX[i][j] = _mm512_setzero_si512();
+        }
+    }
+
+    for (column = 0; column < colCount; column += 64) {
+        const EB_S32 width = colCount - column < 64 ? colCount - column : 64;
+        const EB_S32 boWidth = (width + SAO_BO_SPLIT - 1) & ~(SAO_BO_SPLIT - 1);
+        const __mmask64 valid = width == 64 ? ~(__mmask64)0 : ((__mmask64)1 << width) - 1;
+        EB_BYTE ptr = reconSamplePtr + column;
+
+        maskedCount += (boWidth - width) * lcuHeight;
+        EB_BYTE qtr = inputSamplePtr + column;
+
+        for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+            __m512i x0, y0;
+            __m512i diff;
+
+            x0 = _mm512_maskz_loadu_epi8(valid, ptr);
+            y0 = _mm512_maskz_loadu_epi8(valid, qtr);
+
+            if (gatherBoEo0) {
+                _mm512_store_si512((__m512i *)catArray, _mm512_and_si512(_mm512_srli_epi16(x0, 3), _mm512_set1_epi8(0x1F)));
+            }
+
+            // Signed difference clipped to 8 bits, as the SSE2 kernels do
+            x0 = _mm512_xor_si512(x0, _mm512_set1_epi8(-128));
+            y0 = _mm512_xor_si512(y0, _mm512_set1_epi8(-128));
+            diff = _mm512_subs_epi8(y0, x0);
+
+            if (gatherBoEo0) {
+                EB_S32 k;
+                _mm512_store_si512((__m512i *)diffArray, diff);
+
+                // Masked columns up to boWidth land in band 0 with a zero diff and are taken out below
+                for (k = 0; k < boWidth; k += SAO_BO_SPLIT) {
+                    boCountX[0][catArray[k]]++;
+                    boDiffX[0][catArray[k]] += diffArray[k];
+                    boCountX[1][catArray[k + 1]]++;
+                    boDiffX[1][catArray[k + 1]] += diffArray[k + 1];
+                    boCountX[2][catArray[k + 2]]++;
+                    boDiffX[2][catArray[k + 2]] += diffArray[k + 2];
+                    boCountX[3][catArray[k + 3]]++;
+                    boDiffX[3][catArray[k + 3]] += diffArray[k + 3];
+                }
+            }
+
+            // Edge offset, with the difference biased by 128 for _mm512_sad_epu8
+            diff = _mm512_xor_si512(diff, _mm512_set1_epi8(-128));
+
+            if (gatherBoEo0) {
+                SaoCountEdge8bit(eoDiffX[0], eoCountX[0], ptr, 1, valid, x0, diff);
+            }
+            SaoCountEdge8bit(eoDiffX[1], eoCountX[1], ptr, reconStride, valid, x0, diff);
+            SaoCountEdge8bit(eoDiffX[2], eoCountX[2], ptr, reconStride + 1, valid, x0, diff);
+            SaoCountEdge8bit(eoDiffX[3], eoCountX[3], ptr, reconStride - 1, valid, x0, diff);
+
+            ptr += reconStride;
+            qtr += inputStride;
+        }
+    }
+
+    if (gatherBoEo0) {
+        for (i = 0; i < SAO_BO_INTERVALS; i++) {
+            boCount[i] = (EB_U16)(boCountX[0][i] + boCountX[1][i] + boCountX[2][i] + boCountX[3][i]);
+            boDiff[i] = boDiffX[0][i] + boDiffX[1][i] + boDiffX[2][i] + boDiffX[3][i];
+        }
+        boCount[0] -= (EB_U16)maskedCount;
+    }
+
+    for (i = firstType; i < SAO_EO_TYPES; i++) {
+        for (j = 0; j < SAO_EO_CATEGORIES; j++) {
+            // Note: per byte counts stay below 2 * 62
+            EB_U32 count = (EB_U32)_mm512_reduce_add_epi64(_mm512_sad_epu8(eoCountX[i][j], _mm512_setzero_si512()));
+            eoCount[i][j] = (EB_U16)count;
+            eoDiff[i][j] = (EB_S32)((EB_U32)_mm512_reduce_add_epi64(eoDiffX[i][j]) - 128 * count);
+        }
+    }
+}
+
+// Rows whose 10 bit differences fit the 16 bit edge offset sums
+#define SAO_DIFF_ROWS_16BIT     32
+
+AVX512_FUNC_TARGET
+static inline void SaoCountEdge16bit(
+    __m512i    *eoDiff,
+    __m512i    *eoCount,
+    EB_U16     *ptr,
+    EB_S32      offset,
+    __mmask32   valid,
+    __m512i     x0,
+    __m512i     diff)
+{
+    const __m512i one = _mm512_set1_epi16(1);
+    const __m512i minusOne = _mm512_set1_epi16(-1);
+    __m512i x1 = _mm512_maskz_loadu_epi16(valid, ptr + offset);
+    __m512i x2 = _mm512_maskz_loadu_epi16(valid, ptr - offset);
+    __m512i c1 = _mm512_max_epi16(_mm512_min_epi16(_mm512_sub_epi16(x0, x1), one), minusOne);
+    __m512i c2 = _mm512_max_epi16(_mm512_min_epi16(_mm512_sub_epi16(x0, x2), one), minusOne);
+    __m512i cat = _mm512_add_epi16(c1, c2);
+    __mmask32 select;
+
+    select = _mm512_mask_cmpeq_epi16_mask(valid, cat, _mm512_set1_epi16(-2));
+    eoCount[0] = _mm512_mask_add_epi16(eoCount[0], select, eoCount[0], one);
+    eoDiff[0] = _mm512_mask_add_epi16(eoDiff[0], select, eoDiff[0], diff);
+
+    select = _mm512_mask_cmpeq_epi16_mask(valid, cat, minusOne);
+    eoCount[1] = _mm512_mask_add_epi16(eoCount[1], select, eoCount[1], one);
+    eoDiff[1] = _mm512_mask_add_epi16(eoDiff[1], select, eoDiff[1], diff);
+
+    select = _mm512_mask_cmpeq_epi16_mask(valid, cat, one);
+    eoCount[2] = _mm512_mask_add_epi16(eoCount[2], select, eoCount[2], one);
+    eoDiff[2] = _mm512_mask_add_epi16(eoDiff[2], select, eoDiff[2], diff);
+
+    select = _mm512_mask_cmpeq_epi16_mask(valid, cat, _mm512_set1_epi16(2));
+    eoCount[3] = _mm512_mask_add_epi16(eoCount[3], select, eoCount[3], one);
+    eoDiff[3] = _mm512_mask_add_epi16(eoDiff[3], select, eoDiff[3], diff);
+}
+
+AVX512_FUNC_TARGET
+static inline void GatherSaoStatisticsLcu16bit(
+    EB_U16                  *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U16                  *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                  *boDiff,
+    EB_U16                  *boCount,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_BOOL                  gatherBoEo0)
+{
+    const EB_S32 colCount = lcuWidth - 2;
+    EB_U32 maskedCount = 0;
+    EB_S32 column;
+    EB_U32 rowCount;
+    EB_S32 i, j;
+    EB_S32 firstType = gatherBoEo0 ? 0 : 1;
+
+    __m512i eoDiffX[SAO_EO_TYPES][SAO_EO_CATEGORIES];
+    __m512i eoDiffRowsX[SAO_EO_TYPES][SAO_EO_CATEGORIES];
+    __m512i eoCountX[SAO_EO_TYPES][SAO_EO_CATEGORIES];
+    EB_ALIGN(64) EB_U16 catArray[32];
+    EB_ALIGN(64) EB_S16 diffArray[32];
+    EB_U32 boCountX[SAO_BO_SPLIT][SAO_BO_INTERVALS];
+    EB_S32 boDiffX[SAO_BO_SPLIT][SAO_BO_INTERVALS];
+
+    lcuHeight -= 2;
+    inputSamplePtr += inputStride + 1;
+    reconSamplePtr += reconStride + 1;
+
+    if (gatherBoEo0) {
+        EB_MEMSET(boCountX, 0, sizeof(boCountX));
+        EB_MEMSET(boDiffX, 0, sizeof(boDiffX));
+    }
+
+    for (i = firstType; i < SAO_EO_TYPES; i++) {
+        for (j = 0; j < SAO_EO_CATEGORIES; j++) {
+            eoDiffX[i][j] = _mm512_setzero_si512();
+            eoDiffRowsX[i][j] = _mm512_setzero_si512();
+            eoCountX[i][j] = _mm512_setzero_si512();
+        }
+    }
+
+    for (column = 0; column < colCount; column += 32) {
+        const EB_S32 width = colCount - column < 32 ? colCount - column : 32;
+        const EB_S32 boWidth = (width + SAO_BO_SPLIT - 1) & ~(SAO_BO_SPLIT - 1);
+        const __mmask32 valid = (__mmask32)(((EB_U64)1 << width) - 1);
+        EB_U16 *ptr = reconSamplePtr + column;
+
+        maskedCount += (boWidth - width) * lcuHeight;
+        EB_U16 *qtr = inputSamplePtr + column;
+
+        for (rowCount = 0; rowCount < lcuHeight; ++rowCount) {
+            __m512i x0, y0;
+            __m512i diff;
+
+            x0 = _mm512_maskz_loadu_epi16(valid, ptr);
+            y0 = _mm512_maskz_loadu_epi16(valid, qtr);
+            diff = _mm512_sub_epi16(y0, x0);
+
+            if (gatherBoEo0) {
+                EB_S32 k;
+                _mm512_store_si512((__m512i *)catArray, _mm512_srli_epi16(x0, 5));
+                _mm512_store_si512((__m512i *)diffArray, diff);
+
+                // Masked columns up to boWidth land in band 0 with a zero diff and are taken out below
+                for (k = 0; k < boWidth; k += SAO_BO_SPLIT) {
+                    boCountX[0][catArray[k]]++;
+                    boDiffX[0][catArray[k]] += diffArray[k];
+                    boCountX[1][catArray[k + 1]]++;
+                    boDiffX[1][catArray[k + 1]] += diffArray[k + 1];
+                    boCountX[2][catArray[k + 2]]++;
+                    boDiffX[2][catArray[k + 2]] += diffArray[k + 2];
+                    boCountX[3][catArray[k + 3]]++;
+                    boDiffX[3][catArray[k + 3]] += diffArray[k + 3];
+                }
+
+                SaoCountEdge16bit(eoDiffRowsX[0], eoCountX[0], ptr, 1, valid, x0, diff);
+            }
+            SaoCountEdge16bit(eoDiffRowsX[1], eoCountX[1], ptr, reconStride, valid, x0, diff);
+            SaoCountEdge16bit(eoDiffRowsX[2], eoCountX[2], ptr, reconStride + 1, valid, x0, diff);
+            SaoCountEdge16bit(eoDiffRowsX[3], eoCountX[3], ptr, reconStride - 1, valid, x0, diff);
+
+            // Widens the 16 bit sums before they can overflow
+            if ((rowCount + 1) % SAO_DIFF_ROWS_16BIT == 0 || rowCount + 1 == lcuHeight) {
+                for (i = firstType; i < SAO_EO_TYPES; i++) {
+                    for (j = 0; j < SAO_EO_CATEGORIES; j++) {
+                        eoDiffX[i][j] = _mm512_add_epi32(eoDiffX[i][j], _mm512_madd_epi16(eoDiffRowsX[i][j], _mm512_set1_epi16(1)));
+                        eoDiffRowsX[i][j] = _mm512_setzero_si512();
+                    }
+                }
+            }
+
+            ptr += reconStride;
+            qtr += inputStride;
+        }
+    }
+
+    if (gatherBoEo0) {
+        for (i = 0; i < SAO_BO_INTERVALS; i++) {
+            boCount[i] = (EB_U16)(boCountX[0][i] + boCountX[1][i] + boCountX[2][i] + boCountX[3][i]);
+            boDiff[i] = boDiffX[0][i] + boDiffX[1][i] + boDiffX[2][i] + boDiffX[3][i];
+        }
+        boCount[0] -= (EB_U16)maskedCount;
+    }
+
+    for (i = firstType; i < SAO_EO_TYPES; i++) {
+        for (j = 0; j < SAO_EO_CATEGORIES; j++) {
+            eoCount[i][j] = (EB_U16)_mm512_reduce_add_epi32(_mm512_madd_epi16(eoCountX[i][j], _mm512_set1_epi16(1)));
+            eoDiff[i][j] = _mm512_reduce_add_epi32(eoDiffX[i][j]);
+        }
+    }
+}
+
+AVX512_FUNC_TARGET
+EB_ERRORTYPE GatherSaoStatisticsLcu_BT_AVX512(
+    EB_U8                   *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U8                   *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                  *boDiff,
+    EB_U16                  *boCount,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1])
+{
+    GatherSaoStatisticsLcu8bit(
+        inputSamplePtr,
+        inputStride,
+        reconSamplePtr,
+        reconStride,
+        lcuWidth,
+        lcuHeight,
+        boDiff,
+        boCount,
+        eoDiff,
+        eoCount,
+        EB_TRUE);
+
+    return EB_ErrorNone;
+}
+
+AVX512_FUNC_TARGET
+EB_ERRORTYPE GatherSaoStatisticsLcu_OnlyEo_90_45_135_BT_AVX512(
+    EB_U8                   *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U8                   *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1])
+{
+    GatherSaoStatisticsLcu8bit(
+        inputSamplePtr,
+        inputStride,
+        reconSamplePtr,
+        reconStride,
+        lcuWidth,
+        lcuHeight,
+        (EB_S32 *)EB_NULL,
+        (EB_U16 *)EB_NULL,
+        eoDiff,
+        eoCount,
+        EB_FALSE);
+
+    return EB_ErrorNone;
+}
+
+AVX512_FUNC_TARGET
+EB_ERRORTYPE GatherSaoStatisticsLcu16bit_AVX512_INTRIN(
+    EB_U16                  *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U16                  *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                  *boDiff,
+    EB_U16                  *boCount,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1])
+{
+    GatherSaoStatisticsLcu16bit(
+        inputSamplePtr,
+        inputStride,
+        reconSamplePtr,
+        reconStride,
+        lcuWidth,
+        lcuHeight,
+        boDiff,
+        boCount,
+        eoDiff,
+        eoCount,
+        EB_TRUE);
+
+    return EB_ErrorNone;
+}
+
+AVX512_FUNC_TARGET
+EB_ERRORTYPE GatherSaoStatisticsLcu_OnlyEo_90_45_135_16bit_AVX512_INTRIN(
+    EB_U16                  *inputSamplePtr,
+    EB_U32                   inputStride,
+    EB_U16                  *reconSamplePtr,
+    EB_U32                   reconStride,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight,
+    EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],
+    EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1])
+{
+    GatherSaoStatisticsLcu16bit(
+        inputSamplePtr,
+        inputStride,
+        reconSamplePtr,
+        reconStride,
+        lcuWidth,
+        lcuHeight,
+        (EB_S32 *)EB_NULL,
+        (EB_U16 *)EB_NULL,
+        eoDiff,
+        eoCount,
+        EB_FALSE);
+
+    return EB_ErrorNone;
+}
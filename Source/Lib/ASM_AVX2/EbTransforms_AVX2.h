@@ -103,6 +103,145 @@ void MatMultNxN_AVX2_INTRIN(
 	EB_U32*              nonzerocoeff);
 
 
+void InvTransform32x32_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransform16x16_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransform8x8_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransform4x4_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvDstTransform4x4_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_S16                  *residual,
+    const EB_U32             dstStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransformRecon32x32_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransformRecon16x16_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransformRecon8x8_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransformRecon4x4_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvDstTransformRecon4x4_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransformRecon32x32_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransformRecon16x16_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransformRecon8x8_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvTransformRecon4x4_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
+
+void InvDstTransformRecon4x4_16bit_AVX2_INTRIN(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
 #ifdef __cplusplus
 }
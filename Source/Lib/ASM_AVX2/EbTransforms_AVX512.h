@@ -0,0 +1,32 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbTransforms_AVX512_h
+#define EbTransforms_AVX512_h
+
+#include "EbDefinitions.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void QuantizeInvQuantizeNxN_AVX512_INTRIN(
+	EB_S16          *coeff,
+	const EB_U32     coeffStride,
+	EB_S16          *quantCoeff,
+	EB_S16          *reconCoeff,
+	const EB_U32     qFunc,
+	const EB_U32     q_offset,
+	const EB_S32     shiftedQBits,
+	const EB_S32     shiftedFFunc,
+	const EB_S32     iq_offset,
+	const EB_S32     shiftNum,
+	const EB_U32     areaSize,
+	EB_U32          *nonzerocoeff);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbTransforms_AVX512_h
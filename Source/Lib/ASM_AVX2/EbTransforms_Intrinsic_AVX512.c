@@ -0,0 +1,90 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include "EbTransforms_AVX512.h"
+
+#include <immintrin.h>
+
+/*******************************************************************************
+* Requirement: areaSize = 16 or 32
+* Same result as QuantizeInvQuantizeNxN_AVX2_INTRIN, 32 coefficients per zmm
+* (two rows of a 16x16, one row of a 32x32).
+*******************************************************************************/
+AVX512_FUNC_TARGET
+void QuantizeInvQuantizeNxN_AVX512_INTRIN(
+    EB_S16          *coeff,
+    const EB_U32     coeffStride,
+    EB_S16          *quantCoeff,
+    EB_S16          *reconCoeff,
+    const EB_U32     qFunc,
+    const EB_U32     q_offset,
+    const EB_S32     shiftedQBits,
+    const EB_S32     shiftedFFunc,
+    const EB_S32     iq_offset,
+    const EB_S32     shiftNum,
+    const EB_U32     areaSize,
+    EB_U32          *nonzerocoeff)
+{
+    EB_U32 row;
+    const EB_U32 rowsPerVector = (areaSize == 16) ? 2 : 1;
+    const EB_U32 secondOffset = (areaSize == 16) ? coeffStride : 16;
+    __m512i zero = _mm512_setzero_si512();
+    __m512i q = _mm512_set1_epi16((EB_S16)qFunc);
+    __m512i o = _mm512_set1_epi32(q_offset);
+    __m128i s = _mm_cvtsi32_si128(shiftedQBits);
+    __m512i iq = _mm512_set1_epi16((EB_S16)shiftedFFunc);
+    __m512i io = _mm512_set1_epi32(iq_offset);
+    __m128i is = _mm_cvtsi32_si128(shiftNum);
+    __m512i count = _mm512_setzero_si512();
+
+    for (row = 0; row < areaSize; row += rowsPerVector) {
+        EB_U32 offset = coeffStride * row;
+        EB_U32 col;
+
+        for (col = 0; col < areaSize; col += 32 / rowsPerVector) {
+            __m512i a0, a1, b0, b1, x, y;
+            __mmask32 nonZero;
+
+            // 16 coefficients from each of the two halves
+            y = _mm512_castsi256_si512(_mm256_loadu_si256((__m256i*)(coeff + offset + col)));
+            y = _mm512_inserti64x4(y, _mm256_loadu_si256((__m256i*)(coeff + offset + col + secondOffset)), 1);
+
+            x = _mm512_abs_epi16(y);
+            a0 = _mm512_mullo_epi16(x, q);
+            a1 = _mm512_mulhi_epi16(x, q);
+            b0 = _mm512_unpacklo_epi16(a0, a1);
+            b1 = _mm512_unpackhi_epi16(a0, a1);
+            b0 = _mm512_sra_epi32(_mm512_add_epi32(b0, o), s);
+            b1 = _mm512_sra_epi32(_mm512_add_epi32(b1, o), s);
+            x = _mm512_packs_epi32(b0, b1);
+            count = _mm512_sub_epi16(count, _mm512_movm_epi16(_mm512_cmpgt_epi16_mask(x, zero)));
+
+            // _mm256_sign_epi16(x, y)
+            x = _mm512_maskz_mov_epi16(_mm512_test_epi16_mask(y, y), x);
+            x = _mm512_mask_sub_epi16(x, _mm512_movepi16_mask(y), zero, x);
+
+            _mm256_storeu_si256((__m256i*)(quantCoeff + offset + col), _mm512_castsi512_si256(x));
+            _mm256_storeu_si256((__m256i*)(quantCoeff + offset + col + secondOffset), _mm512_extracti64x4_epi64(x, 1));
+
+            nonZero = _mm512_test_epi16_mask(x, x);
+            if (nonZero) {
+                // the AVX2 kernel skips 16-wide runs that quantized to zero
+                a0 = _mm512_mullo_epi16(x, iq);
+                a1 = _mm512_mulhi_epi16(x, iq);
+                b0 = _mm512_unpacklo_epi16(a0, a1);
+                b1 = _mm512_unpackhi_epi16(a0, a1);
+                b0 = _mm512_sra_epi32(_mm512_add_epi32(b0, io), is);
+                b1 = _mm512_sra_epi32(_mm512_add_epi32(b1, io), is);
+                x = _mm512_packs_epi32(b0, b1);
+                x = _mm512_mask_mov_epi16(zero, ((nonZero & 0xFFFF) ? 0xFFFF : 0) | ((nonZero >> 16) ? 0xFFFF0000 : 0), x);
+            }
+
+            _mm256_storeu_si256((__m256i*)(reconCoeff + offset + col), _mm512_castsi512_si256(x));
+            _mm256_storeu_si256((__m256i*)(reconCoeff + offset + col + secondOffset), _mm512_extracti64x4_epi64(x, 1));
+        }
+    }
+
+    *nonzerocoeff = (EB_U32)_mm512_reduce_add_epi32(_mm512_madd_epi16(count, _mm512_set1_epi16(1)));
+}
@@ -78,6 +78,20 @@ EB_U64 ComputeSubMean8x8_SSE2_INTRIN(
 
 
 
+void ComputeIntermVarFour8x8_SSE2_INTRIN(
+    EB_U8 *  inputSamples,      // input parameter, input samples Ptr
+    EB_U16   inputStride,       // input parameter, input stride
+    EB_U64 * meanOf8x8Blocks,   // output parameter, mean of four 8x8
+    EB_U64 * meanOfSquared8x8Blocks) // output parameter, mean of squared values of four 8x8
+{
+    EB_U32 blockIndex;
+
+    for (blockIndex = 0; blockIndex < 4; blockIndex++) {
+        meanOf8x8Blocks[blockIndex] = ComputeSubMean8x8_SSE2_INTRIN(inputSamples + (blockIndex << 3), inputStride);
+        meanOfSquared8x8Blocks[blockIndex] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(inputSamples + (blockIndex << 3), inputStride);
+    }
+}
+
 EB_U64 ComputeMeanOfSquaredValues8x8_SSE2_INTRIN(
     EB_U8 *  inputSamples,      // input parameter, input samples Ptr
     EB_U32   inputStride,       // input parameter, input stride
@@ -18,6 +18,12 @@ EB_U64 ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(
 	EB_U8 *  inputSamples,      // input parameter, input samples Ptr
 	EB_U16   inputStride);
 
+void ComputeIntermVarFour8x8_SSE2_INTRIN(
+    EB_U8 *  inputSamples,      // input parameter, input samples Ptr
+    EB_U16   inputStride,       // input parameter, input stride
+    EB_U64 * meanOf8x8Blocks,   // output parameter, mean of four 8x8
+    EB_U64 * meanOfSquared8x8Blocks); // output parameter, mean of squared values of four 8x8
+
 EB_U64 ComputeMeanOfSquaredValues8x8_SSE2_INTRIN(
     EB_U8 *  inputSamples,      // input parameter, input samples Ptr
     EB_U32   inputStride,       // input parameter, input stride
@@ -571,7 +571,6 @@ void IntraModeHorizontalChroma_SSE2_INTRIN(
 #if 1
             __m128i left0_14_even, left0_6_even, left8_14_even, left8_10, left12_14, left02, left46, skip_mask;
             skip_mask = _mm_set1_epi16(0x00FF);
-            pStride <<= 1;
             MACRO_HORIZONTAL_LUMA_32X16(0)
             predictionPtr += (pStride << 2);
             MACRO_HORIZONTAL_LUMA_32X16(16)
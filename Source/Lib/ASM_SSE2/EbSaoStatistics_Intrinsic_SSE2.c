@@ -177,6 +177,9 @@ EB_EXTERN EB_ERRORTYPE GatherSaoStatisticsLcu_BT_SSE2(
         colCount -= 16;
     } while (colCount > 0);
 
+    // Masked columns of the last chunk were counted in band 0
+    boCount[0] -= (EB_U16)(-colCount * lcuHeight);
+
     for (i = 0; i < SAO_EO_TYPES; i++)
     {
         for (j = 0; j < SAO_EO_CATEGORIES; j++)
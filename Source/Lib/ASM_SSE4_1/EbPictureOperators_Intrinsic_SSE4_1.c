@@ -513,8 +513,7 @@ EB_U64 SpatialFullDistortionKernel4x4_SSSE3_INTRIN(
         y0 = _mm_setr_epi32(*((EB_U32 *)recon), 0, 0, 0);
         input += inputStride;
         recon += reconStride;
-        x0 = _mm_sub_epi8(x0, y0);
-        x0 = _mm_sign_epi8(x0, x0);
+        x0 = _mm_or_si128(_mm_subs_epu8(x0, y0), _mm_subs_epu8(y0, x0));
         x0 = _mm_unpacklo_epi8(x0, _mm_setzero_si128());
         x0 = _mm_madd_epi16(x0, x0);
         sum = _mm_add_epi32(sum, x0);
@@ -550,8 +549,7 @@ EB_U64 SpatialFullDistortionKernel8x8_SSSE3_INTRIN(
         y0 = _mm_loadl_epi64((__m128i *)(recon + 0x00));
         input += inputStride;
         recon += reconStride;
-        x0 = _mm_sub_epi8(x0, y0);
-        x0 = _mm_sign_epi8(x0, x0);
+        x0 = _mm_or_si128(_mm_subs_epu8(x0, y0), _mm_subs_epu8(y0, x0));
         x0 = _mm_unpacklo_epi8(x0, _mm_setzero_si128());
         x0 = _mm_madd_epi16(x0, x0);
         sum = _mm_add_epi32(sum, x0);
@@ -594,8 +592,7 @@ EB_U64 SpatialFullDistortionKernel16MxN_SSSE3_INTRIN(
             y0 = _mm_loadu_si128((__m128i *)(reconCoeffTemp + 0x00));
             coeffTemp += inputStride;
             reconCoeffTemp += reconStride;
-            x0 = _mm_sub_epi8(x0, y0);
-            x0 = _mm_sign_epi8(x0, x0);
+            x0 = _mm_or_si128(_mm_subs_epu8(x0, y0), _mm_subs_epu8(y0, x0));
 
             x0_L = _mm_unpacklo_epi8(x0, _mm_setzero_si128());
             x0_H = _mm_unpackhi_epi8(x0, _mm_setzero_si128());
@@ -12,6 +12,8 @@
 extern "C" {
 #endif
 
+extern const EB_S8 AvcStyleLumaIFCoeff8_SSSE3[];
+
 void AvcStyleLumaInterpolationFilterHorizontal_SSSE3_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_BYTE tempBuf,  EB_U32 fracPos);
 void AvcStyleLumaInterpolationFilterVertical_SSSE3_INTRIN(EB_BYTE refPic, EB_U32 srcStride, EB_BYTE dst, EB_U32 dstStride, EB_U32 puWidth, EB_U32 puHeight, EB_BYTE tempBuf,  EB_U32 fracPos);
 #ifdef __cplusplus
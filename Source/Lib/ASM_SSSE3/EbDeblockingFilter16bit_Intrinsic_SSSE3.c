@@ -455,3 +455,17 @@ EB_EXTERN void Luma4SampleEdgeDLFCore16bit_SSSE3_INTRIN(
         }
     }
 }
+
+// Two adjacent 4 sample edges, for the dispatch slot shared with the AVX2 kernel
+EB_EXTERN void Luma8SampleEdgeDLFCore16bit_SSSE3_INTRIN(
+    EB_U16         *edgeStartFilteredSamplePtr,
+    EB_U32          reconLumaPicStride,
+    EB_BOOL         isVerticalEdge,
+    EB_S32          tc0,
+    EB_S32          beta0,
+    EB_S32          tc1,
+    EB_S32          beta1)
+{
+    Luma4SampleEdgeDLFCore16bit_SSSE3_INTRIN(edgeStartFilteredSamplePtr, reconLumaPicStride, isVerticalEdge, tc0, beta0);
+    Luma4SampleEdgeDLFCore16bit_SSSE3_INTRIN(edgeStartFilteredSamplePtr + (isVerticalEdge ? (reconLumaPicStride << 2) : 4), reconLumaPicStride, isVerticalEdge, tc1, beta1);
+}
@@ -239,6 +239,20 @@ EB_EXTERN void Luma4SampleEdgeDLFCore_SSSE3(
 
 }
 
+// Two adjacent 4 sample edges, for the dispatch slot shared with the AVX2 kernel
+EB_EXTERN void Luma8SampleEdgeDLFCore_SSSE3(
+	EB_U8                 *edgeStartSample,
+	EB_U32                 reconLumaPicStride,
+	EB_BOOL                isVerticalEdge,
+	EB_S32                 tc0,
+	EB_S32                 beta0,
+	EB_S32                 tc1,
+	EB_S32                 beta1)
+{
+  Luma4SampleEdgeDLFCore_SSSE3(edgeStartSample, reconLumaPicStride, isVerticalEdge, tc0, beta0);
+  Luma4SampleEdgeDLFCore_SSSE3(edgeStartSample + (isVerticalEdge ? (reconLumaPicStride << 2) : 4), reconLumaPicStride, isVerticalEdge, tc1, beta1);
+}
+
 EB_EXTERN void Chroma2SampleEdgeDLFCore_SSSE3(
 	EB_BYTE                edgeStartSampleCb,
 	EB_BYTE                edgeStartSampleCr,
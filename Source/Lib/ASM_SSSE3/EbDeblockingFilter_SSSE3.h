@@ -33,6 +33,24 @@ void Luma4SampleEdgeDLFCore16bit_SSSE3_INTRIN(
     EB_S32          tc,                     
     EB_S32          beta); 
 
+void Luma8SampleEdgeDLFCore_SSSE3(
+    EB_BYTE                edgeStartSample,
+    EB_U32                 reconLumaPicStride,
+    EB_BOOL                isVerticalEdge,
+    EB_S32                 tc0,
+    EB_S32                 beta0,
+    EB_S32                 tc1,
+    EB_S32                 beta1);
+
+void Luma8SampleEdgeDLFCore16bit_SSSE3_INTRIN(
+    EB_U16         *edgeStartFilteredSamplePtr,
+    EB_U32          reconLumaPicStride,
+    EB_BOOL         isVerticalEdge,
+    EB_S32          tc0,
+    EB_S32          beta0,
+    EB_S32          tc1,
+    EB_S32          beta1);
+
 #ifdef __cplusplus
 }
 #endif
@@ -123,6 +123,38 @@ EB_U64 ComputeSubMean8x8(
     return blockMean;
 }
 
+/*******************************************
+* ComputeIntermVarFour8x8
+*   returns the mean and the mean of squared
+*   values of four horizontally adjacent 8x8
+*   blocks, from their even rows
+*******************************************/
+void ComputeIntermVarFour8x8(
+    EB_U8 *  inputSamples,              // input parameter, input samples Ptr
+    EB_U16   inputStride,               // input parameter, input stride
+    EB_U64 * meanOf8x8Blocks,           // output parameter, mean of the four 8x8 blocks
+    EB_U64 * meanOfSquared8x8Blocks)    // output parameter, mean of squared values of the four 8x8 blocks
+{
+    EB_U32 blockIndex;
+    EB_U32 horizontalIndex;
+    EB_U32 verticalIndex;
 
+    for (blockIndex = 0; blockIndex < 4; blockIndex++) {
+        EB_U8 *blockSamples = inputSamples + (blockIndex << 3);
+        EB_U64 blockMean = 0;
+        EB_U64 blockMeanSquared = 0;
 
+        for (verticalIndex = 0; verticalIndex < 8; verticalIndex += 2) {
+            for (horizontalIndex = 0; horizontalIndex < 8; horizontalIndex++) {
 
+                blockMean += blockSamples[horizontalIndex];
+                blockMeanSquared += blockSamples[horizontalIndex] * blockSamples[horizontalIndex];
+
+            }
+            blockSamples += 2 * inputStride;
+        }
+
+        meanOf8x8Blocks[blockIndex] = blockMean << 3;
+        meanOfSquared8x8Blocks[blockIndex] = blockMeanSquared << 11;
+    }
+}
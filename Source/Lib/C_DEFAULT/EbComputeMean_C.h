@@ -23,6 +23,12 @@ EB_U64 ComputeMeanOfSquaredValues(
     EB_U32   inputAreaWidth,    // input parameter, input area width
     EB_U32   inputAreaHeight);   // input parameter, input area height
 
+void ComputeIntermVarFour8x8(
+    EB_U8 *  inputSamples,      // input parameter, input samples Ptr
+    EB_U16   inputStride,       // input parameter, input stride
+    EB_U64 * meanOf8x8Blocks,   // output parameter, mean of four 8x8
+    EB_U64 * meanOfSquared8x8Blocks); // output parameter, mean of squared values of four 8x8
+
 #ifdef __cplusplus
 }
 #endif
@@ -575,3 +575,57 @@ void Chroma2SampleEdgeDLFCore16bit(
 
     return;
 }
+
+/** Luma8SampleEdgeDLFCore()
+filters two adjacent 4 sample luma edges lying on the same 8 sample
+edge, the second one starting 4 samples after edgeStartSample along the
+edge. Each 4 sample edge takes its own tc and beta; beta 0 leaves it
+untouched.
+*/
+void Luma8SampleEdgeDLFCore(
+    EB_BYTE                edgeStartSample,
+    EB_U32                 reconLumaPicStride,
+    EB_BOOL                isVerticalEdge,
+    EB_S32                 tc0,
+    EB_S32                 beta0,
+    EB_S32                 tc1,
+    EB_S32                 beta1)
+{
+    Luma4SampleEdgeDLFCore(
+        edgeStartSample,
+        reconLumaPicStride,
+        isVerticalEdge,
+        tc0,
+        beta0);
+
+    Luma4SampleEdgeDLFCore(
+        edgeStartSample + (isVerticalEdge ? (reconLumaPicStride << 2) : 4),
+        reconLumaPicStride,
+        isVerticalEdge,
+        tc1,
+        beta1);
+}
+
+void Luma8SampleEdgeDLFCore16bit(
+    EB_U16         *edgeStartFilteredSamplePtr,
+    EB_U32          reconLumaPicStride,
+    EB_BOOL         isVerticalEdge,
+    EB_S32          tc0,
+    EB_S32          beta0,
+    EB_S32          tc1,
+    EB_S32          beta1)
+{
+    Luma4SampleEdgeDLFCore16bit(
+        edgeStartFilteredSamplePtr,
+        reconLumaPicStride,
+        isVerticalEdge,
+        tc0,
+        beta0);
+
+    Luma4SampleEdgeDLFCore16bit(
+        edgeStartFilteredSamplePtr + (isVerticalEdge ? (reconLumaPicStride << 2) : 4),
+        reconLumaPicStride,
+        isVerticalEdge,
+        tc1,
+        beta1);
+}
@@ -29,6 +29,24 @@ void Luma4SampleEdgeDLFCore16bit(
     EB_S32          tc,
     EB_S32          beta);
 
+void Luma8SampleEdgeDLFCore(
+    EB_BYTE                edgeStartSample,
+    EB_U32                 reconLumaPicStride,
+    EB_BOOL                isVerticalEdge,
+    EB_S32                 tc0,
+    EB_S32                 beta0,
+    EB_S32                 tc1,
+    EB_S32                 beta1);
+
+void Luma8SampleEdgeDLFCore16bit(
+    EB_U16         *edgeStartFilteredSamplePtr,
+    EB_U32          reconLumaPicStride,
+    EB_BOOL         isVerticalEdge,
+    EB_S32          tc0,
+    EB_S32          beta0,
+    EB_S32          tc1,
+    EB_S32          beta1);
+
 void Chroma2SampleEdgeDLFCore(
     EB_BYTE                edgeStartSampleCb,
     EB_BYTE                edgeStartSampleCr,
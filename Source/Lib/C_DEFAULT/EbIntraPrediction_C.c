@@ -1049,4 +1049,21 @@ void IntraModeAngular16bit_Horizontal_Kernel(
         }
         predictionPtr++;
     }
-}
\ No newline at end of file
+}
+/** IntraFilterReferenceSamples16bit()
+is used to apply the [1 2 1] smoothing filter to the 16bit reference samples,
+the first and last samples are copied
+*/
+void IntraFilterReferenceSamples16bit(
+    const EB_U16   *srcPtr,                     //input parameter, pointer to the reference samples
+    EB_U16         *dstPtr,                     //output parameter, pointer to the filtered reference samples
+    EB_U32          count)                      //input parameter, number of reference samples
+{
+    EB_U32 sampleIndex;
+
+    dstPtr[0] = srcPtr[0];
+    for (sampleIndex = 1; sampleIndex < count - 1; sampleIndex++) {
+        dstPtr[sampleIndex] = (srcPtr[sampleIndex - 1] + (srcPtr[sampleIndex] << 1) + srcPtr[sampleIndex + 1] + 2) >> 2;
+    }
+    dstPtr[count - 1] = srcPtr[count - 1];
+}
@@ -187,6 +187,11 @@ void IntraModeAngular16bit_Horizontal_Kernel(
     const EB_BOOL  skip,
     EB_S32         intraPredAngle);
 
+void IntraFilterReferenceSamples16bit(
+    const EB_U16   *srcPtr,                     //input parameter, pointer to the reference samples
+    EB_U16         *dstPtr,                     //output parameter, pointer to the filtered reference samples
+    EB_U32          count);                     //input parameter, number of reference samples
+
 
 #ifdef __cplusplus
 }
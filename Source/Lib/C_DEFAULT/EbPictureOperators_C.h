@@ -36,6 +36,38 @@ void PictureCopyKernel(
     EB_U32                   areaHeight,
     EB_U32                   bytesPerSample);
 
+void PictureDecimateAverage2x2Kernel(
+    EB_U8                   *src,
+    EB_U32                   srcStride,
+    EB_U8                   *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight);
+
+void PictureDecimateAverage4x4Kernel(
+    EB_U8                   *src,
+    EB_U32                   srcStride,
+    EB_U8                   *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight);
+
+void PictureDecimateAverage2x2Kernel16bit(
+    EB_U16                  *src,
+    EB_U32                   srcStride,
+    EB_U16                  *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight);
+
+void PictureDecimateAverage4x4Kernel16bit(
+    EB_U16                  *src,
+    EB_U32                   srcStride,
+    EB_U16                  *dst,
+    EB_U32                   dstStride,
+    EB_U32                   dstWidth,
+    EB_U32                   dstHeight);
+
 void PictureAdditionKernel(
     EB_U8  *predPtr,
     EB_U32  predStride,
@@ -145,6 +177,37 @@ EB_U64 SpatialFullDistortionKernel(
     EB_U32   areaWidth,
     EB_U32   areaHeight);
 
+EB_U64 SpatialFullDistortionKernel16bit(
+    EB_U16  *input,
+    EB_U32   inputStride,
+    EB_U16  *recon,
+    EB_U32   reconStride,
+    EB_U32   areaWidth,
+    EB_U32   areaHeight);
+
+void SsimBlockSums4x4Kernel(
+    EB_U8   *input,
+    EB_U32   inputStride,
+    EB_U8   *recon,
+    EB_U32   reconStride,
+    EB_U32   sums[][4],
+    EB_U32   blockCount);
+
+void SsimBlockSums4x4Kernel16bit(
+    EB_U16  *input,
+    EB_U32   inputStride,
+    EB_U16  *recon,
+    EB_U32   reconStride,
+    EB_U32   sums[][4],
+    EB_U32   blockCount);
+
+void BlockHash64x64Kernel(
+    EB_U8   *src,
+    EB_U32   srcStride,
+    EB_U32   width,
+    EB_U32   height,
+    EB_U32  *hash);
+
 EB_U64 Compute8x8Satd(
     EB_S16 *diff);
 
@@ -153,6 +216,11 @@ EB_U64 Compute8x8Satd_U8(
     EB_U64 *dcValue,
     EB_U32  srcStride);
 
+EB_U64 Compute16x16Satd_U8(
+    EB_U8  *src,
+    EB_U64 *dcValue,
+    EB_U32  srcStride);
+
 #ifdef __cplusplus
 }
 #endif        
@@ -5,6 +5,7 @@
 
 #include "EbAvcStyleMcp.h"
 #include "EbPictureOperators.h"
+#include "EbRtcd.h"
 
 static const   EB_U8  FracMappedPosTabX[16] = { 0, 1, 2, 3,
 	0, 1, 2, 3,
@@ -213,7 +214,7 @@ void UniPredIFreeRef8Bit(
    if (componentMask & PICTURE_BUFFER_DESC_LUMA_MASK) 
    {
 	   //doing the luma interpolation
-       AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][0](
+       rtcd.AvcStyleUniPredLumaIF[0](
 		   refPic->bufferY + integPosx + integPosy*refPic->strideY, refPic->strideY,
 		   dst->bufferY + dstLumaIndex, lumaStride,
 		   puWidth, puHeight,
@@ -242,7 +243,7 @@ void UniPredIFreeRef8Bit(
         // Note: chromaPuWidth equals 4 is only supported in Intrinsic 
 	   //       for integer positions ( mappedFracPosx + (mappedFracPosy << 3) equals 0 )
 	   //doing the chroma Cb interpolation
-       AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][0](
+       rtcd.AvcStyleUniPredLumaIF[0](
 		   refPic->bufferCb + integPosx + integPosy*refPic->strideCb,
 		   refPic->strideCb,
 		   dst->bufferCb + dstChromaIndex,
@@ -253,7 +254,7 @@ void UniPredIFreeRef8Bit(
 		   mappedFracPosx ? mappedFracPosx : mappedFracPosy);
 
 	   //doing the chroma Cr interpolation
-       AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][0](
+       rtcd.AvcStyleUniPredLumaIF[0](
 		   refPic->bufferCr + integPosx + integPosy*refPic->strideCr,
 		   refPic->strideCr,
 		   dst->bufferCr + dstChromaIndex,
@@ -293,26 +294,6 @@ void BiPredAverageKernel_C(
 
 }
 
-typedef void(*EB_BIAVG_FUNC)(
-	EB_BYTE                  src0,
-	EB_U32                   src0Stride,
-	EB_BYTE                  src1,
-	EB_U32                   src1Stride,
-	EB_BYTE                  dst,
-	EB_U32                   dstStride,
-	EB_U32                   areaWidth,
-	EB_U32                   areaHeight);
-
-
-/*****************************
-* Function Tables
-*****************************/
-static EB_BIAVG_FUNC FUNC_TABLE BiPredAverageKernel_funcPtrArray[EB_ASM_TYPE_TOTAL] =
-{
-	BiPredAverageKernel_C,
-	BiPredAverageKernel_AVX512_INTRIN
-};
-
 
 void BiPredIFreeRef8Bit(
     EbPictureBufferDesc_t *refPicList0,
@@ -380,7 +361,7 @@ void BiPredIFreeRef8Bit(
 		if ( (fracPosL0 == 0) && (fracPosL1 == 0) )	 
 		{
 
-			BiPredAverageKernel_funcPtrArray[(ASM_TYPES & AVX512_MASK) && 1 ](
+			rtcd.BiPredAverageKernel(
 				refPicList0->bufferY + integPosL0x + integPosL0y * refLumaStride,
 				refLumaStride,
 				refPicList1->bufferY + integPosL1x + integPosL1y * refLumaStride,
@@ -409,7 +390,7 @@ void BiPredIFreeRef8Bit(
 			integPosx += IntegerPosoffsetTabX[fracPos];
 			integPosy += IntegerPosoffsetTabY[fracPos];
 
-            AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][0](
+            rtcd.AvcStyleUniPredLumaIF[0](
 				refPicList0->bufferY + integPosx + integPosy*refLumaStride, refLumaStride,
 				refList0TempDst, puWidth,
 				puWidth, puHeight,
@@ -434,7 +415,7 @@ void BiPredIFreeRef8Bit(
 			integPosy += IntegerPosoffsetTabY[fracPos];
 
 			//doing the luma interpolation
-            AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][0](
+            rtcd.AvcStyleUniPredLumaIF[0](
 				refPicList1->bufferY + integPosx + integPosy*refLumaStride, refLumaStride,
 				refList1TempDst, puWidth,
 				puWidth, puHeight,
@@ -443,7 +424,7 @@ void BiPredIFreeRef8Bit(
 
 
 			// bi-pred luma
-			PictureAverageArray[(ASM_TYPES & PREAVX2_MASK) && 1](refList0TempDst, puWidth , refList1TempDst, puWidth , biDst->bufferY + dstLumaIndex, lumaStride , puWidth, puHeight );
+			rtcd.PictureAverageKernel(refList0TempDst, puWidth , refList1TempDst, puWidth , biDst->bufferY + dstLumaIndex, lumaStride , puWidth, puHeight );
 		}
 
 	}
@@ -488,7 +469,7 @@ void BiPredIFreeRef8Bit(
 		shift = 0;
 		if ((fracPosL0 == 0) && (fracPosL1 == 0))
 		{
-            BiPredAverageKernel_funcPtrArray[(ASM_TYPES & AVX512_MASK) && 1](
+            rtcd.BiPredAverageKernel(
 				refPicList0->bufferCb + integPosL0x + integPosL0y * refPicList0->strideCb,
 				refPicList0->strideCb,
 				refPicList1->bufferCb + integPosL1x + integPosL1y * refPicList1->strideCb,
@@ -498,7 +479,7 @@ void BiPredIFreeRef8Bit(
 				chromaPuWidth,
 				chromaPuHeight);
 
-            BiPredAverageKernel_funcPtrArray[(ASM_TYPES & AVX512_MASK) && 1](
+            rtcd.BiPredAverageKernel(
 				refPicList0->bufferCr + integPosL0x + integPosL0y * refPicList0->strideCr,
 				refPicList0->strideCr,
 				refPicList1->bufferCr + integPosL1x + integPosL1y * refPicList1->strideCr,
@@ -529,7 +510,7 @@ void BiPredIFreeRef8Bit(
 			if (fracPosy > 4)
 				integPosy++;
 
-            AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][0](
+            rtcd.AvcStyleUniPredLumaIF[0](
 				refPicList0->bufferCb + integPosx + integPosy*refPicList0->strideCb,
 				refPicList0->strideCb,
 				refList0TempDst,
@@ -554,7 +535,7 @@ void BiPredIFreeRef8Bit(
 			if (fracPosy > 4)
 				integPosy++;
 
-            AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][0](
+            rtcd.AvcStyleUniPredLumaIF[0](
 				refPicList1->bufferCb + integPosx + integPosy*refPicList1->strideCb,
 				refPicList1->strideCb,
 				refList1TempDst,
@@ -565,7 +546,7 @@ void BiPredIFreeRef8Bit(
 				mappedFracPosx ? mappedFracPosx : mappedFracPosy);
 
 			// bi-pred Chroma Cb
-			PictureAverageArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.PictureAverageKernel(
 				refList0TempDst,
 				chromaPuWidth << shift,
 				refList1TempDst,
@@ -594,7 +575,7 @@ void BiPredIFreeRef8Bit(
 			if (fracPosy > 4)
 				integPosy++;
 
-            AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][0](
+            rtcd.AvcStyleUniPredLumaIF[0](
 				refPicList0->bufferCr + integPosx + integPosy*refPicList0->strideCr,
 				refPicList0->strideCr,
 				refList0TempDst,
@@ -619,7 +600,7 @@ void BiPredIFreeRef8Bit(
 			if (fracPosy > 4)
 				integPosy++;
 
-            AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][0](
+            rtcd.AvcStyleUniPredLumaIF[0](
 				refPicList1->bufferCr + integPosx + integPosy*refPicList1->strideCr,
 				refPicList1->strideCr,
 				refList1TempDst,
@@ -630,7 +611,7 @@ void BiPredIFreeRef8Bit(
 				mappedFracPosx ? mappedFracPosx : mappedFracPosy);
 
 			// bi-pred Chroma Cr
-			PictureAverageArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.PictureAverageKernel(
 				refList0TempDst,
 				chromaPuWidth << shift,
 				refList1TempDst,
@@ -10,6 +10,7 @@
 
 #include "EbAvcStyleMcp_SSE2.h"
 #include "EbAvcStyleMcp_SSSE3.h"
+#include "EbAvcStyleMcp_AVX2.h"
 
 #include "EbPictureOperators.h"
 
@@ -105,33 +106,25 @@ typedef void(*PictureAverage)(
     EB_U32                   areaHeight);
 
 
-/***************************************
-* Function Tables
-***************************************/
-static const AvcStyleInterpolationFilterNew FUNC_TABLE AvcStyleUniPredLumaIFFunctionPtrArray[EB_ASM_TYPE_TOTAL][3] = {
-    // C_DEFAULT
-    {
-        AvcStyleCopyNew,                                     //copy
-        AvcStyleLumaInterpolationFilterHorizontal,           //a
-        AvcStyleLumaInterpolationFilterVertical,             //d
-    },
-    // AVX2
-    {
-        AvcStyleCopy_SSE2,                                          //copy
-        AvcStyleLumaInterpolationFilterHorizontal_SSSE3_INTRIN,     //a
-        AvcStyleLumaInterpolationFilterVertical_SSSE3_INTRIN,       //d
-
-    }
-};
-
-
+typedef void(*EB_BIAVG_FUNC)(
+    EB_BYTE                  src0,
+    EB_U32                   src0Stride,
+    EB_BYTE                  src1,
+    EB_U32                   src1Stride,
+    EB_BYTE                  dst,
+    EB_U32                   dstStride,
+    EB_U32                   areaWidth,
+    EB_U32                   areaHeight);
 
-static const PictureAverage FUNC_TABLE PictureAverageArray[EB_ASM_TYPE_TOTAL] = {
-	// C_DEFAULT
-    PictureAverageKernel,
-	// AVX2
-	PictureAverageKernel_SSE2_INTRIN,
-};
+void BiPredAverageKernel_C(
+    EB_BYTE                  src0,
+    EB_U32                   src0Stride,
+    EB_BYTE                  src1,
+    EB_U32                   src1Stride,
+    EB_BYTE                  dst,
+    EB_U32                   dstStride,
+    EB_U32                   areaWidth,
+    EB_U32                   areaHeight);
 
 typedef void(*PictureAverage1Line)(
     EB_BYTE                  src0,   
@@ -139,12 +132,6 @@ typedef void(*PictureAverage1Line)(
     EB_BYTE                  dst,  
     EB_U32                   areaWidth);  
 
-static const PictureAverage1Line FUNC_TABLE PictureAverage1LineArray[EB_ASM_TYPE_TOTAL] = {
-    // C_DEFAULT
-    PictureAverageKernel1Line_C,
-    // AVX2
-    PictureAverageKernel1Line_SSE2_INTRIN,
-};
 
 #ifdef __cplusplus
 }
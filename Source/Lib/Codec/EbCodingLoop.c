@@ -21,6 +21,7 @@
 #include "EbComputeSAD.h"
 #include "EbTransforms.h"
 #include "EbModeDecisionConfiguration.h"
+#include "EbRtcd.h"
 #include "emmintrin.h"
 
 //#define DEBUG_REF_INFO
@@ -852,7 +853,7 @@ static void EncodeLoop(
 
 		// For the case that DC path chosen for chroma, we check the DC values and determine to use DC or N2Shape for chroma. Since there is only one flag for ChromaShaping, we do the prediction of Cr and Cb and decide on the chroma shaping
 		if (tuSize > MIN_PU_SIZE && contextPtr->transCoeffShapeChroma == ONLY_DC_SHAPE) {
-			EB_S64 sumResidual = SumResidual_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			EB_S64 sumResidual = rtcd.SumResidual(
 					((EB_S16*)residual16bit->bufferCb) + scratchCbOffset,
 					tuSize >> subWidthCMinus1,
 					residual16bit->strideCb);
@@ -964,7 +965,7 @@ static void EncodeLoop(
 				tuSize > MIN_PU_SIZE? (tuSize >> subWidthCMinus1): tuSize);
 
 		if (tuSize > MIN_PU_SIZE && contextPtr->transCoeffShapeChroma == ONLY_DC_SHAPE) {
-			EB_S64 sumResidual = SumResidual_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			EB_S64 sumResidual = rtcd.SumResidual(
 					((EB_S16*)residual16bit->bufferCr) + scratchCrOffset,
 					tuSize >> subWidthCMinus1,
 					residual16bit->strideCr);
@@ -1189,26 +1190,17 @@ static void EncodeGenerateRecon(
         reconLumaOffset =   (reconSamples->originY+originY)            * reconSamples->strideY   + (reconSamples->originX+originX);
 		if (tuPtr->lumaCbf == EB_TRUE && cuPtr->skipFlag == EB_FALSE) {
 
-			EncodeInvTransform(
+			EncodeInvTransformRecon(
 				(tuSize==MIN_PU_SIZE)?EB_FALSE:(tuPtr->transCoeffShapeLuma == ONLY_DC_SHAPE || tuPtr->isOnlyDc[0]),
 				((EB_S16*)residual16bit->bufferY) + scratchLumaOffset,
 				residual16bit->strideY,
-				((EB_S16*)residual16bit->bufferY) + scratchLumaOffset,
-				residual16bit->strideY,
-				tuSize,
-				transformScratchBuffer,
-				BIT_INCREMENT_8BIT,
-				(EB_BOOL)(tuSize == MIN_PU_SIZE));
-
-			AdditionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][tuSize >> 3](
 				predSamples->bufferY + predLumaOffset,
 				predSamples->strideY,
-				((EB_S16*)residual16bit->bufferY) + scratchLumaOffset,
-				residual16bit->strideY,
 				reconSamples->bufferY + reconLumaOffset,
 				reconSamples->strideY,
 				tuSize,
-				tuSize);
+				transformScratchBuffer,
+				(EB_BOOL)(tuSize == MIN_PU_SIZE));
 		}
 	}
 
@@ -1228,26 +1220,17 @@ static void EncodeGenerateRecon(
 		// Cb
 		//********************************** 
 		if (cbCbf== EB_TRUE && cuPtr->skipFlag == EB_FALSE) {
-			EncodeInvTransform(
+			EncodeInvTransformRecon(
 				(tuSize==MIN_PU_SIZE)?EB_FALSE:(tuPtr->transCoeffShapeChroma == ONLY_DC_SHAPE || (secondChroma?tuPtr->isOnlyDc2[0]:tuPtr->isOnlyDc[1])),
 				((EB_S16*)residual16bit->bufferCb) + scratchChromaOffset,
 				residual16bit->strideCb,
-				((EB_S16*)residual16bit->bufferCb) + scratchChromaOffset,
-				residual16bit->strideCb,
-                tuSize >> shift_bit,
-				transformScratchBuffer,
-				BIT_INCREMENT_8BIT,
-				EB_FALSE);
-
-			AdditionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][tuSize >> (3 + shift_bit)](
 				predSamples->bufferCb + predChromaOffset,
 				predSamples->strideCb,
-				((EB_S16*)residual16bit->bufferCb) + scratchChromaOffset,
-				residual16bit->strideCb,
 				reconSamples->bufferCb + reconChromaOffset,
 				reconSamples->strideCb,
-                tuSize >> shift_bit,
-                tuSize >> shift_bit);
+				tuSize >> shift_bit,
+				transformScratchBuffer,
+				EB_FALSE);
 		}
 
 #ifdef DEBUG_REF_INFO
@@ -1272,26 +1255,17 @@ static void EncodeGenerateRecon(
             (((reconSamples->originY + originY + tuChromaOffset) >> subHeightCMinus1) * reconSamples->strideCr);
 
 		if (crCbf == EB_TRUE && cuPtr->skipFlag == EB_FALSE) {
-			EncodeInvTransform(
+			EncodeInvTransformRecon(
 				(tuSize==MIN_PU_SIZE)?EB_FALSE:(tuPtr->transCoeffShapeChroma == ONLY_DC_SHAPE || (secondChroma?tuPtr->isOnlyDc2[1]:tuPtr->isOnlyDc[2])),
 				((EB_S16*)residual16bit->bufferCr) + scratchChromaOffset,
 				residual16bit->strideCr,
-				((EB_S16*)residual16bit->bufferCr) + scratchChromaOffset,
-				residual16bit->strideCr,
-				tuSize >> shift_bit,
-				transformScratchBuffer,
-				BIT_INCREMENT_8BIT,
-				EB_FALSE);
-
-			AdditionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][tuSize >> (3 + shift_bit)](
 				predSamples->bufferCr + predChromaOffset,
 				predSamples->strideCr,
-				((EB_S16*)residual16bit->bufferCr) + scratchChromaOffset,
-				residual16bit->strideCr,
 				reconSamples->bufferCr + reconChromaOffset,
 				reconSamples->strideCr,
 				tuSize >> shift_bit,
-				tuSize >> shift_bit);
+				transformScratchBuffer,
+				EB_FALSE);
 		}
 	}
 
@@ -1489,7 +1463,7 @@ static void EncodeLoop16bit(
 
 		// For the case that DC path chosen for chroma, we check the DC values and determine to use DC or N2Shape for chroma. Since there is only one flag for ChromaShaping, we do the prediction of Cr and Cb and decide on the chroma shaping
 		if (tuSize > MIN_PU_SIZE && contextPtr->transCoeffShapeChroma == ONLY_DC_SHAPE) {
-			EB_S64 sumResidual = SumResidual_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			EB_S64 sumResidual = rtcd.SumResidual(
 					((EB_S16*)residual16bit->bufferCb) + scratchCbOffset,
 					tuSize >> subWidthCMinus1,
 					residual16bit->strideCb);
@@ -1598,7 +1572,7 @@ static void EncodeLoop16bit(
 				tuSize > MIN_PU_SIZE? (tuSize >> subWidthCMinus1): tuSize);
 
 		if (tuSize > MIN_PU_SIZE && contextPtr->transCoeffShapeChroma == ONLY_DC_SHAPE) {
-			EB_S64 sumResidual = SumResidual_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			EB_S64 sumResidual = rtcd.SumResidual(
 					((EB_S16*)residual16bit->bufferCr) + scratchCrOffset,
 					tuSize >> subWidthCMinus1,
 					residual16bit->strideCr);
@@ -1822,26 +1796,17 @@ static void EncodeGenerateRecon16bit(
         reconLumaOffset = (predSamples->originY + originY)* predSamples->strideY + (predSamples->originX + originX);
 
 		if (tuPtr->lumaCbf == EB_TRUE && cuPtr->skipFlag == EB_FALSE) {
-			EncodeInvTransform(
+			EncodeInvTransformRecon16bit(
 				(tuSize==MIN_PU_SIZE)?EB_FALSE:(tuPtr->transCoeffShapeLuma == ONLY_DC_SHAPE || tuPtr->isOnlyDc[0]),
 				((EB_S16*)residual16bit->bufferY) + scratchLumaOffset,
 				64,
-				((EB_S16*)residual16bit->bufferY) + scratchLumaOffset,
-				64,
+				(EB_U16*)predSamples->bufferY + predLumaOffset,
+				predSamples->strideY,
+				(EB_U16*)predSamples->bufferY + reconLumaOffset,
+				predSamples->strideY,
 				tuSize,
 				transformScratchBuffer,
-				BIT_INCREMENT_10BIT,
 				(EB_BOOL)(tuSize == MIN_PU_SIZE));
-
-            AdditionKernel_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
-                (EB_U16*)predSamples->bufferY + predLumaOffset,
-                predSamples->strideY,
-                ((EB_S16*)residual16bit->bufferY) + scratchLumaOffset,
-                64,
-                (EB_U16*)predSamples->bufferY + reconLumaOffset,
-                predSamples->strideY,
-                tuSize,
-                tuSize);
 		}
 	}
 
@@ -1861,26 +1826,17 @@ static void EncodeGenerateRecon16bit(
 		// Cb
 		//********************************** 
 		if (cbCbf== EB_TRUE && cuPtr->skipFlag == EB_FALSE) {
-			EncodeInvTransform(
+			EncodeInvTransformRecon16bit(
 				(tuSize==MIN_PU_SIZE)?EB_FALSE:(tuPtr->transCoeffShapeChroma == ONLY_DC_SHAPE || (secondChroma?tuPtr->isOnlyDc2[0]:tuPtr->isOnlyDc[1])),
 				((EB_S16*)residual16bit->bufferCb) + scratchChromaOffset,
 				residual16bit->strideCb,
-				((EB_S16*)residual16bit->bufferCb) + scratchChromaOffset,
-				residual16bit->strideCb,
-                tuSize >> shift_bit,
+				(EB_U16*)predSamples->bufferCb + predChromaOffset,
+				predSamples->strideCb,
+				(EB_U16*)predSamples->bufferCb + reconChromaOffset,
+				predSamples->strideCb,
+				tuSize >> shift_bit,
 				transformScratchBuffer,
-				BIT_INCREMENT_10BIT,
 				EB_FALSE);
-
-            AdditionKernel_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
-                (EB_U16*)predSamples->bufferCb + predChromaOffset,
-				predSamples->strideCb,
-				((EB_S16*)residual16bit->bufferCb) + scratchChromaOffset,
-				residual16bit->strideCb,
-                (EB_U16*)predSamples->bufferCb + reconChromaOffset,
-                predSamples->strideCb,
-                tuSize >> shift_bit,
-                tuSize >> shift_bit);
 		}
 
 		//**********************************
@@ -1894,26 +1850,17 @@ static void EncodeGenerateRecon16bit(
             ((predSamples->originX + originX) >> subWidthCMinus1);
 
 		if (crCbf == EB_TRUE && cuPtr->skipFlag == EB_FALSE) {
-			EncodeInvTransform(
+			EncodeInvTransformRecon16bit(
 				(tuSize==MIN_PU_SIZE)?EB_FALSE:(tuPtr->transCoeffShapeChroma == ONLY_DC_SHAPE || (secondChroma?tuPtr->isOnlyDc2[1]:tuPtr->isOnlyDc[2])),
 				((EB_S16*)residual16bit->bufferCr) + scratchChromaOffset,
 				residual16bit->strideCr,
-				((EB_S16*)residual16bit->bufferCr) + scratchChromaOffset,
-				residual16bit->strideCr,
+				(EB_U16*)predSamples->bufferCr + predChromaOffset,
+				predSamples->strideCr,
+				(EB_U16*)predSamples->bufferCr + reconChromaOffset,
+				predSamples->strideCr,
 				tuSize >> shift_bit,
 				transformScratchBuffer,
-				BIT_INCREMENT_10BIT,
 				EB_FALSE);
-
-            AdditionKernel_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
-                (EB_U16*)predSamples->bufferCr + predChromaOffset,
-				predSamples->strideCr,
-				((EB_S16*)residual16bit->bufferCr) + scratchChromaOffset,
-				residual16bit->strideCr,
-                (EB_U16*)predSamples->bufferCr + reconChromaOffset,
-                predSamples->strideCr,
-				tuSize >> shift_bit,
-				tuSize >> shift_bit);
 		}
 	}
 
@@ -3182,7 +3129,8 @@ EB_EXTERN void EncodePass(
 
     EB_BOOL dlfEnableFlag = (EB_BOOL)(!sequenceControlSetPtr->staticConfig.disableDlfFlag) &&
         (pictureControlSetPtr->ParentPcsPtr->isUsedAsReferenceFlag ||
-        sequenceControlSetPtr->staticConfig.reconEnabled);
+        sequenceControlSetPtr->staticConfig.reconEnabled ||
+        pictureControlSetPtr->ParentPcsPtr->qualityMetricsFlag);
 
     dlfEnableFlag = contextPtr->allowEncDecMismatch ? EB_FALSE : dlfEnableFlag;
 
@@ -3190,7 +3138,8 @@ EB_EXTERN void EncodePass(
 
     EB_BOOL doRecon = (EB_BOOL)(contextPtr->mdContext->limitIntra == 0 || isIntraLCU == 1) ||
         pictureControlSetPtr->ParentPcsPtr->isUsedAsReferenceFlag ||
-        sequenceControlSetPtr->staticConfig.reconEnabled;
+        sequenceControlSetPtr->staticConfig.reconEnabled ||
+        pictureControlSetPtr->ParentPcsPtr->qualityMetricsFlag;
 
     CabacCost_t *cabacCost = pictureControlSetPtr->cabacCost;
     EntropyCoder_t *coeffEstEntropyCoderPtr = pictureControlSetPtr->coeffEstEntropyCoderPtr;
@@ -4572,6 +4521,11 @@ EB_EXTERN void EncodePass(
                     cuPtr->skipFlag = EB_TRUE;
                 }
 
+                if (cuPtr->skipFlag == EB_TRUE)
+                    contextPtr->totSkipCodedArea += cuStats->size*cuStats->size;
+                else
+                    contextPtr->totInterCodedArea += cuStats->size*cuStats->size;
+
                 {
                     // Set the PU Loop Variables
                     puPtr = cuPtr->predictionUnitArray;
@@ -4987,10 +4941,3 @@ EB_EXTERN void EncodePass(
     }
     return;
 }
-
-
-void UnusedVariablevoidFunc_CodingLoop()
-{
-    (void)NxMSadLoopKernel_funcPtrArray;
-    (void)NxMSadAveragingKernel_funcPtrArray;
-}
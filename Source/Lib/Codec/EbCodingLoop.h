@@ -108,6 +108,15 @@ extern void EncodePass(
     EB_U32                   lcuQp,
     EB_BOOL                  enableSaoFlag,
     EncDecContext_t         *contextPtr);
+
+extern void EncodePassPackLcu(
+    SequenceControlSet_t    *sequenceControlSetPtr,
+    EbPictureBufferDesc_t   *inputPicture,
+    EncDecContext_t         *contextPtr,
+    EB_U32                   lcuOriginX,
+    EB_U32                   lcuOriginY,
+    EB_U32                   lcuWidth,
+    EB_U32                   lcuHeight);
 #ifdef __cplusplus
 }
 #endif
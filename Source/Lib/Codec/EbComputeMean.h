@@ -22,20 +22,12 @@ typedef EB_U64(*EB_COMPUTE_MEAN_FUNC)(
     EB_U32 inputAreaWidth,
     EB_U32 inputAreaHeight);
 
-static const EB_COMPUTE_MEAN_FUNC ComputeMeanFunc[2][EB_ASM_TYPE_TOTAL] = {
-    {
-        // C_DEFAULT
-        ComputeMean,
-        // AVX2
-		ComputeMean8x8_AVX2_INTRIN
-    },
-    {
-        // C_DEFAULT
-        ComputeMeanOfSquaredValues,
-        // AVX2
-        ComputeMeanOfSquaredValues8x8_SSE2_INTRIN
-    }
-};
+typedef void(*EB_COMPUTE_INTERM_VAR_FUNC)(
+    EB_U8 *inputSamples,
+    EB_U16 inputStride,
+    EB_U64 *meanOf8x8Blocks,
+    EB_U64 *meanOfSquared8x8Blocks);
+
 
 #ifdef __cplusplus
 }
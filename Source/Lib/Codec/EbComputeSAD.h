@@ -89,73 +89,6 @@ extern "C" {
         EB_U32  *pBestMV64x64,
         EB_U32   mv);
 
-    /***************************************
-    * Function Tables
-    ***************************************/
-    static EB_SADKERNELNxM_TYPE FUNC_TABLE NxMSadKernel_funcPtrArray[EB_ASM_TYPE_TOTAL][9] =   // [ASM_TYPES][SAD - block height]
-    {
-        // C_DEFAULT
-        {
-            /*0 4xM  */ FastLoop_NxMSadKernel,
-            /*1 8xM  */ FastLoop_NxMSadKernel,
-            /*2 16xM */ FastLoop_NxMSadKernel,
-            /*3 24xM */ FastLoop_NxMSadKernel,
-            /*4 32xM */ FastLoop_NxMSadKernel,
-            /*5      */ FastLoop_NxMSadKernel,
-            /*6 48xM */ FastLoop_NxMSadKernel,
-            /*7      */ FastLoop_NxMSadKernel,
-            /*8 64xM */ FastLoop_NxMSadKernel
-        },
-        // AVX2
-        {
-            /*0 4xM  */ Compute4xMSad_SSE2_INTRIN,
-            /*1 8xM  */ Compute8xMSad_SSE2_INTRIN,
-            /*2 16xM */	Compute16xMSad_SSE2_INTRIN,//Compute16xMSad_AVX2_INTRIN is slower than the SSE2 version
-            /*3 24xM */	Compute24xMSad_AVX2_INTRIN,
-            /*4 32xM */	Compute32xMSad_AVX2_INTRIN,
-            /*5      */ (EB_SADKERNELNxM_TYPE)NxMSadKernelVoidFunc,
-            /*6 48xM */	Compute48xMSad_AVX2_INTRIN,
-            /*7      */ (EB_SADKERNELNxM_TYPE)NxMSadKernelVoidFunc,
-            /*8 64xM */ Compute64xMSad_AVX2_INTRIN,
-        },
-    };
-
-    static EB_SADAVGKERNELNxM_TYPE FUNC_TABLE NxMSadAveragingKernel_funcPtrArray[EB_ASM_TYPE_TOTAL][9] =   // [ASM_TYPES][SAD - block height]
-    {
-        // C_DEFAULT
-        {
-            /*0 4xM  */     CombinedAveragingSAD,
-            /*1 8xM  */     CombinedAveragingSAD,
-            /*2 16xM */     CombinedAveragingSAD,
-            /*3 24xM */     CombinedAveragingSAD,
-            /*4 32xM */     CombinedAveragingSAD,
-            /*5      */     (EB_SADAVGKERNELNxM_TYPE)NxMSadKernelVoidFunc,
-            /*6 48xM */     CombinedAveragingSAD,
-            /*7      */     (EB_SADAVGKERNELNxM_TYPE)NxMSadKernelVoidFunc,
-            /*8 64xM */     CombinedAveragingSAD
-        },
-        // AVX2
-        {
-            /*0 4xM  */     CombinedAveraging4xMSAD_SSE2_INTRIN,
-            /*1 8xM  */     CombinedAveraging8xMSAD_SSE2_INTRIN,
-            /*2 16xM */     CombinedAveraging16xMSAD_SSE2_INTRIN,
-            /*3 24xM */     CombinedAveraging24xMSAD_SSE2_INTRIN,
-            /*4 32xM */     CombinedAveraging32xMSAD_SSE2_INTRIN,
-            /*5      */     (EB_SADAVGKERNELNxM_TYPE)NxMSadKernelVoidFunc,
-            /*6 48xM */     CombinedAveraging48xMSAD_SSE2_INTRIN,
-            /*7      */     (EB_SADAVGKERNELNxM_TYPE)NxMSadKernelVoidFunc,
-            /*8 64xM */     CombinedAveraging64xMSAD_SSE2_INTRIN
-        },
-    };
-
-
-    static EB_SADLOOPKERNELNxM_TYPE FUNC_TABLE NxMSadLoopKernel_funcPtrArray[EB_ASM_TYPE_TOTAL] =
-    {
-        // C_DEFAULT
-        SadLoopKernel,
-        // AVX2
-        SadLoopKernel_AVX2_INTRIN,
-    };
 
 #ifdef __cplusplus
 }
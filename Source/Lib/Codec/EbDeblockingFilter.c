@@ -17,6 +17,7 @@
 #include "EbTransforms.h"
 #include "EbErrorCodes.h"
 #include "EbErrorHandling.h"
+#include "EbRtcd.h"
 
 #if 0
 #define   convertToChromaQp(iQpY)  ( ((iQpY) < 0) ? (iQpY) : (((iQpY) > 57) ? ((iQpY)-6) : (EB_S32)(MapChromaQp((EB_U32)iQpY))) )
@@ -431,36 +432,6 @@ void SetBSArrayBasedOnPUBoundary(
 	return;
 }
 
-/** CalculateBSForTUBoundaryInsidePU()
-is used to calulate the bS for a particular(horizontal/vertical) edge of a 4x4 block on a
-TU boundary which lays inside a PU.
-*/
-static inline EB_U8 CalculateBSForTUBoundaryInsidePU(
-	EB_U32                 blk4x4Pos_x,             //input paramter, picture-wise horizontal location of the 4x4 block.
-	EB_U32                 blk4x4Pos_y,             //input paramter, picture-wise vertical location of the 4x4 block.
-	EB_MODETYPE            cuCodingMode,            //input paramter, the coding mode of the CU where the 4x4 block belongs to.
-	EB_BOOL                isVerticalEdge,          //input paramter
-	PictureControlSet_t   *pictureControlSetPtr,
-	SequenceControlSet_t  *sequenceControlSetPtr)
-{
-	EB_U8   bS = 0;
-	EB_U32  blk4x4PosNeighbourX;
-	EB_U32  blk4x4PosNeighbourY;
-
-	blk4x4PosNeighbourX = isVerticalEdge ? blk4x4Pos_x - 4 : blk4x4Pos_x;
-	blk4x4PosNeighbourY = isVerticalEdge ? blk4x4Pos_y : blk4x4Pos_y - 4;
-
-	if (cuCodingMode == INTRA_MODE) {
-		bS = 2;
-	}
-	else {
-		bS = pictureControlSetPtr->cbfMapArray[(blk4x4Pos_x >> 2) + (blk4x4Pos_y >> 2) *(sequenceControlSetPtr->lumaWidth >> 2)] ||
-			pictureControlSetPtr->cbfMapArray[(blk4x4PosNeighbourX >> 2) + (blk4x4PosNeighbourY >> 2) *(sequenceControlSetPtr->lumaWidth >> 2)];
-	}
-
-	return bS;
-}
-
 /** SetBSArrayBasedOnTUBoundary()
 is used to calulate the bS on TU boundary.
 
@@ -486,35 +457,48 @@ void SetBSArrayBasedOnTUBoundary(
 	EB_U32                lcuSize = sequenceControlSetPtr->lcuSize;
 
 	EB_U32  tuTopLeft4x4blkAddr = ((tuPos_x&(lcuSize - 1)) >> 2) + (((tuPos_y&(lcuSize - 1)) >> 2) << logMaxLcuSizeIn4x4blk);
-	EB_U32  tuTopRight4x4blkAddr = tuTopLeft4x4blkAddr + (tuWidth >> 2) - 1;
-	EB_U32  tuBottomLeft4x4blkAddr = tuTopLeft4x4blkAddr + (((tuHeight >> 2) - 1) << logMaxLcuSizeIn4x4blk);
-	EB_U32  blk4x4Addr;
+	EB_U32  tuWidthIn4x4blk = tuWidth >> 2;
+	EB_U32  tuHeightIn4x4blk = tuHeight >> 2;
+	EB_U32  cbfMapStride = sequenceControlSetPtr->lumaWidth >> 2;
+	// picture-wise location of the top-left 4x4 block
+	EB_U32  blk4x4Pos_x = tbOriginX + ((tuTopLeft4x4blkAddr & (MaxLcuSizeIn4x4blk - 1)) << 2);
+	EB_U32  blk4x4Pos_y = tbOriginY + ((tuTopLeft4x4blkAddr >> logMaxLcuSizeIn4x4blk) << 2);
+	EB_U8  *cbfMapPtr = pictureControlSetPtr->cbfMapArray + (blk4x4Pos_x >> 2) + (blk4x4Pos_y >> 2) * cbfMapStride;
+	EB_U8  *neighbourCbfMapPtr;
+	EB_U8  *bSPtr;
+	EB_U32  blk4x4Idx;
+
+	// Inside a PU, bS is 2 for intra, else 1 when either side has coded luma coefficients.
+	// The horizontal edge bS of a TU row is contiguous in the bS array, so both directions
+	// are set with flat loops over the cbf map rather than per 4x4 block.
 
 	//set bS for the horizontal TU boundary which lies on the 8 sample edge inside a PU
     if ((tuPos_y & 7) == 0 && tuPos_y != 0 && tuPos_y != tbOriginY + cuStatsPtr->originY) {
-		for (blk4x4Addr = tuTopLeft4x4blkAddr; blk4x4Addr <= tuTopRight4x4blkAddr; ++blk4x4Addr) {
-			horizontalEdgeBSArray[BLK4X4_ADDR_TO_HORIZONTAL_EDGE_BS_ARRAY_IDX(blk4x4Addr)]
-				= CalculateBSForTUBoundaryInsidePU(
-				tbOriginX + ((blk4x4Addr & (MaxLcuSizeIn4x4blk - 1)) << 2),
-				tbOriginY + ((blk4x4Addr >> logMaxLcuSizeIn4x4blk) << 2),
-				cuCodingMode,
-				EB_FALSE,
-				pictureControlSetPtr,
-				sequenceControlSetPtr);
+		bSPtr = horizontalEdgeBSArray + BLK4X4_ADDR_TO_HORIZONTAL_EDGE_BS_ARRAY_IDX(tuTopLeft4x4blkAddr);
+		if (cuCodingMode == INTRA_MODE) {
+			EB_MEMSET(bSPtr, 2, tuWidthIn4x4blk);
+		}
+		else {
+			neighbourCbfMapPtr = cbfMapPtr - cbfMapStride;
+			for (blk4x4Idx = 0; blk4x4Idx < tuWidthIn4x4blk; ++blk4x4Idx) {
+				bSPtr[blk4x4Idx] = (EB_U8)((cbfMapPtr[blk4x4Idx] | neighbourCbfMapPtr[blk4x4Idx]) != 0);
+			}
 		}
 	}
 
 	//set bS for the vertical TU boundary which lies on the 8 sample edge inside a PU
     if ((tuPos_x & 7) == 0 && tuPos_x != 0 && tuPos_x != tbOriginX + cuStatsPtr->originX) {
-		for (blk4x4Addr = tuTopLeft4x4blkAddr; blk4x4Addr <= tuBottomLeft4x4blkAddr; blk4x4Addr += MaxLcuSizeIn4x4blk) {
-			verticalEdgeBSArray[BLK4X4_ADDR_TO_VERTICAL_EDGE_BS_ARRAY_IDX(blk4x4Addr)]
-				= CalculateBSForTUBoundaryInsidePU(
-				tbOriginX + ((blk4x4Addr & (MaxLcuSizeIn4x4blk - 1)) << 2),
-				tbOriginY + ((blk4x4Addr >> logMaxLcuSizeIn4x4blk) << 2),
-				cuCodingMode,
-				EB_TRUE,
-				pictureControlSetPtr,
-				sequenceControlSetPtr);
+		bSPtr = verticalEdgeBSArray + BLK4X4_ADDR_TO_VERTICAL_EDGE_BS_ARRAY_IDX(tuTopLeft4x4blkAddr);
+		if (cuCodingMode == INTRA_MODE) {
+			for (blk4x4Idx = 0; blk4x4Idx < tuHeightIn4x4blk; ++blk4x4Idx) {
+				bSPtr[blk4x4Idx * MaxLcuSizeIn4x4blk] = 2;
+			}
+		}
+		else {
+			neighbourCbfMapPtr = cbfMapPtr - 1;
+			for (blk4x4Idx = 0; blk4x4Idx < tuHeightIn4x4blk; ++blk4x4Idx) {
+				bSPtr[blk4x4Idx * MaxLcuSizeIn4x4blk] = (EB_U8)((cbfMapPtr[blk4x4Idx * cbfMapStride] | neighbourCbfMapPtr[blk4x4Idx * cbfMapStride]) != 0);
+			}
 		}
 	}
 
@@ -1072,7 +1056,7 @@ static void Luma8x8blkDLFCore(
 		edgeStartFilteredSamplePtr = reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + (centerSamplePos_y - 4) * reconLumaPicStride + centerSamplePos_x;
 
 		// luma 4 sample edge DLF core
-		Luma4SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Luma4SampleEdgeDLFCore(
 			edgeStartFilteredSamplePtr,
 			reconLumaPicStride,
 			EB_TRUE,
@@ -1111,7 +1095,7 @@ static void Luma8x8blkDLFCore(
 
 
 		// luma 4 sample edge DLF core
-		Luma4SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Luma4SampleEdgeDLFCore(
 			edgeStartFilteredSamplePtr,
 			reconLumaPicStride,
 			EB_TRUE,
@@ -1149,7 +1133,7 @@ static void Luma8x8blkDLFCore(
 		edgeStartFilteredSamplePtr = reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + centerSamplePos_y * reconLumaPicStride + (centerSamplePos_x - 4);
 
 		// luma 4 sample edge DLF core
-		Luma4SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Luma4SampleEdgeDLFCore(
 			edgeStartFilteredSamplePtr,
 			reconLumaPicStride,
 			EB_FALSE,
@@ -1187,7 +1171,7 @@ static void Luma8x8blkDLFCore(
 		edgeStartFilteredSamplePtr = reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + centerSamplePos_y * reconLumaPicStride + centerSamplePos_x;
 
 		// luma 4 sample edge DLF core
-		Luma4SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Luma4SampleEdgeDLFCore(
 			edgeStartFilteredSamplePtr,
 			reconLumaPicStride,
 			EB_FALSE,
@@ -1254,7 +1238,7 @@ void Luma8x8blkDLFCore16bit(
 		edgeStartFilteredSamplePtr = (EB_U16*)reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + (centerSamplePos_y - 4) * reconLumaPicStride + centerSamplePos_x;
 
 		// luma 4 sample edge DLF core
-		lumaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.lumaDlf16bit(
 			edgeStartFilteredSamplePtr,
 			reconLumaPicStride,
 			EB_TRUE,
@@ -1297,7 +1281,7 @@ void Luma8x8blkDLFCore16bit(
 		edgeStartFilteredSamplePtr = (EB_U16*)reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + centerSamplePos_y  * reconLumaPicStride + centerSamplePos_x;
 
 		// luma 4 sample edge DLF core
-		lumaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.lumaDlf16bit(
 			edgeStartFilteredSamplePtr,
 			reconLumaPicStride,
 			EB_TRUE,
@@ -1339,7 +1323,7 @@ void Luma8x8blkDLFCore16bit(
 		edgeStartFilteredSamplePtr = (EB_U16*)reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + centerSamplePos_y * reconLumaPicStride + (centerSamplePos_x - 4);
 
 		// luma 4 sample edge DLF core
-		lumaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.lumaDlf16bit(
 			edgeStartFilteredSamplePtr,
 			reconLumaPicStride,
 			EB_FALSE,
@@ -1380,7 +1364,7 @@ void Luma8x8blkDLFCore16bit(
 		edgeStartFilteredSamplePtr = (EB_U16*)reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + centerSamplePos_y * reconLumaPicStride + centerSamplePos_x;
 
 		// luma 4 sample edge DLF core
-		lumaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.lumaDlf16bit(
 			edgeStartFilteredSamplePtr,
 			reconLumaPicStride,
 			EB_FALSE,
@@ -1480,7 +1464,7 @@ static void chroma8x8blkDLFCore(
 		edgeStartSampleCb = reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + (centerSamplePos_y - 4) * reconChromaPicStride + centerSamplePos_x;
 		edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + (centerSamplePos_y - 4) * reconChromaPicStride + centerSamplePos_x;
 
-		Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Chroma2SampleEdgeDLFCore(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1523,7 +1507,7 @@ static void chroma8x8blkDLFCore(
 		edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + (centerSamplePos_y - 2) * reconChromaPicStride + centerSamplePos_x;
 
 
-		Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Chroma2SampleEdgeDLFCore(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1569,7 +1553,7 @@ static void chroma8x8blkDLFCore(
 		edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + centerSamplePos_x;
 
 
-		Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Chroma2SampleEdgeDLFCore(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1612,7 +1596,7 @@ static void chroma8x8blkDLFCore(
 		edgeStartSampleCb = reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + (centerSamplePos_y + 2) * reconChromaPicStride + centerSamplePos_x;
 		edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + (centerSamplePos_y + 2) * reconChromaPicStride + centerSamplePos_x;
 
-		Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Chroma2SampleEdgeDLFCore(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1655,7 +1639,7 @@ static void chroma8x8blkDLFCore(
 		edgeStartSampleCb = reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x - 4);
 		edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x - 4);
 
-		Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Chroma2SampleEdgeDLFCore(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1698,7 +1682,7 @@ static void chroma8x8blkDLFCore(
 		edgeStartSampleCb = reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x - 2);
 		edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x - 2);
 
-		Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Chroma2SampleEdgeDLFCore(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1742,7 +1726,7 @@ static void chroma8x8blkDLFCore(
 		edgeStartSampleCb = reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + centerSamplePos_y * reconChromaPicStride + centerSamplePos_x;
 		edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + centerSamplePos_x;
 
-		Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Chroma2SampleEdgeDLFCore(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1785,7 +1769,7 @@ static void chroma8x8blkDLFCore(
 		edgeStartSampleCb = reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x + 2);
 		edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x + 2);
 
-		Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.Chroma2SampleEdgeDLFCore(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1863,7 +1847,7 @@ static void chroma8x8blkDLFCore16bit(
         edgeStartSampleCb = (EB_U16*)reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + (centerSamplePos_y - 4) * reconChromaPicStride + centerSamplePos_x;
         edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + (centerSamplePos_y - 4) * reconChromaPicStride + centerSamplePos_x;
 
-		chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.chromaDlf16bit(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1910,7 +1894,7 @@ static void chroma8x8blkDLFCore16bit(
 		edgeStartSampleCb = (EB_U16*)reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + (centerSamplePos_y - 2) * reconChromaPicStride + centerSamplePos_x;
 		edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + (centerSamplePos_y - 2) * reconChromaPicStride + centerSamplePos_x;
 
-		chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.chromaDlf16bit(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -1960,7 +1944,7 @@ static void chroma8x8blkDLFCore16bit(
 		edgeStartSampleCb = (EB_U16*)reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + centerSamplePos_y * reconChromaPicStride + centerSamplePos_x;
 		edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + centerSamplePos_x;
 
-		chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.chromaDlf16bit(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -2007,7 +1991,7 @@ static void chroma8x8blkDLFCore16bit(
 		edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + (centerSamplePos_y + 2) * reconChromaPicStride + centerSamplePos_x;
 
 
-		chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.chromaDlf16bit(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -2056,7 +2040,7 @@ static void chroma8x8blkDLFCore16bit(
 		edgeStartSampleCb = (EB_U16*)reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x - 4);
 		edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x - 4);
 
-		chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.chromaDlf16bit(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -2104,7 +2088,7 @@ static void chroma8x8blkDLFCore16bit(
 		edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x - 2);
 
 
-		chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.chromaDlf16bit(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -2153,7 +2137,7 @@ static void chroma8x8blkDLFCore16bit(
 		edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + centerSamplePos_x;
 
 
-		chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.chromaDlf16bit(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -2200,7 +2184,7 @@ static void chroma8x8blkDLFCore16bit(
 		edgeStartSampleCb = (EB_U16*)reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x + 2);
 		edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + centerSamplePos_y * reconChromaPicStride + (centerSamplePos_x + 2);
 
-		chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.chromaDlf16bit(
 			edgeStartSampleCb,
 			edgeStartSampleCr,
 			reconChromaPicStride,
@@ -2212,6 +2196,44 @@ static void chroma8x8blkDLFCore16bit(
 
 	return;
 }
+/** CalculateLumaEdgeTcBeta()
+is used to derive tc and beta of a 4 sample luma edge inside the LCU.
+An edge with bS 0 gets beta 0, which the luma DLF cores never filter.
+*/
+static inline void CalculateLumaEdgeTcBeta(
+	PictureControlSet_t   *reconPictureControlSet,  //input parameter, picture control set.
+	EB_U32                 edgeStartSamplePos_x,    //input parameter, picture-wise location of the edge.
+	EB_U32                 edgeStartSamplePos_y,    //input parameter, picture-wise location of the edge.
+	EB_BOOL                isVerticalEdge,          //input parameter, the neighbour CU is on the left if TRUE, above if FALSE.
+	EB_U8                  bS,                      //input parameter, the edge bS.
+	EB_U32                 bitDepthShift,           //input parameter, 2 for 10-bit samples.
+	EB_S32                *tc,                      //output parameter
+	EB_S32                *beta)                    //output parameter
+{
+	EB_U8 curCuQp;
+	EB_U8 neighbourCuQp;
+	EB_U8 Qp;
+
+	if (bS == 0) {
+		*tc = 0;
+		*beta = 0;
+		return;
+	}
+
+	curCuQp = reconPictureControlSet->qpArray[LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
+		edgeStartSamplePos_x,
+		edgeStartSamplePos_y,
+		reconPictureControlSet->qpArrayStride)];
+	neighbourCuQp = reconPictureControlSet->qpArray[LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
+		edgeStartSamplePos_x - (isVerticalEdge ? 1 : 0),
+		edgeStartSamplePos_y - (isVerticalEdge ? 0 : 1),
+		reconPictureControlSet->qpArrayStride)];
+
+	Qp = (curCuQp + neighbourCuQp + 1) >> 1;
+	*tc = TcTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE_PLUS_INTRA_TC_OFFSET, Qp + ((bS > 1) << 1) + reconPictureControlSet->tcOffset)] << bitDepthShift;
+	*beta = BetaTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE, Qp + reconPictureControlSet->betaOffset)] << bitDepthShift;
+}
+
 /** LCUInternalAreaDLFCore()
 is used to apply the deblocking filter in the LCU internal area (excluding the LCU boundary)
 as the first pass DLF.
@@ -2234,6 +2256,8 @@ EB_ERRORTYPE LCUInternalAreaDLFCore(
 	EB_U32  verticalIdx;
 	EB_U32  horizontalIdx;
 	EB_U8   bS;
+	EB_U8   bS1;
+	EB_BOOL isEdgePair;
 
 	// variables for luma componet
 	EB_U32  blk4x4Addr;
@@ -2244,6 +2268,7 @@ EB_ERRORTYPE LCUInternalAreaDLFCore(
 	EB_U32  num4SampleEdgesPerVerticalLumaSampleEdge = (lcuHeight >> 2) - 2;
 	EB_U32  num4SampleEdgesPerHorizontalLumaSampleEdge = (lcuWidth >> 2) - 2;
 	EB_S32  Beta;
+	EB_S32  Beta1;
 
 	// variables for chroma component
 	EB_U32  blk2x2Addr;
@@ -2267,8 +2292,8 @@ EB_ERRORTYPE LCUInternalAreaDLFCore(
 	EB_BYTE edgeStartSampleCb;
 	EB_BYTE edgeStartSampleCr;
 	EB_U8  neighbourCuQp;
-	EB_U8  Qp;
 	EB_S32  lumaTc;
+	EB_S32  lumaTc1;
 	//EB_BOOL lumaPCMFlagArray[2];
 	//EB_BOOL chromaPCMFlagArray[2];
 	EB_S32  CUqpIndex;
@@ -2285,9 +2310,9 @@ EB_ERRORTYPE LCUInternalAreaDLFCore(
 		EB_ENC_DLF_ERROR8);
 
 	/***** luma component filtering *****/
-	// filter all vertical edges
+	// filter all vertical edges, two 4 sample edges at a time
 	for (horizontalIdx = 1; horizontalIdx <= numVerticalLumaSampleEdges; ++horizontalIdx) {
-		for (verticalIdx = 1; verticalIdx <= num4SampleEdgesPerVerticalLumaSampleEdge; ++verticalIdx) {
+		for (verticalIdx = 1; verticalIdx <= num4SampleEdgesPerVerticalLumaSampleEdge; verticalIdx += 2) {
 			// edge A
 			fourSampleEdgeStartSamplePos_x = horizontalIdx << 3;   // LCU-wise position
 			fourSampleEdgeStartSamplePos_y = verticalIdx << 2;     // LCU-wise position
@@ -2295,51 +2320,59 @@ EB_ERRORTYPE LCUInternalAreaDLFCore(
 				fourSampleEdgeStartSamplePos_x,
 				fourSampleEdgeStartSamplePos_y,
 				logMaxLcuSizeIn4x4blk);
-			//neighbourBlk4x4Addr = blk4x4Addr - MaxLcuSizeIn4x4blk;
 
+			// the second edge belongs to the 4x4 block below; an odd last edge is filtered alone
+			isEdgePair = (EB_BOOL)(verticalIdx < num4SampleEdgesPerVerticalLumaSampleEdge);
 			bS = verticalEdgeBSArray[BLK4X4_ADDR_TO_VERTICAL_EDGE_BS_ARRAY_IDX(blk4x4Addr)];
-			if (bS > 0) {
-				/** *Note - The PCMFlagArray initiallisation should be completely changed when we have PCM coding.
-				*/
-
-				// Qp for the current CU
-				CUqpIndex =
-					LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
+			bS1 = isEdgePair ? verticalEdgeBSArray[BLK4X4_ADDR_TO_VERTICAL_EDGE_BS_ARRAY_IDX(blk4x4Addr + MaxLcuSizeIn4x4blk)] : 0;
+			if (bS > 0 || bS1 > 0) {
+				CalculateLumaEdgeTcBeta(
+					reconPictureControlSet,
 					fourSampleEdgeStartSamplePos_x + lcuPos_x,
 					fourSampleEdgeStartSamplePos_y + lcuPos_y,
-					reconPictureControlSet->qpArrayStride);
-
-
-				curCuQp = reconPictureControlSet->qpArray[CUqpIndex];
-
-				// Qp for the neighboring CU
-				CUqpIndex =
-					LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
-					fourSampleEdgeStartSamplePos_x + lcuPos_x - 1,
-					fourSampleEdgeStartSamplePos_y + lcuPos_y,
-					reconPictureControlSet->qpArrayStride);
-				//CUqpIndex     = ((CUqpIndex - (EB_S32)reconPictureControlSet->qpArrayStride) < 0) ? CUqpIndex : CUqpIndex - reconPictureControlSet->qpArrayStride;
-				neighbourCuQp = reconPictureControlSet->qpArray[CUqpIndex];
-
-				Qp = (curCuQp + neighbourCuQp + 1) >> 1;
-				lumaTc = TcTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE_PLUS_INTRA_TC_OFFSET, Qp + ((bS > 1) << 1) + reconPictureControlSet->tcOffset)];
-				Beta = BetaTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE, Qp + reconPictureControlSet->betaOffset)];
+					EB_TRUE,
+					bS,
+					0,
+					&lumaTc,
+					&Beta);
+				CalculateLumaEdgeTcBeta(
+					reconPictureControlSet,
+					fourSampleEdgeStartSamplePos_x + lcuPos_x,
+					fourSampleEdgeStartSamplePos_y + lcuPos_y + 4,
+					EB_TRUE,
+					bS1,
+					0,
+					&lumaTc1,
+					&Beta1);
 				edgeStartFilteredSamplePtr = reconpicture->bufferY + reconpicture->originX + reconpicture->originY * reconpicture->strideY + (fourSampleEdgeStartSamplePos_y + lcuPos_y) * reconpicture->strideY + fourSampleEdgeStartSamplePos_x + lcuPos_x;
 
-				// 4 sample edge DLF core
-				Luma4SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
-					edgeStartFilteredSamplePtr,
-					reconpicture->strideY,
-					EB_TRUE,
-					lumaTc,
-					Beta);
+				if (isEdgePair) {
+					// 8 sample edge DLF core
+					rtcd.Luma8SampleEdgeDLFCore(
+						edgeStartFilteredSamplePtr,
+						reconpicture->strideY,
+						EB_TRUE,
+						lumaTc,
+						Beta,
+						lumaTc1,
+						Beta1);
+				}
+				else {
+					// 4 sample edge DLF core
+					rtcd.Luma4SampleEdgeDLFCore(
+						edgeStartFilteredSamplePtr,
+						reconpicture->strideY,
+						EB_TRUE,
+						lumaTc,
+						Beta);
+				}
 			}
 		}
 	}
 
-	// filter all horizontal edges
+	// filter all horizontal edges, two 4 sample edges at a time
 	for (verticalIdx = 1; verticalIdx <= numHorizontalLumaSampleEdges; ++verticalIdx) {
-		for (horizontalIdx = 1; horizontalIdx <= num4SampleEdgesPerHorizontalLumaSampleEdge; ++horizontalIdx) {
+		for (horizontalIdx = 1; horizontalIdx <= num4SampleEdgesPerHorizontalLumaSampleEdge; horizontalIdx += 2) {
 			// edge B
 			fourSampleEdgeStartSamplePos_x = horizontalIdx << 2;    // LCU-wise position
 			fourSampleEdgeStartSamplePos_y = verticalIdx << 3;      // LCU-wise position
@@ -2347,43 +2380,52 @@ EB_ERRORTYPE LCUInternalAreaDLFCore(
 				fourSampleEdgeStartSamplePos_x,
 				fourSampleEdgeStartSamplePos_y,
 				logMaxLcuSizeIn4x4blk);
-			//neighbourBlk4x4Addr = blk4x4Addr - 1;
 
+			// the second edge belongs to the 4x4 block on the right; an odd last edge is filtered alone
+			isEdgePair = (EB_BOOL)(horizontalIdx < num4SampleEdgesPerHorizontalLumaSampleEdge);
 			bS = horizontalEdgeBSArray[BLK4X4_ADDR_TO_HORIZONTAL_EDGE_BS_ARRAY_IDX(blk4x4Addr)];
-			if (bS > 0) {
-				/** *Note - The PCMFlagArray initiallisation should be completely changed when we have PCM coding.
-				*/
-
-				// Qp for the current CU
-				CUqpIndex =
-					LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
+			bS1 = isEdgePair ? horizontalEdgeBSArray[BLK4X4_ADDR_TO_HORIZONTAL_EDGE_BS_ARRAY_IDX(blk4x4Addr + 1)] : 0;
+			if (bS > 0 || bS1 > 0) {
+				CalculateLumaEdgeTcBeta(
+					reconPictureControlSet,
 					fourSampleEdgeStartSamplePos_x + lcuPos_x,
 					fourSampleEdgeStartSamplePos_y + lcuPos_y,
-					reconPictureControlSet->qpArrayStride);
-
-
-				curCuQp = reconPictureControlSet->qpArray[CUqpIndex];
-
-				// Qp for the neighboring CU
-				CUqpIndex =
-					LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
-					fourSampleEdgeStartSamplePos_x + lcuPos_x,
-					fourSampleEdgeStartSamplePos_y + lcuPos_y - 1,
-					reconPictureControlSet->qpArrayStride);
-				// CUqpIndex     = ((CUqpIndex - (EB_S32)reconPictureControlSet->qpArrayStride) < 0) ? CUqpIndex : CUqpIndex - reconPictureControlSet->qpArrayStride;
-				neighbourCuQp = reconPictureControlSet->qpArray[CUqpIndex];
-				Qp = (curCuQp + neighbourCuQp + 1) >> 1;
-				lumaTc = TcTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE_PLUS_INTRA_TC_OFFSET, Qp + ((bS > 1) << 1) + reconPictureControlSet->tcOffset)];
-				Beta = BetaTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE, Qp + reconPictureControlSet->betaOffset)];
+					EB_FALSE,
+					bS,
+					0,
+					&lumaTc,
+					&Beta);
+				CalculateLumaEdgeTcBeta(
+					reconPictureControlSet,
+					fourSampleEdgeStartSamplePos_x + lcuPos_x + 4,
+					fourSampleEdgeStartSamplePos_y + lcuPos_y,
+					EB_FALSE,
+					bS1,
+					0,
+					&lumaTc1,
+					&Beta1);
 				edgeStartFilteredSamplePtr = reconpicture->bufferY + reconpicture->originX + reconpicture->originY * reconpicture->strideY + (fourSampleEdgeStartSamplePos_y + lcuPos_y) * reconpicture->strideY + fourSampleEdgeStartSamplePos_x + lcuPos_x;
 
-				// 4 sample edge DLF core
-				Luma4SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
-					edgeStartFilteredSamplePtr,
-					reconpicture->strideY,
-					EB_FALSE,
-					lumaTc,
-					Beta);
+				if (isEdgePair) {
+					// 8 sample edge DLF core
+					rtcd.Luma8SampleEdgeDLFCore(
+						edgeStartFilteredSamplePtr,
+						reconpicture->strideY,
+						EB_FALSE,
+						lumaTc,
+						Beta,
+						lumaTc1,
+						Beta1);
+				}
+				else {
+					// 4 sample edge DLF core
+					rtcd.Luma4SampleEdgeDLFCore(
+						edgeStartFilteredSamplePtr,
+						reconpicture->strideY,
+						EB_FALSE,
+						lumaTc,
+						Beta);
+				}
 			}
 		}
 	}
@@ -2433,7 +2475,7 @@ EB_ERRORTYPE LCUInternalAreaDLFCore(
 				edgeStartSampleCb = reconpicture->bufferCb + (reconpicture->originX >> subWidthCMinus1) + (reconpicture->originY >> subHeightCMinus1) * reconpicture->strideCb + (twoSampleEdgeStartSamplePos_y + chromaLcuPos_y) * reconpicture->strideCb + (twoSampleEdgeStartSamplePos_x + chromaLcuPos_x);
 				edgeStartSampleCr = reconpicture->bufferCr + (reconpicture->originX >> subWidthCMinus1) + (reconpicture->originY >> subHeightCMinus1) * reconpicture->strideCr + (twoSampleEdgeStartSamplePos_y + chromaLcuPos_y) * reconpicture->strideCr + (twoSampleEdgeStartSamplePos_x + chromaLcuPos_x);
 
-				Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.Chroma2SampleEdgeDLFCore(
 					edgeStartSampleCb,
 					edgeStartSampleCr,
 					reconpicture->strideCb,
@@ -2489,7 +2531,7 @@ EB_ERRORTYPE LCUInternalAreaDLFCore(
 				edgeStartSampleCb = reconpicture->bufferCb + (reconpicture->originX >> subWidthCMinus1) + (reconpicture->originY >> subHeightCMinus1) * reconpicture->strideCb + (twoSampleEdgeStartSamplePos_y + chromaLcuPos_y) * reconpicture->strideCb + (twoSampleEdgeStartSamplePos_x + chromaLcuPos_x);
 				edgeStartSampleCr = reconpicture->bufferCr + (reconpicture->originX >> subWidthCMinus1) + (reconpicture->originY >> subHeightCMinus1) * reconpicture->strideCr + (twoSampleEdgeStartSamplePos_y + chromaLcuPos_y) * reconpicture->strideCr + (twoSampleEdgeStartSamplePos_x + chromaLcuPos_x);
 
-				Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.Chroma2SampleEdgeDLFCore(
 					edgeStartSampleCb,
 					edgeStartSampleCr,
 					reconpicture->strideCb,
@@ -2526,6 +2568,8 @@ EB_ERRORTYPE LCUInternalAreaDLFCore16bit(
 	EB_U32  verticalIdx;
 	EB_U32  horizontalIdx;
 	EB_U8   bS;
+	EB_U8   bS1;
+	EB_BOOL isEdgePair;
 
 	// variables for luma componet
 	EB_U32  blk4x4Addr;
@@ -2536,6 +2580,7 @@ EB_ERRORTYPE LCUInternalAreaDLFCore16bit(
 	EB_U32  num4SampleEdgesPerVerticalLumaSampleEdge = (lcuHeight >> 2) - 2;
 	EB_U32  num4SampleEdgesPerHorizontalLumaSampleEdge = (lcuWidth >> 2) - 2;
 	EB_S32  Beta;
+	EB_S32  Beta1;
 
 	// variables for chroma component
 	EB_U32  blk2x2Addr;
@@ -2564,8 +2609,8 @@ EB_ERRORTYPE LCUInternalAreaDLFCore16bit(
 	EB_U16 *edgeStartSampleCb;
 	EB_U16 *edgeStartSampleCr;
 	EB_U8  neighbourCuQp;
-	EB_U8  Qp;
 	EB_S32  lumaTc;
+	EB_S32  lumaTc1;
 	//EB_BOOL lumaPCMFlagArray[2];
 	//EB_BOOL chromaPCMFlagArray[2];
 	EB_S32  CUqpIndex;
@@ -2583,9 +2628,9 @@ EB_ERRORTYPE LCUInternalAreaDLFCore16bit(
 
 
 	/***** luma component filtering *****/
-	// filter all vertical edges
+	// filter all vertical edges, two 4 sample edges at a time
 	for (horizontalIdx = 1; horizontalIdx <= numVerticalLumaSampleEdges; ++horizontalIdx) {
-		for (verticalIdx = 1; verticalIdx <= num4SampleEdgesPerVerticalLumaSampleEdge; ++verticalIdx) {
+		for (verticalIdx = 1; verticalIdx <= num4SampleEdgesPerVerticalLumaSampleEdge; verticalIdx += 2) {
 			// edge A
 			fourSampleEdgeStartSamplePos_x = horizontalIdx << 3;   // LCU-wise position
 			fourSampleEdgeStartSamplePos_y = verticalIdx << 2;     // LCU-wise position
@@ -2593,56 +2638,59 @@ EB_ERRORTYPE LCUInternalAreaDLFCore16bit(
 				fourSampleEdgeStartSamplePos_x,
 				fourSampleEdgeStartSamplePos_y,
 				logMaxLcuSizeIn4x4blk);
-			//neighbourBlk4x4Addr = blk4x4Addr - MaxLcuSizeIn4x4blk;
 
+			// the second edge belongs to the 4x4 block below; an odd last edge is filtered alone
+			isEdgePair = (EB_BOOL)(verticalIdx < num4SampleEdgesPerVerticalLumaSampleEdge);
 			bS = verticalEdgeBSArray[BLK4X4_ADDR_TO_VERTICAL_EDGE_BS_ARRAY_IDX(blk4x4Addr)];
-			if (bS > 0) {
-				/** *Note - The PCMFlagArray initiallisation should be completely changed when we have PCM coding.
-				*/
-
-				// Qp for the current CU
-				CUqpIndex =
-					LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
+			bS1 = isEdgePair ? verticalEdgeBSArray[BLK4X4_ADDR_TO_VERTICAL_EDGE_BS_ARRAY_IDX(blk4x4Addr + MaxLcuSizeIn4x4blk)] : 0;
+			if (bS > 0 || bS1 > 0) {
+				CalculateLumaEdgeTcBeta(
+					reconPictureControlSet,
 					fourSampleEdgeStartSamplePos_x + lcuPos_x,
 					fourSampleEdgeStartSamplePos_y + lcuPos_y,
-					reconPictureControlSet->qpArrayStride);
-
-
-				curCuQp = reconPictureControlSet->qpArray[CUqpIndex];
-
-
-				// Qp for the neighboring CU
-				CUqpIndex =
-					LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
-					fourSampleEdgeStartSamplePos_x + lcuPos_x - 1,
-					fourSampleEdgeStartSamplePos_y + lcuPos_y,
-					reconPictureControlSet->qpArrayStride);
-				//CUqpIndex     = ((CUqpIndex - (EB_S32)reconPictureControlSet->qpArrayStride) < 0) ? CUqpIndex : CUqpIndex - reconPictureControlSet->qpArrayStride;
-				neighbourCuQp = reconPictureControlSet->qpArray[CUqpIndex];
-				Qp = (curCuQp + neighbourCuQp + 1) >> 1;
-				lumaTc = TcTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE_PLUS_INTRA_TC_OFFSET, Qp + ((bS > 1) << 1) + reconPictureControlSet->tcOffset)];
-				Beta = BetaTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE, Qp + reconPictureControlSet->betaOffset)];
-
-				//CHKN
-				lumaTc = lumaTc << 2;
-				Beta = Beta << 2;
-
+					EB_TRUE,
+					bS,
+					2,
+					&lumaTc,
+					&Beta);
+				CalculateLumaEdgeTcBeta(
+					reconPictureControlSet,
+					fourSampleEdgeStartSamplePos_x + lcuPos_x,
+					fourSampleEdgeStartSamplePos_y + lcuPos_y + 4,
+					EB_TRUE,
+					bS1,
+					2,
+					&lumaTc1,
+					&Beta1);
 				edgeStartFilteredSamplePtr = (EB_U16*)reconpicture->bufferY + reconpicture->originX + reconpicture->originY * reconpicture->strideY + (fourSampleEdgeStartSamplePos_y + lcuPos_y) * reconpicture->strideY + fourSampleEdgeStartSamplePos_x + lcuPos_x;
 
-				// 4 sample edge DLF core
-				lumaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
-					edgeStartFilteredSamplePtr,
-					reconpicture->strideY,
-					EB_TRUE,
-					lumaTc,
-					Beta);
+				if (isEdgePair) {
+					// 8 sample edge DLF core
+					rtcd.lumaDlf8Sample16bit(
+						edgeStartFilteredSamplePtr,
+						reconpicture->strideY,
+						EB_TRUE,
+						lumaTc,
+						Beta,
+						lumaTc1,
+						Beta1);
+				}
+				else {
+					// 4 sample edge DLF core
+					rtcd.lumaDlf16bit(
+						edgeStartFilteredSamplePtr,
+						reconpicture->strideY,
+						EB_TRUE,
+						lumaTc,
+						Beta);
+				}
 			}
 		}
 	}
 
-	// filter all horizontal edges
+	// filter all horizontal edges, two 4 sample edges at a time
 	for (verticalIdx = 1; verticalIdx <= numHorizontalLumaSampleEdges; ++verticalIdx) {
-		for (horizontalIdx = 1; horizontalIdx <= num4SampleEdgesPerHorizontalLumaSampleEdge; ++horizontalIdx) {
+		for (horizontalIdx = 1; horizontalIdx <= num4SampleEdgesPerHorizontalLumaSampleEdge; horizontalIdx += 2) {
 			// edge B
 			fourSampleEdgeStartSamplePos_x = horizontalIdx << 2;    // LCU-wise position
 			fourSampleEdgeStartSamplePos_y = verticalIdx << 3;      // LCU-wise position
@@ -2650,51 +2698,57 @@ EB_ERRORTYPE LCUInternalAreaDLFCore16bit(
 				fourSampleEdgeStartSamplePos_x,
 				fourSampleEdgeStartSamplePos_y,
 				logMaxLcuSizeIn4x4blk);
-			//neighbourBlk4x4Addr = blk4x4Addr - 1;
 
+			// the second edge belongs to the 4x4 block on the right; an odd last edge is filtered alone
+			isEdgePair = (EB_BOOL)(horizontalIdx < num4SampleEdgesPerHorizontalLumaSampleEdge);
 			bS = horizontalEdgeBSArray[BLK4X4_ADDR_TO_HORIZONTAL_EDGE_BS_ARRAY_IDX(blk4x4Addr)];
-			if (bS > 0) {
-				/** *Note - The PCMFlagArray initiallisation should be completely changed when we have PCM coding.
-				*/
-
-				// Qp for the current CU
-				CUqpIndex =
-					LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
+			bS1 = isEdgePair ? horizontalEdgeBSArray[BLK4X4_ADDR_TO_HORIZONTAL_EDGE_BS_ARRAY_IDX(blk4x4Addr + 1)] : 0;
+			if (bS > 0 || bS1 > 0) {
+				CalculateLumaEdgeTcBeta(
+					reconPictureControlSet,
 					fourSampleEdgeStartSamplePos_x + lcuPos_x,
 					fourSampleEdgeStartSamplePos_y + lcuPos_y,
-					reconPictureControlSet->qpArrayStride);
-
-
-				curCuQp = reconPictureControlSet->qpArray[CUqpIndex];
-
-				// Qp for the neighboring CU
-				CUqpIndex =
-					LUMA_SAMPLE_PIC_WISE_LOCATION_TO_QP_ARRAY_IDX(
-					fourSampleEdgeStartSamplePos_x + lcuPos_x,
-					fourSampleEdgeStartSamplePos_y + lcuPos_y - 1,
-					reconPictureControlSet->qpArrayStride);
-				// CUqpIndex     = ((CUqpIndex - (EB_S32)reconPictureControlSet->qpArrayStride) < 0) ? CUqpIndex : CUqpIndex - reconPictureControlSet->qpArrayStride;
-				neighbourCuQp = reconPictureControlSet->qpArray[CUqpIndex];
-				Qp = (curCuQp + neighbourCuQp + 1) >> 1;
-				lumaTc = TcTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE_PLUS_INTRA_TC_OFFSET, Qp + ((bS > 1) << 1) + reconPictureControlSet->tcOffset)];
-				Beta = BetaTable_8x8[CLIP3EQ(MIN_QP_VALUE, MAX_QP_VALUE, Qp + reconPictureControlSet->betaOffset)];
-
-				//CHKN
-				lumaTc = lumaTc << 2;
-				Beta = Beta << 2;
+					EB_FALSE,
+					bS,
+					2,
+					&lumaTc,
+					&Beta);
+				CalculateLumaEdgeTcBeta(
+					reconPictureControlSet,
+					fourSampleEdgeStartSamplePos_x + lcuPos_x + 4,
+					fourSampleEdgeStartSamplePos_y + lcuPos_y,
+					EB_FALSE,
+					bS1,
+					2,
+					&lumaTc1,
+					&Beta1);
 				edgeStartFilteredSamplePtr = (EB_U16*)reconpicture->bufferY + reconpicture->originX + reconpicture->originY * reconpicture->strideY + (fourSampleEdgeStartSamplePos_y + lcuPos_y) * reconpicture->strideY + fourSampleEdgeStartSamplePos_x + lcuPos_x;
 
-				// 4 sample edge DLF core
-				lumaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
-					edgeStartFilteredSamplePtr,
-					reconpicture->strideY,
-					EB_FALSE,
-					lumaTc,
-					Beta);
+				if (isEdgePair) {
+					// 8 sample edge DLF core
+					rtcd.lumaDlf8Sample16bit(
+						edgeStartFilteredSamplePtr,
+						reconpicture->strideY,
+						EB_FALSE,
+						lumaTc,
+						Beta,
+						lumaTc1,
+						Beta1);
+				}
+				else {
+					// 4 sample edge DLF core
+					rtcd.lumaDlf16bit(
+						edgeStartFilteredSamplePtr,
+						reconpicture->strideY,
+						EB_FALSE,
+						lumaTc,
+						Beta);
+				}
 			}
 		}
 	}
 
+
 	/***** chroma component filtering ****/
 	// filter all vertical edges
 	for (horizontalIdx = 1; horizontalIdx <= numVerticalChromaSampleEdges; ++horizontalIdx) {
@@ -2744,7 +2798,7 @@ EB_ERRORTYPE LCUInternalAreaDLFCore16bit(
 				edgeStartSampleCr = (EB_U16*)reconpicture->bufferCr + (reconpicture->originX >> subWidthCMinus1) + (reconpicture->originY >> subHeightCMinus1) * reconpicture->strideCr + (twoSampleEdgeStartSamplePos_y + chromaLcuPos_y) * reconpicture->strideCr + (twoSampleEdgeStartSamplePos_x + chromaLcuPos_x);
 
 
-				chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.chromaDlf16bit(
 					edgeStartSampleCb,
 					edgeStartSampleCr,
 					reconpicture->strideCb,
@@ -2803,7 +2857,7 @@ EB_ERRORTYPE LCUInternalAreaDLFCore16bit(
 				edgeStartSampleCb = (EB_U16*)reconpicture->bufferCb + (reconpicture->originX >> subWidthCMinus1) + (reconpicture->originY >> subHeightCMinus1) * reconpicture->strideCb + (twoSampleEdgeStartSamplePos_y + chromaLcuPos_y) * reconpicture->strideCb + (twoSampleEdgeStartSamplePos_x + chromaLcuPos_x);
 				edgeStartSampleCr = (EB_U16*)reconpicture->bufferCr + (reconpicture->originX >> subWidthCMinus1) + (reconpicture->originY >> subHeightCMinus1) * reconpicture->strideCr + (twoSampleEdgeStartSamplePos_y + chromaLcuPos_y) * reconpicture->strideCr + (twoSampleEdgeStartSamplePos_x + chromaLcuPos_x);
 
-				chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.chromaDlf16bit(
 					edgeStartSampleCb,
 					edgeStartSampleCr,
 					reconpicture->strideCb,
@@ -3625,7 +3679,7 @@ void LCUPictureEdgeDLFCore(
 				edgeStartFilteredSamplePtr = reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + fourSampleEdgeStartSamplePos_y * reconPic->strideY + fourSampleEdgeStartSamplePos_x;
 
 				// 4 sample luma edge filter core
-				Luma4SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.Luma4SampleEdgeDLFCore(
 					edgeStartFilteredSamplePtr,
 					reconPic->strideY,
 					EB_FALSE,
@@ -3684,7 +3738,7 @@ void LCUPictureEdgeDLFCore(
 					edgeStartSampleCb = reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + fourSampleEdgeStartSamplePos_y * reconPic->strideCb + fourSampleEdgeStartSamplePos_x;
 					edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + fourSampleEdgeStartSamplePos_y * reconPic->strideCr + fourSampleEdgeStartSamplePos_x;
 
-					Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+					rtcd.Chroma2SampleEdgeDLFCore(
 						edgeStartSampleCb,
 						edgeStartSampleCr,
 						reconPic->strideCb,
@@ -3733,7 +3787,7 @@ void LCUPictureEdgeDLFCore(
 					edgeStartSampleCb = reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + fourSampleEdgeStartSamplePos_y * reconPic->strideCb + (fourSampleEdgeStartSamplePos_x + 2);
 					edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + fourSampleEdgeStartSamplePos_y * reconPic->strideCr + (fourSampleEdgeStartSamplePos_x + 2);
 
-					Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+					rtcd.Chroma2SampleEdgeDLFCore(
 						edgeStartSampleCb,
 						edgeStartSampleCr,
 						reconPic->strideCb,
@@ -3793,7 +3847,7 @@ void LCUPictureEdgeDLFCore(
 				edgeStartFilteredSamplePtr = reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + fourSampleEdgeStartSamplePos_y * reconPic->strideY + fourSampleEdgeStartSamplePos_x;
 
 				// 4 sample edge luma filter core
-				Luma4SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.Luma4SampleEdgeDLFCore(
 					edgeStartFilteredSamplePtr,
 					reconPic->strideY,
 					EB_TRUE,
@@ -3855,7 +3909,7 @@ void LCUPictureEdgeDLFCore(
 					edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + fourSampleEdgeStartSamplePos_y * reconPic->strideCr + fourSampleEdgeStartSamplePos_x;
 
 
-					Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+					rtcd.Chroma2SampleEdgeDLFCore(
 						edgeStartSampleCb,
 						edgeStartSampleCr,
 						reconPic->strideCb,
@@ -3903,7 +3957,7 @@ void LCUPictureEdgeDLFCore(
 					edgeStartSampleCr = reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + (fourSampleEdgeStartSamplePos_y + 2) * reconPic->strideCr + fourSampleEdgeStartSamplePos_x;
 
 
-					Chroma2SampleEdgeDLFCore_Table[(ASM_TYPES & PREAVX2_MASK) && 1](
+					rtcd.Chroma2SampleEdgeDLFCore(
 						edgeStartSampleCb,
 						edgeStartSampleCr,
 						reconPic->strideCb,
@@ -4033,7 +4087,7 @@ void LCUPictureEdgeDLFCore16bit(
 				edgeStartFilteredSamplePtr = (EB_U16*)reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + fourSampleEdgeStartSamplePos_y * reconPic->strideY + fourSampleEdgeStartSamplePos_x;
 
 				// 4 sample luma edge filter core
-				lumaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.lumaDlf16bit(
 					edgeStartFilteredSamplePtr,
 					reconPic->strideY,
 					EB_FALSE,
@@ -4096,7 +4150,7 @@ void LCUPictureEdgeDLFCore16bit(
 					edgeStartSampleCb = ((EB_U16*)reconPic->bufferCb) + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + fourSampleEdgeStartSamplePos_y * reconPic->strideCb + fourSampleEdgeStartSamplePos_x;
 					edgeStartSampleCr = ((EB_U16*)reconPic->bufferCr) + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + fourSampleEdgeStartSamplePos_y * reconPic->strideCr + fourSampleEdgeStartSamplePos_x;
 
-					chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+					rtcd.chromaDlf16bit(
 						edgeStartSampleCb,
 						edgeStartSampleCr,
 						reconPic->strideCb,
@@ -4149,7 +4203,7 @@ void LCUPictureEdgeDLFCore16bit(
 					edgeStartSampleCb = ((EB_U16*)reconPic->bufferCb) + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + fourSampleEdgeStartSamplePos_y * reconPic->strideCb + (fourSampleEdgeStartSamplePos_x + 2);
 					edgeStartSampleCr = ((EB_U16*)reconPic->bufferCr) + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + fourSampleEdgeStartSamplePos_y * reconPic->strideCr + (fourSampleEdgeStartSamplePos_x + 2);
 
-					chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+					rtcd.chromaDlf16bit(
 						edgeStartSampleCb,
 						edgeStartSampleCr,
 						reconPic->strideCb,
@@ -4211,7 +4265,7 @@ void LCUPictureEdgeDLFCore16bit(
 				edgeStartFilteredSamplePtr = (EB_U16*)reconPic->bufferY + reconPic->originX + reconPic->originY * reconPic->strideY + fourSampleEdgeStartSamplePos_y * reconPic->strideY + fourSampleEdgeStartSamplePos_x;
 
 				// 4 sample edge luma filter core
-				lumaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.lumaDlf16bit(
 					edgeStartFilteredSamplePtr,
 					reconPic->strideY,
 					EB_TRUE,
@@ -4274,7 +4328,7 @@ void LCUPictureEdgeDLFCore16bit(
 					edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + fourSampleEdgeStartSamplePos_y * reconPic->strideCr + fourSampleEdgeStartSamplePos_x;
 
 
-					chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+					rtcd.chromaDlf16bit(
 						edgeStartSampleCb,
 						edgeStartSampleCr,
 						reconPic->strideCb,
@@ -4325,7 +4379,7 @@ void LCUPictureEdgeDLFCore16bit(
 					edgeStartSampleCb = (EB_U16*)reconPic->bufferCb + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCb + (fourSampleEdgeStartSamplePos_y + 2) * reconPic->strideCb + fourSampleEdgeStartSamplePos_x;
 					edgeStartSampleCr = (EB_U16*)reconPic->bufferCr + (reconPic->originX >> subWidthCMinus1) + (reconPic->originY >> subHeightCMinus1) * reconPic->strideCr + (fourSampleEdgeStartSamplePos_y + 2) * reconPic->strideCr + fourSampleEdgeStartSamplePos_x;
 
-					chromaDlf_funcPtrArray16bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+					rtcd.chromaDlf16bit(
 						edgeStartSampleCb,
 						edgeStartSampleCr,
 						reconPic->strideCb,
@@ -6,6 +6,7 @@
 #include "EbDeblockingFilter_C.h"
 #include "EbDeblockingFilter_SSE2.h"
 #include "EbDeblockingFilter_SSSE3.h"
+#include "EbDeblockingFilter_AVX2.h"
 
 
 #include "EbPredictionUnit.h"
@@ -212,6 +213,15 @@ typedef void(*EB_LUMA4SAMPLEDGEDLF_FUNC)(
     EB_S32                 tc,
     EB_S32                 beta);
 
+typedef void(*EB_LUMA8SAMPLEDGEDLF_FUNC)(
+    EB_BYTE                edgeStartSample,
+    EB_U32                 reconLumaPicStride,
+    EB_BOOL                isVerticalEdge,
+    EB_S32                 tc0,
+    EB_S32                 beta0,
+    EB_S32                 tc1,
+    EB_S32                 beta1);
+
 typedef void(*EB_CHROMA2SAMPLEDGEDLF_FUNC)(
     EB_BYTE                edgeStartSampleCb,
     EB_BYTE                edgeStartSampleCr,
@@ -235,38 +245,15 @@ typedef void(*EB_LUMADLF_TYPE_16BIT)(
     EB_S32          tc,
     EB_S32          beta);
 
-/***************************************
-* Function Ptr Types
-***************************************/
-static EB_LUMA4SAMPLEDGEDLF_FUNC FUNC_TABLE Luma4SampleEdgeDLFCore_Table[EB_ASM_TYPE_TOTAL] =
-{  
-	// C_DEFAULT
-    Luma4SampleEdgeDLFCore,
-    // AVX2
-    Luma4SampleEdgeDLFCore_SSSE3,
-};
-
-static EB_CHROMA2SAMPLEDGEDLF_FUNC FUNC_TABLE Chroma2SampleEdgeDLFCore_Table[EB_ASM_TYPE_TOTAL] =
-{
-    // C_DEFAULT
-    Chroma2SampleEdgeDLFCore,
-    // AVX2
-    Chroma2SampleEdgeDLFCore_SSSE3,
-};
-
-static EB_CHROMADLF_TYPE_16BIT FUNC_TABLE chromaDlf_funcPtrArray16bit[EB_ASM_TYPE_TOTAL] = {
-    // C_DEFAULT
-    Chroma2SampleEdgeDLFCore16bit,
-    // AVX2
-    Chroma2SampleEdgeDLFCore16bit_SSE2_INTRIN,
-};
-
-static EB_LUMADLF_TYPE_16BIT FUNC_TABLE lumaDlf_funcPtrArray16bit[EB_ASM_TYPE_TOTAL] = {
-    // C_DEFAULT
-    Luma4SampleEdgeDLFCore16bit,
-    // AVX2
-    Luma4SampleEdgeDLFCore16bit_SSSE3_INTRIN,
-};
+typedef void(*EB_LUMA8DLF_TYPE_16BIT)(
+    EB_U16         *edgeStartFilteredSamplePtr,
+    EB_U32          reconLumaPicStride,
+    EB_BOOL         isVerticalEdge,
+    EB_S32          tc0,
+    EB_S32          beta0,
+    EB_S32          tc1,
+    EB_S32          beta1);
+
 
 #ifdef __cplusplus
 }
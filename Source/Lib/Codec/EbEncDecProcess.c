@@ -4,6 +4,7 @@
 */
 
 #include <stdlib.h>
+#include <math.h>
 
 
 #include "EbTransforms.h"
@@ -14,6 +15,8 @@
 #include "EbSampleAdaptiveOffset.h"
 #include "EbErrorCodes.h"
 #include "EbErrorHandling.h"
+#include "EbTime.h"
+#include "EbRtcd.h"
 
 
 void PrecomputeCabacCost(CabacCost_t            *CabacCostPtr,
@@ -47,6 +50,7 @@ EB_ERRORTYPE EncDecContextCtor(
     EbFifo_t                *packetizationOutputFifoPtr,
     EbFifo_t                *feedbackFifoPtr,
     EbFifo_t                *pictureDemuxFifoPtr,
+    EB_U32                   encDecProcessCount,
     EB_BOOL                  is16bit,
     EB_COLOR_FORMAT          colorFormat)
 {
@@ -63,6 +67,7 @@ EB_ERRORTYPE EncDecContextCtor(
     contextPtr->encDecOutputFifoPtr = packetizationOutputFifoPtr;
     contextPtr->encDecFeedbackFifoPtr = feedbackFifoPtr;
     contextPtr->pictureDemuxOutputFifoPtr = pictureDemuxFifoPtr;
+    contextPtr->encDecProcessCount = encDecProcessCount;
 
     // Trasform Scratch Memory
     EB_MALLOC(EB_S16*, contextPtr->transformInnerArrayPtr, 3152, EB_N_PTR); //refer to EbInvTransform_SSE2.as. case 32x32
@@ -284,7 +289,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu(
         }
 
 
-        SaoFunctionTableEO_0_90[(ASM_TYPES & PREAVX2_MASK) && 1][(saoPtr->saoTypeIndex[isChroma]) - 1][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
+        rtcd.SaoFunctionTableEO_0_90[(saoPtr->saoTypeIndex[isChroma]) - 1][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
             reconSamplePtr,
             reconStride,
             temporalBufferLeft,
@@ -324,7 +329,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu(
                 tmp[i] = reconSamplePtr[i + reconStride*(lcuHeight - 1)];
             }
         }
-        SaoFunctionTableEO_0_90[(ASM_TYPES & PREAVX2_MASK) && 1][(saoPtr->saoTypeIndex[isChroma]) - 1][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
+        rtcd.SaoFunctionTableEO_0_90[(saoPtr->saoTypeIndex[isChroma]) - 1][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
             reconSamplePtr,
             reconStride,
             temporalBufferUpper,
@@ -380,7 +385,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu(
             }
         }
 
-        SaoFunctionTableEO_135_45[(ASM_TYPES & PREAVX2_MASK) && 1][(saoPtr->saoTypeIndex[isChroma]) - 3][(lcuHeight == MAX_LCU_SIZE_REMAINING) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
+        rtcd.SaoFunctionTableEO_135_45[(saoPtr->saoTypeIndex[isChroma]) - 3][(lcuHeight == MAX_LCU_SIZE_REMAINING) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
             reconSamplePtr,
             reconStride,
             temporalBufferLeft,
@@ -446,7 +451,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu(
             }
         }
 
-        SaoFunctionTableEO_135_45[(ASM_TYPES & PREAVX2_MASK) && 1][(saoPtr->saoTypeIndex[isChroma]) - 3][(lcuHeight == MAX_LCU_SIZE_REMAINING) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
+        rtcd.SaoFunctionTableEO_135_45[(saoPtr->saoTypeIndex[isChroma]) - 3][(lcuHeight == MAX_LCU_SIZE_REMAINING) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
             reconSamplePtr,
             reconStride,
             temporalBufferLeft,
@@ -481,7 +486,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu(
 
     case 5: // BO
 
-        SaoFunctionTableBo[(ASM_TYPES & PREAVX2_MASK) && 1][((lcuWidth & 15) == 0 && (lcuHeight != MAX_LCU_SIZE_REMAINING))](
+        rtcd.SaoFunctionTableBo[((lcuWidth & 15) == 0 && (lcuHeight != MAX_LCU_SIZE_REMAINING))](
             reconSamplePtr,
             reconStride,
             saoPtr->saoBandPosition[videoComponent],
@@ -812,7 +817,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu16bit(
         }
 
 
-        SaoFunctionTableEO_0_90_16bit[(ASM_TYPES & PREAVX2_MASK) && 1][(saoPtr->saoTypeIndex[isChroma]) - 1][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
+        rtcd.SaoFunctionTableEO_0_90_16bit[(saoPtr->saoTypeIndex[isChroma]) - 1][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
             reconSamplePtr,
             reconStride,
             temporalBufferLeft,
@@ -853,7 +858,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu16bit(
             }
         }
 
-        SaoFunctionTableEO_0_90_16bit[(ASM_TYPES & PREAVX2_MASK) && 1][(saoPtr->saoTypeIndex[isChroma]) - 1][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
+        rtcd.SaoFunctionTableEO_0_90_16bit[(saoPtr->saoTypeIndex[isChroma]) - 1][((lcuHeight & 15) == 0) && ((lcuWidth & 15) == 0) && (lcuWidth >= 32)](
             reconSamplePtr,
             reconStride,
             temporalBufferUpper,
@@ -909,7 +914,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu16bit(
             }
         }
 
-        SaoFunctionTableEO_135_45_16bit[(ASM_TYPES & PREAVX2_MASK) && 1][(saoPtr->saoTypeIndex[isChroma]) - 3][((lcuWidth & 15) == 0) && (lcuWidth >= 32) && ((lcuHeight & 7) == 0) && (lcuHeight >= 8)](
+        rtcd.SaoFunctionTableEO_135_45_16bit[(saoPtr->saoTypeIndex[isChroma]) - 3][((lcuWidth & 15) == 0) && (lcuWidth >= 32) && ((lcuHeight & 7) == 0) && (lcuHeight >= 8)](
             reconSamplePtr,
             reconStride,
             temporalBufferLeft,
@@ -975,7 +980,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu16bit(
             }
         }
 
-        SaoFunctionTableEO_135_45_16bit[(ASM_TYPES & PREAVX2_MASK) && 1][(saoPtr->saoTypeIndex[isChroma]) - 3][((lcuWidth & 15) == 0) && (lcuWidth >= 32) && ((lcuHeight & 7) == 0) && (lcuHeight >= 8)](
+        rtcd.SaoFunctionTableEO_135_45_16bit[(saoPtr->saoTypeIndex[isChroma]) - 3][((lcuWidth & 15) == 0) && (lcuWidth >= 32) && ((lcuHeight & 7) == 0) && (lcuHeight >= 8)](
             reconSamplePtr,
             reconStride,
             temporalBufferLeft,
@@ -1010,7 +1015,7 @@ static EB_ERRORTYPE ApplySaoOffsetsLcu16bit(
 
     case 5: // BO
 
-        SaoFunctionTableBo_16bit[(ASM_TYPES & PREAVX2_MASK) && 1][((lcuWidth & 15) == 0)](
+        rtcd.SaoFunctionTableBo_16bit[((lcuWidth & 15) == 0)](
             reconSamplePtr,
             reconStride,
             saoPtr->saoBandPosition[videoComponent],
@@ -1631,6 +1636,42 @@ EB_BOOL AssignEncDecSegments(
 
     return continueProcessingFlag;
 }
+/**************************************************
+ * Recon Output Decimated Plane
+ *   writes the rounded 2x2 / 4x4 block mean of a
+ *   recon plane, used for the preview recon output
+ **************************************************/
+static void ReconOutputDecimatedPlane(
+    EB_U8                  *reconReadPtr,
+    EB_U32                  reconStride,
+    EB_U8                  *reconWritePtr,
+    EB_U32                  outputWidth,
+    EB_U32                  outputHeight,
+    EB_U32                  decimationShift,
+    EB_BOOL                 is16bit)
+{
+    if (is16bit) {
+        rtcd.DecimateAverage16bit[decimationShift - 1](
+            (EB_U16*)reconReadPtr,
+            reconStride,
+            (EB_U16*)reconWritePtr,
+            outputWidth,
+            outputWidth,
+            outputHeight);
+    }
+    else {
+        rtcd.DecimateAverage[decimationShift - 1](
+            reconReadPtr,
+            reconStride,
+            reconWritePtr,
+            outputWidth,
+            outputWidth,
+            outputHeight);
+    }
+
+    return;
+}
+
 static void ReconOutput(
     PictureControlSet_t    *pictureControlSetPtr,
     SequenceControlSet_t   *sequenceControlSetPtr)
@@ -1643,6 +1684,8 @@ static void ReconOutput(
     const EB_COLOR_FORMAT colorFormat = (EB_COLOR_FORMAT)sequenceControlSetPtr->chromaFormatIdc;
     const EB_U16 subWidthCMinus1 = (colorFormat == EB_YUV444 ? 1 : 2) - 1;
     const EB_U16 subHeightCMinus1 = (colorFormat >= EB_YUV422 ? 1 : 2) - 1;
+    const EB_U32 decimationShift = (sequenceControlSetPtr->staticConfig.reconDecimation == 4) ? 2 :
+                                   (sequenceControlSetPtr->staticConfig.reconDecimation == 2) ? 1 : 0;
 
     // Get Recon Buffer
     EbGetEmptyObject( 
@@ -1674,72 +1717,123 @@ static void ReconOutput(
             }
         }
 
-        // Y Recon Samples
-        sampleTotalCount = ((reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) * (reconPtr->maxHeight - sequenceControlSetPtr->maxInputPadBottom)) << is16bit;
-        reconReadPtr = reconPtr->bufferY + (reconPtr->originY << is16bit) * reconPtr->strideY + (reconPtr->originX << is16bit);
-        reconWritePtr = &(outputReconPtr->pBuffer[outputReconPtr->nFilledLen]);
-
-        CHECK_REPORT_ERROR(
-            (outputReconPtr->nFilledLen + sampleTotalCount <= outputReconPtr->nAllocLen),
-            encodeContextPtr->appCallbackPtr,
-            EB_ENC_ROB_OF_ERROR);
-
-        // Initialize Y recon buffer
-        PictureCopyKernel(
-            reconReadPtr,
-            reconPtr->strideY,
-            reconWritePtr,
-            reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight,
-            reconPtr->width - sequenceControlSetPtr->padRight,
-            reconPtr->height - sequenceControlSetPtr->padBottom,
-            1 << is16bit);
-
-        outputReconPtr->nFilledLen += sampleTotalCount;
-
-        // U Recon Samples
-        sampleTotalCount = ((reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) * (reconPtr->maxHeight - sequenceControlSetPtr->maxInputPadBottom) >> (3 - colorFormat)) << is16bit;
-        reconReadPtr = reconPtr->bufferCb + ((reconPtr->originX << is16bit) >> subWidthCMinus1) +
-            ((reconPtr->originY << is16bit) >> subHeightCMinus1) * reconPtr->strideCb;
-        reconWritePtr = &(outputReconPtr->pBuffer[outputReconPtr->nFilledLen]);
-
-        CHECK_REPORT_ERROR(
-            (outputReconPtr->nFilledLen + sampleTotalCount <= outputReconPtr->nAllocLen),
-            encodeContextPtr->appCallbackPtr,
-            EB_ENC_ROB_OF_ERROR);
-
-        // Initialize U recon buffer
-        PictureCopyKernel(
-            reconReadPtr,
-            reconPtr->strideCb,
-            reconWritePtr,
-            (reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) >> subWidthCMinus1,
-            (reconPtr->width - sequenceControlSetPtr->padRight) >> subWidthCMinus1,
-            (reconPtr->height - sequenceControlSetPtr->padBottom) >> subHeightCMinus1,
-            1 << is16bit);
-        outputReconPtr->nFilledLen += sampleTotalCount;
-
-        // V Recon Samples
-        sampleTotalCount = ((reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) * (reconPtr->maxHeight - sequenceControlSetPtr->maxInputPadBottom) >> (3 - colorFormat)) << is16bit;
-        reconReadPtr = reconPtr->bufferCr + ((reconPtr->originX << is16bit) >> subWidthCMinus1) +
-            ((reconPtr->originY << is16bit) >> subHeightCMinus1) * reconPtr->strideCr;
-        reconWritePtr = &(outputReconPtr->pBuffer[outputReconPtr->nFilledLen]);
-
-        CHECK_REPORT_ERROR(
-            (outputReconPtr->nFilledLen + sampleTotalCount <= outputReconPtr->nAllocLen),
-            encodeContextPtr->appCallbackPtr,
-            EB_ENC_ROB_OF_ERROR);
-
-        // Initialize V recon buffer
-
-        PictureCopyKernel(
-            reconReadPtr,
-            reconPtr->strideCr,
-            reconWritePtr,
-            (reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) >> subWidthCMinus1,
-            (reconPtr->width - sequenceControlSetPtr->padRight) >> subWidthCMinus1,
-            (reconPtr->height - sequenceControlSetPtr->padBottom) >> subHeightCMinus1,
-            1 << is16bit);
-        outputReconPtr->nFilledLen += sampleTotalCount;
+        if (decimationShift) {
+            // Preview Recon: each plane is decimated by averaging 2x2 / 4x4 blocks
+            const EB_U32 lumaWidth = (reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) >> decimationShift;
+            const EB_U32 lumaHeight = (reconPtr->maxHeight - sequenceControlSetPtr->maxInputPadBottom) >> decimationShift;
+            const EB_U32 chromaWidth = ((reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) >> subWidthCMinus1) >> decimationShift;
+            const EB_U32 chromaHeight = ((reconPtr->maxHeight - sequenceControlSetPtr->maxInputPadBottom) >> subHeightCMinus1) >> decimationShift;
+
+            sampleTotalCount = ((lumaWidth * lumaHeight) + 2 * (chromaWidth * chromaHeight)) << is16bit;
+
+            CHECK_REPORT_ERROR(
+                (sampleTotalCount <= outputReconPtr->nAllocLen),
+                encodeContextPtr->appCallbackPtr,
+                EB_ENC_ROB_OF_ERROR);
+
+            // Y Recon Samples
+            reconWritePtr = outputReconPtr->pBuffer;
+            ReconOutputDecimatedPlane(
+                reconPtr->bufferY + (reconPtr->originY << is16bit) * reconPtr->strideY + (reconPtr->originX << is16bit),
+                reconPtr->strideY,
+                reconWritePtr,
+                lumaWidth,
+                lumaHeight,
+                decimationShift,
+                is16bit);
+            reconWritePtr += (lumaWidth * lumaHeight) << is16bit;
+
+            // U Recon Samples
+            ReconOutputDecimatedPlane(
+                reconPtr->bufferCb + ((reconPtr->originX << is16bit) >> subWidthCMinus1) + ((reconPtr->originY << is16bit) >> subHeightCMinus1) * reconPtr->strideCb,
+                reconPtr->strideCb,
+                reconWritePtr,
+                chromaWidth,
+                chromaHeight,
+                decimationShift,
+                is16bit);
+            reconWritePtr += (chromaWidth * chromaHeight) << is16bit;
+
+            // V Recon Samples
+            ReconOutputDecimatedPlane(
+                reconPtr->bufferCr + ((reconPtr->originX << is16bit) >> subWidthCMinus1) + ((reconPtr->originY << is16bit) >> subHeightCMinus1) * reconPtr->strideCr,
+                reconPtr->strideCr,
+                reconWritePtr,
+                chromaWidth,
+                chromaHeight,
+                decimationShift,
+                is16bit);
+
+            outputReconPtr->nFilledLen = sampleTotalCount;
+        }
+        else {
+            // Y Recon Samples
+            sampleTotalCount = ((reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) * (reconPtr->maxHeight - sequenceControlSetPtr->maxInputPadBottom)) << is16bit;
+            reconReadPtr = reconPtr->bufferY + (reconPtr->originY << is16bit) * reconPtr->strideY + (reconPtr->originX << is16bit);
+            reconWritePtr = &(outputReconPtr->pBuffer[outputReconPtr->nFilledLen]);
+
+            CHECK_REPORT_ERROR(
+                (outputReconPtr->nFilledLen + sampleTotalCount <= outputReconPtr->nAllocLen),
+                encodeContextPtr->appCallbackPtr,
+                EB_ENC_ROB_OF_ERROR);
+
+            // Initialize Y recon buffer
+            PictureCopyKernel(
+                reconReadPtr,
+                reconPtr->strideY,
+                reconWritePtr,
+                reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight,
+                reconPtr->width - sequenceControlSetPtr->padRight,
+                reconPtr->height - sequenceControlSetPtr->padBottom,
+                1 << is16bit);
+
+            outputReconPtr->nFilledLen += sampleTotalCount;
+
+            // U Recon Samples
+            sampleTotalCount = ((reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) * (reconPtr->maxHeight - sequenceControlSetPtr->maxInputPadBottom) >> (3 - colorFormat)) << is16bit;
+            reconReadPtr = reconPtr->bufferCb + ((reconPtr->originX << is16bit) >> subWidthCMinus1) +
+                ((reconPtr->originY << is16bit) >> subHeightCMinus1) * reconPtr->strideCb;
+            reconWritePtr = &(outputReconPtr->pBuffer[outputReconPtr->nFilledLen]);
+
+            CHECK_REPORT_ERROR(
+                (outputReconPtr->nFilledLen + sampleTotalCount <= outputReconPtr->nAllocLen),
+                encodeContextPtr->appCallbackPtr,
+                EB_ENC_ROB_OF_ERROR);
+
+            // Initialize U recon buffer
+            PictureCopyKernel(
+                reconReadPtr,
+                reconPtr->strideCb,
+                reconWritePtr,
+                (reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) >> subWidthCMinus1,
+                (reconPtr->width - sequenceControlSetPtr->padRight) >> subWidthCMinus1,
+                (reconPtr->height - sequenceControlSetPtr->padBottom) >> subHeightCMinus1,
+                1 << is16bit);
+            outputReconPtr->nFilledLen += sampleTotalCount;
+
+            // V Recon Samples
+            sampleTotalCount = ((reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) * (reconPtr->maxHeight - sequenceControlSetPtr->maxInputPadBottom) >> (3 - colorFormat)) << is16bit;
+            reconReadPtr = reconPtr->bufferCr + ((reconPtr->originX << is16bit) >> subWidthCMinus1) +
+                ((reconPtr->originY << is16bit) >> subHeightCMinus1) * reconPtr->strideCr;
+            reconWritePtr = &(outputReconPtr->pBuffer[outputReconPtr->nFilledLen]);
+
+            CHECK_REPORT_ERROR(
+                (outputReconPtr->nFilledLen + sampleTotalCount <= outputReconPtr->nAllocLen),
+                encodeContextPtr->appCallbackPtr,
+                EB_ENC_ROB_OF_ERROR);
+
+            // Initialize V recon buffer
+
+            PictureCopyKernel(
+                reconReadPtr,
+                reconPtr->strideCr,
+                reconWritePtr,
+                (reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight) >> subWidthCMinus1,
+                (reconPtr->width - sequenceControlSetPtr->padRight) >> subWidthCMinus1,
+                (reconPtr->height - sequenceControlSetPtr->padBottom) >> subHeightCMinus1,
+                1 << is16bit);
+            outputReconPtr->nFilledLen += sampleTotalCount;
+        }
         outputReconPtr->pts = pictureControlSetPtr->pictureNumber;
     }
 
@@ -1762,6 +1856,492 @@ static void ReconOutput(
     
 }
 
+/******************************************************
+* Quality Metrics Block Sums
+*   4x4 block sums (source, recon, squares, cross) of
+*   blockHeight block rows of one LCU plane, stored from
+*   column 1 on (column 0 holds the last block column of
+*   the LCU on the left)
+******************************************************/
+#define QUALITY_METRICS_BLOCK_COUNT ((MAX_LCU_SIZE >> 2) + 1)
+
+static void QualityMetricsBlockSums(
+    EB_U8                  *inputPtr,
+    EB_U32                  inputStride,
+    EB_U8                  *reconPtr,
+    EB_U32                  reconStride,
+    EB_U32                  blockWidth,
+    EB_U32                  blockHeight,
+    EB_BOOL                 is16bit,
+    EB_U32                  blockSums[][QUALITY_METRICS_BLOCK_COUNT][4])
+{
+    EB_U32 blockY;
+
+    for (blockY = 0; blockY < blockHeight; ++blockY) {
+        if (is16bit) {
+            rtcd.SsimBlockSums16bit(
+                (EB_U16*)inputPtr + 4 * blockY * inputStride,
+                inputStride,
+                (EB_U16*)reconPtr + 4 * blockY * reconStride,
+                reconStride,
+                &blockSums[blockY][1],
+                blockWidth);
+        }
+        else {
+            rtcd.SsimBlockSums(
+                inputPtr + 4 * blockY * inputStride,
+                inputStride,
+                reconPtr + 4 * blockY * reconStride,
+                reconStride,
+                &blockSums[blockY][1],
+                blockWidth);
+        }
+    }
+
+    return;
+}
+
+/******************************************************
+* Quality Metrics Windows
+*   accumulates the SSIM of the 8x8 windows (on a
+*   4-sample grid) whose top-left 4x4 block lies in the
+*   LCU plane. Together with the carried left column and
+*   the first block row of the LCU below, the windows
+*   tile the whole plane as in the standard 8x8 SSIM.
+******************************************************/
+static void QualityMetricsWindows(
+    EB_U32                  blockSums[][QUALITY_METRICS_BLOCK_COUNT][4],
+    EB_U32                  firstColumn,
+    EB_U32                  blockWidth,
+    EB_U32                  blockRowCount,
+    EB_U32                  bitDepth,
+    double                 *ssimSum,
+    EB_U32                 *ssimCount)
+{
+    const double maxValue = (double)((1 << bitDepth) - 1);
+    const double c1 = .01 * .01 * maxValue * maxValue * 64;
+    const double c2 = .03 * .03 * maxValue * maxValue * 64 * 63;
+    EB_U32 blockX;
+    EB_U32 blockY;
+    EB_U32 i;
+
+    for (blockY = 0; blockY + 1 < blockRowCount; ++blockY) {
+        for (blockX = firstColumn; blockX < blockWidth; ++blockX) {
+            double sum[4];
+            double variance;
+            double covariance;
+            for (i = 0; i < 4; ++i) {
+                sum[i] = (double)blockSums[blockY][blockX][i] + blockSums[blockY][blockX + 1][i] +
+                         blockSums[blockY + 1][blockX][i] + blockSums[blockY + 1][blockX + 1][i];
+            }
+            variance = sum[2] * 64 - sum[0] * sum[0] - sum[1] * sum[1];
+            covariance = sum[3] * 64 - sum[0] * sum[1];
+            *ssimSum += (2 * sum[0] * sum[1] + c1) * (2 * covariance + c2) /
+                        ((sum[0] * sum[0] + sum[1] * sum[1] + c1) * (variance + c2));
+            ++(*ssimCount);
+        }
+    }
+
+    // Carry the last block column to the LCU on the right
+    for (blockY = 0; blockY < blockRowCount; ++blockY) {
+        for (i = 0; i < 4; ++i)
+            blockSums[blockY][0][i] = blockSums[blockY][blockWidth][i];
+    }
+
+    return;
+}
+
+/******************************************************
+* Quality Metrics Input Plane
+*   source samples of one plane at an LCU origin; the
+*   16bit source is only available packed per LCU, in
+*   the context buffer
+******************************************************/
+static EB_U8* QualityMetricsInputPlane(
+    EncDecContext_t        *contextPtr,
+    EbPictureBufferDesc_t  *inputPicturePtr,
+    EB_BOOL                 is16bit,
+    EB_U32                  planeIndex,
+    EB_U32                  lcuOriginX,
+    EB_U32                  lcuOriginY,
+    EB_U32                  shiftX,
+    EB_U32                  shiftY,
+    EB_U32                 *inputStride)
+{
+    if (is16bit) {
+        EbPictureBufferDesc_t *packedPtr = contextPtr->inputSample16bitBuffer;
+        *inputStride = planeIndex == 0 ? packedPtr->strideY : planeIndex == 1 ? packedPtr->strideCb : packedPtr->strideCr;
+        return planeIndex == 0 ? packedPtr->bufferY : planeIndex == 1 ? packedPtr->bufferCb : packedPtr->bufferCr;
+    }
+    else {
+        EB_U8 *inputBuffer = planeIndex == 0 ? inputPicturePtr->bufferY : planeIndex == 1 ? inputPicturePtr->bufferCb : inputPicturePtr->bufferCr;
+        *inputStride = planeIndex == 0 ? inputPicturePtr->strideY : planeIndex == 1 ? inputPicturePtr->strideCb : inputPicturePtr->strideCr;
+        return inputBuffer + ((inputPicturePtr->originY + lcuOriginY) >> shiftY) * (*inputStride) + ((inputPicturePtr->originX + lcuOriginX) >> shiftX);
+    }
+}
+
+/******************************************************
+* Quality Metrics LCU Row
+*   accumulates the SSE / SSIM sums of the final
+*   (deblocked + SAO) recon of one LCU row, per plane,
+*   one LCU at a time while its samples are cache-hot
+******************************************************/
+static void QualityMetricsLcuRow(
+    EncDecContext_t        *contextPtr,
+    PictureControlSet_t    *pictureControlSetPtr,
+    SequenceControlSet_t   *sequenceControlSetPtr,
+    EbPictureBufferDesc_t  *reconPtr,
+    EB_U32                  lcuRowIndex,
+    EB_U64                 *sse,
+    double                 *ssimSum,
+    EB_U32                 *ssimCount)
+{
+    const EB_BOOL is16bit = (sequenceControlSetPtr->staticConfig.encoderBitDepth > EB_8BIT);
+    const EB_U32 bitDepth = sequenceControlSetPtr->staticConfig.encoderBitDepth;
+    const EB_COLOR_FORMAT colorFormat = (EB_COLOR_FORMAT)sequenceControlSetPtr->chromaFormatIdc;
+    const EB_U16 subWidthCMinus1 = (colorFormat == EB_YUV444 ? 1 : 2) - 1;
+    const EB_U16 subHeightCMinus1 = (colorFormat >= EB_YUV422 ? 1 : 2) - 1;
+    const EB_U32 pictureWidthInLcu = (sequenceControlSetPtr->lumaWidth + sequenceControlSetPtr->lcuSize - 1) / sequenceControlSetPtr->lcuSize;
+    const EB_U32 pictureWidth = reconPtr->maxWidth - sequenceControlSetPtr->maxInputPadRight;
+    const EB_U32 pictureHeight = reconPtr->maxHeight - sequenceControlSetPtr->maxInputPadBottom;
+    EbPictureBufferDesc_t *inputPicturePtr = (EbPictureBufferDesc_t*)pictureControlSetPtr->ParentPcsPtr->enhancedPicturePtr;
+    EB_U32 blockSums[3][QUALITY_METRICS_BLOCK_COUNT][QUALITY_METRICS_BLOCK_COUNT][4];
+    EB_U32 lcuIndex;
+    EB_U32 planeIndex;
+
+    for (lcuIndex = lcuRowIndex * pictureWidthInLcu; lcuIndex < (lcuRowIndex + 1) * pictureWidthInLcu; ++lcuIndex) {
+        LcuParams_t *lcuParams = &sequenceControlSetPtr->lcuParamsArray[lcuIndex];
+        const EB_U32 lcuOriginX = lcuParams->originX;
+        const EB_U32 lcuOriginY = lcuParams->originY;
+        EB_U32 blockRowCount[3];
+        EB_U32 lcuWidth;
+        EB_U32 lcuHeight;
+
+        if (lcuOriginX >= pictureWidth || lcuOriginY >= pictureHeight)
+            continue;
+
+        lcuWidth = MIN(lcuParams->width, pictureWidth - lcuOriginX);
+        lcuHeight = MIN(lcuParams->height, pictureHeight - lcuOriginY);
+
+        // The windows straddling the LCU below take its first block row
+        if (is16bit && lcuOriginY + lcuHeight < pictureHeight) {
+            LcuParams_t *belowLcuParams = &sequenceControlSetPtr->lcuParamsArray[lcuIndex + pictureWidthInLcu];
+            EncodePassPackLcu(
+                sequenceControlSetPtr,
+                inputPicturePtr,
+                contextPtr,
+                belowLcuParams->originX,
+                belowLcuParams->originY,
+                belowLcuParams->width,
+                belowLcuParams->height);
+        }
+
+        for (planeIndex = 0; planeIndex < 3; ++planeIndex) {
+            const EB_U32 shiftX = planeIndex ? subWidthCMinus1 : 0;
+            const EB_U32 shiftY = planeIndex ? subHeightCMinus1 : 0;
+            const EB_U32 blockWidth = (lcuWidth >> shiftX) >> 2;
+            const EB_U32 blockHeight = (lcuHeight >> shiftY) >> 2;
+            const EB_U32 belowHeight = (pictureHeight >> shiftY) - ((lcuOriginY + lcuHeight) >> shiftY);
+            EB_U8 *reconBuffer = planeIndex == 0 ? reconPtr->bufferY : planeIndex == 1 ? reconPtr->bufferCb : reconPtr->bufferCr;
+            const EB_U32 reconStride = planeIndex == 0 ? reconPtr->strideY : planeIndex == 1 ? reconPtr->strideCb : reconPtr->strideCr;
+            EB_U8 *inputBuffer;
+            EB_U32 inputStride;
+
+            blockRowCount[planeIndex] = blockHeight;
+            if ((lcuHeight >> shiftY) == (blockHeight << 2) && belowHeight >= 4) {
+                inputBuffer = QualityMetricsInputPlane(
+                    contextPtr,
+                    inputPicturePtr,
+                    is16bit,
+                    planeIndex,
+                    lcuOriginX,
+                    lcuOriginY + lcuHeight,
+                    shiftX,
+                    shiftY,
+                    &inputStride);
+
+                QualityMetricsBlockSums(
+                    inputBuffer,
+                    inputStride,
+                    reconBuffer + ((((reconPtr->originY + lcuOriginY + lcuHeight) >> shiftY) * reconStride + ((reconPtr->originX + lcuOriginX) >> shiftX)) << is16bit),
+                    reconStride,
+                    blockWidth,
+                    1,
+                    is16bit,
+                    &blockSums[planeIndex][blockHeight]);
+
+                ++blockRowCount[planeIndex];
+            }
+        }
+
+        if (is16bit) {
+            EncodePassPackLcu(
+                sequenceControlSetPtr,
+                inputPicturePtr,
+                contextPtr,
+                lcuOriginX,
+                lcuOriginY,
+                lcuParams->width,
+                lcuParams->height);
+        }
+
+        for (planeIndex = 0; planeIndex < 3; ++planeIndex) {
+            const EB_U32 shiftX = planeIndex ? subWidthCMinus1 : 0;
+            const EB_U32 shiftY = planeIndex ? subHeightCMinus1 : 0;
+            EB_U8 *reconBuffer = planeIndex == 0 ? reconPtr->bufferY : planeIndex == 1 ? reconPtr->bufferCb : reconPtr->bufferCr;
+            const EB_U32 reconStride = planeIndex == 0 ? reconPtr->strideY : planeIndex == 1 ? reconPtr->strideCb : reconPtr->strideCr;
+            EB_U8 *inputBuffer;
+            EB_U32 inputStride;
+
+            reconBuffer += (((reconPtr->originY + lcuOriginY) >> shiftY) * reconStride + ((reconPtr->originX + lcuOriginX) >> shiftX)) << is16bit;
+            inputBuffer = QualityMetricsInputPlane(
+                contextPtr,
+                inputPicturePtr,
+                is16bit,
+                planeIndex,
+                lcuOriginX,
+                lcuOriginY,
+                shiftX,
+                shiftY,
+                &inputStride);
+
+            if (is16bit) {
+                sse[planeIndex] += rtcd.PictureSse16bit(
+                    (EB_U16*)inputBuffer,
+                    inputStride,
+                    (EB_U16*)reconBuffer,
+                    reconStride,
+                    lcuWidth >> shiftX,
+                    lcuHeight >> shiftY);
+            }
+            else {
+                sse[planeIndex] += rtcd.PictureSse(
+                    inputBuffer,
+                    inputStride,
+                    reconBuffer,
+                    reconStride,
+                    lcuWidth >> shiftX,
+                    lcuHeight >> shiftY);
+            }
+
+            QualityMetricsBlockSums(
+                inputBuffer,
+                inputStride,
+                reconBuffer,
+                reconStride,
+                (lcuWidth >> shiftX) >> 2,
+                (lcuHeight >> shiftY) >> 2,
+                is16bit,
+                blockSums[planeIndex]);
+
+            QualityMetricsWindows(
+                blockSums[planeIndex],
+                lcuOriginX == 0 ? 1 : 0,
+                (lcuWidth >> shiftX) >> 2,
+                blockRowCount[planeIndex],
+                bitDepth,
+                &ssimSum[planeIndex],
+                &ssimCount[planeIndex]);
+        }
+    }
+
+    return;
+}
+
+/******************************************************
+* Finish Quality Metrics
+*   PSNR / SSIM from the reduced sums. The last rows of
+*   the picture were held back from the Entropy Coder
+*   until now, so Packetization reads final values.
+******************************************************/
+static void FinishQualityMetrics(
+    EncDecContext_t        *contextPtr,
+    EbObjectWrapper_t      *pictureControlSetWrapperPtr,
+    SequenceControlSet_t   *sequenceControlSetPtr)
+{
+    PictureControlSet_t *pictureControlSetPtr = (PictureControlSet_t*)pictureControlSetWrapperPtr->objectPtr;
+    const EB_U32 bitDepth = sequenceControlSetPtr->staticConfig.encoderBitDepth;
+    const EB_COLOR_FORMAT colorFormat = (EB_COLOR_FORMAT)sequenceControlSetPtr->chromaFormatIdc;
+    const EB_U16 subWidthCMinus1 = (colorFormat == EB_YUV444 ? 1 : 2) - 1;
+    const EB_U16 subHeightCMinus1 = (colorFormat >= EB_YUV422 ? 1 : 2) - 1;
+    const EB_U32 pictureWidth = sequenceControlSetPtr->maxInputLumaWidth - sequenceControlSetPtr->maxInputPadRight;
+    const EB_U32 pictureHeight = sequenceControlSetPtr->maxInputLumaHeight - sequenceControlSetPtr->maxInputPadBottom;
+    EbObjectWrapper_t *encDecResultsWrapperPtr;
+    EncDecResults_t *encDecResultsPtr;
+    EB_U32 planeIndex;
+
+    for (planeIndex = 0; planeIndex < 3; ++planeIndex) {
+        const double maxValue = (double)((1 << bitDepth) - 1);
+        const double sampleCount = planeIndex ?
+            (double)((pictureWidth >> subWidthCMinus1) * (pictureHeight >> subHeightCMinus1)) :
+            (double)(pictureWidth * pictureHeight);
+        const EB_U64 sse = pictureControlSetPtr->reconSse[planeIndex];
+
+        pictureControlSetPtr->reconPsnr[planeIndex] = sse ?
+            MIN(10 * log10(maxValue * maxValue * sampleCount / (double)sse), 100.0) :
+            100.0;
+        pictureControlSetPtr->reconSsim[planeIndex] = pictureControlSetPtr->reconSsimCount[planeIndex] ?
+            pictureControlSetPtr->reconSsimSum[planeIndex] / pictureControlSetPtr->reconSsimCount[planeIndex] :
+            1.0;
+    }
+
+    // The reference recon was held for the pass
+    if (pictureControlSetPtr->ParentPcsPtr->isUsedAsReferenceFlag == EB_TRUE)
+        EbReleaseObject(pictureControlSetPtr->ParentPcsPtr->referencePictureWrapperPtr);
+
+    // Get Empty EncDec Results
+    EbGetEmptyObject(
+        contextPtr->encDecOutputFifoPtr,
+        &encDecResultsWrapperPtr);
+    encDecResultsPtr = (EncDecResults_t*)encDecResultsWrapperPtr->objectPtr;
+    encDecResultsPtr->pictureControlSetWrapperPtr = pictureControlSetWrapperPtr;
+    encDecResultsPtr->completedLcuRowIndexStart = pictureControlSetPtr->qualityMetricsLcuRowIndexStart;
+    encDecResultsPtr->completedLcuRowCount = pictureControlSetPtr->qualityMetricsLcuRowIndexCount;
+
+    // Post EncDec Results
+    EbPostFullObject(encDecResultsWrapperPtr);
+
+    return;
+}
+
+/******************************************************
+* Quality Metrics LCU Rows
+*   claims LCU rows of the picture until none are
+*   left and adds their sums to the picture totals.
+*   The thread that completes the last row finishes
+*   the metrics; no thread waits for another.
+*   The caller holds a live count of the picture.
+******************************************************/
+static void QualityMetricsLcuRows(
+    EncDecContext_t        *contextPtr,
+    EbObjectWrapper_t      *pictureControlSetWrapperPtr,
+    SequenceControlSet_t   *sequenceControlSetPtr)
+{
+    PictureControlSet_t *pictureControlSetPtr = (PictureControlSet_t*)pictureControlSetWrapperPtr->objectPtr;
+    const EB_BOOL is16bit = (sequenceControlSetPtr->staticConfig.encoderBitDepth > EB_8BIT);
+    const EB_U32 pictureHeightInLcu = (sequenceControlSetPtr->lumaHeight + sequenceControlSetPtr->lcuSize - 1) / sequenceControlSetPtr->lcuSize;
+    EbPictureBufferDesc_t *reconPtr;
+    EB_U32 lcuRowIndex;
+    EB_U32 planeIndex;
+
+    if (pictureControlSetPtr->ParentPcsPtr->isUsedAsReferenceFlag == EB_TRUE)
+        reconPtr = is16bit ?
+            ((EbReferenceObject_t*)pictureControlSetPtr->ParentPcsPtr->referencePictureWrapperPtr->objectPtr)->referencePicture16bit :
+            ((EbReferenceObject_t*)pictureControlSetPtr->ParentPcsPtr->referencePictureWrapperPtr->objectPtr)->referencePicture;
+    else
+        reconPtr = is16bit ? pictureControlSetPtr->reconPicture16bitPtr : pictureControlSetPtr->reconPicturePtr;
+
+    for (;;) {
+        EB_U64 sse[3] = { 0, 0, 0 };
+        double ssimSum[3] = { 0, 0, 0 };
+        EB_U32 ssimCount[3] = { 0, 0, 0 };
+        EB_BOOL lastRowFlag;
+
+        EbBlockOnMutex(pictureControlSetPtr->qualityMetricsMutex);
+        lcuRowIndex = pictureControlSetPtr->qualityMetricsNextRow;
+        if (lcuRowIndex < pictureHeightInLcu)
+            ++pictureControlSetPtr->qualityMetricsNextRow;
+        EbReleaseMutex(pictureControlSetPtr->qualityMetricsMutex);
+
+        if (lcuRowIndex >= pictureHeightInLcu)
+            break;
+
+        QualityMetricsLcuRow(
+            contextPtr,
+            pictureControlSetPtr,
+            sequenceControlSetPtr,
+            reconPtr,
+            lcuRowIndex,
+            sse,
+            ssimSum,
+            ssimCount);
+
+        EbBlockOnMutex(pictureControlSetPtr->qualityMetricsMutex);
+        for (planeIndex = 0; planeIndex < 3; ++planeIndex) {
+            pictureControlSetPtr->reconSse[planeIndex] += sse[planeIndex];
+            pictureControlSetPtr->reconSsimSum[planeIndex] += ssimSum[planeIndex];
+            pictureControlSetPtr->reconSsimCount[planeIndex] += ssimCount[planeIndex];
+        }
+        lastRowFlag = (++pictureControlSetPtr->qualityMetricsRowsDone == pictureHeightInLcu) ? EB_TRUE : EB_FALSE;
+        EbReleaseMutex(pictureControlSetPtr->qualityMetricsMutex);
+
+        if (lastRowFlag)
+            FinishQualityMetrics(
+                contextPtr,
+                pictureControlSetWrapperPtr,
+                sequenceControlSetPtr);
+    }
+
+    return;
+}
+
+/******************************************************
+* Start Quality Metrics
+*   PSNR / SSIM of the final (deblocked + SAO) recon
+*   against the input picture, per plane. The recon is
+*   only final after the picture-level SAO, so the LCU
+*   rows are shared with the idle EncDec threads
+*   through ENCDEC_TASKS_QUALITY_METRICS tasks. The
+*   last segment rows (lcuRowIndexStart, lcuRowIndexCount)
+*   are posted to the Entropy Coder by the thread that
+*   completes the metrics.
+******************************************************/
+static void StartQualityMetrics(
+    EncDecContext_t        *contextPtr,
+    EbObjectWrapper_t      *pictureControlSetWrapperPtr,
+    SequenceControlSet_t   *sequenceControlSetPtr,
+    EB_U32                  lcuRowIndexStart,
+    EB_U32                  lcuRowIndexCount)
+{
+    PictureControlSet_t *pictureControlSetPtr = (PictureControlSet_t*)pictureControlSetWrapperPtr->objectPtr;
+    const EB_U32 pictureHeightInLcu = (sequenceControlSetPtr->lumaHeight + sequenceControlSetPtr->lcuSize - 1) / sequenceControlSetPtr->lcuSize;
+    EB_U32 helperCount = MIN(contextPtr->encDecProcessCount, pictureHeightInLcu) - 1;
+    EbObjectWrapper_t *wrapperPtr;
+    EncDecTasks_t *helperTaskPtr;
+    EB_U32 planeIndex;
+
+    pictureControlSetPtr->qualityMetricsNextRow = 0;
+    pictureControlSetPtr->qualityMetricsRowsDone = 0;
+    pictureControlSetPtr->qualityMetricsLcuRowIndexStart = lcuRowIndexStart;
+    pictureControlSetPtr->qualityMetricsLcuRowIndexCount = lcuRowIndexCount;
+    for (planeIndex = 0; planeIndex < 3; ++planeIndex) {
+        pictureControlSetPtr->reconSse[planeIndex] = 0;
+        pictureControlSetPtr->reconSsimSum[planeIndex] = 0;
+        pictureControlSetPtr->reconSsimCount[planeIndex] = 0;
+    }
+
+    // The reference recon may otherwise be recycled by the Picture Manager during the pass
+    if (pictureControlSetPtr->ParentPcsPtr->isUsedAsReferenceFlag == EB_TRUE)
+        EbObjectIncLiveCount(
+            pictureControlSetPtr->ParentPcsPtr->referencePictureWrapperPtr,
+            1);
+
+    // This thread and each helper task hold a live count of the picture control set until they are done
+    EbObjectIncLiveCount(
+        pictureControlSetWrapperPtr,
+        helperCount + 1);
+
+    while (helperCount--) {
+        EbGetEmptyObject(
+            contextPtr->encDecFeedbackFifoPtr,
+            &wrapperPtr);
+        helperTaskPtr = (EncDecTasks_t*)wrapperPtr->objectPtr;
+        helperTaskPtr->inputType = ENCDEC_TASKS_QUALITY_METRICS;
+        helperTaskPtr->encDecSegmentRow = 0;
+        helperTaskPtr->pictureControlSetWrapperPtr = pictureControlSetWrapperPtr;
+        EbPostFullObject(wrapperPtr);
+    }
+
+    QualityMetricsLcuRows(
+        contextPtr,
+        pictureControlSetWrapperPtr,
+        sequenceControlSetPtr);
+
+    EbReleaseObject(pictureControlSetWrapperPtr);
+
+    return;
+}
+
 void PadRefAndSetFlags(
     PictureControlSet_t    *pictureControlSetPtr,
     SequenceControlSet_t   *sequenceControlSetPtr
@@ -1858,11 +2438,11 @@ void CopyStatisticsToRefObject(
     SequenceControlSet_t   *sequenceControlSetPtr
     )
 {
-    pictureControlSetPtr->intraCodedArea = (100 * pictureControlSetPtr->intraCodedArea) / (sequenceControlSetPtr->lumaWidth * sequenceControlSetPtr->lumaHeight);
-    if (pictureControlSetPtr->sliceType == EB_I_SLICE)
-        pictureControlSetPtr->intraCodedArea = 0;
+    // the PCS keeps the intra area in samples for the picture stats
+    const EB_U32 intraCodedAreaPercent = (pictureControlSetPtr->sliceType == EB_I_SLICE) ? 0 :
+        (100 * pictureControlSetPtr->intraCodedArea) / (sequenceControlSetPtr->lumaWidth * sequenceControlSetPtr->lumaHeight);
 
-    ((EbReferenceObject_t*)pictureControlSetPtr->ParentPcsPtr->referencePictureWrapperPtr->objectPtr)->intraCodedArea = (EB_U8)(pictureControlSetPtr->intraCodedArea);
+    ((EbReferenceObject_t*)pictureControlSetPtr->ParentPcsPtr->referencePictureWrapperPtr->objectPtr)->intraCodedArea = (EB_U8)intraCodedAreaPercent;
 
     EB_U32 lcuIndex;
     for (lcuIndex = 0; lcuIndex < pictureControlSetPtr->lcuTotalCount; ++lcuIndex){
@@ -3576,6 +4156,18 @@ void* EncDecKernel(void *inputPtr)
 #if DEADLOCK_DEBUG
         SVT_LOG("POC %lld ENCDEC IN \n", pictureControlSetPtr->pictureNumber);
 #endif
+
+        // Quality metrics helper: share the LCU rows of a finished picture, then drop its live count
+        if (encDecTasksPtr->inputType == ENCDEC_TASKS_QUALITY_METRICS) {
+            QualityMetricsLcuRows(
+                contextPtr,
+                encDecTasksPtr->pictureControlSetWrapperPtr,
+                sequenceControlSetPtr);
+
+            EbReleaseObject(encDecTasksPtr->pictureControlSetWrapperPtr);
+            EbReleaseObject(encDecTasksWrapperPtr);
+            continue;
+        }
         // LCU Constants
         lcuSize = (EB_U8)sequenceControlSetPtr->lcuSize;
         lcuSizeLog2 = (EB_U8)Log2f(lcuSize);
@@ -3584,6 +4176,8 @@ void* EncDecKernel(void *inputPtr)
         endOfRowFlag = EB_FALSE;
         lcuRowIndexStart = lcuRowIndexCount = 0;
         contextPtr->totIntraCodedArea = 0;
+        contextPtr->totInterCodedArea = 0;
+        contextPtr->totSkipCodedArea = 0;
 
         // EncDec Kernel Signal(s) derivation
         if (sequenceControlSetPtr->staticConfig.tune == TUNE_SQ) {
@@ -3673,6 +4267,8 @@ void* EncDecKernel(void *inputPtr)
                     contextPtr->mdContext->cuUseRefSrcFlag = (pictureControlSetPtr->ParentPcsPtr->useSrcRef) && (pictureControlSetPtr->ParentPcsPtr->edgeResultsPtr[lcuIndex].edgeBlockNum == EB_FALSE || pictureControlSetPtr->ParentPcsPtr->lcuFlatNoiseArray[lcuIndex]) ? EB_TRUE : EB_FALSE;
                     // Derive restrictIntraGlobalMotion Flag
                     contextPtr->mdContext->restrictIntraGlobalMotion = ((pictureControlSetPtr->ParentPcsPtr->isPan || pictureControlSetPtr->ParentPcsPtr->isTilt) && pictureControlSetPtr->ParentPcsPtr->nonMovingIndexArray[lcuIndex] < INTRA_GLOBAL_MOTION_NON_MOVING_INDEX_TH && pictureControlSetPtr->ParentPcsPtr->yMean[lcuIndex][RASTER_SCAN_CU_INDEX_64x64] < INTRA_GLOBAL_MOTION_DARK_LCU_TH);
+                    // Derive staticLcu Flag
+                    contextPtr->mdContext->staticLcu = (pictureControlSetPtr->sliceType != EB_I_SLICE && pictureControlSetPtr->ParentPcsPtr->staticLcuArray[lcuIndex]) ? EB_TRUE : EB_FALSE;
 
                     // Configure the LCU
                     ModeDecisionConfigureLcu(  // HT done
@@ -3818,6 +4414,8 @@ void* EncDecKernel(void *inputPtr)
 
         EbBlockOnMutex(pictureControlSetPtr->intraMutex);
         pictureControlSetPtr->intraCodedArea += (EB_U32)contextPtr->totIntraCodedArea;
+        pictureControlSetPtr->interCodedArea += (EB_U32)contextPtr->totInterCodedArea;
+        pictureControlSetPtr->skipCodedArea += (EB_U32)contextPtr->totSkipCodedArea;
         EbReleaseMutex(pictureControlSetPtr->intraMutex);
 
         if (lastLcuFlag) {
@@ -3831,7 +4429,8 @@ void* EncDecKernel(void *inputPtr)
             
             EB_BOOL applySAOAtEncoderFlag = sequenceControlSetPtr->staticConfig.enableSaoFlag &&
                 (pictureControlSetPtr->ParentPcsPtr->isUsedAsReferenceFlag ||
-                sequenceControlSetPtr->staticConfig.reconEnabled);
+                sequenceControlSetPtr->staticConfig.reconEnabled ||
+                pictureControlSetPtr->ParentPcsPtr->qualityMetricsFlag);
 
             applySAOAtEncoderFlag = contextPtr->allowEncDecMismatch ? EB_FALSE : applySAOAtEncoderFlag;
 
@@ -3853,6 +4452,10 @@ void* EncDecKernel(void *inputPtr)
 
             }
 
+            EbFinishTime(
+                (unsigned long long*)&pictureControlSetPtr->ParentPcsPtr->stageDoneTimeSeconds[PICTURE_STAGE_ENCDEC],
+                (unsigned long long*)&pictureControlSetPtr->ParentPcsPtr->stageDoneTimeuSeconds[PICTURE_STAGE_ENCDEC]);
+
             // Pad the reference picture and set up TMVP flag and ref POC
             if (pictureControlSetPtr->ParentPcsPtr->isUsedAsReferenceFlag == EB_TRUE)
                 PadRefAndSetFlags(
@@ -3943,6 +4546,18 @@ void* EncDecKernel(void *inputPtr)
                 EbPostFullObject(pictureDemuxResultsWrapperPtr);
             }
 
+            // The last rows go to the Entropy Coder from the thread that completes the metrics
+            if (pictureControlSetPtr->ParentPcsPtr->qualityMetricsFlag) {
+                StartQualityMetrics(
+                    contextPtr,
+                    encDecTasksPtr->pictureControlSetWrapperPtr,
+                    sequenceControlSetPtr,
+                    lcuRowIndexStart,
+                    lcuRowIndexCount);
+
+                endOfRowFlag = EB_FALSE;
+            }
+
             // When de interlacing is performed in the lib, each two consecutive pictures (fields: top & bottom) are going to use the same input buffer     
             // only when both fields are encoded we can free the input buffer
             // using the current prediction structure, bottom fields are usually encoded after top fields
@@ -48,6 +48,7 @@ typedef struct EncDecContext_s
     EbFifo_t                       *encDecOutputFifoPtr;
     EbFifo_t                       *encDecFeedbackFifoPtr;
     EbFifo_t                       *pictureDemuxOutputFifoPtr;   // to picture-manager
+    EB_U32                          encDecProcessCount;          // EncDec threads that can share the quality metrics rows
 
     EB_S16                         *transformInnerArrayPtr;
     MdRateEstimationContext_t      *mdRateEstimationPtr;
@@ -114,6 +115,8 @@ typedef struct EncDecContext_s
     EB_U16                         *saoLeftBuffer16[2];
 
     EB_U64                          totIntraCodedArea;
+    EB_U64                          totInterCodedArea;
+    EB_U64                          totSkipCodedArea;
     EB_U8                           intraCodedAreaLCU[MAX_NUMBER_OF_TREEBLOCKS_PER_PICTURE];//percentage of intra coded area 0-100%
     EB_U8                           cleanSparseCeoffPfEncDec;
     EB_U8                           pmpMaskingLevelEncDec;
@@ -156,6 +159,7 @@ extern EB_ERRORTYPE EncDecContextCtor(
     EbFifo_t                *packetizationOutputFifoPtr,
     EbFifo_t                *feedbackFifoPtr,
     EbFifo_t                *pictureDemuxFifoPtr,
+    EB_U32                   encDecProcessCount,
     EB_BOOL                  is16bit,
     EB_COLOR_FORMAT          colorFormat);
 
@@ -52,6 +52,7 @@
 
 #include "EbPredictionStructure.h"
 #include "EbBitstreamUnit.h"
+#include "EbRtcd.h"
 #ifdef _WIN32
 #include <windows.h>
 #else
@@ -258,6 +259,52 @@ EB_U32 GetCpuAsmType()
     return asmType;
 }
 
+// ASM_TYPES and rtcd are shared by all encoder instances of the process
+#ifdef _WIN32
+static SRWLOCK          rtcdSetupLock = SRWLOCK_INIT;
+#else
+static pthread_mutex_t  rtcdSetupLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+static EB_BOOL          rtcdSetupDone = EB_FALSE;
+
+/**********************************
+ * SetupRtcd
+ *   Selects the kernels once, at the first
+ *   EbInitEncoder; later instances reuse them,
+ *   since encoders running alongside read rtcd
+ *   without locking
+ **********************************/
+static EB_ERRORTYPE SetupRtcd(EB_ASM asmType)
+{
+    EB_ERRORTYPE return_error = EB_ErrorNone;
+
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&rtcdSetupLock);
+#else
+    pthread_mutex_lock(&rtcdSetupLock);
+#endif
+
+    if (rtcdSetupDone == EB_FALSE) {
+        if (asmType == EB_ASM_AVX2) {
+            ASM_TYPES = GetCpuAsmType();
+        }
+        else if (asmType == EB_ASM_NON_AVX2) {
+            ASM_TYPES = 0;
+        }
+
+        return_error = EbRtcdSetup(ASM_TYPES);
+        rtcdSetupDone = (return_error == EB_ErrorNone) ? EB_TRUE : EB_FALSE;
+    }
+
+#ifdef _WIN32
+    ReleaseSRWLockExclusive(&rtcdSetupLock);
+#else
+    pthread_mutex_unlock(&rtcdSetupLock);
+#endif
+
+    return return_error;
+}
+
 //Get Number of logical processors
 EB_U32 GetNumProcessors() {
 #ifdef WIN32
@@ -423,10 +470,14 @@ static EB_ERRORTYPE EbEncHandleCtor(
     // Picture Buffers
     encHandlePtr->referencePicturePoolPtrArray                      = (EbSystemResource_t**) EB_NULL;
     encHandlePtr->paReferencePicturePoolPtrArray                    = (EbSystemResource_t**) EB_NULL;
+    encHandlePtr->halfPelPlanesPoolPtrArray                         = (EbSystemResource_t**) EB_NULL;
+    encHandlePtr->blockHashIndexPoolPtrArray                        = (EbSystemResource_t**) EB_NULL;
 
     // Picture Buffer Producer Fifos  
     encHandlePtr->referencePicturePoolProducerFifoPtrDblArray       = (EbFifo_t***) EB_NULL;
     encHandlePtr->paReferencePicturePoolProducerFifoPtrDblArray     = (EbFifo_t***) EB_NULL;
+    encHandlePtr->halfPelPlanesPoolProducerFifoPtrDblArray          = (EbFifo_t***) EB_NULL;
+    encHandlePtr->blockHashIndexPoolProducerFifoPtrDblArray         = (EbFifo_t***) EB_NULL;
     
     // Threads
     encHandlePtr->resourceCoordinationThreadHandle                  = (EB_HANDLE) EB_NULL;
@@ -679,11 +730,9 @@ EB_API EB_ERRORTYPE EbInitEncoder(EB_COMPONENTTYPE *h265EncComponent)
     * Plateform detection
     ************************************/
 
-    if (encHandlePtr->sequenceControlSetInstanceArray[0]->sequenceControlSetPtr->staticConfig.asmType == EB_ASM_AVX2) {
-        ASM_TYPES = GetCpuAsmType();
-    }
-    else if (encHandlePtr->sequenceControlSetInstanceArray[0]->sequenceControlSetPtr->staticConfig.asmType == EB_ASM_NON_AVX2) {
-        ASM_TYPES = 0;
+    return_error = SetupRtcd(encHandlePtr->sequenceControlSetInstanceArray[0]->sequenceControlSetPtr->staticConfig.asmType);
+    if (return_error != EB_ErrorNone) {
+        return return_error;
     }
 
     /************************************
@@ -807,10 +856,14 @@ EB_API EB_ERRORTYPE EbInitEncoder(EB_COMPONENTTYPE *h265EncComponent)
     // Allocate Resource Arrays 
     EB_MALLOC(EbSystemResource_t**, encHandlePtr->referencePicturePoolPtrArray, sizeof(EbSystemResource_t*) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
     EB_MALLOC(EbSystemResource_t**, encHandlePtr->paReferencePicturePoolPtrArray, sizeof(EbSystemResource_t*) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
+    EB_MALLOC(EbSystemResource_t**, encHandlePtr->halfPelPlanesPoolPtrArray, sizeof(EbSystemResource_t*) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
+    EB_MALLOC(EbSystemResource_t**, encHandlePtr->blockHashIndexPoolPtrArray, sizeof(EbSystemResource_t*) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
         
     // Allocate Producer Fifo Arrays   
     EB_MALLOC(EbFifo_t***, encHandlePtr->referencePicturePoolProducerFifoPtrDblArray, sizeof(EbFifo_t**) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
     EB_MALLOC(EbFifo_t***, encHandlePtr->paReferencePicturePoolProducerFifoPtrDblArray, sizeof(EbFifo_t**) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
+    EB_MALLOC(EbFifo_t***, encHandlePtr->halfPelPlanesPoolProducerFifoPtrDblArray, sizeof(EbFifo_t**) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
+    EB_MALLOC(EbFifo_t***, encHandlePtr->blockHashIndexPoolProducerFifoPtrDblArray, sizeof(EbFifo_t**) * encHandlePtr->encodeInstanceTotalCount, EB_N_PTR);
     
     // Rate Control
     rateControlPorts[0].count = EB_PictureManagerProcessInitCount;
@@ -918,9 +971,44 @@ EB_API EB_ERRORTYPE EbInitEncoder(EB_COMPONENTTYPE *h265EncComponent)
             return EB_ErrorInsufficientResources;
         }
 
+        // Half-pel planes of the PA references being searched by the ME
+        return_error = EbSystemResourceCtor(
+            &encHandlePtr->halfPelPlanesPoolPtrArray[instanceIndex],
+            encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequenceControlSetPtr->halfPelPlanesBufferInitCount,
+            EB_PictureDecisionProcessInitCount,
+            0,
+            &encHandlePtr->halfPelPlanesPoolProducerFifoPtrDblArray[instanceIndex],
+            (EbFifo_t ***)EB_NULL,
+            EB_FALSE,
+            EbHalfPelPlanesCtor,
+            &(EbPaReferenceObjectDescInitDataStructure.referencePictureDescInitData));
+        if (return_error == EB_ErrorInsufficientResources){
+            return EB_ErrorInsufficientResources;
+        }
+
+        // Block hash indexes of the PA references being searched by the hash ME
+        if (encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequenceControlSetPtr->blockHashIndexBufferInitCount) {
+            return_error = EbSystemResourceCtor(
+                &encHandlePtr->blockHashIndexPoolPtrArray[instanceIndex],
+                encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->sequenceControlSetPtr->blockHashIndexBufferInitCount,
+                EB_PictureDecisionProcessInitCount,
+                0,
+                &encHandlePtr->blockHashIndexPoolProducerFifoPtrDblArray[instanceIndex],
+                (EbFifo_t ***)EB_NULL,
+                EB_FALSE,
+                EbBlockHashIndexCtor,
+                &(EbPaReferenceObjectDescInitDataStructure.referencePictureDescInitData));
+            if (return_error == EB_ErrorInsufficientResources){
+                return EB_ErrorInsufficientResources;
+            }
+
+            encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->encodeContextPtr->blockHashIndexPoolFifoPtr   = (encHandlePtr->blockHashIndexPoolProducerFifoPtrDblArray[instanceIndex])[0];
+        }
+
         // Set the SequenceControlSet Picture Pool Fifo Ptrs      
         encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->encodeContextPtr->referencePicturePoolFifoPtr     = (encHandlePtr->referencePicturePoolProducerFifoPtrDblArray[instanceIndex])[0];
         encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->encodeContextPtr->paReferencePicturePoolFifoPtr   = (encHandlePtr->paReferencePicturePoolProducerFifoPtrDblArray[instanceIndex])[0];
+        encHandlePtr->sequenceControlSetInstanceArray[instanceIndex]->encodeContextPtr->halfPelPlanesPoolFifoPtr        = (encHandlePtr->halfPelPlanesPoolProducerFifoPtrDblArray[instanceIndex])[0];
 }
     
     /************************************
@@ -1382,6 +1470,7 @@ EB_API EB_ERRORTYPE EbInitEncoder(EB_COMPONENTTYPE *h265EncComponent)
             encHandlePtr->encDecResultsProducerFifoPtrArray[processIndex],
             encHandlePtr->encDecTasksProducerFifoPtrArray[EncDecPortLookup(ENCDEC_INPUT_PORT_ENCDEC, processIndex)],
             encHandlePtr->pictureDemuxResultsProducerFifoPtrArray[1 + processIndex], // Add port lookup logic here JMJ
+            encHandlePtr->sequenceControlSetInstanceArray[0]->sequenceControlSetPtr->encDecProcessInitCount,
             is16bit,
             (EB_COLOR_FORMAT)encHandlePtr->sequenceControlSetInstanceArray[0]->sequenceControlSetPtr->chromaFormatIdc);
 
@@ -1699,6 +1788,9 @@ void LoadDefaultBufferConfigurationSettings(
     sequenceControlSetPtr->pictureControlSetPoolInitCountChild  = MAX(4, coreCount / 6);
     sequenceControlSetPtr->referencePictureBufferInitCount      = sequenceControlSetPtr->inputOutputBufferFifoInitCount;//MAX((EB_U32)(sequenceControlSetPtr->inputOutputBufferFifoInitCount >> 1), (EB_U32)((1 << sequenceControlSetPtr->staticConfig.hierarchicalLevels) + 2));
     sequenceControlSetPtr->paReferencePictureBufferInitCount    = sequenceControlSetPtr->inputOutputBufferFifoInitCount;//MAX((EB_U32)(sequenceControlSetPtr->inputOutputBufferFifoInitCount >> 1), (EB_U32)((1 << sequenceControlSetPtr->staticConfig.hierarchicalLevels) + 2));
+    // The references of one mini-GOP, the base picture before it and a spare; PictureDecision waits for planes beyond that
+    sequenceControlSetPtr->halfPelPlanesBufferInitCount         = MIN(sequenceControlSetPtr->paReferencePictureBufferInitCount, (EB_U32)((1 << sequenceControlSetPtr->staticConfig.hierarchicalLevels) + 2));
+    sequenceControlSetPtr->blockHashIndexBufferInitCount        = sequenceControlSetPtr->staticConfig.hashMotionSearch ? sequenceControlSetPtr->halfPelPlanesBufferInitCount : 0;
     sequenceControlSetPtr->reconBufferFifoInitCount             = sequenceControlSetPtr->referencePictureBufferInitCount;
     
     //#====================== Inter process Fifos ======================
@@ -2040,6 +2132,7 @@ void CopyApiFromApp(
     sequenceControlSetPtr->staticConfig.enableHmeLevel0Flag = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->enableHmeLevel0Flag;
     sequenceControlSetPtr->staticConfig.enableHmeLevel1Flag = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->enableHmeLevel1Flag;
     sequenceControlSetPtr->staticConfig.enableHmeLevel2Flag = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->enableHmeLevel2Flag;
+    sequenceControlSetPtr->staticConfig.hashMotionSearch = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->hashMotionSearch;
     sequenceControlSetPtr->staticConfig.searchAreaWidth = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->searchAreaWidth;
     sequenceControlSetPtr->staticConfig.searchAreaHeight = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->searchAreaHeight;
     sequenceControlSetPtr->staticConfig.numberHmeSearchRegionInWidth = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->numberHmeSearchRegionInWidth;
@@ -2118,6 +2211,9 @@ void CopyApiFromApp(
     sequenceControlSetPtr->staticConfig.frameRateDenominator = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->frameRateDenominator;
     sequenceControlSetPtr->staticConfig.frameRateNumerator = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->frameRateNumerator;
     sequenceControlSetPtr->staticConfig.reconEnabled = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->reconEnabled;
+    sequenceControlSetPtr->staticConfig.reconDecimation = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->reconDecimation;
+    sequenceControlSetPtr->staticConfig.qualityMetricsInterval = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->qualityMetricsInterval;
+    sequenceControlSetPtr->staticConfig.pictureStatsEnabled = ((EB_H265_ENC_CONFIGURATION*)pComponentParameterStructure)->pictureStatsEnabled;
 
     // if HDR is set videoUsabilityInfo should be set to 1
     if (sequenceControlSetPtr->staticConfig.highDynamicRangeInput == 1) {
@@ -2440,6 +2536,11 @@ static EB_ERRORTYPE VerifySettings(\
        return_error = EB_ErrorBadParameter; 
     }
 
+    if ( config->hashMotionSearch > 1 ){
+       SVT_LOG("Error Instance %u: invalid HashMotionSearch. HashMotionSearch must be [0 - 1]\n",channelNumber+1);
+       return_error = EB_ErrorBadParameter; 
+    }
+
     if ( config->enableHmeLevel0Flag > 1 ) {
        SVT_LOG("Error Instance %u: invalid enable HMELevel0. HMELevel0 must be [0 - 1]\n",channelNumber+1);
        return_error = EB_ErrorBadParameter; 
@@ -2708,6 +2809,11 @@ static EB_ERRORTYPE VerifySettings(\
         return_error = EB_ErrorBadParameter;
     }
 
+    if (config->reconDecimation != 1 && config->reconDecimation != 2 && config->reconDecimation != 4) {
+        SVT_LOG("Error instance %u: Invalid ReconDecimation [1, 2, 4] \n", channelNumber + 1);
+        return_error = EB_ErrorBadParameter;
+    }
+
 
     return return_error;
 }
@@ -2761,6 +2867,7 @@ EB_ERRORTYPE EbH265EncInitParameter(
     configPtr->enableHmeLevel0Flag = EB_TRUE;
     configPtr->enableHmeLevel1Flag = EB_FALSE;
     configPtr->enableHmeLevel2Flag = EB_FALSE;
+    configPtr->hashMotionSearch = EB_FALSE;
     configPtr->searchAreaWidth = 16;
     configPtr->searchAreaHeight = 7;
     configPtr->numberHmeSearchRegionInWidth = 2;
@@ -2819,6 +2926,9 @@ EB_ERRORTYPE EbH265EncInitParameter(
     
     // Debug info
     configPtr->reconEnabled = 0;
+    configPtr->reconDecimation = 1;
+    configPtr->qualityMetricsInterval = 0;
+    configPtr->pictureStatsEnabled = 0;
 
     return return_error;
 }
@@ -3291,7 +3401,8 @@ EB_API EB_ERRORTYPE EbH265EncSendPicture(
 
 static void CopyOutputBuffer(
     EB_BUFFERHEADERTYPE   *dst,
-    EB_BUFFERHEADERTYPE   *src
+    EB_BUFFERHEADERTYPE   *src,
+    EB_BOOL                copyStats
 ) 
 {
     // copy output bitstream fileds
@@ -3306,6 +3417,8 @@ static void CopyOutputBuffer(
     dst->sliceType     = src->sliceType;
     if (src->pBuffer)
         EB_MEMCPY(dst->pBuffer, src->pBuffer, src->nFilledLen);
+    if (copyStats && dst->pStats && src->pStats)
+        EB_MEMCPY(dst->pStats, src->pStats, sizeof(EB_H265_ENC_PICTURE_STATS));
     return;
 }
 
@@ -3360,7 +3473,8 @@ EB_API EB_ERRORTYPE EbH265GetPacket(
         EB_BUFFERHEADERTYPE* objPtr = (EB_BUFFERHEADERTYPE*)ebWrapperPtr->objectPtr;
         CopyOutputBuffer(
             pBuffer,
-            objPtr);
+            objPtr,
+            pEncCompData->sequenceControlSetInstanceArray[0]->sequenceControlSetPtr->staticConfig.pictureStatsEnabled ? EB_TRUE : EB_FALSE);
                 
         if (pBuffer->nFlags != EB_BUFFERFLAG_EOS && pBuffer->nFlags != 0) {
             return_error = EB_ErrorMax;
@@ -3419,6 +3533,71 @@ EB_API EB_ERRORTYPE EbH265GetRecon(
     return return_error;
 }
 
+/**********************************
+* Get Recon By Reference
+*   hands out the library recon buffer
+*   without copying it, the buffer is
+*   held until EbH265ReleaseRecon
+**********************************/
+#if __linux
+__attribute__((visibility("default")))
+#endif
+EB_API EB_ERRORTYPE EbH265GetReconRef(
+    EB_COMPONENTTYPE      *h265EncComponent,
+    EB_BUFFERHEADERTYPE  **pBuffer)
+{
+    EB_ERRORTYPE           return_error = EB_ErrorNone;
+    EbEncHandle_t          *pEncCompData = (EbEncHandle_t*)h265EncComponent->pComponentPrivate;
+    EbObjectWrapper_t      *ebWrapperPtr = NULL;
+
+    *pBuffer = NULL;
+
+    if (pEncCompData->sequenceControlSetInstanceArray[0]->sequenceControlSetPtr->staticConfig.reconEnabled) {
+
+        EbGetFullObjectNonBlocking(
+            (pEncCompData->outputReconBufferConsumerFifoPtrDblArray[0])[0],
+            &ebWrapperPtr);
+
+        if (ebWrapperPtr) {
+
+            EB_BUFFERHEADERTYPE* objPtr = (EB_BUFFERHEADERTYPE*)ebWrapperPtr->objectPtr;
+            objPtr->wrapperPtr = ebWrapperPtr;
+            *pBuffer = objPtr;
+
+            if (objPtr->nFlags != EB_BUFFERFLAG_EOS && objPtr->nFlags != 0) {
+                return_error = EB_ErrorMax;
+            }
+        }
+        else {
+            return_error = EB_NoErrorEmptyQueue;
+        }
+    }
+    else {
+        // recon is not enabled
+        return_error = EB_ErrorMax;
+    }
+
+    return return_error;
+}
+
+/**********************************
+* Release Recon
+**********************************/
+#if __linux
+__attribute__((visibility("default")))
+#endif
+EB_API void EbH265ReleaseRecon(
+    EB_BUFFERHEADERTYPE   *pBuffer)
+{
+    if (pBuffer && pBuffer->wrapperPtr) {
+        EbObjectWrapper_t *ebWrapperPtr = (EbObjectWrapper_t*)pBuffer->wrapperPtr;
+        pBuffer->wrapperPtr = NULL;
+        EbReleaseObject(ebWrapperPtr);
+    }
+
+    return;
+}
+
 void SwitchToRealTime()
 {
 
@@ -3567,6 +3746,8 @@ EB_ERRORTYPE EbInputBufferHeaderCtor(
         inputBuffer);
 
     inputBuffer->pAppPrivate = NULL;
+    inputBuffer->wrapperPtr  = NULL;
+    inputBuffer->pStats      = NULL;
 
     return EB_ErrorNone;
 }
@@ -3589,9 +3770,11 @@ EB_ERRORTYPE EbOutputBufferHeaderCtor(
     outBufPtr->nSize = sizeof(EB_BUFFERHEADERTYPE);
 
     EB_MALLOC(EB_U8*, outBufPtr->pBuffer, nStride, EB_N_PTR);
+    EB_MALLOC(EB_H265_ENC_PICTURE_STATS*, outBufPtr->pStats, sizeof(EB_H265_ENC_PICTURE_STATS), EB_N_PTR);
 
     outBufPtr->nAllocLen =  nStride;
     outBufPtr->pAppPrivate = NULL;
+    outBufPtr->wrapperPtr = NULL;
     
         (void)objectInitDataPtr;
 
@@ -3610,9 +3793,11 @@ EB_ERRORTYPE EbOutputReconBufferHeaderCtor(
     const EB_COLOR_FORMAT colorFormat = (EB_COLOR_FORMAT)sequenceControlSetPtr->chromaFormatIdc;
     const EB_U16 subWidthCMinus1 = (colorFormat == EB_YUV444 ? 1 : 2) - 1;
     const EB_U16 subHeightCMinus1 = (colorFormat >= EB_YUV422 ? 1 : 2) - 1;
-    const EB_U32 lumaSize = sequenceControlSetPtr->lumaWidth * sequenceControlSetPtr->lumaHeight;
+    const EB_U32 decimationShift = (sequenceControlSetPtr->staticConfig.reconDecimation == 4) ? 2 :
+                                   (sequenceControlSetPtr->staticConfig.reconDecimation == 2) ? 1 : 0;
+    const EB_U32 lumaSize = (sequenceControlSetPtr->lumaWidth >> decimationShift) * (sequenceControlSetPtr->lumaHeight >> decimationShift);
     // both u and v
-    const EB_U32 chromaSize = lumaSize >> (3 - colorFormat);
+    const EB_U32 chromaSize = ((sequenceControlSetPtr->lumaWidth >> subWidthCMinus1) >> decimationShift) * ((sequenceControlSetPtr->lumaHeight >> subHeightCMinus1) >> decimationShift);
     const EB_U32 tenBit = (sequenceControlSetPtr->staticConfig.encoderBitDepth > 8);
     const EB_U32 frameSize = (lumaSize + 2 * chromaSize) << tenBit;
 
@@ -3627,6 +3812,8 @@ EB_ERRORTYPE EbOutputReconBufferHeaderCtor(
 
     reconBuffer->nAllocLen   = frameSize;
     reconBuffer->pAppPrivate = NULL;
+    reconBuffer->wrapperPtr  = NULL;
+    reconBuffer->pStats      = NULL;
 
     return EB_ErrorNone;
 }
@@ -54,10 +54,14 @@ typedef struct EbEncHandle_s
     // Picture Buffers
     EbSystemResource_t                    **referencePicturePoolPtrArray;
     EbSystemResource_t                    **paReferencePicturePoolPtrArray;
+    EbSystemResource_t                    **halfPelPlanesPoolPtrArray;
+    EbSystemResource_t                    **blockHashIndexPoolPtrArray;
     
     // Picture Buffer Producer Fifos   
     EbFifo_t                             ***referencePicturePoolProducerFifoPtrDblArray;
     EbFifo_t                             ***paReferencePicturePoolProducerFifoPtrDblArray;
+    EbFifo_t                             ***halfPelPlanesPoolProducerFifoPtrDblArray;
+    EbFifo_t                             ***blockHashIndexPoolProducerFifoPtrDblArray;
     
     // Thread Handles
     EB_HANDLE                               resourceCoordinationThreadHandle;
@@ -172,5 +176,8 @@ extern EB_ERRORTYPE EbOutputBufferHeaderCtor(
 extern EB_ERRORTYPE EbOutputReconBufferHeaderCtor(
     EB_PTR *objectDblPtr,
     EB_PTR objectInitDataPtr);
+
+// ASM_TYPES bit-field supported by this CPU (AVX512 - 111, AVX2 - 011, NONAVX2 - 001)
+extern EB_U32 GetCpuAsmType();
     
 #endif // EbEncHandle_h
\ No newline at end of file
@@ -45,6 +45,8 @@ EB_ERRORTYPE EncodeContextCtor(
     encodeContextPtr->inputPicturePoolFifoPtr                           = (EbFifo_t*) EB_NULL;
     encodeContextPtr->referencePicturePoolFifoPtr                       = (EbFifo_t*) EB_NULL;    
     encodeContextPtr->paReferencePicturePoolFifoPtr                     = (EbFifo_t*) EB_NULL;    
+    encodeContextPtr->halfPelPlanesPoolFifoPtr                          = (EbFifo_t*) EB_NULL;
+    encodeContextPtr->blockHashIndexPoolFifoPtr                         = (EbFifo_t*) EB_NULL;
     
     // Picture Decision Reordering Queue
     encodeContextPtr->pictureDecisionReorderQueueHeadIndex                 = 0;
@@ -56,6 +56,8 @@ typedef struct EncodeContext_s
     EbFifo_t                            *inputPicturePoolFifoPtr;
     EbFifo_t                            *referencePicturePoolFifoPtr;
     EbFifo_t                            *paReferencePicturePoolFifoPtr;
+    EbFifo_t                            *halfPelPlanesPoolFifoPtr;
+    EbFifo_t                            *blockHashIndexPoolFifoPtr;
     
     // Picture Decision Reorder Queue
     PictureDecisionReorderEntry_t      **pictureDecisionReorderQueue;
@@ -15,6 +15,7 @@
 #include "EbDeblockingFilter.h"
 #include "EbErrorCodes.h"
 #include "EbErrorHandling.h"
+#include "EbRtcd.h"
 
 // SSE2 Intrinsics 
 #include "emmintrin.h"
@@ -1256,21 +1257,21 @@ void EncodeQuantizedCoefficients_generic(
     EB_U32  transCoeffShape = (componentType == COMPONENT_LUMA) ? tuPtr->transCoeffShapeLuma : tuPtr->transCoeffShapeChroma ;
 
     if (transCoeffShape && tuPtr->isOnlyDc[(componentType == COMPONENT_LUMA) ? 0 : (componentType == COMPONENT_CHROMA_CB) ? 1 : 2] == EB_FALSE) {
-        PicZeroOutCoef_funcPtrArray[(EB_ASM_NON_AVX2 & PREAVX2_MASK) && 1][(size >> 1) >> 3](
+        ZeroOutCoeffKernel(
             coeffBufferPtr,
             coeffStride,
             (size >> 1),
             (size >> 1),
             (size >> 1));
 
-        PicZeroOutCoef_funcPtrArray[(EB_ASM_NON_AVX2 & PREAVX2_MASK) && 1][(size >> 1) >> 3](
+        ZeroOutCoeffKernel(
             coeffBufferPtr,
             coeffStride,
             (size >> 1) * coeffStride,
             (size >> 1),
             (size >> 1));
 
-        PicZeroOutCoef_funcPtrArray[(EB_ASM_NON_AVX2 & PREAVX2_MASK) && 1][(size >> 1) >> 3](
+        ZeroOutCoeffKernel(
             coeffBufferPtr,
             coeffStride,
             (size >> 1) * coeffStride + (size >> 1),
@@ -1278,21 +1279,21 @@ void EncodeQuantizedCoefficients_generic(
             (size >> 1));
 
         if (transCoeffShape == N4_SHAPE) {
-            PicZeroOutCoef_funcPtrArray[(EB_ASM_NON_AVX2 & PREAVX2_MASK) && 1][(size >> 2) >> 3](
+            ZeroOutCoeffKernel(
                 coeffBufferPtr,
                 coeffStride,
                 (size >> 2),
                 (size >> 2),
                 (size >> 2));
 
-            PicZeroOutCoef_funcPtrArray[(EB_ASM_NON_AVX2 & PREAVX2_MASK) && 1][(size >> 2) >> 3](
+            ZeroOutCoeffKernel(
                 coeffBufferPtr,
                 coeffStride,
                 (size >> 2) * coeffStride,
                 (size >> 2),
                 (size >> 2));
 
-            PicZeroOutCoef_funcPtrArray[(EB_ASM_NON_AVX2 & PREAVX2_MASK) && 1][(size >> 2) >> 3](
+            ZeroOutCoeffKernel(
                 coeffBufferPtr,
                 coeffStride,
                 (size >> 2) * coeffStride + (size >> 2),
@@ -4088,7 +4089,7 @@ static EB_ERRORTYPE EncodeCoeff(
 	coeffBuffer = (EB_S16*)&coeffPtr->bufferY[coeffLocation * sizeof(EB_S16)];
 
 	if (tuPtr->lumaCbf) {
-		EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.EncodeQuantizedCoefficients(
 			cabacEncodeCtxPtr,
 			tuSize,
 			(EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -4110,7 +4111,7 @@ static EB_ERRORTYPE EncodeCoeff(
 
 	if (tuSize > 4){
 		if (tuPtr->cbCbf) {
-			EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.EncodeQuantizedCoefficients(
 				cabacEncodeCtxPtr,
 				tuChromaSize,
 				(EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -4125,7 +4126,7 @@ static EB_ERRORTYPE EncodeCoeff(
         if (cabacEncodeCtxPtr->colorFormat == EB_YUV422 && tuPtr->cbCbf2) {
             coeffLocation = (tuOriginX >> 1) + ((tuOriginY+tuChromaSize) * coeffPtr->strideCb);
 	        coeffBuffer = (EB_S16*)&coeffPtr->bufferCb[coeffLocation * sizeof(EB_S16)];
-			EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.EncodeQuantizedCoefficients(
 				cabacEncodeCtxPtr,
 				tuChromaSize,
 				(EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -4139,7 +4140,7 @@ static EB_ERRORTYPE EncodeCoeff(
 	} else if (tuPtr->tuIndex - ((tuPtr->tuIndex >> 2) << 2) == 0) {
         // Never be here
 		if (tuPtr->cbCbf) {
-			EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.EncodeQuantizedCoefficients(
 				cabacEncodeCtxPtr,
 				tuChromaSize,
 				(EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -4159,7 +4160,7 @@ static EB_ERRORTYPE EncodeCoeff(
 
 	if (tuSize > 4){
 		if (tuPtr->crCbf) {
-			EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.EncodeQuantizedCoefficients(
 				cabacEncodeCtxPtr,
 				tuChromaSize,
 				(EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -4174,7 +4175,7 @@ static EB_ERRORTYPE EncodeCoeff(
         if (cabacEncodeCtxPtr->colorFormat == EB_YUV422 && tuPtr->crCbf2) {
             coeffLocation = (tuOriginX >> 1) + ((tuOriginY+tuChromaSize) * coeffPtr->strideCr);
 	        coeffBuffer = (EB_S16*)&coeffPtr->bufferCr[coeffLocation * sizeof(EB_S16)];
-			EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.EncodeQuantizedCoefficients(
 				cabacEncodeCtxPtr,
 				tuChromaSize,
 				(EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -4189,7 +4190,7 @@ static EB_ERRORTYPE EncodeCoeff(
 	else if (tuPtr->tuIndex - ((tuPtr->tuIndex >> 2) << 2) == 0) {
 
 		if (tuPtr->crCbf) {
-			EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.EncodeQuantizedCoefficients(
 				cabacEncodeCtxPtr,
 				tuChromaSize,
 				(EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -6831,7 +6832,7 @@ static EB_ERRORTYPE Intra4x4EncodeLumaCoeff(
 			MIN_PU_SIZE,
 			&countNonZeroCoeffs);
 
-		EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.EncodeQuantizedCoefficients(
 			cabacEncodeCtxPtr,
 			MIN_PU_SIZE,
 			(EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -6879,7 +6880,7 @@ static EB_ERRORTYPE Intra4x4EncodeChromaCoeff(
                     MIN_PU_SIZE,
                     &countNonZeroCoeffs);
 
-            EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.EncodeQuantizedCoefficients(
                     cabacEncodeCtxPtr,
                     MIN_PU_SIZE,
                     (EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -6907,7 +6908,7 @@ static EB_ERRORTYPE Intra4x4EncodeChromaCoeff(
                     MIN_PU_SIZE,
                     &countNonZeroCoeffs);
 
-            EncodeQuantizedCoefficientsFuncArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.EncodeQuantizedCoefficients(
                     cabacEncodeCtxPtr,
                     MIN_PU_SIZE,
                     (EB_MODETYPE)cuPtr->predictionModeFlag,
@@ -7586,7 +7587,7 @@ EB_ERRORTYPE TuEstimateCoeffBitsEncDec(
 
 		if (countNonZeroCoeffs[0]) {
 
-			EstimateQuantizedCoefficients[1][(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.EstimateQuantizedCoefficients[1](
 				CabacCost,
 				cabacEncodeCtxPtr,
 				transformSize,
@@ -7610,7 +7611,7 @@ EB_ERRORTYPE TuEstimateCoeffBitsEncDec(
 
 		if (countNonZeroCoeffs[1]) {
 
-			EstimateQuantizedCoefficients[1][(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.EstimateQuantizedCoefficients[1](
 				CabacCost,
 				cabacEncodeCtxPtr,
 				transformChromaSize,
@@ -7633,7 +7634,7 @@ EB_ERRORTYPE TuEstimateCoeffBitsEncDec(
 
 		if (countNonZeroCoeffs[2]) {
 
-			EstimateQuantizedCoefficients[1][(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.EstimateQuantizedCoefficients[1](
 				CabacCost,
 				cabacEncodeCtxPtr,
 				transformChromaSize,
@@ -7681,7 +7682,7 @@ EB_ERRORTYPE TuEstimateCoeffBitsLuma(
 	if (yCountNonZeroCoeffs) {
 
         if(coeffCabacUpdate)
-            EstimateQuantizedCoefficientsUpdate[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.EstimateQuantizedCoefficientsUpdate(
                 updatedCoeffCtxModel,
                 CabacCost,
                 cabacEncodeCtxPtr,
@@ -7695,7 +7696,7 @@ EB_ERRORTYPE TuEstimateCoeffBitsLuma(
                 yCountNonZeroCoeffs,
                 yTuCoeffBits);
         else
-		    EstimateQuantizedCoefficients[1][(ASM_TYPES & PREAVX2_MASK) && 1](
+		    rtcd.EstimateQuantizedCoefficients[1](
 			    CabacCost,
 			    cabacEncodeCtxPtr,
 			    (transformSize >> partialFrequencyN2Flag),
@@ -7757,7 +7758,7 @@ EB_ERRORTYPE TuEstimateCoeffBits_R(
 		if (yCountNonZeroCoeffs) {
 
 			if (coeffCabacUpdate)
-				EstimateQuantizedCoefficientsUpdate[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.EstimateQuantizedCoefficientsUpdate(
 					updatedCoeffCtxModel,
 					CabacCost,
 					cabacEncodeCtxPtr,
@@ -7773,7 +7774,7 @@ EB_ERRORTYPE TuEstimateCoeffBits_R(
 
             else
 
-			    EstimateQuantizedCoefficients[encoderModeIndex][(ASM_TYPES & PREAVX2_MASK) && 1](
+			    rtcd.EstimateQuantizedCoefficients[encoderModeIndex](
 				    CabacCost,
 				    cabacEncodeCtxPtr,
 				    (transformSize >> partialFrequencyN2Flag),
@@ -7798,7 +7799,7 @@ EB_ERRORTYPE TuEstimateCoeffBits_R(
 		if (cbCountNonZeroCoeffs) {
 
 			if (coeffCabacUpdate)
-				EstimateQuantizedCoefficientsUpdate[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.EstimateQuantizedCoefficientsUpdate(
 					updatedCoeffCtxModel,
 					CabacCost,
 					cabacEncodeCtxPtr,
@@ -7813,7 +7814,7 @@ EB_ERRORTYPE TuEstimateCoeffBits_R(
 					cbTuCoeffBits);
             else
 
-			    EstimateQuantizedCoefficients[encoderModeIndex][(ASM_TYPES & PREAVX2_MASK) && 1](
+			    rtcd.EstimateQuantizedCoefficients[encoderModeIndex](
 				    CabacCost,
 				    cabacEncodeCtxPtr,
 				    (transformChromaSize >> partialFrequencyN2Flag),
@@ -7838,7 +7839,7 @@ EB_ERRORTYPE TuEstimateCoeffBits_R(
 		if (crCountNonZeroCoeffs) {
 
             if (coeffCabacUpdate) 
-                EstimateQuantizedCoefficientsUpdate[(ASM_TYPES & PREAVX2_MASK) && 1](
+                rtcd.EstimateQuantizedCoefficientsUpdate(
                     updatedCoeffCtxModel,
                     CabacCost,
                     cabacEncodeCtxPtr,
@@ -7854,7 +7855,7 @@ EB_ERRORTYPE TuEstimateCoeffBits_R(
 
             else
 
-			    EstimateQuantizedCoefficients[encoderModeIndex][(ASM_TYPES & PREAVX2_MASK) && 1](
+			    rtcd.EstimateQuantizedCoefficients[encoderModeIndex](
 				    CabacCost,
 				    cabacEncodeCtxPtr,
                     (transformChromaSize >> partialFrequencyN2Flag),
@@ -306,31 +306,6 @@ typedef void(*ENCODE_QUANTIZED_COEFF_TYPE) (
     EB_U32                        componentType,
     TransformUnit_t        *tuPtr);
 
-static ESTIMATE_QUANTIZED_COEFF_TYPE FUNC_TABLE EstimateQuantizedCoefficients[2][EB_ASM_TYPE_TOTAL] = { // [lossless/lossy][c/assembly]
-{
-    // C_DEFAULT
-    EstimateQuantizedCoefficients_generic,
-    // AVX2
-    EstimateQuantizedCoefficients_SSE2,
-},
-{
-    // C_DEFAULT
-    EstimateQuantizedCoefficients_Lossy,
-    // AVX2
-    EstimateQuantizedCoefficients_Lossy_SSE2,
-}
-};
-
-
-static ENCODE_QUANTIZED_COEFF_TYPE FUNC_TABLE EncodeQuantizedCoefficientsFuncArray[EB_ASM_TYPE_TOTAL] =
-{
-	// C_DEFAULT
-    EncodeQuantizedCoefficients_generic,
-	// AVX2
-	EncodeQuantizedCoefficients_SSE2,
-};
-
-
 EB_ERRORTYPE EstimateQuantizedCoefficients_Update_SSE2(
     CoeffCtxtMdl_t               *updatedCoeffCtxModel,
     CabacCost_t                  *CabacCost,
@@ -359,15 +334,6 @@ typedef EB_ERRORTYPE(*ESTIMATE_QUANTIZED_COEFF_TYPE_UPDATE)(
     EB_U32                        numNonZeroCoeffs,
     EB_U64                       *coeffBitsLong);
 
-static ESTIMATE_QUANTIZED_COEFF_TYPE_UPDATE FUNC_TABLE EstimateQuantizedCoefficientsUpdate[EB_ASM_TYPE_TOTAL] = {
-    // C_DEFAULT
-    EstimateQuantizedCoefficients_generic_Update,
-    // AVX2
-    EstimateQuantizedCoefficients_Update_SSE2
-};
-
-
-
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,7 @@
 #include "EbSequenceControlSet.h"
 
 #include "EbMotionEstimationResults.h"
+#include "EbPictureDecisionResults.h"
 #include "EbInitialRateControlProcess.h"
 #include "EbInitialRateControlResults.h"
 #include "EbMotionEstimationContext.h"
@@ -19,6 +20,7 @@
 #include "EbMotionEstimation.h"
 #include "EbErrorCodes.h"
 #include "EbErrorHandling.h"
+#include "EbTime.h"
 
 /**************************************
 * Macros
@@ -391,6 +393,7 @@ void ReleasePaReferenceObjects(
 				// Release PA Reference Pictures
 				if (pictureControlSetPtr->refPaPicPtrArray[listIndex] != EB_NULL) {
 
+                    EbPaReferenceReleaseMeBuffers((EbPaReferenceObject_t*)pictureControlSetPtr->refPaPicPtrArray[listIndex]->objectPtr);
                     EbReleaseObject(((EbPaReferenceObject_t*)pictureControlSetPtr->refPaPicPtrArray[listIndex]->objectPtr)->pPcsPtr->pPcsWrapperPtr);
 					EbReleaseObject(pictureControlSetPtr->refPaPicPtrArray[listIndex]);
 				}
@@ -429,6 +432,49 @@ void MeBasedGlobalMotionDetection(
 	return;
 }
 
+/************************************************
+* ME MV Histogram
+** Histogram of the 64x64 L0 MV magnitudes (full-pel,
+** per picture interval, rounded up) of the picture,
+** used as motion history by the HME level selection
+************************************************/
+static void ComputeMeMvHistogram(
+	PictureParentControlSet_t         *pictureControlSetPtr)
+{
+	EB_U32	lcuIndex;
+	EB_S32	xMv;
+	EB_S32	yMv;
+	EB_U32	magnitude;
+	EB_U32	binIndex;
+	EB_U32	distance;
+
+	EB_MEMSET(pictureControlSetPtr->meMvHistogram, 0, sizeof(pictureControlSetPtr->meMvHistogram));
+
+	if (pictureControlSetPtr->sliceType == EB_I_SLICE) {
+		return;
+	}
+
+	distance = (EB_U32)ABS((EB_S64)pictureControlSetPtr->pictureNumber - (EB_S64)pictureControlSetPtr->refPicPocArray[REF_LIST_0]);
+	distance = MAX(distance, 1);
+
+	for (lcuIndex = 0; lcuIndex < pictureControlSetPtr->lcuTotalCount; ++lcuIndex) {
+
+		GetMv(pictureControlSetPtr, lcuIndex, &xMv, &yMv);
+
+		magnitude = (EB_U32)MAX(ABS(xMv), ABS(yMv));
+		magnitude = (((magnitude + 3) >> 2) + distance - 1) / distance;
+
+		binIndex = 0;
+		while (magnitude && binIndex < ME_MV_HISTOGRAM_BINS - 1) {
+			magnitude >>= 1;
+			++binIndex;
+		}
+
+		++pictureControlSetPtr->meMvHistogram[binIndex];
+	}
+
+	return;
+}
 
 void StationaryEdgeCountLcu(
     SequenceControlSet_t        *sequenceControlSetPtr,
@@ -932,12 +978,38 @@ void* InitialRateControlKernel(void *inputPtr)
 			sequenceControlSetPtr = (SequenceControlSet_t*)pictureControlSetPtr->sequenceControlSetWrapperPtr->objectPtr;
 			encodeContextPtr = (EncodeContext_t*)sequenceControlSetPtr->encodeContextPtr;
 
+            EbFinishTime(
+                (unsigned long long*)&pictureControlSetPtr->stageDoneTimeSeconds[PICTURE_STAGE_MOTION_ESTIMATION],
+                (unsigned long long*)&pictureControlSetPtr->stageDoneTimeuSeconds[PICTURE_STAGE_MOTION_ESTIMATION]);
+
             // Mark picture when global motion is detected using ME results
             //reset intraCodedEstimationLcu
             MeBasedGlobalMotionDetection(
                 sequenceControlSetPtr,
                 pictureControlSetPtr);
 
+            ComputeMeMvHistogram(
+                pictureControlSetPtr);
+
+            // Post the ME segments of the pictures held back for this picture's ME results
+            {
+                PictureParentControlSet_t *waitingPictureControlSetPtr;
+
+                EbBlockOnMutex(pictureControlSetPtr->meDoneMutex);
+                pictureControlSetPtr->meDone = EB_TRUE;
+                waitingPictureControlSetPtr = pictureControlSetPtr->meWaitingListHead;
+                pictureControlSetPtr->meWaitingListHead = (PictureParentControlSet_t*)EB_NULL;
+                EbReleaseMutex(pictureControlSetPtr->meDoneMutex);
+
+                // The segments were filled by Picture Decision, so posting them never blocks
+                while (waitingPictureControlSetPtr) {
+                    PictureParentControlSet_t *nextPictureControlSetPtr = waitingPictureControlSetPtr->meWaitingListNext;
+
+                    PostHeldPictureDecisionResults(waitingPictureControlSetPtr->meHeldResultsWrapperPtr);
+                    waitingPictureControlSetPtr = nextPictureControlSetPtr;
+                }
+            }
+
 			// Release Pa Ref pictures when not needed 
 			ReleasePaReferenceObjects(
 				pictureControlSetPtr);
@@ -14,6 +14,7 @@
 #include "EbModeDecisionProcess.h"
 #include "EbErrorCodes.h"
 #include "EbErrorHandling.h"
+#include "EbRtcd.h"
 
 static const EB_U32 smoothingFilterShift[] = {
     3, // 4x4
@@ -1682,7 +1683,6 @@ EB_ERRORTYPE GenerateIntraReference16bitSamplesEncodePass(
     const EB_U32          chromaRatio = (colorFormat==EB_YUV420 || colorFormat==EB_YUV422)?1:0;
     const EB_U32          puChromaSize    = size >> chromaRatio;
 
-    EB_U32                yLoadCounter;
     EB_U16                *sampleReadLoc;
     EB_U16                *sampleWriteLoc;
     EB_U16                *sampleWriteLocCb;
@@ -2072,9 +2072,6 @@ EB_ERRORTYPE GenerateIntraReference16bitSamplesEncodePass(
     //*************************************************
     sampleReadLoc = yBorder;
     sampleWriteLoc = yBorderFilt;
-    // Loop is only over the non-edge samples (TotalCount - 2)
-    yLoadCounter = (size << 2) - 1;
-
     if(strongIntraSmoothingFlag == EB_TRUE) {
         EB_U32 filterShift;
         EB_U32 index;
@@ -2098,32 +2095,13 @@ EB_ERRORTYPE GenerateIntraReference16bitSamplesEncodePass(
             }
         }
         else {
-            // First Sample
-            *sampleWriteLoc++ = *sampleReadLoc++;
-
-            // Internal Filtered Samples
-            do {
-                *sampleWriteLoc++ = (sampleReadLoc[-1] + (sampleReadLoc[0] << 1) + sampleReadLoc[1] + 2) >> 2;
-                ++sampleReadLoc;
-            } while(--yLoadCounter);
-
-            // Last Sample
-            *sampleWriteLoc = *sampleReadLoc;
+            // [1 2 1] filter, the first and last samples are copied
+            rtcd.IntraFilterReferenceSamples16bit(sampleReadLoc, sampleWriteLoc, (size << 2) + 1);
         }
     }
     else {
-
-        // First Sample
-        *sampleWriteLoc++ = *sampleReadLoc++;
-
-        // Internal Filtered Samples
-        do {
-            *sampleWriteLoc++ = (sampleReadLoc[-1] + (sampleReadLoc[0] << 1) + sampleReadLoc[1] + 2) >> 2;
-            ++sampleReadLoc;
-        } while(--yLoadCounter);
-
-        // Last Sample
-        *sampleWriteLoc = *sampleReadLoc;
+        // [1 2 1] filter, the first and last samples are copied
+        rtcd.IntraFilterReferenceSamples16bit(sampleReadLoc, sampleWriteLoc, (size << 2) + 1);
     }
 
     //*************************************************
@@ -2216,7 +2194,6 @@ EB_ERRORTYPE GenerateLumaIntraReference16bitSamplesEncodePass(
 
     const EB_U32          sizeLog2      = Log2f(size);
 
-    EB_U32 yLoadCounter;
     EB_U16 *sampleReadLoc;
     EB_U16 *sampleWriteLoc;
     EB_U32 i;
@@ -2552,9 +2529,6 @@ EB_ERRORTYPE GenerateLumaIntraReference16bitSamplesEncodePass(
     //*************************************************
     sampleReadLoc = yBorder;
     sampleWriteLoc = yBorderFilt;
-    // Loop is only over the non-edge samples (TotalCount - 2)
-    yLoadCounter = (size << 2) - 1;
-
     if(strongIntraSmoothingFlag == EB_TRUE) {
         EB_U32 filterShift;
         EB_U32 index;
@@ -2579,32 +2553,13 @@ EB_ERRORTYPE GenerateLumaIntraReference16bitSamplesEncodePass(
             }
         }
         else {
-            // First Sample
-            *sampleWriteLoc++ = *sampleReadLoc++;
-
-            // Internal Filtered Samples
-            do {
-                *sampleWriteLoc++ = (sampleReadLoc[-1] + (sampleReadLoc[0] << 1) + sampleReadLoc[1] + 2) >> 2;
-                ++sampleReadLoc;
-            } while(--yLoadCounter);
-
-            // Last Sample
-            *sampleWriteLoc = *sampleReadLoc;
+            // [1 2 1] filter, the first and last samples are copied
+            rtcd.IntraFilterReferenceSamples16bit(sampleReadLoc, sampleWriteLoc, (size << 2) + 1);
         }
     }
     else {
-
-        // First Sample
-        *sampleWriteLoc++ = *sampleReadLoc++;
-
-        // Internal Filtered Samples
-        do {
-            *sampleWriteLoc++ = (sampleReadLoc[-1] + (sampleReadLoc[0] << 1) + sampleReadLoc[1] + 2) >> 2;
-            ++sampleReadLoc;
-        } while(--yLoadCounter);
-
-        // Last Sample
-        *sampleWriteLoc = *sampleReadLoc;
+        // [1 2 1] filter, the first and last samples are copied
+        rtcd.IntraFilterReferenceSamples16bit(sampleReadLoc, sampleWriteLoc, (size << 2) + 1);
     }
 
     //*************************************************
@@ -2688,10 +2643,7 @@ EB_ERRORTYPE GenerateChromaIntraReference16bitSamplesEncodePass(
     const EB_U32 chromaOffset = (colorFormat == EB_YUV422 && secondChroma) ? puChromaSize : 0;
 
     EB_U32 i;
-    EB_U32 yLoadCounter;
-    EB_U16 *sampleReadLocCb;
     EB_U16 *sampleWriteLocCb;
-    EB_U16 *sampleReadLocCr;
     EB_U16 *sampleWriteLocCr;
     EB_U16 *sampleWriteLocCbFilt;
     EB_U16 *sampleWriteLocCrFilt;
@@ -3056,28 +3008,9 @@ EB_ERRORTYPE GenerateChromaIntraReference16bitSamplesEncodePass(
         //*************************************************
         // Part 2.5: Intra Filter Samples for ChromaArrayType==3
         //*************************************************
-        sampleReadLocCb = cbBorder;
-        sampleWriteLocCb = cbBorderFilt;
-        sampleReadLocCr = crBorder;
-        sampleWriteLocCr = crBorderFilt;
-        // Loop is only over the non-edge samples (TotalCount - 2)
-        yLoadCounter = (size << 2) - 1;
-
-        // First Sample
-        *sampleWriteLocCb++ = *sampleReadLocCb++;
-        *sampleWriteLocCr++ = *sampleReadLocCr++;
-
-        // Internal Filtered Samples
-        do {
-            *sampleWriteLocCb++ = (sampleReadLocCb[-1] + (sampleReadLocCb[0] << 1) + sampleReadLocCb[1] + 2) >> 2;
-            *sampleWriteLocCr++ = (sampleReadLocCr[-1] + (sampleReadLocCr[0] << 1) + sampleReadLocCr[1] + 2) >> 2;
-            ++sampleReadLocCb;
-            ++sampleReadLocCr;
-        } while(--yLoadCounter);
-
-        // Last Sample
-        *sampleWriteLocCb = *sampleReadLocCb;
-        *sampleWriteLocCr = *sampleReadLocCr;
+        // [1 2 1] filter, the first and last samples are copied
+        rtcd.IntraFilterReferenceSamples16bit(cbBorder, cbBorderFilt, (size << 2) + 1);
+        rtcd.IntraFilterReferenceSamples16bit(crBorder, crBorderFilt, (size << 2) + 1);
     }
 
     //*************************************************
@@ -3151,7 +3084,7 @@ static void IntraModeAngular_27To33(
     EB_S32           intraPredAngle = intraModeAngularTable[mode - INTRA_VERTICAL_MODE];
     refSampMain    = refSamples + (size << 1);
 
-	IntraAngVertical_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+	rtcd.IntraAngVertical(
         size, 
         refSampMain,
         predictionPtr,              
@@ -3172,7 +3105,7 @@ static void IntraModeAngular16bit_27To33(
     EB_S32           intraPredAngle = intraModeAngularTable[mode - INTRA_VERTICAL_MODE];
     refSampMain    = refSamples + (size << 1);
     
-    IntraAngVertical_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+    rtcd.IntraAngVertical_16bit(
         size, 
         refSampMain,
         predictionPtr,              
@@ -3234,7 +3167,7 @@ static void IntraModeAngular_19To25(
     }
 
    
-	IntraAngVertical_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+	rtcd.IntraAngVertical(
         size, 
         refSampMain,
         predictionPtr,              
@@ -3295,7 +3228,7 @@ static void IntraModeAngular16bit_19To25(
     }
 
    
-	IntraAngVertical_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+	rtcd.IntraAngVertical_16bit(
         size, 
         refSampMain,
         predictionPtr,              
@@ -3352,7 +3285,7 @@ static void IntraModeAngular_11To17(
     } 
 
   
-	IntraAngHorizontal_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+	rtcd.IntraAngHorizontal(
         size, 
         refSampMain,
         predictionPtr,              
@@ -3407,7 +3340,7 @@ static void IntraModeAngular16bit_11To17(
     } 
 
   
-   IntraAngHorizontal_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+   rtcd.IntraAngHorizontal_16bit(
         size, 
         refSampMain,
         predictionPtr,              
@@ -3434,7 +3367,7 @@ static void IntraModeAngular_3To9(
     
     refSampMain = refSamples-1;
       
-	IntraAngHorizontal_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+	rtcd.IntraAngHorizontal(
         size, 
         refSampMain,
         predictionPtr,              
@@ -3461,7 +3394,7 @@ static void IntraModeAngular16bit_3To9(
     refSampMain = refSamples-1;
 
       
-	IntraAngHorizontal_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+	rtcd.IntraAngHorizontal_16bit(
         size, 
         refSampMain,
         predictionPtr,              
@@ -3493,7 +3426,7 @@ static inline void IntraModeAngular_all(
     switch(mode){
         case 34:
 
-            IntraAng34_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+            rtcd.IntraAng34(
                 puSize,
                 refSamples,
                 predictionPtr,
@@ -3520,7 +3453,7 @@ static inline void IntraModeAngular_all(
                 AboveReadyFlag);
             break;
         case 18:
-            IntraAng18_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+            rtcd.IntraAng18(
                 puSize,
                 refSamples,
                 predictionPtr,
@@ -3547,7 +3480,7 @@ static inline void IntraModeAngular_all(
             break;
         case 2:
             
-            IntraAng2_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+            rtcd.IntraAng2(
                 puSize,
                 refSamplesReverse,
                 predictionPtr,
@@ -3576,7 +3509,7 @@ static inline void IntraModeAngular16bit_all(
     switch(mode){
         case 34:
 
-            IntraAng34_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraAng34_16bit(
                 puSize,
                 refSamples,
                 predictionPtr,
@@ -3603,7 +3536,7 @@ static inline void IntraModeAngular16bit_all(
                 AboveReadyFlag);
             break;
         case 18:
-            IntraAng18_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraAng18_16bit(
                 puSize,
                 refSamples,
                 predictionPtr,
@@ -3630,7 +3563,7 @@ static inline void IntraModeAngular16bit_all(
             break;
         case 2:
             
-            IntraAng2_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraAng2_16bit(
                 puSize,
                 refSamplesReverse,
                 predictionPtr,
@@ -3715,7 +3648,7 @@ EB_ERRORTYPE IntraPredictionCl(
            yIntraReferenceArray =  (diffMode > intraLumaFilterTable[Log2f(puWidth)-2])? contextPtr->yIntraFilteredReferenceArrayReverse :
                                     contextPtr->yIntraReferenceArrayReverse;
 
-		   IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		   rtcd.IntraPlanar(
                 puSize,
                 yIntraReferenceArray,
                 &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -3728,7 +3661,7 @@ EB_ERRORTYPE IntraPredictionCl(
 
             yIntraReferenceArray = contextPtr->yIntraReferenceArrayReverse;
       
-            IntraDCLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+            rtcd.IntraDCLuma(
                 puSize,
                 yIntraReferenceArray,
                 &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -3743,7 +3676,7 @@ EB_ERRORTYPE IntraPredictionCl(
                                     contextPtr->yIntraReferenceArrayReverse;
               
        
-            IntraVerticalLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+            rtcd.IntraVerticalLuma(
                 puSize,
                 yIntraReferenceArray,
                 &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -3756,7 +3689,7 @@ EB_ERRORTYPE IntraPredictionCl(
             yIntraReferenceArray =  (diffMode > intraLumaFilterTable[Log2f(puWidth)-2])? contextPtr->yIntraFilteredReferenceArrayReverse :
                                      contextPtr->yIntraReferenceArrayReverse;
 
-            IntraHorzLuma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraHorzLuma(
                 puSize,
                 yIntraReferenceArray,
                 &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -3819,7 +3752,7 @@ EB_ERRORTYPE IntraPredictionCl(
                 
              // Cb Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.IntraPlanar(
                     chromaPuSize,
                     contextPtr->cbIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -3829,7 +3762,7 @@ EB_ERRORTYPE IntraPredictionCl(
       
             // Cr Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.IntraPlanar(
                     chromaPuSize,
                     contextPtr->crIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -3843,7 +3776,7 @@ EB_ERRORTYPE IntraPredictionCl(
               
             // Cb Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-                IntraVerticalChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+                rtcd.IntraVerticalChroma(
                     chromaPuSize,
                     contextPtr->cbIntraReferenceArray,
                     &(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -3853,7 +3786,7 @@ EB_ERRORTYPE IntraPredictionCl(
        
             // Cr Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraVerticalChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraVerticalChroma(
                     chromaPuSize,
                     contextPtr->crIntraReferenceArray,
                     &(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -3867,7 +3800,7 @@ EB_ERRORTYPE IntraPredictionCl(
  
             // Cb Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraHorzChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraHorzChroma(
                     chromaPuSize,
                     contextPtr->cbIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -3877,7 +3810,7 @@ EB_ERRORTYPE IntraPredictionCl(
 
             // Cr Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraHorzChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraHorzChroma(
                     chromaPuSize,
                     contextPtr->crIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -3891,7 +3824,7 @@ EB_ERRORTYPE IntraPredictionCl(
                
             // Cb Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraDCChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraDCChroma(
                     chromaPuSize,
                     contextPtr->cbIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -3901,7 +3834,7 @@ EB_ERRORTYPE IntraPredictionCl(
       
             // Cr Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraDCChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraDCChroma(
                     chromaPuSize,
                     contextPtr->crIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -4020,7 +3953,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
            yIntraReferenceArray =  (diffMode > intraLumaFilterTable[Log2f(puWidth)-2])? contextPtr->yIntraFilteredReferenceArrayReverse :
                                     contextPtr->yIntraReferenceArrayReverse;
 
-		   IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		   rtcd.IntraPlanar(
                 puSize,
                 yIntraReferenceArray,
                 &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -4033,7 +3966,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
 
             yIntraReferenceArray = contextPtr->yIntraReferenceArrayReverse;
       
-			IntraDCLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraDCLuma(
                 puSize,
                 yIntraReferenceArray,
                 &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -4048,7 +3981,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
                                     contextPtr->yIntraReferenceArrayReverse;
               
        
-			IntraVerticalLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraVerticalLuma(
                 puSize,
                 yIntraReferenceArray,
                 &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -4061,7 +3994,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
             yIntraReferenceArray =  (diffMode > intraLumaFilterTable[Log2f(puWidth)-2])? contextPtr->yIntraFilteredReferenceArrayReverse :
                                      contextPtr->yIntraReferenceArrayReverse;
 
-			IntraHorzLuma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraHorzLuma(
                 puSize,
                 yIntraReferenceArray,
                 &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -4115,7 +4048,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
                 
              // Cb Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.IntraPlanar(
                     chromaPuSize,
                     contextPtr->cbIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -4125,7 +4058,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
       
             // Cr Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.IntraPlanar(
                     chromaPuSize,
                     contextPtr->crIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -4139,7 +4072,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
               
             // Cb Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraVerticalChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraVerticalChroma(
                     chromaPuSize,
                     contextPtr->cbIntraReferenceArray,
                     &(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -4149,7 +4082,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
        
             // Cr Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraVerticalChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraVerticalChroma(
                     chromaPuSize,
                     contextPtr->crIntraReferenceArray,
                     &(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -4163,7 +4096,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
  
             // Cb Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraHorzChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraHorzChroma(
                     chromaPuSize,
                     contextPtr->cbIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -4173,7 +4106,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
 
             // Cr Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraHorzChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraHorzChroma(
                     chromaPuSize,
                     contextPtr->crIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -4187,7 +4120,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
                
             // Cb Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraDCChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraDCChroma(
                     chromaPuSize,
                     contextPtr->cbIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -4197,7 +4130,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionCl(
       
             // Cr Intra Prediction
             if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraDCChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraDCChroma(
                     chromaPuSize,
                     contextPtr->crIntraReferenceArrayReverse,
                     &(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -4284,7 +4217,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionOl(
 
     case 0:
         
-		IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.IntraPlanar(
             puSize,
             intraRefPtr->yIntraReferenceArrayReverse,
             &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -4295,7 +4228,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionOl(
 
     case 1:
         
-		IntraDCLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.IntraDCLuma(
             puSize,
             intraRefPtr->yIntraReferenceArrayReverse,
             &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -4306,7 +4239,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionOl(
 
     case 2:
         
-		IntraVerticalLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.IntraVerticalLuma(
             puSize,
             intraRefPtr->yIntraReferenceArrayReverse,
             &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -4317,7 +4250,7 @@ EB_ERRORTYPE Intra4x4IntraPredictionOl(
 
     case 3:
         
-		IntraHorzLuma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.IntraHorzLuma(
             puSize,
             intraRefPtr->yIntraReferenceArrayReverse,
             &(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -4408,7 +4341,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
         switch(lumaMode) {
 
         case EB_INTRA_PLANAR:
-		IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.IntraPlanar(
                 puSize,
                 yIntraReferenceArrayReverse,
                 predictionPtr->bufferY + lumaOffset,
@@ -4418,7 +4351,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
             break;
 
         case EB_INTRA_DC:
-			IntraDCLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraDCLuma(
                 puSize,
                 yIntraReferenceArrayReverse,
                 predictionPtr->bufferY + lumaOffset,
@@ -4428,7 +4361,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
             break;
 
         case EB_INTRA_VERTICAL:
-			IntraVerticalLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraVerticalLuma(
                 puSize,
                 yIntraReferenceArrayReverse,
                 predictionPtr->bufferY + lumaOffset,
@@ -4438,7 +4371,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
             break;
 
         case EB_INTRA_HORIZONTAL:
-			IntraHorzLuma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraHorzLuma(
                 puSize,
                 yIntraReferenceArrayReverse,
                 predictionPtr->bufferY + lumaOffset,
@@ -4511,7 +4444,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
         switch(chromaModeAdj) {
         case EB_INTRA_PLANAR:
              // Cb Intra Prediction
-			IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraPlanar(
                 puChromaSize,
                 cbIntraReferenceArrayReverse,
                 predictionPtr->bufferCb + chromaOffset,
@@ -4519,7 +4452,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
                 EB_FALSE);
 
             // Cr Intra Prediction
-			IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraPlanar(
                 puChromaSize,
                 crIntraReferenceArrayReverse,
                 predictionPtr->bufferCr + chromaOffset,
@@ -4531,7 +4464,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
         case EB_INTRA_VERTICAL:
               
             // Cb Intra Prediction
-			IntraVerticalChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraVerticalChroma(
                 puChromaSize,
                 cbIntraReferenceArrayReverse,
                 predictionPtr->bufferCb + chromaOffset,
@@ -4539,7 +4472,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
                 EB_FALSE);
        
             // Cr Intra Prediction
-			IntraVerticalChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraVerticalChroma(
                 puChromaSize,
                 crIntraReferenceArrayReverse,
                 predictionPtr->bufferCr + chromaOffset,
@@ -4551,7 +4484,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
         case EB_INTRA_HORIZONTAL:
  
              // Cb Intra Prediction
-			IntraHorzChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraHorzChroma(
                 puChromaSize,
                 cbIntraReferenceArrayReverse,
                 predictionPtr->bufferCb + chromaOffset,
@@ -4560,7 +4493,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
                          
 
             // Cr Intra Prediction
-			IntraHorzChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraHorzChroma(
                 puChromaSize,
                 crIntraReferenceArrayReverse,
                 predictionPtr->bufferCr + chromaOffset,
@@ -4572,7 +4505,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
         case EB_INTRA_DC:
                
             // Cb Intra Prediction
-			IntraDCChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraDCChroma(
                 puChromaSize,
                 cbIntraReferenceArrayReverse,
                 predictionPtr->bufferCb + chromaOffset,
@@ -4581,7 +4514,7 @@ EB_ERRORTYPE EncodePassIntraPrediction(
 
       
             // Cr Intra Prediction
-			IntraDCChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraDCChroma(
                 puChromaSize,
                 crIntraReferenceArrayReverse,
                 predictionPtr->bufferCr + chromaOffset,
@@ -4689,7 +4622,7 @@ EB_ERRORTYPE EncodePassIntraPrediction16bit(
         switch(lumaMode) {
 
         case EB_INTRA_PLANAR:
-        IntraPlanar_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+        rtcd.IntraPlanar_16bit(
                 puSize,
                 yIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferY + lumaOffset,
@@ -4698,7 +4631,7 @@ EB_ERRORTYPE EncodePassIntraPrediction16bit(
             break;
 
         case EB_INTRA_DC:
-            IntraDCLuma_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraDCLuma_16bit(
                 puSize,
                 yIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferY + lumaOffset,
@@ -4707,7 +4640,7 @@ EB_ERRORTYPE EncodePassIntraPrediction16bit(
             break;
 
         case EB_INTRA_VERTICAL:
-            IntraVerticalLuma_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraVerticalLuma_16bit(
                 puSize,
                 yIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferY + lumaOffset,
@@ -4717,7 +4650,7 @@ EB_ERRORTYPE EncodePassIntraPrediction16bit(
             break;
 
         case EB_INTRA_HORIZONTAL:
-            IntraHorzLuma_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraHorzLuma_16bit(
                 puSize,
                 yIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferY + lumaOffset,
@@ -4788,14 +4721,14 @@ EB_ERRORTYPE EncodePassIntraPrediction16bit(
 
         switch(chromaModeAdj) {
         case EB_INTRA_PLANAR:
-             IntraPlanar_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+             rtcd.IntraPlanar_16bit(
                 puChromaSize,
                 cbIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferCb + chromaOffset,
                 predictionPtr->strideCb,
                 EB_FALSE);
 
-            IntraPlanar_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraPlanar_16bit(
                 puChromaSize,
                 crIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferCr + chromaOffset,
@@ -4804,14 +4737,14 @@ EB_ERRORTYPE EncodePassIntraPrediction16bit(
             break;
 
         case EB_INTRA_VERTICAL:
-            IntraVerticalChroma_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraVerticalChroma_16bit(
                 puChromaSize,
                 cbIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferCb + chromaOffset,
                 predictionPtr->strideCb,
                 EB_FALSE);
        
-            IntraVerticalChroma_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraVerticalChroma_16bit(
                 puChromaSize,
                 crIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferCr + chromaOffset,
@@ -4820,14 +4753,14 @@ EB_ERRORTYPE EncodePassIntraPrediction16bit(
             break;
 
         case EB_INTRA_HORIZONTAL:
-            IntraHorzChroma_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraHorzChroma_16bit(
                 puChromaSize,
                 cbIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferCb + chromaOffset,
                 predictionPtr->strideCb,
                 EB_FALSE);
                          
-            IntraHorzChroma_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraHorzChroma_16bit(
                 puChromaSize,
                 crIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferCr + chromaOffset,
@@ -4836,14 +4769,14 @@ EB_ERRORTYPE EncodePassIntraPrediction16bit(
             break;
 
         case EB_INTRA_DC:
-            IntraDCChroma_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraDCChroma_16bit(
                 puChromaSize,
                 cbIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferCb + chromaOffset,
                 predictionPtr->strideCb,
                 EB_FALSE);
 
-            IntraDCChroma_16bit_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.IntraDCChroma_16bit(
                 puChromaSize,
                 crIntraReferenceArrayReverse,
                 (EB_U16*)predictionPtr->bufferCr + chromaOffset,
@@ -5316,7 +5249,7 @@ EB_ERRORTYPE IntraPredictionOpenLoop(
 
     case 0:
         
-		IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.IntraPlanar(
             cuSize,
             contextPtr->intraRefPtr->yIntraReferenceArrayReverse,
             (&(contextPtr->meContextPtr->lcuBuffer[0])),
@@ -5327,7 +5260,7 @@ EB_ERRORTYPE IntraPredictionOpenLoop(
 
     case 1:
         
-		IntraDCLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.IntraDCLuma(
             cuSize,
             contextPtr->intraRefPtr->yIntraReferenceArrayReverse,
             (&(contextPtr->meContextPtr->lcuBuffer[0])),
@@ -5338,7 +5271,7 @@ EB_ERRORTYPE IntraPredictionOpenLoop(
 
     case 2:
         
-		IntraVerticalLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.IntraVerticalLuma(
             cuSize,
             contextPtr->intraRefPtr->yIntraReferenceArrayReverse,
             (&(contextPtr->meContextPtr->lcuBuffer[0])),
@@ -5349,7 +5282,7 @@ EB_ERRORTYPE IntraPredictionOpenLoop(
 
     case 3:
         
-		IntraHorzLuma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+		rtcd.IntraHorzLuma(
             cuSize,
             contextPtr->intraRefPtr->yIntraReferenceArrayReverse,
             (&(contextPtr->meContextPtr->lcuBuffer[0])),
@@ -5434,7 +5367,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 		case 0:
 
-			IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraPlanar(
 				puSize,
 				intraRefPtr->yIntraReferenceArrayReverse,
 				&(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -5445,7 +5378,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 		case 1:
 
-			IntraDCLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraDCLuma(
 				puSize,
 				intraRefPtr->yIntraReferenceArrayReverse,
 				&(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -5456,7 +5389,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 		case 2:
 
-			IntraVerticalLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraVerticalLuma(
 				puSize,
 				intraRefPtr->yIntraReferenceArrayReverse,
 				&(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -5467,7 +5400,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 		case 3:
 
-			IntraHorzLuma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraHorzLuma(
 				puSize,
 				intraRefPtr->yIntraReferenceArrayReverse,
 				&(candidateBufferPtr->predictionPtr->bufferY[puOriginIndex]),
@@ -5527,7 +5460,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 			// Cb Intra Prediction
 			if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.IntraPlanar(
 					chromaPuSize,
 					intraRefPtr->cbIntraReferenceArrayReverse,
 					&(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -5537,7 +5470,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 			// Cr Intra Prediction
 			if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.IntraPlanar(
 					chromaPuSize,
 					intraRefPtr->crIntraReferenceArrayReverse,
 					&(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -5551,7 +5484,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 			// Cb Intra Prediction
 			if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraVerticalChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraVerticalChroma(
 					chromaPuSize,
 					intraRefPtr->cbIntraReferenceArray,
 					&(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -5561,7 +5494,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 			// Cr Intra Prediction
 			if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraVerticalChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraVerticalChroma(
 					chromaPuSize,
 					intraRefPtr->crIntraReferenceArray,
 					&(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -5575,7 +5508,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 			// Cb Intra Prediction
 			if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraHorzChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraHorzChroma(
 					chromaPuSize,
 					intraRefPtr->cbIntraReferenceArrayReverse,
 					&(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -5585,7 +5518,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 			// Cr Intra Prediction
 			if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraHorzChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraHorzChroma(
 					chromaPuSize,
 					intraRefPtr->crIntraReferenceArrayReverse,
 					&(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -5599,7 +5532,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 			// Cb Intra Prediction
 			if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
-				IntraDCChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraDCChroma(
 					chromaPuSize,
 					intraRefPtr->cbIntraReferenceArrayReverse,
 					&(candidateBufferPtr->predictionPtr->bufferCb[puChromaOriginIndex]),
@@ -5609,7 +5542,7 @@ EB_ERRORTYPE IntraPredictionOl(
 
 			// Cr Intra Prediction
 			if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
-				IntraDCChroma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+				rtcd.IntraDCChroma(
 					chromaPuSize,
 					intraRefPtr->crIntraReferenceArrayReverse,
 					&(candidateBufferPtr->predictionPtr->bufferCr[puChromaOriginIndex]),
@@ -5712,7 +5645,7 @@ EB_ERRORTYPE IntraPredOnSrc(
 
         case 0:
 
-			IntraPlanar_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraPlanar(
                 puSize,
                 intraRefPtr->yIntraReferenceArrayReverse,
                 &(predictionPtr->bufferY[puOriginIndex]),
@@ -5723,7 +5656,7 @@ EB_ERRORTYPE IntraPredOnSrc(
 
         case 1:
 
-			IntraDCLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraDCLuma(
                 puSize,
                 intraRefPtr->yIntraReferenceArrayReverse,
                 &(predictionPtr->bufferY[puOriginIndex]),
@@ -5734,7 +5667,7 @@ EB_ERRORTYPE IntraPredOnSrc(
 
         case 2:
 
-			IntraVerticalLuma_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.IntraVerticalLuma(
                 puSize,
                 intraRefPtr->yIntraReferenceArrayReverse,
                 &(predictionPtr->bufferY[puOriginIndex]),
@@ -5745,7 +5678,7 @@ EB_ERRORTYPE IntraPredOnSrc(
 
         case 3:
 
-			IntraHorzLuma_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](
+			rtcd.IntraHorzLuma(
                 puSize,
                 intraRefPtr->yIntraReferenceArrayReverse,
                 &(predictionPtr->bufferY[puOriginIndex]),
@@ -663,6 +663,14 @@ extern const ChromaFilterNew            uniPredChromaIFFunctionPtrArrayNew[EB_AS
 extern const ChromaFilterOutRaw         biPredChromaIFFunctionPtrArrayNew[EB_ASM_TYPE_TOTAL][64];
 extern const sampleBiPredClipping16bit biPredClipping16bitFuncPtrArray[EB_ASM_TYPE_TOTAL];
 
+// AVX2 rows, selected over the SSSE3 row when AVX2 is available
+extern const sampleBiPredClipping       biPredClippingFuncPtrArray_Avx2[1];
+extern const InterpolationFilterNew     uniPredLumaIFFunctionPtrArrayNew_Avx2[1][16];
+extern const InterpolationFilterOutRaw  biPredLumaIFFunctionPtrArrayNew_Avx2[1][16];
+extern const ChromaFilterNew            uniPredChromaIFFunctionPtrArrayNew_Avx2[1][64];
+extern const ChromaFilterOutRaw         biPredChromaIFFunctionPtrArrayNew_Avx2[1][64];
+extern const ChromaFilterOutRaw16bit    biPredChromaIFFunctionPtrArrayNew16bit_Avx2[1][64];
+
 
 #ifdef __cplusplus
 }
@@ -18,6 +18,11 @@ const sampleBiPredClipping biPredClippingFuncPtrArray[EB_ASM_TYPE_TOTAL] = {
     BiPredClipping_SSSE3,
 };
 
+const sampleBiPredClipping biPredClippingFuncPtrArray_Avx2[1] = {
+    // AVX2
+    BiPredClipping_AVX2_INTRIN,
+};
+
 const sampleBiPredClipping16bit biPredClipping16bitFuncPtrArray[EB_ASM_TYPE_TOTAL] = {
 	// C_DEFAULT
     BiPredClipping16bit,
@@ -66,6 +71,28 @@ const InterpolationFilterNew uniPredLumaIFFunctionPtrArrayNew[EB_ASM_TYPE_TOTAL]
     },
 };
 
+const InterpolationFilterNew uniPredLumaIFFunctionPtrArrayNew_Avx2[1][16] = {
+    // AVX2
+    {
+        LumaInterpolationCopy_SSSE3,                         //A
+        LumaInterpolationFilterPosa_AVX2_INTRIN,             //a
+        LumaInterpolationFilterPosb_AVX2_INTRIN,             //b
+        LumaInterpolationFilterPosc_AVX2_INTRIN,             //c
+        LumaInterpolationFilterPosd_AVX2_INTRIN,             //d
+        LumaInterpolationFilterPose_AVX2_INTRIN,             //e
+        LumaInterpolationFilterPosf_AVX2_INTRIN,             //f
+        LumaInterpolationFilterPosg_AVX2_INTRIN,             //g
+        LumaInterpolationFilterPosh_AVX2_INTRIN,             //h
+        LumaInterpolationFilterPosi_AVX2_INTRIN,             //i
+        LumaInterpolationFilterPosj_AVX2_INTRIN,             //j
+        LumaInterpolationFilterPosk_AVX2_INTRIN,             //k
+        LumaInterpolationFilterPosn_AVX2_INTRIN,             //n
+        LumaInterpolationFilterPosp_AVX2_INTRIN,             //p
+        LumaInterpolationFilterPosq_AVX2_INTRIN,             //q
+        LumaInterpolationFilterPosr_AVX2_INTRIN,             //r
+    },
+};
+
 // Luma
 const InterpolationFilterNew16bit uniPredLuma16bitIFFunctionPtrArray[EB_ASM_TYPE_TOTAL][16] = {     //[ASM type][Interpolation position]
 		// C_DEFAULT
@@ -150,6 +177,28 @@ const InterpolationFilterOutRaw biPredLumaIFFunctionPtrArrayNew[EB_ASM_TYPE_TOTA
         },
 };
 
+const InterpolationFilterOutRaw biPredLumaIFFunctionPtrArrayNew_Avx2[1][16] = {
+        // AVX2
+        {
+            LumaInterpolationCopyOutRaw_SSSE3,                   //A
+            LumaInterpolationFilterPosaOutRaw_AVX2_INTRIN,       //a
+            LumaInterpolationFilterPosbOutRaw_AVX2_INTRIN,       //b
+            LumaInterpolationFilterPoscOutRaw_AVX2_INTRIN,       //c
+            LumaInterpolationFilterPosdOutRaw_AVX2_INTRIN,       //d
+            LumaInterpolationFilterPoseOutRaw_AVX2_INTRIN,       //e
+            LumaInterpolationFilterPosfOutRaw_AVX2_INTRIN,       //f
+            LumaInterpolationFilterPosgOutRaw_AVX2_INTRIN,       //g
+            LumaInterpolationFilterPoshOutRaw_AVX2_INTRIN,       //h
+            LumaInterpolationFilterPosiOutRaw_AVX2_INTRIN,       //i
+            LumaInterpolationFilterPosjOutRaw_AVX2_INTRIN,       //j
+            LumaInterpolationFilterPoskOutRaw_AVX2_INTRIN,       //k
+            LumaInterpolationFilterPosnOutRaw_AVX2_INTRIN,       //n
+            LumaInterpolationFilterPospOutRaw_AVX2_INTRIN,       //p
+            LumaInterpolationFilterPosqOutRaw_AVX2_INTRIN,       //q
+            LumaInterpolationFilterPosrOutRaw_AVX2_INTRIN,       //r
+        },
+};
+
 const InterpolationFilterOutRaw16bit biPredLumaIFFunctionPtrArrayNew16bit[EB_ASM_TYPE_TOTAL][16] = {
 		// C_DEFAULT
 		{
@@ -262,7 +311,6 @@ const ChromaFilterNew uniPredChromaIFFunctionPtrArrayNew[EB_ASM_TYPE_TOTAL][64]
         },
         // AVX2
         {
-
             ChromaInterpolationCopy_SSSE3,                       //B
             ChromaInterpolationFilterOneDHorizontal_SSSE3,		 //ab
             ChromaInterpolationFilterOneDHorizontal_SSSE3,       //ac
@@ -330,6 +378,76 @@ const ChromaFilterNew uniPredChromaIFFunctionPtrArrayNew[EB_ASM_TYPE_TOTAL][64]
         },
 };
 
+const ChromaFilterNew uniPredChromaIFFunctionPtrArrayNew_Avx2[1][64] = {
+        // AVX2
+        {
+            ChromaInterpolationCopy_SSSE3,                       //B
+            ChromaInterpolationFilterOneDHorizontal_AVX2_INTRIN, //ab
+            ChromaInterpolationFilterOneDHorizontal_AVX2_INTRIN, //ac
+            ChromaInterpolationFilterOneDHorizontal_AVX2_INTRIN, //ad
+            ChromaInterpolationFilterOneDHorizontal_AVX2_INTRIN, //ae
+            ChromaInterpolationFilterOneDHorizontal_AVX2_INTRIN, //af
+            ChromaInterpolationFilterOneDHorizontal_AVX2_INTRIN, //ag
+            ChromaInterpolationFilterOneDHorizontal_AVX2_INTRIN, //ah
+            ChromaInterpolationFilterOneDVertical_AVX2_INTRIN,   //ba
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //bb
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //bc
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //bd
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //be
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //bf
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //bg
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //bh
+            ChromaInterpolationFilterOneDVertical_AVX2_INTRIN,   //ca
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //cb
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //cc
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //cd
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //ce
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //cf
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //cg
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //ch
+            ChromaInterpolationFilterOneDVertical_AVX2_INTRIN,   //da
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //db
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //dc
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //dd
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //de
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //df
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //dg
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //dh
+            ChromaInterpolationFilterOneDVertical_AVX2_INTRIN,   //ea
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //eb
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //ec
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //ed
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //ee
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //ef
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //eg
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //eh
+            ChromaInterpolationFilterOneDVertical_AVX2_INTRIN,   //fa
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //fb
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //fc
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //fd
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //fe
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //ff
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //fg
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //fh
+            ChromaInterpolationFilterOneDVertical_AVX2_INTRIN,   //ga
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //gb
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //gc
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //gd
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //ge
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //gf
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //gg
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //gh
+            ChromaInterpolationFilterOneDVertical_AVX2_INTRIN,   //ha
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //hb
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //hc
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //hd
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //he
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //hf
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //hg
+            ChromaInterpolationFilterTwoD_AVX2_INTRIN,           //hh
+        },
+};
+
 
 const InterpolationFilterChromaNew16bit uniPredChromaIFFunctionPtrArrayNew16bit[EB_ASM_TYPE_TOTAL][64] = {
         // C_DEFAULT
@@ -605,6 +723,76 @@ const ChromaFilterOutRaw biPredChromaIFFunctionPtrArrayNew[EB_ASM_TYPE_TOTAL][64
         },
 };
 
+const ChromaFilterOutRaw biPredChromaIFFunctionPtrArrayNew_Avx2[1][64] = {
+        // AVX2
+        {
+            ChromaInterpolationCopyOutRaw_SSSE3,                 //B
+            ChromaInterpolationFilterOneDOutRawHorizontal_AVX2_INTRIN,//ab
+            ChromaInterpolationFilterOneDOutRawHorizontal_AVX2_INTRIN,//ac
+            ChromaInterpolationFilterOneDOutRawHorizontal_AVX2_INTRIN,//ad
+            ChromaInterpolationFilterOneDOutRawHorizontal_AVX2_INTRIN,//ae
+            ChromaInterpolationFilterOneDOutRawHorizontal_AVX2_INTRIN,//af
+            ChromaInterpolationFilterOneDOutRawHorizontal_AVX2_INTRIN,//ag
+            ChromaInterpolationFilterOneDOutRawHorizontal_AVX2_INTRIN,//ah
+            ChromaInterpolationFilterOneDOutRawVertical_AVX2_INTRIN,//ba
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //bb
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //bc
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //bd
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //be
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //bf
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //bg
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //bh
+            ChromaInterpolationFilterOneDOutRawVertical_AVX2_INTRIN,//ca
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //cb
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //cc
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //cd
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //ce
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //cf
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //cg
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //ch
+            ChromaInterpolationFilterOneDOutRawVertical_AVX2_INTRIN,//da
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //db
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //dc
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //dd
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //de
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //df
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //dg
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //dh
+            ChromaInterpolationFilterOneDOutRawVertical_AVX2_INTRIN,//ea
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //eb
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //ec
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //ed
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //ee
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //ef
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //eg
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //eh
+            ChromaInterpolationFilterOneDOutRawVertical_AVX2_INTRIN,//fa
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //fb
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //fc
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //fd
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //fe
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //ff
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //fg
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //fh
+            ChromaInterpolationFilterOneDOutRawVertical_AVX2_INTRIN,//ga
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //gb
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //gc
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //gd
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //ge
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //gf
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //gg
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //gh
+            ChromaInterpolationFilterOneDOutRawVertical_AVX2_INTRIN,//ha
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //hb
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //hc
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //hd
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //he
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //hf
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //hg
+            ChromaInterpolationFilterTwoDOutRaw_AVX2_INTRIN,     //hh
+        },
+};
+
 const ChromaFilterOutRaw16bit biPredChromaIFFunctionPtrArrayNew16bit[EB_ASM_TYPE_TOTAL][64] = {
         // C_DEFAULT
         {
@@ -673,6 +861,77 @@ const ChromaFilterOutRaw16bit biPredChromaIFFunctionPtrArrayNew16bit[EB_ASM_TYPE
             ChromaInterpolationFilterTwoDOutRaw16bit,                 //hg
             ChromaInterpolationFilterTwoDOutRaw16bit,                 //hh
         },
+        // SSE2
+        {
+            ChromaInterpolationCopyOutRaw16bit_SSE2_INTRIN,                 //B
+            ChromaInterpolationFilterOneDOutRaw16bitHorizontal_SSE2_INTRIN, //ab
+            ChromaInterpolationFilterOneDOutRaw16bitHorizontal_SSE2_INTRIN, //ac
+            ChromaInterpolationFilterOneDOutRaw16bitHorizontal_SSE2_INTRIN, //ad
+            ChromaInterpolationFilterOneDOutRaw16bitHorizontal_SSE2_INTRIN, //ae
+            ChromaInterpolationFilterOneDOutRaw16bitHorizontal_SSE2_INTRIN, //af
+            ChromaInterpolationFilterOneDOutRaw16bitHorizontal_SSE2_INTRIN, //ag
+            ChromaInterpolationFilterOneDOutRaw16bitHorizontal_SSE2_INTRIN, //ah
+            ChromaInterpolationFilterOneDOutRaw16bitVertical_SSE2_INTRIN,   //ba
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //bb
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //bc
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //bd
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //be
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //bf
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //bg
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //bh
+            ChromaInterpolationFilterOneDOutRaw16bitVertical_SSE2_INTRIN,   //ca
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //cb
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //cc
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //cd
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //ce
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //cf
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //cg
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //ch
+            ChromaInterpolationFilterOneDOutRaw16bitVertical_SSE2_INTRIN,   //da
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //db
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //dc
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //dd
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //de
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //df
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //dg
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //dh
+            ChromaInterpolationFilterOneDOutRaw16bitVertical_SSE2_INTRIN,   //ea
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //eb
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //ec
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //ed
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //ee
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //ef
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //eg
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //eh
+            ChromaInterpolationFilterOneDOutRaw16bitVertical_SSE2_INTRIN,   //fa
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //fb
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //fc
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //fd
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //fe
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //ff
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //fg
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //fh
+            ChromaInterpolationFilterOneDOutRaw16bitVertical_SSE2_INTRIN,   //ga
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //gb
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //gc
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //gd
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //ge
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //gf
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //gg
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //gh
+            ChromaInterpolationFilterOneDOutRaw16bitVertical_SSE2_INTRIN,   //ha
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //hb
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //hc
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //hd
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //he
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //hf
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //hg
+            ChromaInterpolationFilterTwoDOutRaw16bit_SSE2_INTRIN,           //hh
+
+        },
+};
+
+const ChromaFilterOutRaw16bit biPredChromaIFFunctionPtrArrayNew16bit_Avx2[1][64] = {
         // AVX2
         {
             ChromaInterpolationCopyOutRaw16bit_SSE2_INTRIN,                 //B
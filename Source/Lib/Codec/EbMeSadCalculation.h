@@ -99,33 +99,6 @@ typedef void(*EB_RECTAMPSADCALCULATION_TYPE)(
     EB_U32  *pBestMV24x32,
     EB_U32   mv);
 
-
-/***************************************
-* Function Tables
-***************************************/
-static EB_SADCALCULATION8X8AND16X16_TYPE SadCalculation_8x8_16x16_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
-    // C_DEFAULT
-    SadCalculation_8x8_16x16,
-    // AVX2
-	SadCalculation_8x8_16x16_SSE2_INTRIN,
-};
-
-static EB_SADCALCULATION32X32AND64X64_TYPE SadCalculation_32x32_64x64_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
-    // C_DEFAULT
-    SadCalculation_32x32_64x64,
-    // AVX2      
-	SadCalculation_32x32_64x64_SSE2_INTRIN,
-};
-
-
-static EB_INIALIZEBUFFER_32BITS InitializeBuffer_32bits_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
-    // C_DEFAULT
-    InitializeBuffer_32bits,
-    // AVX2
-    InitializeBuffer_32bits_SSE2_INTRIN
-};
-
-
 #ifdef __cplusplus
 }
 #endif        
@@ -19,6 +19,7 @@
 #include "EbModeDecisionProcess.h"
 #include "EbComputeSAD.h"
 #include "EbModeDecisionConfiguration.h"
+#include "EbRtcd.h"
 
 /********************************************
 * Constants
@@ -94,7 +95,7 @@ void intraSearchTheseModesOutputBest(
         const EB_U32 puOriginIndex = (contextPtr->cuOriginY & 63) * 64 + (contextPtr->cuOriginX & 63);
 
         //Distortion
-        sadCurr  = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][cuSize >> 3](
+        sadCurr  = (EB_U32)rtcd.NxMSadKernel[cuSize >> 3](
             src,
             srcStride,
             &(contextPtr->predictionBuffer->bufferY[puOriginIndex]),
@@ -1593,7 +1594,7 @@ EB_ERRORTYPE ProductGenerateAmvpMergeInterIntraMdCandidatesCU(
             firstPuAMVPCandArray_y,
             firstPuNumAvailableAMVPCand);
 
-		if (contextPtr->amvpInjection) {
+		if (contextPtr->amvpInjection && !contextPtr->staticLcu) {
 
 			//----------------------
 			// Amvp2Nx2N
@@ -1608,7 +1609,7 @@ EB_ERRORTYPE ProductGenerateAmvpMergeInterIntraMdCandidatesCU(
 				firstPuNumAvailableAMVPCand);
 		}
          
-        if (pictureControlSetPtr->sliceType == EB_B_SLICE) {
+        if (pictureControlSetPtr->sliceType == EB_B_SLICE && !contextPtr->staticLcu) {
             if (contextPtr->bipred3x3Injection) {
                 //----------------------
                 // Bipred2Nx2N
@@ -573,6 +573,36 @@ void Forward84CuToModeDecision(
 
 }
 
+/******************************************************
+* Forward the 64x64 CU only of the static LCUs (unchanged
+* in the L0 reference), through the MD path
+******************************************************/
+void ForwardStaticLcuToModeDecision(
+    SequenceControlSet_t  *sequenceControlSetPtr,
+    PictureControlSet_t   *pictureControlSetPtr) {
+
+    EB_U32 lcuIndex;
+
+    for (lcuIndex = 0; lcuIndex < pictureControlSetPtr->lcuTotalCount; ++lcuIndex) {
+
+        MdcLcuData_t *resultsPtr = &pictureControlSetPtr->mdcLcuArray[lcuIndex];
+
+        if (!pictureControlSetPtr->ParentPcsPtr->staticLcuArray[lcuIndex] || !sequenceControlSetPtr->lcuParamsArray[lcuIndex].isCompleteLcu) {
+            continue;
+        }
+
+        if (pictureControlSetPtr->ParentPcsPtr->depthMode == PICT_LCU_SWITCH_DEPTH_MODE &&
+            (pictureControlSetPtr->ParentPcsPtr->lcuMdModeArray[lcuIndex] == LCU_BDP_DEPTH_MODE || pictureControlSetPtr->ParentPcsPtr->lcuMdModeArray[lcuIndex] == LCU_LIGHT_BDP_DEPTH_MODE)) {
+            pictureControlSetPtr->ParentPcsPtr->lcuMdModeArray[lcuIndex] = LCU_FULL85_DEPTH_MODE;
+            pictureControlSetPtr->mdPresentFlag = EB_TRUE;
+        }
+
+        resultsPtr->leafCount = 1;
+        resultsPtr->leafDataArray[0].leafIndex = 0;
+        resultsPtr->leafDataArray[0].splitFlag = EB_FALSE;
+    }
+}
+
 void Forward8x816x16CuToModeDecisionLCU(
     SequenceControlSet_t  *sequenceControlSetPtr,
     PictureControlSet_t   *pictureControlSetPtr,
@@ -2232,6 +2262,8 @@ void* ModeDecisionConfigurationKernel(void *inputPtr)
 		pictureControlSetPtr->ParentPcsPtr->averageQp = 0;
 
 		pictureControlSetPtr->intraCodedArea = 0;
+		pictureControlSetPtr->interCodedArea = 0;
+		pictureControlSetPtr->skipCodedArea = 0;
 
         pictureControlSetPtr->sceneCaracteristicId = EB_FRAME_CARAC_0;
 
@@ -2366,6 +2398,13 @@ void* ModeDecisionConfigurationKernel(void *inputPtr)
             pictureControlSetPtr->ParentPcsPtr->averageQp = (EB_U8)pictureControlSetPtr->ParentPcsPtr->pictureQp; 
         }
 
+        // Static LCUs: 64x64 CU only (no BDP picture: the BDP path does not use the MDC partitioning)
+        if (pictureControlSetPtr->sliceType != EB_I_SLICE && pictureControlSetPtr->ParentPcsPtr->depthMode != PICT_BDP_DEPTH_MODE && pictureControlSetPtr->ParentPcsPtr->depthMode != PICT_LIGHT_BDP_DEPTH_MODE) {
+            ForwardStaticLcuToModeDecision(
+                sequenceControlSetPtr,
+                pictureControlSetPtr);
+        }
+
 #if DEADLOCK_DEBUG
         SVT_LOG("POC %lld MDC OUT \n", pictureControlSetPtr->pictureNumber);
 #endif
@@ -234,6 +234,7 @@ typedef struct ModeDecisionContext_s
 	MdCodingUnit_t					mdLocalCuUnit[CU_MAX_COUNT];
 	EB_BOOL                         cuUseRefSrcFlag; 
     EB_BOOL                         restrictIntraGlobalMotion;    
+    EB_BOOL                         staticLcu;                    // LCU unchanged in the L0 reference: ME 2Nx2N and merge/skip candidates only
     EB_U8                           interpolationMethod;
 
     EB_BOOL                         coeffCabacUpdate;
@@ -4,6 +4,7 @@
 */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "EbDefinitions.h"
 
@@ -20,9 +21,29 @@
 #include "EbIntraPrediction.h"
 #include "EbLambdaRateTables.h"
 #include "EbPictureOperators.h"
+#include "EbRtcd.h"
+#include "EbThreads.h"
 
 #define OIS_TH_COUNT	4
 
+#define TEMPORAL_HME_SEED_MV_TH         16  // Max spread of the projected predictors (quarter-pel)
+#define TEMPORAL_HME_SEED_AREA_PERCENT  50  // HME level-0 search area kept when the predictors agree
+
+#define MV_PROJECTION_SEARCH_AREA_WIDTH  16  // Full-pel refinement window around a projected MV
+#define MV_PROJECTION_SEARCH_AREA_HEIGHT 9
+#define MV_PROJECTION_SAD_TH             6   // Per-sample SAD above which the LCU falls back to the full search
+
+#define ADAPTIVE_SR_STATIC_SAD_TH        2   // Per-sample (0,0) SAD under which an LCU with a (0,0) HME center is static
+#define ADAPTIVE_SR_MV_SPREAD_TH         4   // Full-pel distance of the neighbouring MVs to the HME center for consistent motion
+#define ADAPTIVE_SR_MIN_WIDTH            8
+#define ADAPTIVE_SR_MIN_HEIGHT           3
+
+#define FAST_FULL_PEL_SAD_TH_QP_SHIFT    3   // Per-sample SAD (qp >> 3) under which the ring full-pel search stops
+
+#define HASH_ME_MAX_COMPARES             32  // Exact comparisons of the LCU with positions of its hash per reference
+
+#define STATIC_LCU_8x8_SAD_TH            64  // Co-located 8x8 SAD (noise) below which a block is unchanged
+
 EB_S32 OisPointTh[3][MAX_TEMPORAL_LAYERS][OIS_TH_COUNT] = {
     {
         // Light OIS
@@ -155,7 +176,7 @@ EB_U32 stage1ModesArray[9] = { EB_INTRA_HORIZONTAL, EB_INTRA_VERTICAL, EB_INTRA_
 /*******************************************
 * GetEightHorizontalSearchPointResultsAll85CUs
 *******************************************/
-static void GetEightHorizontalSearchPointResultsAll85PUs_C(
+void GetEightHorizontalSearchPointResultsAll85PUs_C(
 	MeContext_t             *contextPtr,
 	EB_U32                   listIndex,
 	EB_U32                   searchRegionIndex,
@@ -289,23 +310,6 @@ static void GetEightHorizontalSearchPointResultsAll85PUs_C(
 }
 
 
-typedef void(*EB_FPSEARCH_FUNC)(
-	MeContext_t             *contextPtr,
-	EB_U32                   listIndex,
-	EB_U32                   searchRegionIndex,
-	EB_U32                   xSearchIndex,
-	EB_U32                   ySearchIndex);
-
-/*****************************
-* Function Tables
-*****************************/
-static EB_FPSEARCH_FUNC FUNC_TABLE GetEightHorizontalSearchPointResultsAll85PUs_funcPtrArray[EB_ASM_TYPE_TOTAL] =
-{
-	GetEightHorizontalSearchPointResultsAll85PUs_C,
-	GetEightHorizontalSearchPointResultsAll85PUs_AVX512_INTRIN
-};
-
-
 /*******************************************
  * GetSearchPointResults
  *******************************************/
@@ -355,87 +359,87 @@ static void GetSearchPointResults(
 	//---- 16x16 : 0
 	blockIndex = 0;
 	searchPositionIndex = searchPositionTLIndex;
-	SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[0], &pBestSad16x16[0], &pBestMV8x8[0], &pBestMV16x16[0], currMV, &pSad16x16[0]);
+	rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[0], &pBestSad16x16[0], &pBestMV8x8[0], &pBestMV16x16[0], currMV, &pSad16x16[0]);
 
 	//---- 16x16 : 1
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionTLIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[4], &pBestSad16x16[1], &pBestMV8x8[4], &pBestMV16x16[1], currMV, &pSad16x16[1]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[4], &pBestSad16x16[1], &pBestMV8x8[4], &pBestMV16x16[1], currMV, &pSad16x16[1]);
 
     //---- 16x16 : 4
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[16], &pBestSad16x16[4], &pBestMV8x8[16], &pBestMV16x16[4], currMV, &pSad16x16[4]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[16], &pBestSad16x16[4], &pBestMV8x8[16], &pBestMV16x16[4], currMV, &pSad16x16[4]);
 
 
 	//---- 16x16 : 5
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[20], &pBestSad16x16[5], &pBestMV8x8[20], &pBestMV16x16[5], currMV, &pSad16x16[5]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[20], &pBestSad16x16[5], &pBestMV8x8[20], &pBestMV16x16[5], currMV, &pSad16x16[5]);
 
 
 	//---- 16x16 : 2
 	blockIndex = srcNext16x16Offset;
 	searchPositionIndex = searchPositionTLIndex + refNext16x16Offset;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[8], &pBestSad16x16[2], &pBestMV8x8[8], &pBestMV16x16[2], currMV, &pSad16x16[2]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[8], &pBestSad16x16[2], &pBestMV8x8[8], &pBestMV16x16[2], currMV, &pSad16x16[2]);
 
     //---- 16x16 : 3
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-	SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[12], &pBestSad16x16[3], &pBestMV8x8[12], &pBestMV16x16[3], currMV, &pSad16x16[3]);
+	rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[12], &pBestSad16x16[3], &pBestMV8x8[12], &pBestMV16x16[3], currMV, &pSad16x16[3]);
 
     //---- 16x16 : 6
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-	SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[24], &pBestSad16x16[6], &pBestMV8x8[24], &pBestMV16x16[6], currMV, &pSad16x16[6]);
+	rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[24], &pBestSad16x16[6], &pBestMV8x8[24], &pBestMV16x16[6], currMV, &pSad16x16[6]);
 
     //---- 16x16 : 7
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[28], &pBestSad16x16[7], &pBestMV8x8[28], &pBestMV16x16[7], currMV, &pSad16x16[7]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[28], &pBestSad16x16[7], &pBestMV8x8[28], &pBestMV16x16[7], currMV, &pSad16x16[7]);
 
 
 	//---- 16x16 : 8
 	blockIndex = (srcNext16x16Offset << 1);
 	searchPositionIndex = searchPositionTLIndex + (refNext16x16Offset << 1);
-	SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[32], &pBestSad16x16[8], &pBestMV8x8[32], &pBestMV16x16[8], currMV, &pSad16x16[8]);
+	rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[32], &pBestSad16x16[8], &pBestMV8x8[32], &pBestMV16x16[8], currMV, &pSad16x16[8]);
 
     //---- 16x16 : 9
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[36], &pBestSad16x16[9], &pBestMV8x8[36], &pBestMV16x16[9], currMV, &pSad16x16[9]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[36], &pBestSad16x16[9], &pBestMV8x8[36], &pBestMV16x16[9], currMV, &pSad16x16[9]);
 
     //---- 16x16 : 12
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;	searchPositionIndex = searchPositionIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[48], &pBestSad16x16[12], &pBestMV8x8[48], &pBestMV16x16[12], currMV, &pSad16x16[12]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[48], &pBestSad16x16[12], &pBestMV8x8[48], &pBestMV16x16[12], currMV, &pSad16x16[12]);
 
     //---- 16x16 : 13
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[52], &pBestSad16x16[13], &pBestMV8x8[52], &pBestMV16x16[13], currMV, &pSad16x16[13]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[52], &pBestSad16x16[13], &pBestMV8x8[52], &pBestMV16x16[13], currMV, &pSad16x16[13]);
 
 	//---- 16x16 : 10
 	blockIndex = (srcNext16x16Offset * 3);
 	searchPositionIndex = searchPositionTLIndex + (refNext16x16Offset * 3);
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[40], &pBestSad16x16[10], &pBestMV8x8[40], &pBestMV16x16[10], currMV, &pSad16x16[10]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[40], &pBestSad16x16[10], &pBestMV8x8[40], &pBestMV16x16[10], currMV, &pSad16x16[10]);
 
     //---- 16x16 : 11
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[44], &pBestSad16x16[11], &pBestMV8x8[44], &pBestMV16x16[11], currMV, &pSad16x16[11]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[44], &pBestSad16x16[11], &pBestMV8x8[44], &pBestMV16x16[11], currMV, &pSad16x16[11]);
 
     //---- 16x16 : 14
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[56], &pBestSad16x16[14], &pBestMV8x8[56], &pBestMV16x16[14], currMV, &pSad16x16[14]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[56], &pBestSad16x16[14], &pBestMV8x8[56], &pBestMV16x16[14], currMV, &pSad16x16[14]);
 
     //---- 16x16 : 15
 	blockIndex = blockIndex + 16;
 	searchPositionIndex = searchPositionIndex + 16;
-    SadCalculation_8x8_16x16_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[60], &pBestSad16x16[15], &pBestMV8x8[60], &pBestMV16x16[15], currMV, &pSad16x16[15]);
+    rtcd.SadCalculation_8x8_16x16(srcPtr + blockIndex, srcStride, refPtr + searchPositionIndex, reflumaStride, &pBestSad8x8[60], &pBestSad16x16[15], &pBestMV8x8[60], &pBestMV16x16[15], currMV, &pSad16x16[15]);
 
-	SadCalculation_32x32_64x64_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](pSad16x16, pBestSad32x32, pBestSad64x64, pBestMV32x32, pBestMV64x64, currMV);
+	rtcd.SadCalculation_32x32_64x64(pSad16x16, pBestSad32x32, pBestSad64x64, pBestMV32x32, pBestMV64x64, currMV);
 
 }
 
@@ -463,7 +467,7 @@ static void FullPelSearch_LCU(
 
 			//this function will do:  xSearchIndex, +1, +2, ..., +7
 
-			GetEightHorizontalSearchPointResultsAll85PUs_funcPtrArray[ (ASM_TYPES & AVX512_MASK) && 1 ](
+			rtcd.GetEightHorizontalSearchPointResultsAll85PUs(
 				contextPtr,
 				listIndex,
 				xSearchIndex + ySearchIndex * contextPtr->interpolatedFullStride[listIndex][0],
@@ -489,22 +493,96 @@ static void FullPelSearch_LCU(
 }
 
 /*******************************************
- * InterpolateSearchRegion AVC
- *   interpolates the search area
- *   the whole search area is interpolated 15 times
- *   for each sub position an interpolation is done
- *   15 buffers are required for the storage of the interpolated samples.
- *   F0: {-4, 54, 16, -2}
+ * FullPelSearchRings_LCU
+ *   predictor-centred full-pel search: the search
+ *   area is visited in rings of 8 positions x 8 rows
+ *   around the search center, and the search stops
+ *   after the first ring where the 64x64 and all
+ *   32x32 SADs are below the QP-derived thresholds
+ *******************************************/
+static void FullPelSearchRings_LCU(
+	MeContext_t             *contextPtr,
+	EB_U32                   listIndex,
+	EB_S16                   xSearchAreaOrigin,
+	EB_S16                   ySearchAreaOrigin,
+	EB_U32                   searchAreaWidth,
+	EB_U32                   searchAreaHeight,
+	EB_S16                   xSearchCenter,
+	EB_S16                   ySearchCenter,
+	EB_U32                   qp)
+{
+	EB_U32  searchAreaWidthRest8 = searchAreaWidth & 7;
+	EB_U32  searchAreaWidthMult8 = searchAreaWidth - searchAreaWidthRest8;
+	// Groups of 8 positions, plus one group with the remaining positions of each row
+	EB_S32  groupCount = (EB_S32)(searchAreaWidthMult8 >> 3) + (searchAreaWidthRest8 ? 1 : 0);
+	EB_S32  xCenter = CLIP3(0, (EB_S32)searchAreaWidth - 1, xSearchCenter - xSearchAreaOrigin);
+	EB_S32  yCenter = CLIP3(0, (EB_S32)searchAreaHeight - 1, ySearchCenter - ySearchAreaOrigin);
+	EB_S32  groupCenter = MIN(xCenter >> 3, groupCount - 1);
+	EB_S32  ringCount = MAX(MAX(groupCenter, groupCount - 1 - groupCenter), (MAX(yCenter, (EB_S32)searchAreaHeight - 1 - yCenter) + 7) >> 3) + 1;
+	EB_U32  sadTh64x64 = (64 * 64 * qp) >> FAST_FULL_PEL_SAD_TH_QP_SHIFT;
+	EB_U32  sadTh32x32 = (32 * 32 * qp) >> FAST_FULL_PEL_SAD_TH_QP_SHIFT;
+	EB_S32  ring, groupIndex, ySearchIndex;
+	EB_U32  xSearchIndex;
+
+	for (ring = 0; ring < ringCount; ++ring) {
+
+		for (ySearchIndex = MAX(0, yCenter - (ring << 3)); ySearchIndex <= MIN((EB_S32)searchAreaHeight - 1, yCenter + (ring << 3)); ++ySearchIndex) {
+
+			EB_S32 yRing = (ABS(ySearchIndex - yCenter) + 7) >> 3;
+
+			for (groupIndex = MAX(0, groupCenter - ring); groupIndex <= MIN(groupCount - 1, groupCenter + ring); ++groupIndex) {
+
+				// Visited in an inner ring
+				if (MAX(yRing, ABS(groupIndex - groupCenter)) != ring) {
+					continue;
+				}
+
+				if ((EB_U32)(groupIndex << 3) < searchAreaWidthMult8) {
+					rtcd.GetEightHorizontalSearchPointResultsAll85PUs(
+						contextPtr,
+						listIndex,
+						(groupIndex << 3) + ySearchIndex * contextPtr->interpolatedFullStride[listIndex][0],
+						(groupIndex << 3) + xSearchAreaOrigin,
+						ySearchIndex + ySearchAreaOrigin);
+				}
+				else {
+					for (xSearchIndex = searchAreaWidthMult8; xSearchIndex < searchAreaWidth; xSearchIndex++) {
+						GetSearchPointResults(
+							contextPtr,
+							listIndex,
+							xSearchIndex + ySearchIndex * contextPtr->interpolatedFullStride[listIndex][0],
+							xSearchIndex + xSearchAreaOrigin,
+							ySearchIndex + ySearchAreaOrigin);
+					}
+				}
+			}
+		}
+
+		if (contextPtr->pBestSad64x64[0] < sadTh64x64 &&
+			contextPtr->pBestSad32x32[0] < sadTh32x32 &&
+			contextPtr->pBestSad32x32[1] < sadTh32x32 &&
+			contextPtr->pBestSad32x32[2] < sadTh32x32 &&
+			contextPtr->pBestSad32x32[3] < sadTh32x32) {
+			break;
+		}
+	}
+}
+
+/*******************************************
+ * InterpolateReferenceBandsAVC
+ *   makes sure rows [firstRow, lastRow] of the half-pel planes of the
+ *   reference are interpolated. The planes cover the whole padded picture
+ *   and are filled one band of MAX_LCU_SIZE rows at a time, the first time
+ *   any ME segment of any picture asks for it; they are read-only afterwards.
+ *   Segments filling different bands run concurrently.
+ *   b: F1 horizontal, h: F1 vertical, j: F1 vertical on b
  *   F1: {-4, 36, 36, -4}
- *   F2: {-2, 16, 54, -4}
  ********************************************/
-void InterpolateSearchRegionAVC(
-	MeContext_t             *contextPtr,           // input/output parameter, ME context ptr, used to get/set interpolated search area Ptr
-	EB_U32                   listIndex,            // Refrence picture list index
-	EB_U8                   *searchRegionBuffer,   // input parameter, search region index, used to point to reference samples
-	EB_U32                   lumaStride,           // input parameter, reference Picture stride
-	EB_U32                   searchAreaWidth,      // input parameter, search area width
-	EB_U32                   searchAreaHeight)     // input parameter, search area height
+static void InterpolateReferenceBandsAVC(
+	MeContext_t             *contextPtr,           // input parameter, ME context ptr, used to get the filter scratch buffer
+	EbPaReferenceObject_t   *referenceObject,      // input parameter, reference the half-pel planes are attached to
+	EB_S32                   firstRow,             // input parameter, first needed row of the padded picture
+	EB_S32                   lastRow)              // input parameter, last needed row of the padded picture
 {
 
 	//      0    1    2    3
@@ -531,53 +609,88 @@ void InterpolateSearchRegionAVC(
 	// q         3           2           F1                 F2
 	// r         3           3           F2                 F2
 
-	// Start a b c
+	EbPictureBufferDesc_t *refPicPtr = referenceObject->inputPaddedPicturePtr;
+	EbHalfPelPlanes_t *halfPelPlanes = referenceObject->halfPelPlanes;
+	const EB_U32 stride = refPicPtr->strideY;
+	const EB_S32 bandHeight = MAX_LCU_SIZE;
+	const EB_S32 planeHeight = (EB_S32)halfPelPlanes->planeHeight;
+	const EB_S32 lastBand = (EB_S32)halfPelPlanes->bandCount - 1;
 
-	// The Search area needs to be a multiple of 8 to align with the ASM kernel
-	// Also the search area must be oversized by 2 to account for edge conditions
-	EB_U32 searchAreaWidthForAsm = ROUND_UP_MUL_8(searchAreaWidth + 2);
+	// Keep the 4-tap support inside the row; the search area never gets closer
+	// than ME_FILTER_TAP samples to the edge of the padded picture
+	const EB_U32 firstColumn = ME_FILTER_TAP;
+	const EB_U32 width = stride - (ME_FILTER_TAP << 1);
+	EB_S32 bandIndex;
 
-	// Half pel interpolation of the search region using f1 -> posbBuffer
-	if (searchAreaWidthForAsm){
+	firstRow = MAX(firstRow, 0);
+	lastRow = MIN(lastRow, planeHeight - 1);
 
-		AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][1](
-			searchRegionBuffer - (ME_FILTER_TAP >> 1) * lumaStride - (ME_FILTER_TAP >> 1) + 1,
-			lumaStride,
-			contextPtr->posbBuffer[listIndex][0],
-			contextPtr->interpolatedStride,
-			searchAreaWidthForAsm,
-			searchAreaHeight + ME_FILTER_TAP,
-			contextPtr->avctempBuffer,
-			2);
-	}
+	for (bandIndex = firstRow / bandHeight; bandIndex <= lastRow / bandHeight; ++bandIndex) {
 
-	// Half pel interpolation of the search region using f1 -> poshBuffer
-	if (searchAreaWidthForAsm){
-		AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][2](
-			searchRegionBuffer - (ME_FILTER_TAP >> 1) * lumaStride - 1 + lumaStride,
-			lumaStride,
-			contextPtr->poshBuffer[listIndex][0],
-			contextPtr->interpolatedStride,
-			searchAreaWidthForAsm,
-			searchAreaHeight + 1,
-			contextPtr->avctempBuffer,
-			2);
-	}
+		EB_S32 neighbourBand;
+		EB_S32 rowStart;
+		EB_S32 rowEnd;
 
-	if (searchAreaWidthForAsm){
-		// Half pel interpolation of the search region using f1 -> posjBuffer
-		AvcStyleUniPredLumaIFFunctionPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][2](
-			contextPtr->posbBuffer[listIndex][0] + contextPtr->interpolatedStride,
-			contextPtr->interpolatedStride,
-			contextPtr->posjBuffer[listIndex][0],
-			contextPtr->interpolatedStride,
-			searchAreaWidthForAsm,
-			searchAreaHeight + 1,
-			contextPtr->avctempBuffer,
-			2);
-	}
+		EbBlockOnMutex(halfPelPlanes->halfPelBandMutex[bandIndex]);
+
+		if (halfPelPlanes->halfPelBandReady[bandIndex]) {
+			EbReleaseMutex(halfPelPlanes->halfPelBandMutex[bandIndex]);
+			continue;
+		}
+
+		// j reads b one row above and two rows below the band
+		for (neighbourBand = MAX(bandIndex - 1, 0); neighbourBand <= MIN(bandIndex + 1, lastBand); ++neighbourBand) {
+			EbBlockOnMutex(halfPelPlanes->posbBandMutex[neighbourBand]);
+
+			if (!halfPelPlanes->posbBandReady[neighbourBand]) {
+				rowStart = neighbourBand * bandHeight;
+				rowEnd = MIN(rowStart + bandHeight, planeHeight);
+
+				rtcd.AvcStyleUniPredLumaIF[1](
+					refPicPtr->bufferY + rowStart * stride + firstColumn,
+					stride,
+					halfPelPlanes->posbPlane + rowStart * stride + firstColumn,
+					stride,
+					width,
+					rowEnd - rowStart,
+					contextPtr->avctempBuffer,
+					2);
+
+				halfPelPlanes->posbBandReady[neighbourBand] = EB_TRUE;
+			}
+
+			EbReleaseMutex(halfPelPlanes->posbBandMutex[neighbourBand]);
+		}
+
+		rowStart = MAX(bandIndex * bandHeight, 1);
+		rowEnd = MIN((bandIndex + 1) * bandHeight, planeHeight - 2);
+
+		if (rowEnd > rowStart) {
+			rtcd.AvcStyleUniPredLumaIF[2](
+				refPicPtr->bufferY + rowStart * stride + firstColumn,
+				stride,
+				halfPelPlanes->poshPlane + rowStart * stride + firstColumn,
+				stride,
+				width,
+				rowEnd - rowStart,
+				contextPtr->avctempBuffer,
+				2);
+
+			rtcd.AvcStyleUniPredLumaIF[2](
+				halfPelPlanes->posbPlane + rowStart * stride + firstColumn,
+				stride,
+				halfPelPlanes->posjPlane + rowStart * stride + firstColumn,
+				stride,
+				width,
+				rowEnd - rowStart,
+				contextPtr->avctempBuffer,
+				2);
+		}
 
+		halfPelPlanes->halfPelBandReady[bandIndex] = EB_TRUE;
 
+		EbReleaseMutex(halfPelPlanes->halfPelBandMutex[bandIndex]);
+	}
 
 	return;
 }
@@ -652,7 +765,7 @@ static void PU_HalfPelRefinement(
 
     // Compute SSD for the best full search candidate
     if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
-        *pBestSsd = (EB_U32) SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(puWidth) - 2](
+        *pBestSsd = (EB_U32) rtcd.SpatialFullDistortionKernel[Log2f(puWidth) - 2](
             &(contextPtr->lcuSrcPtr[puLcuBufferIndex]),
             contextPtr->lcuSrcStride,
             &(refBuffer[ySearchIndex * refStride + xSearchIndex]),
@@ -669,14 +782,14 @@ static void PU_HalfPelRefinement(
 		searchRegionIndex = xSearchIndex + (EB_S16)contextPtr->interpolatedStride * ySearchIndex;
 
         distortionLeftPosition = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?            
-            SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
+            rtcd.SpatialFullDistortionKernel[Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
             (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
-                NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                (rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
+                rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
 
         if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
             if (distortionLeftPosition < *pBestSsd) {
-                *pBestSad = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                *pBestSad = (EB_U32)rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
                 *pBestMV = ((EB_U16)yMvHalf[0] << 16) | ((EB_U16)xMvHalf[0]);
                 *pBestSsd = (EB_U32)distortionLeftPosition;
             }
@@ -692,15 +805,15 @@ static void PU_HalfPelRefinement(
 		searchRegionIndex++;
 
         distortionRightPosition = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ? 
-            SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
+            rtcd.SpatialFullDistortionKernel[Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
             (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
-                 NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                (rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
+                 rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
 
 
         if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
             if (distortionRightPosition < *pBestSsd) {
-                *pBestSad = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                *pBestSad = (EB_U32)rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posbBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
                 *pBestMV = ((EB_U16)yMvHalf[1] << 16) | ((EB_U16)xMvHalf[1]);
                 *pBestSsd = (EB_U32)distortionRightPosition;
             }
@@ -716,14 +829,14 @@ static void PU_HalfPelRefinement(
 		searchRegionIndex = xSearchIndex + (EB_S16)contextPtr->interpolatedStride * ySearchIndex;
 
         distortionTopPosition = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ? 
-            SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
+            rtcd.SpatialFullDistortionKernel[Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
             (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
-                 NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                (rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
+                 rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
 
         if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
             if (distortionTopPosition < *pBestSsd) {
-                *pBestSad = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                *pBestSad = (EB_U32)rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
                 *pBestMV = ((EB_U16)yMvHalf[2] << 16) | ((EB_U16)xMvHalf[2]);
                 *pBestSsd = (EB_U32)distortionTopPosition;
             }
@@ -739,14 +852,14 @@ static void PU_HalfPelRefinement(
 		searchRegionIndex += (EB_S16)contextPtr->interpolatedStride;
 
         distortionBottomPosition = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ? 
-            SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
+            rtcd.SpatialFullDistortionKernel[Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
             (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
-                NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                (rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
+                rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
 
         if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
             if (distortionBottomPosition < *pBestSsd) {
-                *pBestSad = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                *pBestSad = (EB_U32)rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(poshBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
                 *pBestMV = ((EB_U16)yMvHalf[3] << 16) | ((EB_U16)xMvHalf[3]);
                 *pBestSsd = (EB_U32)distortionBottomPosition;
             }
@@ -762,14 +875,14 @@ static void PU_HalfPelRefinement(
 		searchRegionIndex = xSearchIndex + (EB_S16)contextPtr->interpolatedStride * ySearchIndex;
 
         distortionTopLeftPosition = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ? 
-            SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
+            rtcd.SpatialFullDistortionKernel[Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
             (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
-                NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                (rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
+                rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
 
         if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
             if (distortionTopLeftPosition < *pBestSsd) {
-                *pBestSad = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                *pBestSad = (EB_U32)rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
                 *pBestMV = ((EB_U16)yMvHalf[4] << 16) | ((EB_U16)xMvHalf[4]);
                 *pBestSsd = (EB_U32)distortionTopLeftPosition;
             }
@@ -786,14 +899,14 @@ static void PU_HalfPelRefinement(
 		searchRegionIndex++;
 
         distortionTopRightPosition = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
-            SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
+            rtcd.SpatialFullDistortionKernel[Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
             (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
-                NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                (rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
+                rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
 
         if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
             if (distortionTopRightPosition < *pBestSsd) {
-                *pBestSad = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                *pBestSad = (EB_U32)rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
                 *pBestMV = ((EB_U16)yMvHalf[5] << 16) | ((EB_U16)xMvHalf[5]);
                 *pBestSsd = (EB_U32)distortionTopRightPosition;
             }
@@ -809,14 +922,14 @@ static void PU_HalfPelRefinement(
 		searchRegionIndex += (EB_S16)contextPtr->interpolatedStride;
 
         distortionBottomRightPosition = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
-            SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
+            rtcd.SpatialFullDistortionKernel[Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
             (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
-                NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                (rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
+                rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
 
         if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
             if (distortionBottomRightPosition < *pBestSsd) {
-                *pBestSad = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
+                *pBestSad = (EB_U32)rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth);
                 *pBestMV = ((EB_U16)yMvHalf[6] << 16) | ((EB_U16)xMvHalf[6]);
                 *pBestSsd = (EB_U32)distortionBottomRightPosition;
             }
@@ -832,14 +945,14 @@ static void PU_HalfPelRefinement(
 		searchRegionIndex--;
 
         distortionBottomLeftPosition = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
-            SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
+            rtcd.SpatialFullDistortionKernel[Log2f(puWidth) - 2](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth) :
             (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
-                (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth));
+                (rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride << 1, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride << 1, puHeight >> 1, puWidth)) << 1 :
+                (rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth));
 
         if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
             if (distortionBottomLeftPosition < *pBestSsd) {
-                *pBestSad = (EB_U32)(NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth));
+                *pBestSad = (EB_U32)(rtcd.NxMSadKernel[puWidth >> 3](&(contextPtr->lcuSrcPtr[puLcuBufferIndex]), contextPtr->lcuSrcStride, &(posjBuffer[searchRegionIndex]), contextPtr->interpolatedStride, puHeight, puWidth));
                 *pBestMV = ((EB_U16)yMvHalf[7] << 16) | ((EB_U16)xMvHalf[7]);
                 *pBestSsd = (EB_U32)distortionBottomLeftPosition;
             }
@@ -1167,12 +1280,12 @@ static void PU_QuarterPelRefinementOnTheFly(
             dist = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
                 CombinedAveragingSSD(&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[0] + searchRegionIndex1, buf1Stride[0], buf2[0] + searchRegionIndex2, buf2Stride[0], puHeight, puWidth) :
                 (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                    (NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[0] + searchRegionIndex1, buf1Stride[0] << 1, buf2[0] + searchRegionIndex2, buf2Stride[0] << 1, puHeight >> 1, puWidth)) << 1 :
-                    NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[0] + searchRegionIndex1, buf1Stride[0], buf2[0] + searchRegionIndex2, buf2Stride[0], puHeight, puWidth);
+                    (rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[0] + searchRegionIndex1, buf1Stride[0] << 1, buf2[0] + searchRegionIndex2, buf2Stride[0] << 1, puHeight >> 1, puWidth)) << 1 :
+                    rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[0] + searchRegionIndex1, buf1Stride[0], buf2[0] + searchRegionIndex2, buf2Stride[0], puHeight, puWidth);
 
             if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
                 if (dist < *pBestSsd) {
-                    *pBestSad = (EB_U32)NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[0] + searchRegionIndex1, buf1Stride[0], buf2[0] + searchRegionIndex2, buf2Stride[0], puHeight, puWidth);
+                    *pBestSad = (EB_U32)rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[0] + searchRegionIndex1, buf1Stride[0], buf2[0] + searchRegionIndex2, buf2Stride[0], puHeight, puWidth);
                     *pBestMV = ((EB_U16)yMvQuarter[0] << 16) | ((EB_U16)xMvQuarter[0]);
                     *pBestSsd = (EB_U32)dist;
                 }
@@ -1194,12 +1307,12 @@ static void PU_QuarterPelRefinementOnTheFly(
             dist = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
                 CombinedAveragingSSD(&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[1] + searchRegionIndex1, buf1Stride[1], buf2[1] + searchRegionIndex2, buf2Stride[1], puHeight, puWidth) :
                 (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                    (NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[1] + searchRegionIndex1, buf1Stride[1] << 1, buf2[1] + searchRegionIndex2, buf2Stride[1] << 1, puHeight >> 1, puWidth)) << 1 :
-                    NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[1] + searchRegionIndex1, buf1Stride[1], buf2[1] + searchRegionIndex2, buf2Stride[1], puHeight, puWidth);
+                    (rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[1] + searchRegionIndex1, buf1Stride[1] << 1, buf2[1] + searchRegionIndex2, buf2Stride[1] << 1, puHeight >> 1, puWidth)) << 1 :
+                    rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[1] + searchRegionIndex1, buf1Stride[1], buf2[1] + searchRegionIndex2, buf2Stride[1], puHeight, puWidth);
 
             if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
                 if (dist < *pBestSsd) {
-                    *pBestSad = (EB_U32)NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[1] + searchRegionIndex1, buf1Stride[1], buf2[1] + searchRegionIndex2, buf2Stride[1], puHeight, puWidth);
+                    *pBestSad = (EB_U32)rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[1] + searchRegionIndex1, buf1Stride[1], buf2[1] + searchRegionIndex2, buf2Stride[1], puHeight, puWidth);
                     *pBestMV = ((EB_U16)yMvQuarter[1] << 16) | ((EB_U16)xMvQuarter[1]);
                     *pBestSsd = (EB_U32)dist;
                 }
@@ -1221,12 +1334,12 @@ static void PU_QuarterPelRefinementOnTheFly(
             dist = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
                 CombinedAveragingSSD(&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[2] + searchRegionIndex1, buf1Stride[2], buf2[2] + searchRegionIndex2, buf2Stride[2], puHeight, puWidth) :
                 (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                    (NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[2] + searchRegionIndex1, buf1Stride[2] << 1, buf2[2] + searchRegionIndex2, buf2Stride[2] << 1, puHeight >> 1, puWidth)) << 1 :
-                    NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[2] + searchRegionIndex1, buf1Stride[2], buf2[2] + searchRegionIndex2, buf2Stride[2], puHeight, puWidth);
+                    (rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[2] + searchRegionIndex1, buf1Stride[2] << 1, buf2[2] + searchRegionIndex2, buf2Stride[2] << 1, puHeight >> 1, puWidth)) << 1 :
+                    rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[2] + searchRegionIndex1, buf1Stride[2], buf2[2] + searchRegionIndex2, buf2Stride[2], puHeight, puWidth);
 
             if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
                 if (dist < *pBestSsd) {
-                    *pBestSad = (EB_U32)NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[2] + searchRegionIndex1, buf1Stride[2], buf2[2] + searchRegionIndex2, buf2Stride[2], puHeight, puWidth);
+                    *pBestSad = (EB_U32)rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[2] + searchRegionIndex1, buf1Stride[2], buf2[2] + searchRegionIndex2, buf2Stride[2], puHeight, puWidth);
                     *pBestMV = ((EB_U16)yMvQuarter[2] << 16) | ((EB_U16)xMvQuarter[2]);
                     *pBestSsd = (EB_U32)dist;
                 }
@@ -1248,12 +1361,12 @@ static void PU_QuarterPelRefinementOnTheFly(
             dist = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
                 CombinedAveragingSSD(&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[3] + searchRegionIndex1, buf1Stride[3], buf2[3] + searchRegionIndex2, buf2Stride[3], puHeight, puWidth) :
                 (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                    (NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[3] + searchRegionIndex1, buf1Stride[3] << 1, buf2[3] + searchRegionIndex2, buf2Stride[3] << 1, puHeight >> 1, puWidth)) << 1 :
-                    NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[3] + searchRegionIndex1, buf1Stride[3], buf2[3] + searchRegionIndex2, buf2Stride[3], puHeight, puWidth);
+                    (rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[3] + searchRegionIndex1, buf1Stride[3] << 1, buf2[3] + searchRegionIndex2, buf2Stride[3] << 1, puHeight >> 1, puWidth)) << 1 :
+                    rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[3] + searchRegionIndex1, buf1Stride[3], buf2[3] + searchRegionIndex2, buf2Stride[3], puHeight, puWidth);
 
             if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
                 if (dist < *pBestSsd) {
-                    *pBestSad = (EB_U32)NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[3] + searchRegionIndex1, buf1Stride[3], buf2[3] + searchRegionIndex2, buf2Stride[3], puHeight, puWidth);
+                    *pBestSad = (EB_U32)rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[3] + searchRegionIndex1, buf1Stride[3], buf2[3] + searchRegionIndex2, buf2Stride[3], puHeight, puWidth);
                     *pBestMV  = ((EB_U16)yMvQuarter[3] << 16) | ((EB_U16)xMvQuarter[3]);
                     *pBestSsd = (EB_U32)dist;
                 }
@@ -1275,12 +1388,12 @@ static void PU_QuarterPelRefinementOnTheFly(
             dist = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
                 CombinedAveragingSSD(&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[4] + searchRegionIndex1, buf1Stride[4], buf2[4] + searchRegionIndex2, buf2Stride[4], puHeight, puWidth) :
                 (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                    (NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[4] + searchRegionIndex1, buf1Stride[4] << 1, buf2[4] + searchRegionIndex2, buf2Stride[4] << 1, puHeight >> 1, puWidth)) << 1 :
-                    NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[4] + searchRegionIndex1, buf1Stride[4], buf2[4] + searchRegionIndex2, buf2Stride[4], puHeight, puWidth);
+                    (rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[4] + searchRegionIndex1, buf1Stride[4] << 1, buf2[4] + searchRegionIndex2, buf2Stride[4] << 1, puHeight >> 1, puWidth)) << 1 :
+                    rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[4] + searchRegionIndex1, buf1Stride[4], buf2[4] + searchRegionIndex2, buf2Stride[4], puHeight, puWidth);
 
             if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
                 if (dist < *pBestSsd) {
-                    *pBestSad = (EB_U32)NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[4] + searchRegionIndex1, buf1Stride[4], buf2[4] + searchRegionIndex2, buf2Stride[4], puHeight, puWidth);
+                    *pBestSad = (EB_U32)rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[4] + searchRegionIndex1, buf1Stride[4], buf2[4] + searchRegionIndex2, buf2Stride[4], puHeight, puWidth);
                     *pBestMV = ((EB_U16)yMvQuarter[4] << 16) | ((EB_U16)xMvQuarter[4]);
                     *pBestSsd = (EB_U32)dist;
                 }
@@ -1303,12 +1416,12 @@ static void PU_QuarterPelRefinementOnTheFly(
             dist = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
                 CombinedAveragingSSD(&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[5] + searchRegionIndex1, buf1Stride[5], buf2[5] + searchRegionIndex2, buf2Stride[5], puHeight, puWidth) :\
                 (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                    (NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[5] + searchRegionIndex1, buf1Stride[5] << 1, buf2[5] + searchRegionIndex2, buf2Stride[5] << 1, puHeight >> 1, puWidth)) << 1 :
-                    NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[5] + searchRegionIndex1, buf1Stride[5], buf2[5] + searchRegionIndex2, buf2Stride[5], puHeight, puWidth);
+                    (rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[5] + searchRegionIndex1, buf1Stride[5] << 1, buf2[5] + searchRegionIndex2, buf2Stride[5] << 1, puHeight >> 1, puWidth)) << 1 :
+                    rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[5] + searchRegionIndex1, buf1Stride[5], buf2[5] + searchRegionIndex2, buf2Stride[5], puHeight, puWidth);
 
             if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
                 if (dist < *pBestSsd) {
-                    *pBestSad = (EB_U32)NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[5] + searchRegionIndex1, buf1Stride[5], buf2[5] + searchRegionIndex2, buf2Stride[5], puHeight, puWidth);
+                    *pBestSad = (EB_U32)rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[5] + searchRegionIndex1, buf1Stride[5], buf2[5] + searchRegionIndex2, buf2Stride[5], puHeight, puWidth);
                     *pBestMV = ((EB_U16)yMvQuarter[5] << 16) | ((EB_U16)xMvQuarter[5]);
                     *pBestSsd = (EB_U32)dist;
                 }
@@ -1330,12 +1443,12 @@ static void PU_QuarterPelRefinementOnTheFly(
             dist = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
                 CombinedAveragingSSD(&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[6] + searchRegionIndex1, buf1Stride[6], buf2[6] + searchRegionIndex2, buf2Stride[6], puHeight, puWidth) :
                 (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                    (NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[6] + searchRegionIndex1, buf1Stride[6] << 1, buf2[6] + searchRegionIndex2, buf2Stride[6] << 1, puHeight >> 1, puWidth)) << 1 :
-                    NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[6] + searchRegionIndex1, buf1Stride[6], buf2[6] + searchRegionIndex2, buf2Stride[6], puHeight, puWidth);
+                    (rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[6] + searchRegionIndex1, buf1Stride[6] << 1, buf2[6] + searchRegionIndex2, buf2Stride[6] << 1, puHeight >> 1, puWidth)) << 1 :
+                    rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[6] + searchRegionIndex1, buf1Stride[6], buf2[6] + searchRegionIndex2, buf2Stride[6], puHeight, puWidth);
 
             if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
                 if (dist < *pBestSsd) {
-                    *pBestSad = (EB_U32)NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[6] + searchRegionIndex1, buf1Stride[6], buf2[6] + searchRegionIndex2, buf2Stride[6], puHeight, puWidth);
+                    *pBestSad = (EB_U32)rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[6] + searchRegionIndex1, buf1Stride[6], buf2[6] + searchRegionIndex2, buf2Stride[6], puHeight, puWidth);
                     *pBestMV = ((EB_U16)yMvQuarter[6] << 16) | ((EB_U16)xMvQuarter[6]);
                     *pBestSsd = (EB_U32)dist;
                 }
@@ -1357,12 +1470,12 @@ static void PU_QuarterPelRefinementOnTheFly(
             dist = (contextPtr->fractionalSearchMethod == SSD_SEARCH) ?
                 CombinedAveragingSSD(&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[7] + searchRegionIndex1, buf1Stride[7], buf2[7] + searchRegionIndex2, buf2Stride[7], puHeight, puWidth) :
                 (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-                    (NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[7] + searchRegionIndex1, buf1Stride[7] << 1, buf2[7] + searchRegionIndex2, buf2Stride[7] << 1, puHeight >> 1, puWidth)) << 1 :
-                    NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[7] + searchRegionIndex1, buf1Stride[7], buf2[7] + searchRegionIndex2, buf2Stride[7], puHeight, puWidth);
+                    (rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE << 1, buf1[7] + searchRegionIndex1, buf1Stride[7] << 1, buf2[7] + searchRegionIndex2, buf2Stride[7] << 1, puHeight >> 1, puWidth)) << 1 :
+                    rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[7] + searchRegionIndex1, buf1Stride[7], buf2[7] + searchRegionIndex2, buf2Stride[7], puHeight, puWidth);
 
             if (contextPtr->fractionalSearchMethod == SSD_SEARCH) {
                 if (dist < *pBestSsd) {
-                    *pBestSad = (EB_U32)NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[7] + searchRegionIndex1, buf1Stride[7], buf2[7] + searchRegionIndex2, buf2Stride[7], puHeight, puWidth);
+                    *pBestSad = (EB_U32)rtcd.NxMSadAveragingKernel[puWidth >> 3](&(contextPtr->lcuBuffer[puLcuBufferIndex]), MAX_LCU_SIZE, buf1[7] + searchRegionIndex1, buf1Stride[7], buf2[7] + searchRegionIndex2, buf2Stride[7], puHeight, puWidth);
                     *pBestMV = ((EB_U16)yMvQuarter[7] << 16) | ((EB_U16)xMvQuarter[7]);
                     *pBestSsd = (EB_U32)dist;
                 }
@@ -1801,48 +1914,43 @@ void HmeOneQuadrantLevel0(
 			searchAreaWidth = (EB_S16)((double)((searchAreaWidth >> 4) << 4));
 		}
 
-	    if (((searchAreaWidth & 15) == 0) && ((ASM_TYPES & AVX512_MASK) && 1))
-	    {
-		    SadLoopKernel_AVX512_HmeL0_INTRIN(
-			    &contextPtr->sixteenthLcuBuffer[0],
-			    contextPtr->sixteenthLcuBufferStride,
-			    &sixteenthRefPicPtr->bufferY[searchRegionIndex],
-			    sixteenthRefPicPtr->strideY * 2,
-			    lcuHeight >> 1, lcuWidth,
-			    // results 
-			    level0BestSad,
-			    xLevel0SearchCenter,
-			    yLevel0SearchCenter,
-			    // range 
-			    sixteenthRefPicPtr->strideY,
-			    searchAreaWidth,
-			    searchAreaHeight
-			    );
-
-        }
-        else {
-            {
-                // Only width equals 16 (LCU equals 64) is updated 
-                // other width sizes work with the old code as the one in"SadLoopKernel_SSE4_1_INTRIN"
-
-                SadLoopKernel(
-                    &contextPtr->sixteenthLcuBuffer[0],
-                    contextPtr->sixteenthLcuBufferStride,
-                    &sixteenthRefPicPtr->bufferY[searchRegionIndex],
-                    sixteenthRefPicPtr->strideY * 2,
-                    lcuHeight >> 1, lcuWidth,
-                    /* results */
-                    level0BestSad,
-                    xLevel0SearchCenter,
-                    yLevel0SearchCenter,
-                    /* range */
-                    sixteenthRefPicPtr->strideY,
-                    searchAreaWidth,
-                    searchAreaHeight
-                    );
-            }
-        }
-    }
+		if (((lcuWidth & 7) == 0) || (lcuWidth == 4))
+		{
+			rtcd.HmeLevel0SadLoopKernel(
+				&contextPtr->sixteenthLcuBuffer[0],
+				contextPtr->sixteenthLcuBufferStride,
+				&sixteenthRefPicPtr->bufferY[searchRegionIndex],
+				sixteenthRefPicPtr->strideY * 2,
+				lcuHeight >> 1, lcuWidth,
+				/* results */
+				level0BestSad,
+				xLevel0SearchCenter,
+				yLevel0SearchCenter,
+				/* range */
+				sixteenthRefPicPtr->strideY,
+				searchAreaWidth,
+				searchAreaHeight
+				);
+		}
+		else
+		{
+			SadLoopKernel(
+				&contextPtr->sixteenthLcuBuffer[0],
+				contextPtr->sixteenthLcuBufferStride,
+				&sixteenthRefPicPtr->bufferY[searchRegionIndex],
+				sixteenthRefPicPtr->strideY * 2,
+				lcuHeight >> 1, lcuWidth,
+				/* results */
+				level0BestSad,
+				xLevel0SearchCenter,
+				yLevel0SearchCenter,
+				/* range */
+				sixteenthRefPicPtr->strideY,
+				searchAreaWidth,
+				searchAreaHeight
+				);
+		}
+	}
 
 	*level0BestSad *= 2; // Multiply by 2 because considered only ever other line
 	*xLevel0SearchCenter += xSearchAreaOrigin;
@@ -1948,43 +2056,22 @@ void HmeLevel0(
 	
 	if (((lcuWidth  & 7) == 0) || (lcuWidth == 4))
 	{
-		if (((searchAreaWidth & 15) == 0) && ((ASM_TYPES & AVX512_MASK) && 1))
-		{
-		    SadLoopKernel_AVX512_HmeL0_INTRIN(
-				&contextPtr->sixteenthLcuBuffer[0],
-				contextPtr->sixteenthLcuBufferStride,
-				&sixteenthRefPicPtr->bufferY[searchRegionIndex],
-				sixteenthRefPicPtr->strideY * 2,
-				lcuHeight >> 1, lcuWidth,
-				// results 
-				level0BestSad,
-				xLevel0SearchCenter,
-				yLevel0SearchCenter,
-				// range 
-				sixteenthRefPicPtr->strideY,
-				searchAreaWidth,
-				searchAreaHeight
-				);
-        }
-		else
-		    {
-			    // Put the first search location into level0 results
-			    NxMSadLoopKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
-				    &contextPtr->sixteenthLcuBuffer[0],
-				    contextPtr->sixteenthLcuBufferStride,
-				    &sixteenthRefPicPtr->bufferY[searchRegionIndex],
-				    sixteenthRefPicPtr->strideY * 2,
-				    lcuHeight >> 1, lcuWidth,
-				    /* results */
-				    level0BestSad,
-				    xLevel0SearchCenter,
-				    yLevel0SearchCenter,
-				    /* range */
-				    sixteenthRefPicPtr->strideY,
-				    searchAreaWidth,
-				    searchAreaHeight
-				    );
-		}
+		// The AVX-512 kernel needs a search area a multiple of 16 wide
+		(((searchAreaWidth & 15) == 0) ? rtcd.HmeLevel0SadLoopKernel : rtcd.NxMSadLoopKernel)(
+			&contextPtr->sixteenthLcuBuffer[0],
+			contextPtr->sixteenthLcuBufferStride,
+			&sixteenthRefPicPtr->bufferY[searchRegionIndex],
+			sixteenthRefPicPtr->strideY * 2,
+			lcuHeight >> 1, lcuWidth,
+			/* results */
+			level0BestSad,
+			xLevel0SearchCenter,
+			yLevel0SearchCenter,
+			/* range */
+			sixteenthRefPicPtr->strideY,
+			searchAreaWidth,
+			searchAreaHeight
+			);
 	}
 	else
 	{
@@ -2091,7 +2178,7 @@ void HmeLevel1(
 	if (((lcuWidth & 7) == 0) || (lcuWidth == 4))
 	{
 		// Put the first search location into level0 results
-		NxMSadLoopKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.NxMSadLoopKernel(
 			&contextPtr->quarterLcuBuffer[0],
 			contextPtr->quarterLcuBufferStride * 2,
 			&quarterRefPicPtr->bufferY[searchRegionIndex],
@@ -2214,7 +2301,7 @@ void HmeLevel2(
 	if ((((lcuWidth & 7) == 0) && (lcuWidth != 40) && (lcuWidth != 56)))
 	{
 		// Put the first search location into level0 results
-		NxMSadLoopKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.NxMSadLoopKernel(
 			contextPtr->lcuSrcPtr,
 			contextPtr->lcuSrcStride * 2,
 			&refPicPtr->bufferY[searchRegionIndex],
@@ -2412,11 +2499,78 @@ static void QuarterPelCompensation(
 	buf1 = buf1 + puShiftXIndex + puShiftYIndex * refStride1;
 	buf2 = buf2 + puShiftXIndex + puShiftYIndex * refStride2;
 
-	PictureAverageArray[(ASM_TYPES & PREAVX2_MASK) && 1](buf1, refStride1, buf2, refStride2, Dst, DstStride, puWidth, puHeight);
+	rtcd.PictureAverageKernel(buf1, refStride1, buf2, refStride2, Dst, DstStride, puWidth, puHeight);
 
 	return;
 }
 
+/*******************************************
+ * QuarterPelCachedCompensation
+ *   returns the quarter-pel prediction of the
+ *   PU from the LCU-local cache; the PU is only
+ *   compensated when one of its 8x8 blocks was
+ *   not already built with the same MV (e.g. by
+ *   the parent PU)
+ *******************************************/
+static EB_U8 *QuarterPelCachedCompensation(
+	MeContext_t           *contextPtr,
+	EB_U32                 listIndex,
+	EB_U32                 mv,
+	EB_U32                 puIndex,
+	EB_U8                  fracPosition,
+	EB_U32                 puWidth,
+	EB_U32                 puHeight,
+	EB_U8                 *pos_Full,
+	EB_U8                 *pos_b,
+	EB_U8                 *pos_h,
+	EB_U8                 *pos_j,
+	EB_U32                 refHalfStride,
+	EB_U32                 refBufferFullStride,
+	EB_U8                 *cacheBuffer)
+{
+	EB_U32   puShiftXIndex = puSearchIndexMap[puIndex][0];
+	EB_U32   puShiftYIndex = puSearchIndexMap[puIndex][1];
+	EB_U32   blockX;
+	EB_U32   blockY;
+	EB_U32   blockIndex;
+	EB_BOOL  cached = EB_TRUE;
+	EB_U8   *dst = cacheBuffer + puShiftXIndex + puShiftYIndex * MAX_LCU_SIZE;
+
+	for (blockY = puShiftYIndex >> 3; cached && blockY < (puShiftYIndex + puHeight) >> 3; ++blockY) {
+		for (blockX = puShiftXIndex >> 3; cached && blockX < (puShiftXIndex + puWidth) >> 3; ++blockX) {
+			blockIndex = blockX + (blockY << 3);
+			cached = (EB_BOOL)(contextPtr->quarterPelCacheValid[listIndex][blockIndex] && contextPtr->quarterPelCacheMv[listIndex][blockIndex] == mv);
+		}
+	}
+
+	if (!cached) {
+
+		QuarterPelCompensation(
+			puIndex,
+			fracPosition,
+			puWidth,
+			puHeight,
+			pos_Full,
+			pos_b,
+			pos_h,
+			pos_j,
+			refHalfStride,
+			refBufferFullStride,
+			dst,
+			MAX_LCU_SIZE);
+
+		for (blockY = puShiftYIndex >> 3; blockY < (puShiftYIndex + puHeight) >> 3; ++blockY) {
+			for (blockX = puShiftXIndex >> 3; blockX < (puShiftXIndex + puWidth) >> 3; ++blockX) {
+				blockIndex = blockX + (blockY << 3);
+				contextPtr->quarterPelCacheValid[listIndex][blockIndex] = EB_TRUE;
+				contextPtr->quarterPelCacheMv[listIndex][blockIndex] = mv;
+			}
+		}
+	}
+
+	return dst;
+}
+
 /*******************************************************************************
  * Requirement: puWidth      = 8, 16, 24, 32, 48 or 64
  * Requirement: puHeight % 2 = 0
@@ -2434,6 +2588,8 @@ EB_U32 BiPredAverging(
 	EB_U32                 puIndex,
 	EB_U8                 *sourcePic,
 	EB_U32                 lumaStride,
+	EB_U32                 firstList,
+	EB_U32                 secondList,
 	EB_U8                  firstFracPos,
 	EB_U8                  secondFracPos,
 	EB_U32                 puWidth,
@@ -2476,7 +2632,10 @@ EB_U32 BiPredAverging(
 	}
 	else{
 
-		QuarterPelCompensation(
+		ptrList0 = QuarterPelCachedCompensation(
+			contextPtr,
+			firstList,
+			meCandidate->Mv[0],
 			puIndex,
 			firstFracPos,
 			puWidth,
@@ -2487,10 +2646,8 @@ EB_U32 BiPredAverging(
 			firstRefPosJ,
 			refBufferStride,
 			refBufferFullList0Stride,
-			firstRefTempDst,
-			MAX_LCU_SIZE);
+			firstRefTempDst);
 
-		ptrList0 = firstRefTempDst;
 		ptrList0Stride = MAX_LCU_SIZE;
 	}
 
@@ -2514,7 +2671,10 @@ EB_U32 BiPredAverging(
 	else{
 		//uni-prediction List1 luma
 		//doing the luma interpolation
-		QuarterPelCompensation(
+		ptrList1 = QuarterPelCachedCompensation(
+			contextPtr,
+			secondList,
+			meCandidate->Mv[1],
 			puIndex,
 			secondFracPos,
 			puWidth,
@@ -2525,17 +2685,15 @@ EB_U32 BiPredAverging(
 			secondRefPosJ,
 			refBufferStride,
 			refBufferFullList1Stride,
-			secondRefTempDst,
-			MAX_LCU_SIZE);
+			secondRefTempDst);
 
-		ptrList1 = secondRefTempDst;
 		ptrList1Stride = MAX_LCU_SIZE;
 
 	}
 
 	// bi-pred luma
     meCandidate->distortion = (contextPtr->fractionalSearchMethod == SUB_SAD_SEARCH) ?
-        NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](sourcePic,
+        rtcd.NxMSadAveragingKernel[puWidth >> 3](sourcePic,
             lumaStride << 1,
             ptrList0,
             ptrList0Stride << 1,
@@ -2543,7 +2701,7 @@ EB_U32 BiPredAverging(
             ptrList1Stride << 1,
             puHeight >> 1,
             puWidth) << 1 :
-        NxMSadAveragingKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][puWidth >> 3](sourcePic,
+        rtcd.NxMSadAveragingKernel[puWidth >> 3](sourcePic,
 		    lumaStride,
 		    ptrList0,
 		    ptrList0Stride,
@@ -2664,6 +2822,8 @@ EB_ERRORTYPE  BiPredictionCompensation(
 		    puIndex,
 		    &(contextPtr->lcuSrcPtr[puLcuBufferIndex]),
 		    contextPtr->lcuSrcStride,
+		    firstList,
+		    secondList,
 		    firstRefFracPos,
 		    secondRefFracPos,
 		    partitionWidth[puIndex],
@@ -2679,8 +2839,8 @@ EB_ERRORTYPE  BiPredictionCompensation(
 		    contextPtr->interpolatedStride,
 		    contextPtr->interpolatedFullStride[firstList][0],
 		    contextPtr->interpolatedFullStride[secondList][0],
-		    &(contextPtr->oneDIntermediateResultsBuf0[0]),
-		    &(contextPtr->oneDIntermediateResultsBuf1[0]));
+		    firstList == REFERENCE_PIC_LIST_0 ? contextPtr->oneDIntermediateResultsBuf0 : contextPtr->oneDIntermediateResultsBuf1,
+		    secondList == REFERENCE_PIC_LIST_0 ? contextPtr->oneDIntermediateResultsBuf0 : contextPtr->oneDIntermediateResultsBuf1);
 
 	return return_error;
 }
@@ -2787,7 +2947,7 @@ EB_ERRORTYPE CheckZeroZeroCenter(
 	searchRegionIndex = (EB_S16)refPicPtr->originX + originX +
 		((EB_S16)refPicPtr->originY + originY) * refPicPtr->strideY;
 
-	zeroMvSad = NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][lcuWidth >> 3](
+	zeroMvSad = rtcd.NxMSadKernel[lcuWidth >> 3](
 		contextPtr->lcuSrcPtr,
 		contextPtr->lcuSrcStride << subsampleSad,
 		&(refPicPtr->bufferY[searchRegionIndex]),
@@ -2801,7 +2961,7 @@ EB_ERRORTYPE CheckZeroZeroCenter(
 	searchRegionIndex = (EB_S16)(refPicPtr->originX + originX) + *xSearchCenter +
 		((EB_S16)(refPicPtr->originY + originY) + *ySearchCenter) * refPicPtr->strideY;
 
-	hmeMvSad = NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][lcuWidth >> 3](
+	hmeMvSad = rtcd.NxMSadKernel[lcuWidth >> 3](
 		contextPtr->lcuSrcPtr,
 		contextPtr->lcuSrcStride << subsampleSad,
 		&(refPicPtr->bufferY[searchRegionIndex]),
@@ -3156,6 +3316,406 @@ EB_ERRORTYPE SuPelEnable(
 	return return_error;
 }
 
+/*******************************************
+ * DeriveTemporalHmeSeed
+ *   projects the 64x64 L0 MVs of the co-located
+ *   and neighbouring LCUs of the L0 reference
+ *   onto the current picture (POC distance
+ *   scaling); returns EB_TRUE with the full-pel
+ *   HME search center when they agree
+ *******************************************/
+static EB_BOOL DeriveTemporalHmeSeed(
+	PictureParentControlSet_t   *pictureControlSetPtr,
+	EB_U32                       lcuIndex,
+	EB_S16                      *xSeed,
+	EB_S16                      *ySeed)
+{
+	static const EB_S32 neighbourOffset[5][2] = { { 0, 0 }, { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+
+	SequenceControlSet_t      *sequenceControlSetPtr = (SequenceControlSet_t*)pictureControlSetPtr->sequenceControlSetWrapperPtr->objectPtr;
+	PictureParentControlSet_t *refPictureControlSetPtr = pictureControlSetPtr->refPaPcsArray[REF_LIST_0];
+	EB_S32 pictureWidthInLcu = (EB_S32)((sequenceControlSetPtr->lumaWidth + MAX_LCU_SIZE - 1) / MAX_LCU_SIZE);
+	EB_S32 pictureHeightInLcu = (EB_S32)((sequenceControlSetPtr->lumaHeight + MAX_LCU_SIZE - 1) / MAX_LCU_SIZE);
+	EB_S32 currentDistance = (EB_S32)(pictureControlSetPtr->pictureNumber - pictureControlSetPtr->refPicPocArray[REF_LIST_0]);
+	EB_S32 refDistance = (EB_S32)(refPictureControlSetPtr->pictureNumber - refPictureControlSetPtr->refPicPocArray[REF_LIST_0]);
+	EB_S32 xMin = 0, xMax = 0, yMin = 0, yMax = 0;
+	EB_S32 xCollocated = 0, yCollocated = 0;
+	EB_U32 neighbourIndex;
+
+	for (neighbourIndex = 0; neighbourIndex < 5; ++neighbourIndex) {
+		EB_S32 lcuX = (EB_S32)(lcuIndex % pictureWidthInLcu) + neighbourOffset[neighbourIndex][0];
+		EB_S32 lcuY = (EB_S32)(lcuIndex / pictureWidthInLcu) + neighbourOffset[neighbourIndex][1];
+		MeCuResults_t *refPuResult;
+		EB_S32 xMv, yMv;
+
+		if (lcuX < 0 || lcuX >= pictureWidthInLcu || lcuY < 0 || lcuY >= pictureHeightInLcu) {
+			continue;
+		}
+
+		// 64x64 PU of the reference LCU, quarter-pel
+		refPuResult = &refPictureControlSetPtr->meResults[lcuX + lcuY * pictureWidthInLcu][0];
+		xMv = refPuResult->xMvL0 * currentDistance / refDistance;
+		yMv = refPuResult->yMvL0 * currentDistance / refDistance;
+
+		if (neighbourIndex == 0) {
+			xCollocated = xMin = xMax = xMv;
+			yCollocated = yMin = yMax = yMv;
+		}
+		else {
+			xMin = MIN(xMin, xMv);
+			xMax = MAX(xMax, xMv);
+			yMin = MIN(yMin, yMv);
+			yMax = MAX(yMax, yMv);
+		}
+	}
+
+	if (xMax - xMin > TEMPORAL_HME_SEED_MV_TH || yMax - yMin > TEMPORAL_HME_SEED_MV_TH) {
+		return EB_FALSE;
+	}
+
+	*xSeed = (EB_S16)CLIP3(-(EB_S32)sequenceControlSetPtr->lumaWidth, (EB_S32)sequenceControlSetPtr->lumaWidth, xCollocated >> 2);
+	*ySeed = (EB_S16)CLIP3(-(EB_S32)sequenceControlSetPtr->lumaHeight, (EB_S32)sequenceControlSetPtr->lumaHeight, yCollocated >> 2);
+
+	return EB_TRUE;
+}
+
+/*******************************************
+ * DeriveProjectedSearchCenter
+ *   projects the co-located 64x64 L0 MV of the
+ *   L0 reference onto listIndex (POC distance
+ *   scaling, i.e. halved for the pictures midway
+ *   between two references); returns EB_TRUE
+ *   when the projected MV is good enough to
+ *   replace HME and the full search area
+ *******************************************/
+static EB_BOOL DeriveProjectedSearchCenter(
+	PictureParentControlSet_t   *pictureControlSetPtr,
+	MeContext_t                 *contextPtr,
+	EbPictureBufferDesc_t       *refPicPtr,
+	EB_U32                       listIndex,
+	EB_U32                       lcuIndex,
+	EB_U32                       lcuOriginX,
+	EB_U32                       lcuOriginY,
+	EB_U32                       lcuWidth,
+	EB_U32                       lcuHeight,
+	EB_S16                      *xProjectedCenter,
+	EB_S16                      *yProjectedCenter)
+{
+	SequenceControlSet_t      *sequenceControlSetPtr = (SequenceControlSet_t*)pictureControlSetPtr->sequenceControlSetWrapperPtr->objectPtr;
+	PictureParentControlSet_t *refPictureControlSetPtr = pictureControlSetPtr->refPaPcsArray[REF_LIST_0];
+	MeCuResults_t             *colPuResult = &refPictureControlSetPtr->meResults[lcuIndex][0];
+	EB_S32 colDistance = (EB_S32)(refPictureControlSetPtr->pictureNumber - refPictureControlSetPtr->refPicPocArray[REF_LIST_0]);
+	EB_S32 distance = (EB_S32)((EB_S64)pictureControlSetPtr->pictureNumber - (EB_S64)pictureControlSetPtr->refPicPocArray[listIndex]);
+	EB_S32 originX = (EB_S32)lcuOriginX;
+	EB_S32 originY = (EB_S32)lcuOriginY;
+	EB_S32 padWidth = (EB_S32)MAX_LCU_SIZE - 1;
+	EB_S32 padHeight = (EB_S32)MAX_LCU_SIZE - 1;
+	EB_S32 xMv, yMv;
+	EB_U32 searchRegionIndex;
+	EB_U32 projectedSad;
+	EB_U32 subsampleSad = 1;
+
+	// Quarter-pel to full-pel, kept inside the area the search regions may cover
+	xMv = (colPuResult->xMvL0 * distance / colDistance) >> 2;
+	yMv = (colPuResult->yMvL0 * distance / colDistance) >> 2;
+	xMv = CLIP3(-padWidth - originX, (EB_S32)sequenceControlSetPtr->lumaWidth - 1 - originX, xMv);
+	yMv = CLIP3(-padHeight - originY, (EB_S32)sequenceControlSetPtr->lumaHeight - 1 - originY, yMv);
+
+	searchRegionIndex = (EB_S16)(refPicPtr->originX + originX) + xMv +
+		((EB_S16)(refPicPtr->originY + originY) + yMv) * refPicPtr->strideY;
+
+	projectedSad = rtcd.NxMSadKernel[lcuWidth >> 3](
+		contextPtr->lcuSrcPtr,
+		contextPtr->lcuSrcStride << subsampleSad,
+		&(refPicPtr->bufferY[searchRegionIndex]),
+		refPicPtr->strideY << subsampleSad,
+		lcuHeight >> subsampleSad,
+		lcuWidth);
+
+	projectedSad = projectedSad << subsampleSad;
+
+	*xProjectedCenter = (EB_S16)xMv;
+	*yProjectedCenter = (EB_S16)yMv;
+
+	return (EB_BOOL)(projectedSad <= lcuWidth * lcuHeight * MV_PROJECTION_SAD_TH);
+}
+
+/*******************************************
+ * DeriveAdaptiveSearchArea
+ *   shrinks the full-pel search area of static
+ *   LCUs (quarter size) and of LCUs whose HME
+ *   center agrees with the MVs of the already
+ *   searched left and top LCUs (half size)
+ *******************************************/
+static void DeriveAdaptiveSearchArea(
+	PictureParentControlSet_t   *pictureControlSetPtr,
+	MeContext_t                 *contextPtr,
+	EbPictureBufferDesc_t       *refPicPtr,
+	EB_U32                       listIndex,
+	EB_U32                       lcuIndex,
+	EB_U32                       lcuOriginX,
+	EB_U32                       lcuOriginY,
+	EB_U32                       lcuWidth,
+	EB_U32                       lcuHeight,
+	EB_S16                       xSearchCenter,
+	EB_S16                       ySearchCenter,
+	EB_S16                      *searchAreaWidth,
+	EB_S16                      *searchAreaHeight)
+{
+	SequenceControlSet_t *sequenceControlSetPtr = (SequenceControlSet_t*)pictureControlSetPtr->sequenceControlSetWrapperPtr->objectPtr;
+	EB_U32 pictureWidthInLcu = (sequenceControlSetPtr->lumaWidth + MAX_LCU_SIZE - 1) / MAX_LCU_SIZE;
+	EB_U32 lcuX = lcuIndex % pictureWidthInLcu;
+	EB_U32 lcuY = lcuIndex / pictureWidthInLcu;
+	EB_U32 shift = 0;
+
+	if (xSearchCenter == 0 && ySearchCenter == 0) {
+		EB_U32 searchRegionIndex = refPicPtr->originX + lcuOriginX + (refPicPtr->originY + lcuOriginY) * refPicPtr->strideY;
+		EB_U32 subsampleSad = 1;
+		EB_U32 zeroMvSad = rtcd.NxMSadKernel[lcuWidth >> 3](
+			contextPtr->lcuSrcPtr,
+			contextPtr->lcuSrcStride << subsampleSad,
+			&(refPicPtr->bufferY[searchRegionIndex]),
+			refPicPtr->strideY << subsampleSad,
+			lcuHeight >> subsampleSad,
+			lcuWidth) << subsampleSad;
+
+		if (zeroMvSad <= lcuWidth * lcuHeight * ADAPTIVE_SR_STATIC_SAD_TH) {
+			shift = 2;
+		}
+	}
+
+	if (shift == 0) {
+		EB_U32 neighbourCount = 0;
+		EB_S32 spread = 0;
+		MeCuResults_t *neighbourPuResult;
+
+		// Left and top LCUs, when they belong to the segment (final MVs, quarter-pel)
+		if (lcuX > contextPtr->segmentStartLcuX) {
+			neighbourPuResult = &pictureControlSetPtr->meResults[lcuIndex - 1][0];
+			spread = MAX(spread, ABS(((listIndex == REF_LIST_0 ? neighbourPuResult->xMvL0 : neighbourPuResult->xMvL1) >> 2) - xSearchCenter));
+			spread = MAX(spread, ABS(((listIndex == REF_LIST_0 ? neighbourPuResult->yMvL0 : neighbourPuResult->yMvL1) >> 2) - ySearchCenter));
+			++neighbourCount;
+		}
+		if (lcuY > contextPtr->segmentStartLcuY) {
+			neighbourPuResult = &pictureControlSetPtr->meResults[lcuIndex - pictureWidthInLcu][0];
+			spread = MAX(spread, ABS(((listIndex == REF_LIST_0 ? neighbourPuResult->xMvL0 : neighbourPuResult->xMvL1) >> 2) - xSearchCenter));
+			spread = MAX(spread, ABS(((listIndex == REF_LIST_0 ? neighbourPuResult->yMvL0 : neighbourPuResult->yMvL1) >> 2) - ySearchCenter));
+			++neighbourCount;
+		}
+
+		if (neighbourCount && spread <= ADAPTIVE_SR_MV_SPREAD_TH) {
+			shift = 1;
+		}
+	}
+
+	if (shift) {
+		*searchAreaWidth = (EB_S16)MAX(ADAPTIVE_SR_MIN_WIDTH, (*searchAreaWidth >> shift) & ~7);
+		*searchAreaHeight = (EB_S16)MAX(ADAPTIVE_SR_MIN_HEIGHT, *searchAreaHeight >> shift);
+		*searchAreaWidth = MIN(*searchAreaWidth, (EB_S16)MIN(contextPtr->searchAreaWidth, 127));
+		*searchAreaHeight = MIN(*searchAreaHeight, (EB_S16)MIN(contextPtr->searchAreaHeight, 127));
+	}
+}
+
+/*******************************************
+ * ColocatedLcuUnchanged
+ *   TRUE when every 8x8 block of the (full)
+ *   LCU matches the co-located block of the
+ *   reference within the noise threshold
+ *******************************************/
+EB_BOOL ColocatedLcuUnchanged(
+	MeContext_t                 *contextPtr,
+	EbPictureBufferDesc_t       *refPicPtr,
+	EB_U32                       lcuOriginX,
+	EB_U32                       lcuOriginY)
+{
+	EB_U8  *refPtr = &refPicPtr->bufferY[(refPicPtr->originY + lcuOriginY) * refPicPtr->strideY + refPicPtr->originX + lcuOriginX];
+	EB_U32  blockX, blockY;
+
+	for (blockY = 0; blockY < MAX_LCU_SIZE; blockY += 8) {
+		for (blockX = 0; blockX < MAX_LCU_SIZE; blockX += 8) {
+			if (rtcd.NxMSadKernel[1](
+					contextPtr->lcuSrcPtr + blockY * contextPtr->lcuSrcStride + blockX,
+					contextPtr->lcuSrcStride,
+					refPtr + blockY * refPicPtr->strideY + blockX,
+					refPicPtr->strideY,
+					8,
+					8) > STATIC_LCU_8x8_SAD_TH) {
+				return EB_FALSE;
+			}
+		}
+	}
+
+	return EB_TRUE;
+}
+
+/*******************************************
+ * ColocatedSearchOnly
+ *   TRUE when the static LCU is unchanged in
+ *   the reference of listIndex, so the
+ *   co-located position alone is checked.
+ *   The static flag is derived against L0
+ *   (or a duplicate reference), so another
+ *   reference gets its own co-located check
+ *******************************************/
+static EB_BOOL ColocatedSearchOnly(
+	PictureParentControlSet_t   *pictureControlSetPtr,
+	MeContext_t                 *contextPtr,
+	EbPaReferenceObject_t       *referenceObject,
+	EB_U32                       listIndex,
+	EB_U32                       lcuIndex,
+	EB_U32                       lcuOriginX,
+	EB_U32                       lcuOriginY)
+{
+	EB_BOOL identicalToL1;
+
+	if (!pictureControlSetPtr->staticLcuArray[lcuIndex]) {
+		return EB_FALSE;
+	}
+
+	// Duplicate of this reference
+	if (referenceObject->duplicateRunStart == pictureControlSetPtr->duplicateRunStart) {
+		return EB_TRUE;
+	}
+
+	// Unchanged in L0 by the co-located check of the static flag, unless the flag comes from a duplicate L1
+	identicalToL1 = (pictureControlSetPtr->sliceType == EB_B_SLICE &&
+		((EbPaReferenceObject_t*)pictureControlSetPtr->refPaPicPtrArray[REF_LIST_1]->objectPtr)->duplicateRunStart == pictureControlSetPtr->duplicateRunStart) ? EB_TRUE : EB_FALSE;
+	if (listIndex == REF_LIST_0 && !identicalToL1) {
+		return EB_TRUE;
+	}
+
+	return ColocatedLcuUnchanged(
+		contextPtr,
+		referenceObject->inputPaddedPicturePtr,
+		lcuOriginX,
+		lcuOriginY);
+}
+
+/*******************************************
+ * HashBlockMatch
+ *   exact comparison of the LCU with the 64x64
+ *   block at (x, y) of the reference
+ *******************************************/
+static EB_BOOL HashBlockMatch(
+	MeContext_t                 *contextPtr,
+	EbPictureBufferDesc_t       *refPicPtr,
+	EB_U32                       x,
+	EB_U32                       y)
+{
+	EB_U8  *refPtr = &refPicPtr->bufferY[(refPicPtr->originY + y) * refPicPtr->strideY + refPicPtr->originX + x];
+	EB_U32  rowIndex;
+
+	for (rowIndex = 0; rowIndex < MAX_LCU_SIZE; ++rowIndex) {
+		if (memcmp(contextPtr->lcuSrcPtr + rowIndex * contextPtr->lcuSrcStride, refPtr + rowIndex * refPicPtr->strideY, MAX_LCU_SIZE)) {
+			return EB_FALSE;
+		}
+	}
+
+	return EB_TRUE;
+}
+
+/*******************************************
+ * BuildBlockHashIndex
+ *   hashes the 64x64 blocks of the padded input
+ *   picture of the reference at every position and
+ *   chains the positions of each hash bucket
+ *******************************************/
+static void BuildBlockHashIndex(
+	EbBlockHashIndex_t          *blockHashIndex,
+	EbPictureBufferDesc_t       *refPicPtr)
+{
+	EB_U32 pictureWidth = refPicPtr->width;
+	EB_U32 pictureHeight = refPicPtr->height;
+	EB_U32 x, y;
+
+	rtcd.BlockHash64x64(
+		&refPicPtr->bufferY[refPicPtr->originX + refPicPtr->originY * refPicPtr->strideY],
+		refPicPtr->strideY,
+		pictureWidth,
+		pictureHeight,
+		blockHashIndex->blockHash);
+
+	// Empty buckets (BLOCK_HASH_NO_POSITION)
+	EB_MEMSET(blockHashIndex->hashBucketHead, 0xFF, sizeof(EB_U32) * (1 << BLOCK_HASH_BUCKET_BITS));
+
+	for (y = 0; y + MAX_LCU_SIZE <= pictureHeight; ++y) {
+		for (x = 0; x + MAX_LCU_SIZE <= pictureWidth; ++x) {
+			EB_U32 position = y * pictureWidth + x;
+			EB_U32 bucket = blockHashIndex->blockHash[position] & ((1 << BLOCK_HASH_BUCKET_BITS) - 1);
+
+			blockHashIndex->hashPositionNext[position] = blockHashIndex->hashBucketHead[bucket];
+			blockHashIndex->hashBucketHead[bucket] = position;
+		}
+	}
+}
+
+/*******************************************
+ * HashMotionSearch
+ *   looks the 64x64 LCU up in the block hash
+ *   index of the reference, building the index
+ *   on the first look-up; returns EB_TRUE with
+ *   the full-pel MV of an exact match: the
+ *   co-located block when it matches, else the
+ *   closest position of the whole bucket chain,
+ *   with at most HASH_ME_MAX_COMPARES exact
+ *   comparisons (only for positions closer than
+ *   the best match so far)
+ *******************************************/
+static EB_BOOL HashMotionSearch(
+	MeContext_t                 *contextPtr,
+	EbPaReferenceObject_t       *referenceObject,
+	EB_U32                       lcuOriginX,
+	EB_U32                       lcuOriginY,
+	EB_S16                      *xMv,
+	EB_S16                      *yMv)
+{
+	EbBlockHashIndex_t    *blockHashIndex = referenceObject->blockHashIndex;
+	EbPictureBufferDesc_t *refPicPtr = referenceObject->inputPaddedPicturePtr;
+	EB_U32  pictureWidth = refPicPtr->width;
+	EB_U32  lcuPosition = lcuOriginY * pictureWidth + lcuOriginX;
+	EB_U32  hash = contextPtr->lcuBlockHash[0];
+	EB_U32  bestDistance = (EB_U32)~0;
+	EB_U32  compareCount = 0;
+	EB_U32  position;
+
+	EbBlockOnMutex(blockHashIndex->buildMutex);
+	if (!blockHashIndex->built) {
+		BuildBlockHashIndex(
+			blockHashIndex,
+			refPicPtr);
+		blockHashIndex->built = EB_TRUE;
+	}
+	EbReleaseMutex(blockHashIndex->buildMutex);
+
+	if (blockHashIndex->blockHash[lcuPosition] == hash && HashBlockMatch(contextPtr, refPicPtr, lcuOriginX, lcuOriginY)) {
+		*xMv = 0;
+		*yMv = 0;
+		return EB_TRUE;
+	}
+
+	for (position = blockHashIndex->hashBucketHead[hash & ((1 << BLOCK_HASH_BUCKET_BITS) - 1)];
+		position != BLOCK_HASH_NO_POSITION && compareCount < HASH_ME_MAX_COMPARES;
+		position = blockHashIndex->hashPositionNext[position]) {
+
+		EB_S32 x = (EB_S32)(position % pictureWidth);
+		EB_S32 y = (EB_S32)(position / pictureWidth);
+		EB_U32 distance = (EB_U32)(ABS(x - (EB_S32)lcuOriginX) + ABS(y - (EB_S32)lcuOriginY));
+
+		if (blockHashIndex->blockHash[position] != hash || distance >= bestDistance) {
+			continue;
+		}
+		++compareCount;
+
+		if (HashBlockMatch(contextPtr, refPicPtr, (EB_U32)x, (EB_U32)y)) {
+			bestDistance = distance;
+			*xMv = (EB_S16)(x - (EB_S32)lcuOriginX);
+			*yMv = (EB_S16)(y - (EB_S32)lcuOriginY);
+		}
+	}
+
+	return (EB_BOOL)(bestDistance != (EB_U32)~0);
+}
+
 /*******************************************
  * MotionEstimateLcu
  *   performs ME (LCU)
@@ -3237,6 +3797,17 @@ EB_ERRORTYPE MotionEstimateLcu(
                             
 	EB_U64                  ref0Poc = 0;
 	EB_U64                  ref1Poc = 0;
+
+	EB_U32                  hmeLevel0AreaMultiplierX;
+	EB_U32                  hmeLevel0AreaMultiplierY;
+
+	EB_BOOL                 exactSearch;
+	EB_S16                  xExactCenter;
+	EB_S16                  yExactCenter;
+
+	EB_BOOL                 projectedSearch;
+	EB_S16                  xProjectedCenter = 0;
+	EB_S16                  yProjectedCenter = 0;
                             
 	EB_U64                  i;
 
@@ -3246,7 +3817,7 @@ EB_ERRORTYPE MotionEstimateLcu(
 	EB_U32                  adjustSearchAreaDirection = 0;
 
     // Configure HME level 0, level 1 and level 2 from static config parameters
-    EB_BOOL                 enableHmeLevel0Flag = pictureControlSetPtr->enableHmeLevel0Flag;
+    EB_BOOL                 enableHmeLevel0Flag = (EB_BOOL)(pictureControlSetPtr->enableHmeLevel0Flag && !contextPtr->skipHmeLevel0);
     EB_BOOL                 enableHmeLevel1Flag = pictureControlSetPtr->enableHmeLevel1Flag;
     EB_BOOL                 enableHmeLevel2Flag = pictureControlSetPtr->enableHmeLevel2Flag;
 	EB_BOOL					enableHalfPel32x32  = EB_FALSE;
@@ -3266,6 +3837,16 @@ EB_ERRORTYPE MotionEstimateLcu(
 		ref1Poc = pictureControlSetPtr->refPicPocArray[1];
 	}
 
+	// Hash of the LCU, looked up in the block hash index of each reference
+	if (contextPtr->hashMotionSearch && lcuWidth == MAX_LCU_SIZE && lcuHeight == MAX_LCU_SIZE) {
+		rtcd.BlockHash64x64(
+			contextPtr->lcuSrcPtr,
+			contextPtr->lcuSrcStride,
+			MAX_LCU_SIZE,
+			MAX_LCU_SIZE,
+			contextPtr->lcuBlockHash);
+	}
+
 	// Uni-Prediction motion estimation loop
 	// List Loop 
 	for (listIndex = REF_LIST_0; listIndex <= numOfListToSearch; ++listIndex) {
@@ -3278,6 +3859,37 @@ EB_ERRORTYPE MotionEstimateLcu(
 			quarterRefPicPtr    = (EbPictureBufferDesc_t*)referenceObject->quarterDecimatedPicturePtr;
 			sixteenthRefPicPtr  = (EbPictureBufferDesc_t*)referenceObject->sixteenthDecimatedPicturePtr;
 
+			// Static LCU (co-located) or exact match in the block hash index: check that position alone,
+			// no HME and no fractional search
+			xExactCenter = 0;
+			yExactCenter = 0;
+			exactSearch = ColocatedSearchOnly(pictureControlSetPtr, contextPtr, referenceObject, listIndex, lcuIndex, lcuOriginX, lcuOriginY) ? EB_TRUE :
+				(contextPtr->hashMotionSearch && lcuWidth == MAX_LCU_SIZE && lcuHeight == MAX_LCU_SIZE) ?
+				HashMotionSearch(
+					contextPtr,
+					referenceObject,
+					lcuOriginX,
+					lcuOriginY,
+					&xExactCenter,
+					&yExactCenter) :
+				EB_FALSE;
+
+			// Projected MV: refine around it instead of running HME and the full search area
+			projectedSearch = (contextPtr->mvProjection && !exactSearch) ?
+				DeriveProjectedSearchCenter(
+					pictureControlSetPtr,
+					contextPtr,
+					refPicPtr,
+					listIndex,
+					lcuIndex,
+					lcuOriginX,
+					lcuOriginY,
+					lcuWidth,
+					lcuHeight,
+					&xProjectedCenter,
+					&yProjectedCenter) :
+				EB_FALSE;
+
 			if (pictureControlSetPtr->temporalLayerIndex > 0 || listIndex == 0){
 				// A - The MV center for Tier0 search could be either (0,0), or HME
 				// A - Set HME MV Center
@@ -3285,10 +3897,25 @@ EB_ERRORTYPE MotionEstimateLcu(
 				xSearchCenter = 0;
 				ySearchCenter = 0;
 
+				hmeLevel0AreaMultiplierX = HME_LEVEL_0_SEARCH_AREA_MULTIPLIER_X[pictureControlSetPtr->hierarchicalLevels][pictureControlSetPtr->temporalLayerIndex];
+				hmeLevel0AreaMultiplierY = HME_LEVEL_0_SEARCH_AREA_MULTIPLIER_Y[pictureControlSetPtr->hierarchicalLevels][pictureControlSetPtr->temporalLayerIndex];
+
+				// Seed HME with the projected reference MV field, and shrink level 0 when it is consistent
+				if (listIndex == REF_LIST_0 && contextPtr->temporalMvSeeding &&
+					DeriveTemporalHmeSeed(pictureControlSetPtr, lcuIndex, &xSearchCenter, &ySearchCenter)) {
+					hmeLevel0AreaMultiplierX = hmeLevel0AreaMultiplierX * TEMPORAL_HME_SEED_AREA_PERCENT / 100;
+					hmeLevel0AreaMultiplierY = hmeLevel0AreaMultiplierY * TEMPORAL_HME_SEED_AREA_PERCENT / 100;
+				}
+
+				if (projectedSearch) {
+					xSearchCenter = xProjectedCenter;
+					ySearchCenter = yProjectedCenter;
+				}
+
 				// B - NO HME in boundaries
 				// C - Skip HME
 
-                if (pictureControlSetPtr->enableHmeFlag && /*B*/lcuHeight == MAX_LCU_SIZE) {//(searchCenterSad > sequenceControlSetPtr->staticConfig.skipTier0HmeTh)) {
+                if (pictureControlSetPtr->enableHmeFlag && /*B*/lcuHeight == MAX_LCU_SIZE && !projectedSearch && !exactSearch) {//(searchCenterSad > sequenceControlSetPtr->staticConfig.skipTier0HmeTh)) {
 
 					while (searchRegionNumberInHeight < contextPtr->numberHmeSearchRegionInHeight) {
 						while (searchRegionNumberInWidth < contextPtr->numberHmeSearchRegionInWidth) {
@@ -3328,8 +3955,8 @@ EB_ERRORTYPE MotionEstimateLcu(
 								&(hmeLevel0Sad[searchRegionNumberInWidth][searchRegionNumberInHeight]),
 								&(xHmeLevel0SearchCenter[searchRegionNumberInWidth][searchRegionNumberInHeight]),
 								&(yHmeLevel0SearchCenter[searchRegionNumberInWidth][searchRegionNumberInHeight]),
-	                            HME_LEVEL_0_SEARCH_AREA_MULTIPLIER_X[pictureControlSetPtr->hierarchicalLevels][pictureControlSetPtr->temporalLayerIndex],
-								HME_LEVEL_0_SEARCH_AREA_MULTIPLIER_Y[pictureControlSetPtr->hierarchicalLevels][pictureControlSetPtr->temporalLayerIndex]);
+	                            hmeLevel0AreaMultiplierX,
+								hmeLevel0AreaMultiplierY);
 
 
 
@@ -3355,8 +3982,8 @@ EB_ERRORTYPE MotionEstimateLcu(
                                         &(hmeLevel0Sad[searchRegionNumberInWidth][searchRegionNumberInHeight]),
                                         &(xHmeLevel0SearchCenter[searchRegionNumberInWidth][searchRegionNumberInHeight]),
                                         &(yHmeLevel0SearchCenter[searchRegionNumberInWidth][searchRegionNumberInHeight]),
-                                        HME_LEVEL_0_SEARCH_AREA_MULTIPLIER_X[pictureControlSetPtr->hierarchicalLevels][pictureControlSetPtr->temporalLayerIndex],
-                                        HME_LEVEL_0_SEARCH_AREA_MULTIPLIER_Y[pictureControlSetPtr->hierarchicalLevels][pictureControlSetPtr->temporalLayerIndex]);
+                                        hmeLevel0AreaMultiplierX,
+                                        hmeLevel0AreaMultiplierY);
 
                                     searchRegionNumberInWidth++;
                                 }
@@ -3551,7 +4178,34 @@ EB_ERRORTYPE MotionEstimateLcu(
             searchAreaWidth = (EB_S16)MIN(contextPtr->searchAreaWidth, 127);
             searchAreaHeight = (EB_S16)MIN(contextPtr->searchAreaHeight, 127);
 
-			if (xSearchCenter != 0 || ySearchCenter != 0) {
+			if (exactSearch) {
+				xSearchCenter = xExactCenter;
+				ySearchCenter = yExactCenter;
+				searchAreaWidth = 1;
+				searchAreaHeight = 1;
+			}
+			else if (projectedSearch) {
+				searchAreaWidth = (EB_S16)MV_PROJECTION_SEARCH_AREA_WIDTH;
+				searchAreaHeight = (EB_S16)MV_PROJECTION_SEARCH_AREA_HEIGHT;
+			}
+			else if (contextPtr->adaptiveSearchArea) {
+				DeriveAdaptiveSearchArea(
+					pictureControlSetPtr,
+					contextPtr,
+					refPicPtr,
+					listIndex,
+					lcuIndex,
+					lcuOriginX,
+					lcuOriginY,
+					lcuWidth,
+					lcuHeight,
+					xSearchCenter,
+					ySearchCenter,
+					&searchAreaWidth,
+					&searchAreaHeight);
+			}
+
+			if (!exactSearch && (xSearchCenter != 0 || ySearchCenter != 0)) {
 				CheckZeroZeroCenter(
 					refPicPtr,
 					contextPtr,
@@ -3566,7 +4220,7 @@ EB_ERRORTYPE MotionEstimateLcu(
 			xSearchAreaOrigin = xSearchCenter - (searchAreaWidth >> 1);
 			ySearchAreaOrigin = ySearchCenter - (searchAreaHeight >> 1);
 
-            if (listIndex == 1 && lcuWidth == MAX_LCU_SIZE && lcuHeight == MAX_LCU_SIZE)
+            if (listIndex == 1 && lcuWidth == MAX_LCU_SIZE && lcuHeight == MAX_LCU_SIZE && !exactSearch)
             {
 				{
 					if (adjustSearchAreaDirection == 1){
@@ -3635,10 +4289,16 @@ EB_ERRORTYPE MotionEstimateLcu(
 			yTopLeftSearchRegion = (EB_S16)(refPicPtr->originY + lcuOriginY) + ySearchAreaOrigin;
 			searchRegionIndex = xTopLeftSearchRegion + yTopLeftSearchRegion * refPicPtr->strideY;
 
+			// Half-pel samples are read from the planes of the reference, with the same origins the per search area buffers had
+			contextPtr->interpolatedStride = refPicPtr->strideY;
+			contextPtr->posbBuffer[listIndex][0] = referenceObject->halfPelPlanes->posbPlane + searchRegionIndex - (ME_FILTER_TAP >> 1) * refPicPtr->strideY - 1;
+			contextPtr->poshBuffer[listIndex][0] = referenceObject->halfPelPlanes->poshPlane + searchRegionIndex - refPicPtr->strideY - 1;
+			contextPtr->posjBuffer[listIndex][0] = referenceObject->halfPelPlanes->posjPlane + searchRegionIndex - refPicPtr->strideY - 1;
+
 			{
 				{
 
-					InitializeBuffer_32bits_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](contextPtr->pLcuBestSad[listIndex][0], 21, 1, MAX_SAD_VALUE);
+					rtcd.InitializeBuffer_32bits(contextPtr->pLcuBestSad[listIndex][0], 21, 1, MAX_SAD_VALUE);
 					contextPtr->pBestSad64x64 = &(contextPtr->pLcuBestSad[listIndex][0][ME_TIER_ZERO_PU_64x64]);
 					contextPtr->pBestSad32x32 = &(contextPtr->pLcuBestSad[listIndex][0][ME_TIER_ZERO_PU_32x32_0]);
 					contextPtr->pBestSad16x16 = &(contextPtr->pLcuBestSad[listIndex][0][ME_TIER_ZERO_PU_16x16_0]);
@@ -3654,18 +4314,38 @@ EB_ERRORTYPE MotionEstimateLcu(
                     contextPtr->pBestSsd16x16 = &(contextPtr->pLcuBestSsd[listIndex][0][ME_TIER_ZERO_PU_16x16_0]);
                     contextPtr->pBestSsd8x8   = &(contextPtr->pLcuBestSsd[listIndex][0][ME_TIER_ZERO_PU_8x8_0]);
 
-					FullPelSearch_LCU(
-						contextPtr,
-						listIndex,
-						xSearchAreaOrigin,
-						ySearchAreaOrigin,
-						searchAreaWidth,
-						searchAreaHeight
-					);
+					if (contextPtr->fullPelSearchMethod == 1) {
+						FullPelSearchRings_LCU(
+							contextPtr,
+							listIndex,
+							xSearchAreaOrigin,
+							ySearchAreaOrigin,
+							searchAreaWidth,
+							searchAreaHeight,
+							xSearchCenter,
+							ySearchCenter,
+							sequenceControlSetPtr->qp);
+					}
+					else {
+						FullPelSearch_LCU(
+							contextPtr,
+							listIndex,
+							xSearchAreaOrigin,
+							ySearchAreaOrigin,
+							searchAreaWidth,
+							searchAreaHeight
+						);
+					}
 
 				}
 
-                if (contextPtr->fractionalSearchModel == 0) {
+                if (exactSearch) {
+                    enableHalfPel32x32 = EB_FALSE;
+                    enableHalfPel16x16 = EB_FALSE;
+                    enableHalfPel8x8   = EB_FALSE;
+                    enableQuarterPel   = EB_FALSE;
+                }
+                else if (contextPtr->fractionalSearchModel == 0) {
                     enableHalfPel32x32 = EB_TRUE;
                     enableHalfPel16x16 = EB_TRUE;
                     enableHalfPel8x8   = EB_TRUE;
@@ -3694,20 +4374,13 @@ EB_ERRORTYPE MotionEstimateLcu(
 
 		        if (enableHalfPel32x32 || enableHalfPel16x16 || enableHalfPel8x8 || enableQuarterPel){
 
-		        	// Move to the top left of the search region
-		        	xTopLeftSearchRegion = (EB_S16)(refPicPtr->originX + lcuOriginX) + xSearchAreaOrigin;
-		        	yTopLeftSearchRegion = (EB_S16)(refPicPtr->originY + lcuOriginY) + ySearchAreaOrigin;
-		        	searchRegionIndex = xTopLeftSearchRegion + yTopLeftSearchRegion * refPicPtr->strideY;
-
-		        	// Interpolate the search region for Half-Pel Refinements 
+		        	// Interpolate the rows of the reference spanned by the search region for Half-Pel Refinements
 		        	// H - AVC Style
-		        	InterpolateSearchRegionAVC(
+		        	InterpolateReferenceBandsAVC(
 		        		contextPtr,
-		        		listIndex,
-		        		contextPtr->integerBufferPtr[listIndex][0] + (ME_FILTER_TAP >> 1) + ((ME_FILTER_TAP >> 1) * contextPtr->interpolatedFullStride[listIndex][0]),
-		        		contextPtr->interpolatedFullStride[listIndex][0],
-		        		(EB_U32)searchAreaWidth + (MAX_LCU_SIZE - 1),
-		        		(EB_U32)searchAreaHeight + (MAX_LCU_SIZE - 1));
+		        		referenceObject,
+		        		yTopLeftSearchRegion - (ME_FILTER_TAP >> 1),
+		        		yTopLeftSearchRegion + searchAreaHeight + MAX_LCU_SIZE);
 
 		        	// Half-Pel Refinement [8 search positions]
 		        	HalfPelSearch_LCU(
@@ -3746,6 +4419,7 @@ EB_ERRORTYPE MotionEstimateLcu(
 	}
 
 	// Bi-Prediction motion estimation loop
+	EB_MEMSET(contextPtr->quarterPelCacheValid, EB_FALSE, sizeof(contextPtr->quarterPelCacheValid));
 	for (puIndex = 0; puIndex < maxNumberOfPusPerLcu; ++puIndex){
 
 		candidateIndex = 0;
@@ -3921,7 +4595,7 @@ void IntraOpenLoopSearchTheseModesOutputBest(
 			(EB_U32)mode);
 
 		//Distortion
-		sadArray[candidateIndex] = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][cuSize >> 3]( // Always SAD without weighting 
+		sadArray[candidateIndex] = (EB_U32)rtcd.NxMSadKernel[cuSize >> 3]( // Always SAD without weighting 
 			src,
 			srcStride,
 			&(contextPtr->meContextPtr->lcuBuffer[0]),
@@ -4236,7 +4910,7 @@ EB_S32 GetInterIntraSadDistance(
         (EB_U32)1);
 
     //Distortion
-	stage1SadArray[0] = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][cuSize >> 3]( // Always SAD without weighting 
+	stage1SadArray[0] = (EB_U32)rtcd.NxMSadKernel[cuSize >> 3]( // Always SAD without weighting 
         src,
         inputPtr->strideY,
         &(contextPtr->meContextPtr->lcuBuffer[0]),
@@ -4391,7 +5065,7 @@ EB_U32 UpdateNeighborDcIntraPred(
 		contextPtr,
 		(EB_U32)INTRA_DC_MODE);
 
-	distortion = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][cuSize >> 3]( // Always SAD without weighting 
+	distortion = (EB_U32)rtcd.NxMSadKernel[cuSize >> 3]( // Always SAD without weighting 
 		&(inputPtr->bufferY[(inputPtr->originY + cuOriginY) * inputPtr->strideY + (inputPtr->originX + cuOriginX)]),
 		inputPtr->strideY,
 		&(contextPtr->meContextPtr->lcuBuffer[0]),
@@ -4401,6 +5075,25 @@ EB_U32 UpdateNeighborDcIntraPred(
 	return(distortion);
 }
 
+EB_U32 UpdateNeighborDcIntraPred_AVX2(
+	MotionEstimationContext_t       *contextPtr,
+	EbPictureBufferDesc_t           *inputPtr,
+	EB_U32                           cuOriginX,
+	EB_U32                           cuOriginY,
+	EB_U32                           cuSize)
+{
+	return UpdateNeighborDcIntraPred_AVX2_INTRIN(
+		contextPtr->intraRefPtr->yIntraReferenceArrayReverse,
+		inputPtr->height,
+		inputPtr->strideY,
+		inputPtr->bufferY,
+		inputPtr->originY,
+		inputPtr->originX,
+		cuOriginX,
+		cuOriginY,
+		cuSize);
+}
+
 EB_ERRORTYPE OpenLoopIntraDC(
 	PictureParentControlSet_t   *pictureControlSetPtr,
 	EB_U32                       lcuIndex,
@@ -4420,28 +5113,12 @@ EB_ERRORTYPE OpenLoopIntraDC(
 
 	if ((cuSize == 32) || (cuSize == 16) || (cuSize == 8))
 	{
-        if ((ASM_TYPES & AVX2_MASK) && 1)
-        {
-            oisCuPtr[0].distortion = (EB_U32)UpdateNeighborDcIntraPred_AVX2_INTRIN(
-                contextPtr->intraRefPtr->yIntraReferenceArrayReverse,
-                inputPtr->height,
-                inputPtr->strideY,
-                inputPtr->bufferY,
-                inputPtr->originY,
-                inputPtr->originX,
-                cuOriginX,
-                cuOriginY,
-                cuSize);
-        }
-        else
-        {
-            oisCuPtr[0].distortion = (EB_U32)UpdateNeighborDcIntraPred(
-                contextPtr,
-                inputPtr,
-                cuOriginX,
-                cuOriginY,
-                cuSize);
-        }
+		oisCuPtr[0].distortion = rtcd.UpdateNeighborDcIntraPred(
+			contextPtr,
+			inputPtr,
+			cuOriginX,
+			cuOriginY,
+			cuSize);
 
 		oisCuPtr[0].intraMode = INTRA_DC_MODE;
 	}
@@ -4554,7 +5231,7 @@ EB_ERRORTYPE OpenLoopIntraSearchLcu(
 						(EB_U32)EB_INTRA_PLANAR);
 
 					//Distortion
-					oisCuPtr[0].distortion = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][cuSize >> 3]( // Always SAD without weighting 
+					oisCuPtr[0].distortion = (EB_U32)rtcd.NxMSadKernel[cuSize >> 3]( // Always SAD without weighting 
 						&(inputPtr->bufferY[(inputPtr->originY + cuOriginY) * inputPtr->strideY + (inputPtr->originX + cuOriginX)]),
 						inputPtr->strideY,
 						&(contextPtr->meContextPtr->lcuBuffer[0]),
@@ -4644,7 +5321,7 @@ EB_ERRORTYPE OpenLoopIntraSearchLcu(
 							openLoopIntraCandidateIndex);
 
 						//Distortion
-						sadDistortion = (EB_U32)NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][cuSize >> 3](
+						sadDistortion = (EB_U32)rtcd.NxMSadKernel[cuSize >> 3](
 							&(inputPtr->bufferY[(inputPtr->originY + cuOriginY) * inputPtr->strideY + (inputPtr->originX + cuOriginX)]),
 							inputPtr->strideY,
 							&(contextPtr->meContextPtr->lcuBuffer[0]),
@@ -58,6 +58,12 @@ extern void GetMeDist(
     EB_U32						 lcuIndex,
     EB_U32                      *distortion);
 
+extern EB_BOOL ColocatedLcuUnchanged(
+    MeContext_t                 *contextPtr,
+    EbPictureBufferDesc_t       *refPicPtr,
+    EB_U32                       lcuOriginX,
+    EB_U32                       lcuOriginY);
+
 EB_S8 Sort3Elements(EB_U32 a, EB_U32 b, EB_U32 c);
 #define a_b_c  0
 #define a_c_b  1
@@ -66,6 +72,20 @@ EB_S8 Sort3Elements(EB_U32 a, EB_U32 b, EB_U32 c);
 #define c_a_b  4
 #define c_b_a  5
 
+typedef void(*EB_FPSEARCH_FUNC)(
+    MeContext_t             *contextPtr,
+    EB_U32                   listIndex,
+    EB_U32                   searchRegionIndex,
+    EB_U32                   xSearchIndex,
+    EB_U32                   ySearchIndex);
+
+void GetEightHorizontalSearchPointResultsAll85PUs_C(
+    MeContext_t             *contextPtr,
+    EB_U32                   listIndex,
+    EB_U32                   searchRegionIndex,
+    EB_U32                   xSearchIndex,
+    EB_U32                   ySearchIndex);
+
 #ifdef __cplusplus
 }
 #endif
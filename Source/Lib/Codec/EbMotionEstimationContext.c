@@ -105,12 +105,11 @@ EB_ERRORTYPE MeContextCtor(
         for( refPicIndex = 0; refPicIndex < MAX_REF_IDX; refPicIndex++) {
 
             EB_MALLOC(EB_U8 *, (*objectDblPtr)->integerBuffer[listIndex][refPicIndex], sizeof(EB_U8) * (*objectDblPtr)->interpolatedStride * MAX_SEARCH_AREA_HEIGHT, EB_N_PTR);
-            
-            EB_MALLOC(EB_U8 *, (*objectDblPtr)->posbBuffer[listIndex][refPicIndex], sizeof(EB_U8) * (*objectDblPtr)->interpolatedStride * MAX_SEARCH_AREA_HEIGHT, EB_N_PTR);
-            
-            EB_MALLOC(EB_U8 *, (*objectDblPtr)->poshBuffer[listIndex][refPicIndex], sizeof(EB_U8) * (*objectDblPtr)->interpolatedStride * MAX_SEARCH_AREA_HEIGHT, EB_N_PTR);
-            
-            EB_MALLOC(EB_U8 *, (*objectDblPtr)->posjBuffer[listIndex][refPicIndex], sizeof(EB_U8) * (*objectDblPtr)->interpolatedStride * MAX_SEARCH_AREA_HEIGHT, EB_N_PTR);
+
+            // Point into the half-pel planes of the reference, set per search area
+            (*objectDblPtr)->posbBuffer[listIndex][refPicIndex] = (EB_U8 *)EB_NULL;
+            (*objectDblPtr)->poshBuffer[listIndex][refPicIndex] = (EB_U8 *)EB_NULL;
+            (*objectDblPtr)->posjBuffer[listIndex][refPicIndex] = (EB_U8 *)EB_NULL;
             
         }
 
@@ -127,6 +126,8 @@ EB_ERRORTYPE MeContextCtor(
     }
 
     EB_MALLOC(EB_U8 *, (*objectDblPtr)->avctempBuffer, sizeof(EB_U8) * (*objectDblPtr)->interpolatedStride * MAX_SEARCH_AREA_HEIGHT, EB_N_PTR);
+
+    EB_MALLOC(EB_U32 *, (*objectDblPtr)->lcuBlockHash, sizeof(EB_U32) * MAX_LCU_SIZE * MAX_LCU_SIZE, EB_N_PTR);
     
     EB_MALLOC(EB_U16 *, (*objectDblPtr)->pEightPosSad16x16, sizeof(EB_U16) * 8 * 16, EB_N_PTR);//16= 16 16x16 blocks in a LCU.       8=8search points
     
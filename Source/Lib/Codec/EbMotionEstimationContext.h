@@ -331,6 +331,7 @@ typedef struct MeContext_s {
     EB_U32 hmeLcuBufferStride;
 	EB_U8 *lcuSrcPtr;
 	EB_U32 lcuSrcStride;
+    EB_U32 *lcuBlockHash;                      // BlockHash64x64 work buffer of the LCU, lcuBlockHash[0] is the LCU hash (hash ME)
     EB_U8 *quarterLcuBuffer;
     EB_U32 quarterLcuBufferStride;
     EB_U8 *sixteenthLcuBuffer;
@@ -338,12 +339,18 @@ typedef struct MeContext_s {
 
     EB_U8 *integerBuffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
 	EB_U8 *integerBufferPtr[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];	
+    // Search area origins in the half-pel planes of the reference (stride interpolatedStride)
     EB_U8 *posbBuffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX]; 
     EB_U8 *poshBuffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
     EB_U8 *posjBuffer[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
 
     EB_U8  *oneDIntermediateResultsBuf0;
     EB_U8  *oneDIntermediateResultsBuf1;
+    // LCU-local cache of the quarter-pel L0/L1 predictions built by the bi-pred search.
+    // The samples live in oneDIntermediateResultsBuf0/1 at their LCU position (stride MAX_LCU_SIZE);
+    // each 8x8 block is tagged with the MV it was compensated with.
+    EB_U32  quarterPelCacheMv[MAX_NUM_OF_REF_PIC_LIST][64];
+    EB_BOOL quarterPelCacheValid[MAX_NUM_OF_REF_PIC_LIST][64];
 
     EB_S16 xSearchAreaOrigin[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
     EB_S16 ySearchAreaOrigin[MAX_NUM_OF_REF_PIC_LIST][MAX_REF_IDX];
@@ -443,6 +450,15 @@ typedef struct MeContext_s {
     EB_U8    fractionalSearchModel;
     EB_BOOL  fractionalSearch64x64;
     EB_BOOL  oneQuadrantHME;
+    EB_BOOL  temporalMvSeeding;
+    EB_BOOL  mvProjection;                     // Top temporal layer: refine around the projected L0 reference MV field
+    EB_BOOL  adaptiveSearchArea;               // Size the full-pel search area of each LCU from its motion
+    EB_U8    fullPelSearchMethod;              // 0: exhaustive, 1: rings around the search center with early termination
+    EB_BOOL  hashMotionSearch;                 // Look up exact 64x64 matches in the block hash index of the references
+    EB_BOOL  staticLcuDetection;               // Check the co-located position only for LCUs unchanged in the L0 reference
+    EB_BOOL  skipHmeLevel0;                    // Low motion history of the L0 reference: level 1 alone covers the motion
+    EB_U32   segmentStartLcuX;                 // First LCU of the segment being searched, the LCUs of the segment
+    EB_U32   segmentStartLcuY;                 // above and to the left of the current one have their final ME results
             
     // ME  
     EB_U8    searchAreaWidth;
@@ -16,6 +16,8 @@
 #include "EbIntraPrediction.h"
 #include "EbLambdaRateTables.h"
 #include "EbComputeSAD.h"
+#include "EbRtcd.h"
+#include "EbTime.h"
 
 #include "emmintrin.h"
 
@@ -24,6 +26,8 @@
 
 #define DERIVE_INTRA_32_FROM_16   0 //CHKN 1
 
+#define HME_LEVEL0_SKIP_FAR_LCU_PERCENT 5 // Max share of LCUs whose motion history exceeds the reach of HME level 1
+
 /* --32x32-
 |00||01|
 |02||03|
@@ -370,7 +374,7 @@ EB_ERRORTYPE ComputeDecimatedZzSad(
 					4);
 
 				// ZZ SAD between 1/16 current & 1/16 collocated
-				decimatedLcuCollocatedSad = NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][2](
+				decimatedLcuCollocatedSad = rtcd.NxMSadKernel[2](
 					&(sixteenthDecimatedPicturePtr->bufferY[blkDisplacementDecimated]),
 					sixteenthDecimatedPicturePtr->strideY,
 					contextPtr->meContextPtr->sixteenthLcuBuffer,
@@ -424,6 +428,116 @@ EB_ERRORTYPE ComputeDecimatedZzSad(
 
 	return return_error;
 }
+/******************************************************
+* Check whether the ME results of the L0 reference can be used
+  Only past L0 references qualify: they are dispatched
+  to ME ahead of the current picture, so holding the
+  current picture back until their ME is done cannot
+  deadlock
+******************************************************/
+static EB_BOOL L0RefMeResultsAvailable(
+    PictureParentControlSet_t   *pictureControlSetPtr)
+{
+    PictureParentControlSet_t *refPictureControlSetPtr;
+
+    if (pictureControlSetPtr->predStructure != EB_PRED_RANDOM_ACCESS ||
+        pictureControlSetPtr->sliceType == EB_I_SLICE) {
+        return EB_FALSE;
+    }
+
+    refPictureControlSetPtr = pictureControlSetPtr->refPaPcsArray[REF_LIST_0];
+
+    return (EB_BOOL)(refPictureControlSetPtr->sliceType != EB_I_SLICE &&
+        pictureControlSetPtr->refPicPocArray[REF_LIST_0] < pictureControlSetPtr->pictureNumber &&
+        refPictureControlSetPtr->refPicPocArray[REF_LIST_0] < refPictureControlSetPtr->pictureNumber);
+}
+
+/******************************************************
+* Derive HME Level 0 Skip
+  Level 0 is skipped when, scaled to the farthest
+  reference, the MV histogram of the L0 reference
+  stays within the reach of HME level 1 for nearly
+  all LCUs; the L0 reference ME results must be
+  complete
+******************************************************/
+static EB_BOOL DeriveHmeLevel0Skip(
+    PictureParentControlSet_t   *pictureControlSetPtr,
+    MeContext_t                 *contextPtr)
+{
+    PictureParentControlSet_t *refPictureControlSetPtr = pictureControlSetPtr->refPaPcsArray[REF_LIST_0];
+    EB_U32 reach = ~0u;
+    EB_U32 distance;
+    EB_U32 regionIndex;
+    EB_U32 binIndex;
+    EB_U32 farLcuCount = 0;
+    EB_U32 totalLcuCount = 0;
+
+    if (!pictureControlSetPtr->hmeLevel0SkipAllowed ||
+        !pictureControlSetPtr->enableHmeLevel0Flag ||
+        !pictureControlSetPtr->enableHmeLevel1Flag) {
+        return EB_FALSE;
+    }
+
+    // Reach of level 1 (full-pel) around the HME search center
+    for (regionIndex = 0; regionIndex < contextPtr->numberHmeSearchRegionInWidth; ++regionIndex) {
+        reach = MIN(reach, contextPtr->hmeLevel1SearchAreaInWidthArray[regionIndex]);
+    }
+    for (regionIndex = 0; regionIndex < contextPtr->numberHmeSearchRegionInHeight; ++regionIndex) {
+        reach = MIN(reach, contextPtr->hmeLevel1SearchAreaInHeightArray[regionIndex]);
+    }
+
+    distance = (EB_U32)ABS((EB_S64)pictureControlSetPtr->pictureNumber - (EB_S64)pictureControlSetPtr->refPicPocArray[REF_LIST_0]);
+    if (pictureControlSetPtr->sliceType == EB_B_SLICE) {
+        distance = MAX(distance, (EB_U32)ABS((EB_S64)pictureControlSetPtr->pictureNumber - (EB_S64)pictureControlSetPtr->refPicPocArray[REF_LIST_1]));
+    }
+
+    for (binIndex = 0; binIndex < ME_MV_HISTOGRAM_BINS; ++binIndex) {
+        totalLcuCount += refPictureControlSetPtr->meMvHistogram[binIndex];
+
+        // Largest magnitude of the bin is 2^binIndex - 1, the last bin is unbounded
+        if (binIndex == ME_MV_HISTOGRAM_BINS - 1 || ((1u << binIndex) - 1) * distance > reach) {
+            farLcuCount += refPictureControlSetPtr->meMvHistogram[binIndex];
+        }
+    }
+
+    return (EB_BOOL)(farLcuCount * 100 <= totalLcuCount * HME_LEVEL0_SKIP_FAR_LCU_PERCENT);
+}
+
+/******************************************************
+* Check whether the picture is a non-reference top layer
+  picture between a past and a future reference
+******************************************************/
+static EB_BOOL IsBracketedTopLayerPicture(
+    PictureParentControlSet_t   *pictureControlSetPtr)
+{
+    return (EB_BOOL)(pictureControlSetPtr->sliceType == EB_B_SLICE &&
+        pictureControlSetPtr->hierarchicalLevels > 0 &&
+        pictureControlSetPtr->temporalLayerIndex == pictureControlSetPtr->hierarchicalLevels &&
+        pictureControlSetPtr->isUsedAsReferenceFlag == EB_FALSE &&
+        pictureControlSetPtr->refPicPocArray[REF_LIST_1] > pictureControlSetPtr->pictureNumber);
+}
+
+/******************************************************
+* Check whether the ME of the picture reads the ME
+  results of its L0 reference (temporal MV seeding or
+  MV projection, as set by the ME signal derivations);
+  Picture Decision holds such a picture back until the
+  ME of its L0 reference is done
+******************************************************/
+EB_BOOL MotionEstimationUsesL0RefMeResults(
+    SequenceControlSet_t        *sequenceControlSetPtr,
+    PictureParentControlSet_t   *pictureControlSetPtr)
+{
+    const EB_ENC_MODE mvProjectionEncMode = (sequenceControlSetPtr->staticConfig.tune == TUNE_SQ) ? ENC_MODE_8 : ENC_MODE_9;
+
+    if (!L0RefMeResultsAvailable(pictureControlSetPtr)) {
+        return EB_FALSE;
+    }
+
+    return (EB_BOOL)((pictureControlSetPtr->encMode > ENC_MODE_1 && pictureControlSetPtr->enableHmeFlag) ||
+        (pictureControlSetPtr->encMode >= mvProjectionEncMode && IsBracketedTopLayerPicture(pictureControlSetPtr)));
+}
+
 /******************************************************
 * Derive ME Settings for SQ
   Input   : encoder mode and tune
@@ -463,6 +577,34 @@ EB_ERRORTYPE SignalDerivationMeKernelSq(
         }
     }
 
+    // Set temporal MV seeding of HME
+    contextPtr->meContextPtr->temporalMvSeeding = (EB_BOOL)(pictureControlSetPtr->encMode > ENC_MODE_1 &&
+        pictureControlSetPtr->enableHmeFlag &&
+        L0RefMeResultsAvailable(pictureControlSetPtr));
+
+    // Set adaptive search area
+    // 0: OFF (search area of the picture for every LCU)
+    // 1: ON  (smaller search area for static LCUs and LCUs whose motion agrees with their neighbours)
+    contextPtr->meContextPtr->adaptiveSearchArea = (EB_BOOL)(pictureControlSetPtr->encMode > ENC_MODE_1);
+
+    // Set full-pel search method
+    // 0: exhaustive search of the search area
+    // 1: rings around the search center, stopped once the 64x64 and 32x32 SADs are below QP-derived thresholds
+    contextPtr->meContextPtr->fullPelSearchMethod = (pictureControlSetPtr->encMode >= ENC_MODE_4) ? 1 : 0;
+
+    // Set hash ME (screen content)
+    contextPtr->meContextPtr->hashMotionSearch = (EB_BOOL)sequenceControlSetPtr->staticConfig.hashMotionSearch;
+
+    // Set static LCU detection
+    contextPtr->meContextPtr->staticLcuDetection = (pictureControlSetPtr->encMode >= ENC_MODE_5) ? EB_TRUE : EB_FALSE;
+
+    // Set MV projection for the top temporal layer
+    // 0: OFF (HME + full search area)
+    // 1: ON  (refinement around the projected MV, full search for the LCUs where it is poor)
+    contextPtr->meContextPtr->mvProjection = (EB_BOOL)(pictureControlSetPtr->encMode >= ENC_MODE_8 &&
+        IsBracketedTopLayerPicture(pictureControlSetPtr) &&
+        L0RefMeResultsAvailable(pictureControlSetPtr));
+
     // Set ME Fractional Search Method
     if (pictureControlSetPtr->encMode == ENC_MODE_0) {
         contextPtr->meContextPtr->fractionalSearchMethod = SSD_SEARCH;
@@ -602,6 +744,34 @@ EB_ERRORTYPE SignalDerivationMeKernelOq(
         }
     }
 
+    // Set temporal MV seeding of HME
+    contextPtr->meContextPtr->temporalMvSeeding = (EB_BOOL)(pictureControlSetPtr->encMode > ENC_MODE_1 &&
+        pictureControlSetPtr->enableHmeFlag &&
+        L0RefMeResultsAvailable(pictureControlSetPtr));
+
+    // Set adaptive search area
+    // 0: OFF (search area of the picture for every LCU)
+    // 1: ON  (smaller search area for static LCUs and LCUs whose motion agrees with their neighbours)
+    contextPtr->meContextPtr->adaptiveSearchArea = (EB_BOOL)(pictureControlSetPtr->encMode > ENC_MODE_1);
+
+    // Set full-pel search method
+    // 0: exhaustive search of the search area
+    // 1: rings around the search center, stopped once the 64x64 and 32x32 SADs are below QP-derived thresholds
+    contextPtr->meContextPtr->fullPelSearchMethod = (pictureControlSetPtr->encMode >= ENC_MODE_5) ? 1 : 0;
+
+    // Set hash ME (screen content)
+    contextPtr->meContextPtr->hashMotionSearch = (EB_BOOL)sequenceControlSetPtr->staticConfig.hashMotionSearch;
+
+    // Set static LCU detection
+    contextPtr->meContextPtr->staticLcuDetection = (pictureControlSetPtr->encMode >= ENC_MODE_5) ? EB_TRUE : EB_FALSE;
+
+    // Set MV projection for the top temporal layer
+    // 0: OFF (HME + full search area)
+    // 1: ON  (refinement around the projected MV, full search for the LCUs where it is poor)
+    contextPtr->meContextPtr->mvProjection = (EB_BOOL)(pictureControlSetPtr->encMode >= ENC_MODE_9 &&
+        IsBracketedTopLayerPicture(pictureControlSetPtr) &&
+        L0RefMeResultsAvailable(pictureControlSetPtr));
+
     // Set ME Fractional Search Method
     if (pictureControlSetPtr->encMode <= ENC_MODE_3) {
         contextPtr->meContextPtr->fractionalSearchMethod = SSD_SEARCH;
@@ -784,6 +954,49 @@ void DeriveSimilarCollocatedFlag(
     return;
 }
 
+/******************************************************
+* Derive Static LCU Flag
+*   every 8x8 block of the LCU matches the co-located
+*   block of the L0 reference within the noise threshold,
+*   or the picture is a duplicate of one of its references
+******************************************************/
+static void DeriveStaticLcuFlag(
+    PictureParentControlSet_t   *pictureControlSetPtr,
+    MeContext_t                 *contextPtr,
+    EB_BOOL                      identicalToRef,
+    EB_U32                       lcuIndex,
+    EB_U32                       lcuOriginX,
+    EB_U32                       lcuOriginY,
+    EB_U32                       lcuWidth,
+    EB_U32                       lcuHeight)
+{
+    EbPaReferenceObject_t  *refObjL0;
+
+    pictureControlSetPtr->staticLcuArray[lcuIndex] = EB_FALSE;
+
+    if (lcuWidth != MAX_LCU_SIZE || lcuHeight != MAX_LCU_SIZE) {
+        return;
+    }
+
+    // Duplicate of a reference: no need to compare
+    if (identicalToRef) {
+        pictureControlSetPtr->staticLcuArray[lcuIndex] = EB_TRUE;
+        return;
+    }
+
+    if (!contextPtr->staticLcuDetection) {
+        return;
+    }
+
+    refObjL0 = (EbPaReferenceObject_t*)pictureControlSetPtr->refPaPicPtrArray[REF_LIST_0]->objectPtr;
+
+    pictureControlSetPtr->staticLcuArray[lcuIndex] = ColocatedLcuUnchanged(
+        contextPtr,
+        refObjL0->inputPaddedPicturePtr,
+        lcuOriginX,
+        lcuOriginY);
+}
+
 void StationaryEdgeOverUpdateOverTimeLcuPart1(
     SequenceControlSet_t        *sequenceControlSetPtr,
     PictureParentControlSet_t   *pictureControlSetPtr,
@@ -916,6 +1129,13 @@ void* MotionEstimationKernel(void *inputPtr)
 	EB_U32                       lcuWidth;
 	EB_U32                       lcuHeight;
 	EB_U32                       lcuRow;
+	EB_BOOL                      identicalToRef;
+
+	EB_U64                       segmentStartSeconds;
+	EB_U64                       segmentStartuSeconds;
+	EB_U64                       segmentDoneSeconds;
+	EB_U64                       segmentDoneuSeconds;
+	double                       segmentTime;
 
 
 
@@ -945,6 +1165,8 @@ void* MotionEstimationKernel(void *inputPtr)
 			contextPtr->pictureDecisionResultsInputFifoPtr,
 			&inputResultsWrapperPtr);
 
+		EbStartTime((unsigned long long*)&segmentStartSeconds, (unsigned long long*)&segmentStartuSeconds);
+
 		inputResultsPtr = (PictureDecisionResults_t*)inputResultsWrapperPtr->objectPtr;
 		pictureControlSetPtr = (PictureParentControlSet_t*)inputResultsPtr->pictureControlSetWrapperPtr->objectPtr;
 		sequenceControlSetPtr = (SequenceControlSet_t*)pictureControlSetPtr->sequenceControlSetWrapperPtr->objectPtr;
@@ -999,6 +1221,25 @@ void* MotionEstimationKernel(void *inputPtr)
         // Motion Estimation
         if (pictureControlSetPtr->sliceType != EB_I_SLICE) {
 
+            // Content-adaptive HME levels, from the motion history of the L0 reference
+            contextPtr->meContextPtr->skipHmeLevel0 = (EB_BOOL)((contextPtr->meContextPtr->temporalMvSeeding || contextPtr->meContextPtr->mvProjection) &&
+                DeriveHmeLevel0Skip(pictureControlSetPtr, contextPtr->meContextPtr));
+
+            if (segmentIndex == 0 && pictureControlSetPtr->enableHmeFlag) {
+                pictureControlSetPtr->hmeLevelMask = (EB_U8)(
+                    ((pictureControlSetPtr->enableHmeLevel0Flag && !contextPtr->meContextPtr->skipHmeLevel0) ? 1 : 0) |
+                    (pictureControlSetPtr->enableHmeLevel1Flag ? 2 : 0) |
+                    (pictureControlSetPtr->enableHmeLevel2Flag ? 4 : 0));
+            }
+
+            // Identical to a reference when both are in the same run of identical input pictures
+            identicalToRef = (((EbPaReferenceObject_t*)pictureControlSetPtr->refPaPicPtrArray[REF_LIST_0]->objectPtr)->duplicateRunStart == pictureControlSetPtr->duplicateRunStart ||
+                (pictureControlSetPtr->sliceType == EB_B_SLICE &&
+                ((EbPaReferenceObject_t*)pictureControlSetPtr->refPaPicPtrArray[REF_LIST_1]->objectPtr)->duplicateRunStart == pictureControlSetPtr->duplicateRunStart)) ? EB_TRUE : EB_FALSE;
+
+            contextPtr->meContextPtr->segmentStartLcuX = xLcuStartIndex;
+            contextPtr->meContextPtr->segmentStartLcuY = yLcuStartIndex;
+
             // LCU Loop
             for (yLcuIndex = yLcuStartIndex; yLcuIndex < yLcuEndIndex; ++yLcuIndex) {
                 for (xLcuIndex = xLcuStartIndex; xLcuIndex < xLcuEndIndex; ++xLcuIndex) {
@@ -1047,7 +1288,7 @@ void* MotionEstimationKernel(void *inputPtr)
                     }
 
                     // Load the 1/16 decimated LCU from the 1/16 decimated input to the 1/16 intermediate LCU buffer
-                    if (pictureControlSetPtr->enableHmeLevel0Flag) {
+                    if (pictureControlSetPtr->enableHmeLevel0Flag && !contextPtr->meContextPtr->skipHmeLevel0) {
 
                         bufferIndex = (sixteenthDecimatedPicturePtr->originY + (lcuOriginY >> 2)) * sixteenthDecimatedPicturePtr->strideY + sixteenthDecimatedPicturePtr->originX + (lcuOriginX >> 2);
 
@@ -1063,6 +1304,16 @@ void* MotionEstimationKernel(void *inputPtr)
                         }
                     }
 
+                    DeriveStaticLcuFlag(
+                        pictureControlSetPtr,
+                        contextPtr->meContextPtr,
+                        identicalToRef,
+                        lcuIndex,
+                        lcuOriginX,
+                        lcuOriginY,
+                        lcuWidth,
+                        lcuHeight);
+
                     MotionEstimateLcu(
                         pictureControlSetPtr,
                         lcuIndex,
@@ -1251,6 +1502,17 @@ void* MotionEstimationKernel(void *inputPtr)
 #if DEADLOCK_DEBUG
         SVT_LOG("POC %lld ME OUT \n", pictureControlSetPtr->pictureNumber);
 #endif
+
+        // Accumulate the ME work of the picture
+        EbFinishTime((unsigned long long*)&segmentDoneSeconds, (unsigned long long*)&segmentDoneuSeconds);
+        EbComputeOverallElapsedTimeMs(
+            segmentStartSeconds,
+            segmentStartuSeconds,
+            segmentDoneSeconds,
+            segmentDoneuSeconds,
+            &segmentTime);
+        pictureControlSetPtr->motionEstimationComputeTime += segmentTime;
+
         EbReleaseMutex(pictureControlSetPtr->rcDistortionHistogramMutex);
 		// Get Empty Results Object
 		EbGetEmptyObject(
@@ -42,4 +42,8 @@ extern EB_ERRORTYPE MotionEstimationContextCtor(
 
 extern void* MotionEstimationKernel(void *inputPtr);  
 
+extern EB_BOOL MotionEstimationUsesL0RefMeResults(
+    SequenceControlSet_t        *sequenceControlSetPtr,
+    PictureParentControlSet_t   *pictureControlSetPtr);
+
 #endif // EbMotionEstimationProcess_h
\ No newline at end of file
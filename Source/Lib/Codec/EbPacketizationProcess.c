@@ -36,6 +36,92 @@ EB_ERRORTYPE PacketizationContextCtor(
 	return EB_ErrorNone;
 }
 
+/**************************************************
+* Fill Picture Stats
+*   per-picture statistics of the output packet;
+*   latency and packetization time are set when the
+*   packet leaves the reorder queue
+**************************************************/
+static void FillPictureStats(
+    SequenceControlSet_t    *sequenceControlSetPtr,
+    PictureControlSet_t     *pictureControlSetPtr,
+    EB_BUFFERHEADERTYPE     *outputStreamPtr)
+{
+    PictureParentControlSet_t *parentPcsPtr = pictureControlSetPtr->ParentPcsPtr;
+    EB_H265_ENC_PICTURE_STATS *statsPtr = outputStreamPtr->pStats;
+    const EB_U32 codedArea = pictureControlSetPtr->intraCodedArea + pictureControlSetPtr->interCodedArea + pictureControlSetPtr->skipCodedArea;
+    double stageDoneTime[PICTURE_STAGE_TOTAL_COUNT];
+    EB_U64 qpSum = 0;
+    EB_U32 lcuIndex;
+    EB_U32 stageIndex;
+
+    EB_MEMSET(statsPtr, 0, sizeof(EB_H265_ENC_PICTURE_STATS));
+
+    // Quality Metrics
+    if (parentPcsPtr->qualityMetricsFlag) {
+        statsPtr->qualityMetricsValid = 1;
+        statsPtr->sseY = pictureControlSetPtr->reconSse[0];
+        statsPtr->sseCb = pictureControlSetPtr->reconSse[1];
+        statsPtr->sseCr = pictureControlSetPtr->reconSse[2];
+        statsPtr->psnrY = pictureControlSetPtr->reconPsnr[0];
+        statsPtr->psnrCb = pictureControlSetPtr->reconPsnr[1];
+        statsPtr->psnrCr = pictureControlSetPtr->reconPsnr[2];
+        statsPtr->ssimY = pictureControlSetPtr->reconSsim[0];
+        statsPtr->ssimCb = pictureControlSetPtr->reconSsim[1];
+        statsPtr->ssimCr = pictureControlSetPtr->reconSsim[2];
+    }
+
+    // Encode Statistics
+    statsPtr->bitCount = outputStreamPtr->nFilledLen << 3;
+    statsPtr->temporalLayerIndex = pictureControlSetPtr->temporalLayerIndex;
+
+    for (lcuIndex = 0; lcuIndex < pictureControlSetPtr->lcuTotalCount; ++lcuIndex)
+        qpSum += pictureControlSetPtr->lcuPtrArray[lcuIndex]->qp;
+    statsPtr->averageQp = (double)qpSum / pictureControlSetPtr->lcuTotalCount;
+
+    // shares of the coded (padded) CU area
+    if (codedArea) {
+        statsPtr->intraCuPercentage = 100.0 * pictureControlSetPtr->intraCodedArea / codedArea;
+        statsPtr->interCuPercentage = 100.0 * pictureControlSetPtr->interCodedArea / codedArea;
+        statsPtr->skipCuPercentage = 100.0 * pictureControlSetPtr->skipCodedArea / codedArea;
+    }
+
+    // ME SAD of the complete LCUs (16x16 PUs 5 to 20 in the ME results)
+    if (pictureControlSetPtr->sliceType != EB_I_SLICE) {
+        EB_U64 meSad = 0;
+        EB_U32 meLcuCount = 0;
+        EB_U32 puIndex;
+        for (lcuIndex = 0; lcuIndex < parentPcsPtr->lcuTotalCount; ++lcuIndex) {
+            if (sequenceControlSetPtr->lcuParamsArray[lcuIndex].isCompleteLcu) {
+                for (puIndex = 5; puIndex < 21; ++puIndex)
+                    meSad += parentPcsPtr->meResults[lcuIndex][puIndex].distortionDirection[0].distortion;
+                ++meLcuCount;
+            }
+        }
+        statsPtr->meAverageSad = meLcuCount ? (double)meSad / (meLcuCount * MAX_LCU_SIZE * MAX_LCU_SIZE) : 0;
+    }
+
+    // Stage Times
+    for (stageIndex = 0; stageIndex < PICTURE_STAGE_TOTAL_COUNT; ++stageIndex) {
+        EbComputeOverallElapsedTimeMs(
+            parentPcsPtr->startTimeSeconds,
+            parentPcsPtr->startTimeuSeconds,
+            parentPcsPtr->stageDoneTimeSeconds[stageIndex],
+            parentPcsPtr->stageDoneTimeuSeconds[stageIndex],
+            &stageDoneTime[stageIndex]);
+    }
+    statsPtr->analysisTime = stageDoneTime[PICTURE_STAGE_ANALYSIS];
+    statsPtr->motionEstimationTime = stageDoneTime[PICTURE_STAGE_MOTION_ESTIMATION] - stageDoneTime[PICTURE_STAGE_ANALYSIS];
+    statsPtr->rateControlTime = stageDoneTime[PICTURE_STAGE_RATE_CONTROL] - stageDoneTime[PICTURE_STAGE_MOTION_ESTIMATION];
+    statsPtr->encDecTime = stageDoneTime[PICTURE_STAGE_ENCDEC] - stageDoneTime[PICTURE_STAGE_RATE_CONTROL];
+    statsPtr->entropyCodingTime = stageDoneTime[PICTURE_STAGE_ENTROPY_CODING] - stageDoneTime[PICTURE_STAGE_ENCDEC];
+    statsPtr->motionEstimationComputeTime = parentPcsPtr->motionEstimationComputeTime;
+    statsPtr->duplicatePicture = (unsigned char)parentPcsPtr->duplicatePictureFlag;
+    statsPtr->hmeLevels = parentPcsPtr->hmeLevelMask;
+
+    return;
+}
+
 void* PacketizationKernel(void *inputPtr)
 {
     // Context
@@ -98,6 +184,10 @@ void* PacketizationKernel(void *inputPtr)
         queueEntryPtr->startTimeSeconds = pictureControlSetPtr->ParentPcsPtr->startTimeSeconds;
         queueEntryPtr->startTimeuSeconds = pictureControlSetPtr->ParentPcsPtr->startTimeuSeconds;
 
+        EbFinishTime(
+            (unsigned long long*)&pictureControlSetPtr->ParentPcsPtr->stageDoneTimeSeconds[PICTURE_STAGE_ENTROPY_CODING],
+            (unsigned long long*)&pictureControlSetPtr->ParentPcsPtr->stageDoneTimeuSeconds[PICTURE_STAGE_ENTROPY_CODING]);
+
         //TODO: buffer should be big enough to avoid a deadlock here. Add an assert that make the warning       
         // Get Output Bitstream buffer
         outputStreamWrapperPtr   = pictureControlSetPtr->ParentPcsPtr->outputStreamWrapperPtr;
@@ -114,6 +204,7 @@ void* PacketizationKernel(void *inputPtr)
                                      pictureControlSetPtr->sliceType : EB_NON_REF_SLICE;
 
         outputStreamPtr->pAppPrivate = pictureControlSetPtr->ParentPcsPtr->ebInputPtr->pAppPrivate;
+
         // Get Empty Rate Control Input Tasks
         EbGetEmptyObject(
             contextPtr->rateControlTasksOutputFifoPtr,
@@ -516,7 +607,15 @@ void* PacketizationKernel(void *inputPtr)
                 (EB_U32*) &(outputStreamPtr->nAllocLen),
                 ((SequenceControlSet_t*)(pictureControlSetPtr->sequenceControlSetWrapperPtr->objectPtr))->encodeContextPtr);
         }
-        
+
+        // Picture Stats
+        if (outputStreamPtr->pStats) {
+            FillPictureStats(
+                sequenceControlSetPtr,
+                pictureControlSetPtr,
+                outputStreamPtr);
+        }
+
         //Store the buffer in the Queue
         queueEntryPtr->outputStreamWrapperPtr = outputStreamWrapperPtr;               
 
@@ -562,6 +661,12 @@ void* PacketizationKernel(void *inputPtr)
                 &latency);
 
             outputStreamPtr->nTickCount = (EB_U32)latency;
+            if (outputStreamPtr->pStats) {
+                EB_H265_ENC_PICTURE_STATS *statsPtr = outputStreamPtr->pStats;
+                statsPtr->latency = latency;
+                statsPtr->packetizationTime = latency - (statsPtr->analysisTime + statsPtr->motionEstimationTime +
+                    statsPtr->rateControlTime + statsPtr->encDecTime + statsPtr->entropyCodingTime);
+            }
 			EbPostFullObject(outputStreamWrapperPtr);
 
             // Reset the Reorder Queue Entry
@@ -26,6 +26,7 @@
 #include "EbCombinedAveragingSAD_Intrinsic_AVX2.h"
 
 #include "EbTime.h"
+#include "EbRtcd.h"
 
 
 #define VARIANCE_PRECISION		16
@@ -256,89 +257,89 @@ EB_U64 ComputeVariance32x32(
 	// (0,0)
 	blockIndex = inputLumaOriginIndex;
 
-	meanOf8x8Blocks[0] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[0] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[0] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[0] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (0,1)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[1] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[1] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[1] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[1] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (0,2)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[2] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[2] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[2] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[2] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (0,3)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[3] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[3] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[3] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[3] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	
 
 	// (1,0)
 	blockIndex = inputLumaOriginIndex + (inputPaddedPicturePtr->strideY << 3);
-	meanOf8x8Blocks[4] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[4] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[4] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[4] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (1,1)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[5] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[5] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[5] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[5] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (1,2)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[6] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[6] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[6] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[6] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (1,3)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[7] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[7] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[7] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[7] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	
 
 	// (2,0)
 	blockIndex = inputLumaOriginIndex + (inputPaddedPicturePtr->strideY << 4);
-	meanOf8x8Blocks[8] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[8] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[8] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[8] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (2,1)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[9] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[9] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[9] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[9] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (2,2)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[10] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[10] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[10] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[10] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (2,3)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[11] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[11] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[11] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[11] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	
 
 	// (3,0)
 	blockIndex = inputLumaOriginIndex + (inputPaddedPicturePtr->strideY << 3) + (inputPaddedPicturePtr->strideY << 4);
-	meanOf8x8Blocks[12] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[12] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[12] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[12] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (3,1)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[13] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[13] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[13] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[13] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (3,2)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[14] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[14] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[14] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[14] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (3,3)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[15] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[15] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[15] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[15] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 
 	/////////////////////////////////////////////
@@ -399,23 +400,23 @@ EB_U64 ComputeVariance16x16(
 	// (0,0)
 	blockIndex = inputLumaOriginIndex;
 
-	meanOf8x8Blocks[0] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[0] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[0] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[0] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (0,1)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[1] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[1] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[1] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[1] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (1,0)
 	blockIndex = inputLumaOriginIndex + (inputPaddedPicturePtr->strideY << 3);
-	meanOf8x8Blocks[2] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[2] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[2] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[2] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	// (1,1)
 	blockIndex = blockIndex + 8;
-	meanOf8x8Blocks[3] = ComputeMeanFunc[0][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
-	meanOf8x8SquaredValuesBlocks[3] = ComputeMeanFunc[1][(ASM_TYPES & AVX2_MASK) && 1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8Blocks[3] = rtcd.ComputeMeanFunc[0](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
+	meanOf8x8SquaredValuesBlocks[3] = rtcd.ComputeMeanFunc[1](&(inputPaddedPicturePtr->bufferY[blockIndex]), inputPaddedPicturePtr->strideY, 8, 8);
 
 	variance8x8[0] = meanOf8x8SquaredValuesBlocks[0] - (meanOf8x8Blocks[0] * meanOf8x8Blocks[0]);
 	variance8x8[1] = meanOf8x8SquaredValuesBlocks[1] - (meanOf8x8Blocks[1] * meanOf8x8Blocks[1]);
@@ -461,428 +462,103 @@ EB_U64 ComputeVariance64x64(
 	blockIndex = inputLumaOriginIndex;
 	const EB_U16 strideY = inputPaddedPicturePtr->strideY;
 
-    if ((ASM_TYPES & AVX2_MASK) && 1) {
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[0], &meanOf8x8SquaredValuesBlocks[0]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[0], &meanOf8x8SquaredValuesBlocks[0]);
 
-        // (0,1)
-        blockIndex = blockIndex + 32;
+    // (0,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[4], &meanOf8x8SquaredValuesBlocks[4]);
-        // (0,5)
-        blockIndex = blockIndex + 24;
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[4], &meanOf8x8SquaredValuesBlocks[4]);
+    // (0,5)
+    blockIndex = blockIndex + 24;
 
-        // (1,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3);
+    // (1,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 3);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[8], &meanOf8x8SquaredValuesBlocks[8]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[8], &meanOf8x8SquaredValuesBlocks[8]);
 
-        // (1,1)
-        blockIndex = blockIndex + 32;
+    // (1,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[12], &meanOf8x8SquaredValuesBlocks[12]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[12], &meanOf8x8SquaredValuesBlocks[12]);
 
-        // (1,5)
-        blockIndex = blockIndex + 24;
+    // (1,5)
+    blockIndex = blockIndex + 24;
 
-        // (2,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 4);
+    // (2,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 4);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[16], &meanOf8x8SquaredValuesBlocks[16]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[16], &meanOf8x8SquaredValuesBlocks[16]);
 
-        // (2,1)
-        blockIndex = blockIndex + 32;
+    // (2,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[20], &meanOf8x8SquaredValuesBlocks[20]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[20], &meanOf8x8SquaredValuesBlocks[20]);
 
-        // (2,5)
-        blockIndex = blockIndex + 24;
+    // (2,5)
+    blockIndex = blockIndex + 24;
 
-        // (3,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4);
+    // (3,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[24], &meanOf8x8SquaredValuesBlocks[24]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[24], &meanOf8x8SquaredValuesBlocks[24]);
 
-        // (3,1)
-        blockIndex = blockIndex + 32;
+    // (3,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[28], &meanOf8x8SquaredValuesBlocks[28]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[28], &meanOf8x8SquaredValuesBlocks[28]);
 
-        // (3,5)
-        blockIndex = blockIndex + 24;
+    // (3,5)
+    blockIndex = blockIndex + 24;
 
-        // (4,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 5);
+    // (4,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 5);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[32], &meanOf8x8SquaredValuesBlocks[32]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[32], &meanOf8x8SquaredValuesBlocks[32]);
 
-        // (4,1)
-        blockIndex = blockIndex + 32;
+    // (4,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[36], &meanOf8x8SquaredValuesBlocks[36]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[36], &meanOf8x8SquaredValuesBlocks[36]);
 
-        // (4,5)
-        blockIndex = blockIndex + 24;
+    // (4,5)
+    blockIndex = blockIndex + 24;
 
-        // (5,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 5);
+    // (5,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 5);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[40], &meanOf8x8SquaredValuesBlocks[40]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[40], &meanOf8x8SquaredValuesBlocks[40]);
 
-        // (5,1)
-        blockIndex = blockIndex + 32;
+    // (5,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[44], &meanOf8x8SquaredValuesBlocks[44]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[44], &meanOf8x8SquaredValuesBlocks[44]);
 
-        // (5,5)
-        blockIndex = blockIndex + 24;
+    // (5,5)
+    blockIndex = blockIndex + 24;
 
-        // (6,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 4) + (strideY << 5);
+    // (6,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 4) + (strideY << 5);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[48], &meanOf8x8SquaredValuesBlocks[48]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[48], &meanOf8x8SquaredValuesBlocks[48]);
 
-        // (6,1)
-        blockIndex = blockIndex + 32;
+    // (6,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[52], &meanOf8x8SquaredValuesBlocks[52]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[52], &meanOf8x8SquaredValuesBlocks[52]);
 
-        // (6,5)
-        blockIndex = blockIndex + 24;
+    // (6,5)
+    blockIndex = blockIndex + 24;
 
-        // (7,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4) + (strideY << 5);
+    // (7,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4) + (strideY << 5);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[56], &meanOf8x8SquaredValuesBlocks[56]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[56], &meanOf8x8SquaredValuesBlocks[56]);
 
-        // (7,1)
-        blockIndex = blockIndex + 32;
+    // (7,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[60], &meanOf8x8SquaredValuesBlocks[60]);
-
-
-    }
-    else{
-        meanOf8x8Blocks[0] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[0] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (0,1)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[1] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[1] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (0,2)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[2] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[2] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (0,3)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[3] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[3] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (0,4)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[4] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[4] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (0,5)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[5] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[5] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (0,6)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[6] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[6] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (0,7)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[7] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[7] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (1,0)
-	    blockIndex = inputLumaOriginIndex + (strideY << 3);
-	    meanOf8x8Blocks[8] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[8] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (1,1)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[9] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[9] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-	    // (1,2)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[10] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-	    meanOf8x8SquaredValuesBlocks[10] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (1,3)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[11] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[11] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (1,4)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[12] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[12] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (1,5)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[13] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[13] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (1,6)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[14] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[14] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (1,7)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[15] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[15] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (2,0)
-	    blockIndex = inputLumaOriginIndex + (strideY << 4);
-	    meanOf8x8Blocks[16] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[16] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (2,1)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[17] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[17] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (2,2)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[18] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[18] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (2,3)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[19] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[19] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    /// (2,4)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[20] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[20] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (2,5)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[21] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[21] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (2,6)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[22] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[22] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (2,7)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[23] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[23] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (3,0)
-	    blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4);
-	    meanOf8x8Blocks[24] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[24] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (3,1)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[25] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[25] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (3,2)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[26] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[26] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (3,3)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[27] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[27] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (3,4)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[28] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[28] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (3,5)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[29] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[29] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (3,6)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[30] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[30] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (3,7)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[31] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[31] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (4,0)
-	    blockIndex = inputLumaOriginIndex + (strideY << 5);
-	    meanOf8x8Blocks[32] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[32] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (4,1)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[33] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[33] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (4,2)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[34] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[34] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (4,3)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[35] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[35] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (4,4)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[36] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[36] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (4,5)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[37] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[37] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (4,6)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[38] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[38] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (4,7)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[39] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[39] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (5,0)
-	    blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 5);
-	    meanOf8x8Blocks[40] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[40] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (5,1)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[41] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[41] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (5,2)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[42] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[42] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (5,3)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[43] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[43] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (5,4)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[44] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[44] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (5,5)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[45] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[45] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (5,6)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[46] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[46] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (5,7)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[47] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[47] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (6,0)
-	    blockIndex = inputLumaOriginIndex + (strideY << 4) + (strideY << 5);
-	    meanOf8x8Blocks[48] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[48] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (6,1)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[49] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[49] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (6,2)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[50] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[50] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (6,3)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[51] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[51] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (6,4)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[52] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[52] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (6,5)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[53] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[53] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (6,6)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[54] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[54] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (6,7)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[55] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[55] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (7,0)
-	    blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4) + (strideY << 5);
-	    meanOf8x8Blocks[56] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[56] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (7,1)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[57] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[57] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (7,2)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[58] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[58] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (7,3)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[59] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[59] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (7,4)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[60] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[60] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (7,5)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[61] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[61] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (7,6)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[62] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[62] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-
-	    // (7,7)
-	    blockIndex = blockIndex + 8;
-	    meanOf8x8Blocks[63] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-	    meanOf8x8SquaredValuesBlocks[63] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]),  strideY);
-    
-    
-    }
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[60], &meanOf8x8SquaredValuesBlocks[60]);
 
 
 	// 16x16
@@ -1867,431 +1543,107 @@ EB_ERRORTYPE ComputeBlockMeanComputeVariance(
 
     const EB_U16 strideY = inputPaddedPicturePtr->strideY;
 
-    if ((ASM_TYPES & AVX2_MASK) && 1){
-
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[0], &meanOf8x8SquaredValuesBlocks[0]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[0], &meanOf8x8SquaredValuesBlocks[0]);
 
-        // (0,1)
-        blockIndex = blockIndex + 32;
+    // (0,1)
+    blockIndex = blockIndex + 32;
 
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[4], &meanOf8x8SquaredValuesBlocks[4]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[4], &meanOf8x8SquaredValuesBlocks[4]);
 
-        // (0,5)
-        blockIndex = blockIndex + 24;
+    // (0,5)
+    blockIndex = blockIndex + 24;
 
-        // (1,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3);
+    // (1,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 3);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[8], &meanOf8x8SquaredValuesBlocks[8]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[8], &meanOf8x8SquaredValuesBlocks[8]);
 
-        // (1,1)
-        blockIndex = blockIndex + 32;
+    // (1,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[12], &meanOf8x8SquaredValuesBlocks[12]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[12], &meanOf8x8SquaredValuesBlocks[12]);
 
-        // (1,5)
-        blockIndex = blockIndex + 24;
+    // (1,5)
+    blockIndex = blockIndex + 24;
 
-        // (2,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 4);
+    // (2,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 4);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[16], &meanOf8x8SquaredValuesBlocks[16]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[16], &meanOf8x8SquaredValuesBlocks[16]);
 
-        // (2,1)
-        blockIndex = blockIndex + 32;
+    // (2,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[20], &meanOf8x8SquaredValuesBlocks[20]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[20], &meanOf8x8SquaredValuesBlocks[20]);
 
-        // (2,5)
-        blockIndex = blockIndex + 24;
+    // (2,5)
+    blockIndex = blockIndex + 24;
 
-        // (3,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4);
+    // (3,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4);
 
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[24], &meanOf8x8SquaredValuesBlocks[24]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[24], &meanOf8x8SquaredValuesBlocks[24]);
 
-        // (3,1)
-        blockIndex = blockIndex + 32;
+    // (3,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[28], &meanOf8x8SquaredValuesBlocks[28]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[28], &meanOf8x8SquaredValuesBlocks[28]);
 
-        // (3,5)
-        blockIndex = blockIndex + 24;
+    // (3,5)
+    blockIndex = blockIndex + 24;
 
-        // (4,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 5);
+    // (4,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 5);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[32], &meanOf8x8SquaredValuesBlocks[32]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[32], &meanOf8x8SquaredValuesBlocks[32]);
 
-        // (4,1)
-        blockIndex = blockIndex + 32;
+    // (4,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[36], &meanOf8x8SquaredValuesBlocks[36]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[36], &meanOf8x8SquaredValuesBlocks[36]);
 
-        // (4,5)
-        blockIndex = blockIndex + 24;
+    // (4,5)
+    blockIndex = blockIndex + 24;
 
-        // (5,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 5);
+    // (5,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 5);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[40], &meanOf8x8SquaredValuesBlocks[40]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[40], &meanOf8x8SquaredValuesBlocks[40]);
 
-        // (5,1)
-        blockIndex = blockIndex + 32;
+    // (5,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[44], &meanOf8x8SquaredValuesBlocks[44]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[44], &meanOf8x8SquaredValuesBlocks[44]);
 
-        // (5,5)
-        blockIndex = blockIndex + 24;
+    // (5,5)
+    blockIndex = blockIndex + 24;
 
-        // (6,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 4) + (strideY << 5);
+    // (6,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 4) + (strideY << 5);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[48], &meanOf8x8SquaredValuesBlocks[48]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[48], &meanOf8x8SquaredValuesBlocks[48]);
 
-        // (6,1)
-        blockIndex = blockIndex + 32;
+    // (6,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[52], &meanOf8x8SquaredValuesBlocks[52]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[52], &meanOf8x8SquaredValuesBlocks[52]);
 
-        // (6,5)
-        blockIndex = blockIndex + 24;
+    // (6,5)
+    blockIndex = blockIndex + 24;
 
 
-        // (7,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4) + (strideY << 5);
+    // (7,0)
+    blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4) + (strideY << 5);
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[56], &meanOf8x8SquaredValuesBlocks[56]);
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[56], &meanOf8x8SquaredValuesBlocks[56]);
 
 
-        // (7,1)
-        blockIndex = blockIndex + 32;
+    // (7,1)
+    blockIndex = blockIndex + 32;
 
-        ComputeIntermVarFour8x8_AVX2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[60], &meanOf8x8SquaredValuesBlocks[60]);
-
-       
-    }
-    else{
-        meanOf8x8Blocks[0] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[0] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (0,1)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[1] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[1] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (0,2)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[2] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[2] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (0,3)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[3] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[3] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (0,4)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[4] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[4] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (0,5)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[5] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[5] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (0,6)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[6] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[6] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (0,7)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[7] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[7] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (1,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3);
-        meanOf8x8Blocks[8] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[8] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (1,1)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[9] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[9] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (1,2)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[10] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[10] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (1,3)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[11] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[11] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (1,4)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[12] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[12] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (1,5)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[13] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[13] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (1,6)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[14] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[14] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (1,7)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[15] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[15] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (2,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 4);
-        meanOf8x8Blocks[16] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[16] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (2,1)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[17] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[17] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (2,2)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[18] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[18] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (2,3)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[19] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[19] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        /// (2,4)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[20] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[20] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (2,5)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[21] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[21] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (2,6)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[22] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[22] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (2,7)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[23] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[23] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (3,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4);
-        meanOf8x8Blocks[24] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[24] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (3,1)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[25] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[25] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (3,2)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[26] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[26] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (3,3)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[27] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[27] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (3,4)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[28] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[28] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (3,5)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[29] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[29] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (3,6)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[30] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[30] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (3,7)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[31] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[31] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (4,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 5);
-        meanOf8x8Blocks[32] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[32] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (4,1)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[33] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[33] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (4,2)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[34] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[34] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (4,3)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[35] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[35] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (4,4)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[36] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[36] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (4,5)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[37] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[37] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (4,6)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[38] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[38] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (4,7)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[39] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[39] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (5,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 5);
-        meanOf8x8Blocks[40] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[40] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (5,1)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[41] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[41] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (5,2)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[42] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[42] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (5,3)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[43] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[43] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (5,4)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[44] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[44] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (5,5)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[45] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[45] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (5,6)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[46] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[46] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (5,7)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[47] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[47] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (6,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 4) + (strideY << 5);
-        meanOf8x8Blocks[48] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[48] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (6,1)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[49] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[49] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (6,2)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[50] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[50] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (6,3)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[51] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[51] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (6,4)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[52] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[52] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (6,5)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[53] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[53] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (6,6)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[54] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[54] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (6,7)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[55] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[55] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (7,0)
-        blockIndex = inputLumaOriginIndex + (strideY << 3) + (strideY << 4) + (strideY << 5);
-        meanOf8x8Blocks[56] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[56] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (7,1)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[57] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[57] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (7,2)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[58] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[58] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (7,3)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[59] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[59] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (7,4)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[60] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[60] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (7,5)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[61] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[61] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (7,6)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[62] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[62] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-
-        // (7,7)
-        blockIndex = blockIndex + 8;
-        meanOf8x8Blocks[63] = ComputeSubMean8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-        meanOf8x8SquaredValuesBlocks[63] = ComputeSubdMeanOfSquaredValues8x8_SSE2_INTRIN(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY);
-    }
+    rtcd.ComputeIntermVarFour8x8(&(inputPaddedPicturePtr->bufferY[blockIndex]), strideY, &meanOf8x8Blocks[60], &meanOf8x8SquaredValuesBlocks[60]);
 
 
 	// 16x16
@@ -2574,7 +1926,7 @@ EB_ERRORTYPE DenoiseInputPicture(
 
 
 			if (lcuOriginX == 0)
-				StrongLumaFilter_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.StrongLumaFilter(
 				inputPicturePtr,
 				denoisedPicturePtr,
 				lcuOriginY,
@@ -2607,7 +1959,7 @@ EB_ERRORTYPE DenoiseInputPicture(
             lcuOriginY = lcuParams->originY;
 
 			if (lcuOriginX == 0)
-				StrongChromaFilter_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.StrongChromaFilter(
 				inputPicturePtr,
 				denoisedPicturePtr,
 				lcuOriginY >> subHeightCMinus1,
@@ -2660,7 +2012,7 @@ EB_ERRORTYPE DenoiseInputPicture(
             lcuOriginY = lcuParams->originY;
 
 			if (lcuOriginX == 0)
-				WeakChromaFilter_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.WeakChromaFilter(
 				inputPicturePtr,
 				denoisedPicturePtr,
 				lcuOriginY >> subHeightCMinus1,
@@ -2763,7 +2115,7 @@ EB_ERRORTYPE DetectInputPictureNoise(
 		EB_U32  noiseOriginIndex = noisePicturePtr->originX + lcuOriginX + noisePicturePtr->originY * noisePicturePtr->strideY;
 
 		if (lcuOriginX == 0)
-			WeakLumaFilter_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+			rtcd.WeakLumaFilter(
 			inputPicturePtr,
 			denoisedPicturePtr,
 			noisePicturePtr,
@@ -2935,7 +2287,7 @@ EB_ERRORTYPE SubSampleFilterNoise(
             lcuOriginY = lcuParams->originY;
 
 			if (lcuOriginX == 0)
-				WeakLumaFilter_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.WeakLumaFilter(
 				inputPicturePtr,
 				denoisedPicturePtr,
 				noisePicturePtr,
@@ -2969,7 +2321,7 @@ EB_ERRORTYPE SubSampleFilterNoise(
             lcuOriginY = lcuParams->originY;
 
 			if (lcuOriginX == 0)
-				WeakChromaFilter_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.WeakChromaFilter(
 				inputPicturePtr,
 				denoisedPicturePtr,
 				lcuOriginY >> subHeightCMinus1,
@@ -3014,7 +2366,7 @@ EB_ERRORTYPE SubSampleFilterNoise(
 			if (lcuParams->isCompleteLcu && pictureControlSetPtr->lcuFlatNoiseArray[lcuIndex] == 1)
 			{
 
-				WeakLumaFilterLcu_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.WeakLumaFilterLcu(
 					inputPicturePtr,
 					denoisedPicturePtr,
 					noisePicturePtr,
@@ -3135,7 +2487,7 @@ EB_ERRORTYPE QuarterSampleDetectNoise(
 			block64x64Y = vert64x64Index * 64;
 
 			if (block64x64X == 0)
-				WeakLumaFilter_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.WeakLumaFilter(
 				quarterDecimatedPicturePtr,
 				denoisedPicturePtr,
 				noisePicturePtr,
@@ -3279,7 +2631,7 @@ EB_ERRORTYPE SubSampleDetectNoise(
 			block64x64Y = vert64x64Index * 64;
 
 			if (block64x64X == 0)
-				WeakLumaFilter_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+				rtcd.WeakLumaFilter(
 				sixteenthDecimatedPicturePtr,
 				denoisedPicturePtr,
 				noisePicturePtr,
@@ -3603,7 +2955,7 @@ void SubSampleLumaGeneratePixelIntensityHistogramBins(
 
 
 			// Initialize bins to 1
-			InitializeBuffer_32bits_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](pictureControlSetPtr->pictureHistogram[regionInPictureWidthIndex][regionInPictureHeightIndex][0], 64, 0, 1);
+			rtcd.InitializeBuffer_32bits(pictureControlSetPtr->pictureHistogram[regionInPictureWidthIndex][regionInPictureHeightIndex][0], 64, 0, 1);
 
 			regionWidthOffset = (regionInPictureWidthIndex == sequenceControlSetPtr->pictureAnalysisNumberOfRegionsPerWidth - 1) ?
 				inputPicturePtr->width - (sequenceControlSetPtr->pictureAnalysisNumberOfRegionsPerWidth * regionWidth) :
@@ -3662,8 +3014,8 @@ void SubSampleChromaGeneratePixelIntensityHistogramBins(
 
 
             // Initialize bins to 1
-			InitializeBuffer_32bits_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](pictureControlSetPtr->pictureHistogram[regionInPictureWidthIndex][regionInPictureHeightIndex][1], 64, 0, 1);
-			InitializeBuffer_32bits_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1](pictureControlSetPtr->pictureHistogram[regionInPictureWidthIndex][regionInPictureHeightIndex][2], 64, 0, 1);
+			rtcd.InitializeBuffer_32bits(pictureControlSetPtr->pictureHistogram[regionInPictureWidthIndex][regionInPictureHeightIndex][1], 64, 0, 1);
+			rtcd.InitializeBuffer_32bits(pictureControlSetPtr->pictureHistogram[regionInPictureWidthIndex][regionInPictureHeightIndex][2], 64, 0, 1);
 
             regionWidthOffset = (regionInPictureWidthIndex == sequenceControlSetPtr->pictureAnalysisNumberOfRegionsPerWidth - 1) ?
                 inputPicturePtr->width - (sequenceControlSetPtr->pictureAnalysisNumberOfRegionsPerWidth * regionWidth) :
@@ -4515,6 +3867,10 @@ void* PictureAnalysisKernel(void *inputPtr)
 		outputResultsPtr = (PictureAnalysisResults_t*)outputResultsWrapperPtr->objectPtr;
 		outputResultsPtr->pictureControlSetWrapperPtr = inputResultsPtr->pictureControlSetWrapperPtr;
 
+		EbFinishTime(
+			(unsigned long long*)&pictureControlSetPtr->stageDoneTimeSeconds[PICTURE_STAGE_ANALYSIS],
+			(unsigned long long*)&pictureControlSetPtr->stageDoneTimeuSeconds[PICTURE_STAGE_ANALYSIS]);
+
 #if DEADLOCK_DEBUG
         SVT_LOG("POC %lld PA OUT \n", pictureControlSetPtr->pictureNumber);
 #endif
@@ -4528,9 +3884,3 @@ void* PictureAnalysisKernel(void *inputPtr)
 	}
 	return EB_NULL;
 }
-
-void UnusedVariablevoidFunc_PA()
-{
-	(void)SadCalculation_8x8_16x16_funcPtrArray;
-	(void)SadCalculation_32x32_64x64_funcPtrArray;
-}
@@ -52,14 +52,6 @@ typedef void(*EB_WEAKLUMAFILTER_TYPE)(
 	EB_U32                       lcuOriginY,
 	EB_U32						 lcuOriginX
 	);
-static EB_WEAKLUMAFILTER_TYPE FUNC_TABLE WeakLumaFilter_funcPtrArray[EB_ASM_TYPE_TOTAL] =
-{
-	// C_DEFAULT
-	noiseExtractLumaWeak,
-	// AVX2
-	noiseExtractLumaWeak_AVX2_INTRIN,
-
-};
 
 void noiseExtractLumaWeakLcu(
 	EbPictureBufferDesc_t       *inputPicturePtr,
@@ -68,14 +60,6 @@ void noiseExtractLumaWeakLcu(
 	EB_U32                       lcuOriginY,
 	EB_U32						 lcuOriginX
 	);
-static EB_WEAKLUMAFILTER_TYPE FUNC_TABLE WeakLumaFilterLcu_funcPtrArray[EB_ASM_TYPE_TOTAL] =
-{
-	// C_DEFAULT
-	noiseExtractLumaWeakLcu,
-	// AVX2
-	noiseExtractLumaWeakLcu_AVX2_INTRIN,
-
-};
 
 
 void noiseExtractLumaStrong(
@@ -90,14 +74,6 @@ typedef void(*EB_STRONGLUMAFILTER_TYPE)(
 	EB_U32                       lcuOriginY,
 	EB_U32						 lcuOriginX
 	);
-static EB_STRONGLUMAFILTER_TYPE FUNC_TABLE StrongLumaFilter_funcPtrArray[EB_ASM_TYPE_TOTAL] =
-{
-	// C_DEFAULT
-	noiseExtractLumaStrong,
-	// AVX2
-	noiseExtractLumaStrong_AVX2_INTRIN,
-
-};
 void noiseExtractChromaStrong(
 	EbPictureBufferDesc_t       *inputPicturePtr,
 	EbPictureBufferDesc_t       *denoisedPicturePtr,
@@ -110,14 +86,6 @@ typedef void(*EB_STRONGCHROMAFILTER_TYPE)(
 	EB_U32                       lcuOriginY,
 	EB_U32						 lcuOriginX
 	);
-static EB_STRONGCHROMAFILTER_TYPE FUNC_TABLE StrongChromaFilter_funcPtrArray[EB_ASM_TYPE_TOTAL] =
-{
-	// C_DEFAULT
-	noiseExtractChromaStrong,
-	// AVX2
-	noiseExtractChromaStrong_AVX2_INTRIN,
-
-};
 
 void noiseExtractChromaWeak(
 	EbPictureBufferDesc_t       *inputPicturePtr,
@@ -131,14 +99,6 @@ typedef void(*EB_WEAKCHROMAFILTER_TYPE)(
 	EB_U32                       lcuOriginY,
 	EB_U32						 lcuOriginX
 	);
-static EB_WEAKCHROMAFILTER_TYPE FUNC_TABLE WeakChromaFilter_funcPtrArray[EB_ASM_TYPE_TOTAL] =
-{
-	// C_DEFAULT
-	noiseExtractChromaWeak,
-	// AVX2
-	noiseExtractChromaWeak_AVX2_INTRIN,
-
-};
 
 
 #endif // EbPictureAnalysis_h
\ No newline at end of file
@@ -568,6 +568,8 @@ EB_ERRORTYPE PictureControlSetCtor(
 
     EB_CREATEMUTEX(EB_HANDLE, objectPtr->intraMutex, sizeof(EB_HANDLE), EB_MUTEX);
 
+    EB_CREATEMUTEX(EB_HANDLE, objectPtr->qualityMetricsMutex, sizeof(EB_HANDLE), EB_MUTEX);
+
     return EB_ErrorNone;
 
 }
@@ -744,6 +746,9 @@ EB_ERRORTYPE PictureParentControlSetCtor(
     // similar Colocated Lcu array
     EB_MALLOC(EB_BOOL*, objectPtr->similarColocatedLcuArrayAllLayers, sizeof(EB_BOOL) * objectPtr->lcuTotalCount, EB_N_PTR);
 
+    // static Lcu array
+    EB_MALLOC(EB_BOOL*, objectPtr->staticLcuArray, sizeof(EB_BOOL) * objectPtr->lcuTotalCount, EB_N_PTR);
+
     // LCU noise variance array
     EB_MALLOC(EB_U8*, objectPtr->lcuFlatNoiseArray, sizeof(EB_U8) * objectPtr->lcuTotalCount, EB_N_PTR);
     EB_MALLOC(EB_U64*, objectPtr->lcuVarianceOfVarianceOverTime, sizeof(EB_U64) * objectPtr->lcuTotalCount, EB_N_PTR);
@@ -780,6 +785,11 @@ EB_ERRORTYPE PictureParentControlSetCtor(
     EB_MALLOC(EB_LCU_COMPLEXITY_STATUS*, objectPtr->complexLcuArray, sizeof(EB_LCU_COMPLEXITY_STATUS) * objectPtr->lcuTotalCount, EB_N_PTR);
 
     EB_CREATEMUTEX(EB_HANDLE, objectPtr->rcDistortionHistogramMutex, sizeof(EB_HANDLE), EB_MUTEX);
+    EB_CREATEMUTEX(EB_HANDLE, objectPtr->meDoneMutex, sizeof(EB_HANDLE), EB_MUTEX);
+    objectPtr->meDone = EB_FALSE;
+    objectPtr->meWaitingListHead = (PictureParentControlSet_t*)EB_NULL;
+    objectPtr->meWaitingListNext = (PictureParentControlSet_t*)EB_NULL;
+    objectPtr->meHeldResultsWrapperPtr = (EbObjectWrapper_t*)EB_NULL;
     
 
     EB_MALLOC(EB_LCU_DEPTH_MODE*, objectPtr->lcuMdModeArray, sizeof(EB_LCU_DEPTH_MODE) * objectPtr->lcuTotalCount, EB_N_PTR);
@@ -31,6 +31,7 @@ extern "C" {
 #define HISTOGRAM_NUMBER_OF_BINS            256  
 #define MAX_NUMBER_OF_REGIONS_IN_WIDTH      4
 #define MAX_NUMBER_OF_REGIONS_IN_HEIGHT     4
+#define ME_MV_HISTOGRAM_BINS                8    // 0, 1, 2-3, 4-7, ... 32-63, 64+ pels per picture interval
 
 #define MAX_REF_QP_NUM                      52
 
@@ -57,6 +58,15 @@ extern "C" {
 
 #define NEIGHBOR_ARRAY_TOTAL_COUNT             4
 
+// Picture stage completion times, reported in the output picture stats
+#define PICTURE_STAGE_ANALYSIS                 0
+#define PICTURE_STAGE_MOTION_ESTIMATION        1
+#define PICTURE_STAGE_RATE_CONTROL             2
+#define PICTURE_STAGE_ENCDEC                   3
+#define PICTURE_STAGE_ENTROPY_CODING           4
+
+#define PICTURE_STAGE_TOTAL_COUNT              5
+
 
 
 struct PredictionUnit_s;
@@ -169,6 +179,8 @@ typedef struct PictureControlSet_s
 
     EB_HANDLE                             intraMutex;
     EB_U32                                intraCodedArea;
+    EB_U32                                interCodedArea;           // non-skip inter CUs, updated with intraMutex
+    EB_U32                                skipCodedArea;            // skip CUs, updated with intraMutex
 
     // Mode Decision Config
     MdcLcuData_t                         *mdcLcuArray;
@@ -278,6 +290,20 @@ typedef struct PictureControlSet_s
     EB_BOOL                               bdpPresentFlag;
     EB_BOOL                               mdPresentFlag;
 
+    // Quality Metrics (computed in the EncDec tail when ParentPcsPtr->qualityMetricsFlag is set)
+    // LCU rows are claimed through qualityMetricsNextRow and summed under qualityMetricsMutex.
+    // The thread that sums the last row posts the EncDec results of the last segment rows.
+    EB_HANDLE                             qualityMetricsMutex;
+    EB_U32                                qualityMetricsNextRow;
+    EB_U32                                qualityMetricsRowsDone;
+    EB_U32                                qualityMetricsLcuRowIndexStart;
+    EB_U32                                qualityMetricsLcuRowIndexCount;
+    double                                reconSsimSum[3];
+    EB_U32                                reconSsimCount[3];
+    EB_U64                                reconSse[3];
+    double                                reconPsnr[3];
+    double                                reconSsim[3];
+
 } PictureControlSet_t;
 
 
@@ -341,6 +367,7 @@ typedef struct PictureParentControlSet_s
     EB_BOOL                               craFlag;
     EB_BOOL                               openGopCraFlag;
     EB_BOOL                               sceneChangeFlag;   
+    EB_U64                                sceneStartPictureNumber;                  // picture number of the last scene change at or before this picture
     EB_BOOL                               endOfSequenceFlag;   
 
     EB_U8                                 pictureQp;                                 
@@ -363,6 +390,7 @@ typedef struct PictureParentControlSet_s
     EB_U8                                 temporalLayerIndex;                       
     EB_U64                                decodeOrder;        
     EB_BOOL                               isUsedAsReferenceFlag;
+    EB_BOOL                               qualityMetricsFlag;
     EB_U8                                 refList0Count;                             
     EB_U8                                 refList1Count;   
     PredictionStructure_t                *predStructPtr;          // need to check
@@ -409,6 +437,9 @@ typedef struct PictureParentControlSet_s
 
     EB_U64                                startTimeSeconds;
     EB_U64                                startTimeuSeconds;
+    EB_U64                                stageDoneTimeSeconds[PICTURE_STAGE_TOTAL_COUNT];
+    EB_U64                                stageDoneTimeuSeconds[PICTURE_STAGE_TOTAL_COUNT];
+    double                                motionEstimationComputeTime;        // ms, summed over the ME segments
     EB_U32                                lumaSse;   
     EB_U32                                crSse;   
     EB_U32                                cbSse;   
@@ -437,6 +468,12 @@ typedef struct PictureParentControlSet_s
     EB_U8                                 meSegmentsColumnCount;
     EB_U8                                 meSegmentsRowCount;
     EB_U64                                meSegmentsCompletionMask;
+    EB_HANDLE                             meDoneMutex;                      // Guards meDone and meWaitingListHead
+    EB_BOOL                               meDone;                           // Set once all ME segments are done
+    struct PictureParentControlSet_s     *meWaitingListHead;                // Pictures whose ME segments are held back until this picture's ME is done
+    struct PictureParentControlSet_s     *meWaitingListNext;
+    EbObjectWrapper_t                    *meHeldResultsWrapperPtr;          // ME segments filled by Picture Decision, posted once the L0 reference's ME is done
+    EB_U32                                meMvHistogram[ME_MV_HISTOGRAM_BINS];    // LCUs per 64x64 L0 MV magnitude per picture interval, set before meDone
 
     // Motion Estimation Results
     EB_U8                                 maxNumberOfPusPerLcu;
@@ -487,6 +524,7 @@ typedef struct PictureParentControlSet_s
 
     EB_BOOL                              *similarColocatedLcuArray;
     EB_BOOL                              *similarColocatedLcuArrayAllLayers;
+    EB_BOOL                              *staticLcuArray;
     EB_U8                                *lcuFlatNoiseArray;
     EB_U64                               *lcuVarianceOfVarianceOverTime;
     EB_BOOL                              *isLcuHomogeneousOverTime;
@@ -519,6 +557,8 @@ typedef struct PictureParentControlSet_s
     EB_U8                                 percentageOfEdgeinLightBackground;
     EB_BOOL                               darkBackGroundlightForeGround;
     EbObjectWrapper_t                    *previousPictureControlSetWrapperPtr;
+    EB_BOOL                               duplicatePictureFlag;                         // identical to the previous input picture, computed @ ResourceCoordinationProcess()
+    EB_U64                                duplicateRunStart;                            // picture number of the first picture of the run of identical pictures
     LcuStat_t                            *lcuStatArray;
     EB_U8                                 veryLowVarPicFlag;
     EB_BOOL                               highDarkAreaDensityFlag;                      // computed @ PictureAnalysisProcess() and used @ SourceBasedOperationsProcess()
@@ -567,6 +607,8 @@ typedef struct PictureParentControlSet_s
     EB_BOOL                               enableHmeLevel0Flag;
     EB_BOOL                               enableHmeLevel1Flag;
     EB_BOOL                               enableHmeLevel2Flag;
+    EB_BOOL                               hmeLevel0SkipAllowed;                         // near references in the same scene, computed @ PictureDecisionProcess()
+    EB_U8                                 hmeLevelMask;                                 // HME levels run (bit n: level n), computed @ MotionEstimationProcess()
     EB_BOOL                               disableVarianceFlag;
 
 } PictureParentControlSet_t;
@@ -15,6 +15,7 @@
 #include "EbPictureDecisionProcess.h"
 #include "EbPictureDecisionResults.h"
 #include "EbReferenceObject.h"
+#include "EbMotionEstimationProcess.h"
 #include "EbComputeSAD.h"
 #include "EbMeSadCalculation.h"
 
@@ -33,6 +34,7 @@
 #define SCENE_TH                            3000
 #define NOISY_SCENE_TH                      4500	// SCD TH in presence of noise
 #define HIGH_PICTURE_VARIANCE_TH			1500
+#define HME_LEVEL0_SKIP_MAX_DISTANCE        2       // Max POC distance to the references for HME level 0 to be skipped
 #define NUM64x64INPIC(w,h)          ((w*h)>> (LOG2F(MAX_LCU_SIZE)<<1))
 #define QUEUE_GET_PREVIOUS_SPOT(h)  ((h == 0) ? PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH - 1 : h - 1)
 #define QUEUE_GET_NEXT_SPOT(h,off)  (( (h+off) >= PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH) ? h+off - PICTURE_DECISION_REORDER_QUEUE_MAX_DEPTH  : h + off)
@@ -85,6 +87,7 @@ EB_ERRORTYPE PictureDecisionContextCtor(
     contextPtr->resetRunningAvg = EB_TRUE;
 
 	contextPtr->isSceneChangeDetected = EB_FALSE;
+	contextPtr->sceneStartPictureNumber = 0;
 
 
     return EB_ErrorNone;
@@ -690,6 +693,42 @@ EB_ERRORTYPE SignalDerivationMultiProcessesOq(
     return return_error;
 }
 
+/******************************************************
+* Derive whether HME level 0 may be skipped
+  Only for pictures whose references are all near and
+  in the same scene; the L0 reference's own L0
+  reference must be in that scene too, as its ME
+  results are the motion history ME relies on
+******************************************************/
+static EB_BOOL DeriveHmeLevel0SkipAllowed(
+    PictureParentControlSet_t   *pictureControlSetPtr)
+{
+    PictureParentControlSet_t *refPictureControlSetPtr;
+    EB_U64 distance;
+
+    if (pictureControlSetPtr->sliceType == EB_I_SLICE || pictureControlSetPtr->refList0Count == 0) {
+        return EB_FALSE;
+    }
+
+    refPictureControlSetPtr = pictureControlSetPtr->refPaPcsArray[REF_LIST_0];
+    distance = (EB_U64)ABS((EB_S64)pictureControlSetPtr->pictureNumber - (EB_S64)pictureControlSetPtr->refPicPocArray[REF_LIST_0]);
+
+    if (refPictureControlSetPtr->sliceType == EB_I_SLICE ||
+        refPictureControlSetPtr->refPicPocArray[REF_LIST_0] < pictureControlSetPtr->sceneStartPictureNumber ||
+        refPictureControlSetPtr->sceneStartPictureNumber != pictureControlSetPtr->sceneStartPictureNumber) {
+        return EB_FALSE;
+    }
+
+    if (pictureControlSetPtr->sliceType == EB_B_SLICE && pictureControlSetPtr->refList1Count) {
+        distance = MAX(distance, (EB_U64)ABS((EB_S64)pictureControlSetPtr->pictureNumber - (EB_S64)pictureControlSetPtr->refPicPocArray[REF_LIST_1]));
+
+        if (pictureControlSetPtr->refPaPcsArray[REF_LIST_1]->sceneStartPictureNumber != pictureControlSetPtr->sceneStartPictureNumber) {
+            return EB_FALSE;
+        }
+    }
+
+    return (EB_BOOL)(distance <= HME_LEVEL0_SKIP_MAX_DISTANCE);
+}
 
 /***************************************************************************************************
  * Picture Decision Kernel
@@ -796,8 +835,7 @@ void* PictureDecisionKernel(void *inputPtr)
     EbObjectWrapper_t               *inputResultsWrapperPtr;
     PictureAnalysisResults_t        *inputResultsPtr;
     
-    EbObjectWrapper_t               *outputResultsWrapperPtr;
-    PictureDecisionResults_t        *outputResultsPtr;
+    EB_BOOL                          meWaitsForL0Ref;
 
     PredictionStructureEntry_t      *predPositionPtr;
 
@@ -943,6 +981,12 @@ void* PictureDecisionKernel(void *inputPtr)
             pictureControlSetPtr->pictureNumber    = (encodeContextPtr->currentInputPoc + 1) /*& ((1 << sequenceControlSetPtr->bitsForPictureOrderCount)-1)*/;
             encodeContextPtr->currentInputPoc      = pictureControlSetPtr->pictureNumber;
 
+            // Track the scene the picture belongs to
+            if (windowAvail == EB_TRUE && pictureControlSetPtr->sceneChangeFlag == EB_TRUE) {
+                contextPtr->sceneStartPictureNumber = pictureControlSetPtr->pictureNumber;
+            }
+            pictureControlSetPtr->sceneStartPictureNumber = contextPtr->sceneStartPictureNumber;
+
 
 			pictureControlSetPtr->predStructure = sequenceControlSetPtr->staticConfig.predStructure;
 
@@ -1485,6 +1529,11 @@ void* PictureDecisionKernel(void *inputPtr)
                                     paReferenceEntryPtr->inputObjectPtr,
                                     1);
 
+                                EbPaReferenceAcquireMeBuffers(
+                                    (EbPaReferenceObject_t*)paReferenceEntryPtr->inputObjectPtr->objectPtr,
+                                    encodeContextPtr->halfPelPlanesPoolFifoPtr,
+                                    encodeContextPtr->blockHashIndexPoolFifoPtr);
+
                                 ((EbPaReferenceObject_t*)pictureControlSetPtr->refPaPicPtrArray[REF_LIST_0]->objectPtr)->pPcsPtr = paReferenceEntryPtr->pPcsPtr;
 
                                 EbObjectIncLiveCount(
@@ -1520,6 +1569,11 @@ void* PictureDecisionKernel(void *inputPtr)
                                     paReferenceEntryPtr->inputObjectPtr,
                                     1);
 
+                                EbPaReferenceAcquireMeBuffers(
+                                    (EbPaReferenceObject_t*)paReferenceEntryPtr->inputObjectPtr->objectPtr,
+                                    encodeContextPtr->halfPelPlanesPoolFifoPtr,
+                                    encodeContextPtr->blockHashIndexPoolFifoPtr);
+
                                 ((EbPaReferenceObject_t*)pictureControlSetPtr->refPaPicPtrArray[REF_LIST_1]->objectPtr)->pPcsPtr = paReferenceEntryPtr->pPcsPtr;
 
                                 EbObjectIncLiveCount(
@@ -1530,34 +1584,59 @@ void* PictureDecisionKernel(void *inputPtr)
                             }
                         }
 
-   
+
+                        // Content-adaptive HME levels
+                        pictureControlSetPtr->hmeLevel0SkipAllowed = DeriveHmeLevel0SkipAllowed(pictureControlSetPtr);
+                        pictureControlSetPtr->hmeLevelMask = 0;
+
                         // Initialize Segments
                         pictureControlSetPtr->meSegmentsColumnCount    =  (EB_U8)(sequenceControlSetPtr->meSegmentColumnCountArray[pictureControlSetPtr->temporalLayerIndex]);
                         pictureControlSetPtr->meSegmentsRowCount       =  (EB_U8)(sequenceControlSetPtr->meSegmentRowCountArray[pictureControlSetPtr->temporalLayerIndex]);
                         pictureControlSetPtr->meSegmentsTotalCount     =  (EB_U16)(pictureControlSetPtr->meSegmentsColumnCount  * pictureControlSetPtr->meSegmentsRowCount);
                         pictureControlSetPtr->meSegmentsCompletionMask = 0;
+                        pictureControlSetPtr->motionEstimationComputeTime = 0;
+
+                        pictureControlSetPtr->meDone = EB_FALSE;
+                        pictureControlSetPtr->meWaitingListHead = (PictureParentControlSet_t*)EB_NULL;
+                        pictureControlSetPtr->meWaitingListNext = (PictureParentControlSet_t*)EB_NULL;
+
+                        // Post the results to the ME processes; a picture reading the ME results of its
+                        // L0 reference gets its segments filled here, but queued on the reference while the
+                        // ME of the reference is in flight, and Initial Rate Control posts them once it is done.
+                        // The segments are taken before the reference's mutex so only Picture Decision waits on the pool
+                        meWaitsForL0Ref = EB_FALSE;
+                        pictureControlSetPtr->meHeldResultsWrapperPtr = (EbObjectWrapper_t*)EB_NULL;
+                        if (MotionEstimationUsesL0RefMeResults(sequenceControlSetPtr, pictureControlSetPtr)) {
+                            PictureParentControlSet_t *refPictureControlSetPtr = pictureControlSetPtr->refPaPcsArray[REF_LIST_0];
+
+                            pictureControlSetPtr->meHeldResultsWrapperPtr = GetHeldPictureDecisionResults(
+                                contextPtr->pictureDecisionResultsOutputFifoPtr,
+                                encodeContextPtr->preAssignmentBuffer[pictureIndex],
+                                pictureControlSetPtr->meSegmentsTotalCount);
+
+                            EbBlockOnMutex(refPictureControlSetPtr->meDoneMutex);
+                            if (!refPictureControlSetPtr->meDone) {
+                                PictureParentControlSet_t **waitingListTailPtr = &refPictureControlSetPtr->meWaitingListHead;
+
+                                // Keep the waiting pictures in decode order
+                                while (*waitingListTailPtr) {
+                                    waitingListTailPtr = &(*waitingListTailPtr)->meWaitingListNext;
+                                }
+                                *waitingListTailPtr = pictureControlSetPtr;
+                                meWaitsForL0Ref = EB_TRUE;
+                            }
+                            EbReleaseMutex(refPictureControlSetPtr->meDoneMutex);
 
-                        // Post the results to the ME processes                  
-                        {
-                            EB_U32 segmentIndex;
-
-                            for(segmentIndex=0; segmentIndex < pictureControlSetPtr->meSegmentsTotalCount; ++segmentIndex)
-                            {
-                                // Get Empty Results Object
-                                EbGetEmptyObject(
-                                    contextPtr->pictureDecisionResultsOutputFifoPtr,
-                                    &outputResultsWrapperPtr);
-
-                                outputResultsPtr = (PictureDecisionResults_t*) outputResultsWrapperPtr->objectPtr;
-
-								outputResultsPtr->pictureControlSetWrapperPtr = encodeContextPtr->preAssignmentBuffer[pictureIndex];
-
-                                outputResultsPtr->segmentIndex = segmentIndex;  
-                        
-                                // Post the Full Results Object
-                                EbPostFullObject(outputResultsWrapperPtr);
+                            if (!meWaitsForL0Ref) {
+                                PostHeldPictureDecisionResults(pictureControlSetPtr->meHeldResultsWrapperPtr);
                             }
                         }
+                        else {
+                            PostPictureDecisionResults(
+                                contextPtr->pictureDecisionResultsOutputFifoPtr,
+                                encodeContextPtr->preAssignmentBuffer[pictureIndex],
+                                pictureControlSetPtr->meSegmentsTotalCount);
+                        }
 
 						if (pictureIndex == contextPtr->miniGopEndIndex[miniGopIndex]) {
 
@@ -1630,12 +1709,3 @@ void* PictureDecisionKernel(void *inputPtr)
     
     return EB_NULL;
 }
-void UnusedVariablevoidFunc_PicDecision()
-{
-    (void)NxMSadKernel_funcPtrArray;
-	(void)NxMSadLoopKernel_funcPtrArray;
-    (void)NxMSadAveragingKernel_funcPtrArray;
-    (void)SadCalculation_8x8_16x16_funcPtrArray;
-    (void)SadCalculation_32x32_64x64_funcPtrArray;
-    (void)InitializeBuffer_32bits_funcPtrArray;
-}
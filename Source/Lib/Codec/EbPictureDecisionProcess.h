@@ -25,6 +25,7 @@ typedef struct PictureDecisionContext_s
     EB_U32 **ahdRunningAvgCr;
     EB_U32 **ahdRunningAvg;
 	EB_BOOL		isSceneChangeDetected;
+	EB_U64		sceneStartPictureNumber;
 
 	// Dynamic GOP
 	EB_U32	    totalRegionActivityCost[MAX_NUMBER_OF_REGIONS_IN_WIDTH][MAX_NUMBER_OF_REGIONS_IN_HEIGHT];
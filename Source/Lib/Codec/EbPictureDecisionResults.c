@@ -21,4 +21,87 @@ EB_ERRORTYPE PictureDecisionResultCtor(
     return EB_ErrorNone;
 }
 
+/**************************************
+ * Post the ME segments of a picture
+ **************************************/
+void PostPictureDecisionResults(
+    EbFifo_t            *outputFifoPtr,
+    EbObjectWrapper_t   *pictureControlSetWrapperPtr,
+    EB_U32               segmentCount)
+{
+    EbObjectWrapper_t        *outputResultsWrapperPtr;
+    PictureDecisionResults_t *outputResultsPtr;
+    EB_U32                    segmentIndex;
+
+    for (segmentIndex = 0; segmentIndex < segmentCount; ++segmentIndex) {
+
+        // Get Empty Results Object
+        EbGetEmptyObject(
+            outputFifoPtr,
+            &outputResultsWrapperPtr);
+
+        outputResultsPtr = (PictureDecisionResults_t*)outputResultsWrapperPtr->objectPtr;
+        outputResultsPtr->pictureControlSetWrapperPtr = pictureControlSetWrapperPtr;
+        outputResultsPtr->segmentIndex = segmentIndex;
+        outputResultsPtr->nextHeldResultsWrapperPtr = (EbObjectWrapper_t*)EB_NULL;
+
+        // Post the Full Results Object
+        EbPostFullObject(outputResultsWrapperPtr);
+    }
+}
+
+/**************************************
+ * Fill the ME segments of a picture held
+ *   back for its L0 reference, without
+ *   posting them; returns the first one
+ **************************************/
+EbObjectWrapper_t* GetHeldPictureDecisionResults(
+    EbFifo_t            *outputFifoPtr,
+    EbObjectWrapper_t   *pictureControlSetWrapperPtr,
+    EB_U32               segmentCount)
+{
+    EbObjectWrapper_t        *headResultsWrapperPtr = (EbObjectWrapper_t*)EB_NULL;
+    EbObjectWrapper_t       **tailResultsWrapperPtr = &headResultsWrapperPtr;
+    EbObjectWrapper_t        *outputResultsWrapperPtr;
+    PictureDecisionResults_t *outputResultsPtr;
+    EB_U32                    segmentIndex;
+
+    for (segmentIndex = 0; segmentIndex < segmentCount; ++segmentIndex) {
+
+        // Get Empty Results Object
+        EbGetEmptyObject(
+            outputFifoPtr,
+            &outputResultsWrapperPtr);
 
+        outputResultsPtr = (PictureDecisionResults_t*)outputResultsWrapperPtr->objectPtr;
+        outputResultsPtr->pictureControlSetWrapperPtr = pictureControlSetWrapperPtr;
+        outputResultsPtr->segmentIndex = segmentIndex;
+        outputResultsPtr->nextHeldResultsWrapperPtr = (EbObjectWrapper_t*)EB_NULL;
+
+        *tailResultsWrapperPtr = outputResultsWrapperPtr;
+        tailResultsWrapperPtr = &outputResultsPtr->nextHeldResultsWrapperPtr;
+    }
+
+    return headResultsWrapperPtr;
+}
+
+/**************************************
+ * Post the held back ME segments of a
+ *   picture; never blocks
+ **************************************/
+void PostHeldPictureDecisionResults(
+    EbObjectWrapper_t   *heldResultsWrapperPtr)
+{
+    EbObjectWrapper_t *nextResultsWrapperPtr;
+
+    while (heldResultsWrapperPtr) {
+
+        // Read the link first, ME may release the object as soon as it is posted
+        nextResultsWrapperPtr = ((PictureDecisionResults_t*)heldResultsWrapperPtr->objectPtr)->nextHeldResultsWrapperPtr;
+
+        // Post the Full Results Object
+        EbPostFullObject(heldResultsWrapperPtr);
+
+        heldResultsWrapperPtr = nextResultsWrapperPtr;
+    }
+}
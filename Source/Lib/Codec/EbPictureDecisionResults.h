@@ -16,6 +16,7 @@ typedef struct PictureDecisionResults_s
 {
     EbObjectWrapper_t   *pictureControlSetWrapperPtr;
     EB_U32               segmentIndex;
+    EbObjectWrapper_t   *nextHeldResultsWrapperPtr;     // Next ME segment of a picture held back for its L0 reference
 } PictureDecisionResults_t;
 
 typedef struct PictureDecisionResultInitData_s
@@ -30,5 +31,17 @@ extern EB_ERRORTYPE PictureDecisionResultCtor(
     EB_PTR *objectDblPtr, 
     EB_PTR objectInitDataPtr);
 
+extern void PostPictureDecisionResults(
+    EbFifo_t            *outputFifoPtr,
+    EbObjectWrapper_t   *pictureControlSetWrapperPtr,
+    EB_U32               segmentCount);
+
+extern EbObjectWrapper_t* GetHeldPictureDecisionResults(
+    EbFifo_t            *outputFifoPtr,
+    EbObjectWrapper_t   *pictureControlSetWrapperPtr,
+    EB_U32               segmentCount);
+
+extern void PostHeldPictureDecisionResults(
+    EbObjectWrapper_t   *heldResultsWrapperPtr);
    
 #endif //EbPictureDecisionResults_h
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 #include "EbComputeSAD.h"
 #include "EbPackUnPack.h"
+#include "EbRtcd.h"
 
 /*********************************
  * x86 implememtation of Picture Addition
@@ -29,7 +30,7 @@ void PictureAddition(
     EB_U32  height)
 {
 
-	AdditionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][width >> 3](
+	rtcd.AdditionKernel[width >> 3](
         predPtr,
         predStride,
         residualPtr,
@@ -64,7 +65,7 @@ EB_ERRORTYPE PictureCopy8Bit(
     // Execute the Kernels
     if (componentMask & PICTURE_BUFFER_DESC_Y_FLAG) {
 
-        PicCopyKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][areaWidth>>3](
+        rtcd.PicCopyKernel[areaWidth>>3](
             &(src->bufferY[srcLumaOriginIndex]),
             src->strideY,
             &(dst->bufferY[dstLumaOriginIndex]),
@@ -75,7 +76,7 @@ EB_ERRORTYPE PictureCopy8Bit(
 
     if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
 
-		PicCopyKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][chromaAreaWidth >> 3](
+		rtcd.PicCopyKernel[chromaAreaWidth >> 3](
             &(src->bufferCb[srcChromaOriginIndex]),
             src->strideCb,
             &(dst->bufferCb[dstChromaOriginIndex]),
@@ -86,7 +87,7 @@ EB_ERRORTYPE PictureCopy8Bit(
 
     if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
 
-		PicCopyKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][chromaAreaWidth >> 3](
+		rtcd.PicCopyKernel[chromaAreaWidth >> 3](
             &(src->bufferCr[srcChromaOriginIndex]),
             src->strideCr,
             &(dst->bufferCr[dstChromaOriginIndex]),
@@ -115,7 +116,7 @@ void PictureSubSampledResidual(
     EB_U8    lastLine)    //the last line has correct prediction data, so no duplication to be done.
 {
 
-    ResidualKernelSubSampled_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][areaWidth>>3](
+    rtcd.ResidualKernelSubSampled[areaWidth>>3](
         input,
         inputStride,
         pred,
@@ -143,7 +144,7 @@ void PictureResidual(
     EB_U32   areaHeight)
 {
 
-    ResidualKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][areaWidth>>3](
+    rtcd.ResidualKernel[areaWidth>>3](
         input,
         inputStride,
         pred,
@@ -171,7 +172,7 @@ void PictureResidual16bit(
     EB_U32   areaHeight)
 {
 
-    ResidualKernel_funcPtrArray16Bit[(ASM_TYPES & PREAVX2_MASK) && 1](
+    rtcd.ResidualKernel16Bit(
         input,
         inputStride,
         pred,
@@ -194,7 +195,17 @@ EB_U64 ComputeNxMSatd8x8Units_U8(
 	EB_U64 satd = 0;
 	EB_U32 blockIndexInWidth;
 	EB_U32 blockIndexInHeight;
-	EB_SATD_U8_TYPE Compute8x8SatdFunction = Compute8x8Satd_U8_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1];
+	EB_SATD_U8_TYPE Compute8x8SatdFunction = rtcd.Compute8x8Satd_U8;
+
+	// Four 8x8 blocks at a time when the area allows it
+	if (((width | height) & 15) == 0) {
+		for (blockIndexInHeight = 0; blockIndexInHeight < height >> 4; ++blockIndexInHeight) {
+			for (blockIndexInWidth = 0; blockIndexInWidth < width >> 4; ++blockIndexInWidth) {
+				satd += rtcd.Compute16x16Satd_U8(&(src[(blockIndexInWidth << 4) + (blockIndexInHeight << 4) * srcStride]), dcValue, srcStride);
+			}
+		}
+		return satd;
+	}
 
 	for (blockIndexInHeight = 0; blockIndexInHeight < height >> 3; ++blockIndexInHeight) {
 		for (blockIndexInWidth = 0; blockIndexInWidth < width >> 3; ++blockIndexInWidth) {
@@ -287,7 +298,7 @@ EB_ERRORTYPE PictureFastDistortion(
     // Y
     if (componentMask & PICTURE_BUFFER_DESC_Y_FLAG) {
 
-        lumaDistortion[DIST_CALC_RESIDUAL] += NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][size >> 3](
+        lumaDistortion[DIST_CALC_RESIDUAL] += rtcd.NxMSadKernel[size >> 3](
             &(input->bufferY[inputLumaOriginIndex]),
             input->strideY,
             &(pred->bufferY[predLumaOriginIndex]),
@@ -299,7 +310,7 @@ EB_ERRORTYPE PictureFastDistortion(
     // Cb
     if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
 
-        chromaDistortion[DIST_CALC_RESIDUAL] += NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][chromaSize >> 3]( // Always SAD without weighting
+        chromaDistortion[DIST_CALC_RESIDUAL] += rtcd.NxMSadKernel[chromaSize >> 3]( // Always SAD without weighting
             &(input->bufferCb[inputChromaOriginIndex]),
             input->strideCb,
             &(pred->bufferCb[predChromaOriginIndex]),
@@ -311,7 +322,7 @@ EB_ERRORTYPE PictureFastDistortion(
     // Cr
     if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
 
-        chromaDistortion[DIST_CALC_RESIDUAL] += NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][chromaSize >> 3]( // Always SAD without weighting
+        chromaDistortion[DIST_CALC_RESIDUAL] += rtcd.NxMSadKernel[chromaSize >> 3]( // Always SAD without weighting
             &(input->bufferCr[inputChromaOriginIndex]),
             input->strideCr,
             &(pred->bufferCr[predChromaOriginIndex]),
@@ -350,7 +361,7 @@ EB_ERRORTYPE PictureFullDistortion_R(
     // Y
     if (componentMask & PICTURE_BUFFER_DESC_Y_FLAG) {
 			
-		FullDistortionIntrinsic_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][countNonZeroCoeffs[0] != 0][mode == INTRA_MODE][areaSize>>3](
+		rtcd.FullDistortionIntrinsic[countNonZeroCoeffs[0] != 0][mode == INTRA_MODE][areaSize>>3](
             &(((EB_S16*) coeff->bufferY)[coeffLumaOriginIndex]),
             coeff->strideY,
             &(((EB_S16*) reconCoeff->bufferY)[coeffLumaOriginIndex]),
@@ -363,7 +374,7 @@ EB_ERRORTYPE PictureFullDistortion_R(
     // Cb
     if (componentMask & PICTURE_BUFFER_DESC_Cb_FLAG) {
         
-		FullDistortionIntrinsic_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][countNonZeroCoeffs[1] != 0][mode == INTRA_MODE][chromaAreaSize >> 3](
+		rtcd.FullDistortionIntrinsic[countNonZeroCoeffs[1] != 0][mode == INTRA_MODE][chromaAreaSize >> 3](
             &(((EB_S16*) coeff->bufferCb)[coeffChromaOriginIndex]),
             coeff->strideCb,
             &(((EB_S16*) reconCoeff->bufferCb)[coeffChromaOriginIndex]),
@@ -376,7 +387,7 @@ EB_ERRORTYPE PictureFullDistortion_R(
     // Cr
     if (componentMask & PICTURE_BUFFER_DESC_Cr_FLAG) {
 
-		FullDistortionIntrinsic_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][countNonZeroCoeffs[2] != 0][mode == INTRA_MODE][chromaAreaSize >> 3](
+		rtcd.FullDistortionIntrinsic[countNonZeroCoeffs[2] != 0][mode == INTRA_MODE][chromaAreaSize >> 3](
             &(((EB_S16*) coeff->bufferCr)[coeffChromaOriginIndex]),
             coeff->strideCr,
             &(((EB_S16*) reconCoeff->bufferCr)[coeffChromaOriginIndex]),
@@ -412,7 +423,7 @@ EB_ERRORTYPE PictureFullDistortionLuma(
     lumaDistortion[1]   = 0;
 	
     // Y
-	FullDistortionIntrinsic_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][countNonZeroCoeffsY != 0][mode == INTRA_MODE][areaSize >> 3](
+	rtcd.FullDistortionIntrinsic[countNonZeroCoeffsY != 0][mode == INTRA_MODE][areaSize >> 3](
         &(((EB_S16*) coeff->bufferY)[coeffLumaOriginIndex]),
         coeff->strideY,
         &(((EB_S16*) reconCoeff->bufferY)[reconCoeffLumaOriginIndex]),
@@ -436,7 +447,7 @@ void extract8Bitdata(
     )
 {
     
-    UnPack8BIT_funcPtrArray_16Bit[((width & 3) == 0) && ((height & 1)== 0)][(ASM_TYPES & PREAVX2_MASK) && 1](
+    rtcd.UnPack8BIT_16Bit[((width & 3) == 0) && ((height & 1)== 0)](
         in16BitBuffer,
         inStride,
         out8BitBuffer,    
@@ -455,7 +466,7 @@ void UnpackL0L1Avg(
         EB_U32  height)
  {
  
-     UnPackAvg_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+     rtcd.UnPackAvg(
         ref16L0,
         refL0Stride,
         ref16L1,
@@ -477,7 +488,7 @@ void Extract8BitdataSafeSub(
     )
 {
 
-    UnPack8BITSafeSub_funcPtrArray_16Bit[(ASM_TYPES & AVX2_MASK) && 1](
+    rtcd.UnPack8BITSafeSub_16Bit(
         in16BitBuffer,
         inStride,
         out8BitBuffer,    
@@ -498,7 +509,7 @@ void UnpackL0L1AvgSafeSub(
  {
      //fix C
 
-     UnPackAvgSafeSub_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+     rtcd.UnPackAvgSafeSub(
         ref16L0,
         refL0Stride,
         ref16L1,
@@ -522,7 +533,7 @@ void UnPack2D(
     )
 {
     
-    UnPack2D_funcPtrArray_16Bit[((width & 3) == 0) && ((height & 1)== 0)][(ASM_TYPES & AVX512_MASK) && 1](
+    rtcd.UnPack2D_16Bit[((width & 3) == 0) && ((height & 1)== 0)](
         in16BitBuffer,
         inStride,
         out8BitBuffer,
@@ -545,7 +556,7 @@ void Pack2D_SRC(
    )
 {
 	 
-    Pack2D_funcPtrArray_16Bit_SRC[((width & 3) == 0) && ((height & 1)== 0)][(ASM_TYPES & AVX2_MASK) && 1](
+    rtcd.Pack2D_16Bit_SRC[((width & 3) == 0) && ((height & 1)== 0)](
         in8BitBuffer,
         in8Stride,
         innBitBuffer,
@@ -568,7 +579,7 @@ void CompressedPackLcu(
 )
 {
 
-    CompressedPack_funcPtrArray[((width == 64 || width == 32) ? ((ASM_TYPES & AVX2_MASK) && 1) : EB_ASM_NON_AVX2)](
+    ((width == 64 || width == 32) ? rtcd.CompressedPack : CompressedPackmsb)(
         in8BitBuffer,
         in8Stride,
         innBitBuffer,
@@ -593,7 +604,7 @@ void CompressedPackBlk(
 {
 
 
-	CompressedPack_funcPtrArray[((width == 64 || width == 32 || width == 16 || width == 8) ? ((ASM_TYPES & AVX2_MASK) && 1) : EB_ASM_NON_AVX2)](
+	((width == 64 || width == 32 || width == 16 || width == 8) ? rtcd.CompressedPack : CompressedPackmsb)(
 		in8BitBuffer,
 		in8Stride,
 		innBitBuffer,
@@ -615,7 +626,7 @@ void Conv2bToCPackLcu(
 	EB_U32     height)
 {
 
-	Convert_Unpack_CPack_funcPtrArray[((width == 64 || width == 32) ? ((ASM_TYPES & AVX2_MASK) && 1) : EB_ASM_NON_AVX2)](
+	((width == 64 || width == 32) ? rtcd.Convert_Unpack_CPack : CPack_C)(
 		innBitBuffer,
 		innStride,
 		inCompnBitBuffer,
@@ -685,11 +696,3 @@ void memset16bitBlock (
        memset16bit((EB_U16*)inPtr + i*strideIn, value, size);
 
 }  
-
-
-void UnusedVariablevoidFunc_PicOper()
-{
-    (void)NxMSadKernel_funcPtrArray;
-	(void)NxMSadLoopKernel_funcPtrArray;
-    (void)NxMSadAveragingKernel_funcPtrArray;
-}
@@ -21,6 +21,7 @@
 #include "EbTransforms.h"
 
 #include "EbInterPrediction.h"
+#include "EbRtcd.h"
 #include "emmintrin.h"
 
 #define TH_NFL_BIAS             7
@@ -1382,7 +1383,7 @@ void PerformInverseTransformRecon(
                         EB_FALSE,
                         tuSize < 32 ? PF_OFF : contextPtr->pfMdMode);
 
-                    AdditionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][tuSize >> 3](
+                    rtcd.AdditionKernel[tuSize >> 3](
                         &(candidateBuffer->predictionPtr->bufferY[tuOriginIndex]),
                         64,
                         &(((EB_S16*)(contextPtr->transQuantBuffersPtr->tuTransCoeff2Nx2NPtr->bufferY))[tuOriginIndex]),
@@ -2039,7 +2040,7 @@ void ProductPerformFastLoop(
 					lumaFastDistortion = candidatePtr->meDistortion;
 				else
 					// Y
-					lumaFastDistortion += (NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][cuSize >> 3] ( 
+					lumaFastDistortion += (rtcd.NxMSadKernel[cuSize >> 3] ( 
 						inputBufferY,
 						inputStrideY,
 						predBufferY,
@@ -2053,7 +2054,7 @@ void ProductPerformFastLoop(
                     EB_U8 * const inputBufferCb = inputPicturePtr->bufferCb + inputCbOriginIndex;
                     EB_U8 *  const predBufferCb = candidateBuffer->predictionPtr->bufferCb + cuChromaOriginIndex;
 
-					chromaFastDistortion += NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][cuSize >> 4] ( 
+					chromaFastDistortion += rtcd.NxMSadKernel[cuSize >> 4] ( 
 						inputBufferCb,
 						inputPicturePtr->strideCb,
 						predBufferCb,
@@ -2065,7 +2066,7 @@ void ProductPerformFastLoop(
                     EB_U8 * const inputBufferCr = inputPicturePtr->bufferCr + inputCrOriginIndex;
                     EB_U8 * const predBufferCr = candidateBuffer->predictionPtr->bufferCr + cuChromaOriginIndex;
 
-                    chromaFastDistortion += NxMSadKernel_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][cuSize >> 4] (
+                    chromaFastDistortion += rtcd.NxMSadKernel[cuSize >> 4] (
                         inputBufferCr,
                         inputPicturePtr->strideCb ,
                         predBufferCr,
@@ -3254,7 +3255,7 @@ EB_EXTERN EB_ERRORTYPE PerformIntra4x4Search(
                         EB_TRUE,
                         EB_FALSE);
 
-                    AdditionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][candidateBuffer->candidatePtr->transformSize >> 3](
+                    rtcd.AdditionKernel[candidateBuffer->candidatePtr->transformSize >> 3](
                         &(candidateBuffer->predictionPtr->bufferY[puOriginIndex]),
                         candidateBuffer->predictionPtr->strideY,
                         &(((EB_S16*)(contextPtr->transQuantBuffersPtr->tuTransCoeff2Nx2NPtr->bufferY))[puOriginIndex]),
@@ -3280,7 +3281,7 @@ EB_EXTERN EB_ERRORTYPE PerformIntra4x4Search(
                         PICTURE_BUFFER_DESC_Y_FLAG);
                 }
 
-                yFullDistortion[0] = SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(MIN_PU_SIZE) - 2](
+                yFullDistortion[0] = rtcd.SpatialFullDistortionKernel[Log2f(MIN_PU_SIZE) - 2](
                     &(inputPicturePtr->bufferY[inputOriginIndex]),
                     inputPicturePtr->strideY,
                     &(candidateBuffer->reconPtr->bufferY[puOriginIndex]),
@@ -3304,7 +3305,7 @@ EB_EXTERN EB_ERRORTYPE PerformIntra4x4Search(
                             EB_FALSE, // DCT
                             EB_FALSE);
 
-                        AdditionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][candidateBuffer->candidatePtr->transformSize >> 3](
+                        rtcd.AdditionKernel[candidateBuffer->candidatePtr->transformSize >> 3](
                             &(candidateBuffer->predictionPtr->bufferCb[puChromaOriginIndex]),
                             candidateBuffer->predictionPtr->strideCb,
                             &(((EB_S16*)(contextPtr->transQuantBuffersPtr->tuTransCoeff2Nx2NPtr->bufferCb))[puChromaOriginIndex]),
@@ -3330,7 +3331,7 @@ EB_EXTERN EB_ERRORTYPE PerformIntra4x4Search(
                             PICTURE_BUFFER_DESC_Cb_FLAG);
                     }
 
-                    cbFullDistortion[0] = SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(MIN_PU_SIZE) - 2](
+                    cbFullDistortion[0] = rtcd.SpatialFullDistortionKernel[Log2f(MIN_PU_SIZE) - 2](
                         &(inputPicturePtr->bufferCb[inputChromaOriginIndex]),
                         inputPicturePtr->strideCb,
                         &(candidateBuffer->reconPtr->bufferCb[puChromaOriginIndex]),
@@ -3352,7 +3353,7 @@ EB_EXTERN EB_ERRORTYPE PerformIntra4x4Search(
                             EB_FALSE, // DCT
                             EB_FALSE);
 
-                        AdditionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][candidateBuffer->candidatePtr->transformSize >> 3](
+                        rtcd.AdditionKernel[candidateBuffer->candidatePtr->transformSize >> 3](
                             &(candidateBuffer->predictionPtr->bufferCr[puChromaOriginIndex]),
                             candidateBuffer->predictionPtr->strideCr,
                             &(((EB_S16*)(contextPtr->transQuantBuffersPtr->tuTransCoeff2Nx2NPtr->bufferCr))[puChromaOriginIndex]),
@@ -3378,7 +3379,7 @@ EB_EXTERN EB_ERRORTYPE PerformIntra4x4Search(
                             PICTURE_BUFFER_DESC_Cr_FLAG);
                     }
 
-                    crFullDistortion[0] = SpatialFullDistortionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][Log2f(MIN_PU_SIZE) - 2](
+                    crFullDistortion[0] = rtcd.SpatialFullDistortionKernel[Log2f(MIN_PU_SIZE) - 2](
                         &(inputPicturePtr->bufferCr[inputChromaOriginIndex]),
                         inputPicturePtr->strideCr,
                         &(candidateBuffer->reconPtr->bufferCr[puChromaOriginIndex]),
@@ -3455,7 +3456,7 @@ EB_EXTERN EB_ERRORTYPE PerformIntra4x4Search(
                     BIT_INCREMENT_8BIT,
                     EB_TRUE, // DST
                     EB_FALSE);
-                AdditionKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][candidateBuffer->candidatePtr->transformSize >> 3](
+                rtcd.AdditionKernel[candidateBuffer->candidatePtr->transformSize >> 3](
                     &(candidateBuffer->predictionPtr->bufferY[puOriginIndex]),
                     candidateBuffer->predictionPtr->strideY,
                     &(((EB_S16*)(contextPtr->transQuantBuffersPtr->tuTransCoeff2Nx2NPtr->bufferY))[puOriginIndex]),
@@ -4116,7 +4117,7 @@ void UpdateMdReconBuffer(
 	LargestCodingUnit_t				*lcuPtr)
 {
 	if ((contextPtr->cuStats->size >> 3) < 9) {
-		PicCopyKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][contextPtr->cuStats->size >> 3](
+		rtcd.PicCopyKernel[contextPtr->cuStats->size >> 3](
 			&(reconSrcPtr->bufferY[contextPtr->cuStats->originX + contextPtr->cuStats->originY * reconSrcPtr->strideY]),
 			reconSrcPtr->strideY,
 			&(reconDstPtr->bufferY[contextPtr->cuStats->originX + contextPtr->cuStats->originY * reconDstPtr->strideY]),
@@ -4129,7 +4130,7 @@ void UpdateMdReconBuffer(
 			EB_U16  chromaOriginX = contextPtr->cuStats->originX >> 1;
 			EB_U16  chromaOriginY = contextPtr->cuStats->originY >> 1;
 
-			PicCopyKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][chromaSize >> 3](
+			rtcd.PicCopyKernel[chromaSize >> 3](
 				&(reconSrcPtr->bufferCb[chromaOriginX + chromaOriginY * reconSrcPtr->strideCb]),
 				reconSrcPtr->strideCb,
 				&(reconDstPtr->bufferCb[chromaOriginX + chromaOriginY * reconDstPtr->strideCb]),
@@ -4137,7 +4138,7 @@ void UpdateMdReconBuffer(
 				chromaSize,
 				chromaSize);
 
-			PicCopyKernel_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][chromaSize >> 3](
+			rtcd.PicCopyKernel[chromaSize >> 3](
 				&(reconSrcPtr->bufferCr[chromaOriginX + chromaOriginY * reconSrcPtr->strideCr]),
 				reconSrcPtr->strideCr,
 				&(reconDstPtr->bufferCr[chromaOriginX + chromaOriginY * reconDstPtr->strideCr]),
@@ -13,6 +13,7 @@
 #include "EbUtility.h"
 #include "EbErrorCodes.h"
 #include "EbErrorHandling.h"
+#include "EbTime.h"
 
 #include "EbRateControlResults.h"
 #include "EbRateControlTasks.h"
@@ -2512,6 +2513,10 @@ void* RateControlKernel(void *inputPtr)
             rateControlResultsPtr = (RateControlResults_t*)rateControlResultsWrapperPtr->objectPtr;
             rateControlResultsPtr->pictureControlSetWrapperPtr = rateControlTasksPtr->pictureControlSetWrapperPtr;
 
+            EbFinishTime(
+                (unsigned long long*)&pictureControlSetPtr->ParentPcsPtr->stageDoneTimeSeconds[PICTURE_STAGE_RATE_CONTROL],
+                (unsigned long long*)&pictureControlSetPtr->ParentPcsPtr->stageDoneTimeuSeconds[PICTURE_STAGE_RATE_CONTROL]);
+
 #if DEADLOCK_DEBUG
             SVT_LOG("POC %lld RC OUT \n", pictureControlSetPtr->pictureNumber);
 #endif
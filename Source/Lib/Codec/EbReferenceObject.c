@@ -8,6 +8,7 @@
 
 #include "EbPictureBufferDesc.h"
 #include "EbReferenceObject.h"
+#include "EbThreads.h"
 
 void InitializeSamplesNeighboringReferencePicture16Bit(
     EB_BYTE  reconSamplesBufferPtr,
@@ -254,9 +255,147 @@ EB_ERRORTYPE EbPaReferenceObjectCtor(
 		if (return_error == EB_ErrorInsufficientResources){
             return EB_ErrorInsufficientResources;
         }
+
+    // Half-pel planes and block hash index, attached by the PictureDecision
+    paReferenceObject->halfPelPlanesWrapperPtr = (EbObjectWrapper_t*)EB_NULL;
+    paReferenceObject->halfPelPlanes = (EbHalfPelPlanes_t*)EB_NULL;
+    paReferenceObject->blockHashIndexWrapperPtr = (EbObjectWrapper_t*)EB_NULL;
+    paReferenceObject->blockHashIndex = (EbBlockHashIndex_t*)EB_NULL;
+    paReferenceObject->meUserCount = 0;
+    EB_CREATEMUTEX(EB_HANDLE, paReferenceObject->meBuffersMutex, sizeof(EB_HANDLE), EB_MUTEX);
     
     return EB_ErrorNone;
 }
 
+/*****************************************
+ * EbHalfPelPlanesCtor
+ *  Half-pel planes of a padded luma picture
+ *  described by the init data.
+ *****************************************/
+EB_ERRORTYPE EbHalfPelPlanesCtor(
+    EB_PTR  *objectDblPtr, 
+    EB_PTR   objectInitDataPtr)
+{
+    EbHalfPelPlanes_t                   *halfPelPlanes;
+    EbPictureBufferDescInitData_t       *pictureBufferDescInitDataPtr   = (EbPictureBufferDescInitData_t*) objectInitDataPtr;
+    EB_U32                               planeStride                    = pictureBufferDescInitDataPtr->maxWidth + pictureBufferDescInitDataPtr->leftPadding + pictureBufferDescInitDataPtr->rightPadding;
+    EB_U32                               bandIndex;
+
+    EB_MALLOC(EbHalfPelPlanes_t*, halfPelPlanes, sizeof(EbHalfPelPlanes_t), EB_N_PTR);
+    *objectDblPtr = (EB_PTR) halfPelPlanes;
+
+    halfPelPlanes->planeHeight = pictureBufferDescInitDataPtr->maxHeight + pictureBufferDescInitDataPtr->topPadding + pictureBufferDescInitDataPtr->botPadding;
+    halfPelPlanes->bandCount = (halfPelPlanes->planeHeight + MAX_LCU_SIZE - 1) / MAX_LCU_SIZE;
+
+    EB_MALLOC(EB_BYTE, halfPelPlanes->posbPlane, sizeof(EB_U8) * planeStride * halfPelPlanes->planeHeight, EB_N_PTR);
+    EB_MALLOC(EB_BYTE, halfPelPlanes->poshPlane, sizeof(EB_U8) * planeStride * halfPelPlanes->planeHeight, EB_N_PTR);
+    EB_MALLOC(EB_BYTE, halfPelPlanes->posjPlane, sizeof(EB_U8) * planeStride * halfPelPlanes->planeHeight, EB_N_PTR);
+    EB_MALLOC(EB_BOOL*, halfPelPlanes->posbBandReady, sizeof(EB_BOOL) * halfPelPlanes->bandCount, EB_N_PTR);
+    EB_MALLOC(EB_BOOL*, halfPelPlanes->halfPelBandReady, sizeof(EB_BOOL) * halfPelPlanes->bandCount, EB_N_PTR);
+    EB_MALLOC(EB_HANDLE*, halfPelPlanes->posbBandMutex, sizeof(EB_HANDLE) * halfPelPlanes->bandCount, EB_N_PTR);
+    EB_MALLOC(EB_HANDLE*, halfPelPlanes->halfPelBandMutex, sizeof(EB_HANDLE) * halfPelPlanes->bandCount, EB_N_PTR);
+
+    for (bandIndex = 0; bandIndex < halfPelPlanes->bandCount; ++bandIndex) {
+        EB_CREATEMUTEX(EB_HANDLE, halfPelPlanes->posbBandMutex[bandIndex], sizeof(EB_HANDLE), EB_MUTEX);
+        EB_CREATEMUTEX(EB_HANDLE, halfPelPlanes->halfPelBandMutex[bandIndex], sizeof(EB_HANDLE), EB_MUTEX);
+    }
+
+    return EB_ErrorNone;
+}
+
+/*****************************************
+ * EbBlockHashIndexCtor
+ *  Block hash index of a padded luma picture
+ *  described by the init data.
+ *****************************************/
+EB_ERRORTYPE EbBlockHashIndexCtor(
+    EB_PTR  *objectDblPtr, 
+    EB_PTR   objectInitDataPtr)
+{
+    EbBlockHashIndex_t                  *blockHashIndex;
+    EbPictureBufferDescInitData_t       *pictureBufferDescInitDataPtr   = (EbPictureBufferDescInitData_t*) objectInitDataPtr;
+    EB_U32                               positionCount                  = pictureBufferDescInitDataPtr->maxWidth * pictureBufferDescInitDataPtr->maxHeight;
+
+    EB_MALLOC(EbBlockHashIndex_t*, blockHashIndex, sizeof(EbBlockHashIndex_t), EB_N_PTR);
+    *objectDblPtr = (EB_PTR) blockHashIndex;
+
+    EB_MALLOC(EB_U32*, blockHashIndex->blockHash, sizeof(EB_U32) * positionCount, EB_N_PTR);
+    EB_MALLOC(EB_U32*, blockHashIndex->hashBucketHead, sizeof(EB_U32) * (1 << BLOCK_HASH_BUCKET_BITS), EB_N_PTR);
+    EB_MALLOC(EB_U32*, blockHashIndex->hashPositionNext, sizeof(EB_U32) * positionCount, EB_N_PTR);
+    blockHashIndex->built = EB_FALSE;
+    EB_CREATEMUTEX(EB_HANDLE, blockHashIndex->buildMutex, sizeof(EB_HANDLE), EB_MUTEX);
+
+    return EB_ErrorNone;
+}
+
+/*****************************************
+ * EbPaReferenceAcquireMeBuffers
+ *  Counts one more picture searching the
+ *  reference, taking empty half-pel planes
+ *  and block hash index (when the pool is
+ *  given) from the pools for the first one.
+ *****************************************/
+void EbPaReferenceAcquireMeBuffers(
+    EbPaReferenceObject_t *paReferenceObject,
+    EbFifo_t              *halfPelPlanesPoolFifoPtr,
+    EbFifo_t              *blockHashIndexPoolFifoPtr)
+{
+    EbBlockOnMutex(paReferenceObject->meBuffersMutex);
+
+    if (paReferenceObject->meUserCount == 0) {
+        EbHalfPelPlanes_t *halfPelPlanes;
+
+        EbGetEmptyObject(
+            halfPelPlanesPoolFifoPtr,
+            &paReferenceObject->halfPelPlanesWrapperPtr);
 
+        // The planes still hold the previous reference
+        halfPelPlanes = (EbHalfPelPlanes_t*)paReferenceObject->halfPelPlanesWrapperPtr->objectPtr;
+        EB_MEMSET(halfPelPlanes->posbBandReady, EB_FALSE, sizeof(EB_BOOL) * halfPelPlanes->bandCount);
+        EB_MEMSET(halfPelPlanes->halfPelBandReady, EB_FALSE, sizeof(EB_BOOL) * halfPelPlanes->bandCount);
+        paReferenceObject->halfPelPlanes = halfPelPlanes;
 
+        if (blockHashIndexPoolFifoPtr) {
+            EbGetEmptyObject(
+                blockHashIndexPoolFifoPtr,
+                &paReferenceObject->blockHashIndexWrapperPtr);
+
+            paReferenceObject->blockHashIndex = (EbBlockHashIndex_t*)paReferenceObject->blockHashIndexWrapperPtr->objectPtr;
+            paReferenceObject->blockHashIndex->built = EB_FALSE;
+        }
+    }
+    ++paReferenceObject->meUserCount;
+
+    EbReleaseMutex(paReferenceObject->meBuffersMutex);
+
+    return;
+}
+
+/*****************************************
+ * EbPaReferenceReleaseMeBuffers
+ *  Counts one picture done searching the
+ *  reference, giving the half-pel planes and
+ *  block hash index back to the pools after
+ *  the last one.
+ *****************************************/
+void EbPaReferenceReleaseMeBuffers(
+    EbPaReferenceObject_t *paReferenceObject)
+{
+    EbBlockOnMutex(paReferenceObject->meBuffersMutex);
+
+    if (--paReferenceObject->meUserCount == 0) {
+        EbReleaseObject(paReferenceObject->halfPelPlanesWrapperPtr);
+        paReferenceObject->halfPelPlanesWrapperPtr = (EbObjectWrapper_t*)EB_NULL;
+        paReferenceObject->halfPelPlanes = (EbHalfPelPlanes_t*)EB_NULL;
+
+        if (paReferenceObject->blockHashIndexWrapperPtr) {
+            EbReleaseObject(paReferenceObject->blockHashIndexWrapperPtr);
+            paReferenceObject->blockHashIndexWrapperPtr = (EbObjectWrapper_t*)EB_NULL;
+            paReferenceObject->blockHashIndex = (EbBlockHashIndex_t*)EB_NULL;
+        }
+    }
+
+    EbReleaseMutex(paReferenceObject->meBuffersMutex);
+
+    return;
+}
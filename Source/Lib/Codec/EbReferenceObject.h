@@ -8,6 +8,7 @@
 
 #include "EbDefinitions.h"
 #include "EbAdaptiveMotionVectorPrediction.h" 
+#include "EbSystemResourceManager.h"
 
 typedef struct EbReferenceObject_s {
     EbPictureBufferDesc_t          *referencePicture;
@@ -40,6 +41,38 @@ typedef struct EbReferenceObjectDescInitData_s {
     EbPictureBufferDescInitData_t   referencePictureDescInitData;
 } EbReferenceObjectDescInitData_t;
 
+#define BLOCK_HASH_BUCKET_BITS          16
+#define BLOCK_HASH_NO_POSITION          0xFFFFFFFF
+
+// Half-pel planes of a PA reference (AVC-style b, h and j positions), same
+// geometry as the padded luma. Filled on demand one band of MAX_LCU_SIZE rows
+// at a time and shared by all the ME searches of the reference. A band's
+// posb and its h/j have separate locks; h/j lock the posb of the neighbour
+// bands one at a time, so no two searches wait on each other in a cycle.
+typedef struct EbHalfPelPlanes_s {
+    EB_BYTE                         posbPlane;
+    EB_BYTE                         poshPlane;
+    EB_BYTE                         posjPlane;
+    EB_U32                          planeHeight;
+    EB_U32                          bandCount;
+    EB_BOOL                        *posbBandReady;
+    EB_BOOL                        *halfPelBandReady;
+    EB_HANDLE                      *posbBandMutex;
+    EB_HANDLE                      *halfPelBandMutex;
+} EbHalfPelPlanes_t;
+
+// Block hash index of a padded luma picture (hash ME): blockHash[y * width + x]
+// is the hash of the 64x64 block at (x, y), and the positions of each bucket are
+// chained through hashPositionNext (BLOCK_HASH_NO_POSITION ends a chain). Built
+// by the first ME search of the reference that needs it.
+typedef struct EbBlockHashIndex_s {
+    EB_U32                         *blockHash;
+    EB_U32                         *hashBucketHead;
+    EB_U32                         *hashPositionNext;
+    EB_BOOL                         built;
+    EB_HANDLE                       buildMutex;
+} EbBlockHashIndex_t;
+
 typedef struct EbPaReferenceObject_s {
     EbPictureBufferDesc_t          *inputPaddedPicturePtr;
     EbPictureBufferDesc_t          *quarterDecimatedPicturePtr; 
@@ -50,6 +83,18 @@ typedef struct EbPaReferenceObject_s {
 
 	EB_U32 dependentPicturesCount; //number of pic using this reference frame  
     PictureParentControlSet_t       *pPcsPtr;
+
+    // Half-pel planes and block hash index (hash ME only), taken from their pools
+    // while pictures searching this reference are in ME (meUserCount of them)
+    EbObjectWrapper_t              *halfPelPlanesWrapperPtr;
+    EbHalfPelPlanes_t              *halfPelPlanes;
+    EbObjectWrapper_t              *blockHashIndexWrapperPtr;
+    EbBlockHashIndex_t             *blockHashIndex;
+    EB_U32                          meUserCount;
+    EB_HANDLE                       meBuffersMutex;
+
+    // picture number of the first picture of the run of identical input pictures
+    EB_U64                          duplicateRunStart;
 } EbPaReferenceObject_t;
 
 typedef struct EbPaReferenceObjectDescInitData_s {
@@ -69,5 +114,21 @@ extern EB_ERRORTYPE EbPaReferenceObjectCtor(
     EB_PTR *objectDblPtr, 
     EB_PTR objectInitDataPtr);
 
+extern EB_ERRORTYPE EbHalfPelPlanesCtor(
+    EB_PTR *objectDblPtr, 
+    EB_PTR objectInitDataPtr);
+
+extern EB_ERRORTYPE EbBlockHashIndexCtor(
+    EB_PTR *objectDblPtr, 
+    EB_PTR objectInitDataPtr);
+
+extern void EbPaReferenceAcquireMeBuffers(
+    EbPaReferenceObject_t *paReferenceObject,
+    EbFifo_t              *halfPelPlanesPoolFifoPtr,
+    EbFifo_t              *blockHashIndexPoolFifoPtr);
+
+extern void EbPaReferenceReleaseMeBuffers(
+    EbPaReferenceObject_t *paReferenceObject);
+
 
 #endif //EbReferenceObject_h
\ No newline at end of file
@@ -256,6 +256,72 @@ void SpeedBufferControl(
 }
 
 
+/******************************************************
+* Compare Picture Plane
+******************************************************/
+static EB_BOOL ComparePicturePlane(
+    EB_U8   *currentPtr,
+    EB_U8   *previousPtr,
+    EB_U32   stride,
+    EB_U32   width,
+    EB_U32   height)
+{
+    EB_U32 rowIndex;
+
+    for (rowIndex = 0; rowIndex < height; ++rowIndex) {
+        if (memcmp(currentPtr + rowIndex * stride, previousPtr + rowIndex * stride, width)) {
+            return EB_FALSE;
+        }
+    }
+
+    return EB_TRUE;
+}
+
+/******************************************************
+* Detect Duplicate Picture
+*   the input picture is identical to the previous one
+*   (first differing row ends the comparison); the
+*   pictures of a run of duplicates share the picture
+*   number of the first picture of the run
+******************************************************/
+static void DetectDuplicatePicture(
+    SequenceControlSet_t        *sequenceControlSetPtr,
+    PictureParentControlSet_t   *pictureControlSetPtr,
+    PictureParentControlSet_t   *previousPictureControlSetPtr,
+    EB_U32                       subWidthCMinus1,
+    EB_U32                       subHeightCMinus1)
+{
+    EbPictureBufferDesc_t *currentPicturePtr = pictureControlSetPtr->enhancedPicturePtr;
+    EbPictureBufferDesc_t *previousPicturePtr = previousPictureControlSetPtr->enhancedPicturePtr;
+    EB_BOOL  is16BitInput = (EB_BOOL)(sequenceControlSetPtr->staticConfig.encoderBitDepth > EB_8BIT);
+    EB_U32   lumaWidth = currentPicturePtr->width - sequenceControlSetPtr->maxInputPadRight;
+    EB_U32   lumaHeight = currentPicturePtr->height - sequenceControlSetPtr->maxInputPadBottom;
+    EB_U32   lumaOffset = currentPicturePtr->strideY * currentPicturePtr->originY + currentPicturePtr->originX;
+    EB_U32   chromaOffset = currentPicturePtr->strideCb * (currentPicturePtr->originY >> subHeightCMinus1) + (currentPicturePtr->originX >> subWidthCMinus1);
+    EB_BOOL  duplicateFlag;
+
+    duplicateFlag = (previousPictureControlSetPtr != pictureControlSetPtr &&
+        // The 2-bit planes of the compressed 10-bit format are not checked
+        !(is16BitInput && sequenceControlSetPtr->staticConfig.compressedTenBitFormat)) ? EB_TRUE : EB_FALSE;
+
+    duplicateFlag = duplicateFlag &&
+        ComparePicturePlane(currentPicturePtr->bufferY + lumaOffset, previousPicturePtr->bufferY + lumaOffset, currentPicturePtr->strideY, lumaWidth, lumaHeight) &&
+        ComparePicturePlane(currentPicturePtr->bufferCb + chromaOffset, previousPicturePtr->bufferCb + chromaOffset, currentPicturePtr->strideCb, lumaWidth >> subWidthCMinus1, lumaHeight >> subHeightCMinus1) &&
+        ComparePicturePlane(currentPicturePtr->bufferCr + chromaOffset, previousPicturePtr->bufferCr + chromaOffset, currentPicturePtr->strideCr, lumaWidth >> subWidthCMinus1, lumaHeight >> subHeightCMinus1);
+
+    if (duplicateFlag && is16BitInput) {
+        duplicateFlag =
+            ComparePicturePlane(currentPicturePtr->bufferBitIncY + lumaOffset, previousPicturePtr->bufferBitIncY + lumaOffset, currentPicturePtr->strideBitIncY, lumaWidth, lumaHeight) &&
+            ComparePicturePlane(currentPicturePtr->bufferBitIncCb + chromaOffset, previousPicturePtr->bufferBitIncCb + chromaOffset, currentPicturePtr->strideBitIncCb, lumaWidth >> subWidthCMinus1, lumaHeight >> subHeightCMinus1) &&
+            ComparePicturePlane(currentPicturePtr->bufferBitIncCr + chromaOffset, previousPicturePtr->bufferBitIncCr + chromaOffset, currentPicturePtr->strideBitIncCr, lumaWidth >> subWidthCMinus1, lumaHeight >> subHeightCMinus1);
+    }
+
+    pictureControlSetPtr->duplicatePictureFlag = duplicateFlag;
+    pictureControlSetPtr->duplicateRunStart = duplicateFlag ?
+        previousPictureControlSetPtr->duplicateRunStart :
+        pictureControlSetPtr->pictureNumber;
+}
+
 /******************************************************
 * Derive Pre-Analysis settings for SQ
 Input   : encoder mode and tune
@@ -690,6 +756,16 @@ void* ResourceCoordinationKernel(void *inputPtr)
 
         // Picture Stats
         pictureControlSetPtr->pictureNumber                   = contextPtr->pictureNumberArray[instanceIndex]++;
+        pictureControlSetPtr->qualityMetricsFlag              = (sequenceControlSetPtr->staticConfig.qualityMetricsInterval &&
+            (pictureControlSetPtr->pictureNumber % sequenceControlSetPtr->staticConfig.qualityMetricsInterval) == 0) ? EB_TRUE : EB_FALSE;
+
+        // Duplicate Picture Detection (the previous picture is not posted yet: its input is untouched)
+        DetectDuplicatePicture(
+            sequenceControlSetPtr,
+            pictureControlSetPtr,
+            (PictureParentControlSet_t*)pictureControlSetPtr->previousPictureControlSetWrapperPtr->objectPtr,
+            subWidthCMinus1,
+            subHeightCMinus1);
 
 #if DEADLOCK_DEBUG
         SVT_LOG("POC %lld RESCOOR IN \n", pictureControlSetPtr->pictureNumber);
@@ -721,6 +797,7 @@ void* ResourceCoordinationKernel(void *inputPtr)
             2);
 
         ((EbPaReferenceObject_t*)pictureControlSetPtr->paReferencePictureWrapperPtr->objectPtr)->inputPaddedPicturePtr->bufferY = inputPicturePtr->bufferY;
+        ((EbPaReferenceObject_t*)pictureControlSetPtr->paReferencePictureWrapperPtr->objectPtr)->duplicateRunStart = pictureControlSetPtr->duplicateRunStart;
 
         // Get Empty Output Results Object
         if (pictureControlSetPtr->pictureNumber > 0)
@@ -0,0 +1,1967 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EbRtcd.h"
+
+/**************************************************
+* Picture operators
+**************************************************/
+static const EB_SUM_RES SumResidual_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+	// C_DEFAULT
+	sumResidual,
+	// AVX2
+	sumResidual8bit_AVX2_INTRIN,
+};
+
+static const EB_MEMSET16bitBLK memset16bitBlock_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+	// C_DEFAULT
+	memset16bitBlock,
+	// AVX2
+	memset16bitBlock_AVX2_INTRIN,
+};
+
+static const EB_ADDDKERNEL_TYPE AdditionKernel_funcPtrArray[EB_ASM_TYPE_TOTAL][9] = {
+        // C_DEFAULT
+        {
+            /*0 4x4   */    PictureAdditionKernel,
+            /*1 8x8   */    PictureAdditionKernel,
+            /*2 16x16 */    PictureAdditionKernel,
+            /*3       */    (EB_ADDDKERNEL_TYPE)PictureAdditionVoidFunc,
+            /*4 32x32 */    PictureAdditionKernel,
+            /*5       */    (EB_ADDDKERNEL_TYPE)PictureAdditionVoidFunc,
+            /*6       */    (EB_ADDDKERNEL_TYPE)PictureAdditionVoidFunc,
+            /*7       */    (EB_ADDDKERNEL_TYPE)PictureAdditionVoidFunc,
+            /*8 64x64 */    PictureAdditionKernel
+        },
+        // AVX2
+        {
+			/*0 4x4   */    PictureAdditionKernel4x4_SSE_INTRIN,
+			/*1 8x8   */    PictureAdditionKernel8x8_SSE2_INTRIN,
+			/*2 16x16 */    PictureAdditionKernel16x16_SSE2_INTRIN,
+            /*3       */    (EB_ADDDKERNEL_TYPE)PictureAdditionVoidFunc,
+			/*4 32x32 */    PictureAdditionKernel32x32_SSE2_INTRIN,
+            /*5       */    (EB_ADDDKERNEL_TYPE)PictureAdditionVoidFunc,
+            /*6       */    (EB_ADDDKERNEL_TYPE)PictureAdditionVoidFunc,
+            /*7       */    (EB_ADDDKERNEL_TYPE)PictureAdditionVoidFunc,
+			/*8 64x64 */    PictureAdditionKernel64x64_SSE2_INTRIN,
+        },
+};
+
+static const EB_ADDDKERNEL_TYPE_16BIT AdditionKernel_funcPtrArray16bit[EB_ASM_TYPE_TOTAL] = {
+	// C_DEFAULT
+    PictureAdditionKernel16bit,
+	// AVX2
+	PictureAdditionKernel16bit_SSE2_INTRIN,
+};
+
+static const EB_PICCOPY_TYPE PicCopyKernel_funcPtrArray[EB_ASM_TYPE_TOTAL][9] = {
+        // C_DEFAULT
+        {
+            /*0 4x4   */     CopyKernel8Bit,
+            /*1 8x8   */     CopyKernel8Bit,
+            /*2 16x16 */     CopyKernel8Bit,
+            /*3       */     (EB_PICCOPY_TYPE)PicCopyVoidFunc,
+            /*4 32x32 */     CopyKernel8Bit,
+            /*5       */     (EB_PICCOPY_TYPE)PicCopyVoidFunc,
+            /*6       */     (EB_PICCOPY_TYPE)PicCopyVoidFunc,
+            /*7       */     (EB_PICCOPY_TYPE)PicCopyVoidFunc,
+            /*8 64x64 */     CopyKernel8Bit
+        },
+        // AVX2
+        {
+			/*0 4x4   */     PictureCopyKernel4x4_SSE_INTRIN,
+			/*1 8x8   */     PictureCopyKernel8x8_SSE2_INTRIN,
+			/*2 16x16 */     PictureCopyKernel16x16_SSE2_INTRIN,
+            /*3       */     (EB_PICCOPY_TYPE)PicCopyVoidFunc,
+			/*4 32x32 */     PictureCopyKernel32x32_SSE2_INTRIN,
+            /*5       */     (EB_PICCOPY_TYPE)PicCopyVoidFunc,
+            /*6       */     (EB_PICCOPY_TYPE)PicCopyVoidFunc,
+            /*7       */     (EB_PICCOPY_TYPE)PicCopyVoidFunc,
+			/*8 64x64 */     PictureCopyKernel64x64_SSE2_INTRIN,
+        },
+};
+
+static const EB_RESDKERNELSUBSAMPLED_TYPE ResidualKernelSubSampled_funcPtrArray[EB_ASM_TYPE_TOTAL][9] = {
+	// C_DEFAULT
+	{
+		/*0 4x4  */     ResidualKernelSubSampled,
+		/*1 8x8  */     ResidualKernelSubSampled,
+		/*2 16x16 */    ResidualKernelSubSampled,
+		/*3  */         (EB_RESDKERNELSUBSAMPLED_TYPE)PicResdVoidFunc,
+		/*4 32x32 */    ResidualKernelSubSampled,
+		/*5      */     (EB_RESDKERNELSUBSAMPLED_TYPE)PicResdVoidFunc,
+		/*6  */         (EB_RESDKERNELSUBSAMPLED_TYPE)PicResdVoidFunc,
+		/*7      */     (EB_RESDKERNELSUBSAMPLED_TYPE)PicResdVoidFunc,
+		/*8 64x64 */    ResidualKernelSubSampled
+	},
+	// AVX2
+	{
+		/*0 4x4  */     ResidualKernelSubSampled4x4_SSE_INTRIN,
+		/*1 8x8  */     ResidualKernelSubSampled8x8_SSE2_INTRIN,
+		/*2 16x16 */    ResidualKernelSubSampled16x16_SSE2_INTRIN,
+		/*3  */         (EB_RESDKERNELSUBSAMPLED_TYPE)PicResdVoidFunc,
+		/*4 32x32 */    ResidualKernelSubSampled32x32_SSE2_INTRIN,
+		/*5      */     (EB_RESDKERNELSUBSAMPLED_TYPE)PicResdVoidFunc,
+		/*6  */         (EB_RESDKERNELSUBSAMPLED_TYPE)PicResdVoidFunc,
+		/*7      */     (EB_RESDKERNELSUBSAMPLED_TYPE)PicResdVoidFunc,
+		/*8 64x64 */    ResidualKernelSubSampled64x64_SSE2_INTRIN,
+	},
+};
+
+static const EB_RESDKERNEL_TYPE ResidualKernel_funcPtrArray[EB_ASM_TYPE_TOTAL][9] = {
+	// C_DEFAULT
+	{
+        /*0 4x4  */     ResidualKernel,
+        /*1 8x8  */     ResidualKernel,
+        /*2 16x16 */    ResidualKernel,
+        /*3  */         (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+        /*4 32x32 */    ResidualKernel,
+        /*5      */     (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+        /*6  */         (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+        /*7      */     (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+        /*8 64x64 */    ResidualKernel
+	},
+	// AVX2
+	{
+		/*0 4x4  */     ResidualKernel4x4_SSE_INTRIN,
+		/*1 8x8  */     ResidualKernel8x8_SSE2_INTRIN,
+		/*2 16x16 */    ResidualKernel16x16_SSE2_INTRIN,
+		/*3  */         (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+		/*4 32x32 */    ResidualKernel32x32_SSE2_INTRIN,
+		/*5      */     (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+		/*6  */         (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+		/*7      */     (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+		/*8 64x64 */    ResidualKernel64x64_SSE2_INTRIN,
+	},
+};
+
+static const EB_RESDKERNEL_TYPE ResidualKernel_Avx512[9] = {
+    /*0 4x4  */     ResidualKernel4x4_SSE_INTRIN,
+    /*1 8x8  */     ResidualKernel8x8_SSE2_INTRIN,
+    /*2 16x16 */    ResidualKernel16x16_SSE2_INTRIN,
+    /*3  */         (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+    /*4 32x32 */    ResidualKernel32x32_AVX512_INTRIN,
+    /*5      */     (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+    /*6  */         (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+    /*7      */     (EB_RESDKERNEL_TYPE)PicResdVoidFunc,
+    /*8 64x64 */    ResidualKernel64x64_AVX512_INTRIN
+};
+
+static const EB_RESDKERNEL_TYPE_16BIT ResidualKernel_funcPtrArray16Bit[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT     
+    ResidualKernel16bit,
+    // AVX2     
+    ResidualKernel16bit_SSE2_INTRIN
+};
+
+static const EB_ZEROCOEFF_TYPE PicZeroOutCoef_funcPtrArray[EB_ASM_TYPE_TOTAL][5] = {
+        // C_DEFAULT
+        {
+            /*0 4x4   */     ZeroOutCoeffKernel,
+            /*1 8x8   */     ZeroOutCoeffKernel,
+            /*2 16x16 */     ZeroOutCoeffKernel,
+            /*3       */     (EB_ZEROCOEFF_TYPE)PicZeroOutCoefVoidFunc,
+            /*4 32x32 */     ZeroOutCoeffKernel
+        },
+        // AVX2
+        {
+            /*0 4x4   */     ZeroOutCoeff4x4_SSE,
+            /*1 8x8   */     ZeroOutCoeff8x8_SSE2,
+            /*2 16x16 */     ZeroOutCoeff16x16_SSE2,
+            /*3       */     (EB_ZEROCOEFF_TYPE)PicZeroOutCoefVoidFunc,
+            /*4 32x32 */     ZeroOutCoeff32x32_SSE2
+        },
+};
+
+static const EB_FULLDIST_TYPE FullDistortionIntrinsic_funcPtrArray[EB_ASM_TYPE_TOTAL][2][2][9] = {     
+    // C_DEFAULT
+    // It was found that the SSE2 intrinsic code is much faster (~2x) than the SSE4.1 code
+    {
+        {
+            {
+                /*0 4x4   */    FullDistortionKernelCbfZero_32bit,
+                /*1 8x8   */    FullDistortionKernelCbfZero_32bit,
+                /*2 16x16 */    FullDistortionKernelCbfZero_32bit,
+                /*3       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*4 32x32 */    FullDistortionKernelCbfZero_32bit,
+                /*5       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*6       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*7       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*8 64x64 */    FullDistortionKernelCbfZero_32bit,
+            },
+            {
+                /*0 4x4   */    FullDistortionKernelCbfZero_32bit,
+                /*1 8x8   */    FullDistortionKernelCbfZero_32bit,
+                /*2 16x16 */    FullDistortionKernelCbfZero_32bit,
+                /*3       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*4 32x32 */    FullDistortionKernelCbfZero_32bit,
+                /*5       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*6       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*7       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*8 64x64 */    FullDistortionKernelCbfZero_32bit,
+            }
+        },
+        {
+            {
+                /*0 4x4   */    FullDistortionKernel_32bit,
+                /*1 8x8   */    FullDistortionKernel_32bit,
+                /*2 16x16 */    FullDistortionKernel_32bit,
+                /*3       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*4 32x32 */    FullDistortionKernel_32bit,
+                /*5       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*6       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*7       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*8 64x64 */    FullDistortionKernel_32bit,
+            },
+            {
+                /*0 4x4   */    FullDistortionKernelIntra_32bit,
+                /*1 8x8   */    FullDistortionKernelIntra_32bit,
+                /*2 16x16 */    FullDistortionKernelIntra_32bit,
+                /*3       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*4 32x32 */    FullDistortionKernelIntra_32bit,
+                /*5       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*6       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*7       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*8 64x64 */    FullDistortionKernelIntra_32bit,
+            }
+
+        }
+    },    
+    // AVX2
+    // It was found that the SSE2 intrinsic code is much faster (~2x) than the SSE4.1 code
+    {
+        {
+            {
+                /*0 4x4   */    FullDistortionKernelCbfZero4x4_32bit_BT_SSE2,
+                /*1 8x8   */    FullDistortionKernelCbfZero8x8_32bit_BT_SSE2,
+                /*2 16x16 */    FullDistortionKernelCbfZero16MxN_32bit_BT_SSE2,
+                /*3       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*4 32x32 */    FullDistortionKernelCbfZero16MxN_32bit_BT_SSE2,
+                /*5       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*6       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*7       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*8 64x64 */    FullDistortionKernelCbfZero16MxN_32bit_BT_SSE2,
+            },
+            {
+                /*0 4x4   */    FullDistortionKernelCbfZero4x4_32bit_BT_SSE2,
+                /*1 8x8   */    FullDistortionKernelCbfZero8x8_32bit_BT_SSE2,
+                /*2 16x16 */    FullDistortionKernelCbfZero16MxN_32bit_BT_SSE2,
+                /*3       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*4 32x32 */    FullDistortionKernelCbfZero16MxN_32bit_BT_SSE2,
+                /*5       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*6       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*7       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*8 64x64 */    FullDistortionKernelCbfZero16MxN_32bit_BT_SSE2,
+            }
+        },
+        {
+            {
+                /*0 4x4   */    FullDistortionKernel4x4_32bit_BT_SSE2,
+                /*1 8x8   */    FullDistortionKernel8x8_32bit_BT_SSE2,
+                /*2 16x16 */    FullDistortionKernel16MxN_32bit_BT_SSE2,
+                /*3       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*4 32x32 */    FullDistortionKernel16MxN_32bit_BT_SSE2,
+                /*5       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*6       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*7       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*8 64x64 */    FullDistortionKernel16MxN_32bit_BT_SSE2,
+            },
+            {
+                /*0 4x4   */    FullDistortionKernelIntra4x4_32bit_BT_SSE2,
+                /*1 8x8   */    FullDistortionKernelIntra8x8_32bit_BT_SSE2,
+                /*2 16x16 */    FullDistortionKernelIntra16MxN_32bit_BT_SSE2,
+                /*3       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*4 32x32 */    FullDistortionKernelIntra16MxN_32bit_BT_SSE2,
+                /*5       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*6       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*7       */    (EB_FULLDIST_TYPE)FullDistortionVoidFunc,
+                /*8 64x64 */    FullDistortionKernelIntra16MxN_32bit_BT_SSE2,
+            }
+        }
+    },   
+};
+
+static const EB_SATD_TYPE Compute8x8Satd_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    Compute8x8Satd,
+    // ASM_AVX2
+    Compute8x8Satd_SSE4
+};
+
+static const EB_SATD_U8_TYPE Compute8x8Satd_U8_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+	// C_DEFAULT
+    Compute8x8Satd_U8,
+	// ASM_AVX2
+	Compute8x8Satd_U8_SSE4
+};
+
+static const EB_SATD_TYPE Compute8x8Satd_Avx2[1] = {
+    Compute8x8Satd_AVX2_INTRIN
+};
+
+static const EB_SATD_U8_TYPE Compute8x8Satd_U8_Avx2[1] = {
+    Compute8x8Satd_U8_AVX2_INTRIN
+};
+
+static const EB_SATD_U8_TYPE Compute16x16Satd_U8_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    Compute16x16Satd_U8,
+    // AVX2
+    Compute16x16Satd_U8_AVX2_INTRIN
+};
+
+static const EB_SATD_U8_TYPE Compute16x16Satd_U8_Avx512[1] = {
+    Compute16x16Satd_U8_AVX512_INTRIN
+};
+
+static const EB_DECIMAVG_TYPE DecimateAverage_funcPtrArray[EB_ASM_TYPE_TOTAL][2] = {
+    // C_DEFAULT
+    {
+        // 2x2
+        PictureDecimateAverage2x2Kernel,
+        // 4x4
+        PictureDecimateAverage4x4Kernel
+    },
+    // ASM_AVX2
+    {
+        // 2x2
+        PictureDecimateAverage2x2Kernel_AVX2_INTRIN,
+        // 4x4
+        PictureDecimateAverage4x4Kernel_AVX2_INTRIN
+    },
+};
+
+static const EB_DECIMAVG_TYPE_16BIT DecimateAverage16bit_funcPtrArray[EB_ASM_TYPE_TOTAL][2] = {
+    // C_DEFAULT
+    {
+        // 2x2
+        PictureDecimateAverage2x2Kernel16bit,
+        // 4x4
+        PictureDecimateAverage4x4Kernel16bit
+    },
+    // ASM_AVX2
+    {
+        // 2x2
+        PictureDecimateAverage2x2Kernel16bit_AVX2_INTRIN,
+        // 4x4
+        PictureDecimateAverage4x4Kernel16bit_AVX2_INTRIN
+    },
+};
+
+static const EB_SPATIALFULLDIST_TYPE SpatialFullDistortionKernel_funcPtrArray[EB_ASM_TYPE_TOTAL][5] = {
+    // C_DEFAULT
+    {
+        // 4x4
+        SpatialFullDistortionKernel,
+        // 8x8
+        SpatialFullDistortionKernel,
+        // 16x16
+        SpatialFullDistortionKernel,
+        // 32x32
+        SpatialFullDistortionKernel,
+        // 64x64
+        SpatialFullDistortionKernel
+    },
+    // ASM_AVX2
+    {
+        // 4x4
+        SpatialFullDistortionKernel4x4_SSSE3_INTRIN,
+        // 8x8
+        SpatialFullDistortionKernel8x8_SSSE3_INTRIN,
+        // 16x16
+        SpatialFullDistortionKernel16MxN_SSSE3_INTRIN,
+        // 32x32
+        SpatialFullDistortionKernel16MxN_SSSE3_INTRIN,
+        // 64x64
+        SpatialFullDistortionKernel16MxN_SSSE3_INTRIN
+    },
+};
+
+static const EB_SPATIALFULLDIST_TYPE SpatialFullDistortionKernel_Avx512[5] = {
+    // 4x4
+    SpatialFullDistortionKernel4x4_SSSE3_INTRIN,
+    // 8x8
+    SpatialFullDistortionKernel8x8_SSSE3_INTRIN,
+    // 16x16
+    SpatialFullDistortionKernel16MxN_SSSE3_INTRIN,
+    // 32x32
+    SpatialFullDistortionKernel16MxN_AVX512_INTRIN,
+    // 64x64
+    SpatialFullDistortionKernel16MxN_AVX512_INTRIN
+};
+
+static const EB_SPATIALFULLDIST_TYPE PictureSse_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    SpatialFullDistortionKernel,
+    // ASM_AVX2
+    SpatialFullDistortionKernel_AVX2_INTRIN
+};
+
+static const EB_SPATIALFULLDIST16BIT_TYPE PictureSse16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    SpatialFullDistortionKernel16bit,
+    // ASM_AVX2
+    SpatialFullDistortionKernel16bit_AVX2_INTRIN
+};
+
+static const EB_SSIMBLOCKSUMS_TYPE SsimBlockSums_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    SsimBlockSums4x4Kernel,
+    // ASM_AVX2
+    SsimBlockSums4x4Kernel_AVX2_INTRIN
+};
+
+static const EB_SSIMBLOCKSUMS16BIT_TYPE SsimBlockSums16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    SsimBlockSums4x4Kernel16bit,
+    // ASM_AVX2
+    SsimBlockSums4x4Kernel16bit_AVX2_INTRIN
+};
+
+static const EB_BLOCKHASH_TYPE BlockHash64x64_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    BlockHash64x64Kernel,
+    // ASM_AVX2
+    BlockHash64x64Kernel_AVX2_INTRIN
+};
+
+/**************************************************
+* Pack / unpack
+**************************************************/
+static const EB_ENC_Pack2D_TYPE Pack2D_funcPtrArray_16Bit_SRC[EB_ASM_TYPE_TOTAL][2] =
+{
+    // C_DEFAULT
+    {
+        EB_ENC_msbPack2D,
+        EB_ENC_msbPack2D,
+    },
+    // AVX2
+    {
+        EB_ENC_msbPack2D,
+        EB_ENC_msbPack2D_AVX2_INTRIN_AL,//EB_ENC_msbPack2D_AVX2
+    }
+};
+
+static const EB_ENC_Pack2D_TYPE CompressedPack_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+	// C_DEFAULT
+	CompressedPackmsb,
+	// AVX2
+	CompressedPackmsb_AVX2_INTRIN,
+};
+
+static const COMPPack_TYPE Convert_Unpack_CPack_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+	// C_DEFAULT
+	CPack_C,
+	// AVX2
+	CPack_AVX2_INTRIN,
+
+};
+
+static const EB_ENC_UnPack2D_TYPE UnPack2D_funcPtrArray_16Bit[EB_ASM_TYPE_TOTAL][2] =
+{
+    // C_DEFAULT
+    {
+        EB_ENC_msbUnPack2D,
+        EB_ENC_msbUnPack2D,
+    },
+    // AVX512
+    {
+        EB_ENC_msbUnPack2D,
+        EB_ENC_msbUnPack2D_AVX512_INTRIN,
+    }
+};
+
+static const EB_ENC_UnpackAvg_TYPE UnPackAvg_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+        // C_DEFAULT
+		UnpackAvg,
+        // AVX2
+		UnpackAvg_AVX2_INTRIN,//UnpackAvg_SSE2_INTRIN,
+    
+};
+
+static const EB_ENC_UnpackAvgSub_TYPE UnPackAvgSafeSub_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+        // C_DEFAULT
+		UnpackAvgSafeSub,
+        // AVX2  SafeSub
+		UnpackAvgSafeSub_AVX2_INTRIN
+   
+};
+
+static const EB_ENC_UnPack8BitData_TYPE UnPack8BIT_funcPtrArray_16Bit[EB_ASM_TYPE_TOTAL][2] =
+{
+    // C_DEFAULT
+    {
+        UnPack8BitData,
+        UnPack8BitData,
+    },
+    // AVX2
+    {
+        UnPack8BitData,
+        EB_ENC_UnPack8BitData_SSE2_INTRIN,
+    }
+};
+
+static const EB_ENC_UnPack8BitDataSUB_TYPE UnPack8BITSafeSub_funcPtrArray_16Bit[EB_ASM_TYPE_TOTAL] =
+{
+        // C_DEFAULT           
+		UnPack8BitDataSafeSub,
+        // SSE2
+		EB_ENC_UnPack8BitDataSafeSub_SSE2_INTRIN
+};
+
+/**************************************************
+* SAD
+**************************************************/
+static const EB_SADKERNELNxM_TYPE NxMSadKernel_funcPtrArray[EB_ASM_TYPE_TOTAL][9] =   // [ASM_TYPES][SAD - block height]
+{
+    // C_DEFAULT
+    {
+        /*0 4xM  */ FastLoop_NxMSadKernel,
+        /*1 8xM  */ FastLoop_NxMSadKernel,
+        /*2 16xM */ FastLoop_NxMSadKernel,
+        /*3 24xM */ FastLoop_NxMSadKernel,
+        /*4 32xM */ FastLoop_NxMSadKernel,
+        /*5      */ FastLoop_NxMSadKernel,
+        /*6 48xM */ FastLoop_NxMSadKernel,
+        /*7      */ FastLoop_NxMSadKernel,
+        /*8 64xM */ FastLoop_NxMSadKernel
+    },
+    // AVX2
+    {
+        /*0 4xM  */ Compute4xMSad_SSE2_INTRIN,
+        /*1 8xM  */ Compute8xMSad_SSE2_INTRIN,
+        /*2 16xM */	Compute16xMSad_SSE2_INTRIN,//Compute16xMSad_AVX2_INTRIN is slower than the SSE2 version
+        /*3 24xM */	Compute24xMSad_AVX2_INTRIN,
+        /*4 32xM */	Compute32xMSad_AVX2_INTRIN,
+        /*5      */ (EB_SADKERNELNxM_TYPE)NxMSadKernelVoidFunc,
+        /*6 48xM */	Compute48xMSad_AVX2_INTRIN,
+        /*7      */ (EB_SADKERNELNxM_TYPE)NxMSadKernelVoidFunc,
+        /*8 64xM */ Compute64xMSad_AVX2_INTRIN,
+    },
+};
+
+static const EB_SADAVGKERNELNxM_TYPE NxMSadAveragingKernel_funcPtrArray[EB_ASM_TYPE_TOTAL][9] =   // [ASM_TYPES][SAD - block height]
+{
+    // C_DEFAULT
+    {
+        /*0 4xM  */     CombinedAveragingSAD,
+        /*1 8xM  */     CombinedAveragingSAD,
+        /*2 16xM */     CombinedAveragingSAD,
+        /*3 24xM */     CombinedAveragingSAD,
+        /*4 32xM */     CombinedAveragingSAD,
+        /*5      */     (EB_SADAVGKERNELNxM_TYPE)NxMSadKernelVoidFunc,
+        /*6 48xM */     CombinedAveragingSAD,
+        /*7      */     (EB_SADAVGKERNELNxM_TYPE)NxMSadKernelVoidFunc,
+        /*8 64xM */     CombinedAveragingSAD
+    },
+    // AVX2
+    {
+        /*0 4xM  */     CombinedAveraging4xMSAD_SSE2_INTRIN,
+        /*1 8xM  */     CombinedAveraging8xMSAD_SSE2_INTRIN,
+        /*2 16xM */     CombinedAveraging16xMSAD_SSE2_INTRIN,
+        /*3 24xM */     CombinedAveraging24xMSAD_SSE2_INTRIN,
+        /*4 32xM */     CombinedAveraging32xMSAD_SSE2_INTRIN,
+        /*5      */     (EB_SADAVGKERNELNxM_TYPE)NxMSadKernelVoidFunc,
+        /*6 48xM */     CombinedAveraging48xMSAD_SSE2_INTRIN,
+        /*7      */     (EB_SADAVGKERNELNxM_TYPE)NxMSadKernelVoidFunc,
+        /*8 64xM */     CombinedAveraging64xMSAD_SSE2_INTRIN
+    },
+};
+
+static const EB_SADLOOPKERNELNxM_TYPE NxMSadLoopKernel_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+    // C_DEFAULT
+    SadLoopKernel,
+    // AVX2
+    SadLoopKernel_AVX2_INTRIN,
+};
+
+// HME level-0 search, for search areas a multiple of 16 wide
+static const EB_SADLOOPKERNELNxM_TYPE HmeLevel0SadLoopKernel_Avx512[1] = {
+    SadLoopKernel_AVX512_HmeL0_INTRIN,
+};
+
+/**************************************************
+* ME SAD
+**************************************************/
+static const EB_SADCALCULATION8X8AND16X16_TYPE SadCalculation_8x8_16x16_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    SadCalculation_8x8_16x16,
+    // AVX2
+	SadCalculation_8x8_16x16_SSE2_INTRIN,
+};
+
+static const EB_SADCALCULATION32X32AND64X64_TYPE SadCalculation_32x32_64x64_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    SadCalculation_32x32_64x64,
+    // AVX2      
+	SadCalculation_32x32_64x64_SSE2_INTRIN,
+};
+
+static const EB_INIALIZEBUFFER_32BITS InitializeBuffer_32bits_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    InitializeBuffer_32bits,
+    // AVX2
+    InitializeBuffer_32bits_SSE2_INTRIN
+};
+
+/**************************************************
+* Motion estimation
+**************************************************/
+static const EB_FPSEARCH_FUNC GetEightHorizontalSearchPointResultsAll85PUs_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    GetEightHorizontalSearchPointResultsAll85PUs_C,
+    // AVX512
+    GetEightHorizontalSearchPointResultsAll85PUs_AVX512_INTRIN
+};
+
+/**************************************************
+* Mean
+**************************************************/
+static const EB_COMPUTE_MEAN_FUNC ComputeMeanFunc[EB_ASM_TYPE_TOTAL][2] = {
+    // C_DEFAULT
+    {
+        ComputeMean,
+        ComputeMeanOfSquaredValues
+    },
+    // AVX2
+    {
+        ComputeMean8x8_AVX2_INTRIN,
+        ComputeMeanOfSquaredValues8x8_SSE2_INTRIN
+    }
+};
+
+static const EB_COMPUTE_INTERM_VAR_FUNC ComputeIntermVarFour8x8_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    ComputeIntermVarFour8x8,
+    // AVX2
+    ComputeIntermVarFour8x8_SSE2_INTRIN
+};
+
+static const EB_COMPUTE_INTERM_VAR_FUNC ComputeIntermVarFour8x8_Avx2[1] = {
+    ComputeIntermVarFour8x8_AVX2_INTRIN
+};
+
+/**************************************************
+* Noise filters
+**************************************************/
+static const EB_WEAKLUMAFILTER_TYPE WeakLumaFilter_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+	// C_DEFAULT
+	noiseExtractLumaWeak,
+	// AVX2
+	noiseExtractLumaWeak_AVX2_INTRIN,
+
+};
+
+static const EB_WEAKLUMAFILTER_TYPE WeakLumaFilterLcu_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+	// C_DEFAULT
+	noiseExtractLumaWeakLcu,
+	// AVX2
+	noiseExtractLumaWeakLcu_AVX2_INTRIN,
+
+};
+
+static const EB_STRONGLUMAFILTER_TYPE StrongLumaFilter_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+	// C_DEFAULT
+	noiseExtractLumaStrong,
+	// AVX2
+	noiseExtractLumaStrong_AVX2_INTRIN,
+
+};
+
+static const EB_STRONGCHROMAFILTER_TYPE StrongChromaFilter_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+	// C_DEFAULT
+	noiseExtractChromaStrong,
+	// AVX2
+	noiseExtractChromaStrong_AVX2_INTRIN,
+
+};
+
+static const EB_WEAKCHROMAFILTER_TYPE WeakChromaFilter_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+	// C_DEFAULT
+	noiseExtractChromaWeak,
+	// AVX2
+	noiseExtractChromaWeak_AVX2_INTRIN,
+
+};
+
+/**************************************************
+* Intra prediction
+**************************************************/
+static const EB_INTRA_NOANG_TYPE IntraVerticalLuma_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeVerticalLuma,
+    // AVX2
+    IntraModeVerticalLuma_AVX2_INTRIN,
+
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraVerticalLuma_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeVerticalLuma16bit,
+    // AVX2
+    IntraModeVerticalLuma16bit_SSE2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_TYPE IntraVerticalChroma_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeVerticalChroma,
+    // AVX2
+    IntraModeVerticalChroma_AVX2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraVerticalChroma_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeVerticalChroma16bit,
+    // AVX2
+    IntraModeVerticalChroma16bit_SSE2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_TYPE IntraHorzLuma_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeHorizontalLuma,
+    // AVX2
+    IntraModeHorizontalLuma_SSE2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraHorzLuma_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeHorizontalLuma16bit,
+    // AVX2
+    IntraModeHorizontalLuma16bit_SSE2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_TYPE IntraHorzChroma_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeHorizontalChroma,
+    // AVX2
+    IntraModeHorizontalChroma_SSE2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraHorzChroma_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeHorizontalChroma16bit,
+    // AVX2
+    IntraModeHorizontalChroma16bit_SSE2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_TYPE IntraDCLuma_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeDCLuma,
+    // AVX2
+    IntraModeDCLuma_AVX2_INTRIN,
+  
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraDCLuma_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeDCLuma16bit,
+    // AVX2
+    IntraModeDCLuma16bit_SSE4_1_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraDCLuma_16bit_funcPtrArray_Avx2[1] = {
+    IntraModeDCLuma16bit_AVX2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_TYPE IntraDCChroma_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeDCChroma,
+    // AVX2
+    IntraModeDCChroma_AVX2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraDCChroma_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeDCChroma16bit,
+    // AVX2
+    IntraModeDCChroma16bit_SSSE3_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraDCChroma_16bit_funcPtrArray_Avx2[1] = {
+    IntraModeDCChroma16bit_AVX2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_TYPE IntraPlanar_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModePlanar,
+    // AVX2
+    IntraModePlanar_AVX2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraPlanar_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModePlanar16bit,
+    // AVX2
+    IntraModePlanar16bit_SSE2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraPlanar_16bit_funcPtrArray_Avx2[1] = {
+    IntraModePlanar16bit_AVX2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_TYPE IntraAng34_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular_34,
+    // AVX2
+    IntraModeAngular_34_AVX2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraAng34_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular16bit_34,
+    // AVX2
+    IntraModeAngular16bit_34_SSE2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_TYPE IntraAng18_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular_18,
+    // AVX2
+    IntraModeAngular_18_AVX2_INTRIN,
+
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraAng18_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular16bit_18,
+    // AVX2
+    IntraModeAngular16bit_18_SSE2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_TYPE IntraAng2_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular_2,
+    // AVX2
+    IntraModeAngular_2_AVX2_INTRIN,
+};
+
+static const EB_INTRA_NOANG_16bit_TYPE IntraAng2_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular16bit_2,
+    // AVX2
+    IntraModeAngular16bit_2_SSE2_INTRIN,
+};
+
+static const EB_INTRA_ANG_TYPE IntraAngVertical_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular_Vertical_Kernel,
+    // AVX2
+    IntraModeAngular_Vertical_Kernel_AVX2_INTRIN,
+};
+
+static const EB_INTRA_ANG_16BIT_TYPE IntraAngVertical_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular16bit_Vertical_Kernel,
+    // AVX2
+    IntraModeAngular16bit_Vertical_Kernel_SSE2_INTRIN,
+};
+
+static const EB_INTRA_ANG_16BIT_TYPE IntraAngVertical_16bit_funcPtrArray_Avx2[1] = {
+    IntraModeAngular16bit_Vertical_Kernel_AVX2_INTRIN,
+};
+
+static const EB_INTRA_ANG_TYPE IntraAngHorizontal_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular_Horizontal_Kernel,
+    // AVX2
+    IntraModeAngular_Horizontal_Kernel_AVX2_INTRIN,
+};
+
+static const EB_INTRA_ANG_16BIT_TYPE IntraAngHorizontal_16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraModeAngular16bit_Horizontal_Kernel,
+    // AVX2
+    IntraModeAngular16bit_Horizontal_Kernel_SSE2_INTRIN,
+};
+
+static const EB_INTRA_ANG_16BIT_TYPE IntraAngHorizontal_16bit_funcPtrArray_Avx2[1] = {
+    IntraModeAngular16bit_Horizontal_Kernel_AVX2_INTRIN,
+};
+
+static const EB_INTRA_REF_FILTER_16BIT_TYPE IntraFilterReferenceSamples16bit_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    IntraFilterReferenceSamples16bit,
+    // AVX2
+    IntraFilterReferenceSamples16bit_AVX2_INTRIN,
+};
+
+static const EB_NEIGHBOR_DC_INTRA_TYPE UpdateNeighborDcIntraPred_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    UpdateNeighborDcIntraPred,
+    // AVX2
+    UpdateNeighborDcIntraPred_AVX2,
+};
+
+/**************************************************
+* AVC-style motion compensated prediction
+**************************************************/
+static const AvcStyleInterpolationFilterNew AvcStyleUniPredLumaIFFunctionPtrArray[EB_ASM_TYPE_TOTAL][3] = {
+    // C_DEFAULT
+    {
+        AvcStyleCopyNew,                                     //copy
+        AvcStyleLumaInterpolationFilterHorizontal,           //a
+        AvcStyleLumaInterpolationFilterVertical,             //d
+    },
+    // AVX2
+    {
+        AvcStyleCopy_SSE2,                                          //copy
+        AvcStyleLumaInterpolationFilterHorizontal_SSSE3_INTRIN,     //a
+        AvcStyleLumaInterpolationFilterVertical_SSSE3_INTRIN,       //d
+
+    }
+};
+
+static const AvcStyleInterpolationFilterNew AvcStyleUniPredLumaIF_Avx2[1][3] = {
+    {
+        AvcStyleCopy_SSE2,                                          //copy
+        AvcStyleLumaInterpolationFilterHorizontal_AVX2_INTRIN,      //a
+        AvcStyleLumaInterpolationFilterVertical_AVX2_INTRIN,        //d
+    }
+};
+
+static const PictureAverage PictureAverageArray[EB_ASM_TYPE_TOTAL] = {
+	// C_DEFAULT
+    PictureAverageKernel,
+	// AVX2
+	PictureAverageKernel_SSE2_INTRIN,
+};
+
+static const PictureAverage PictureAverage_Avx512[1] = {
+    BiPredAverageKernel_AVX512_INTRIN
+};
+
+static const EB_BIAVG_FUNC BiPredAverageKernel_funcPtrArray[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    BiPredAverageKernel_C,
+    // AVX512
+    BiPredAverageKernel_AVX512_INTRIN
+};
+
+/**************************************************
+* Transforms / quantization
+**************************************************/
+static const EB_MAT_OUT_MUL_TYPE MatMulOut_funcPtrArray[EB_ASM_TYPE_TOTAL] =
+{
+	  MatMultOut,
+	  MatMult4x4_OutBuff_AVX2_INTRIN,
+};
+
+static const EB_QIQ_TYPE QiQ_funcPtrArray[EB_ASM_TYPE_TOTAL][5] = {
+	// C_DEFAULT
+	{
+        /*0 4x4   */     QuantizeInvQuantize,
+        /*1 8x8   */     QuantizeInvQuantize,
+        /*2 16x16 */     QuantizeInvQuantize,
+        /*3       */     (EB_QIQ_TYPE)QiQVoidFunc,
+        /*4 32x32 */     QuantizeInvQuantize
+	},
+	// AVX2
+	{
+		/*0 4x4   */    QuantizeInvQuantize4x4_SSE3,
+		/*1 8x8   */	 QuantizeInvQuantize8x8_AVX2_INTRIN,
+		/*2 16x16 */	 QuantizeInvQuantizeNxN_AVX2_INTRIN,
+		/*3       */    (EB_QIQ_TYPE)QiQVoidFunc,
+		/*4 32x32 */	 QuantizeInvQuantizeNxN_AVX2_INTRIN,
+
+	},
+};
+
+static const EB_QIQ_TYPE QiQ_Avx512[5] = {
+    /*0 4x4   */    QuantizeInvQuantize4x4_SSE3,
+    /*1 8x8   */    QuantizeInvQuantize8x8_AVX2_INTRIN,
+    /*2 16x16 */    QuantizeInvQuantizeNxN_AVX512_INTRIN,
+    /*3       */    (EB_QIQ_TYPE)QiQVoidFunc,
+    /*4 32x32 */    QuantizeInvQuantizeNxN_AVX512_INTRIN
+};
+
+static const EB_MAT_MUL_TYPE MatMul_funcPtrArray[EB_ASM_TYPE_TOTAL][5] = {
+    // C_DEFAULT
+    {
+        /*0 4x4   */     MatMult,
+        /*1 8x8   */     MatMult,
+        /*2 16x16 */     MatMult,
+        /*3 16x16 */     MatMult,
+        /*4 32x32 */     MatMult
+    },
+    // AVX2
+    {
+        /*0 4x4   */     MatMult4x4_AVX2_INTRIN,
+        /*1 8x8   */     MatMult8x8_AVX2_INTRIN,
+        /*2 16x16 */     MatMultNxN_AVX2_INTRIN,
+        /*3 16x16 */     MatMultNxN_AVX2_INTRIN,
+        /*4 32x32 */     MatMultNxN_AVX2_INTRIN
+    },
+
+
+};
+
+static const EB_TRANSFORM_FUNC transformFunctionTableEstimate[EB_ASM_TYPE_TOTAL][5] = {
+        // C_DEFAULT
+        {
+	    	Transform32x32Estimate,
+		    Transform16x16Estimate,
+            Transform8x8,
+            Transform4x4,
+            DstTransform4x4
+        },
+        // AVX2
+        {
+            lowPrecisionTransform32x32_AVX2_INTRIN,
+            lowPrecisionTransform16x16_AVX2_INTRIN,
+            Transform8x8_SSE4_1_INTRIN,
+            Transform4x4_SSE2_INTRIN,
+            DstTransform4x4_SSE2_INTRIN
+        },
+};
+
+static const EB_TRANSFORM_FUNC PfreqN2TransformTable0[EB_ASM_TYPE_TOTAL][5] = {
+    // NON_AVX2
+    {
+        Transform32x32Estimate,
+        Transform16x16Estimate,
+        Transform8x8,
+        Transform4x4,
+        DstTransform4x4
+
+    },
+    // AVX2
+    {
+        PfreqTransform32x32_AVX2_INTRIN,
+        PfreqTransform16x16_SSE2,
+        PfreqTransform8x8_SSE4_1_INTRIN,
+        Transform4x4_SSE2_INTRIN,
+        DstTransform4x4_SSE2_INTRIN
+    }
+};
+
+// Encode pass, 10-bit residuals
+static const EB_TRANSFORM_FUNC PfreqN2TransformTable16bit[EB_ASM_TYPE_TOTAL][5] = {
+    // NON_AVX2
+    {
+        Transform32x32Estimate,
+        Transform16x16Estimate,
+        Transform8x8,
+        Transform4x4,
+        DstTransform4x4
+    },
+    // AVX2
+    {
+        PfreqTransform32x32_SSE2,
+        PfreqTransform16x16_SSE2,
+        PfreqTransform8x8_SSE2_INTRIN,
+        Transform4x4_SSE2_INTRIN,
+        DstTransform4x4_SSE2_INTRIN
+    }
+};
+
+static const EB_TRANSFORM_FUNC PfreqN4TransformTable0[EB_ASM_TYPE_TOTAL][5] = {
+    // NON_AVX2
+    {
+        Transform32x32Estimate,
+        Transform16x16Estimate,
+        Transform8x8,
+        Transform4x4,
+        DstTransform4x4
+    },
+    // AVX2
+    {
+        PfreqN4Transform32x32_AVX2_INTRIN,
+        PfreqN4Transform16x16_SSE2,
+        PfreqN4Transform8x8_SSE4_1_INTRIN,
+        Transform4x4_SSE2_INTRIN,
+        DstTransform4x4_SSE2_INTRIN
+    }
+};
+
+// Encode pass, 10-bit residuals
+static const EB_TRANSFORM_FUNC PfreqN4TransformTable16bit[EB_ASM_TYPE_TOTAL][5] = {
+    // NON_AVX2
+    {
+        Transform32x32Estimate,
+        Transform16x16Estimate,
+        Transform8x8,
+        Transform4x4,
+        DstTransform4x4
+    },
+    // AVX2
+    {
+        PfreqN4Transform32x32_SSE2,
+        PfreqN4Transform16x16_SSE2,
+        PfreqN4Transform8x8_SSE2_INTRIN,
+        Transform4x4_SSE2_INTRIN,
+        DstTransform4x4_SSE2_INTRIN
+    }
+};
+
+// Encode pass; also the 10-bit residual set, the top row only serves 8-bit ones
+static const EB_TRANSFORM_FUNC transformFunctionTableEncode[EB_ASM_TYPE_TOTAL][5] = {
+    // NON_AVX2
+    {
+        Transform32x32Estimate,
+        Transform16x16Estimate,
+        Transform8x8,
+        Transform4x4,
+        DstTransform4x4
+    },
+    // AVX2
+    {
+        Transform32x32_SSE2,
+        Transform16x16_SSE2,
+        Transform8x8_SSE2_INTRIN,       // Transform8x8_SSE4_1_INTRIN overflows on 10-bit residuals
+        Transform4x4_SSE2_INTRIN,
+        DstTransform4x4_SSE2_INTRIN
+    },
+};
+
+static const EB_TRANSFORM_FUNC transformFunctionTableEncode_Avx2[1][5] = {
+    {
+        Transform32x32_SSE2,
+        Transform16x16_SSE2,
+        Transform8x8_SSE4_1_INTRIN,
+        Transform4x4_SSE2_INTRIN,
+        DstTransform4x4_SSE2_INTRIN
+    },
+};
+
+static const EB_INVTRANSFORM_FUNC invTransformFunctionTableEstimate[EB_ASM_TYPE_TOTAL][5] = {
+        // C_DEFAULT
+        {
+            InvTransform32x32,
+            InvTransform16x16,
+            InvTransform8x8,
+            InvTransform4x4,
+            InvDstTransform4x4
+        },
+        // AVX2
+        {
+            EstimateInvTransform32x32_SSE2,
+            EstimateInvTransform16x16_SSE2,
+            InvTransform8x8_SSE2_INTRIN,
+            InvTransform4x4_SSE2_INTRIN,
+            InvDstTransform4x4_SSE2_INTRIN
+        },
+};
+
+static const EB_INVTRANSFORM_FUNC invTransformFunctionTableEncode[EB_ASM_TYPE_TOTAL][5] = {
+        // C_DEFAULT
+        {
+            InvTransform32x32,
+            InvTransform16x16,
+            InvTransform8x8,
+            InvTransform4x4,
+            InvDstTransform4x4
+        },
+        // AVX2
+        {
+            PFinvTransform32x32_SSSE3,
+            PFinvTransform16x16_SSSE3,
+            InvTransform8x8_SSE2_INTRIN,
+            InvTransform4x4_SSE2_INTRIN,
+            InvDstTransform4x4_SSE2_INTRIN
+        },
+};
+
+// The 4x4 inverse transforms stay on SSE2 as the AVX2 ones only pay off when fused with the reconstruction
+static const EB_INVTRANSFORM_FUNC invTransformFunctionTableEstimate_Avx2[1][5] = {
+        {
+            InvTransform32x32_AVX2_INTRIN,
+            InvTransform16x16_AVX2_INTRIN,
+            InvTransform8x8_AVX2_INTRIN,
+            InvTransform4x4_SSE2_INTRIN,
+            InvDstTransform4x4_SSE2_INTRIN
+        },
+};
+
+static const EB_INVTRANSFORM_FUNC invTransformFunctionTableEncode_Avx2[1][5] = {
+        {
+            InvTransform32x32_AVX2_INTRIN,
+            InvTransform16x16_AVX2_INTRIN,
+            InvTransform8x8_AVX2_INTRIN,
+            InvTransform4x4_SSE2_INTRIN,
+            InvDstTransform4x4_SSE2_INTRIN
+        },
+};
+
+static const EB_INVTRANSFORM_RECON_FUNC invTransformReconFunctionTable[EB_ASM_TYPE_TOTAL][5] = {
+        // C_DEFAULT
+        {
+            InvTransformRecon32x32,
+            InvTransformRecon16x16,
+            InvTransformRecon8x8,
+            InvTransformRecon4x4,
+            InvDstTransformRecon4x4
+        },
+        // AVX2
+        {
+            InvTransformRecon32x32,
+            InvTransformRecon16x16,
+            InvTransformRecon8x8,
+            InvTransformRecon4x4,
+            InvDstTransformRecon4x4
+        },
+};
+
+static const EB_INVTRANSFORM_RECON_FUNC invTransformReconFunctionTable_Avx2[1][5] = {
+        {
+            InvTransformRecon32x32_AVX2_INTRIN,
+            InvTransformRecon16x16_AVX2_INTRIN,
+            InvTransformRecon8x8_AVX2_INTRIN,
+            InvTransformRecon4x4_AVX2_INTRIN,
+            InvDstTransformRecon4x4_AVX2_INTRIN
+        },
+};
+
+static const EB_INVTRANSFORM_RECON_16BIT_FUNC invTransformRecon16bitFunctionTable[EB_ASM_TYPE_TOTAL][5] = {
+        // C_DEFAULT
+        {
+            InvTransformRecon32x32_16bit,
+            InvTransformRecon16x16_16bit,
+            InvTransformRecon8x8_16bit,
+            InvTransformRecon4x4_16bit,
+            InvDstTransformRecon4x4_16bit
+        },
+        // AVX2
+        {
+            InvTransformRecon32x32_16bit,
+            InvTransformRecon16x16_16bit,
+            InvTransformRecon8x8_16bit,
+            InvTransformRecon4x4_16bit,
+            InvDstTransformRecon4x4_16bit
+        },
+};
+
+static const EB_INVTRANSFORM_RECON_16BIT_FUNC invTransformRecon16bitFunctionTable_Avx2[1][5] = {
+        {
+            InvTransformRecon32x32_16bit_AVX2_INTRIN,
+            InvTransformRecon16x16_16bit_AVX2_INTRIN,
+            InvTransformRecon8x8_16bit_AVX2_INTRIN,
+            InvTransformRecon4x4_16bit_AVX2_INTRIN,
+            InvDstTransformRecon4x4_16bit_AVX2_INTRIN
+        },
+};
+
+static const PM_RATE_EST_TYPE CoeffRateEst4x4_funcPtrArray[EB_ASM_TYPE_TOTAL][2/*Luma+Chroma*/] = {
+    // C_DEFAULT
+    { EstimateQuantizedCoefficients_Lossy, EstimateQuantizedCoefficients_Lossy },
+    // AVX2
+    { PmEstimateQuantCoeffLuma_SSE2, PmEstimateQuantCoeffChroma_SSE2 }
+};
+
+/**************************************************
+* Entropy coding
+**************************************************/
+static const ESTIMATE_QUANTIZED_COEFF_TYPE EstimateQuantizedCoefficients[EB_ASM_TYPE_TOTAL][2] = { // [c/assembly][lossless/lossy]
+    // C_DEFAULT
+    {
+        EstimateQuantizedCoefficients_generic,
+        EstimateQuantizedCoefficients_Lossy,
+    },
+    // AVX2
+    {
+        EstimateQuantizedCoefficients_SSE2,
+        EstimateQuantizedCoefficients_Lossy_SSE2,
+    }
+};
+
+static const ENCODE_QUANTIZED_COEFF_TYPE EncodeQuantizedCoefficientsFuncArray[EB_ASM_TYPE_TOTAL] =
+{
+	// C_DEFAULT
+    EncodeQuantizedCoefficients_generic,
+	// AVX2
+	EncodeQuantizedCoefficients_SSE2,
+};
+
+static const ESTIMATE_QUANTIZED_COEFF_TYPE_UPDATE EstimateQuantizedCoefficientsUpdate[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    EstimateQuantizedCoefficients_generic_Update,
+    // AVX2
+    EstimateQuantizedCoefficients_Update_SSE2
+};
+
+/**************************************************
+* Deblocking filter
+**************************************************/
+static const EB_LUMA4SAMPLEDGEDLF_FUNC Luma4SampleEdgeDLFCore_Table[EB_ASM_TYPE_TOTAL] =
+{  
+	// C_DEFAULT
+    Luma4SampleEdgeDLFCore,
+    // AVX2
+    Luma4SampleEdgeDLFCore_SSSE3,
+};
+
+static const EB_CHROMA2SAMPLEDGEDLF_FUNC Chroma2SampleEdgeDLFCore_Table[EB_ASM_TYPE_TOTAL] =
+{
+    // C_DEFAULT
+    Chroma2SampleEdgeDLFCore,
+    // AVX2
+    Chroma2SampleEdgeDLFCore_SSSE3,
+};
+
+static const EB_CHROMADLF_TYPE_16BIT chromaDlf_funcPtrArray16bit[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    Chroma2SampleEdgeDLFCore16bit,
+    // AVX2
+    Chroma2SampleEdgeDLFCore16bit_SSE2_INTRIN,
+};
+
+static const EB_LUMADLF_TYPE_16BIT lumaDlf_funcPtrArray16bit[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    Luma4SampleEdgeDLFCore16bit,
+    // AVX2
+    Luma4SampleEdgeDLFCore16bit_SSSE3_INTRIN,
+};
+
+static const EB_LUMA8SAMPLEDGEDLF_FUNC Luma8SampleEdgeDLFCore_Table[EB_ASM_TYPE_TOTAL] =
+{
+    // C_DEFAULT
+    Luma8SampleEdgeDLFCore,
+    // SSSE3
+    Luma8SampleEdgeDLFCore_SSSE3,
+};
+
+static const EB_LUMA8SAMPLEDGEDLF_FUNC Luma8SampleEdgeDLFCore_Avx2[1] =
+{
+    Luma8SampleEdgeDLFCore_AVX2_INTRIN,
+};
+
+static const EB_LUMA8DLF_TYPE_16BIT lumaDlf8Sample_funcPtrArray16bit[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    Luma8SampleEdgeDLFCore16bit,
+    // SSSE3
+    Luma8SampleEdgeDLFCore16bit_SSSE3_INTRIN,
+};
+
+static const EB_LUMA8DLF_TYPE_16BIT lumaDlf8Sample_Avx2_16bit[1] = {
+    Luma8SampleEdgeDLFCore16bit_AVX2_INTRIN,
+};
+
+/**************************************************
+* Sample adaptive offset
+**************************************************/
+static const EB_SAOGATHER_FUNC SaoGatherFunctionTableLossy[EB_ASM_TYPE_TOTAL] = {
+    // C_DEFAULT
+    GatherSaoStatisticsLcuLossy_62x62,
+    // AVX2 
+    GatherSaoStatisticsLcu_BT_SSE2,
+};
+
+static const EB_SAOGATHER_90_45_135_FUNC SaoGatherFunctionTableLossy_90_45_135[EB_ASM_TYPE_TOTAL]= {
+	// C_DEFAULT
+    GatherSaoStatisticsLcu_OnlyEo_90_45_135_Lossy,
+	// AVX2 
+	GatherSaoStatisticsLcu_OnlyEo_90_45_135_BT_SSE2,
+};
+
+static const EB_SAOGATHER_16bit_FUNC SaoGatherFunctionTable_16bit[EB_ASM_TYPE_TOTAL][2] = {
+    // C_DEFAULT
+    {
+        GatherSaoStatisticsLcu_62x62_16bit,
+        GatherSaoStatisticsLcu_62x62_16bit,
+    },
+    // AVX2
+    {
+        GatherSaoStatisticsLcu_62x62_16bit,
+        GatherSaoStatisticsLcu16bit_SSE2,
+    },
+};
+
+static const EB_SAOGATHER_90_45_135_16bit_SSE2_FUNC SaoGatherFunctionTable_90_45_135_16bit_SSE2[EB_ASM_TYPE_TOTAL][2] = {
+	// C_DEFAULT
+	{
+        GatherSaoStatisticsLcu_62x62_OnlyEo_90_45_135_16bit,
+        GatherSaoStatisticsLcu_62x62_OnlyEo_90_45_135_16bit,
+	},
+	// AVX2
+	{
+		GatherSaoStatisticsLcu_62x62_OnlyEo_90_45_135_16bit,
+		GatherSaoStatisticsLcu_OnlyEo_90_45_135_16bit_SSE2_INTRIN,
+	},
+};
+
+static const EB_SAOAPPLY_BO_FUNC SaoFunctionTableBo[EB_ASM_TYPE_TOTAL][2] = {
+    // C_DEFAULT
+    {
+        SAOApplyBO,
+        SAOApplyBO
+    },
+    // AVX2
+    {
+		SAOApplyBO,
+		SAOApplyBO_BT_SSSE3
+    },
+};
+
+static const EB_SAOAPPLY_EO_0_90_FUNC SaoFunctionTableEO_0_90[EB_ASM_TYPE_TOTAL][2][2] = {
+	// C_DEFAULT
+    {
+        {
+            SAOApplyEO_0,
+            SAOApplyEO_0
+        },
+        {
+            SAOApplyEO_90,
+            SAOApplyEO_90
+        }
+    },
+	// AVX2
+    {
+        {
+            SAOApplyEO_0,
+            SAOApplyEO_0_BT_SSSE3
+        },
+        {
+            SAOApplyEO_90,
+            SAOApplyEO_90_BT_SSSE3
+        }
+    },
+};
+
+static const EB_SAOAPPLY_EO_135_45_FUNC SaoFunctionTableEO_135_45[EB_ASM_TYPE_TOTAL][2][2][2] = {
+	// C_DEFAULT
+	{
+        {
+			{
+			SAOApplyEO_135,
+			SAOApplyEO_135
+			},
+			{
+			SAOApplyEO_135,
+			SAOApplyEO_135
+			}
+        },
+        {
+			{
+            SAOApplyEO_45,
+            SAOApplyEO_45
+			},
+			{
+            SAOApplyEO_45,
+            SAOApplyEO_45
+			}
+        }
+    },
+	// AVX2
+	{
+        {
+			{  
+				SAOApplyEO_135,
+                SAOApplyEO_135_BT_SSSE3
+			},
+			{ 
+				SAOApplyEO_135,
+                SAOApplyEO_135_BT_SSSE3
+			}
+
+        },
+        {
+			{
+                SAOApplyEO_45,
+                SAOApplyEO_45_BT_SSSE3
+			},
+			{
+                SAOApplyEO_45,
+				SAOApplyEO_45_BT_SSSE3
+			}
+        }
+    },
+};
+
+static const EB_SAOAPPLY_BO_16bit_FUNC SaoFunctionTableBo_16bit[EB_ASM_TYPE_TOTAL][2] = { 
+	// C_DEFAULT
+	{
+        SAOApplyBO16bit,
+        SAOApplyBO16bit
+	},
+	// AVX2
+	{
+		SAOApplyBO16bit,
+		SAOApplyBO16bit_SSE2_INTRIN
+	},
+};
+
+static const EB_SAOAPPLY_EO_0_90_16bit_FUNC SaoFunctionTableEO_0_90_16bit[EB_ASM_TYPE_TOTAL][2][2] = {
+	// C_DEFAULT
+    {
+        {
+         SAOApplyEO_0_16bit,
+         SAOApplyEO_0_16bit
+        },
+        {
+         SAOApplyEO_90_16bit,
+         SAOApplyEO_90_16bit
+        }
+    },
+	// AVX2
+    {
+        {
+         SAOApplyEO_0_16bit,
+         SAOApplyEO_0_16bit_SSE2_INTRIN
+        },
+        {
+         SAOApplyEO_90_16bit,
+         SAOApplyEO_90_16bit_SSE2_INTRIN
+        }
+    },
+};
+
+static const EB_SAOAPPLY_EO_135_45_16bit_FUNC SaoFunctionTableEO_135_45_16bit[EB_ASM_TYPE_TOTAL][2][2] = {
+	// C_DEFAULT
+    {
+        {
+			SAOApplyEO_135_16bit,
+			SAOApplyEO_135_16bit
+        },
+        {
+            SAOApplyEO_45_16bit,
+            SAOApplyEO_45_16bit
+        }
+    },
+	// AVX2
+    {
+        {
+			SAOApplyEO_135_16bit,
+            SAOApplyEO_135_16bit_SSE2_INTRIN
+        },
+        {
+			SAOApplyEO_45_16bit,
+			SAOApplyEO_45_16bit_SSE2_INTRIN
+        }
+    },
+};
+
+static const EB_SAOGATHER_FUNC SaoGatherFunctionTableLossy_Avx2[1] = {
+    GatherSaoStatisticsLcu_BT_AVX2,
+};
+
+static const EB_SAOGATHER_90_45_135_FUNC SaoGatherFunctionTableLossy_90_45_135_Avx2[1] = {
+    GatherSaoStatisticsLcu_OnlyEo_90_45_135_BT_AVX2,
+};
+
+static const EB_SAOGATHER_16bit_FUNC SaoGatherFunctionTable_16bit_Avx2[1][2] = {
+    {
+        GatherSaoStatisticsLcu_62x62_16bit,
+        GatherSaoStatisticsLcu16bit_AVX2_INTRIN,
+    },
+};
+
+static const EB_SAOGATHER_90_45_135_16bit_SSE2_FUNC SaoGatherFunctionTable_90_45_135_16bit_Avx2[1][2] = {
+    {
+        GatherSaoStatisticsLcu_62x62_OnlyEo_90_45_135_16bit,
+        GatherSaoStatisticsLcu_OnlyEo_90_45_135_16bit_AVX2_INTRIN,
+    },
+};
+
+static const EB_SAOGATHER_FUNC SaoGatherFunctionTableLossy_Avx512[1] = {
+    GatherSaoStatisticsLcu_BT_AVX512,
+};
+
+static const EB_SAOGATHER_90_45_135_FUNC SaoGatherFunctionTableLossy_90_45_135_Avx512[1] = {
+    GatherSaoStatisticsLcu_OnlyEo_90_45_135_BT_AVX512,
+};
+
+// The AVX-512 kernels take any LCU width
+static const EB_SAOGATHER_16bit_FUNC SaoGatherFunctionTable_16bit_Avx512[1][2] = {
+    {
+        GatherSaoStatisticsLcu16bit_AVX512_INTRIN,
+        GatherSaoStatisticsLcu16bit_AVX512_INTRIN,
+    },
+};
+
+static const EB_SAOGATHER_90_45_135_16bit_SSE2_FUNC SaoGatherFunctionTable_90_45_135_16bit_Avx512[1][2] = {
+    {
+        GatherSaoStatisticsLcu_OnlyEo_90_45_135_16bit_AVX512_INTRIN,
+        GatherSaoStatisticsLcu_OnlyEo_90_45_135_16bit_AVX512_INTRIN,
+    },
+};
+
+static const EB_SAOAPPLY_BO_FUNC SaoFunctionTableBo_Avx2[1][2] = {
+    {
+        SAOApplyBO,
+        SAOApplyBO_BT_AVX2
+    },
+};
+
+static const EB_SAOAPPLY_EO_0_90_FUNC SaoFunctionTableEO_0_90_Avx2[1][2][2] = {
+    {
+        {
+            SAOApplyEO_0,
+            SAOApplyEO_0_BT_AVX2
+        },
+        {
+            SAOApplyEO_90,
+            SAOApplyEO_90_BT_AVX2
+        }
+    },
+};
+
+static const EB_SAOAPPLY_EO_135_45_FUNC SaoFunctionTableEO_135_45_Avx2[1][2][2][2] = {
+    {
+        {
+            {
+                SAOApplyEO_135,
+                SAOApplyEO_135_BT_AVX2
+            },
+            {
+                SAOApplyEO_135,
+                SAOApplyEO_135_BT_AVX2
+            }
+        },
+        {
+            {
+                SAOApplyEO_45,
+                SAOApplyEO_45_BT_AVX2
+            },
+            {
+                SAOApplyEO_45,
+                SAOApplyEO_45_BT_AVX2
+            }
+        }
+    },
+};
+
+static const EB_SAOAPPLY_BO_16bit_FUNC SaoFunctionTableBo_16bit_Avx2[1][2] = {
+    {
+        SAOApplyBO16bit,
+        SAOApplyBO16bit_AVX2_INTRIN
+    },
+};
+
+static const EB_SAOAPPLY_EO_0_90_16bit_FUNC SaoFunctionTableEO_0_90_16bit_Avx2[1][2][2] = {
+    {
+        {
+            SAOApplyEO_0_16bit,
+            SAOApplyEO_0_16bit_AVX2_INTRIN
+        },
+        {
+            SAOApplyEO_90_16bit,
+            SAOApplyEO_90_16bit_AVX2_INTRIN
+        }
+    },
+};
+
+static const EB_SAOAPPLY_EO_135_45_16bit_FUNC SaoFunctionTableEO_135_45_16bit_Avx2[1][2][2] = {
+    {
+        {
+            SAOApplyEO_135_16bit,
+            SAOApplyEO_135_16bit_AVX2_INTRIN
+        },
+        {
+            SAOApplyEO_45_16bit,
+            SAOApplyEO_45_16bit_AVX2_INTRIN
+        }
+    },
+};
+
+/**************************************************
+* Dispatch table
+**************************************************/
+EbRtcd_t rtcd;
+
+// Kernel tiers, as accepted by SVT_HEVC_RTCD
+#define RTCD_TIER_C         0   // row 0 of the candidate table
+#define RTCD_TIER_AVX2      1   // row 1 of the candidate table
+#define RTCD_TIER_AVX512    2   // AVX-512 row, or row 1 when it needs AVX512_MASK
+
+typedef struct RtcdEntry_s
+{
+    const char  *name;
+    size_t       offset;        // member offset in EbRtcd_t
+    size_t       size;          // member size, i.e. one candidate row
+    size_t       tableSize;     // size of the [EB_ASM_TYPE_TOTAL] candidate table
+    const void  *table;
+    EB_U32       mask;          // ASM_TYPES bit row 1 needs
+    size_t       topSize;       // size of the top row, 0 if there is none
+    const void  *topRow;        // used over row 1 when ASM_TYPES has topMask
+    EB_U32       topMask;       // AVX2_MASK or AVX512_MASK
+    size_t       avx512Size;    // size of the AVX-512 row over an AVX2 top row, 0 if there is none
+    const void  *avx512Row;     // used over the top row when ASM_TYPES has AVX512_MASK
+} RtcdEntry_t;
+
+#define RTCD_ENTRY(member, candidates, asmMask) \
+    { #member, offsetof(EbRtcd_t, member), sizeof(((EbRtcd_t*)0)->member), sizeof(candidates), (const void*)(candidates), asmMask, 0, NULL, 0, 0, NULL }
+
+// Row 1 plus a top row for CPUs with topMask, e.g. SSSE3 in row 1 and AVX2 on top
+#define RTCD_ENTRY_TOP(member, candidates, asmMask, topCandidates, topAsmMask) \
+    { #member, offsetof(EbRtcd_t, member), sizeof(((EbRtcd_t*)0)->member), sizeof(candidates), (const void*)(candidates), asmMask, sizeof(topCandidates), (const void*)(topCandidates), topAsmMask, 0, NULL }
+
+#define RTCD_ENTRY_AVX512(member, candidates, asmMask, avx512Candidates) \
+    RTCD_ENTRY_TOP(member, candidates, asmMask, avx512Candidates, AVX512_MASK)
+
+// Row 1, an AVX2 top row and an AVX-512 row above it
+#define RTCD_ENTRY_TOP_AVX512(member, candidates, asmMask, topCandidates, topAsmMask, avx512Candidates) \
+    { #member, offsetof(EbRtcd_t, member), sizeof(((EbRtcd_t*)0)->member), sizeof(candidates), (const void*)(candidates), asmMask, sizeof(topCandidates), (const void*)(topCandidates), topAsmMask, sizeof(avx512Candidates), (const void*)(avx512Candidates) }
+
+static const RtcdEntry_t RtcdEntries[] = {
+    // Picture operators
+    RTCD_ENTRY(SumResidual, SumResidual_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(memset16bitBlock, memset16bitBlock_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(AdditionKernel, AdditionKernel_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(AdditionKernel16bit, AdditionKernel_funcPtrArray16bit, PREAVX2_MASK),
+    RTCD_ENTRY(PicCopyKernel, PicCopyKernel_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(ResidualKernelSubSampled, ResidualKernelSubSampled_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY_AVX512(ResidualKernel, ResidualKernel_funcPtrArray, PREAVX2_MASK, ResidualKernel_Avx512),
+    RTCD_ENTRY(ResidualKernel16Bit, ResidualKernel_funcPtrArray16Bit, PREAVX2_MASK),
+    RTCD_ENTRY(PicZeroOutCoef, PicZeroOutCoef_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(FullDistortionIntrinsic, FullDistortionIntrinsic_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY_TOP(Compute8x8Satd, Compute8x8Satd_funcPtrArray, PREAVX2_MASK, Compute8x8Satd_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(Compute8x8Satd_U8, Compute8x8Satd_U8_funcPtrArray, PREAVX2_MASK, Compute8x8Satd_U8_Avx2, AVX2_MASK),
+    RTCD_ENTRY_AVX512(Compute16x16Satd_U8, Compute16x16Satd_U8_funcPtrArray, AVX2_MASK, Compute16x16Satd_U8_Avx512),
+    RTCD_ENTRY(DecimateAverage, DecimateAverage_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(DecimateAverage16bit, DecimateAverage16bit_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY_AVX512(SpatialFullDistortionKernel, SpatialFullDistortionKernel_funcPtrArray, PREAVX2_MASK, SpatialFullDistortionKernel_Avx512),
+    RTCD_ENTRY(PictureSse, PictureSse_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(PictureSse16bit, PictureSse16bit_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(SsimBlockSums, SsimBlockSums_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(SsimBlockSums16bit, SsimBlockSums16bit_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(BlockHash64x64, BlockHash64x64_funcPtrArray, AVX2_MASK),
+
+    // Pack / unpack
+    RTCD_ENTRY(Pack2D_16Bit_SRC, Pack2D_funcPtrArray_16Bit_SRC, AVX2_MASK),
+    RTCD_ENTRY(CompressedPack, CompressedPack_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(Convert_Unpack_CPack, Convert_Unpack_CPack_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(UnPack2D_16Bit, UnPack2D_funcPtrArray_16Bit, AVX512_MASK),
+    RTCD_ENTRY(UnPackAvg, UnPackAvg_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(UnPackAvgSafeSub, UnPackAvgSafeSub_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(UnPack8BIT_16Bit, UnPack8BIT_funcPtrArray_16Bit, PREAVX2_MASK),
+    RTCD_ENTRY(UnPack8BITSafeSub_16Bit, UnPack8BITSafeSub_funcPtrArray_16Bit, AVX2_MASK),
+
+    // SAD
+    RTCD_ENTRY(NxMSadKernel, NxMSadKernel_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(NxMSadAveragingKernel, NxMSadAveragingKernel_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(NxMSadLoopKernel, NxMSadLoopKernel_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY_AVX512(HmeLevel0SadLoopKernel, NxMSadLoopKernel_funcPtrArray, AVX2_MASK, HmeLevel0SadLoopKernel_Avx512),
+
+    // ME SAD
+    RTCD_ENTRY(SadCalculation_8x8_16x16, SadCalculation_8x8_16x16_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(SadCalculation_32x32_64x64, SadCalculation_32x32_64x64_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(InitializeBuffer_32bits, InitializeBuffer_32bits_funcPtrArray, PREAVX2_MASK),
+
+    // Motion estimation
+    RTCD_ENTRY(GetEightHorizontalSearchPointResultsAll85PUs, GetEightHorizontalSearchPointResultsAll85PUs_funcPtrArray, AVX512_MASK),
+
+    // Mean
+    RTCD_ENTRY(ComputeMeanFunc, ComputeMeanFunc, AVX2_MASK),
+    RTCD_ENTRY_TOP(ComputeIntermVarFour8x8, ComputeIntermVarFour8x8_funcPtrArray, PREAVX2_MASK, ComputeIntermVarFour8x8_Avx2, AVX2_MASK),
+
+    // Noise filters
+    RTCD_ENTRY(WeakLumaFilter, WeakLumaFilter_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(WeakLumaFilterLcu, WeakLumaFilterLcu_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(StrongLumaFilter, StrongLumaFilter_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(StrongChromaFilter, StrongChromaFilter_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(WeakChromaFilter, WeakChromaFilter_funcPtrArray, AVX2_MASK),
+
+    // Intra prediction
+    RTCD_ENTRY(IntraVerticalLuma, IntraVerticalLuma_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(IntraVerticalLuma_16bit, IntraVerticalLuma_16bit_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraVerticalChroma, IntraVerticalChroma_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraVerticalChroma_16bit, IntraVerticalChroma_16bit_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraHorzLuma, IntraHorzLuma_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraHorzLuma_16bit, IntraHorzLuma_16bit_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraHorzChroma, IntraHorzChroma_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraHorzChroma_16bit, IntraHorzChroma_16bit_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraDCLuma, IntraDCLuma_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY_TOP(IntraDCLuma_16bit, IntraDCLuma_16bit_funcPtrArray, PREAVX2_MASK, IntraDCLuma_16bit_funcPtrArray_Avx2, AVX2_MASK),
+    RTCD_ENTRY(IntraDCChroma, IntraDCChroma_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY_TOP(IntraDCChroma_16bit, IntraDCChroma_16bit_funcPtrArray, PREAVX2_MASK, IntraDCChroma_16bit_funcPtrArray_Avx2, AVX2_MASK),
+    RTCD_ENTRY(IntraPlanar, IntraPlanar_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY_TOP(IntraPlanar_16bit, IntraPlanar_16bit_funcPtrArray, PREAVX2_MASK, IntraPlanar_16bit_funcPtrArray_Avx2, AVX2_MASK),
+    RTCD_ENTRY(IntraAng34, IntraAng34_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(IntraAng34_16bit, IntraAng34_16bit_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraAng18, IntraAng18_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(IntraAng18_16bit, IntraAng18_16bit_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraAng2, IntraAng2_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(IntraAng2_16bit, IntraAng2_16bit_funcPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY(IntraAngVertical, IntraAngVertical_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY_TOP(IntraAngVertical_16bit, IntraAngVertical_16bit_funcPtrArray, PREAVX2_MASK, IntraAngVertical_16bit_funcPtrArray_Avx2, AVX2_MASK),
+    RTCD_ENTRY(IntraAngHorizontal, IntraAngHorizontal_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY_TOP(IntraAngHorizontal_16bit, IntraAngHorizontal_16bit_funcPtrArray, PREAVX2_MASK, IntraAngHorizontal_16bit_funcPtrArray_Avx2, AVX2_MASK),
+    RTCD_ENTRY(IntraFilterReferenceSamples16bit, IntraFilterReferenceSamples16bit_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(UpdateNeighborDcIntraPred, UpdateNeighborDcIntraPred_funcPtrArray, AVX2_MASK),
+
+    // Motion compensated prediction
+    RTCD_ENTRY_TOP(biPredClipping, biPredClippingFuncPtrArray, PREAVX2_MASK, biPredClippingFuncPtrArray_Avx2, AVX2_MASK),
+    RTCD_ENTRY(biPredClipping16bit, biPredClipping16bitFuncPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY_TOP(uniPredLumaIFNew, uniPredLumaIFFunctionPtrArrayNew, PREAVX2_MASK, uniPredLumaIFFunctionPtrArrayNew_Avx2, AVX2_MASK),
+    RTCD_ENTRY(uniPredLuma16bitIF, uniPredLuma16bitIFFunctionPtrArray, PREAVX2_MASK),
+    RTCD_ENTRY_TOP(biPredLumaIFNew, biPredLumaIFFunctionPtrArrayNew, PREAVX2_MASK, biPredLumaIFFunctionPtrArrayNew_Avx2, AVX2_MASK),
+    RTCD_ENTRY(biPredLumaIFNew16bit, biPredLumaIFFunctionPtrArrayNew16bit, PREAVX2_MASK),
+    RTCD_ENTRY_TOP(uniPredChromaIFNew, uniPredChromaIFFunctionPtrArrayNew, PREAVX2_MASK, uniPredChromaIFFunctionPtrArrayNew_Avx2, AVX2_MASK),
+    RTCD_ENTRY(uniPredChromaIFNew16bit, uniPredChromaIFFunctionPtrArrayNew16bit, AVX2_MASK),
+    RTCD_ENTRY_TOP(biPredChromaIFNew, biPredChromaIFFunctionPtrArrayNew, PREAVX2_MASK, biPredChromaIFFunctionPtrArrayNew_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(biPredChromaIFNew16bit, biPredChromaIFFunctionPtrArrayNew16bit, PREAVX2_MASK, biPredChromaIFFunctionPtrArrayNew16bit_Avx2, AVX2_MASK),
+
+    // AVC-style motion compensated prediction
+    RTCD_ENTRY_TOP(AvcStyleUniPredLumaIF, AvcStyleUniPredLumaIFFunctionPtrArray, PREAVX2_MASK, AvcStyleUniPredLumaIF_Avx2, AVX2_MASK),
+    RTCD_ENTRY_AVX512(PictureAverageKernel, PictureAverageArray, PREAVX2_MASK, PictureAverage_Avx512),
+    RTCD_ENTRY(BiPredAverageKernel, BiPredAverageKernel_funcPtrArray, AVX512_MASK),
+
+    // Transforms / quantization
+    RTCD_ENTRY(MatMulOut, MatMulOut_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY_AVX512(QiQ, QiQ_funcPtrArray, AVX2_MASK, QiQ_Avx512),
+    RTCD_ENTRY(MatMul, MatMul_funcPtrArray, AVX2_MASK),
+    RTCD_ENTRY(transformFunctionTableEstimate, transformFunctionTableEstimate, AVX2_MASK),
+    RTCD_ENTRY(PfreqN2TransformTable0, PfreqN2TransformTable0, AVX2_MASK),
+    RTCD_ENTRY(PfreqN2TransformTable16bit, PfreqN2TransformTable16bit, AVX2_MASK),
+    RTCD_ENTRY(PfreqN4TransformTable0, PfreqN4TransformTable0, AVX2_MASK),
+    RTCD_ENTRY(PfreqN4TransformTable16bit, PfreqN4TransformTable16bit, AVX2_MASK),
+    RTCD_ENTRY_TOP(transformFunctionTableEncode, transformFunctionTableEncode, PREAVX2_MASK, transformFunctionTableEncode_Avx2, AVX2_MASK),
+    RTCD_ENTRY(transformFunctionTableEncode16bit, transformFunctionTableEncode, PREAVX2_MASK),
+    RTCD_ENTRY_TOP(invTransformFunctionTableEstimate, invTransformFunctionTableEstimate, PREAVX2_MASK, invTransformFunctionTableEstimate_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(invTransformFunctionTableEncode, invTransformFunctionTableEncode, PREAVX2_MASK, invTransformFunctionTableEncode_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(invTransformReconFunctionTable, invTransformReconFunctionTable, PREAVX2_MASK, invTransformReconFunctionTable_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(invTransformRecon16bitFunctionTable, invTransformRecon16bitFunctionTable, PREAVX2_MASK, invTransformRecon16bitFunctionTable_Avx2, AVX2_MASK),
+    RTCD_ENTRY(CoeffRateEst4x4, CoeffRateEst4x4_funcPtrArray, PREAVX2_MASK),
+
+    // Entropy coding
+    RTCD_ENTRY(EstimateQuantizedCoefficients, EstimateQuantizedCoefficients, PREAVX2_MASK),
+    RTCD_ENTRY(EncodeQuantizedCoefficients, EncodeQuantizedCoefficientsFuncArray, PREAVX2_MASK),
+    RTCD_ENTRY(EstimateQuantizedCoefficientsUpdate, EstimateQuantizedCoefficientsUpdate, PREAVX2_MASK),
+
+    // Deblocking filter
+    RTCD_ENTRY(Luma4SampleEdgeDLFCore, Luma4SampleEdgeDLFCore_Table, PREAVX2_MASK),
+    RTCD_ENTRY(Chroma2SampleEdgeDLFCore, Chroma2SampleEdgeDLFCore_Table, PREAVX2_MASK),
+    RTCD_ENTRY(chromaDlf16bit, chromaDlf_funcPtrArray16bit, PREAVX2_MASK),
+    RTCD_ENTRY(lumaDlf16bit, lumaDlf_funcPtrArray16bit, PREAVX2_MASK),
+    RTCD_ENTRY_TOP(Luma8SampleEdgeDLFCore, Luma8SampleEdgeDLFCore_Table, PREAVX2_MASK, Luma8SampleEdgeDLFCore_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(lumaDlf8Sample16bit, lumaDlf8Sample_funcPtrArray16bit, PREAVX2_MASK, lumaDlf8Sample_Avx2_16bit, AVX2_MASK),
+
+    // Sample adaptive offset
+    RTCD_ENTRY_TOP_AVX512(SaoGatherFunctionTableLossy, SaoGatherFunctionTableLossy, PREAVX2_MASK, SaoGatherFunctionTableLossy_Avx2, AVX2_MASK, SaoGatherFunctionTableLossy_Avx512),
+    RTCD_ENTRY_TOP_AVX512(SaoGatherFunctionTableLossy_90_45_135, SaoGatherFunctionTableLossy_90_45_135, PREAVX2_MASK, SaoGatherFunctionTableLossy_90_45_135_Avx2, AVX2_MASK, SaoGatherFunctionTableLossy_90_45_135_Avx512),
+    RTCD_ENTRY_TOP_AVX512(SaoGatherFunctionTable_16bit, SaoGatherFunctionTable_16bit, PREAVX2_MASK, SaoGatherFunctionTable_16bit_Avx2, AVX2_MASK, SaoGatherFunctionTable_16bit_Avx512),
+    RTCD_ENTRY_TOP_AVX512(SaoGatherFunctionTable_90_45_135_16bit_SSE2, SaoGatherFunctionTable_90_45_135_16bit_SSE2, PREAVX2_MASK, SaoGatherFunctionTable_90_45_135_16bit_Avx2, AVX2_MASK, SaoGatherFunctionTable_90_45_135_16bit_Avx512),
+    RTCD_ENTRY_TOP(SaoFunctionTableBo, SaoFunctionTableBo, PREAVX2_MASK, SaoFunctionTableBo_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(SaoFunctionTableEO_0_90, SaoFunctionTableEO_0_90, PREAVX2_MASK, SaoFunctionTableEO_0_90_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(SaoFunctionTableEO_135_45, SaoFunctionTableEO_135_45, PREAVX2_MASK, SaoFunctionTableEO_135_45_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(SaoFunctionTableBo_16bit, SaoFunctionTableBo_16bit, PREAVX2_MASK, SaoFunctionTableBo_16bit_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(SaoFunctionTableEO_0_90_16bit, SaoFunctionTableEO_0_90_16bit, PREAVX2_MASK, SaoFunctionTableEO_0_90_16bit_Avx2, AVX2_MASK),
+    RTCD_ENTRY_TOP(SaoFunctionTableEO_135_45_16bit, SaoFunctionTableEO_135_45_16bit, PREAVX2_MASK, SaoFunctionTableEO_135_45_16bit_Avx2, AVX2_MASK),
+};
+
+#define RTCD_ENTRY_COUNT (sizeof(RtcdEntries) / sizeof(RtcdEntries[0]))
+
+/**************************************************
+* RtcdApplyOverrides
+*   Parses SVT_HEVC_RTCD="name=tier[,name=tier...]"
+*   where tier caps the kernel at RTCD_TIER_C (0),
+*   RTCD_TIER_AVX2 (1) or RTCD_TIER_AVX512 (2);
+*   "all" matches every kernel. A kernel never goes
+*   above what the CPU supports.
+**************************************************/
+static void RtcdApplyOverrides(
+    EB_U32 *maxTier)
+{
+    const char *env = getenv("SVT_HEVC_RTCD");
+
+    while (env && *env) {
+        const char *tokenEnd = strchr(env, ',');
+        const char *equal    = strchr(env, '=');
+        size_t      nameLength;
+        EB_U32      entryIndex;
+        EB_BOOL     allKernels;
+        EB_BOOL     matched = EB_FALSE;
+
+        if (tokenEnd == NULL) {
+            tokenEnd = env + strlen(env);
+        }
+
+        if (equal == NULL || equal + 2 != tokenEnd || equal[1] < '0' + RTCD_TIER_C || equal[1] > '0' + RTCD_TIER_AVX512) {
+            SVT_LOG("SVT [WARNING]: SVT_HEVC_RTCD: ignoring malformed entry \"%.*s\"\n", (int)(tokenEnd - env), env);
+        }
+        else {
+            nameLength = (size_t)(equal - env);
+            allKernels = (nameLength == 3 && strncmp(env, "all", 3) == 0) ? EB_TRUE : EB_FALSE;
+
+            for (entryIndex = 0; entryIndex < RTCD_ENTRY_COUNT; ++entryIndex) {
+                const RtcdEntry_t *entry = &RtcdEntries[entryIndex];
+
+                if (allKernels || (strlen(entry->name) == nameLength && strncmp(env, entry->name, nameLength) == 0)) {
+                    maxTier[entryIndex] = (EB_U32)(equal[1] - '0');
+                    matched = EB_TRUE;
+                }
+            }
+
+            if (!matched) {
+                SVT_LOG("SVT [WARNING]: SVT_HEVC_RTCD: unknown kernel \"%.*s\"\n", (int)nameLength, env);
+            }
+        }
+
+        env = *tokenEnd ? tokenEnd + 1 : tokenEnd;
+    }
+}
+
+/**************************************************
+* RtcdSelectRow
+*   Highest candidate row that both the CPU and
+*   maxTier allow.
+**************************************************/
+static const void* RtcdSelectRow(
+    const RtcdEntry_t *entry,
+    EB_U32             asmTypes,
+    EB_U32             maxTier)
+{
+    EB_U32 rowTier = (entry->mask & AVX512_MASK) ? RTCD_TIER_AVX512 : RTCD_TIER_AVX2;
+    EB_U32 topTier = (entry->topMask & AVX512_MASK) ? RTCD_TIER_AVX512 : RTCD_TIER_AVX2;
+
+    if (entry->avx512Row && maxTier >= RTCD_TIER_AVX512 && (asmTypes & AVX512_MASK)) {
+        return entry->avx512Row;
+    }
+    if (entry->topRow && maxTier >= topTier && (asmTypes & entry->topMask)) {
+        return entry->topRow;
+    }
+    if (maxTier >= rowTier && (asmTypes & entry->mask)) {
+        return (const EB_U8*)entry->table + entry->size;
+    }
+    return entry->table;
+}
+
+/**************************************************
+* EbRtcdSetup
+*   Copies, for every kernel, the candidate row
+*   matching asmTypes into rtcd.
+**************************************************/
+EB_ERRORTYPE EbRtcdSetup(EB_U32 asmTypes)
+{
+    EB_U32 maxTier[RTCD_ENTRY_COUNT];
+    EB_U32 entryIndex;
+
+    for (entryIndex = 0; entryIndex < RTCD_ENTRY_COUNT; ++entryIndex) {
+        const RtcdEntry_t *entry = &RtcdEntries[entryIndex];
+
+        if (entry->tableSize != entry->size * EB_ASM_TYPE_TOTAL || (entry->topRow && entry->topSize != entry->size) ||
+            (entry->avx512Row && entry->avx512Size != entry->size)) {
+            SVT_LOG("SVT [ERROR]: rtcd: %s candidate table does not match its dispatch entry\n", entry->name);
+            return EB_ErrorUndefined;
+        }
+        maxTier[entryIndex] = RTCD_TIER_AVX512;
+    }
+
+    RtcdApplyOverrides(maxTier);
+
+    for (entryIndex = 0; entryIndex < RTCD_ENTRY_COUNT; ++entryIndex) {
+        const RtcdEntry_t *entry = &RtcdEntries[entryIndex];
+
+        EB_MEMCPY(
+            (EB_U8*)&rtcd + entry->offset,
+            (EB_U8*)RtcdSelectRow(entry, asmTypes, maxTier[entryIndex]),
+            entry->size);
+    }
+
+    return EB_ErrorNone;
+}
@@ -0,0 +1,208 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+#ifndef EbRtcd_h
+#define EbRtcd_h
+
+#include "EbDefinitions.h"
+#include "EbPictureOperators.h"
+#include "EbPackUnPack.h"
+#include "EbComputeSAD.h"
+#include "EbMeSadCalculation.h"
+#include "EbMotionEstimation.h"
+#include "EbComputeMean.h"
+#include "EbPictureAnalysisProcess.h"
+#include "EbIntraPrediction.h"
+#include "EbMcp.h"
+#include "EbAvcStyleMcp.h"
+#include "EbTransforms.h"
+#include "EbEntropyCoding.h"
+#include "EbDeblockingFilter.h"
+#include "EbSampleAdaptiveOffset.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**************************************
+ * Run-time CPU dispatch table
+ *
+ * Holds the kernel selected for this CPU out of each [EB_ASM_TYPE_TOTAL]
+ * candidate table, with the ISA dimension dropped. Filled once per process
+ * by EbRtcdSetup() at the first EbInitEncoder, whose asmType then holds for
+ * every encoder instance; kernels are then called as rtcd.<kernel>[...](...)
+ * instead of indexing the candidate tables with ASM_TYPES at every call site.
+ *
+ * Kernels come in up to three tiers: C_DEFAULT, the optimized row of the
+ * candidate table (SSE..AVX2) and a top row, normally AVX-512; kernels whose
+ * optimized row stops at SSSE3 may use the top row for AVX2, with an AVX-512
+ * row above it (the SAO statistics gathers). The SVT_HEVC_RTCD
+ * environment variable caps single kernels for A/B testing, e.g.
+ * SVT_HEVC_RTCD="NxMSadKernel=0,QiQ=1" keeps NxMSadKernel on C_DEFAULT and
+ * QiQ below AVX-512 ("all=1" runs the whole encoder on the AVX2 tier).
+ *
+ * The AVX-512 tier covers part of the kernel families only: ResidualKernel
+ * and SpatialFullDistortionKernel (32x32, 64x64), QiQ (16x16, 32x32),
+ * PictureAverageKernel, BiPredAverageKernel, Compute16x16Satd_U8, the HME
+ * level 0 SAD loop, the 85 PU search point results, the 16bit unpack and
+ * the 8 and 16 bit SAO statistics gathers. Transforms, MCP interpolation,
+ * intra prediction, SAO application and deblocking have no AVX-512 row yet
+ * and run their AVX2 (or SSE) kernels at every tier.
+ **************************************/
+typedef struct EbRtcd_s
+{
+    // Picture operators
+    EB_SUM_RES                              SumResidual;
+    EB_MEMSET16bitBLK                       memset16bitBlock;
+    EB_ADDDKERNEL_TYPE                      AdditionKernel[9];
+    EB_ADDDKERNEL_TYPE_16BIT                AdditionKernel16bit;
+    EB_PICCOPY_TYPE                         PicCopyKernel[9];
+    EB_RESDKERNELSUBSAMPLED_TYPE            ResidualKernelSubSampled[9];
+    EB_RESDKERNEL_TYPE                      ResidualKernel[9];
+    EB_RESDKERNEL_TYPE_16BIT                ResidualKernel16Bit;
+    EB_ZEROCOEFF_TYPE                       PicZeroOutCoef[5];
+    EB_FULLDIST_TYPE                        FullDistortionIntrinsic[2][2][9];
+    EB_SATD_TYPE                            Compute8x8Satd;
+    EB_SATD_U8_TYPE                         Compute8x8Satd_U8;
+    EB_SATD_U8_TYPE                         Compute16x16Satd_U8;
+    EB_DECIMAVG_TYPE                        DecimateAverage[2];
+    EB_DECIMAVG_TYPE_16BIT                  DecimateAverage16bit[2];
+    EB_SPATIALFULLDIST_TYPE                 SpatialFullDistortionKernel[5];
+    EB_SPATIALFULLDIST_TYPE                 PictureSse;
+    EB_SPATIALFULLDIST16BIT_TYPE            PictureSse16bit;
+    EB_SSIMBLOCKSUMS_TYPE                   SsimBlockSums;
+    EB_SSIMBLOCKSUMS16BIT_TYPE              SsimBlockSums16bit;
+    EB_BLOCKHASH_TYPE                       BlockHash64x64;
+
+    // Pack / unpack
+    EB_ENC_Pack2D_TYPE                      Pack2D_16Bit_SRC[2];
+    EB_ENC_Pack2D_TYPE                      CompressedPack;
+    COMPPack_TYPE                           Convert_Unpack_CPack;
+    EB_ENC_UnPack2D_TYPE                    UnPack2D_16Bit[2];
+    EB_ENC_UnpackAvg_TYPE                   UnPackAvg;
+    EB_ENC_UnpackAvgSub_TYPE                UnPackAvgSafeSub;
+    EB_ENC_UnPack8BitData_TYPE              UnPack8BIT_16Bit[2];
+    EB_ENC_UnPack8BitDataSUB_TYPE           UnPack8BITSafeSub_16Bit;
+
+    // SAD
+    EB_SADKERNELNxM_TYPE                    NxMSadKernel[9];
+    EB_SADAVGKERNELNxM_TYPE                 NxMSadAveragingKernel[9];
+    EB_SADLOOPKERNELNxM_TYPE                NxMSadLoopKernel;
+    EB_SADLOOPKERNELNxM_TYPE                HmeLevel0SadLoopKernel;
+
+    // ME SAD
+    EB_SADCALCULATION8X8AND16X16_TYPE       SadCalculation_8x8_16x16;
+    EB_SADCALCULATION32X32AND64X64_TYPE     SadCalculation_32x32_64x64;
+    EB_INIALIZEBUFFER_32BITS                InitializeBuffer_32bits;
+
+    // Motion estimation
+    EB_FPSEARCH_FUNC                        GetEightHorizontalSearchPointResultsAll85PUs;
+
+    // Mean
+    EB_COMPUTE_MEAN_FUNC                    ComputeMeanFunc[2];
+    EB_COMPUTE_INTERM_VAR_FUNC              ComputeIntermVarFour8x8;
+
+    // Noise filters
+    EB_WEAKLUMAFILTER_TYPE                  WeakLumaFilter;
+    EB_WEAKLUMAFILTER_TYPE                  WeakLumaFilterLcu;
+    EB_STRONGLUMAFILTER_TYPE                StrongLumaFilter;
+    EB_STRONGCHROMAFILTER_TYPE              StrongChromaFilter;
+    EB_WEAKCHROMAFILTER_TYPE                WeakChromaFilter;
+
+    // Intra prediction
+    EB_INTRA_NOANG_TYPE                     IntraVerticalLuma;
+    EB_INTRA_NOANG_16bit_TYPE               IntraVerticalLuma_16bit;
+    EB_INTRA_NOANG_TYPE                     IntraVerticalChroma;
+    EB_INTRA_NOANG_16bit_TYPE               IntraVerticalChroma_16bit;
+    EB_INTRA_NOANG_TYPE                     IntraHorzLuma;
+    EB_INTRA_NOANG_16bit_TYPE               IntraHorzLuma_16bit;
+    EB_INTRA_NOANG_TYPE                     IntraHorzChroma;
+    EB_INTRA_NOANG_16bit_TYPE               IntraHorzChroma_16bit;
+    EB_INTRA_NOANG_TYPE                     IntraDCLuma;
+    EB_INTRA_NOANG_16bit_TYPE               IntraDCLuma_16bit;
+    EB_INTRA_NOANG_TYPE                     IntraDCChroma;
+    EB_INTRA_NOANG_16bit_TYPE               IntraDCChroma_16bit;
+    EB_INTRA_NOANG_TYPE                     IntraPlanar;
+    EB_INTRA_NOANG_16bit_TYPE               IntraPlanar_16bit;
+    EB_INTRA_NOANG_TYPE                     IntraAng34;
+    EB_INTRA_NOANG_16bit_TYPE               IntraAng34_16bit;
+    EB_INTRA_NOANG_TYPE                     IntraAng18;
+    EB_INTRA_NOANG_16bit_TYPE               IntraAng18_16bit;
+    EB_INTRA_NOANG_TYPE                     IntraAng2;
+    EB_INTRA_NOANG_16bit_TYPE               IntraAng2_16bit;
+    EB_INTRA_ANG_TYPE                       IntraAngVertical;
+    EB_INTRA_ANG_16BIT_TYPE                 IntraAngVertical_16bit;
+    EB_INTRA_ANG_TYPE                       IntraAngHorizontal;
+    EB_INTRA_ANG_16BIT_TYPE                 IntraAngHorizontal_16bit;
+    EB_INTRA_REF_FILTER_16BIT_TYPE          IntraFilterReferenceSamples16bit;
+    EB_NEIGHBOR_DC_INTRA_TYPE               UpdateNeighborDcIntraPred;
+
+    // Motion compensated prediction
+    sampleBiPredClipping                    biPredClipping;
+    sampleBiPredClipping16bit               biPredClipping16bit;
+    InterpolationFilterNew                  uniPredLumaIFNew[16];
+    InterpolationFilterNew16bit             uniPredLuma16bitIF[16];
+    InterpolationFilterOutRaw               biPredLumaIFNew[16];
+    InterpolationFilterOutRaw16bit          biPredLumaIFNew16bit[16];
+    ChromaFilterNew                         uniPredChromaIFNew[64];
+    InterpolationFilterChromaNew16bit       uniPredChromaIFNew16bit[64];
+    ChromaFilterOutRaw                      biPredChromaIFNew[64];
+    ChromaFilterOutRaw16bit                 biPredChromaIFNew16bit[64];
+
+    // AVC-style motion compensated prediction
+    AvcStyleInterpolationFilterNew          AvcStyleUniPredLumaIF[3];
+    PictureAverage                          PictureAverageKernel;
+    EB_BIAVG_FUNC                           BiPredAverageKernel;
+
+    // Transforms / quantization
+    EB_MAT_OUT_MUL_TYPE                     MatMulOut;
+    EB_QIQ_TYPE                             QiQ[5];
+    EB_MAT_MUL_TYPE                         MatMul[5];
+    EB_TRANSFORM_FUNC                       transformFunctionTableEstimate[5];
+    EB_TRANSFORM_FUNC                       PfreqN2TransformTable0[5];
+    EB_TRANSFORM_FUNC                       PfreqN2TransformTable16bit[5];
+    EB_TRANSFORM_FUNC                       PfreqN4TransformTable0[5];
+    EB_TRANSFORM_FUNC                       PfreqN4TransformTable16bit[5];
+    EB_TRANSFORM_FUNC                       transformFunctionTableEncode[5];
+    EB_TRANSFORM_FUNC                       transformFunctionTableEncode16bit[5];
+    EB_INVTRANSFORM_FUNC                    invTransformFunctionTableEstimate[5];
+    EB_INVTRANSFORM_FUNC                    invTransformFunctionTableEncode[5];
+    EB_INVTRANSFORM_RECON_FUNC              invTransformReconFunctionTable[5];
+    EB_INVTRANSFORM_RECON_16BIT_FUNC        invTransformRecon16bitFunctionTable[5];
+    PM_RATE_EST_TYPE                        CoeffRateEst4x4[2];
+
+    // Entropy coding
+    ESTIMATE_QUANTIZED_COEFF_TYPE           EstimateQuantizedCoefficients[2];
+    ENCODE_QUANTIZED_COEFF_TYPE             EncodeQuantizedCoefficients;
+    ESTIMATE_QUANTIZED_COEFF_TYPE_UPDATE    EstimateQuantizedCoefficientsUpdate;
+
+    // Deblocking filter
+    EB_LUMA4SAMPLEDGEDLF_FUNC               Luma4SampleEdgeDLFCore;
+    EB_CHROMA2SAMPLEDGEDLF_FUNC             Chroma2SampleEdgeDLFCore;
+    EB_CHROMADLF_TYPE_16BIT                 chromaDlf16bit;
+    EB_LUMADLF_TYPE_16BIT                   lumaDlf16bit;
+    EB_LUMA8SAMPLEDGEDLF_FUNC               Luma8SampleEdgeDLFCore;
+    EB_LUMA8DLF_TYPE_16BIT                  lumaDlf8Sample16bit;
+
+    // Sample adaptive offset
+    EB_SAOGATHER_FUNC                       SaoGatherFunctionTableLossy;
+    EB_SAOGATHER_90_45_135_FUNC             SaoGatherFunctionTableLossy_90_45_135;
+    EB_SAOGATHER_16bit_FUNC                 SaoGatherFunctionTable_16bit[2];
+    EB_SAOGATHER_90_45_135_16bit_SSE2_FUNC  SaoGatherFunctionTable_90_45_135_16bit_SSE2[2];
+    EB_SAOAPPLY_BO_FUNC                     SaoFunctionTableBo[2];
+    EB_SAOAPPLY_EO_0_90_FUNC                SaoFunctionTableEO_0_90[2][2];
+    EB_SAOAPPLY_EO_135_45_FUNC              SaoFunctionTableEO_135_45[2][2][2];
+    EB_SAOAPPLY_BO_16bit_FUNC               SaoFunctionTableBo_16bit[2];
+    EB_SAOAPPLY_EO_0_90_16bit_FUNC          SaoFunctionTableEO_0_90_16bit[2][2];
+    EB_SAOAPPLY_EO_135_45_16bit_FUNC        SaoFunctionTableEO_135_45_16bit[2][2];
+} EbRtcd_t;
+
+extern EbRtcd_t rtcd;
+
+extern EB_ERRORTYPE EbRtcdSetup(EB_U32 asmTypes);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // EbRtcd_h
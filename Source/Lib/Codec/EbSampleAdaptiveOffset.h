@@ -9,6 +9,8 @@
 #include "EbSampleAdaptiveOffset_C.h"
 #include "EbSampleAdaptiveOffset_SSE2.h"
 #include "EbSaoApplication_SSSE3.h"
+#include "EbSampleAdaptiveOffset_AVX2.h"
+#include "EbSampleAdaptiveOffset_AVX512.h"
 
 #include "EbDefinitions.h"
 
@@ -169,195 +171,6 @@ typedef EB_ERRORTYPE(*EB_SAOGATHER_16bit_FUNC)(
 	EB_S32                   eoDiff[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1],		// output parameter, used to store Edge Offset diff, eoDiff[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
 	EB_U16                   eoCount[SAO_EO_TYPES][SAO_EO_CATEGORIES + 1]);		// output parameter, used to store Edge Offset count, eoCount[SAO_EO_TYPES] [SAO_EO_CATEGORIES]
 
-static const EB_SAOGATHER_16bit_FUNC SaoGatherFunctionTabl_16bit[EB_ASM_TYPE_TOTAL] = {
-	// C_DEFAULT
-	GatherSaoStatisticsLcu_62x62_16bit,
-	// AVX2 
-	GatherSaoStatisticsLcu16bit_SSE2,
-
-};
-
-
-static const EB_SAOGATHER_FUNC SaoGatherFunctionTableLossy[EB_ASM_TYPE_TOTAL] = {
-    // C_DEFAULT
-    GatherSaoStatisticsLcuLossy_62x62,
-    // AVX2 
-    GatherSaoStatisticsLcu_BT_SSE2,
-};
-
-
-static const EB_SAOGATHER_90_45_135_FUNC SaoGatherFunctionTableLossy_90_45_135[EB_ASM_TYPE_TOTAL]= {
-	// C_DEFAULT
-    GatherSaoStatisticsLcu_OnlyEo_90_45_135_Lossy,
-	// AVX2 
-	GatherSaoStatisticsLcu_OnlyEo_90_45_135_BT_SSE2,
-};
-
-static const EB_SAOGATHER_90_45_135_16bit_SSE2_FUNC SaoGatherFunctionTable_90_45_135_16bit_SSE2[EB_ASM_TYPE_TOTAL][2] = {
-	// C_DEFAULT
-	{
-        GatherSaoStatisticsLcu_62x62_OnlyEo_90_45_135_16bit,
-        GatherSaoStatisticsLcu_62x62_OnlyEo_90_45_135_16bit,
-	},
-	// AVX2
-	{
-		GatherSaoStatisticsLcu_62x62_OnlyEo_90_45_135_16bit,
-		GatherSaoStatisticsLcu_OnlyEo_90_45_135_16bit_SSE2_INTRIN,
-	},
-};
-
-
-static const EB_SAOAPPLY_BO_FUNC SaoFunctionTableBo[EB_ASM_TYPE_TOTAL][2] = {
-    // C_DEFAULT
-    {
-        SAOApplyBO,
-        SAOApplyBO
-    },
-    // AVX2
-    {
-		SAOApplyBO,
-		SAOApplyBO_BT_SSSE3
-    },
-};
-
-static const EB_SAOAPPLY_EO_0_90_FUNC SaoFunctionTableEO_0_90[EB_ASM_TYPE_TOTAL][2][2] = {
-	// C_DEFAULT
-    {
-        {
-            SAOApplyEO_0,
-            SAOApplyEO_0
-        },
-        {
-            SAOApplyEO_90,
-            SAOApplyEO_90
-        }
-    },
-	// AVX2
-    {
-        {
-            SAOApplyEO_0,
-            SAOApplyEO_0_BT_SSSE3
-        },
-        {
-            SAOApplyEO_90,
-            SAOApplyEO_90_BT_SSSE3
-        }
-    },
-};
-
-static const EB_SAOAPPLY_EO_135_45_FUNC SaoFunctionTableEO_135_45[EB_ASM_TYPE_TOTAL][2][2][2] = {
-	// C_DEFAULT
-	{
-        {
-			{
-			SAOApplyEO_135,
-			SAOApplyEO_135
-			},
-			{
-			SAOApplyEO_135,
-			SAOApplyEO_135
-			}
-        },
-        {
-			{
-            SAOApplyEO_45,
-            SAOApplyEO_45
-			},
-			{
-            SAOApplyEO_45,
-            SAOApplyEO_45
-			}
-        }
-    },
-	// AVX2
-	{
-        {
-			{  
-				SAOApplyEO_135,
-                SAOApplyEO_135_BT_SSSE3
-			},
-			{ 
-				SAOApplyEO_135,
-                SAOApplyEO_135_BT_SSSE3
-			}
-
-        },
-        {
-			{
-                SAOApplyEO_45,
-                SAOApplyEO_45_BT_SSSE3
-			},
-			{
-                SAOApplyEO_45,
-				SAOApplyEO_45_BT_SSSE3
-			}
-        }
-    },
-};
-
-static const EB_SAOAPPLY_BO_16bit_FUNC SaoFunctionTableBo_16bit[EB_ASM_TYPE_TOTAL][2] = { 
-	// C_DEFAULT
-	{
-        SAOApplyBO16bit,
-        SAOApplyBO16bit
-	},
-	// AVX2
-	{
-		SAOApplyBO16bit,
-		SAOApplyBO16bit_SSE2_INTRIN
-	},
-};
-
-static const EB_SAOAPPLY_EO_0_90_16bit_FUNC SaoFunctionTableEO_0_90_16bit[EB_ASM_TYPE_TOTAL][2][2] = {
-	// C_DEFAULT
-    {
-        {
-         SAOApplyEO_0_16bit,
-         SAOApplyEO_0_16bit
-        },
-        {
-         SAOApplyEO_90_16bit,
-         SAOApplyEO_90_16bit
-        }
-    },
-	// AVX2
-    {
-        {
-         SAOApplyEO_0_16bit,
-         SAOApplyEO_0_16bit_SSE2_INTRIN
-        },
-        {
-         SAOApplyEO_90_16bit,
-         SAOApplyEO_90_16bit_SSE2_INTRIN
-        }
-    },
-};
-
-static const EB_SAOAPPLY_EO_135_45_16bit_FUNC SaoFunctionTableEO_135_45_16bit[EB_ASM_TYPE_TOTAL][2][2] = {
-	// C_DEFAULT
-    {
-        {
-			SAOApplyEO_135_16bit,
-			SAOApplyEO_135_16bit
-        },
-        {
-            SAOApplyEO_45_16bit,
-            SAOApplyEO_45_16bit
-        }
-    },
-	// AVX2
-    {
-        {
-			SAOApplyEO_135_16bit,
-            SAOApplyEO_135_16bit_SSE2_INTRIN
-        },
-        {
-			SAOApplyEO_45_16bit,
-			SAOApplyEO_45_16bit_SSE2_INTRIN
-        }
-    },
-};
-
 #ifdef __cplusplus
 }
 #endif
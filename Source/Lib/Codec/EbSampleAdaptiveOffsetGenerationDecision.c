@@ -13,6 +13,7 @@
 #include "EbSampleAdaptiveOffset.h"
 #include "EbLambdaRateTables.h"
 #include "EbReferenceObject.h"
+#include "EbRtcd.h"
 static EB_S32 MinSaoOffsetvalueEO[2 /*8bit+10bit*/][SAO_EO_CATEGORIES] = { {0, 0, -7, -7},{0,  0, -31, -31} };
 static EB_S32 MaxSaoOffsetvalueEO[2 /*8bit+10bit*/][SAO_EO_CATEGORIES] = { {7, 7,  0,  0},{31, 31, 0,    0} };
 static EB_S32 MaxSaoOffsetvalueBO[2 /*8bit+10bit*/] = { 7 , 31 };
@@ -698,7 +699,7 @@ EB_ERRORTYPE SaoGenerationDecision(
 
     if (mmSao) {
         // Y
-        SaoGatherFunctionTableLossy[(ASM_TYPES & PREAVX2_MASK) && 1](
+        rtcd.SaoGatherFunctionTableLossy(
             &(inputPicturePtr->bufferY[(inputPicturePtr->originY + tbOriginY) * inputPicturePtr->strideY + inputPicturePtr->originX + tbOriginX]),
             inputPicturePtr->strideY,
             &(reconPicturePtr->bufferY[(reconPicturePtr->originY + tbOriginY) * reconPicturePtr->strideY + reconPicturePtr->originX + tbOriginX]),
@@ -711,7 +712,7 @@ EB_ERRORTYPE SaoGenerationDecision(
             saoStats->eoCount[0]);
 
         // U
-        SaoGatherFunctionTableLossy[(ASM_TYPES & PREAVX2_MASK) && 1](
+        rtcd.SaoGatherFunctionTableLossy(
             &(inputPicturePtr->bufferCb[(((inputPicturePtr->originY + tbOriginY) * inputPicturePtr->strideCb) >> subHeightCMinus1) + ((inputPicturePtr->originX + tbOriginX) >> subWidthCMinus1)]),
             inputPicturePtr->strideCb,
             &(reconPicturePtr->bufferCb[(((reconPicturePtr->originY + tbOriginY) * reconPicturePtr->strideCb) >> subHeightCMinus1) + ((reconPicturePtr->originX + tbOriginX) >> subWidthCMinus1)]),
@@ -724,7 +725,7 @@ EB_ERRORTYPE SaoGenerationDecision(
             saoStats->eoCount[1]);
 
         // V
-        SaoGatherFunctionTableLossy[(ASM_TYPES & PREAVX2_MASK) && 1](
+        rtcd.SaoGatherFunctionTableLossy(
             &(inputPicturePtr->bufferCr[(((inputPicturePtr->originY + tbOriginY) * inputPicturePtr->strideCr) >> subHeightCMinus1) + ((inputPicturePtr->originX + tbOriginX) >> subWidthCMinus1)]),
             inputPicturePtr->strideCr,
             &(reconPicturePtr->bufferCr[(((reconPicturePtr->originY + tbOriginY) * reconPicturePtr->strideCr) >> subHeightCMinus1) + ((reconPicturePtr->originX + tbOriginX) >> subHeightCMinus1)]),
@@ -773,7 +774,7 @@ EB_ERRORTYPE SaoGenerationDecision(
         if (pictureControlSetPtr->temporalLayerIndex == 0) {
             // Y
             {
-                SaoGatherFunctionTableLossy_90_45_135[(ASM_TYPES & PREAVX2_MASK) && 1](
+                rtcd.SaoGatherFunctionTableLossy_90_45_135(
                     &(inputPicturePtr->bufferY[(inputPicturePtr->originY + tbOriginY) * inputPicturePtr->strideY + inputPicturePtr->originX + tbOriginX]),
                     inputPicturePtr->strideY,
                     &(reconPicturePtr->bufferY[(reconPicturePtr->originY + tbOriginY) * reconPicturePtr->strideY + reconPicturePtr->originX + tbOriginX]),
@@ -788,7 +789,7 @@ EB_ERRORTYPE SaoGenerationDecision(
 
         if (pictureControlSetPtr->temporalLayerIndex == 1) {
             // Y
-            SaoGatherFunctionTableLossy_90_45_135[(ASM_TYPES & PREAVX2_MASK) && 1](
+            rtcd.SaoGatherFunctionTableLossy_90_45_135(
                 &(inputPicturePtr->bufferY[(inputPicturePtr->originY + tbOriginY) * inputPicturePtr->strideY + inputPicturePtr->originX + tbOriginX]),
                 inputPicturePtr->strideY,
                 &(reconPicturePtr->bufferY[(reconPicturePtr->originY + tbOriginY) * reconPicturePtr->strideY + reconPicturePtr->originX + tbOriginX]),
@@ -991,7 +992,7 @@ EB_ERRORTYPE SaoGenerationDecision16bit(
 		// Requirement: lcuHeight > 2
 
 		// This function is only written in C. To be implemented in ASM
-		SaoGatherFunctionTabl_16bit[((lcuWidth & 15) == 0) || (lcuWidth == 28) || (lcuWidth == 56)](
+		rtcd.SaoGatherFunctionTable_16bit[((lcuWidth & 15) == 0) || (lcuWidth == 28) || (lcuWidth == 56)](
 			(EB_U16*)inputLcuPtr->bufferY,
 			inputLcuPtr->strideY,
 			(EB_U16*)(recon16->bufferY) + (recon16->originY + tbOriginY)*recon16->strideY + (recon16->originX + tbOriginX),
@@ -1004,7 +1005,7 @@ EB_ERRORTYPE SaoGenerationDecision16bit(
 			saoStats->eoCount[0]);
 
 		// U
-		SaoGatherFunctionTabl_16bit[((lcuChromaWidth & 15) == 0) || (lcuChromaWidth == 28) || (lcuChromaWidth == 56)](
+		rtcd.SaoGatherFunctionTable_16bit[((lcuChromaWidth & 15) == 0) || (lcuChromaWidth == 28) || (lcuChromaWidth == 56)](
 			(EB_U16*)inputLcuPtr->bufferCb,
 			inputLcuPtr->strideCb,
 			(EB_U16*)(recon16->bufferCb) + ((((recon16->originY + tbOriginY) * recon16->strideCb) >> subHeightCMinus1) + ((recon16->originX + tbOriginX) >> subWidthCMinus1)),
@@ -1017,7 +1018,7 @@ EB_ERRORTYPE SaoGenerationDecision16bit(
 			saoStats->eoCount[1]);
 
 		// V
-		SaoGatherFunctionTabl_16bit[((lcuChromaWidth & 15) == 0) || (lcuChromaWidth == 28) || (lcuChromaWidth == 56)](
+		rtcd.SaoGatherFunctionTable_16bit[((lcuChromaWidth & 15) == 0) || (lcuChromaWidth == 28) || (lcuChromaWidth == 56)](
 			(EB_U16*)inputLcuPtr->bufferCr,
 			inputLcuPtr->strideCr,
 			(EB_U16*)(recon16->bufferCr) + ((((recon16->originY + tbOriginY) * recon16->strideCb) >> subHeightCMinus1) + ((recon16->originX + tbOriginX) >> subWidthCMinus1)),
@@ -1069,7 +1070,7 @@ EB_ERRORTYPE SaoGenerationDecision16bit(
 			//; Requirement: lcuHeight > 2
 
 			{
-                SaoGatherFunctionTable_90_45_135_16bit_SSE2[(ASM_TYPES & PREAVX2_MASK) && 1][((lcuWidth & 15) == 0) || (lcuWidth == 28) || (lcuWidth == 56)](
+                rtcd.SaoGatherFunctionTable_90_45_135_16bit_SSE2[((lcuWidth & 15) == 0) || (lcuWidth == 28) || (lcuWidth == 56)](
                     (EB_U16*)inputLcuPtr->bufferY,
                     inputLcuPtr->strideY,
                     (EB_U16*)(recon16->bufferY) + (recon16->originY + tbOriginY)*recon16->strideY + (recon16->originX + tbOriginX),
@@ -1082,7 +1083,7 @@ EB_ERRORTYPE SaoGenerationDecision16bit(
 		}
 
 		if (pictureControlSetPtr->temporalLayerIndex == 1) {
-            SaoGatherFunctionTable_90_45_135_16bit_SSE2[(ASM_TYPES & PREAVX2_MASK) && 1][((lcuWidth & 15) == 0) || (lcuWidth == 28) || (lcuWidth == 56)](
+            rtcd.SaoGatherFunctionTable_90_45_135_16bit_SSE2[((lcuWidth & 15) == 0) || (lcuWidth == 28) || (lcuWidth == 56)](
                 (EB_U16*)inputLcuPtr->bufferY,
                 inputLcuPtr->strideY,
                 (EB_U16*)(recon16->bufferY) + (recon16->originY + tbOriginY)*recon16->strideY + (recon16->originX + tbOriginX),
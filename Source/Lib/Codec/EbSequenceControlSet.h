@@ -141,6 +141,8 @@ typedef struct SequenceControlSet_s
 	EB_U32						pictureControlSetPoolInitCount;      
 	EB_U32						pictureControlSetPoolInitCountChild; 
 	EB_U32						paReferencePictureBufferInitCount;
+	EB_U32						halfPelPlanesBufferInitCount;
+	EB_U32						blockHashIndexBufferInitCount;
 	EB_U32						referencePictureBufferInitCount;
     EB_U32                      reconBufferFifoInitCount;
 	EB_U32						inputOutputBufferFifoInitCount;
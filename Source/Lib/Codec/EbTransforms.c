@@ -11,6 +11,7 @@
 #include "EbTransforms.h"
 #include "EbEncDecProcess.h"
 #include "EbLambdaRateTables.h"
+#include "EbRtcd.h"
 
 static inline EB_U32 CheckNZero4x4(
 	EB_S16  *coeff,
@@ -70,53 +71,6 @@ void MatMultOut(
 	}
 }
 
-EB_ERRORTYPE PmEstimateQuantCoeffLuma_SSE2(
-	CabacCost_t                  *CabacCost,
-	CabacEncodeContext_t         *cabacEncodeCtxPtr,
-	EB_U32                        size,                 // Input: TU size
-	EB_MODETYPE                   type,                 // Input: CU type (INTRA, INTER)
-	EB_U32                        intraLumaMode,
-	EB_U32                        intraChromaMode,
-	EB_S16                       *coeffBufferPtr,
-	const EB_U32                  coeffStride,
-	EB_U32                        componentType,
-	EB_U32                        numNonZeroCoeffs,
-	EB_U64                       *coeffBitsLong);
-
-EB_ERRORTYPE PmEstimateQuantCoeffChroma_SSE2(
-	CabacCost_t                  *CabacCost,
-	CabacEncodeContext_t         *cabacEncodeCtxPtr,
-	EB_U32                        size,                 // Input: TU size
-	EB_MODETYPE                   type,                 // Input: CU type (INTRA, INTER)
-	EB_U32                        intraLumaMode,
-	EB_U32                        intraChromaMode,
-	EB_S16                       *coeffBufferPtr,
-	const EB_U32                  coeffStride,
-	EB_U32                        componentType,
-	EB_U32                        numNonZeroCoeffs,
-	EB_U64                       *coeffBitsLong);
-
-
-typedef EB_ERRORTYPE(*PM_RATE_EST_TYPE)(
-	CabacCost_t                  *CabacCost,	
-	CabacEncodeContext_t         *cabacEncodeCtxPtr,
-	EB_U32                        size,  
-	EB_MODETYPE                   type,                 // Input: CU type (INTRA, INTER)
-	EB_U32                        intraLumaMode,
-	EB_U32                        intraChromaMode,
-	EB_S16                       *coeffBufferPtr,
-	const EB_U32                  coeffStride,
-	EB_U32                        componentType,
-	EB_U32                        numNonZeroCoeffs,
-	EB_U64                       *coeffBitsLong);
-
-static PM_RATE_EST_TYPE FUNC_TABLE CoeffRateEst4x4_funcPtrArray[EB_ASM_TYPE_TOTAL][2/*Luma+Chroma*/] =
-{
-	{ EstimateQuantizedCoefficients_Lossy, EstimateQuantizedCoefficients_Lossy },
-	{ PmEstimateQuantCoeffLuma_SSE2, PmEstimateQuantCoeffChroma_SSE2 }
-};
-
-
 /*****************************
  * function header
  *****************************/
@@ -2195,7 +2149,7 @@ void MaskTransformCoeffs(
 	
 	depthIndex = depthIndex < 4 ? depthIndex : 0;
 
-	MatMul_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][activeAreaSize >> 3](
+	rtcd.MatMul[activeAreaSize >> 3](
         coeff,
         coeffStride,
         &MaskingMatrix[pmpMaskingClass][pmpMaskingLevelEncDec][depthIndex][0],
@@ -2278,7 +2232,7 @@ void PerformTwoStagePm(
     *yCountNonZeroCoeffs = 0;
 
     // Do the Quantization to avoid extra compute for areas without non zero coefficient
-	QiQ_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][activeAreaSize >> 3](
+	rtcd.QiQ[activeAreaSize >> 3](
         coeff,
         coeffStride,
         quantCoeff,
@@ -2511,7 +2465,7 @@ void PerformTwoStagePm(
                         EbPMCand_t  *pmCand = &pmCandBuffer[canDi];
 						
 						//There is Mismatch between ASM vs C !
-						MatMulOut_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+						rtcd.MatMulOut(
 							&coeff[blkOffset],
 							coeffStride,
 							pmCand->trCoeff,
@@ -2529,7 +2483,7 @@ void PerformTwoStagePm(
 						}
 
 
-						QiQ_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][blkAreaSize >> 3](
+						rtcd.QiQ[blkAreaSize >> 3](
                             pmCand->trCoeff,
                             PM_STRIDE,
                             pmCand->quCoeff,
@@ -2547,7 +2501,7 @@ void PerformTwoStagePm(
 						EB_U64 sse[2];
                         EB_U64 coeffBits = 0;
 
-						FullDistortionIntrinsic_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][pmCand->nzCoeff != 0][1][blkAreaSize >> 3](
+						rtcd.FullDistortionIntrinsic[pmCand->nzCoeff != 0][1][blkAreaSize >> 3](
                             &coeff[blkOffset],
                             coeffStride,
                             pmCand->iqCoeff,
@@ -2561,7 +2515,7 @@ void PerformTwoStagePm(
                         sse[DIST_CALC_RESIDUAL] = (sse[DIST_CALC_RESIDUAL] + (EB_U64)(1 << (shift - 1))) >> shift;
 
 						if (pmCand->nzCoeff)						
-							CoeffRateEst4x4_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][componentType != COMPONENT_LUMA](
+							rtcd.CoeffRateEst4x4[componentType != COMPONENT_LUMA](
 								pictureControlSetPtr->cabacCost,
 								NULL,
 								4,
@@ -2643,7 +2597,7 @@ void DecoupledQuantizeInvQuantizeLoops(
 	adptive_qp_offset = q_offset;
 	coeffLocation = 0;
 	*nonzerocoeff = 0;
-	QiQ_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][areaSize >> 3](
+	rtcd.QiQ[areaSize >> 3](
 		coeff,
         coeffStride,
         quantCoeff,
@@ -2702,7 +2656,7 @@ void DecoupledQuantizeInvQuantizeLoops(
 
                         coeffBitsLong = 0;
                         if (*nonzerocoeff) {
-                            EstimateQuantizedCoefficients[1][(ASM_TYPES & PREAVX2_MASK) && 1](
+                            rtcd.EstimateQuantizedCoefficients[1](
                                 CabacCost,
                                 cabacEncodeCtxPtr,
                                 areaSize,
@@ -2825,7 +2779,7 @@ void DecoupledQuantizeInvQuantizeLoops(
 						EbPMCand_t  *pmCand = &pmCandBuffer[canDi];
 
 						//There is Mismatch between ASM vs C !
-						MatMulOut_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+						rtcd.MatMulOut(
 							&coeff[blkOffset],
 							coeffStride,
 							pmCand->trCoeff,
@@ -2843,7 +2797,7 @@ void DecoupledQuantizeInvQuantizeLoops(
 						}
 
 
-						QiQ_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][blkAreaSize >> 3](
+						rtcd.QiQ[blkAreaSize >> 3](
 							pmCand->trCoeff,
 							PM_STRIDE,
 							pmCand->quCoeff,
@@ -2861,7 +2815,7 @@ void DecoupledQuantizeInvQuantizeLoops(
 						EB_U64 sse[2];
 						EB_U64 coeffBits = 0;
 
-						FullDistortionIntrinsic_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][pmCand->nzCoeff != 0][1][blkAreaSize >> 3](
+						rtcd.FullDistortionIntrinsic[pmCand->nzCoeff != 0][1][blkAreaSize >> 3](
 							&coeff[blkOffset],
 							coeffStride,
 							pmCand->iqCoeff,
@@ -2875,7 +2829,7 @@ void DecoupledQuantizeInvQuantizeLoops(
 						sse[DIST_CALC_RESIDUAL] = (sse[DIST_CALC_RESIDUAL] + (EB_U64)(1 << (shift - 1))) >> shift;
 
 						if (pmCand->nzCoeff)
-							CoeffRateEst4x4_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][componentType != COMPONENT_LUMA](
+							rtcd.CoeffRateEst4x4[componentType != COMPONENT_LUMA](
 							CabacCost,
 							NULL,
 							4,
@@ -3107,7 +3061,7 @@ void UnifiedQuantizeInvQuantize(
             }
             //QiQ SSSE3 is hardcoded 
             //QiQ   Use this for SW	
-			QiQ_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][activeAreaSize >> 3](
+			rtcd.QiQ[activeAreaSize >> 3](
                 coeff,
                 coeffStride,
                 quantCoeff,
@@ -3148,7 +3102,7 @@ void UnifiedQuantizeInvQuantize(
 
             } else {
 
-				QiQ_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1][activeAreaSize >> 3](
+				rtcd.QiQ[activeAreaSize >> 3](
                     coeff,
                     coeffStride,
                     quantCoeff,
@@ -3252,7 +3206,7 @@ EB_ERRORTYPE EstimateTransform(
     EB_U32 transformSizeFlag = Log2f(TRANSFORM_MAX_SIZE) - Log2f(transformSize);
 
     if (transCoeffShape == DEFAULT_SHAPE) {
-		(*transformFunctionTableEstimate[(ASM_TYPES & AVX2_MASK) && 1][transformSizeFlag + dstTansformFlag])(
+		(*rtcd.transformFunctionTableEstimate[transformSizeFlag + dstTansformFlag])(
             residualBuffer,
             residualStride,
             coeffBuffer,
@@ -3264,7 +3218,7 @@ EB_ERRORTYPE EstimateTransform(
 
     else if (transCoeffShape == N2_SHAPE) {
 
-		(*PfreqN2TransformTable0[(ASM_TYPES & AVX2_MASK) && 1][transformSizeFlag + dstTansformFlag])(
+		(*rtcd.PfreqN2TransformTable0[transformSizeFlag + dstTansformFlag])(
             residualBuffer,
             residualStride,
             coeffBuffer,
@@ -3275,7 +3229,7 @@ EB_ERRORTYPE EstimateTransform(
 
     else if (transCoeffShape == N4_SHAPE) {
 
-		(*PfreqN4TransformTable0[(ASM_TYPES & AVX2_MASK) && 1][transformSizeFlag + dstTansformFlag])(
+		(*rtcd.PfreqN4TransformTable0[transformSizeFlag + dstTansformFlag])(
             residualBuffer,
             residualStride,
             coeffBuffer,
@@ -3287,7 +3241,7 @@ EB_ERRORTYPE EstimateTransform(
 
         EB_S32 sumResidual;
 
-		sumResidual = SumResidual_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		sumResidual = rtcd.SumResidual(
             residualBuffer,
             transformSize,
             residualStride);
@@ -3325,78 +3279,42 @@ EB_ERRORTYPE EncodeTransform(
 
     EB_U32 transformSizeFlag = Log2f(TRANSFORM_MAX_SIZE) - Log2f(transformSize);
 
+    // 10-bit residuals (bitIncrement & 2) overflow the 8-bit AVX2 kernels
     if (transCoeffShape == DEFAULT_SHAPE) {
-        if (!(((ASM_TYPES & AVX2_MASK) && 1))) { // C Only
-            (*transformFunctionTableEncode0[((ASM_TYPES & PREAVX2_MASK) && 1)][transformSizeFlag + dstTransformFlag])(
-                residualBuffer,
-                residualStride,
-                coeffBuffer,
-                coeffStride,
-                transformInnerArrayPtr,
-                bitIncrement
-                );
-        }
-        else {
-            (*transformFunctionTableEncode1[/*ASM_TYPES*/((bitIncrement & 2) ? EB_ASM_NON_AVX2 : ((ASM_TYPES & PREAVX2_MASK) && 1))][transformSizeFlag + dstTransformFlag])(
-                residualBuffer,
-                residualStride,
-                coeffBuffer,
-                coeffStride,
-                transformInnerArrayPtr,
-                bitIncrement
-                );
-        }
+        (*((bitIncrement & 2) ? rtcd.transformFunctionTableEncode16bit : rtcd.transformFunctionTableEncode)[transformSizeFlag + dstTransformFlag])(
+            residualBuffer,
+            residualStride,
+            coeffBuffer,
+            coeffStride,
+            transformInnerArrayPtr,
+            bitIncrement);
     }
 
     else if (transCoeffShape == N2_SHAPE) {
-            if (!(((ASM_TYPES & AVX2_MASK) && 1))) { // C Only
-                (*PfreqN2TransformTable0[((ASM_TYPES & AVX2_MASK) && 1)][transformSizeFlag + dstTransformFlag])(
-                    residualBuffer,
-                    residualStride,
-                    coeffBuffer,
-                    coeffStride,
-                    transformInnerArrayPtr,
-                    bitIncrement
-                    );
-            }
-            else {
-                (*PfreqN2TransformTable1[/*ASM_TYPES*/((bitIncrement & 2) ? EB_ASM_NON_AVX2 : ((ASM_TYPES & AVX2_MASK) && 1))][transformSizeFlag + dstTransformFlag])(
-                    residualBuffer,
-                    residualStride,
-                    coeffBuffer,
-                    coeffStride,
-                    transformInnerArrayPtr,
-                    bitIncrement
-                    );
-            }
+        (*((bitIncrement & 2) ? rtcd.PfreqN2TransformTable16bit : rtcd.PfreqN2TransformTable0)[transformSizeFlag + dstTransformFlag])(
+            residualBuffer,
+            residualStride,
+            coeffBuffer,
+            coeffStride,
+            transformInnerArrayPtr,
+            bitIncrement);
     }
 
     else if (transCoeffShape == N4_SHAPE) {
-        if (!(((ASM_TYPES & AVX2_MASK) && 1))) { // C Only
-            (*PfreqN4TransformTable0[(ASM_TYPES & AVX2_MASK) && 1][transformSizeFlag + dstTransformFlag])(
-                residualBuffer,
-                residualStride,
-                coeffBuffer,
-                coeffStride,
-                transformInnerArrayPtr,
-                bitIncrement);
-        }
-        else {
-            (*PfreqN4TransformTable1[/*ASM_TYPES*/((bitIncrement & 2) ? EB_ASM_NON_AVX2 : ((ASM_TYPES & AVX2_MASK) && 1))][transformSizeFlag + dstTransformFlag])(
-                residualBuffer,
-                residualStride,
-                coeffBuffer,
-                coeffStride,
-                transformInnerArrayPtr,
-                bitIncrement);
-        }
+        (*((bitIncrement & 2) ? rtcd.PfreqN4TransformTable16bit : rtcd.PfreqN4TransformTable0)[transformSizeFlag + dstTransformFlag])(
+            residualBuffer,
+            residualStride,
+            coeffBuffer,
+            coeffStride,
+            transformInnerArrayPtr,
+            bitIncrement);
     }
 
     else { // transCoeffShape == ONLY_DC_SHAPE
 
         EB_S32 sumResidual;
 
-		sumResidual = SumResidual_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		sumResidual = rtcd.SumResidual(
             residualBuffer,
             transformSize,
             residualStride);
@@ -3442,7 +3360,7 @@ EB_ERRORTYPE EstimateInvTransform(
     //   but in order to avoid extra copying, it is overwritten in place. The
     //   input(residualBuffer) is the LCU residual buffer
     if (partialFrequencyN2Flag == EB_FALSE) {
-		(*invTransformFunctionTableEstimate[(ASM_TYPES & PREAVX2_MASK) && 1][transformSizeFlag + dstTransformFlag])(
+		(*rtcd.invTransformFunctionTableEstimate[transformSizeFlag + dstTransformFlag])(
             coeffBuffer,
             coeffStride,
             reconBuffer,
@@ -3498,7 +3416,7 @@ EB_ERRORTYPE EncodeInvTransform(
         invTranformedDcCoef = (EB_S16) CLIP3(MIN_NEG_16BIT_NUM, MAX_POS_16BIT_NUM,((64 * dcCoef + offset1st) >> shift1st));
         invTranformedDcCoef = (EB_S16) CLIP3(MIN_NEG_16BIT_NUM, MAX_POS_16BIT_NUM,((64 * invTranformedDcCoef + offset2nd) >> shift2nd));
 
-		memset16bitBlock_funcPtrArray[(ASM_TYPES & AVX2_MASK) && 1](
+		rtcd.memset16bitBlock(
             reconBuffer,
             reconStride,
             transformSize,
@@ -3512,7 +3430,7 @@ EB_ERRORTYPE EncodeInvTransform(
         // The input of this function is the quantized_inversequantized transformed residual
         //   but in order to avoid extra copying, it is overwritten in place. The
         //   input(residualBuffer) is the LCU residual buffer
-		(*invTransformFunctionTableEncode[(ASM_TYPES & PREAVX2_MASK) && 1][transformSizeFlag + dstTransformFlag])(
+		(*rtcd.invTransformFunctionTableEncode[transformSizeFlag + dstTransformFlag])(
             coeffBuffer,
             coeffStride,
             reconBuffer,
@@ -3523,6 +3441,314 @@ EB_ERRORTYPE EncodeInvTransform(
     return return_error;
 }
 
+/*********************************************************************
+ * Encode Inverse Transform + Reconstruction
+ *   The residual is added to the prediction and clipped to the sample
+ *   range; the coefficient buffer may be used as scratch.
+ *********************************************************************/
+EB_ERRORTYPE EncodeInvTransformRecon(
+    EB_BOOL      isOnlyDc,
+    EB_S16      *coeffBuffer,
+    EB_U32       coeffStride,
+    EB_U8       *predBuffer,
+    EB_U32       predStride,
+    EB_U8       *reconBuffer,
+    EB_U32       reconStride,
+    EB_U32       transformSize,
+    EB_S16      *transformInnerArrayPtr,
+    EB_BOOL      dstTransformFlag)
+{
+    EB_ERRORTYPE return_error = EB_ErrorNone;
+
+    EB_U32 transformSizeFlag = Log2f(TRANSFORM_MAX_SIZE) - Log2f(transformSize);
+
+    if (isOnlyDc) {
+        EncodeInvTransform(
+            EB_TRUE,
+            coeffBuffer,
+            coeffStride,
+            coeffBuffer,
+            coeffStride,
+            transformSize,
+            transformInnerArrayPtr,
+            BIT_INCREMENT_8BIT,
+            dstTransformFlag);
+
+        rtcd.AdditionKernel[transformSize >> 3](
+            predBuffer,
+            predStride,
+            coeffBuffer,
+            coeffStride,
+            reconBuffer,
+            reconStride,
+            transformSize,
+            transformSize);
+    }
+    else {
+        rtcd.invTransformReconFunctionTable[transformSizeFlag + dstTransformFlag](
+            coeffBuffer,
+            coeffStride,
+            predBuffer,
+            predStride,
+            reconBuffer,
+            reconStride,
+            transformInnerArrayPtr,
+            BIT_INCREMENT_8BIT);
+    }
+
+    return return_error;
+}
+
+EB_ERRORTYPE EncodeInvTransformRecon16bit(
+    EB_BOOL      isOnlyDc,
+    EB_S16      *coeffBuffer,
+    EB_U32       coeffStride,
+    EB_U16      *predBuffer,
+    EB_U32       predStride,
+    EB_U16      *reconBuffer,
+    EB_U32       reconStride,
+    EB_U32       transformSize,
+    EB_S16      *transformInnerArrayPtr,
+    EB_BOOL      dstTransformFlag)
+{
+    EB_ERRORTYPE return_error = EB_ErrorNone;
+
+    EB_U32 transformSizeFlag = Log2f(TRANSFORM_MAX_SIZE) - Log2f(transformSize);
+
+    if (isOnlyDc) {
+        EncodeInvTransform(
+            EB_TRUE,
+            coeffBuffer,
+            coeffStride,
+            coeffBuffer,
+            coeffStride,
+            transformSize,
+            transformInnerArrayPtr,
+            BIT_INCREMENT_10BIT,
+            dstTransformFlag);
+
+        rtcd.AdditionKernel16bit(
+            predBuffer,
+            predStride,
+            coeffBuffer,
+            coeffStride,
+            reconBuffer,
+            reconStride,
+            transformSize,
+            transformSize);
+    }
+    else {
+        rtcd.invTransformRecon16bitFunctionTable[transformSizeFlag + dstTransformFlag](
+            coeffBuffer,
+            coeffStride,
+            predBuffer,
+            predStride,
+            reconBuffer,
+            reconStride,
+            transformInnerArrayPtr,
+            BIT_INCREMENT_10BIT);
+    }
+
+    return return_error;
+}
+
+/*********************************************************************
+ * Inverse Transform + Reconstruction kernels without a fused version
+ *   Run the selected inverse transform in place, then the selected
+ *   addition kernel
+ *********************************************************************/
+static void InvTransformReconComposed(
+    EB_S16      *transformCoefficients,
+    EB_U32       srcStride,
+    EB_U8       *predPtr,
+    EB_U32       predStride,
+    EB_U8       *reconPtr,
+    EB_U32       reconStride,
+    EB_S16      *transformInnerArrayPtr,
+    EB_U32       bitIncrement,
+    EB_U32       transformSize,
+    EB_BOOL      dstTransformFlag)
+{
+    rtcd.invTransformFunctionTableEncode[Log2f(TRANSFORM_MAX_SIZE) - Log2f(transformSize) + dstTransformFlag](
+        transformCoefficients,
+        srcStride,
+        transformCoefficients,
+        srcStride,
+        transformInnerArrayPtr,
+        bitIncrement);
+
+    rtcd.AdditionKernel[transformSize >> 3](
+        predPtr,
+        predStride,
+        transformCoefficients,
+        srcStride,
+        reconPtr,
+        reconStride,
+        transformSize,
+        transformSize);
+}
+
+static void InvTransformReconComposed16bit(
+    EB_S16      *transformCoefficients,
+    EB_U32       srcStride,
+    EB_U16      *predPtr,
+    EB_U32       predStride,
+    EB_U16      *reconPtr,
+    EB_U32       reconStride,
+    EB_S16      *transformInnerArrayPtr,
+    EB_U32       bitIncrement,
+    EB_U32       transformSize,
+    EB_BOOL      dstTransformFlag)
+{
+    rtcd.invTransformFunctionTableEncode[Log2f(TRANSFORM_MAX_SIZE) - Log2f(transformSize) + dstTransformFlag](
+        transformCoefficients,
+        srcStride,
+        transformCoefficients,
+        srcStride,
+        transformInnerArrayPtr,
+        bitIncrement);
+
+    rtcd.AdditionKernel16bit(
+        predPtr,
+        predStride,
+        transformCoefficients,
+        srcStride,
+        reconPtr,
+        reconStride,
+        transformSize,
+        transformSize);
+}
+
+void InvTransformRecon32x32(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 32, EB_FALSE);
+}
+
+void InvTransformRecon16x16(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 16, EB_FALSE);
+}
+
+void InvTransformRecon8x8(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 8, EB_FALSE);
+}
+
+void InvTransformRecon4x4(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 4, EB_FALSE);
+}
+
+void InvDstTransformRecon4x4(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 4, EB_TRUE);
+}
+
+void InvTransformRecon32x32_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed16bit(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 32, EB_FALSE);
+}
+
+void InvTransformRecon16x16_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed16bit(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 16, EB_FALSE);
+}
+
+void InvTransformRecon8x8_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed16bit(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 8, EB_FALSE);
+}
+
+void InvTransformRecon4x4_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed16bit(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 4, EB_FALSE);
+}
+
+void InvDstTransformRecon4x4_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement)
+{
+    InvTransformReconComposed16bit(transformCoefficients, srcStride, predPtr, predStride, reconPtr, reconStride, transformInnerArrayPtr, bitIncrement, 4, EB_TRUE);
+}
+
 /*********************************************************************
  * Calculate CBF
  *********************************************************************/
@@ -3599,21 +3825,21 @@ void PfZeroOutUselessQuadrants(
     EB_U32  transformCoeffStride,
     EB_U32  quadrantSize) {
 
-    PicZeroOutCoef_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][quadrantSize >> 3](
+    rtcd.PicZeroOutCoef[quadrantSize >> 3](
         transformCoeffBuffer,
         transformCoeffStride,
         quadrantSize,
         quadrantSize,
         quadrantSize);
 
-    PicZeroOutCoef_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][quadrantSize >> 3](
+    rtcd.PicZeroOutCoef[quadrantSize >> 3](
         transformCoeffBuffer,
         transformCoeffStride,
         quadrantSize * transformCoeffStride,
         quadrantSize,
         quadrantSize);
 
-    PicZeroOutCoef_funcPtrArray[(ASM_TYPES & PREAVX2_MASK) && 1][quadrantSize >> 3](
+    rtcd.PicZeroOutCoef[quadrantSize >> 3](
         transformCoeffBuffer,
         transformCoeffStride,
         quadrantSize * transformCoeffStride + quadrantSize,
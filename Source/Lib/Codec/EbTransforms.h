@@ -11,6 +11,7 @@
 #include "EbTransforms_SSSE3.h"
 #include "EbTransforms_SSE4_1.h"
 #include "EbTransforms_AVX2.h"
+#include "EbTransforms_AVX512.h"
 #include "EbSequenceControlSet.h"
 #include "EbPictureControlSet.h"
 
@@ -162,6 +163,30 @@ extern EB_ERRORTYPE EncodeInvTransform(
     EB_U32       bitIncrement,
     EB_BOOL      dstTransformFlag);
 
+extern EB_ERRORTYPE EncodeInvTransformRecon(
+    EB_BOOL      isOnlyDc,
+    EB_S16      *coeffBuffer,
+    EB_U32       coeffStride,
+    EB_U8       *predBuffer,
+    EB_U32       predStride,
+    EB_U8       *reconBuffer,
+    EB_U32       reconStride,
+    EB_U32       transformSize,
+    EB_S16      *transformInnerArrayPtr,
+    EB_BOOL      dstTransformFlag);
+
+extern EB_ERRORTYPE EncodeInvTransformRecon16bit(
+    EB_BOOL      isOnlyDc,
+    EB_S16      *coeffBuffer,
+    EB_U32       coeffStride,
+    EB_U16      *predBuffer,
+    EB_U32       predStride,
+    EB_U16      *reconBuffer,
+    EB_U32       reconStride,
+    EB_U32       transformSize,
+    EB_S16      *transformInnerArrayPtr,
+    EB_BOOL      dstTransformFlag);
+
 extern EB_ERRORTYPE CalculateCbf(
     EB_S16      *buffer,
     EB_U32       stride,
@@ -267,14 +292,6 @@ void MatMultOut(
 	const EB_S32     shiftNum,
 	EB_U32			 *nonzerocoeff);
 
-static EB_MAT_OUT_MUL_TYPE FUNC_TABLE MatMulOut_funcPtrArray[EB_ASM_TYPE_TOTAL] =
-{
-	  MatMultOut,
-	  MatMult4x4_OutBuff_AVX2_INTRIN,
-};
-
-
-
 typedef void(*EB_TRANSFORM_FUNC)(
     EB_S16                  *residual,
     const EB_U32             srcStride,
@@ -291,222 +308,165 @@ typedef void(*EB_INVTRANSFORM_FUNC)(
     EB_S16                  *transformInnerArrayPtr,
     EB_U32                   bitIncrement);
 
-/*****************************
-* Function Tables
-*****************************/
-static EB_QIQ_TYPE FUNC_TABLE QiQ_funcPtrArray[EB_ASM_TYPE_TOTAL][5] = {
-	// C_DEFAULT
-	{
-        /*0 4x4   */     QuantizeInvQuantize,
-        /*1 8x8   */     QuantizeInvQuantize,
-        /*2 16x16 */     QuantizeInvQuantize,
-        /*3       */     (EB_QIQ_TYPE)QiQVoidFunc,
-        /*4 32x32 */     QuantizeInvQuantize
-	},
-	// AVX2
-	{
-		/*0 4x4   */    QuantizeInvQuantize4x4_SSE3,
-		/*1 8x8   */	 QuantizeInvQuantize8x8_AVX2_INTRIN,
-		/*2 16x16 */	 QuantizeInvQuantizeNxN_AVX2_INTRIN,
-		/*3       */    (EB_QIQ_TYPE)QiQVoidFunc,
-		/*4 32x32 */	 QuantizeInvQuantizeNxN_AVX2_INTRIN,
-
-	},
-};
+// Inverse transform followed by the addition of the prediction and clipping
+typedef void(*EB_INVTRANSFORM_RECON_FUNC)(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static EB_MAT_MUL_TYPE FUNC_TABLE MatMul_funcPtrArray[EB_ASM_TYPE_TOTAL][5] = {
-    // C_DEFAULT
-    {
-        /*0 4x4   */     MatMult,
-        /*1 8x8   */     MatMult,
-        /*2 16x16 */     MatMult,
-        /*3 16x16 */     MatMult,
-        /*4 32x32 */     MatMult
-    },
-    // AVX2
-    {
-        /*0 4x4   */     MatMult4x4_AVX2_INTRIN,
-        /*1 8x8   */     MatMult8x8_AVX2_INTRIN,
-        /*2 16x16 */     MatMultNxN_AVX2_INTRIN,
-        /*3 16x16 */     MatMultNxN_AVX2_INTRIN,
-        /*4 32x32 */     MatMultNxN_AVX2_INTRIN
-    },
+typedef void(*EB_INVTRANSFORM_RECON_16BIT_FUNC)(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
+extern void InvTransformRecon32x32(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-};
+extern void InvTransformRecon16x16(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static const EB_TRANSFORM_FUNC transformFunctionTableEstimate[EB_ASM_TYPE_TOTAL][5] = {
-        // C_DEFAULT
-        {
-	    	Transform32x32Estimate,
-		    Transform16x16Estimate,
-            Transform8x8,
-            Transform4x4,
-            DstTransform4x4
-        },
-        // AVX2
-        {
-            lowPrecisionTransform32x32_AVX2_INTRIN,
-            lowPrecisionTransform16x16_AVX2_INTRIN,
-            Transform8x8_SSE4_1_INTRIN,
-            Transform4x4_SSE2_INTRIN,
-            DstTransform4x4_SSE2_INTRIN
-        },
-};
+extern void InvTransformRecon8x8(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static const EB_TRANSFORM_FUNC PfreqN2TransformTable0[EB_ASM_TYPE_TOTAL][5] = {
-    // NON_AVX2
-    {
-        Transform32x32Estimate,
-        Transform16x16Estimate,
-        Transform8x8,
-        Transform4x4,
-        DstTransform4x4
-
-    },
-    // AVX2
-    {
-        PfreqTransform32x32_AVX2_INTRIN,
-        PfreqTransform16x16_SSE2,
-        PfreqTransform8x8_SSE4_1_INTRIN,
-        Transform4x4_SSE2_INTRIN,
-        DstTransform4x4_SSE2_INTRIN
-    }
-};
+extern void InvTransformRecon4x4(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static const EB_TRANSFORM_FUNC PfreqN2TransformTable1[EB_ASM_TYPE_TOTAL][5] = {
-    // NON_AVX2
-    {
-        PfreqTransform32x32_SSE2,
-        PfreqTransform16x16_SSE2,
-        PfreqTransform8x8_SSE2_INTRIN,
-        Transform4x4_SSE2_INTRIN,
-        DstTransform4x4_SSE2_INTRIN
-
-    },
-    // AVX2
-    {
-        PfreqTransform32x32_AVX2_INTRIN,
-        PfreqTransform16x16_SSE2,
-        PfreqTransform8x8_SSE4_1_INTRIN,
-        Transform4x4_SSE2_INTRIN,
-        DstTransform4x4_SSE2_INTRIN
-    }
-};
+extern void InvDstTransformRecon4x4(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U8                   *predPtr,
+    const EB_U32             predStride,
+    EB_U8                   *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static const EB_TRANSFORM_FUNC PfreqN4TransformTable0[EB_ASM_TYPE_TOTAL][5] = {
-    // NON_AVX2
-    {
-        Transform32x32Estimate,
-        Transform16x16Estimate,
-        Transform8x8,
-        Transform4x4,
-        DstTransform4x4
-    },
-    // AVX2
-    {
-        PfreqN4Transform32x32_AVX2_INTRIN,
-        PfreqN4Transform16x16_SSE2,
-        PfreqN4Transform8x8_SSE4_1_INTRIN,
-        Transform4x4_SSE2_INTRIN,
-        DstTransform4x4_SSE2_INTRIN
-    }
-};
+extern void InvTransformRecon32x32_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static const EB_TRANSFORM_FUNC PfreqN4TransformTable1[EB_ASM_TYPE_TOTAL][5] = {
-    // NON_AVX2
-    {
-        PfreqN4Transform32x32_SSE2,
-        PfreqN4Transform16x16_SSE2,
-        PfreqN4Transform8x8_SSE2_INTRIN,
-        Transform4x4_SSE2_INTRIN,
-        DstTransform4x4_SSE2_INTRIN
-    },
-    // AVX2
-    {
-        PfreqN4Transform32x32_AVX2_INTRIN,
-        PfreqN4Transform16x16_SSE2,
-        PfreqN4Transform8x8_SSE4_1_INTRIN,
-        Transform4x4_SSE2_INTRIN,
-        DstTransform4x4_SSE2_INTRIN
-    }
-};
+extern void InvTransformRecon16x16_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static const EB_TRANSFORM_FUNC transformFunctionTableEncode0[EB_ASM_TYPE_TOTAL][5] = {
-    // NON_AVX2
-    {
-        Transform32x32Estimate,
-        Transform16x16Estimate,
-        Transform8x8,
-        Transform4x4,
-        DstTransform4x4
-    },
-    // AVX2
-    {
-        Transform32x32_SSE2,
-        Transform16x16_SSE2,
-        Transform8x8_SSE4_1_INTRIN,
-        Transform4x4_SSE2_INTRIN,
-        DstTransform4x4_SSE2_INTRIN
-    },
-};
+extern void InvTransformRecon8x8_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static const EB_TRANSFORM_FUNC transformFunctionTableEncode1[EB_ASM_TYPE_TOTAL][5] = {
-    // NON_AVX2
-    {
-        Transform32x32_SSE2,
-        Transform16x16_SSE2,
-        Transform8x8_SSE2_INTRIN,
-        Transform4x4_SSE2_INTRIN,
-        DstTransform4x4_SSE2_INTRIN
-    },
-    // AVX2
-    {
-        Transform32x32_SSE2,
-        Transform16x16_SSE2,
-        Transform8x8_SSE4_1_INTRIN,
-        Transform4x4_SSE2_INTRIN,
-        DstTransform4x4_SSE2_INTRIN
-    },
-};
+extern void InvTransformRecon4x4_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static const EB_INVTRANSFORM_FUNC invTransformFunctionTableEstimate[EB_ASM_TYPE_TOTAL][5] = {
-        // C_DEFAULT
-        {
-            InvTransform32x32,
-            InvTransform16x16,
-            InvTransform8x8,
-            InvTransform4x4,
-            InvDstTransform4x4
-        },
-        // AVX2
-        {
-            EstimateInvTransform32x32_SSE2,
-            EstimateInvTransform16x16_SSE2,
-            InvTransform8x8_SSE2_INTRIN,
-            InvTransform4x4_SSE2_INTRIN,
-            InvDstTransform4x4_SSE2_INTRIN
-        },
-};
+extern void InvDstTransformRecon4x4_16bit(
+    EB_S16                  *transformCoefficients,
+    const EB_U32             srcStride,
+    EB_U16                  *predPtr,
+    const EB_U32             predStride,
+    EB_U16                  *reconPtr,
+    const EB_U32             reconStride,
+    EB_S16                  *transformInnerArrayPtr,
+    EB_U32                   bitIncrement);
 
-static const EB_INVTRANSFORM_FUNC invTransformFunctionTableEncode[EB_ASM_TYPE_TOTAL][5] = {
-        // C_DEFAULT
-        {
-            InvTransform32x32,
-            InvTransform16x16,
-            InvTransform8x8,
-            InvTransform4x4,
-            InvDstTransform4x4
-        },
-        // AVX2
-        {
-            PFinvTransform32x32_SSSE3,
-            PFinvTransform16x16_SSSE3,
-            InvTransform8x8_SSE2_INTRIN,
-            InvTransform4x4_SSE2_INTRIN,
-            InvDstTransform4x4_SSE2_INTRIN
-        },
-};
+typedef EB_ERRORTYPE(*PM_RATE_EST_TYPE)(
+    CabacCost_t                  *CabacCost,
+    CabacEncodeContext_t         *cabacEncodeCtxPtr,
+    EB_U32                        size,
+    EB_MODETYPE                   type,                 // Input: CU type (INTRA, INTER)
+    EB_U32                        intraLumaMode,
+    EB_U32                        intraChromaMode,
+    EB_S16                       *coeffBufferPtr,
+    const EB_U32                  coeffStride,
+    EB_U32                        componentType,
+    EB_U32                        numNonZeroCoeffs,
+    EB_U64                       *coeffBitsLong);
+
+EB_ERRORTYPE PmEstimateQuantCoeffLuma_SSE2(
+    CabacCost_t                  *CabacCost,
+    CabacEncodeContext_t         *cabacEncodeCtxPtr,
+    EB_U32                        size,                 // Input: TU size
+    EB_MODETYPE                   type,                 // Input: CU type (INTRA, INTER)
+    EB_U32                        intraLumaMode,
+    EB_U32                        intraChromaMode,
+    EB_S16                       *coeffBufferPtr,
+    const EB_U32                  coeffStride,
+    EB_U32                        componentType,
+    EB_U32                        numNonZeroCoeffs,
+    EB_U64                       *coeffBitsLong);
+
+EB_ERRORTYPE PmEstimateQuantCoeffChroma_SSE2(
+    CabacCost_t                  *CabacCost,
+    CabacEncodeContext_t         *cabacEncodeCtxPtr,
+    EB_U32                        size,                 // Input: TU size
+    EB_MODETYPE                   type,                 // Input: CU type (INTRA, INTER)
+    EB_U32                        intraLumaMode,
+    EB_U32                        intraChromaMode,
+    EB_S16                       *coeffBufferPtr,
+    const EB_U32                  coeffStride,
+    EB_U32                        componentType,
+    EB_U32                        numNonZeroCoeffs,
+    EB_U64                       *coeffBitsLong);
 
 #ifdef __cplusplus
 }
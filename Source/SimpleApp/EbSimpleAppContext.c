@@ -90,6 +90,8 @@ EB_ERRORTYPE EbAppContextCtor(EbAppContext_t *contextPtr, EbConfig_t *config)
     contextPtr->inputPictureBuffer->nSize = sizeof(EB_BUFFERHEADERTYPE);
     contextPtr->inputPictureBuffer->pAppPrivate = NULL;
     contextPtr->inputPictureBuffer->sliceType = EB_INVALID_SLICE;
+    contextPtr->inputPictureBuffer->wrapperPtr = NULL;
+    contextPtr->inputPictureBuffer->pStats = NULL;
     // Allocate frame buffer for the pBuffer
     AllocateFrameBuffer(
         config,
@@ -106,6 +108,8 @@ EB_ERRORTYPE EbAppContextCtor(EbAppContext_t *contextPtr, EbConfig_t *config)
     contextPtr->outputStreamBuffer->nAllocLen = EB_OUTPUTSTREAMBUFFERSIZE_MACRO(config->sourceWidth*config->sourceHeight);
     contextPtr->outputStreamBuffer->pAppPrivate = NULL;
     contextPtr->outputStreamBuffer->sliceType = EB_INVALID_SLICE;
+    contextPtr->outputStreamBuffer->wrapperPtr = NULL;
+    contextPtr->outputStreamBuffer->pStats = NULL;
     
     // recon buffer
     if (config->reconFile) {
@@ -125,6 +129,8 @@ EB_ERRORTYPE EbAppContextCtor(EbAppContext_t *contextPtr, EbConfig_t *config)
 
         contextPtr->reconBuffer->nAllocLen = (unsigned int)frameSize;
         contextPtr->reconBuffer->pAppPrivate = NULL;
+        contextPtr->reconBuffer->wrapperPtr = NULL;
+        contextPtr->reconBuffer->pStats = NULL;
     }
     return EB_ErrorNone;
 }
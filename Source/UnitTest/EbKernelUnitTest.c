@@ -0,0 +1,1265 @@
+/*
+* Copyright(c) 2018 Intel Corporation
+* SPDX - License - Identifier: BSD - 2 - Clause - Patent
+*/
+
+// Kernel bit-exactness test
+//  -Fills the test buffers with random samples and coefficients, with random strides,
+//   block sizes, fractional positions, filter strengths and offsets
+//  -Runs every kernel of the run-time dispatch table (rtcd) through the C_DEFAULT
+//   table and through each ASM tier (SSE, AVX2, AVX-512) the CPU supports, on
+//   identical copies of the buffers
+//  -Fails when the two copies, or the kernels' return values, differ
+//
+// Usage: SvtHevcKernelUnitTest [-iterations <n>] [-seed <n>] [-filter <kernel substring>]
+
+/***************************************
+ * Includes
+ ***************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "EbDefinitions.h"
+#include "EbRtcd.h"
+#include "EbEncHandle.h"
+#include "EbTransforms.h"
+
+/***************************************
+ * Test data
+ ***************************************/
+#define TEST_STRIDE_MAX             192
+#define TEST_ROWS                   192
+#define TEST_BUFFER_SIZE            (TEST_STRIDE_MAX * TEST_ROWS)
+#define TEST_BORDER                 16      // kernels read up to 8 samples outside the block
+#define TEST_DEFAULT_ITERATIONS     16
+
+typedef struct TestData_s
+{
+    EB_U8   src[TEST_BUFFER_SIZE];
+    EB_U8   ref[TEST_BUFFER_SIZE];
+    EB_U8   aux[TEST_BUFFER_SIZE];
+    EB_U8   dst[TEST_BUFFER_SIZE];
+    EB_U16  src16[TEST_BUFFER_SIZE];
+    EB_U16  ref16[TEST_BUFFER_SIZE];
+    EB_U16  dst16[TEST_BUFFER_SIZE];
+    EB_S16  coeff[TEST_BUFFER_SIZE];
+    EB_S16  residual[TEST_BUFFER_SIZE];
+    EB_S16  raw0[TEST_BUFFER_SIZE];
+    EB_S16  raw1[TEST_BUFFER_SIZE];
+    EB_S16  out[TEST_BUFFER_SIZE];
+    EB_U32  stats[1024];                    // small outputs: SAD, MVs, SAO statistics, ...
+} TestData_t;
+
+static TestData_t testInput;
+static TestData_t testRef;
+static TestData_t testOpt;
+
+// Intermediate buffers; their content is not compared
+static EB_S16 testScratch[TEST_BUFFER_SIZE];
+static EB_S16 testRaw0[TEST_BUFFER_SIZE];
+static EB_S16 testRaw1[TEST_BUFFER_SIZE];
+static EB_S16 testCoeff[TEST_BUFFER_SIZE];
+
+// Table the kernel under test is taken from, for cases that chain two kernels
+static const EbRtcd_t *testKernels;
+
+#define TEST_BLOCK(buffer, stride)  ((buffer) + TEST_BORDER * (stride) + TEST_BORDER)
+
+/***************************************
+ * Per-iteration parameters
+ ***************************************/
+typedef struct TestSize_s
+{
+    EB_U32       width;
+    EB_U32       height;
+} TestSize_t;
+
+typedef struct TestParams_s
+{
+    EB_U32       stride;
+    EB_U32       width;
+    EB_U32       height;
+    EB_U32       random;        // kernel-specific choice: position, angle, edge direction, ...
+    EB_S32       tc;
+    EB_S32       beta;
+    EB_S8        saoOffset[16];
+    EB_U32       saoBand;
+} TestParams_t;
+
+/***************************************
+ * Kernel cases
+ ***************************************/
+typedef enum TestFill_e
+{
+    TEST_FILL_RANDOM,           // uniform samples, sometimes only 0 and the maximum
+    TEST_FILL_SMOOTH            // noisy ramps, so that deblocking decisions vary
+} TestFill_t;
+
+typedef struct TestCase_s
+{
+    const char          *kernel;        // rtcd member, with its candidate index
+    const TestSize_t    *sizes;         // block sizes to pick from, ends with { 0, 0 }
+    TestFill_t           fill;
+    EB_U64             (*run)(const void *slot, TestData_t *data, const TestParams_t *params);
+    size_t               offset;        // offset of the member in EbRtcd_t
+    size_t               size;          // size of the member in EbRtcd_t
+    size_t               pairOffset;    // second member the run function calls, if any
+    size_t               pairSize;
+} TestCase_t;
+
+#define TEST_MEMBER(member) \
+    (size_t)((const EB_U8*)&rtcd.member - (const EB_U8*)&rtcd), sizeof(rtcd.member)
+
+#define TEST_CASE_FILL(member, sizes, fill, run) \
+    { #member, sizes, fill, run, TEST_MEMBER(member), 0, 0 }
+
+#define TEST_CASE_PAIR(member, pairMember, sizes, run) \
+    { #member "+" #pairMember, sizes, TEST_FILL_RANDOM, run, TEST_MEMBER(member), TEST_MEMBER(pairMember) }
+
+#define TEST_CASE(member, sizes, run) \
+    TEST_CASE_FILL(member, sizes, TEST_FILL_RANDOM, run)
+
+#define TEST_KERNEL(type, slot)         (*(const type*)(slot))
+#define TEST_KERNEL_AT(type, slot, i)   (((const type*)(slot))[i])
+
+static const TestSize_t TestSizes8[] = { { 8, 8 }, { 0, 0 } };
+static const TestSize_t TestSizes16[] = { { 16, 16 }, { 0, 0 } };
+static const TestSize_t TestSizes64[] = { { 64, 64 }, { 0, 0 } };
+static const TestSize_t TestSizes32x8[] = { { 32, 8 }, { 0, 0 } };
+static const TestSize_t TestSizesTu[] = { { 4, 4 }, { 8, 8 }, { 16, 16 }, { 32, 32 }, { 0, 0 } };
+static const TestSize_t TestSizesCu[] = { { 4, 4 }, { 8, 8 }, { 16, 16 }, { 32, 32 }, { 64, 64 }, { 0, 0 } };
+static const TestSize_t TestSizesLumaPicture[] = { { 128, 160 }, { 0, 0 } };
+static const TestSize_t TestSizesChromaPicture[] = { { 64, 80 }, { 0, 0 } };
+static const TestSize_t TestSizesBlockHash[] = { { 128, 128 }, { 96, 72 }, { 64, 64 }, { 0, 0 } };
+static const TestSize_t TestSizesLcu[] = { { 64, 64 }, { 32, 32 }, { 64, 56 }, { 56, 64 }, { 48, 40 }, { 32, 16 }, { 0, 0 } };
+
+// Picture edge LCUs too, whose width picks the C_DEFAULT slot of the 16bit gathers
+static const TestSize_t TestSizesSaoGather[] = {
+    { 64, 64 }, { 32, 32 }, { 64, 56 }, { 56, 64 }, { 48, 40 }, { 40, 24 }, { 24, 64 }, { 8, 8 }, { 0, 0 }
+};
+
+// Sixteenth-resolution LCUs of HME level 0, searched every other row
+static const TestSize_t TestSizesHme[] = {
+    { 4, 2 }, { 4, 4 }, { 4, 8 }, { 8, 2 }, { 8, 4 }, { 8, 8 }, { 16, 2 }, { 16, 4 }, { 16, 6 }, { 16, 8 }, { 0, 0 }
+};
+
+// Luma PU sizes of the SAD kernels, which are indexed by width >> 3
+static const TestSize_t TestSizesSad[] = {
+    { 4, 4 }, { 4, 8 }, { 8, 4 }, { 8, 8 }, { 8, 16 }, { 8, 32 }, { 16, 4 }, { 16, 8 }, { 16, 12 }, { 16, 16 },
+    { 16, 32 }, { 16, 64 }, { 24, 32 }, { 32, 8 }, { 32, 16 }, { 32, 24 }, { 32, 32 }, { 32, 64 }, { 48, 64 },
+    { 64, 16 }, { 64, 32 }, { 64, 48 }, { 64, 64 }, { 0, 0 }
+};
+
+static const TestSize_t TestSizesLumaPu[] = {
+    { 4, 8 }, { 8, 4 }, { 8, 8 }, { 8, 16 }, { 12, 16 }, { 16, 4 }, { 16, 8 }, { 16, 12 }, { 16, 16 }, { 16, 32 },
+    { 16, 64 }, { 24, 32 }, { 32, 8 }, { 32, 16 }, { 32, 24 }, { 32, 32 }, { 32, 64 }, { 48, 64 }, { 64, 16 },
+    { 64, 32 }, { 64, 48 }, { 64, 64 }, { 0, 0 }
+};
+
+// Search-area widths of the AVC-style filters, with odd heights for the row-pair kernels
+static const TestSize_t TestSizesAvcStyle[] = {
+    { 8, 8 }, { 8, 5 }, { 16, 16 }, { 24, 7 }, { 32, 32 }, { 48, 3 }, { 64, 64 }, { 128, 65 }, { 0, 0 }
+};
+
+static const TestSize_t TestSizesChromaPu[] = {
+    { 2, 4 }, { 4, 2 }, { 4, 4 }, { 4, 8 }, { 6, 8 }, { 8, 2 }, { 8, 4 }, { 8, 6 }, { 8, 8 }, { 8, 16 },
+    { 8, 32 }, { 12, 16 }, { 16, 4 }, { 16, 8 }, { 16, 12 }, { 16, 16 }, { 16, 32 }, { 24, 32 }, { 32, 8 },
+    { 32, 16 }, { 32, 24 }, { 32, 32 }, { 0, 0 }
+};
+
+static EB_U64 TestSad(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    return TEST_KERNEL_AT(EB_SADKERNELNxM_TYPE, slot, p->width >> 3)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->ref, p->stride) + (p->random & 7), p->stride, p->height, p->width);
+}
+
+static EB_U64 TestSadAveraging(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    return TEST_KERNEL_AT(EB_SADAVGKERNELNxM_TYPE, slot, p->width >> 3)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->ref, p->stride) + (p->random & 7), p->stride,
+        TEST_BLOCK(d->aux, p->stride) + ((p->random >> 3) & 7), p->stride, p->height, p->width);
+}
+
+static EB_U64 TestSadLoop(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U64 *bestSad = (EB_U64*)d->stats;
+    EB_S16 *searchCenter = (EB_S16*)(d->stats + 2);
+
+    *bestSad = ~(EB_U64)0;
+    TEST_KERNEL(EB_SADLOOPKERNELNxM_TYPE, slot)(
+        TEST_BLOCK(d->src, p->stride),
+        p->stride,
+        TEST_BLOCK(d->ref, p->stride),
+        p->stride,
+        p->height,
+        p->width,
+        bestSad,
+        &searchCenter[0],
+        &searchCenter[1],
+        p->stride,
+        (EB_S16)(8 + (p->random & 63)),
+        (EB_S16)(8 + ((p->random >> 6) & 31)));
+    return 0;
+}
+
+// HME level 0 searches areas a multiple of 16 wide from the packed
+// sixteenth-resolution LCU buffer
+static EB_U64 TestHmeLevel0SadLoop(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U64 *bestSad = (EB_U64*)d->stats;
+    EB_S16 *searchCenter = (EB_S16*)(d->stats + 2);
+
+    *bestSad = ~(EB_U64)0;
+    TEST_KERNEL(EB_SADLOOPKERNELNxM_TYPE, slot)(
+        TEST_BLOCK(d->src, MAX_LCU_SIZE >> 2),
+        MAX_LCU_SIZE >> 2,
+        TEST_BLOCK(d->ref, p->stride),
+        p->stride,
+        p->height,
+        p->width,
+        bestSad,
+        &searchCenter[0],
+        &searchCenter[1],
+        p->stride,
+        (EB_S16)(16 + (p->random & 48)),
+        (EB_S16)(8 + ((p->random >> 6) & 31)));
+    return 0;
+}
+
+// SADs in their encoder range, from a generator seeded by the parameters so that
+// both runs of an iteration see the same values. Half of them are MAX_SAD_VALUE
+// of EbMotionEstimation.c, the initial best SAD.
+static void TestInitSads(EB_U32 *sad, EB_U32 count, EB_U32 maxSad, EB_U32 seed)
+{
+    EB_U32 index;
+
+    for (index = 0; index < count; ++index) {
+        seed = seed * 1103515245 + 12345;
+        sad[index] = ((seed >> 16) & 1) ? 64 * 64 * 255 : (seed >> 8) % maxSad;
+    }
+}
+
+static EB_U64 TestMeSad8x8And16x16(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U32 *stats = d->stats;
+
+    TestInitSads(&stats[0], 5, 16 * 16 * 255, p->random);
+    TEST_KERNEL(EB_SADCALCULATION8X8AND16X16_TYPE, slot)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->ref, p->stride) + (p->random & 7), p->stride,
+        &stats[0], &stats[4], &stats[5], &stats[9], p->random, &stats[10]);
+    return 0;
+}
+
+static EB_U64 TestMeSad32x32And64x64(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U32 *stats = d->stats;
+    EB_U32 index;
+
+    // 16x16 SADs of the 64x64 block, then its best 32x32 and 64x64 SADs
+    TestInitSads(&stats[64], 16, 16 * 16 * 255 + 1, p->random);
+    for (index = 64; index < 80; ++index) {
+        stats[index] %= 16 * 16 * 255 + 1;
+    }
+    TestInitSads(&stats[0], 5, 64 * 64 * 255, p->random ^ 0x5A5A5A5A);
+    TEST_KERNEL(EB_SADCALCULATION32X32AND64X64_TYPE, slot)(&stats[64], &stats[0], &stats[4], &stats[5], &stats[9], p->random);
+    return 0;
+}
+
+static EB_U64 TestResidual(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_RESDKERNEL_TYPE, slot, p->width >> 3)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->ref, p->stride), p->stride, d->residual, p->stride, p->width, p->height);
+    return 0;
+}
+
+static EB_U64 TestResidual16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_RESDKERNEL_TYPE_16BIT, slot)(
+        TEST_BLOCK(d->src16, p->stride), p->stride, TEST_BLOCK(d->ref16, p->stride), p->stride, d->residual, p->stride, p->width, p->height);
+    return 0;
+}
+
+static EB_U64 TestPicCopy(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_PICCOPY_TYPE, slot, p->width >> 3)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->dst, p->stride), p->stride, p->width, p->height);
+    return 0;
+}
+
+static EB_U64 TestAddition(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_ADDDKERNEL_TYPE, slot, p->width >> 3)(
+        TEST_BLOCK(d->ref, p->stride), p->stride, d->residual, p->stride, TEST_BLOCK(d->dst, p->stride), p->stride, p->width, p->height);
+    return 0;
+}
+
+static EB_U64 TestAddition16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_ADDDKERNEL_TYPE_16BIT, slot)(
+        TEST_BLOCK(d->ref16, p->stride), p->stride, d->residual, p->stride, TEST_BLOCK(d->dst16, p->stride), p->stride, p->width, p->height);
+    return 0;
+}
+
+static EB_U64 TestSpatialDistortion(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    return TEST_KERNEL_AT(EB_SPATIALFULLDIST_TYPE, slot, Log2f(p->width) - 2)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->ref, p->stride), p->stride, p->width, p->height);
+}
+
+static EB_U64 TestPictureSse(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    return TEST_KERNEL(EB_SPATIALFULLDIST_TYPE, slot)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->ref, p->stride), p->stride, p->width, p->height);
+}
+
+static EB_U64 TestPictureSse16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    return TEST_KERNEL(EB_SPATIALFULLDIST16BIT_TYPE, slot)(
+        TEST_BLOCK(d->src16, p->stride), p->stride, TEST_BLOCK(d->ref16, p->stride), p->stride, p->width, p->height);
+}
+
+static EB_U64 TestBlockHash(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    // One hash per sample position, in raw0
+    TEST_KERNEL(EB_BLOCKHASH_TYPE, slot)(
+        TEST_BLOCK(d->src, p->stride), p->stride, p->width, p->height, (EB_U32*)d->raw0);
+    return 0;
+}
+
+static EB_U64 TestFullDistortion(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    // [cbf][intra][size]
+    const EB_U32 cbf = p->random & 1;
+    const EB_U32 intra = (p->random >> 1) & 1;
+
+    TEST_KERNEL_AT(EB_FULLDIST_TYPE, slot, (cbf * 2 + intra) * 9 + (p->width >> 3))(
+        d->coeff, p->stride, d->residual, p->stride, (EB_U64*)d->stats, p->width, p->height);
+    return 0;
+}
+
+static EB_U64 TestSatd(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    (void)p;
+    return TEST_KERNEL(EB_SATD_TYPE, slot)(d->residual);
+}
+
+static EB_U64 TestSatdU8(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U64 dcValue = 0;
+    EB_U64 satd = TEST_KERNEL(EB_SATD_U8_TYPE, slot)(TEST_BLOCK(d->src, p->stride), &dcValue, p->stride);
+
+    return satd ^ (dcValue << 32);
+}
+
+static EB_U64 TestMean(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    return TEST_KERNEL_AT(EB_COMPUTE_MEAN_FUNC, slot, p->random & 1)(TEST_BLOCK(d->src, p->stride), p->stride, 8, 8);
+}
+
+static EB_U64 TestIntermVarFour8x8(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U64 *stats = (EB_U64*)d->stats;
+
+    TEST_KERNEL(EB_COMPUTE_INTERM_VAR_FUNC, slot)(TEST_BLOCK(d->src, p->stride), (EB_U16)p->stride, &stats[0], &stats[4]);
+    return 0;
+}
+
+static EB_U64 TestDecimateAverage(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_DECIMAVG_TYPE, slot, p->random & 1)(
+        TEST_BLOCK(d->src, p->stride), p->stride << 1, TEST_BLOCK(d->dst, p->stride), p->stride, p->width >> 1, p->height >> 1);
+    return 0;
+}
+
+static EB_U64 TestSumResidual(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    return (EB_U64)(EB_S64)TEST_KERNEL(EB_SUM_RES, slot)(d->residual, p->width, p->stride);
+}
+
+static EB_U64 TestMemset16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_MEMSET16bitBLK, slot)(d->residual, p->stride, p->width, (EB_S16)p->random);
+    return 0;
+}
+
+static EB_U64 TestZeroOutCoeff(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_ZEROCOEFF_TYPE, slot, p->width >> 3)(d->coeff, p->stride, (p->random & 7) * p->stride + (p->random & 8), p->width, p->height);
+    return 0;
+}
+
+// Reference samples as laid out by IntraPrediction.c: left column, corner, top row
+static EB_U64 TestIntra(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_INTRA_NOANG_TYPE, slot)(p->width, d->aux, TEST_BLOCK(d->dst, p->stride), p->stride, (EB_BOOL)(p->random & 1));
+    return 0;
+}
+
+// The encoder never asks for DC prediction on every other row
+static EB_U64 TestIntraDC(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_INTRA_NOANG_TYPE, slot)(p->width, d->aux, TEST_BLOCK(d->dst, p->stride), p->stride, EB_FALSE);
+    return 0;
+}
+
+static EB_U64 TestIntra16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_INTRA_NOANG_16bit_TYPE, slot)(p->width, d->ref16, TEST_BLOCK(d->dst16, p->stride), p->stride, (EB_BOOL)(p->random & 1));
+    return 0;
+}
+
+// Positive angles only read the main reference array
+static const EB_S32 TestIntraAngles[] = { 2, 5, 9, 13, 17, 21, 26, 32 };
+
+static EB_U64 TestIntraAngular(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_INTRA_ANG_TYPE, slot)(
+        p->width, d->aux + (p->width << 1), TEST_BLOCK(d->dst, p->stride), p->stride, (EB_BOOL)(p->random & 1), TestIntraAngles[(p->random >> 1) & 7]);
+    return 0;
+}
+
+static EB_U64 TestIntraAngular16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_INTRA_ANG_16BIT_TYPE, slot)(
+        p->width, d->ref16 + (p->width << 1), TEST_BLOCK(d->dst16, p->stride), p->stride, (EB_BOOL)(p->random & 1), TestIntraAngles[(p->random >> 1) & 7]);
+    return 0;
+}
+
+static EB_U64 TestIntraFilter16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_INTRA_REF_FILTER_16BIT_TYPE, slot)(d->ref16, d->dst16, (p->width << 2) + 1);
+    return 0;
+}
+
+// Transform tables are indexed by Log2f(TRANSFORM_MAX_SIZE) - Log2f(size), DST 4x4 at 4
+static EB_U32 TestTransformIndex(const TestParams_t *p)
+{
+    return (p->width == 4 && (p->random & 1)) ? 4 : Log2f(TRANSFORM_MAX_SIZE) - Log2f(p->width);
+}
+
+// Residuals are 10-bit; 8-bit ones are scaled down to their range
+static EB_U64 TestForwardTransform(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    const EB_U32 bitIncrement = (p->random >> 1) & 2;
+    EB_U32 index;
+
+    if (bitIncrement == 0) {
+        for (index = 0; index < TEST_BUFFER_SIZE; ++index) {
+            d->residual[index] >>= 2;
+        }
+    }
+    TEST_KERNEL_AT(EB_TRANSFORM_FUNC, slot, TestTransformIndex(p))(d->residual, p->stride, d->out, p->stride, testScratch, bitIncrement);
+    return 0;
+}
+
+// The 8-bit encode set overflows on 10-bit residuals
+static EB_U64 TestForwardTransform8bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U32 index;
+
+    for (index = 0; index < TEST_BUFFER_SIZE; ++index) {
+        d->residual[index] >>= 2;
+    }
+    TEST_KERNEL_AT(EB_TRANSFORM_FUNC, slot, TestTransformIndex(p))(d->residual, p->stride, d->out, p->stride, testScratch, 0);
+    return 0;
+}
+
+static EB_U64 TestInverseTransform(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_INVTRANSFORM_FUNC, slot, TestTransformIndex(p))(d->coeff, p->stride, d->out, p->stride, testScratch, (p->random >> 1) & 2);
+    return 0;
+}
+
+// The fused kernels may use the coefficient buffer as scratch
+static EB_U64 TestInverseTransformRecon(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_MEMCPY(testCoeff, d->coeff, sizeof(testCoeff));
+    TEST_KERNEL_AT(EB_INVTRANSFORM_RECON_FUNC, slot, TestTransformIndex(p))(
+        testCoeff, p->stride, TEST_BLOCK(d->ref, p->stride), p->stride, TEST_BLOCK(d->dst, p->stride), p->stride, testScratch, 0);
+    return 0;
+}
+
+static EB_U64 TestInverseTransformRecon16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_MEMCPY(testCoeff, d->coeff, sizeof(testCoeff));
+    TEST_KERNEL_AT(EB_INVTRANSFORM_RECON_16BIT_FUNC, slot, TestTransformIndex(p))(
+        testCoeff, p->stride, TEST_BLOCK(d->ref16, p->stride), p->stride, TEST_BLOCK(d->dst16, p->stride), p->stride, testScratch, 2);
+    return 0;
+}
+
+// Quantization parameters as derived in EbFullLoop.c
+static EB_U64 TestQiQ(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    const EB_S32 qp = (EB_S32)(p->random % 52);
+    const EB_S32 qpRem = qp % 6;
+    const EB_S32 qpPer = qp / 6;
+    const EB_U32 transformShiftNum = 7 - Log2f(p->width);
+    const EB_S32 shiftedQBits = QUANT_SHIFT + qpPer + transformShiftNum;
+    const EB_U32 qOffset = (((p->random >> 6) & 1) ? QUANT_OFFSET_I : QUANT_OFFSET_P) << (shiftedQBits - 9);
+    const EB_S32 shiftedFFunc = (qpPer > 8) ? (EB_S32)FFunc[qpRem] << (qpPer - 2) : (EB_S32)FFunc[qpRem] << qpPer;
+    const EB_S32 shiftNum = (qpPer > 8) ? QUANT_IQUANT_SHIFT - QUANT_SHIFT - transformShiftNum - 2 : QUANT_IQUANT_SHIFT - QUANT_SHIFT - transformShiftNum;
+
+    d->stats[0] = 0;
+    TEST_KERNEL_AT(EB_QIQ_TYPE, slot, p->width >> 3)(
+        d->coeff, p->stride, d->raw0, d->raw1, QFunc[qpRem], qOffset, shiftedQBits, shiftedFFunc, 1 << (shiftNum - 1), shiftNum, p->width, &d->stats[0]);
+    return 0;
+}
+
+static EB_U64 TestLumaUniPred(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(InterpolationFilterNew, slot, p->random & 15)(
+        TEST_BLOCK(d->ref, p->stride), p->stride, TEST_BLOCK(d->dst, p->stride), p->stride, p->width, p->height, testScratch);
+    return 0;
+}
+
+// Bi-pred intermediates are kernel-specific, so the raw filters are checked
+// together with the clipping kernel of the same table
+static EB_U64 TestLumaBiPred(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(InterpolationFilterOutRaw, slot, p->random & 15)(
+        TEST_BLOCK(d->ref, p->stride), p->stride, testRaw0, p->width, p->height, testScratch);
+    TEST_KERNEL_AT(InterpolationFilterOutRaw, slot, (p->random >> 4) & 15)(
+        TEST_BLOCK(d->aux, p->stride), p->stride, testRaw1, p->width, p->height, testScratch);
+    testKernels->biPredClipping(p->width, p->height, testRaw0, testRaw1, TEST_BLOCK(d->dst, p->stride), p->stride, Offset5);
+    return 0;
+}
+
+static EB_U64 TestLumaUniPred16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(InterpolationFilterNew16bit, slot, p->random & 15)(
+        TEST_BLOCK(d->ref16, p->stride), p->stride, TEST_BLOCK(d->dst16, p->stride), p->stride, p->width, p->height, testScratch);
+    return 0;
+}
+
+static EB_U64 TestLumaBiPred16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(InterpolationFilterOutRaw16bit, slot, p->random & 15)(
+        TEST_BLOCK(d->ref16, p->stride), p->stride, testRaw0, p->width, p->height, testScratch);
+    TEST_KERNEL_AT(InterpolationFilterOutRaw16bit, slot, (p->random >> 4) & 15)(
+        TEST_BLOCK(d->src16, p->stride), p->stride, testRaw1, p->width, p->height, testScratch);
+    testKernels->biPredClipping16bit(p->width, p->height, testRaw0, testRaw1, TEST_BLOCK(d->dst16, p->stride), p->stride);
+    return 0;
+}
+
+static EB_U64 TestAvcStyleUniPred(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(AvcStyleInterpolationFilterNew, slot, p->random % 3)(
+        TEST_BLOCK(d->ref, p->stride), p->stride, TEST_BLOCK(d->dst, p->stride), p->stride, p->width, p->height, (EB_BYTE)testScratch, 1 + (p->random >> 2) % 3);
+    return 0;
+}
+
+static EB_U64 TestChromaUniPred(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    const EB_U32 position = p->random & 63;
+
+    TEST_KERNEL_AT(ChromaFilterNew, slot, position)(
+        TEST_BLOCK(d->ref, p->stride), p->stride, TEST_BLOCK(d->dst, p->stride), p->stride, p->width, p->height, testScratch, position & 7, position >> 3);
+    return 0;
+}
+
+static EB_U64 TestChromaBiPred(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    const EB_U32 position0 = p->random & 63;
+    const EB_U32 position1 = (p->random >> 6) & 63;
+
+    TEST_KERNEL_AT(ChromaFilterOutRaw, slot, position0)(
+        TEST_BLOCK(d->ref, p->stride), p->stride, testRaw0, p->width, p->height, testScratch, position0 & 7, position0 >> 3);
+    TEST_KERNEL_AT(ChromaFilterOutRaw, slot, position1)(
+        TEST_BLOCK(d->aux, p->stride), p->stride, testRaw1, p->width, p->height, testScratch, position1 & 7, position1 >> 3);
+    testKernels->biPredClipping(p->width, p->height, testRaw0, testRaw1, TEST_BLOCK(d->dst, p->stride), p->stride, ChromaOffset5);
+    return 0;
+}
+
+static EB_U64 TestChromaUniPred16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    const EB_U32 position = p->random & 63;
+
+    TEST_KERNEL_AT(InterpolationFilterChromaNew16bit, slot, position)(
+        TEST_BLOCK(d->ref16, p->stride), p->stride, TEST_BLOCK(d->dst16, p->stride), p->stride, p->width, p->height, testScratch, position & 7, position >> 3);
+    return 0;
+}
+
+static EB_U64 TestChromaBiPred16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    const EB_U32 position0 = p->random & 63;
+    const EB_U32 position1 = (p->random >> 6) & 63;
+
+    TEST_KERNEL_AT(ChromaFilterOutRaw16bit, slot, position0)(
+        TEST_BLOCK(d->ref16, p->stride), p->stride, testRaw0, p->width, p->height, testScratch, position0 & 7, position0 >> 3);
+    TEST_KERNEL_AT(ChromaFilterOutRaw16bit, slot, position1)(
+        TEST_BLOCK(d->src16, p->stride), p->stride, testRaw1, p->width, p->height, testScratch, position1 & 7, position1 >> 3);
+    testKernels->biPredClipping16bit(p->width, p->height, testRaw0, testRaw1, TEST_BLOCK(d->dst16, p->stride), p->stride);
+    return 0;
+}
+
+static EB_U64 TestPictureAverage(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(PictureAverage, slot)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->ref, p->stride), p->stride, TEST_BLOCK(d->dst, p->stride), p->stride, p->width, p->height);
+    return 0;
+}
+
+// The edge is at the centre of the block, which holds every sample the filters may modify
+#define TEST_EDGE(buffer, p)    (TEST_BLOCK(buffer, (p)->stride) + ((p)->height >> 1) * (p)->stride + ((p)->width >> 1))
+
+static EB_U64 TestLumaDeblock4(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_LUMA4SAMPLEDGEDLF_FUNC, slot)(TEST_EDGE(d->dst, p), p->stride, (EB_BOOL)(p->random & 1), p->tc, p->beta);
+    return 0;
+}
+
+static EB_U64 TestLumaDeblock8(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_LUMA8SAMPLEDGEDLF_FUNC, slot)(
+        TEST_EDGE(d->dst, p), p->stride, (EB_BOOL)(p->random & 1), p->tc, p->beta, (p->random & 2) ? p->tc >> 1 : 0, p->beta);
+    return 0;
+}
+
+static EB_U64 TestChromaDeblock(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_CHROMA2SAMPLEDGEDLF_FUNC, slot)(
+        TEST_EDGE(d->dst, p), TEST_EDGE(d->aux, p), p->stride, (EB_BOOL)(p->random & 1), (EB_U8)p->tc, (EB_U8)(p->tc >> 1));
+    return 0;
+}
+
+static EB_U64 TestLumaDeblock16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_LUMADLF_TYPE_16BIT, slot)(TEST_EDGE(d->dst16, p), p->stride, (EB_BOOL)(p->random & 1), p->tc << 2, p->beta << 2);
+    return 0;
+}
+
+static EB_U64 TestLumaDeblock8Sample16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_LUMA8DLF_TYPE_16BIT, slot)(
+        TEST_EDGE(d->dst16, p), p->stride, (EB_BOOL)(p->random & 1), p->tc << 2, p->beta << 2, (p->random & 2) ? p->tc << 1 : 0, p->beta << 2);
+    return 0;
+}
+
+static EB_U64 TestChromaDeblock16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_CHROMADLF_TYPE_16BIT, slot)(
+        TEST_EDGE(d->dst16, p), TEST_EDGE(d->ref16, p), p->stride, (EB_BOOL)(p->random & 1), (EB_U8)(p->tc << 2), (EB_U8)(p->tc << 1));
+    return 0;
+}
+
+typedef EB_S32 TestEoDiff_t[SAO_EO_CATEGORIES + 1];
+typedef EB_U16 TestEoCount_t[SAO_EO_CATEGORIES + 1];
+
+// The last edge offset category is scratch space for the C kernels and is never read
+static void TestClearEoScratch(EB_U32 *stats)
+{
+    EB_U32 eoType;
+
+    for (eoType = 0; eoType < SAO_EO_TYPES; ++eoType) {
+        ((TestEoDiff_t*)&stats[128])[eoType][SAO_EO_CATEGORIES] = 0;
+        ((TestEoCount_t*)&stats[256])[eoType][SAO_EO_CATEGORIES] = 0;
+    }
+}
+
+static EB_U64 TestSaoGather(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U32 *stats = d->stats;
+
+    TEST_KERNEL(EB_SAOGATHER_FUNC, slot)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->ref, p->stride), p->stride, p->width, p->height,
+        (EB_S32*)&stats[0], (EB_U16*)&stats[64], (TestEoDiff_t*)&stats[128], (TestEoCount_t*)&stats[256]);
+    TestClearEoScratch(stats);
+    return 0;
+}
+
+static EB_U64 TestSaoGather904513590(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U32 *stats = d->stats;
+
+    TEST_KERNEL(EB_SAOGATHER_90_45_135_FUNC, slot)(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->ref, p->stride), p->stride, p->width, p->height,
+        (TestEoDiff_t*)&stats[128], (TestEoCount_t*)&stats[256]);
+    TestClearEoScratch(stats);
+    return 0;
+}
+
+static EB_U64 TestSaoGather16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U32 *stats = d->stats;
+
+    TEST_KERNEL_AT(EB_SAOGATHER_90_45_135_16bit_SSE2_FUNC, slot, ((p->width & 15) == 0) || (p->width == 56))(
+        TEST_BLOCK(d->src16, p->stride), p->stride, TEST_BLOCK(d->ref16, p->stride), p->stride, p->width, p->height,
+        (TestEoDiff_t*)&stats[128], (TestEoCount_t*)&stats[256]);
+    TestClearEoScratch(stats);
+    return 0;
+}
+
+static EB_U64 TestSaoGatherBoEo16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EB_U32 *stats = d->stats;
+
+    TEST_KERNEL_AT(EB_SAOGATHER_16bit_FUNC, slot, ((p->width & 15) == 0) || (p->width == 56))(
+        TEST_BLOCK(d->src16, p->stride), p->stride, TEST_BLOCK(d->ref16, p->stride), p->stride, p->width, p->height,
+        (EB_S32*)&stats[0], (EB_U16*)&stats[64], (TestEoDiff_t*)&stats[128], (TestEoCount_t*)&stats[256]);
+    TestClearEoScratch(stats);
+    return 0;
+}
+
+// SAO kernel selection as in EbEncDecProcess.c
+static EB_U32 TestSaoAligned(const TestParams_t *p)
+{
+    return ((p->height & 15) == 0) && ((p->width & 15) == 0) && (p->width >= 32);
+}
+
+// The SSSE3 kernels load the offsets as one 8 byte row
+typedef EB_S8 TestEoOffsets_t[8];
+
+// Edge offsets as reordered in EbEncDecProcess.c: positive for the valleys, none for
+// category 0, negative for the peaks
+static void TestEoOffsets(EB_S8 *offsets, const TestParams_t *p)
+{
+    memset(offsets, 0, sizeof(TestEoOffsets_t));
+    offsets[0] = (EB_S8)ABS(p->saoOffset[0]);
+    offsets[1] = (EB_S8)ABS(p->saoOffset[1]);
+    offsets[2] = 0;
+    offsets[3] = (EB_S8)-ABS(p->saoOffset[2]);
+    offsets[4] = (EB_S8)-ABS(p->saoOffset[3]);
+}
+
+static EB_U64 TestSaoBo(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_SAOAPPLY_BO_FUNC, slot, (p->width & 15) == 0 && p->height != MAX_LCU_SIZE_REMAINING)(
+        TEST_BLOCK(d->dst, p->stride), p->stride, p->saoBand, (EB_S8*)p->saoOffset, p->height, p->width);
+    return 0;
+}
+
+static EB_U64 TestSaoEo090(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TestEoOffsets_t offsets;
+    TestEoOffsets(offsets, p);
+    TEST_KERNEL_AT(EB_SAOAPPLY_EO_0_90_FUNC, slot, (p->random & 1) * 2 + TestSaoAligned(p))(
+        TEST_BLOCK(d->dst, p->stride), p->stride, d->aux + TEST_BORDER, offsets, p->height, p->width);
+    return 0;
+}
+
+static EB_U64 TestSaoEo13545(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TestEoOffsets_t offsets;
+    const EB_U32 lastRow = (p->height == MAX_LCU_SIZE_REMAINING) && ((p->width & 15) == 0) && (p->width >= 32);
+
+    TestEoOffsets(offsets, p);
+    TEST_KERNEL_AT(EB_SAOAPPLY_EO_135_45_FUNC, slot, (p->random & 1) * 4 + lastRow * 2 + TestSaoAligned(p))(
+        TEST_BLOCK(d->dst, p->stride), p->stride, d->aux + TEST_BORDER, d->aux + TEST_STRIDE_MAX + TEST_BORDER, offsets, p->height, p->width);
+    return 0;
+}
+
+static EB_U64 TestSaoBo16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_SAOAPPLY_BO_16bit_FUNC, slot, (p->width & 15) == 0)(
+        TEST_BLOCK(d->dst16, p->stride), p->stride, p->saoBand, (EB_S8*)p->saoOffset, p->height, p->width);
+    return 0;
+}
+
+static EB_U64 TestSaoEo090_16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TestEoOffsets_t offsets;
+    TestEoOffsets(offsets, p);
+    TEST_KERNEL_AT(EB_SAOAPPLY_EO_0_90_16bit_FUNC, slot, (p->random & 1) * 2 + TestSaoAligned(p))(
+        TEST_BLOCK(d->dst16, p->stride), p->stride, d->ref16 + TEST_BORDER, offsets, p->height, p->width);
+    return 0;
+}
+
+static EB_U64 TestSaoEo13545_16bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TestEoOffsets_t offsets;
+    const EB_U32 aligned = ((p->width & 15) == 0) && (p->width >= 32) && ((p->height & 7) == 0) && (p->height >= 8);
+
+    TestEoOffsets(offsets, p);
+    TEST_KERNEL_AT(EB_SAOAPPLY_EO_135_45_16bit_FUNC, slot, (p->random & 1) * 2 + aligned)(
+        TEST_BLOCK(d->dst16, p->stride), p->stride, d->ref16 + TEST_BORDER, d->ref16 + TEST_STRIDE_MAX + TEST_BORDER, offsets, p->height, p->width);
+    return 0;
+}
+
+// Pack / unpack kernels are indexed by ((width & 3) == 0) && ((height & 1) == 0)
+static EB_U64 TestPack2D(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_ENC_Pack2D_TYPE, slot, ((p->width & 3) == 0) && ((p->height & 1) == 0))(
+        TEST_BLOCK(d->src, p->stride), p->stride, TEST_BLOCK(d->aux, p->stride), TEST_BLOCK(d->dst16, p->stride), p->stride, p->stride, p->width, p->height);
+    return 0;
+}
+
+static EB_U64 TestUnPack2D(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_ENC_UnPack2D_TYPE, slot, ((p->width & 3) == 0) && ((p->height & 1) == 0))(
+        TEST_BLOCK(d->src16, p->stride), p->stride, TEST_BLOCK(d->dst, p->stride), TEST_BLOCK(d->aux, p->stride), p->stride, p->stride, p->width, p->height);
+    return 0;
+}
+
+static EB_U64 TestUnPack8Bit(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL_AT(EB_ENC_UnPack8BitData_TYPE, slot, ((p->width & 3) == 0) && ((p->height & 1) == 0))(
+        TEST_BLOCK(d->src16, p->stride), p->stride, TEST_BLOCK(d->dst, p->stride), p->stride, p->width, p->height);
+    return 0;
+}
+
+static EB_U64 TestUnPackAvg(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    TEST_KERNEL(EB_ENC_UnpackAvg_TYPE, slot)(
+        TEST_BLOCK(d->src16, p->stride), p->stride, TEST_BLOCK(d->ref16, p->stride), p->stride, TEST_BLOCK(d->dst, p->stride), p->stride, p->width, p->height);
+    return 0;
+}
+
+// Noise filters on a picture of the block size, at the block of the test buffers.
+// The whole-row filters run on LCU rows, as called for lcuOriginX == 0.
+static void TestPictureInit(EbPictureBufferDesc_t *picture, EB_BYTE buffer, EB_U32 subSampling, const TestParams_t *p)
+{
+    EB_MEMSET(picture, 0, sizeof(*picture));
+    picture->bufferY = buffer;
+    picture->bufferCb = buffer;
+    picture->bufferCr = buffer;
+    picture->strideY = (EB_U16)p->stride;
+    picture->strideCb = (EB_U16)p->stride;
+    picture->strideCr = (EB_U16)p->stride;
+    picture->originX = (EB_U16)(TEST_BORDER << subSampling);
+    picture->originY = (EB_U16)(TEST_BORDER << subSampling);
+    picture->width = (EB_U16)(p->width << subSampling);
+    picture->height = (EB_U16)(p->height << subSampling);
+    picture->maxWidth = picture->width;
+    picture->maxHeight = picture->height;
+    picture->bitDepth = EB_8BIT;
+    picture->colorFormat = EB_YUV420;
+}
+
+static EB_U64 TestWeakLumaFilter(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EbPictureBufferDesc_t input, denoised, noise;
+
+    TestPictureInit(&input, d->src, 0, p);
+    TestPictureInit(&denoised, d->dst, 0, p);
+    TestPictureInit(&noise, d->aux, 0, p);
+    TEST_KERNEL(EB_WEAKLUMAFILTER_TYPE, slot)(&input, &denoised, &noise, (p->random % ((p->height + MAX_LCU_SIZE - 1) / MAX_LCU_SIZE)) * MAX_LCU_SIZE, 0);
+    return 0;
+}
+
+// Only called for complete LCUs
+static EB_U64 TestWeakLumaFilterLcu(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EbPictureBufferDesc_t input, denoised, noise;
+
+    TestPictureInit(&input, d->src, 0, p);
+    TestPictureInit(&denoised, d->dst, 0, p);
+    TestPictureInit(&noise, d->aux, 0, p);
+    TEST_KERNEL(EB_WEAKLUMAFILTER_TYPE, slot)(
+        &input, &denoised, &noise, (p->random % (p->height / MAX_LCU_SIZE)) * MAX_LCU_SIZE, ((p->random >> 4) % (p->width / MAX_LCU_SIZE)) * MAX_LCU_SIZE);
+    return 0;
+}
+
+static EB_U64 TestStrongLumaFilter(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    EbPictureBufferDesc_t input, denoised;
+
+    TestPictureInit(&input, d->src, 0, p);
+    TestPictureInit(&denoised, d->dst, 0, p);
+    TEST_KERNEL(EB_STRONGLUMAFILTER_TYPE, slot)(&input, &denoised, (p->random % ((p->height + MAX_LCU_SIZE - 1) / MAX_LCU_SIZE)) * MAX_LCU_SIZE, 0);
+    return 0;
+}
+
+// The block is the chroma plane of a 4:2:0 picture; Cb and Cr share the buffers
+static EB_U64 TestChromaFilter(const void *slot, TestData_t *d, const TestParams_t *p)
+{
+    const EB_U32 lcuSize = MAX_LCU_SIZE >> 1;
+    EbPictureBufferDesc_t input, denoised;
+
+    TestPictureInit(&input, d->src, 1, p);
+    TestPictureInit(&denoised, d->dst, 1, p);
+    TEST_KERNEL(EB_STRONGCHROMAFILTER_TYPE, slot)(&input, &denoised, (p->random % ((p->height + lcuSize - 1) / lcuSize)) * lcuSize, 0);
+    return 0;
+}
+
+static const TestCase_t TestCases[] = {
+    // Picture operators
+    TEST_CASE(SumResidual, TestSizesTu, TestSumResidual),
+    TEST_CASE(memset16bitBlock, TestSizesTu, TestMemset16bit),
+    TEST_CASE(AdditionKernel, TestSizesCu, TestAddition),
+    TEST_CASE(AdditionKernel16bit, TestSizesLumaPu, TestAddition16bit),
+    TEST_CASE(PicCopyKernel, TestSizesCu, TestPicCopy),
+    TEST_CASE(ResidualKernel, TestSizesCu, TestResidual),
+    TEST_CASE(ResidualKernel16Bit, TestSizesLumaPu, TestResidual16bit),
+    TEST_CASE(PicZeroOutCoef, TestSizesTu, TestZeroOutCoeff),
+    TEST_CASE(FullDistortionIntrinsic, TestSizesTu, TestFullDistortion),
+    TEST_CASE(Compute8x8Satd, TestSizes8, TestSatd),
+    TEST_CASE(Compute8x8Satd_U8, TestSizes8, TestSatdU8),
+    TEST_CASE(Compute16x16Satd_U8, TestSizes16, TestSatdU8),
+    TEST_CASE(DecimateAverage, TestSizesCu, TestDecimateAverage),
+    TEST_CASE(SpatialFullDistortionKernel, TestSizesCu, TestSpatialDistortion),
+    TEST_CASE(PictureSse, TestSizesLcu, TestPictureSse),
+    TEST_CASE(PictureSse16bit, TestSizesLcu, TestPictureSse16bit),
+    TEST_CASE(BlockHash64x64, TestSizesBlockHash, TestBlockHash),
+
+    // Pack / unpack
+    TEST_CASE(Pack2D_16Bit_SRC, TestSizesLumaPu, TestPack2D),
+    TEST_CASE(UnPack2D_16Bit, TestSizesLumaPu, TestUnPack2D),
+    TEST_CASE(UnPack8BIT_16Bit, TestSizesLumaPu, TestUnPack8Bit),
+    TEST_CASE(UnPackAvg, TestSizesCu, TestUnPackAvg),
+
+    // SAD
+    TEST_CASE(NxMSadKernel, TestSizesSad, TestSad),
+    TEST_CASE(NxMSadAveragingKernel, TestSizesSad, TestSadAveraging),
+    TEST_CASE(NxMSadLoopKernel, TestSizesSad, TestSadLoop),
+    TEST_CASE(HmeLevel0SadLoopKernel, TestSizesHme, TestHmeLevel0SadLoop),
+
+    // ME SAD
+    TEST_CASE(SadCalculation_8x8_16x16, TestSizes16, TestMeSad8x8And16x16),
+    TEST_CASE(SadCalculation_32x32_64x64, TestSizes64, TestMeSad32x32And64x64),
+
+    // Mean
+    TEST_CASE(ComputeMeanFunc, TestSizes8, TestMean),
+    TEST_CASE(ComputeIntermVarFour8x8, TestSizes32x8, TestIntermVarFour8x8),
+
+    // Noise filters
+    TEST_CASE(WeakLumaFilter, TestSizesLumaPicture, TestWeakLumaFilter),
+    TEST_CASE(WeakLumaFilterLcu, TestSizesLumaPicture, TestWeakLumaFilterLcu),
+    TEST_CASE(StrongLumaFilter, TestSizesLumaPicture, TestStrongLumaFilter),
+    TEST_CASE(StrongChromaFilter, TestSizesChromaPicture, TestChromaFilter),
+    TEST_CASE(WeakChromaFilter, TestSizesChromaPicture, TestChromaFilter),
+
+    // Intra prediction
+    TEST_CASE(IntraVerticalLuma, TestSizesTu, TestIntra),
+    TEST_CASE(IntraVerticalLuma_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraVerticalChroma, TestSizesTu, TestIntra),
+    TEST_CASE(IntraVerticalChroma_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraHorzLuma, TestSizesTu, TestIntra),
+    TEST_CASE(IntraHorzLuma_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraHorzChroma, TestSizesTu, TestIntra),
+    TEST_CASE(IntraHorzChroma_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraDCLuma, TestSizesTu, TestIntraDC),
+    TEST_CASE(IntraDCLuma_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraDCChroma, TestSizesTu, TestIntra),
+    TEST_CASE(IntraDCChroma_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraPlanar, TestSizesTu, TestIntra),
+    TEST_CASE(IntraPlanar_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraAng34, TestSizesTu, TestIntra),
+    TEST_CASE(IntraAng34_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraAng18, TestSizesTu, TestIntra),
+    TEST_CASE(IntraAng18_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraAng2, TestSizesTu, TestIntra),
+    TEST_CASE(IntraAng2_16bit, TestSizesTu, TestIntra16bit),
+    TEST_CASE(IntraAngVertical, TestSizesTu, TestIntraAngular),
+    TEST_CASE(IntraAngVertical_16bit, TestSizesTu, TestIntraAngular16bit),
+    TEST_CASE(IntraAngHorizontal, TestSizesTu, TestIntraAngular),
+    TEST_CASE(IntraAngHorizontal_16bit, TestSizesTu, TestIntraAngular16bit),
+    TEST_CASE(IntraFilterReferenceSamples16bit, TestSizesTu, TestIntraFilter16bit),
+
+    // Motion compensated prediction
+    TEST_CASE(uniPredLumaIFNew, TestSizesLumaPu, TestLumaUniPred),
+    TEST_CASE(uniPredLuma16bitIF, TestSizesLumaPu, TestLumaUniPred16bit),
+    TEST_CASE_PAIR(biPredLumaIFNew, biPredClipping, TestSizesLumaPu, TestLumaBiPred),
+    TEST_CASE_PAIR(biPredLumaIFNew16bit, biPredClipping16bit, TestSizesLumaPu, TestLumaBiPred16bit),
+    TEST_CASE(AvcStyleUniPredLumaIF, TestSizesAvcStyle, TestAvcStyleUniPred),
+    TEST_CASE(uniPredChromaIFNew, TestSizesChromaPu, TestChromaUniPred),
+    TEST_CASE(uniPredChromaIFNew16bit, TestSizesChromaPu, TestChromaUniPred16bit),
+    TEST_CASE_PAIR(biPredChromaIFNew, biPredClipping, TestSizesChromaPu, TestChromaBiPred),
+    TEST_CASE_PAIR(biPredChromaIFNew16bit, biPredClipping16bit, TestSizesChromaPu, TestChromaBiPred16bit),
+
+    // AVC-style motion compensated prediction
+    TEST_CASE(PictureAverageKernel, TestSizesLumaPu, TestPictureAverage),
+
+    // Transforms / quantization
+    TEST_CASE(QiQ, TestSizesTu, TestQiQ),
+    TEST_CASE(transformFunctionTableEncode, TestSizesTu, TestForwardTransform8bit),
+    TEST_CASE(transformFunctionTableEncode16bit, TestSizesTu, TestForwardTransform),
+    TEST_CASE(invTransformFunctionTableEstimate, TestSizesTu, TestInverseTransform),
+    TEST_CASE(invTransformFunctionTableEncode, TestSizesTu, TestInverseTransform),
+    TEST_CASE(invTransformReconFunctionTable, TestSizesTu, TestInverseTransformRecon),
+    TEST_CASE(invTransformRecon16bitFunctionTable, TestSizesTu, TestInverseTransformRecon16bit),
+
+    // Deblocking filter
+    TEST_CASE_FILL(Luma4SampleEdgeDLFCore, TestSizes8, TEST_FILL_SMOOTH, TestLumaDeblock4),
+    TEST_CASE_FILL(Luma8SampleEdgeDLFCore, TestSizes16, TEST_FILL_SMOOTH, TestLumaDeblock8),
+    TEST_CASE_FILL(Chroma2SampleEdgeDLFCore, TestSizes8, TEST_FILL_SMOOTH, TestChromaDeblock),
+    TEST_CASE_FILL(lumaDlf16bit, TestSizes8, TEST_FILL_SMOOTH, TestLumaDeblock16bit),
+    TEST_CASE_FILL(lumaDlf8Sample16bit, TestSizes16, TEST_FILL_SMOOTH, TestLumaDeblock8Sample16bit),
+    TEST_CASE_FILL(chromaDlf16bit, TestSizes8, TEST_FILL_SMOOTH, TestChromaDeblock16bit),
+
+    // Sample adaptive offset
+    TEST_CASE(SaoGatherFunctionTableLossy, TestSizesSaoGather, TestSaoGather),
+    TEST_CASE(SaoGatherFunctionTableLossy_90_45_135, TestSizesSaoGather, TestSaoGather904513590),
+    TEST_CASE(SaoGatherFunctionTable_16bit, TestSizesSaoGather, TestSaoGatherBoEo16bit),
+    TEST_CASE(SaoGatherFunctionTable_90_45_135_16bit_SSE2, TestSizesSaoGather, TestSaoGather16bit),
+    TEST_CASE(SaoFunctionTableBo, TestSizesLcu, TestSaoBo),
+    TEST_CASE(SaoFunctionTableEO_0_90, TestSizesLcu, TestSaoEo090),
+    TEST_CASE(SaoFunctionTableEO_135_45, TestSizesLcu, TestSaoEo13545),
+    TEST_CASE(SaoFunctionTableBo_16bit, TestSizesLcu, TestSaoBo16bit),
+    TEST_CASE(SaoFunctionTableEO_0_90_16bit, TestSizesLcu, TestSaoEo090_16bit),
+    TEST_CASE(SaoFunctionTableEO_135_45_16bit, TestSizesLcu, TestSaoEo13545_16bit),
+};
+
+#define TEST_CASE_COUNT (sizeof(TestCases) / sizeof(TestCases[0]))
+
+/***************************************
+ * ASM tiers, as ASM_TYPES bit-fields
+ ***************************************/
+typedef struct TestTier_s
+{
+    const char  *name;
+    EB_U32       asmTypes;
+} TestTier_t;
+
+static const TestTier_t TestTiers[] = {
+    { "SSE",    PREAVX2_MASK },
+    { "AVX2",   PREAVX2_MASK | AVX2_MASK },
+    { "AVX512", PREAVX2_MASK | AVX2_MASK | AVX512_MASK },
+};
+
+#define TEST_TIER_COUNT (sizeof(TestTiers) / sizeof(TestTiers[0]))
+
+/***************************************
+ * TestFillData
+ *   8-bit samples, 10-bit samples, coefficients
+ *   and bi-pred intermediates in their encoder
+ *   ranges
+ ***************************************/
+static void TestFillData(TestData_t *d, TestFill_t fill)
+{
+    const EB_BOOL extremes = (fill == TEST_FILL_RANDOM && (rand() & 3) == 0) ? EB_TRUE : EB_FALSE;
+    const EB_S32 slope = rand() & 7;
+    EB_U32 index;
+
+    for (index = 0; index < TEST_BUFFER_SIZE; ++index) {
+        const EB_S32 x = (EB_S32)(index % TEST_STRIDE_MAX);
+        const EB_S32 y = (EB_S32)(index / TEST_STRIDE_MAX);
+
+        if (fill == TEST_FILL_SMOOTH) {
+            // Ramps with a step every 8 samples, as at block edges
+            const EB_S32 base = 64 + ((x * slope) >> 4) + ((y * slope) >> 4) + ((((x >> 3) + (y >> 3)) & 1) ? slope : 0);
+
+            d->src[index] = (EB_U8)(base + (rand() & 3));
+            d->ref[index] = (EB_U8)(base + (rand() & 3));
+            d->aux[index] = (EB_U8)(base + (rand() & 3));
+            d->dst[index] = (EB_U8)(base + (rand() & 3));
+            d->src16[index] = (EB_U16)((base << 2) + (rand() & 15));
+            d->ref16[index] = (EB_U16)((base << 2) + (rand() & 15));
+            d->dst16[index] = (EB_U16)((base << 2) + (rand() & 15));
+        }
+        else if (extremes) {
+            d->src[index] = (rand() & 1) ? 0xFF : 0;
+            d->ref[index] = (rand() & 1) ? 0xFF : 0;
+            d->aux[index] = (rand() & 1) ? 0xFF : 0;
+            d->dst[index] = (rand() & 1) ? 0xFF : 0;
+            d->src16[index] = (rand() & 1) ? 0x3FF : 0;
+            d->ref16[index] = (rand() & 1) ? 0x3FF : 0;
+            d->dst16[index] = (rand() & 1) ? 0x3FF : 0;
+        }
+        else {
+            d->src[index] = (EB_U8)(rand() & 0xFF);
+            d->ref[index] = (EB_U8)(rand() & 0xFF);
+            d->aux[index] = (EB_U8)(rand() & 0xFF);
+            d->dst[index] = (EB_U8)(rand() & 0xFF);
+            d->src16[index] = (EB_U16)(rand() & 0x3FF);
+            d->ref16[index] = (EB_U16)(rand() & 0x3FF);
+            d->dst16[index] = (EB_U16)(rand() & 0x3FF);
+        }
+
+        // Transform coefficients are sparse and mostly small
+        d->coeff[index] = (rand() & 3) ? 0 : (EB_S16)((rand() & 0x7FF) - 0x400);
+        d->residual[index] = (EB_S16)((rand() & 0x7FF) - 0x3FF);
+        d->raw0[index] = (EB_S16)(((rand() & 0xFF) << 6) - 8192);
+        d->raw1[index] = (EB_S16)(((rand() & 0xFF) << 6) - 8192);
+        d->out[index] = (EB_S16)rand();
+    }
+
+    for (index = 0; index < sizeof(d->stats) / sizeof(d->stats[0]); ++index) {
+        d->stats[index] = 0;
+    }
+}
+
+static void TestPickParams(TestParams_t *p, const TestCase_t *testCase)
+{
+    EB_U32 sizeCount = 0;
+    EB_U32 sizeIndex;
+    EB_U32 index;
+
+    while (testCase->sizes[sizeCount].width) {
+        ++sizeCount;
+    }
+    sizeIndex = (EB_U32)rand() % sizeCount;
+
+    p->width = testCase->sizes[sizeIndex].width;
+    p->height = testCase->sizes[sizeIndex].height;
+    p->stride = TEST_STRIDE_MAX - 16 * ((EB_U32)rand() % 3);
+    p->random = ((EB_U32)rand() << 16) ^ (EB_U32)rand();
+    p->tc = rand() % 25;
+    p->beta = rand() % 65;
+    p->saoBand = (EB_U32)rand() % 29;
+    for (index = 0; index < sizeof(p->saoOffset); ++index) {
+        p->saoOffset[index] = (EB_S8)(rand() % 15 - 7);
+    }
+}
+
+/***************************************
+ * TestSameKernels
+ ***************************************/
+static EB_BOOL TestSameKernels(const TestCase_t *testCase, const EbRtcd_t *first, const EbRtcd_t *second)
+{
+    const EB_U8 *base0 = (const EB_U8*)first;
+    const EB_U8 *base1 = (const EB_U8*)second;
+
+    return (memcmp(base0 + testCase->offset, base1 + testCase->offset, testCase->size) == 0 &&
+        memcmp(base0 + testCase->pairOffset, base1 + testCase->pairOffset, testCase->pairSize) == 0) ? EB_TRUE : EB_FALSE;
+}
+
+/***************************************
+ * TestCompare
+ *   dst and dst16 are only compared inside the
+ *   block: some kernels store whole vectors past
+ *   its right or bottom edge, which the encoder
+ *   allows since its buffers are padded. Every
+ *   other buffer is compared in full.
+ ***************************************/
+static EB_BOOL TestCompare(const TestParams_t *p, char *report, size_t reportSize)
+{
+    const EB_U8 *ref;
+    const EB_U8 *opt;
+    EB_U32 x, y;
+    size_t offset;
+
+    for (y = 0; y < p->height; ++y) {
+        for (x = 0; x < p->width; ++x) {
+            const EB_U32 index = (TEST_BORDER + y) * p->stride + TEST_BORDER + x;
+
+            if (testRef.dst[index] != testOpt.dst[index]) {
+                snprintf(report, reportSize, "dst at (%u, %u): %u vs %u", x, y, testRef.dst[index], testOpt.dst[index]);
+                return EB_FALSE;
+            }
+            if (testRef.dst16[index] != testOpt.dst16[index]) {
+                snprintf(report, reportSize, "dst16 at (%u, %u): %u vs %u", x, y, testRef.dst16[index], testOpt.dst16[index]);
+                return EB_FALSE;
+            }
+        }
+    }
+
+    EB_MEMCPY(testOpt.dst, testRef.dst, sizeof(testRef.dst));
+    EB_MEMCPY(testOpt.dst16, testRef.dst16, sizeof(testRef.dst16));
+
+    ref = (const EB_U8*)&testRef;
+    opt = (const EB_U8*)&testOpt;
+    for (offset = 0; offset < sizeof(TestData_t); ++offset) {
+        if (ref[offset] != opt[offset]) {
+            snprintf(report, reportSize, "byte %u of the test data: %u vs %u", (unsigned)offset, ref[offset], opt[offset]);
+            return EB_FALSE;
+        }
+    }
+
+    return EB_TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+    EbRtcd_t    rtcdRef;
+    EbRtcd_t    rtcdPrevious;
+    EB_U32      iterations = TEST_DEFAULT_ITERATIONS;
+    EB_U32      seed = 1;
+    const char *filter = NULL;
+    EB_U32      cpuAsmTypes = GetCpuAsmType();
+    EB_U32      tested = 0;
+    EB_U32      failed = 0;
+    EB_BOOL     firstTier = EB_TRUE;
+    EB_U32      tierIndex;
+    EB_U32      caseIndex;
+    EB_U32      iteration;
+    int         argIndex;
+
+    for (argIndex = 1; argIndex < argc; ++argIndex) {
+        if (strcmp(argv[argIndex], "-iterations") == 0 && argIndex + 1 < argc && atoi(argv[argIndex + 1]) > 0) {
+            iterations = (EB_U32)atoi(argv[++argIndex]);
+        }
+        else if (strcmp(argv[argIndex], "-seed") == 0 && argIndex + 1 < argc) {
+            seed = (EB_U32)strtoul(argv[++argIndex], NULL, 0);
+        }
+        else if (strcmp(argv[argIndex], "-filter") == 0 && argIndex + 1 < argc) {
+            filter = argv[++argIndex];
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-iterations <n>] [-seed <n>] [-filter <kernel substring>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (EbRtcdSetup(0) != EB_ErrorNone) {
+        return 1;
+    }
+    rtcdRef = rtcd;
+    rtcdPrevious = rtcd;
+
+    for (tierIndex = 0; tierIndex < TEST_TIER_COUNT; ++tierIndex) {
+        const TestTier_t *tier = &TestTiers[tierIndex];
+
+        if ((tier->asmTypes & ~cpuAsmTypes) != 0) {
+            printf("skipping %s: not supported by this CPU\n", tier->name);
+            continue;
+        }
+        if (EbRtcdSetup(tier->asmTypes) != EB_ErrorNone) {
+            return 1;
+        }
+
+        for (caseIndex = 0; caseIndex < TEST_CASE_COUNT; ++caseIndex) {
+            const TestCase_t *testCase = &TestCases[caseIndex];
+            const void       *slotRef = (const EB_U8*)&rtcdRef + testCase->offset;
+            const void       *slotOpt = (const EB_U8*)&rtcd + testCase->offset;
+            EB_BOOL           caseFailed = EB_FALSE;
+
+            if (filter && strstr(testCase->kernel, filter) == NULL) {
+                continue;
+            }
+
+            // Kernels still on C_DEFAULT, or already tested in the tier below, are skipped
+            if (TestSameKernels(testCase, &rtcd, &rtcdRef) ||
+                (!firstTier && TestSameKernels(testCase, &rtcd, &rtcdPrevious))) {
+                continue;
+            }
+
+            // The same random sequence for every tier
+            srand(seed + caseIndex);
+            for (iteration = 0; iteration < iterations && !caseFailed; ++iteration) {
+                TestParams_t params;
+                EB_U64       resultRef;
+                EB_U64       resultOpt;
+                char         report[128];
+
+                TestPickParams(&params, testCase);
+                TestFillData(&testInput, testCase->fill);
+
+                EB_MEMCPY(&testRef, &testInput, sizeof(TestData_t));
+                EB_MEMCPY(&testOpt, &testInput, sizeof(TestData_t));
+                testKernels = &rtcdRef;
+                resultRef = testCase->run(slotRef, &testRef, &params);
+                testKernels = &rtcd;
+                resultOpt = testCase->run(slotOpt, &testOpt, &params);
+
+                if (resultRef != resultOpt) {
+                    snprintf(report, sizeof(report), "result 0x%llx vs 0x%llx", (unsigned long long)resultRef, (unsigned long long)resultOpt);
+                    caseFailed = EB_TRUE;
+                }
+                else if (!TestCompare(&params, report, sizeof(report))) {
+                    caseFailed = EB_TRUE;
+                }
+
+                if (caseFailed) {
+                    printf("FAIL %s %s iteration %u: %ux%u stride %u random 0x%08x tc %d beta %d, %s\n",
+                        testCase->kernel, tier->name, iteration, params.width, params.height, params.stride,
+                        params.random, params.tc, params.beta, report);
+                }
+            }
+
+            ++tested;
+            if (caseFailed) {
+                ++failed;
+            }
+            else {
+                printf("ok   %s %s\n", testCase->kernel, tier->name);
+            }
+        }
+
+        rtcdPrevious = rtcd;
+        firstTier = EB_FALSE;
+    }
+
+    printf("%u kernel tables tested, %u failed\n", tested, failed);
+    return failed ? 1 : 0;
+}